@@ -6,11 +6,13 @@
 #include "App_SharedHeartbeatMonitor.h"
 #include "App_SharedRgbLedSequence.h"
 #include "App_Charger.h"
+#include "App_ChargeController.h"
 #include "App_OkStatus.h"
 #include "App_Accumulator.h"
 #include "App_CellMonitors.h"
 #include "App_Airs.h"
 #include "App_PreChargeSequence.h"
+#include "App_TractiveSystem.h"
 #include "App_SharedErrorTable.h"
 #include "App_SharedClock.h"
 
@@ -32,6 +34,7 @@ struct BmsWorld *App_BmsWorld_Create(
     struct HeartbeatMonitor * heartbeat_monitor,
     struct RgbLedSequence *   rgb_led_sequence,
     struct Charger *          charger,
+    struct ChargeController * charge_controller,
     struct OkStatus *         bms_ok,
     struct OkStatus *         imd_ok,
     struct OkStatus *         bspd_ok,
@@ -39,6 +42,7 @@ struct BmsWorld *App_BmsWorld_Create(
     struct CellMonitors *     cell_monitors,
     struct Airs *             airs,
     struct PreChargeSequence *pre_charge_sequence,
+    struct TractiveSystem *   tractive_system,
     struct ErrorTable *       error_table,
     struct Clock *            clock);
 
@@ -92,6 +96,14 @@ struct RgbLedSequence *
  */
 struct Charger *App_BmsWorld_GetCharger(const struct BmsWorld *world);
 
+/**
+ * Get the charge controller for the given world
+ * @param world The world to get the charge controller for
+ * @return The charge controller for the given world
+ */
+struct ChargeController *
+    App_BmsWorld_GetChargeController(const struct BmsWorld *world);
+
 /**
  * Get the BMS OK status for the given world
  * @param world The world to get BMS OK status for
@@ -142,6 +154,14 @@ struct Airs *App_BmsWorld_GetAirs(const struct BmsWorld *world);
 struct PreChargeSequence *
     App_BmsWorld_GetPreChargeSequence(const struct BmsWorld *world);
 
+/**
+ * Get the tractive system for the given world
+ * @param world The world to get the tractive system for
+ * @return The tractive system for the given world
+ */
+struct TractiveSystem *
+    App_BmsWorld_GetTractiveSystem(const struct BmsWorld *world);
+
 /**
  * Get the error table for the given world
  * @param world The world to get the error table from
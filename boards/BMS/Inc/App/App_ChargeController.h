@@ -0,0 +1,123 @@
+#pragma once
+
+#include <stdbool.h>
+
+#include "App_SharedExitCode.h"
+
+struct ChargeController;
+
+enum ChargeControllerMode
+{
+    CHARGE_CONTROLLER_OFF,
+    CHARGE_CONTROLLER_CONSTANT_CURRENT,
+    CHARGE_CONTROLLER_CONSTANT_VOLTAGE,
+    CHARGE_CONTROLLER_COMPLETE,
+};
+
+/**
+ * Allocate and initialize a CC/CV charge controller. The controller charges
+ * at constant current until the highest cell reaches the target cell voltage,
+ * then holds the highest cell at the target cell voltage while the current
+ * tapers off. The current is derated as the cells and the cell monitoring
+ * chips heat up.
+ * @param get_max_cell_voltage A function that returns the highest cell voltage,
+ *                             in V
+ * @param get_min_cell_voltage A function that returns the lowest cell voltage,
+ *                             in V
+ * @param read_cell_temperatures A function that can be called to read the cell
+ *                               temperatures from all thermistors
+ * @param get_max_cell_temperature A function that returns the highest cell
+ *                                 temperature as of the last read, in °C
+ * @param get_max_die_temperature A function that returns the highest cell
+ *                                monitoring chip die temperature, in °C
+ * @return The created charge controller, whose ownership is given to the
+ *         caller
+ */
+struct ChargeController *App_ChargeController_Create(
+    float (*get_max_cell_voltage)(void),
+    float (*get_min_cell_voltage)(void),
+    ExitCode (*read_cell_temperatures)(void),
+    float (*get_max_cell_temperature)(void),
+    float (*get_max_die_temperature)(void));
+
+/**
+ * Deallocate the memory used by the given charge controller
+ * @param charge_controller The charge controller to deallocate
+ */
+void App_ChargeController_Destroy(struct ChargeController *charge_controller);
+
+/**
+ * Start a new charge cycle in constant current mode, ramping the current
+ * setpoint up from 0A. The cell temperatures aren't read here, as this runs on
+ * entry to the charge state, but are marked as pending a read.
+ * @param charge_controller The charge controller to start
+ */
+void App_ChargeController_Start(struct ChargeController *charge_controller);
+
+/**
+ * Stop the charge cycle and set the current setpoint to 0A
+ * @param charge_controller The charge controller to stop
+ */
+void App_ChargeController_Stop(struct ChargeController *charge_controller);
+
+/**
+ * Read the cell temperatures used to derate the current of the given charge
+ * controller. Until the cell temperatures are read successfully, and for as
+ * long as they can't be read, no current is allowed.
+ * @param charge_controller The charge controller to read the cell
+ *                          temperatures for
+ * @return The exit code of reading the cell temperatures
+ */
+ExitCode App_ChargeController_ReadCellTemperatures(
+    struct ChargeController *charge_controller);
+
+/**
+ * Check if the cell temperatures of the given charge controller are yet to be
+ * read since its charge cycle was started
+ * @param charge_controller The charge controller to check
+ * @return true if the cell temperatures are pending a read, else false
+ */
+bool App_ChargeController_IsCellTemperatureReadPending(
+    const struct ChargeController *charge_controller);
+
+/**
+ * Update the current setpoint of the given charge controller. This is expected
+ * to be called every CHARGE_CONTROLLER_TICK_PERIOD_S.
+ * @param charge_controller The charge controller to update
+ */
+void App_ChargeController_Tick(struct ChargeController *charge_controller);
+
+/**
+ * Get the mode of the given charge controller
+ * @param charge_controller The charge controller to get the mode for
+ * @return The mode of the given charge controller
+ */
+enum ChargeControllerMode App_ChargeController_GetMode(
+    const struct ChargeController *charge_controller);
+
+/**
+ * Get the charger output current setpoint of the given charge controller
+ * @param charge_controller The charge controller to get the setpoint for
+ * @return The charger output current setpoint, in A
+ */
+float App_ChargeController_GetCurrentSetpoint(
+    const struct ChargeController *charge_controller);
+
+/**
+ * Get the charger output voltage setpoint of the given charge controller. The
+ * charger's own voltage limit is a backstop, the charge controller regulates
+ * the highest cell voltage through the current setpoint.
+ * @param charge_controller The charge controller to get the setpoint for
+ * @return The charger output voltage setpoint, in V
+ */
+float App_ChargeController_GetVoltageSetpoint(
+    const struct ChargeController *charge_controller);
+
+/**
+ * Get the fraction of the maximum current that is allowed by the cell and die
+ * temperature derating curves
+ * @param charge_controller The charge controller to get the derating for
+ * @return The derating factor, in [0, 1]
+ */
+float App_ChargeController_GetDeratingFactor(
+    const struct ChargeController *charge_controller);
@@ -48,8 +48,12 @@ struct Imd_Condition
  *                     IMD's PWM output
  * @pwm_frequency_tolerance: The acceptable tolerance when we map the IMD's PWM
  *                           output frequency to a condition
+ * @pwm_frequency_hysteresis: The additional tolerance allowed in the IMD's PWM
+ *                            output frequency before we leave the current
+ *                            condition
  * @get_pwm_duty_cycle: A function that can be called to get the duty cycle of
- *                      the IMD's PWM output
+ *                      the IMD's PWM output. Every tick, it is called right
+ *                      after get_pwm_frequency.
  * @get_seconds_since_power_on: A function that can be called to get the time of
  *                              the system, in milliseconds
  * @return A pointer to the created IMD, whose ownership is given to the caller
@@ -57,6 +61,7 @@ struct Imd_Condition
 struct Imd *App_Imd_Create(
     float (*get_pwm_frequency)(void),
     float pwm_frequency_tolerance,
+    float pwm_frequency_hysteresis,
     float (*get_pwm_duty_cycle)(void),
     uint16_t (*get_seconds_since_power_on)(void));
 
@@ -67,21 +72,27 @@ struct Imd *App_Imd_Create(
 void App_Imd_Destroy(struct Imd *imd);
 
 /**
- * Get the condition for the given IMD
+ * Sample the IMD's PWM output and update the condition for the given IMD
+ * @param imd The IMD to update
+ */
+void App_Imd_Tick(struct Imd *imd);
+
+/**
+ * Get the condition for the given IMD, as of the last tick
  * @param imd The IMD to get condition for
  * @return The condition for the given IMD
  */
 struct Imd_Condition App_Imd_GetCondition(const struct Imd *imd);
 
 /**
- * Get the PWM frequency for the given IMD
+ * Get the PWM frequency for the given IMD, as of the last tick
  * @param imd The IMD to get PWM frequency for
  * @return The PWM frequency for the given IMD
  */
 float App_Imd_GetPwmFrequency(const struct Imd *imd);
 
 /**
- * Get the PWM duty cycle for the given IMD
+ * Get the PWM duty cycle for the given IMD, as of the last tick
  * @param imd The IMD to get PWM duty cycle for
  * @return The PWM duty cycle for the given IMD
  */
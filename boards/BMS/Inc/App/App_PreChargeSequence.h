@@ -1,6 +1,17 @@
 #pragma once
 
 #include <stdbool.h>
+#include <stdint.h>
+
+enum PreChargeSequenceStatus
+{
+    PRE_CHARGE_SEQUENCE_IDLE,
+    PRE_CHARGE_SEQUENCE_IN_PROGRESS,
+    PRE_CHARGE_SEQUENCE_COMPLETE,
+    PRE_CHARGE_SEQUENCE_RISE_TOO_FAST,
+    PRE_CHARGE_SEQUENCE_RISE_TOO_SLOW,
+    PRE_CHARGE_SEQUENCE_TIMEOUT,
+};
 
 struct PreChargeSequence;
 
@@ -10,12 +21,18 @@ struct PreChargeSequence;
  * the pre-charge sequence
  * @param disable_pre_charge_sequence A function that can be called to disable
  * the pre-charge sequence
+ * @param get_ts_voltage A function that can be called to get the tractive
+ * system voltage, in V
+ * @param get_accumulator_voltage A function that can be called to get the
+ * accumulator voltage, in V
  * @return The created pre-charge sequence, whose ownership is given to the
  * caller
  */
 struct PreChargeSequence *App_PreChargeSequence_Create(
     void (*enable_pre_charge_sequence)(void),
-    void (*disable_pre_charge_sequence)(void));
+    void (*disable_pre_charge_sequence)(void),
+    float (*get_ts_voltage)(void),
+    float (*get_accumulator_voltage)(void));
 
 /**
  * Deallocate the memory used by the pre-charge sequence
@@ -25,15 +42,72 @@ void App_PreChargeSequence_Destroy(
     struct PreChargeSequence *pre_charge_sequence);
 
 /**
- * Enable the given pre-charge sequence
+ * Enable the given pre-charge sequence and start tracking the TS voltage
+ * against the expected RC charging curve
  * @param pre_charge_sequence The pre-charge sequence to enable
+ * @param current_time_ms The current time, in milliseconds
  */
 void App_PreChargeSequence_Enable(
-    const struct PreChargeSequence *pre_charge_sequence);
+    struct PreChargeSequence *pre_charge_sequence,
+    uint32_t                  current_time_ms);
 
 /**
- * Disable the given pre-charge sequence
+ * Disable the given pre-charge sequence. The status and the logged voltage
+ * ratio curve of the last sequence are kept until it is enabled again.
  * @param pre_charge_sequence The pre-charge sequence to disable
  */
 void App_PreChargeSequence_Disable(
     const struct PreChargeSequence *pre_charge_sequence);
+
+/**
+ * Sample the TS and accumulator voltages and update the status of the given
+ * pre-charge sequence. This is expected to be called at 1kHz.
+ * @note The sequence is complete as soon as the TS voltage reaches the
+ *       completion ratio of the accumulator voltage, and is aborted as soon as
+ *       the voltage ratio deviates from the expected RC charging curve
+ * @param pre_charge_sequence The pre-charge sequence to update
+ * @param current_time_ms The current time, in milliseconds
+ * @return The status of the given pre-charge sequence. Once the status is no
+ *         longer PRE_CHARGE_SEQUENCE_IN_PROGRESS, it stays the same until the
+ *         sequence is enabled again.
+ */
+enum PreChargeSequenceStatus App_PreChargeSequence_Tick(
+    struct PreChargeSequence *pre_charge_sequence,
+    uint32_t                  current_time_ms);
+
+/**
+ * Get the status of the given pre-charge sequence
+ * @param pre_charge_sequence The pre-charge sequence to get the status for
+ * @return The status of the given pre-charge sequence
+ */
+enum PreChargeSequenceStatus App_PreChargeSequence_GetStatus(
+    const struct PreChargeSequence *pre_charge_sequence);
+
+/**
+ * Get the last sampled TS voltage to accumulator voltage ratio
+ * @param pre_charge_sequence The pre-charge sequence to get the ratio for
+ * @return The last sampled voltage ratio, or NAN if the accumulator voltage
+ *         was not valid
+ */
+float App_PreChargeSequence_GetVoltageRatio(
+    const struct PreChargeSequence *pre_charge_sequence);
+
+/**
+ * Get the time elapsed since the given pre-charge sequence was enabled, as of
+ * the last tick
+ * @param pre_charge_sequence The pre-charge sequence to get the time for
+ * @return The elapsed time, in milliseconds
+ */
+uint32_t App_PreChargeSequence_GetElapsedTimeMs(
+    const struct PreChargeSequence *pre_charge_sequence);
+
+/**
+ * Get the voltage ratio curve logged during the last pre-charge sequence. The
+ * n-th entry is the voltage ratio sampled at n * PRE_CHARGE_LOG_PERIOD_MS.
+ * @param pre_charge_sequence The pre-charge sequence to get the log for
+ * @param num_samples This will be set to the number of logged samples
+ * @return The logged voltage ratio curve
+ */
+const float *App_PreChargeSequence_GetVoltageRatioLog(
+    const struct PreChargeSequence *pre_charge_sequence,
+    uint32_t *                      num_samples);
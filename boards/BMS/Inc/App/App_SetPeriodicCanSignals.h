@@ -13,3 +13,7 @@ void App_SetPeriodicSignals_AccumulatorInRangeChecks(
 void App_SetPeriodicSignals_CellMonitorsInRangeChecks(
     struct BmsCanTxInterface * can_tx,
     const struct CellMonitors *cell_monitors);
+
+void App_SetPeriodicCanSignals_ChargeController(
+    struct BmsCanTxInterface *     can_tx,
+    const struct ChargeController *charge_controller);
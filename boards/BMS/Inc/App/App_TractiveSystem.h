@@ -0,0 +1,38 @@
+#pragma once
+
+struct TractiveSystem;
+
+/**
+ * Allocate and initialize the tractive system, which is measured on the
+ * accumulator side of the AIRs
+ * @param get_voltage A function that returns the tractive system voltage, in V
+ * @param get_current A function that returns the current out of the
+ *                    accumulator, in A. It is negative while charging or
+ *                    regenerating.
+ * @return The created tractive system, whose ownership is given to the caller
+ */
+struct TractiveSystem *App_TractiveSystem_Create(
+    float (*get_voltage)(void),
+    float (*get_current)(void));
+
+/**
+ * Deallocate the memory used by the given tractive system
+ * @param tractive_system The tractive system to deallocate
+ */
+void App_TractiveSystem_Destroy(struct TractiveSystem *tractive_system);
+
+/**
+ * Get the voltage of the given tractive system
+ * @param tractive_system The tractive system to get the voltage for
+ * @return The voltage of the given tractive system, in V
+ */
+float App_TractiveSystem_GetVoltage(
+    const struct TractiveSystem *tractive_system);
+
+/**
+ * Get the current of the given tractive system
+ * @param tractive_system The tractive system to get the current for
+ * @return The current out of the accumulator, in A
+ */
+float App_TractiveSystem_GetCurrent(
+    const struct TractiveSystem *tractive_system);
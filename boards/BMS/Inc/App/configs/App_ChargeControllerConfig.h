@@ -0,0 +1,34 @@
+#pragma once
+
+// The charge controller is ticked in the 100Hz task
+#define CHARGE_CONTROLLER_TICK_PERIOD_S 0.01f
+
+// Maximum output current of the BRUSA NLG513 at the accumulator voltage
+#define CHARGE_CONTROLLER_MAX_CURRENT_A 12.0f
+
+// The constant voltage phase regulates the highest cell to this voltage. This
+// is kept below MAX_CELL_VOLTAGE so the CV overshoot can't trip a fault.
+#define CHARGE_CONTROLLER_TARGET_CELL_VOLTAGE 4.15f
+#define CHARGE_CONTROLLER_NUM_CELLS_IN_SERIES 96U
+
+// PI gains of the constant voltage loop on the highest cell voltage
+#define CHARGE_CONTROLLER_CV_KP_A_PER_V 25.0f
+#define CHARGE_CONTROLLER_CV_KI_A_PER_V_S 50.0f
+
+// The current setpoint may drop immediately but only rises at this rate
+#define CHARGE_CONTROLLER_CURRENT_SLEW_RATE_A_PER_S 2.0f
+
+// The charge is complete once the constant voltage loop has requested less
+// than the termination current for the termination time
+#define CHARGE_CONTROLLER_TERMINATION_CURRENT_A 0.5f
+#define CHARGE_CONTROLLER_TERMINATION_TIME_S 5.0f
+
+// The current is linearly derated from full current to 0A between these cell
+// temperatures
+#define CHARGE_CONTROLLER_CELL_TEMP_TO_START_DERATING_DEGC 45.0f
+#define CHARGE_CONTROLLER_CELL_TEMP_TO_STOP_CHARGING_DEGC 55.0f
+
+// During the constant voltage phase, the current is capped while the cell
+// voltage spread is above this threshold so the cell balancing can keep up
+#define CHARGE_CONTROLLER_BALANCING_CELL_VOLTAGE_SPREAD_V 0.02f
+#define CHARGE_CONTROLLER_BALANCING_CURRENT_A 1.0f
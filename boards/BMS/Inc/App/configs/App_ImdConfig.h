@@ -1,3 +1,4 @@
 #pragma once
 
 #define IMD_FREQUENCY_TOLERANCE 2.0f
+#define IMD_FREQUENCY_HYSTERESIS 1.0f
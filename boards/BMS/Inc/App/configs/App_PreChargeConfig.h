@@ -0,0 +1,28 @@
+#pragma once
+
+// Time constant of the pre-charge resistor and the inverter DC bus capacitance
+#define PRE_CHARGE_RC_TIME_CONSTANT_MS 500.0f
+
+// Relative tolerance on the time constant before the measured curve is
+// considered to be rising too fast or too slowly
+#define PRE_CHARGE_RC_TIME_CONSTANT_TOLERANCE 0.25f
+
+// Absolute margin (in TS/accumulator voltage ratio) added on either side of the
+// expected curve to absorb measurement noise and ADC offset
+#define PRE_CHARGE_VOLTAGE_RATIO_MARGIN 0.05f
+
+// FSAE rules EV.6.6.1: AIR+ may only close once the TS voltage reaches 90% of
+// the accumulator voltage
+#define PRE_CHARGE_COMPLETE_VOLTAGE_RATIO 0.9f
+
+// Number of consecutive samples required to declare completion or a fault
+#define PRE_CHARGE_COMPLETE_SAMPLES 3U
+#define PRE_CHARGE_FAULT_SAMPLES 10U
+
+// Backstop in case the ratio never reaches the completion threshold
+#define PRE_CHARGE_TIMEOUT_MS 5000U
+
+// The measured curve is logged every PRE_CHARGE_LOG_PERIOD_MS for offline
+// analysis. The log covers PRE_CHARGE_LOG_LENGTH * PRE_CHARGE_LOG_PERIOD_MS
+#define PRE_CHARGE_LOG_PERIOD_MS 10U
+#define PRE_CHARGE_LOG_LENGTH 256U
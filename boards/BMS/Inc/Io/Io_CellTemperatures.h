@@ -28,3 +28,10 @@ uint32_t Io_CellTemperatures_GetMaxCellTemperature(void);
  * @return The average accumulator cell temperature (0.1°C)
  */
 float Io_CellTemperatures_GetAverageCellTemperature(void);
+
+/**
+ * Get the current maximum accumulator cell temperature out of all cell
+ * temperatures
+ * @return The current maximum cell temperature (°C)
+ */
+float Io_CellTemperatures_GetMaxCellTemperatureDegC(void);
@@ -4,29 +4,31 @@
 
 /**
  * Initialize the PWM input for measuring the IMD's PWM output
+ * @note Every period of the IMD's PWM output is transferred into a circular
+ *       buffer using DMA, and the periods captured since the last call are
+ *       processed when the frequency is read
  */
 void Io_Imd_Init(void);
 
 /**
- * Get the frequency of the IMD's PWM output
- * @return The frequency of the IMD's PWM output
+ * Get the frequency of the IMD's PWM output, estimated from the median of the
+ * recently captured PWM periods
+ * @note This also estimates the duty cycle returned by Io_Imd_GetDutyCycle, so
+ *       that both are estimated once per tick from the same captured periods
+ * @return The frequency of the IMD's PWM output, or NAN if the recently
+ *         captured PWM periods don't agree with each other
  */
 float Io_Imd_GetFrequency(void);
 
 /**
- * Get the duty cycle of the IMD's PWM output
- * @return The duty cycle of the IMD's PWM output
+ * Get the duty cycle of the IMD's PWM output, as estimated by the last call to
+ * Io_Imd_GetFrequency
+ * @return The duty cycle of the IMD's PWM output, or NAN if the recently
+ *         captured PWM periods didn't agree with each other or the frequency
+ *         hasn't been read yet
  */
 float Io_Imd_GetDutyCycle(void);
 
-/**
- * Updates the frequency and duty cycle for the IMD's PWM output. This should
- * be called in the input capture callback function.
- * @param htim The handle of the timer that triggered the input capture callback
- *             function
- */
-void Io_Imd_InputCaptureCallback(TIM_HandleTypeDef *htim);
-
 /**
  * Get the time elapsed since the IMD was powered on
  * @return The the time elapsed since the IMD was powered on, in seconds
@@ -0,0 +1,13 @@
+#pragma once
+
+/**
+ * Get the tractive system voltage measured at the TS_VSENSE ADC channel
+ * @return The tractive system voltage, in V
+ */
+float Io_TractiveSystem_GetVoltage(void);
+
+/**
+ * Get the tractive system current measured at the MAIN_ISENSE ADC channels
+ * @return The current out of the accumulator, in A
+ */
+float Io_TractiveSystem_GetCurrent(void);
@@ -60,6 +60,7 @@ extern "C"
     void UsageFault_Handler(void);
     void DebugMon_Handler(void);
     void DMA1_Channel1_IRQHandler(void);
+    void DMA1_Channel7_IRQHandler(void);
     void USB_HP_CAN_TX_IRQHandler(void);
     void USB_LP_CAN_RX0_IRQHandler(void);
     void CAN_RX1_IRQHandler(void);
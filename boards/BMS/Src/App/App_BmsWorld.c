@@ -11,6 +11,7 @@ struct BmsWorld
     struct HeartbeatMonitor * heartbeat_monitor;
     struct RgbLedSequence *   rgb_led_sequence;
     struct Charger *          charger;
+    struct ChargeController * charge_controller;
     struct OkStatus *         bms_ok;
     struct OkStatus *         imd_ok;
     struct OkStatus *         bspd_ok;
@@ -18,6 +19,7 @@ struct BmsWorld
     struct CellMonitors *     cell_monitors;
     struct Airs *             airs;
     struct PreChargeSequence *pre_charge_sequence;
+    struct TractiveSystem *   tractive_system;
     struct ErrorTable *       error_table;
     struct Clock *            clock;
 };
@@ -29,6 +31,7 @@ struct BmsWorld *App_BmsWorld_Create(
     struct HeartbeatMonitor *const  heartbeat_monitor,
     struct RgbLedSequence *const    rgb_led_sequence,
     struct Charger *const           charger,
+    struct ChargeController *const  charge_controller,
     struct OkStatus *const          bms_ok,
     struct OkStatus *const          imd_ok,
     struct OkStatus *const          bspd_ok,
@@ -36,6 +39,7 @@ struct BmsWorld *App_BmsWorld_Create(
     struct CellMonitors *const      cell_monitors,
     struct Airs *const              airs,
     struct PreChargeSequence *const pre_charge_sequence,
+    struct TractiveSystem *const    tractive_system,
     struct ErrorTable *const        error_table,
     struct Clock *const             clock)
 {
@@ -48,6 +52,7 @@ struct BmsWorld *App_BmsWorld_Create(
     world->heartbeat_monitor   = heartbeat_monitor;
     world->rgb_led_sequence    = rgb_led_sequence;
     world->charger             = charger;
+    world->charge_controller   = charge_controller;
     world->bms_ok              = bms_ok;
     world->imd_ok              = imd_ok;
     world->bspd_ok             = bspd_ok;
@@ -55,6 +60,7 @@ struct BmsWorld *App_BmsWorld_Create(
     world->cell_monitors       = cell_monitors;
     world->airs                = airs;
     world->pre_charge_sequence = pre_charge_sequence;
+    world->tractive_system     = tractive_system;
     world->error_table         = error_table;
     world->clock               = clock;
 
@@ -100,6 +106,12 @@ struct Charger *App_BmsWorld_GetCharger(const struct BmsWorld *const world)
     return world->charger;
 }
 
+struct ChargeController *
+    App_BmsWorld_GetChargeController(const struct BmsWorld *const world)
+{
+    return world->charge_controller;
+}
+
 struct OkStatus *App_BmsWorld_GetBmsOkStatus(const struct BmsWorld *const world)
 {
     return world->bms_ok;
@@ -139,6 +151,12 @@ struct PreChargeSequence *
     return world->pre_charge_sequence;
 }
 
+struct TractiveSystem *
+    App_BmsWorld_GetTractiveSystem(const struct BmsWorld *const world)
+{
+    return world->tractive_system;
+}
+
 struct ErrorTable *
     App_BmsWorld_GetErrorTable(const struct BmsWorld *const world)
 {
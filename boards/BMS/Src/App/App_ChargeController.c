@@ -0,0 +1,288 @@
+#include <assert.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "App_CanMsgs.h"
+#include "App_SharedMacros.h"
+#include "App_ChargeController.h"
+#include "configs/App_ChargeControllerConfig.h"
+#include "configs/App_CellMonitorsThresholds.h"
+
+// Match the charge controller enums with the DBC values of the charger message
+static_assert(
+    CHARGE_CONTROLLER_OFF == CANMSGS_BMS_CHARGER_CHARGE_MODE_OFF_CHOICE,
+    "The charge controller off enum must match its DBC value");
+static_assert(
+    CHARGE_CONTROLLER_CONSTANT_CURRENT ==
+        CANMSGS_BMS_CHARGER_CHARGE_MODE_CONSTANT_CURRENT_CHOICE,
+    "The charge controller constant current enum must match its DBC value");
+static_assert(
+    CHARGE_CONTROLLER_CONSTANT_VOLTAGE ==
+        CANMSGS_BMS_CHARGER_CHARGE_MODE_CONSTANT_VOLTAGE_CHOICE,
+    "The charge controller constant voltage enum must match its DBC value");
+static_assert(
+    CHARGE_CONTROLLER_COMPLETE ==
+        CANMSGS_BMS_CHARGER_CHARGE_MODE_COMPLETE_CHOICE,
+    "The charge controller complete enum must match its DBC value");
+
+#define TERMINATION_TICKS                      \
+    ((uint32_t)(                               \
+        CHARGE_CONTROLLER_TERMINATION_TIME_S / \
+            CHARGE_CONTROLLER_TICK_PERIOD_S +  \
+        0.5f))
+
+struct ChargeController
+{
+    float (*get_max_cell_voltage)(void);
+    float (*get_min_cell_voltage)(void);
+    ExitCode (*read_cell_temperatures)(void);
+    float (*get_max_cell_temperature)(void);
+    float (*get_max_die_temperature)(void);
+
+    bool are_cell_temperatures_valid;
+
+    // Whether the cell temperatures are yet to be read for the current charge
+    // cycle
+    bool is_cell_temperature_read_pending;
+
+    enum ChargeControllerMode mode;
+    float                     current_setpoint;
+    float                     cv_integrator;
+    float                     derating_factor;
+    uint32_t                  termination_ticks;
+};
+
+/**
+ * Get the fraction of the maximum current allowed at the given temperature by
+ * a derating curve that falls linearly from 1 to 0
+ * @param temperature The temperature to look up, in °C
+ * @param derating_start_temperature The temperature above which the current
+ *                                   starts to be derated, in °C
+ * @param derating_stop_temperature The temperature at and above which no
+ *                                  current is allowed, in °C
+ * @return The derating factor, in [0, 1]. An invalid (NAN) temperature allows
+ *         no current.
+ */
+static float App_GetDeratingFactor(
+    float temperature,
+    float derating_start_temperature,
+    float derating_stop_temperature);
+
+static float App_GetDeratingFactor(
+    const float temperature,
+    const float derating_start_temperature,
+    const float derating_stop_temperature)
+{
+    if (temperature <= derating_start_temperature)
+    {
+        return 1.0f;
+    }
+    else if (temperature < derating_stop_temperature)
+    {
+        return (derating_stop_temperature - temperature) /
+               (derating_stop_temperature - derating_start_temperature);
+    }
+
+    return 0.0f;
+}
+
+struct ChargeController *App_ChargeController_Create(
+    float (*const get_max_cell_voltage)(void),
+    float (*const get_min_cell_voltage)(void),
+    ExitCode (*const read_cell_temperatures)(void),
+    float (*const get_max_cell_temperature)(void),
+    float (*const get_max_die_temperature)(void))
+{
+    struct ChargeController *charge_controller =
+        malloc(sizeof(struct ChargeController));
+    assert(charge_controller != NULL);
+
+    charge_controller->get_max_cell_voltage     = get_max_cell_voltage;
+    charge_controller->get_min_cell_voltage     = get_min_cell_voltage;
+    charge_controller->read_cell_temperatures   = read_cell_temperatures;
+    charge_controller->get_max_cell_temperature = get_max_cell_temperature;
+    charge_controller->get_max_die_temperature  = get_max_die_temperature;
+
+    charge_controller->are_cell_temperatures_valid      = false;
+    charge_controller->is_cell_temperature_read_pending = false;
+
+    charge_controller->mode              = CHARGE_CONTROLLER_OFF;
+    charge_controller->current_setpoint  = 0.0f;
+    charge_controller->cv_integrator     = 0.0f;
+    charge_controller->derating_factor   = 0.0f;
+    charge_controller->termination_ticks = 0U;
+
+    return charge_controller;
+}
+
+void App_ChargeController_Destroy(
+    struct ChargeController *const charge_controller)
+{
+    free(charge_controller);
+}
+
+void App_ChargeController_Start(
+    struct ChargeController *const charge_controller)
+{
+    charge_controller->mode             = CHARGE_CONTROLLER_CONSTANT_CURRENT;
+    charge_controller->current_setpoint = 0.0f;
+
+    // Start the integrator at full current so the constant voltage loop does
+    // not limit the current until the highest cell reaches the target voltage
+    charge_controller->cv_integrator     = CHARGE_CONTROLLER_MAX_CURRENT_A;
+    charge_controller->termination_ticks = 0U;
+
+    charge_controller->is_cell_temperature_read_pending = true;
+}
+
+void App_ChargeController_Stop(struct ChargeController *const charge_controller)
+{
+    charge_controller->mode             = CHARGE_CONTROLLER_OFF;
+    charge_controller->current_setpoint = 0.0f;
+}
+
+ExitCode App_ChargeController_ReadCellTemperatures(
+    struct ChargeController *const charge_controller)
+{
+    const ExitCode exit_code = charge_controller->read_cell_temperatures();
+
+    charge_controller->are_cell_temperatures_valid      = EXIT_OK(exit_code);
+    charge_controller->is_cell_temperature_read_pending = false;
+
+    return exit_code;
+}
+
+bool App_ChargeController_IsCellTemperatureReadPending(
+    const struct ChargeController *const charge_controller)
+{
+    return charge_controller->is_cell_temperature_read_pending;
+}
+
+void App_ChargeController_Tick(struct ChargeController *const charge_controller)
+{
+    if (charge_controller->mode == CHARGE_CONTROLLER_OFF ||
+        charge_controller->mode == CHARGE_CONTROLLER_COMPLETE)
+    {
+        charge_controller->current_setpoint = 0.0f;
+        return;
+    }
+
+    const float max_cell_voltage = charge_controller->get_max_cell_voltage();
+    const float cell_voltage_spread =
+        max_cell_voltage - charge_controller->get_min_cell_voltage();
+
+    // Without a valid cell temperature, the derating curve allows no current
+    const float max_cell_temperature =
+        charge_controller->are_cell_temperatures_valid
+            ? charge_controller->get_max_cell_temperature()
+            : NAN;
+
+    // The die temperature curve tapers the current between the thresholds at
+    // which the charge state re-enables and disables the charger, so the
+    // charger is rarely switched off by the die temperature hysteresis
+    const float cell_temp_derating_factor = App_GetDeratingFactor(
+        max_cell_temperature,
+        CHARGE_CONTROLLER_CELL_TEMP_TO_START_DERATING_DEGC,
+        CHARGE_CONTROLLER_CELL_TEMP_TO_STOP_CHARGING_DEGC);
+    const float die_temp_derating_factor = App_GetDeratingFactor(
+        charge_controller->get_max_die_temperature(),
+        DIE_TEMP_TO_REENABLE_CHARGER_DEGC, DIE_TEMP_TO_DISABLE_CHARGER_DEGC);
+
+    charge_controller->derating_factor =
+        min(cell_temp_derating_factor, die_temp_derating_factor);
+    const float current_limit =
+        CHARGE_CONTROLLER_MAX_CURRENT_A * charge_controller->derating_factor;
+
+    if (charge_controller->mode == CHARGE_CONTROLLER_CONSTANT_CURRENT &&
+        max_cell_voltage >= CHARGE_CONTROLLER_TARGET_CELL_VOLTAGE)
+    {
+        charge_controller->mode = CHARGE_CONTROLLER_CONSTANT_VOLTAGE;
+    }
+
+    // Regulate the highest cell to the target voltage. Clamping the integrator
+    // to the current limit keeps it from winding up while the current is
+    // limited by the derating curves or by the constant current phase.
+    const float cv_error =
+        CHARGE_CONTROLLER_TARGET_CELL_VOLTAGE - max_cell_voltage;
+    charge_controller->cv_integrator += CHARGE_CONTROLLER_CV_KI_A_PER_V_S *
+                                        cv_error *
+                                        CHARGE_CONTROLLER_TICK_PERIOD_S;
+    if (charge_controller->cv_integrator > current_limit)
+    {
+        charge_controller->cv_integrator = current_limit;
+    }
+    else if (charge_controller->cv_integrator < 0.0f)
+    {
+        charge_controller->cv_integrator = 0.0f;
+    }
+
+    float cv_current = CHARGE_CONTROLLER_CV_KP_A_PER_V * cv_error +
+                       charge_controller->cv_integrator;
+    if (cv_current < 0.0f)
+    {
+        cv_current = 0.0f;
+    }
+
+    float current = min(cv_current, current_limit);
+
+    // Once the top cells are full, give the cell balancing time to bring the
+    // lower cells up rather than pushing more current through the top cells
+    const bool is_balancing =
+        charge_controller->mode == CHARGE_CONTROLLER_CONSTANT_VOLTAGE &&
+        cell_voltage_spread > CHARGE_CONTROLLER_BALANCING_CELL_VOLTAGE_SPREAD_V;
+    if (is_balancing)
+    {
+        current = min(current, CHARGE_CONTROLLER_BALANCING_CURRENT_A);
+    }
+
+    // Only rate limit increases, so the current can always drop immediately
+    const float max_current_step = CHARGE_CONTROLLER_CURRENT_SLEW_RATE_A_PER_S *
+                                   CHARGE_CONTROLLER_TICK_PERIOD_S;
+    charge_controller->current_setpoint =
+        min(current, charge_controller->current_setpoint + max_current_step);
+
+    if (charge_controller->mode == CHARGE_CONTROLLER_CONSTANT_VOLTAGE &&
+        !is_balancing && cv_current < CHARGE_CONTROLLER_TERMINATION_CURRENT_A)
+    {
+        charge_controller->termination_ticks++;
+    }
+    else
+    {
+        charge_controller->termination_ticks = 0U;
+    }
+
+    if (charge_controller->termination_ticks >= TERMINATION_TICKS)
+    {
+        charge_controller->mode             = CHARGE_CONTROLLER_COMPLETE;
+        charge_controller->current_setpoint = 0.0f;
+    }
+}
+
+enum ChargeControllerMode App_ChargeController_GetMode(
+    const struct ChargeController *const charge_controller)
+{
+    return charge_controller->mode;
+}
+
+float App_ChargeController_GetCurrentSetpoint(
+    const struct ChargeController *const charge_controller)
+{
+    return charge_controller->current_setpoint;
+}
+
+float App_ChargeController_GetVoltageSetpoint(
+    const struct ChargeController *const charge_controller)
+{
+    UNUSED(charge_controller);
+
+    return CHARGE_CONTROLLER_TARGET_CELL_VOLTAGE *
+           (float)CHARGE_CONTROLLER_NUM_CELLS_IN_SERIES;
+}
+
+float App_ChargeController_GetDeratingFactor(
+    const struct ChargeController *const charge_controller)
+{
+    return charge_controller->derating_factor;
+}
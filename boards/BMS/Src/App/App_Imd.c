@@ -35,70 +35,231 @@ struct Imd
     uint16_t (*get_seconds_since_power_on)(void);
 
     float                pwm_frequency_tolerance;
+    float                pwm_frequency_hysteresis;
+    float                pwm_frequency;
+    float                pwm_duty_cycle;
     struct Imd_Condition condition;
 };
 
+// The IMD encodes each condition in a PWM output frequency, and encodes
+// additional information about some conditions in the duty cycle
+struct ImdConditionEncoding
+{
+    float ideal_pwm_frequency;
+
+    // Decode the given duty cycle into the PWM encoding of the given condition,
+    // and return whether the duty cycle is valid for the condition
+    bool (*decode_pwm_duty_cycle)(
+        float                 pwm_duty_cycle,
+        struct Imd_Condition *condition);
+};
+
+/**
+ * Decode the duty cycle for conditions that don't use the duty cycle to encode
+ * information, so any duty cycle is valid
+ */
+static bool App_DecodeAnyPwmDutyCycle(
+    float                 pwm_duty_cycle,
+    struct Imd_Condition *condition);
+
+/**
+ * Decode the insulation resistance for the normal and undervoltage detected
+ * conditions
+ */
+static bool App_DecodeInsulationMeasurement(
+    float                 pwm_duty_cycle,
+    struct Imd_Condition *condition);
+
+/**
+ * Decode the good or bad evaluation for the speed start measurement condition
+ */
+static bool App_DecodeSpeedStartMeasurement(
+    float                 pwm_duty_cycle,
+    struct Imd_Condition *condition);
+
+/**
+ * Decode the duty cycle for the device error and earth fault conditions, which
+ * only use a fixed duty cycle
+ */
+static bool App_DecodeFixedPwmDutyCycle(
+    float                 pwm_duty_cycle,
+    struct Imd_Condition *condition);
+
+/**
+ * Convert the given duty cycle to an insulation resistance
+ * @param pwm_duty_cycle: The duty cycle to convert, between 5% and 95%
+ * @return The insulation resistance, in kOhms
+ */
+static uint16_t App_GetInsulationResistanceKohms(float pwm_duty_cycle);
+
+/**
+ * Check if the given PWM frequency is within the given tolerance of the ideal
+ * frequency of the given IMD condition
+ * @param frequency: The PWM frequency to check
+ * @param condition_name: The IMD condition to check against
+ * @param tolerance: The tolerance allowed in the PWM frequency
+ * @return true if the given frequency is within the tolerance, else false
+ */
+static bool App_IsPwmFrequencyInBand(
+    float                  frequency,
+    enum Imd_ConditionName condition_name,
+    float                  tolerance);
+
 /**
  * Convert the given PWM frequency to an IMD condition name. Note the PWM
- * frequency won't be exact so we must do some approximation.
+ * frequency won't be exact so we must do some approximation. To avoid chatter
+ * when the frequency is at the edge of a band, the current condition is kept
+ * until the frequency is further than the tolerance plus the hysteresis away
+ * from its ideal frequency.
  * @param frequency: The PWM frequency to convert to an IMD condition name
+ * @param current_condition_name: The current IMD condition name
  * @param tolerance: The tolerance allowed in the PWM frequency
+ * @param hysteresis: The additional tolerance allowed for the current
+ *                    condition
  * @return The IMD condition corresponding to the given PWM frequency
  */
-static enum Imd_ConditionName
-    App_EstimateConditionName(float frequency, float tolerance);
+static enum Imd_ConditionName App_EstimateConditionName(
+    float                  frequency,
+    enum Imd_ConditionName current_condition_name,
+    float                  tolerance,
+    float                  hysteresis);
 
-/**
- * Get the ideal frequency for the given IMD condition name
- * @param condition_name: The IMD condition name to look up ideal frequency for
- * @return The ideal frequency for the given IMD condition name
- */
-static float App_GetIdealPwmFrequency(enum Imd_ConditionName condition_name);
+// Key: IMD condition
+// Value: PWM output frequency and duty cycle encoding
+static const struct ImdConditionEncoding
+    imd_condition_encodings[NUM_OF_IMD_CONDITIONS] = {
+        [IMD_SHORT_CIRCUIT] = { 0.0f, App_DecodeAnyPwmDutyCycle },
+        [IMD_NORMAL]        = { 10.0f, App_DecodeInsulationMeasurement },
+        [IMD_UNDERVOLTAGE_DETECTED] = { 20.0f,
+                                        App_DecodeInsulationMeasurement },
+        [IMD_SST]          = { 30.0f, App_DecodeSpeedStartMeasurement },
+        [IMD_DEVICE_ERROR] = { 40.0f, App_DecodeFixedPwmDutyCycle },
+        [IMD_EARTH_FAULT]  = { 50.0f, App_DecodeFixedPwmDutyCycle },
+    };
 
-static enum Imd_ConditionName
-    App_EstimateConditionName(const float frequency, const float tolerance)
+static bool App_DecodeAnyPwmDutyCycle(
+    const float           pwm_duty_cycle,
+    struct Imd_Condition *condition)
 {
-    enum Imd_ConditionName condition_name = IMD_INVALID;
+    UNUSED(pwm_duty_cycle);
+    UNUSED(condition);
 
-    for (enum Imd_ConditionName i = 0U; i < NUM_OF_IMD_CONDITIONS; i++)
+    return true;
+}
+
+static bool App_DecodeInsulationMeasurement(
+    const float           pwm_duty_cycle,
+    struct Imd_Condition *condition)
+{
+    if (!(pwm_duty_cycle >= 5.0f && pwm_duty_cycle <= 95.0f))
     {
-        // Use min() because subtracting from 0Hz (IMD_SHORT_CIRCUIT) causes an
-        // underflow
-        const float lower_bound =
-            min(App_GetIdealPwmFrequency(i),
-                App_GetIdealPwmFrequency(i) - tolerance);
+        return false;
+    }
 
-        const float upper_bound = App_GetIdealPwmFrequency(i) + tolerance;
+    condition->pwm_encoding.insulation_measurement_dcp_kohms =
+        App_GetInsulationResistanceKohms(pwm_duty_cycle);
 
-        if (frequency >= lower_bound && frequency <= upper_bound)
-        {
-            condition_name = i;
-            break;
-        }
+    return true;
+}
+
+static bool App_DecodeSpeedStartMeasurement(
+    const float           pwm_duty_cycle,
+    struct Imd_Condition *condition)
+{
+    if (pwm_duty_cycle >= 5.0f && pwm_duty_cycle <= 10.0f)
+    {
+        condition->pwm_encoding.speed_start_status = SST_GOOD;
+        return true;
+    }
+    else if (pwm_duty_cycle >= 90.0f && pwm_duty_cycle <= 95.0f)
+    {
+        condition->pwm_encoding.speed_start_status = SST_BAD;
+        return true;
+    }
+
+    return false;
+}
+
+static bool App_DecodeFixedPwmDutyCycle(
+    const float           pwm_duty_cycle,
+    struct Imd_Condition *condition)
+{
+    UNUSED(condition);
+
+    return pwm_duty_cycle >= 47.5f && pwm_duty_cycle <= 52.5f;
+}
+
+static uint16_t App_GetInsulationResistanceKohms(const float pwm_duty_cycle)
+{
+    // The insulation resistance is supposed to saturate at 50MOhms, but the
+    // formula for calculating it exceeds 50MOhms once the duty cycle is below
+    // ~7.1%, and divides by zero at 5%. Saturate the resistance before it is
+    // converted to an integer, so every duty cycle in the valid range decodes
+    // to a continuous, well-defined resistance.
+    const float max_resistance = 50000.0f;
+
+    if (pwm_duty_cycle <= 5.0f)
+    {
+        return (uint16_t)max_resistance;
+    }
+
+    const float resistance =
+        1080.0f / (pwm_duty_cycle / 100.0f - 0.05f) - 1200.0f;
+
+    if (resistance >= max_resistance)
+    {
+        return (uint16_t)max_resistance;
+    }
+    else if (resistance <= 0.0f)
+    {
+        return 0U;
     }
 
-    return condition_name;
+    return (uint16_t)resistance;
 }
 
-static float
-    App_GetIdealPwmFrequency(const enum Imd_ConditionName condition_name)
+static bool App_IsPwmFrequencyInBand(
+    const float                  frequency,
+    const enum Imd_ConditionName condition_name,
+    const float                  tolerance)
 {
     assert(condition_name < NUM_OF_IMD_CONDITIONS);
 
-    // Key: IMD condition
-    // Value: PWM output frequency
-    static const float imd_frequency_lookup[NUM_OF_IMD_CONDITIONS] = {
-        [IMD_SHORT_CIRCUIT] = 0.0f,          [IMD_NORMAL] = 10.0f,
-        [IMD_UNDERVOLTAGE_DETECTED] = 20.0f, [IMD_SST] = 30.0f,
-        [IMD_DEVICE_ERROR] = 40.0f,          [IMD_EARTH_FAULT] = 50.0f,
-    };
+    const float ideal_frequency =
+        imd_condition_encodings[condition_name].ideal_pwm_frequency;
+
+    return frequency >= ideal_frequency - tolerance &&
+           frequency <= ideal_frequency + tolerance;
+}
+
+static enum Imd_ConditionName App_EstimateConditionName(
+    const float                  frequency,
+    const enum Imd_ConditionName current_condition_name,
+    const float                  tolerance,
+    const float                  hysteresis)
+{
+    if (current_condition_name < NUM_OF_IMD_CONDITIONS &&
+        App_IsPwmFrequencyInBand(
+            frequency, current_condition_name, tolerance + hysteresis))
+    {
+        return current_condition_name;
+    }
+
+    for (enum Imd_ConditionName i = 0U; i < NUM_OF_IMD_CONDITIONS; i++)
+    {
+        if (App_IsPwmFrequencyInBand(frequency, i, tolerance))
+        {
+            return i;
+        }
+    }
 
-    return imd_frequency_lookup[condition_name];
+    return IMD_INVALID;
 }
 
 struct Imd *App_Imd_Create(
     float (*const get_pwm_frequency)(void),
     float pwm_frequency_tolerance,
+    float pwm_frequency_hysteresis,
     float (*const get_pwm_duty_cycle)(void),
     uint16_t (*const get_seconds_since_power_on)(void))
 {
@@ -111,10 +272,14 @@ struct Imd *App_Imd_Create(
 
     imd->get_pwm_frequency          = get_pwm_frequency;
     imd->pwm_frequency_tolerance    = pwm_frequency_tolerance;
+    imd->pwm_frequency_hysteresis   = pwm_frequency_hysteresis;
     imd->get_pwm_duty_cycle         = get_pwm_duty_cycle;
     imd->get_seconds_since_power_on = get_seconds_since_power_on;
 
+    imd->pwm_frequency  = 0.0f;
+    imd->pwm_duty_cycle = 0.0f;
     memset(&imd->condition, 0, sizeof(imd->condition));
+    imd->condition.name = IMD_INVALID;
 
     return imd;
 }
@@ -124,113 +289,46 @@ void App_Imd_Destroy(struct Imd *const imd)
     free(imd);
 }
 
-struct Imd_Condition App_Imd_GetCondition(const struct Imd *const imd)
+void App_Imd_Tick(struct Imd *const imd)
 {
-    const float pwm_frequency  = imd->get_pwm_frequency();
-    const float pwm_duty_cycle = imd->get_pwm_duty_cycle();
+    imd->pwm_frequency  = imd->get_pwm_frequency();
+    imd->pwm_duty_cycle = imd->get_pwm_duty_cycle();
 
     struct Imd_Condition condition;
     memset(&condition, 0, sizeof(condition));
 
-    condition.name =
-        App_EstimateConditionName(pwm_frequency, imd->pwm_frequency_tolerance);
+    condition.name = App_EstimateConditionName(
+        imd->pwm_frequency, imd->condition.name, imd->pwm_frequency_tolerance,
+        imd->pwm_frequency_hysteresis);
 
-    // Decode the information encoded in the PWM frequency and duty cycle
-    switch (condition.name)
+    // Decode the information encoded in the PWM duty cycle
+    if (condition.name < NUM_OF_IMD_CONDITIONS)
     {
-        case IMD_SHORT_CIRCUIT:
-        {
-            // This condition doesn't use duty cycle to encode information so
-            // any duty cycle is valid.
-            condition.pwm_encoding.valid_duty_cycle = true;
-        }
-        break;
-        case IMD_NORMAL:
-        case IMD_UNDERVOLTAGE_DETECTED:
-        {
-            condition.pwm_encoding.valid_duty_cycle =
-                (pwm_duty_cycle >= 5.0f && pwm_duty_cycle <= 95.0f) ? true
-                                                                    : false;
-
-            if (condition.pwm_encoding.valid_duty_cycle)
-            {
-                if (pwm_duty_cycle == 5.0f)
-                {
-                    // The formula for calculating the insulation resistance
-                    // causes a div-by-zero if the duty cycle is 5%.
-                    // Curiously, 5% duty cycle is still defined as valid so
-                    // we hard-code the resistance to be 50MOhms.
-                    condition.pwm_encoding.insulation_measurement_dcp_kohms =
-                        50000;
-                }
-                else
-                {
-                    // The insulation resistance is supposed to be saturate at
-                    // 50MOhms, but the formula for calculating the insulation
-                    // resistance exceeds 50Ohms once the duty cycle is below
-                    // ~7.1%. Thus, we manually saturate the value at 50MOhms to
-                    // get well-defined behaviours.
-                    uint16_t resistance = (uint16_t)(
-                        1080.0f / (pwm_duty_cycle / 100.0f - 0.05f) - 1200.0f);
-
-                    condition.pwm_encoding.insulation_measurement_dcp_kohms =
-                        min(resistance, 50000);
-                }
-            }
-        }
-        break;
-        case IMD_SST:
-        {
-            condition.pwm_encoding.valid_duty_cycle =
-                ((pwm_duty_cycle >= 5.0f && pwm_duty_cycle <= 10.0f) ||
-                 (pwm_duty_cycle >= 90.0f && pwm_duty_cycle <= 95.0f))
-                    ? true
-                    : false;
-
-            if (condition.pwm_encoding.valid_duty_cycle)
-            {
-                if (pwm_duty_cycle >= 5.0f && pwm_duty_cycle <= 10.0f)
-                {
-                    condition.pwm_encoding.speed_start_status = SST_GOOD;
-                }
-                else if (pwm_duty_cycle >= 90.0f && pwm_duty_cycle <= 95.0f)
-                {
-                    condition.pwm_encoding.speed_start_status = SST_BAD;
-                }
-            }
-        }
-        break;
-        case IMD_DEVICE_ERROR:
-        case IMD_EARTH_FAULT:
-        {
-            condition.pwm_encoding.valid_duty_cycle =
-                (pwm_duty_cycle >= 47.5f && pwm_duty_cycle <= 52.5f) ? true
-                                                                     : false;
-        }
-        break;
-        case IMD_INVALID:
-        {
-            condition.pwm_encoding.valid_duty_cycle = false;
-        }
-        break;
-        default:
-        {
-            condition.pwm_encoding.valid_duty_cycle = false;
-        }
-        break;
+        condition.pwm_encoding.valid_duty_cycle =
+            imd_condition_encodings[condition.name].decode_pwm_duty_cycle(
+                imd->pwm_duty_cycle, &condition);
     }
+    else
+    {
+        condition.pwm_encoding.valid_duty_cycle = false;
+    }
+
+    imd->condition = condition;
+}
 
-    return condition;
+struct Imd_Condition App_Imd_GetCondition(const struct Imd *const imd)
+{
+    return imd->condition;
 }
 
 float App_Imd_GetPwmFrequency(const struct Imd *const imd)
 {
-    return imd->get_pwm_frequency();
+    return imd->pwm_frequency;
 }
 
 float App_Imd_GetPwmDutyCycle(const struct Imd *const imd)
 {
-    return imd->get_pwm_duty_cycle();
+    return imd->pwm_duty_cycle;
 }
 
 uint16_t App_Imd_GetSecondsSincePowerOn(const struct Imd *imd)
@@ -1,16 +1,91 @@
 #include <assert.h>
+#include <math.h>
 #include <stdlib.h>
+
+#include "App_CanMsgs.h"
 #include "App_PreChargeSequence.h"
+#include "configs/App_PreChargeConfig.h"
+
+// Match the pre-charge sequence enums with the DBC values of the pre-charge
+// message
+static_assert(
+    PRE_CHARGE_SEQUENCE_IDLE ==
+        CANMSGS_BMS_PRE_CHARGE_PRE_CHARGE_STATUS_IDLE_CHOICE,
+    "The pre-charge idle enum must match its DBC value");
+static_assert(
+    PRE_CHARGE_SEQUENCE_IN_PROGRESS ==
+        CANMSGS_BMS_PRE_CHARGE_PRE_CHARGE_STATUS_IN_PROGRESS_CHOICE,
+    "The pre-charge in progress enum must match its DBC value");
+static_assert(
+    PRE_CHARGE_SEQUENCE_COMPLETE ==
+        CANMSGS_BMS_PRE_CHARGE_PRE_CHARGE_STATUS_COMPLETE_CHOICE,
+    "The pre-charge complete enum must match its DBC value");
+static_assert(
+    PRE_CHARGE_SEQUENCE_RISE_TOO_FAST ==
+        CANMSGS_BMS_PRE_CHARGE_PRE_CHARGE_STATUS_RISE_TOO_FAST_CHOICE,
+    "The pre-charge rise too fast enum must match its DBC value");
+static_assert(
+    PRE_CHARGE_SEQUENCE_RISE_TOO_SLOW ==
+        CANMSGS_BMS_PRE_CHARGE_PRE_CHARGE_STATUS_RISE_TOO_SLOW_CHOICE,
+    "The pre-charge rise too slow enum must match its DBC value");
+static_assert(
+    PRE_CHARGE_SEQUENCE_TIMEOUT ==
+        CANMSGS_BMS_PRE_CHARGE_PRE_CHARGE_STATUS_TIMEOUT_CHOICE,
+    "The pre-charge timeout enum must match its DBC value");
+
+// The fastest and slowest acceptable RC charging curves are bounded by the
+// nominal time constant scaled by the tolerance. Store their reciprocals so we
+// only need to multiply at 1kHz.
+#define FASTEST_CURVE_INVERSE_TIME_CONSTANT   \
+    (1.0f / (PRE_CHARGE_RC_TIME_CONSTANT_MS * \
+             (1.0f - PRE_CHARGE_RC_TIME_CONSTANT_TOLERANCE)))
+#define SLOWEST_CURVE_INVERSE_TIME_CONSTANT   \
+    (1.0f / (PRE_CHARGE_RC_TIME_CONSTANT_MS * \
+             (1.0f + PRE_CHARGE_RC_TIME_CONSTANT_TOLERANCE)))
 
 struct PreChargeSequence
 {
     void (*enable_pre_charge_sequence)(void);
     void (*disable_pre_charge_sequence)(void);
+    float (*get_ts_voltage)(void);
+    float (*get_accumulator_voltage)(void);
+
+    enum PreChargeSequenceStatus status;
+    uint32_t                     start_time_ms;
+    uint32_t                     elapsed_time_ms;
+    float                        voltage_ratio;
+
+    uint32_t complete_sample_count;
+    uint32_t too_fast_sample_count;
+    uint32_t too_slow_sample_count;
+
+    float    voltage_ratio_log[PRE_CHARGE_LOG_LENGTH];
+    uint32_t num_logged_samples;
 };
 
+/**
+ * Update a counter of consecutive samples
+ * @param counter The counter to update
+ * @param condition Whether the condition being counted holds for this sample
+ * @return The number of consecutive samples for which the condition has held
+ */
+static uint32_t
+    App_UpdateConsecutiveSampleCount(uint32_t *counter, bool condition);
+
+static uint32_t App_UpdateConsecutiveSampleCount(
+    uint32_t *const counter,
+    const bool      condition)
+{
+    *counter = condition ? *counter + 1U : 0U;
+
+    return *counter;
+}
+
 struct PreChargeSequence *App_PreChargeSequence_Create(
     void (*enable_pre_charge_sequence)(void),
-    void (*disable_pre_charge_sequence)(void))
+    void (*disable_pre_charge_sequence)(void),
+    float (*get_ts_voltage)(void),
+    float (*get_accumulator_voltage)(void))
 {
     struct PreChargeSequence *pre_charge_sequence =
         malloc(sizeof(struct PreChargeSequence));
@@ -20,6 +95,17 @@ struct PreChargeSequence *App_PreChargeSequence_Create(
         enable_pre_charge_sequence;
     pre_charge_sequence->disable_pre_charge_sequence =
         disable_pre_charge_sequence;
+    pre_charge_sequence->get_ts_voltage          = get_ts_voltage;
+    pre_charge_sequence->get_accumulator_voltage = get_accumulator_voltage;
+
+    pre_charge_sequence->status                = PRE_CHARGE_SEQUENCE_IDLE;
+    pre_charge_sequence->start_time_ms         = 0U;
+    pre_charge_sequence->elapsed_time_ms       = 0U;
+    pre_charge_sequence->voltage_ratio         = 0.0f;
+    pre_charge_sequence->complete_sample_count = 0U;
+    pre_charge_sequence->too_fast_sample_count = 0U;
+    pre_charge_sequence->too_slow_sample_count = 0U;
+    pre_charge_sequence->num_logged_samples    = 0U;
 
     return pre_charge_sequence;
 }
@@ -31,8 +117,18 @@ void App_PreChargeSequence_Destroy(
 }
 
 void App_PreChargeSequence_Enable(
-    const struct PreChargeSequence *const pre_charge_sequence)
+    struct PreChargeSequence *const pre_charge_sequence,
+    const uint32_t                  current_time_ms)
 {
+    pre_charge_sequence->status          = PRE_CHARGE_SEQUENCE_IN_PROGRESS;
+    pre_charge_sequence->start_time_ms   = current_time_ms;
+    pre_charge_sequence->elapsed_time_ms = 0U;
+    pre_charge_sequence->voltage_ratio   = 0.0f;
+    pre_charge_sequence->complete_sample_count = 0U;
+    pre_charge_sequence->too_fast_sample_count = 0U;
+    pre_charge_sequence->too_slow_sample_count = 0U;
+    pre_charge_sequence->num_logged_samples    = 0U;
+
     pre_charge_sequence->enable_pre_charge_sequence();
 }
 
@@ -41,3 +137,109 @@ void App_PreChargeSequence_Disable(
 {
     pre_charge_sequence->disable_pre_charge_sequence();
 }
+
+enum PreChargeSequenceStatus App_PreChargeSequence_Tick(
+    struct PreChargeSequence *const pre_charge_sequence,
+    const uint32_t                  current_time_ms)
+{
+    if (pre_charge_sequence->status != PRE_CHARGE_SEQUENCE_IN_PROGRESS)
+    {
+        return pre_charge_sequence->status;
+    }
+
+    const uint32_t elapsed_time_ms =
+        current_time_ms - pre_charge_sequence->start_time_ms;
+    const float ts_voltage = pre_charge_sequence->get_ts_voltage();
+    const float accumulator_voltage =
+        pre_charge_sequence->get_accumulator_voltage();
+
+    // Without a valid accumulator voltage we can't tell how far the pre-charge
+    // has progressed, so the sample counts towards the rise being too slow
+    const float voltage_ratio =
+        (accumulator_voltage > 0.0f) ? ts_voltage / accumulator_voltage : NAN;
+
+    pre_charge_sequence->elapsed_time_ms = elapsed_time_ms;
+    pre_charge_sequence->voltage_ratio   = voltage_ratio;
+
+    if (elapsed_time_ms >= pre_charge_sequence->num_logged_samples *
+                               PRE_CHARGE_LOG_PERIOD_MS &&
+        pre_charge_sequence->num_logged_samples < PRE_CHARGE_LOG_LENGTH)
+    {
+        pre_charge_sequence
+            ->voltage_ratio_log[pre_charge_sequence->num_logged_samples++] =
+            voltage_ratio;
+    }
+
+    // The TS voltage should follow V_acc * (1 - e^(-t / RC)), so the voltage
+    // ratio must stay between the curves of the fastest and slowest acceptable
+    // time constants
+    const float elapsed_time = (float)elapsed_time_ms;
+    const float upper_bound =
+        1.0f - expf(-elapsed_time * FASTEST_CURVE_INVERSE_TIME_CONSTANT) +
+        PRE_CHARGE_VOLTAGE_RATIO_MARGIN;
+    const float lower_bound =
+        1.0f - expf(-elapsed_time * SLOWEST_CURVE_INVERSE_TIME_CONSTANT) -
+        PRE_CHARGE_VOLTAGE_RATIO_MARGIN;
+
+    const bool is_too_fast = voltage_ratio > upper_bound;
+    const bool is_too_slow =
+        isnan(voltage_ratio) || voltage_ratio < lower_bound;
+
+    // Only a sample that follows the expected curve may count towards
+    // completion, otherwise a TS voltage that jumps straight to the
+    // accumulator voltage would close AIR+
+    const uint32_t too_fast_samples = App_UpdateConsecutiveSampleCount(
+        &pre_charge_sequence->too_fast_sample_count, is_too_fast);
+    const uint32_t too_slow_samples = App_UpdateConsecutiveSampleCount(
+        &pre_charge_sequence->too_slow_sample_count, is_too_slow);
+    const uint32_t complete_samples = App_UpdateConsecutiveSampleCount(
+        &pre_charge_sequence->complete_sample_count,
+        !is_too_fast && !is_too_slow &&
+            voltage_ratio >= PRE_CHARGE_COMPLETE_VOLTAGE_RATIO);
+
+    if (too_fast_samples >= PRE_CHARGE_FAULT_SAMPLES)
+    {
+        pre_charge_sequence->status = PRE_CHARGE_SEQUENCE_RISE_TOO_FAST;
+    }
+    else if (too_slow_samples >= PRE_CHARGE_FAULT_SAMPLES)
+    {
+        pre_charge_sequence->status = PRE_CHARGE_SEQUENCE_RISE_TOO_SLOW;
+    }
+    else if (complete_samples >= PRE_CHARGE_COMPLETE_SAMPLES)
+    {
+        pre_charge_sequence->status = PRE_CHARGE_SEQUENCE_COMPLETE;
+    }
+    else if (elapsed_time_ms >= PRE_CHARGE_TIMEOUT_MS)
+    {
+        pre_charge_sequence->status = PRE_CHARGE_SEQUENCE_TIMEOUT;
+    }
+
+    return pre_charge_sequence->status;
+}
+
+enum PreChargeSequenceStatus App_PreChargeSequence_GetStatus(
+    const struct PreChargeSequence *const pre_charge_sequence)
+{
+    return pre_charge_sequence->status;
+}
+
+float App_PreChargeSequence_GetVoltageRatio(
+    const struct PreChargeSequence *const pre_charge_sequence)
+{
+    return pre_charge_sequence->voltage_ratio;
+}
+
+uint32_t App_PreChargeSequence_GetElapsedTimeMs(
+    const struct PreChargeSequence *const pre_charge_sequence)
+{
+    return pre_charge_sequence->elapsed_time_ms;
+}
+
+const float *App_PreChargeSequence_GetVoltageRatioLog(
+    const struct PreChargeSequence *const pre_charge_sequence,
+    uint32_t *const                       num_samples)
+{
+    *num_samples = pre_charge_sequence->num_logged_samples;
+
+    return pre_charge_sequence->voltage_ratio_log;
+}
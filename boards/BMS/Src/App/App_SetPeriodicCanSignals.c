@@ -204,3 +204,15 @@ void App_SetPeriodicSignals_CellMonitorsInRangeChecks(
         CANMSGS_BMS_NON_CRITICAL_ERRORS_CELL_MONITOR_5_DIE_TEMP_OUT_OF_RANGE_UNDERFLOW_CHOICE,
         CANMSGS_BMS_NON_CRITICAL_ERRORS_CELL_MONITOR_5_DIE_TEMP_OUT_OF_RANGE_OVERFLOW_CHOICE);
 }
+
+void App_SetPeriodicCanSignals_ChargeController(
+    struct BmsCanTxInterface *     can_tx,
+    const struct ChargeController *charge_controller)
+{
+    App_CanTx_SetPeriodicSignal_CHARGE_MODE(
+        can_tx, (uint8_t)App_ChargeController_GetMode(charge_controller));
+    App_CanTx_SetPeriodicSignal_CHARGER_CURRENT_SETPOINT(
+        can_tx, App_ChargeController_GetCurrentSetpoint(charge_controller));
+    App_CanTx_SetPeriodicSignal_CHARGER_VOLTAGE_SETPOINT(
+        can_tx, App_ChargeController_GetVoltageSetpoint(charge_controller));
+}
@@ -0,0 +1,40 @@
+#include <assert.h>
+#include <stdlib.h>
+#include "App_TractiveSystem.h"
+
+struct TractiveSystem
+{
+    float (*get_voltage)(void);
+    float (*get_current)(void);
+};
+
+struct TractiveSystem *App_TractiveSystem_Create(
+    float (*const get_voltage)(void),
+    float (*const get_current)(void))
+{
+    struct TractiveSystem *tractive_system =
+        malloc(sizeof(struct TractiveSystem));
+    assert(tractive_system != NULL);
+
+    tractive_system->get_voltage = get_voltage;
+    tractive_system->get_current = get_current;
+
+    return tractive_system;
+}
+
+void App_TractiveSystem_Destroy(struct TractiveSystem *tractive_system)
+{
+    free(tractive_system);
+}
+
+float App_TractiveSystem_GetVoltage(
+    const struct TractiveSystem *const tractive_system)
+{
+    return tractive_system->get_voltage();
+}
+
+float App_TractiveSystem_GetCurrent(
+    const struct TractiveSystem *const tractive_system)
+{
+    return tractive_system->get_current();
+}
@@ -26,7 +26,10 @@ void App_AllStatesRunOnTick100Hz(struct StateMachine *const state_machine)
     struct OkStatus *         bspd_ok     = App_BmsWorld_GetBspdOkStatus(world);
     struct Accumulator *      accumulator = App_BmsWorld_GetAccumulator(world);
     struct Airs *             airs        = App_BmsWorld_GetAirs(world);
+    struct TractiveSystem *   tractive_system =
+        App_BmsWorld_GetTractiveSystem(world);
 
+    App_Imd_Tick(imd);
     App_SetPeriodicCanSignals_Imd(can_tx, imd);
 
     App_CanTx_SetPeriodicSignal_AIR_NEGATIVE(
@@ -61,6 +64,12 @@ void App_AllStatesRunOnTick100Hz(struct StateMachine *const state_machine)
         App_CanTx_SetPeriodicSignal_BSPD_OK(can_tx, false);
     }
 
+    // The DCM limits the motor power with the tractive system power
+    App_CanTx_SetPeriodicSignal_TS_VOLTAGE(
+        can_tx, App_TractiveSystem_GetVoltage(tractive_system));
+    App_CanTx_SetPeriodicSignal_TS_CURRENT(
+        can_tx, App_TractiveSystem_GetCurrent(tractive_system));
+
     App_SetPeriodicSignals_AccumulatorInRangeChecks(can_tx, accumulator);
     if (App_CanTx_GetPeriodicSignal_MAX_CELL_VOLTAGE_OUT_OF_RANGE(can_tx) !=
             CANMSGS_BMS_AIR_SHUTDOWN_ERRORS_MAX_CELL_VOLTAGE_OUT_OF_RANGE_OK_CHOICE ||
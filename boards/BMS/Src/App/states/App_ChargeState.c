@@ -9,8 +9,13 @@ static void ChargeStateRunOnEntry(struct StateMachine *const state_machine)
 {
     struct BmsWorld *world = App_SharedStateMachine_GetWorld(state_machine);
     struct BmsCanTxInterface *can_tx_interface = App_BmsWorld_GetCanTx(world);
+    struct ChargeController * charge_controller =
+        App_BmsWorld_GetChargeController(world);
+
     App_CanTx_SetPeriodicSignal_STATE(
         can_tx_interface, CANMSGS_BMS_STATE_MACHINE_STATE_CHARGE_CHOICE);
+
+    App_ChargeController_Start(charge_controller);
 }
 
 static void ChargeStateRunOnTick1Hz(struct StateMachine *const state_machine)
@@ -21,9 +26,12 @@ static void ChargeStateRunOnTick1Hz(struct StateMachine *const state_machine)
     struct BmsCanTxInterface * can_tx = App_BmsWorld_GetCanTx(world);
     const struct CellMonitors *cell_monitors =
         App_BmsWorld_GetCellMonitors(world);
-    struct Charger *charger = App_BmsWorld_GetCharger(world);
+    struct Charger *         charger = App_BmsWorld_GetCharger(world);
+    struct ChargeController *charge_controller =
+        App_BmsWorld_GetChargeController(world);
 
     App_CellMonitors_ReadDieTemps(cell_monitors);
+    App_ChargeController_ReadCellTemperatures(charge_controller);
     App_SetPeriodicSignals_CellMonitorsInRangeChecks(can_tx, cell_monitors);
 
     float                 max_die_temperature;
@@ -45,7 +53,9 @@ static void ChargeStateRunOnTick1Hz(struct StateMachine *const state_machine)
     }
     else if (cell_monitor_itmp_in_range_check == ITMP_CHARGER_IN_RANGE)
     {
-        if (!App_Charger_IsEnabled(charger))
+        if (!App_Charger_IsEnabled(charger) &&
+            App_ChargeController_GetMode(charge_controller) !=
+                CHARGE_CONTROLLER_COMPLETE)
         {
             App_Charger_Enable(charger);
         }
@@ -63,6 +73,25 @@ static void ChargeStateRunOnTick100Hz(struct StateMachine *const state_machine)
     struct BmsWorld *world = App_SharedStateMachine_GetWorld(state_machine);
     struct BmsCanTxInterface *can_tx  = App_BmsWorld_GetCanTx(world);
     struct Charger *          charger = App_BmsWorld_GetCharger(world);
+    struct ChargeController * charge_controller =
+        App_BmsWorld_GetChargeController(world);
+
+    // The entry into this state can run in the 1kHz tick, which is too short
+    // for the blocking thermistor read, so the first read is done here
+    if (App_ChargeController_IsCellTemperatureReadPending(charge_controller))
+    {
+        App_ChargeController_ReadCellTemperatures(charge_controller);
+    }
+
+    App_ChargeController_Tick(charge_controller);
+    App_SetPeriodicCanSignals_ChargeController(can_tx, charge_controller);
+
+    if (App_ChargeController_GetMode(charge_controller) ==
+            CHARGE_CONTROLLER_COMPLETE &&
+        App_Charger_IsEnabled(charger))
+    {
+        App_Charger_Disable(charger);
+    }
 
     if (!App_Charger_IsConnected(charger))
     {
@@ -74,7 +103,13 @@ static void ChargeStateRunOnTick100Hz(struct StateMachine *const state_machine)
 
 static void ChargeStateRunOnExit(struct StateMachine *const state_machine)
 {
-    UNUSED(state_machine);
+    struct BmsWorld *world = App_SharedStateMachine_GetWorld(state_machine);
+    struct BmsCanTxInterface *can_tx = App_BmsWorld_GetCanTx(world);
+    struct ChargeController * charge_controller =
+        App_BmsWorld_GetChargeController(world);
+
+    App_ChargeController_Stop(charge_controller);
+    App_SetPeriodicCanSignals_ChargeController(can_tx, charge_controller);
 }
 
 const struct State *App_GetChargeState(void)
@@ -1,4 +1,8 @@
 #include "states/App_AllStates.h"
+#include "states/App_AirOpenState.h"
+#include "states/App_ChargeState.h"
+#include "states/App_DriveState.h"
+#include "states/App_FaultState.h"
 
 #include "App_SetPeriodicCanSignals.h"
 #include "App_SharedMacros.h"
@@ -7,8 +11,16 @@ static void PreChargeStateRunOnEntry(struct StateMachine *const state_machine)
 {
     struct BmsWorld *world = App_SharedStateMachine_GetWorld(state_machine);
     struct BmsCanTxInterface *can_tx_interface = App_BmsWorld_GetCanTx(world);
+    struct PreChargeSequence *pre_charge_sequence =
+        App_BmsWorld_GetPreChargeSequence(world);
+    struct Clock *clock = App_BmsWorld_GetClock(world);
+
     App_CanTx_SetPeriodicSignal_STATE(
         can_tx_interface, CANMSGS_BMS_STATE_MACHINE_STATE_PRE_CHARGE_CHOICE);
+
+    App_PreChargeSequence_Enable(
+        pre_charge_sequence,
+        App_SharedClock_GetCurrentTimeInMilliseconds(clock));
 }
 
 static void PreChargeStateRunOnTick1Hz(struct StateMachine *const state_machine)
@@ -20,11 +32,74 @@ static void
     PreChargeStateRunOnTick100Hz(struct StateMachine *const state_machine)
 {
     App_AllStatesRunOnTick100Hz(state_machine);
+
+    struct BmsWorld *world = App_SharedStateMachine_GetWorld(state_machine);
+    struct Airs *    airs  = App_BmsWorld_GetAirs(world);
+
+    // Abort the pre-charge sequence if AIR- is opened
+    if (!App_SharedBinaryStatus_IsActive(App_Airs_GetAirNegative(airs)))
+    {
+        App_SharedStateMachine_SetNextState(
+            state_machine, App_GetAirOpenState());
+    }
+}
+
+static void
+    PreChargeStateRunOnTick1kHz(struct StateMachine *const state_machine)
+{
+    struct BmsWorld *world = App_SharedStateMachine_GetWorld(state_machine);
+    struct BmsCanTxInterface *can_tx_interface = App_BmsWorld_GetCanTx(world);
+    struct PreChargeSequence *pre_charge_sequence =
+        App_BmsWorld_GetPreChargeSequence(world);
+    struct Airs *   airs    = App_BmsWorld_GetAirs(world);
+    struct Charger *charger = App_BmsWorld_GetCharger(world);
+    struct Clock *  clock   = App_BmsWorld_GetClock(world);
+
+    const enum PreChargeSequenceStatus status = App_PreChargeSequence_Tick(
+        pre_charge_sequence,
+        App_SharedClock_GetCurrentTimeInMilliseconds(clock));
+
+    App_CanTx_SetPeriodicSignal_PRE_CHARGE_VOLTAGE_RATIO(
+        can_tx_interface,
+        App_PreChargeSequence_GetVoltageRatio(pre_charge_sequence));
+    App_CanTx_SetPeriodicSignal_PRE_CHARGE_ELAPSED_TIME(
+        can_tx_interface,
+        (uint16_t)App_PreChargeSequence_GetElapsedTimeMs(pre_charge_sequence));
+    App_CanTx_SetPeriodicSignal_PRE_CHARGE_STATUS(can_tx_interface, status);
+
+    if (status == PRE_CHARGE_SEQUENCE_COMPLETE)
+    {
+        // Close AIR+ as soon as the TS voltage is close enough to the
+        // accumulator voltage rather than waiting out a fixed pre-charge time
+        App_Airs_CloseAirPositive(airs);
+        App_CanTx_SetPeriodicSignal_AIR_POSITIVE(
+            can_tx_interface,
+            CANMSGS_BMS_AIR_STATES_AIR_POSITIVE_CLOSED_CHOICE);
+
+        if (App_Charger_IsConnected(charger))
+        {
+            App_SharedStateMachine_SetNextState(
+                state_machine, App_GetChargeState());
+        }
+        else
+        {
+            App_SharedStateMachine_SetNextState(
+                state_machine, App_GetDriveState());
+        }
+    }
+    else if (status != PRE_CHARGE_SEQUENCE_IN_PROGRESS)
+    {
+        App_SharedStateMachine_SetNextState(state_machine, App_GetFaultState());
+    }
 }
 
 static void PreChargeStateRunOnExit(struct StateMachine *const state_machine)
 {
-    UNUSED(state_machine);
+    struct BmsWorld *world = App_SharedStateMachine_GetWorld(state_machine);
+    struct PreChargeSequence *pre_charge_sequence =
+        App_BmsWorld_GetPreChargeSequence(world);
+
+    App_PreChargeSequence_Disable(pre_charge_sequence);
 }
 
 const struct State *App_GetPreChargeState(void)
@@ -34,6 +109,7 @@ const struct State *App_GetPreChargeState(void)
         .run_on_entry      = PreChargeStateRunOnEntry,
         .run_on_tick_1Hz   = PreChargeStateRunOnTick1Hz,
         .run_on_tick_100Hz = PreChargeStateRunOnTick100Hz,
+        .run_on_tick_1kHz  = PreChargeStateRunOnTick1kHz,
         .run_on_exit       = PreChargeStateRunOnExit,
     };
 
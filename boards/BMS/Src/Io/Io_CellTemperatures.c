@@ -304,3 +304,8 @@ float Io_CellTemperatures_GetAverageCellTemperature(void)
     return (float)sum_of_cell_temp /
            (float)(NUM_OF_THERMISTORS_PER_IC * NUM_OF_CELL_MONITOR_CHIPS);
 }
+
+float Io_CellTemperatures_GetMaxCellTemperatureDegC(void)
+{
+    return (float)Io_CellTemperatures_GetMaxCellTemperature() / 10.0f;
+}
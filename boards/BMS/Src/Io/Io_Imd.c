@@ -1,39 +1,100 @@
 #include <FreeRTOS.h>
 #include <task.h>
 #include <assert.h>
+#include <math.h>
 
 #include "main.h"
 #include "Io_Imd.h"
-#include "Io_SharedPwmInput.h"
+#include "Io_SharedDmaInputCapture.h"
+#include "App_SharedPwmInputBuffer.h"
+
+// The slowest non-DC IMD output is 10Hz, so this keeps every period captured
+// in the buffer while still detecting a DC output (0Hz) within a second
+#define IMD_PWM_MAX_SAMPLE_AGE_MS 1000U
+
+// The IMD output frequencies are 10Hz apart, so periods within 10% of each
+// other are from the same IMD condition
+#define IMD_PWM_CONSENSUS_TOLERANCE 0.1f
+
+// The IMD output is at most 50Hz, so this holds every period captured between
+// two reads of the IMD output
+#define IMD_PWM_MAX_CAPTURES 8U
+
+// Every capture is a DMA burst read of CCR1 (the high time of the period) and
+// CCR2 (the length of the period), since the timer resets on every rising edge
+#define IMD_PWM_NUM_REGISTERS 2U
+#define IMD_PWM_HIGH_TIME_REGISTER 0U
+#define IMD_PWM_PERIOD_REGISTER 1U
 
 extern TIM_HandleTypeDef htim2;
 
-static struct PwmInput *  imd_pwm_input;
-static TIM_HandleTypeDef *imd_htim;
+static struct PwmInputBuffer * imd_pwm_input_buffer;
+static struct DmaInputCapture *imd_dma_input_capture;
 
-void Io_Imd_Init(void)
-{
-    imd_pwm_input = Io_SharedPwmInput_Create(
-        &htim2, TIM2_FREQUENCY / TIM2_PRESCALER, TIM_CHANNEL_2, TIM_CHANNEL_1);
-    imd_htim = &htim2;
-}
+// The frequency and the duty cycle estimated from the same captured periods,
+// or NAN if they couldn't be estimated
+static float imd_frequency_hz = NAN;
+static float imd_duty_cycle   = NAN;
 
-float Io_Imd_GetFrequency(void)
+/**
+ * Push the periods of the IMD's PWM output captured since the last call into
+ * the PWM input buffer
+ * @note The DMA burst read carries no capture time, so the periods are stamped
+ *       with the time they are read at. A period is therefore up to one read
+ *       interval (10ms from the 100Hz tick) older than its timestamp, so it
+ *       stays in the buffer for up to IMD_PWM_MAX_SAMPLE_AGE_MS plus one read
+ *       interval, which only delays detecting a DC output by that much.
+ */
+static void Io_PushCapturedPeriods(void);
+
+static void Io_PushCapturedPeriods(void)
 {
-    return Io_SharedPwmInput_GetFrequency(imd_pwm_input);
+    uint32_t       captures[IMD_PWM_MAX_CAPTURES * IMD_PWM_NUM_REGISTERS];
+    const uint32_t num_captures = Io_SharedDmaInputCapture_Read(
+        imd_dma_input_capture, captures, IMD_PWM_MAX_CAPTURES);
+    const uint32_t current_time_ms = HAL_GetTick();
+
+    for (uint32_t i = 0U; i < num_captures; i++)
+    {
+        App_SharedPwmInputBuffer_Push(
+            imd_pwm_input_buffer,
+            captures[i * IMD_PWM_NUM_REGISTERS + IMD_PWM_PERIOD_REGISTER],
+            captures[i * IMD_PWM_NUM_REGISTERS + IMD_PWM_HIGH_TIME_REGISTER],
+            current_time_ms);
+    }
 }
 
-float Io_Imd_GetDutyCycle(void)
+void Io_Imd_Init(void)
 {
-    return Io_SharedPwmInput_GetDutyCycle(imd_pwm_input);
+    imd_pwm_input_buffer = App_SharedPwmInputBuffer_Create(
+        TIM2_FREQUENCY / TIM2_PRESCALER, IMD_PWM_MAX_SAMPLE_AGE_MS,
+        IMD_PWM_CONSENSUS_TOLERANCE);
+
+    // The falling edge channel only captures, while the rising edge channel
+    // also triggers the DMA burst read of both channels
+    HAL_TIM_IC_Start(&htim2, TIM_CHANNEL_1);
+    imd_dma_input_capture = Io_SharedDmaInputCapture_Create(
+        &htim2, TIM_CHANNEL_2, IMD_PWM_NUM_REGISTERS, IMD_PWM_MAX_CAPTURES);
 }
 
-void Io_Imd_InputCaptureCallback(TIM_HandleTypeDef *htim)
+float Io_Imd_GetFrequency(void)
 {
-    if (htim == imd_htim)
+    Io_PushCapturedPeriods();
+
+    if (!App_SharedPwmInputBuffer_Estimate(
+            imd_pwm_input_buffer, HAL_GetTick(), &imd_frequency_hz,
+            &imd_duty_cycle))
     {
-        Io_SharedPwmInput_Tick(imd_pwm_input);
+        imd_frequency_hz = NAN;
+        imd_duty_cycle   = NAN;
     }
+
+    return imd_frequency_hz;
+}
+
+float Io_Imd_GetDutyCycle(void)
+{
+    return imd_duty_cycle;
 }
 
 uint16_t Io_Imd_GetTimeSincePowerOn(void)
@@ -0,0 +1,37 @@
+#include <math.h>
+#include "Io_TractiveSystem.h"
+#include "Io_VoltageSense.h"
+#include "Io_CurrentSense.h"
+#include "Io_Adc.h"
+
+// The current sensor's ±50A output resolves the current more finely than its
+// ±300A output, so it is used until it nears saturation
+#define MAX_LOW_RESOLUTION_CURRENT_A 45.0f
+
+float Io_TractiveSystem_GetVoltage(void)
+{
+    return Io_VoltageSense_GetTractiveSystemVoltage(
+        Io_Adc_GetAdc1Channel3Voltage());
+}
+
+float Io_TractiveSystem_GetCurrent(void)
+{
+    float low_resolution_current  = 0.0f;
+    float high_resolution_current = 0.0f;
+
+    // MAIN_ISENSE_1 and MAIN_ISENSE_2 are outputs 1 and 2 of the current sensor
+    if (!EXIT_OK(Io_CurrentSense_ConvertToHighResolutionMainCurrent(
+            Io_Adc_GetAdc2Channel3Voltage(), &high_resolution_current)))
+    {
+        return 0.0f;
+    }
+
+    if (fabsf(high_resolution_current) < MAX_LOW_RESOLUTION_CURRENT_A &&
+        EXIT_OK(Io_CurrentSense_ConvertToLowResolutionMainCurrent(
+            Io_Adc_GetAdc2Channel1Voltage(), &low_resolution_current)))
+    {
+        return low_resolution_current;
+    }
+
+    return high_resolution_current;
+}
@@ -44,6 +44,8 @@
 #include "Io_Airs.h"
 #include "Io_PreCharge.h"
 #include "Io_Adc.h"
+#include "Io_TractiveSystem.h"
+#include "Io_CellTemperatures.h"
 
 #include "App_BmsWorld.h"
 #include "App_AccumulatorVoltages.h"
@@ -75,6 +77,7 @@ ADC_HandleTypeDef hadc1;
 ADC_HandleTypeDef hadc2;
 DMA_HandleTypeDef hdma_adc1;
 DMA_HandleTypeDef hdma_adc2;
+DMA_HandleTypeDef hdma_tim2_ch2_ch4;
 
 CAN_HandleTypeDef hcan;
 
@@ -109,6 +112,7 @@ struct Imd *              imd;
 struct HeartbeatMonitor * heartbeat_monitor;
 struct RgbLedSequence *   rgb_led_sequence;
 struct Charger *          charger;
+struct ChargeController * charge_controller;
 struct OkStatus *         bms_ok;
 struct OkStatus *         imd_ok;
 struct OkStatus *         bspd_ok;
@@ -116,6 +120,7 @@ struct Accumulator *      accumulator;
 struct CellMonitors *     cell_monitors;
 struct Airs *             airs;
 struct PreChargeSequence *pre_charge_sequence;
+struct TractiveSystem *   tractive_system;
 struct ErrorTable *       error_table;
 struct Clock *            clock;
 /* USER CODE END PV */
@@ -212,8 +217,8 @@ int main(void)
 
     Io_Imd_Init();
     imd = App_Imd_Create(
-        Io_Imd_GetFrequency, IMD_FREQUENCY_TOLERANCE, Io_Imd_GetDutyCycle,
-        Io_Imd_GetTimeSincePowerOn);
+        Io_Imd_GetFrequency, IMD_FREQUENCY_TOLERANCE, IMD_FREQUENCY_HYSTERESIS,
+        Io_Imd_GetDutyCycle, Io_Imd_GetTimeSincePowerOn);
 
     can_tx = App_CanTx_Create(
         Io_CanTx_EnqueueNonPeriodicMsg_BMS_STARTUP,
@@ -232,6 +237,13 @@ int main(void)
     charger = App_Charger_Create(
         Io_Charger_Enable, Io_Charger_Disable, Io_Charger_IsConnected);
 
+    charge_controller = App_ChargeController_Create(
+        App_AccumulatorVoltages_GetMaxCellVoltage,
+        App_AccumulatorVoltages_GetMinCellVoltage,
+        Io_CellTemperatures_ReadTemperatures,
+        Io_CellTemperatures_GetMaxCellTemperatureDegC,
+        Io_DieTemperatures_GetMaxDieTemp);
+
     bms_ok = App_OkStatus_Create(
         Io_OkStatuses_EnableBmsOk, Io_OkStatuses_DisableBmsOk,
         Io_OkStatuses_IsBmsOkEnabled);
@@ -277,8 +289,12 @@ int main(void)
         Io_Airs_IsAirPositiveClosed, Io_Airs_IsAirNegativeClosed,
         Io_Airs_CloseAirPositive, Io_Airs_OpenAirPositive);
 
-    pre_charge_sequence =
-        App_PreChargeSequence_Create(Io_PreCharge_Enable, Io_PreCharge_Disable);
+    pre_charge_sequence = App_PreChargeSequence_Create(
+        Io_PreCharge_Enable, Io_PreCharge_Disable, Io_TractiveSystem_GetVoltage,
+        App_AccumulatorVoltages_GetPackVoltage);
+
+    tractive_system = App_TractiveSystem_Create(
+        Io_TractiveSystem_GetVoltage, Io_TractiveSystem_GetCurrent);
 
     error_table = App_SharedErrorTable_Create();
 
@@ -286,8 +302,8 @@ int main(void)
 
     world = App_BmsWorld_Create(
         can_tx, can_rx, imd, heartbeat_monitor, rgb_led_sequence, charger,
-        bms_ok, imd_ok, bspd_ok, accumulator, cell_monitors, airs,
-        pre_charge_sequence, error_table, clock);
+        charge_controller, bms_ok, imd_ok, bspd_ok, accumulator, cell_monitors,
+        airs, pre_charge_sequence, tractive_system, error_table, clock);
 
     Io_StackWaterMark_Init(can_tx);
     Io_SoftwareWatchdog_Init(can_tx);
@@ -770,6 +786,9 @@ static void MX_DMA_Init(void)
     /* DMA1_Channel1_IRQn interrupt configuration */
     HAL_NVIC_SetPriority(DMA1_Channel1_IRQn, 5, 0);
     HAL_NVIC_EnableIRQ(DMA1_Channel1_IRQn);
+    /* DMA1_Channel7_IRQn interrupt configuration */
+    HAL_NVIC_SetPriority(DMA1_Channel7_IRQn, 5, 0);
+    HAL_NVIC_EnableIRQ(DMA1_Channel7_IRQn);
     /* DMA2_Channel1_IRQn interrupt configuration */
     HAL_NVIC_SetPriority(DMA2_Channel1_IRQn, 5, 0);
     HAL_NVIC_EnableIRQ(DMA2_Channel1_IRQn);
@@ -926,6 +945,7 @@ void RunTask1kHz(void const *argument)
         const uint32_t current_time_ms = osKernelSysTick() * portTICK_PERIOD_MS;
 
         App_SharedClock_SetCurrentTimeInMilliseconds(clock, current_time_ms);
+        App_SharedStateMachine_Tick1kHz(state_machine);
         Io_CanTx_EnqueuePeriodicMsgs(can_tx, current_time_ms);
 
         // Watchdog check-in must be the last function called before putting the
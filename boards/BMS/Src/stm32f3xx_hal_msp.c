@@ -28,6 +28,8 @@ extern DMA_HandleTypeDef hdma_adc1;
 
 extern DMA_HandleTypeDef hdma_adc2;
 
+extern DMA_HandleTypeDef hdma_tim2_ch2_ch4;
+
 /* Private typedef -----------------------------------------------------------*/
 /* USER CODE BEGIN TD */
 
@@ -409,6 +411,27 @@ void HAL_TIM_Base_MspInit(TIM_HandleTypeDef *htim_base)
         GPIO_InitStruct.Alternate = GPIO_AF1_TIM2;
         HAL_GPIO_Init(IMD_M_HS_GPIO_Port, &GPIO_InitStruct);
 
+        /* TIM2 DMA Init */
+        /* TIM2_CH2_CH4 Init */
+        hdma_tim2_ch2_ch4.Instance                 = DMA1_Channel7;
+        hdma_tim2_ch2_ch4.Init.Direction           = DMA_PERIPH_TO_MEMORY;
+        hdma_tim2_ch2_ch4.Init.PeriphInc           = DMA_PINC_DISABLE;
+        hdma_tim2_ch2_ch4.Init.MemInc              = DMA_MINC_ENABLE;
+        hdma_tim2_ch2_ch4.Init.PeriphDataAlignment = DMA_PDATAALIGN_WORD;
+        hdma_tim2_ch2_ch4.Init.MemDataAlignment    = DMA_MDATAALIGN_WORD;
+        hdma_tim2_ch2_ch4.Init.Mode                = DMA_CIRCULAR;
+        hdma_tim2_ch2_ch4.Init.Priority            = DMA_PRIORITY_LOW;
+        if (HAL_DMA_Init(&hdma_tim2_ch2_ch4) != HAL_OK)
+        {
+            Error_Handler();
+        }
+
+        /* Several peripheral DMA handle pointers point to the same DMA
+         * handle. Be aware that there is only one channel to perform all
+         * the requested DMAs. */
+        __HAL_LINKDMA(htim_base, hdma[TIM_DMA_ID_CC2], hdma_tim2_ch2_ch4);
+        __HAL_LINKDMA(htim_base, hdma[TIM_DMA_ID_CC4], hdma_tim2_ch2_ch4);
+
         /* TIM2 interrupt Init */
         HAL_NVIC_SetPriority(TIM2_IRQn, 5, 0);
         HAL_NVIC_EnableIRQ(TIM2_IRQn);
@@ -453,6 +476,10 @@ void HAL_TIM_Base_MspDeInit(TIM_HandleTypeDef *htim_base)
         */
         HAL_GPIO_DeInit(IMD_M_HS_GPIO_Port, IMD_M_HS_Pin);
 
+        /* TIM2 DMA DeInit */
+        HAL_DMA_DeInit(htim_base->hdma[TIM_DMA_ID_CC2]);
+        HAL_DMA_DeInit(htim_base->hdma[TIM_DMA_ID_CC4]);
+
         /* TIM2 interrupt DeInit */
         HAL_NVIC_DisableIRQ(TIM2_IRQn);
         /* USER CODE BEGIN TIM2_MspDeInit 1 */
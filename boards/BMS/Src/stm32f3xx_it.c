@@ -61,6 +61,7 @@
 /* External variables --------------------------------------------------------*/
 extern DMA_HandleTypeDef hdma_adc1;
 extern DMA_HandleTypeDef hdma_adc2;
+extern DMA_HandleTypeDef hdma_tim2_ch2_ch4;
 extern CAN_HandleTypeDef hcan;
 extern TIM_HandleTypeDef htim2;
 extern TIM_HandleTypeDef htim3;
@@ -180,6 +181,20 @@ void DMA1_Channel1_IRQHandler(void)
     /* USER CODE END DMA1_Channel1_IRQn 1 */
 }
 
+/**
+ * @brief This function handles DMA1 channel7 global interrupt.
+ */
+void DMA1_Channel7_IRQHandler(void)
+{
+    /* USER CODE BEGIN DMA1_Channel7_IRQn 0 */
+
+    /* USER CODE END DMA1_Channel7_IRQn 0 */
+    HAL_DMA_IRQHandler(&hdma_tim2_ch2_ch4);
+    /* USER CODE BEGIN DMA1_Channel7_IRQn 1 */
+
+    /* USER CODE END DMA1_Channel7_IRQn 1 */
+}
+
 /**
  * @brief This function handles USB high priority or CAN_TX interrupts.
  */
@@ -14,12 +14,16 @@ class ImdTest : public testing::Test
         struct Imd *           imd_to_set,
         enum Imd_ConditionName condition_name,
         float &                fake_pwm_frequency_return_val);
-    static void
-        SetPwmFrequencyTolerance(struct Imd *&imd_to_set, float tolerance);
+    static void SetPwmFrequencyToleranceAndHysteresis(
+        struct Imd *&imd_to_set,
+        float        tolerance,
+        float        hysteresis);
 
   protected:
     void SetUp() override;
     void TearDown() override;
 
+    struct Imd_Condition TickAndGetCondition(void);
+
     struct Imd *imd;
 };
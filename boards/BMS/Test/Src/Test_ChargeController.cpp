@@ -0,0 +1,417 @@
+#include <math.h>
+#include <algorithm>
+#include <limits>
+#include "Test_Bms.h"
+
+extern "C"
+{
+#include "App_ChargeController.h"
+#include "configs/App_ChargeControllerConfig.h"
+#include "configs/App_CellMonitorsThresholds.h"
+}
+
+FAKE_VALUE_FUNC(float, get_max_cell_voltage);
+FAKE_VALUE_FUNC(float, get_min_cell_voltage);
+FAKE_VALUE_FUNC(ExitCode, read_cell_temperatures);
+FAKE_VALUE_FUNC(float, get_max_cell_temperature);
+FAKE_VALUE_FUNC(float, get_max_die_temperature);
+
+// A lumped model of the highest and lowest cells in the accumulator, charged
+// in series by a charger that follows the current setpoint
+class PackModel
+{
+  public:
+    static constexpr float CELL_CAPACITY_AS     = 1.0f * 3600.0f;
+    static constexpr float CELL_RESISTANCE_OHMS = 0.02f;
+
+    // Cell temperature rise per joule of I^2R heating, and the rate at which
+    // the cells cool down towards the ambient temperature
+    static constexpr float HEATING_DEGC_PER_J = 0.05f;
+    static constexpr float COOLING_RATE_PER_S = 0.02f;
+
+    void Reset(
+        float highest_cell_soc,
+        float lowest_cell_soc,
+        float ambient_temperature_degc)
+    {
+        soc[0]              = highest_cell_soc;
+        soc[1]              = lowest_cell_soc;
+        current             = 0.0f;
+        ambient_temperature = ambient_temperature_degc;
+        temperature         = ambient_temperature_degc;
+    }
+
+    float GetCellVoltage(size_t cell) const
+    {
+        // Linearized open circuit voltage between 3.4V at 0% and 4.2V at 100%
+        return 3.4f + 0.8f * soc[cell] + current * CELL_RESISTANCE_OHMS;
+    }
+
+    void Update(float charger_current, float period_s)
+    {
+        current = charger_current;
+
+        for (float &cell_soc : soc)
+        {
+            cell_soc += current * period_s / CELL_CAPACITY_AS;
+        }
+
+        temperature +=
+            HEATING_DEGC_PER_J * current * current * CELL_RESISTANCE_OHMS *
+                period_s -
+            COOLING_RATE_PER_S * (temperature - ambient_temperature) * period_s;
+    }
+
+    float soc[2];
+    float current;
+    float ambient_temperature;
+    float temperature;
+};
+
+static PackModel pack;
+
+static float GetModelMaxCellVoltage(void)
+{
+    return pack.GetCellVoltage(0);
+}
+
+static float GetModelMinCellVoltage(void)
+{
+    return pack.GetCellVoltage(1);
+}
+
+static float GetModelCellTemperature(void)
+{
+    return pack.temperature;
+}
+
+class ChargeControllerTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        charge_controller = App_ChargeController_Create(
+            get_max_cell_voltage, get_min_cell_voltage, read_cell_temperatures,
+            get_max_cell_temperature, get_max_die_temperature);
+
+        RESET_FAKE(get_max_cell_voltage);
+        RESET_FAKE(get_min_cell_voltage);
+        RESET_FAKE(read_cell_temperatures);
+        RESET_FAKE(get_max_cell_temperature);
+        RESET_FAKE(get_max_die_temperature);
+
+        get_max_cell_voltage_fake.return_val     = 3.8f;
+        get_min_cell_voltage_fake.return_val     = 3.8f;
+        get_max_cell_temperature_fake.return_val = 25.0f;
+        get_max_die_temperature_fake.return_val  = 40.0f;
+
+        read_cell_temperatures_fake.return_val = EXIT_CODE_OK;
+        App_ChargeController_ReadCellTemperatures(charge_controller);
+    }
+
+    void TearDown() override
+    {
+        TearDownObject(charge_controller, App_ChargeController_Destroy);
+    }
+
+    void UsePackModel(
+        float highest_cell_soc,
+        float lowest_cell_soc,
+        float ambient_temperature_degc)
+    {
+        pack.Reset(highest_cell_soc, lowest_cell_soc, ambient_temperature_degc);
+        get_max_cell_voltage_fake.custom_fake     = GetModelMaxCellVoltage;
+        get_min_cell_voltage_fake.custom_fake     = GetModelMinCellVoltage;
+        get_max_cell_temperature_fake.custom_fake = GetModelCellTemperature;
+    }
+
+    void TickPackModel(void)
+    {
+        App_ChargeController_Tick(charge_controller);
+        pack.Update(
+            App_ChargeController_GetCurrentSetpoint(charge_controller),
+            CHARGE_CONTROLLER_TICK_PERIOD_S);
+    }
+
+    void TickForSeconds(float seconds)
+    {
+        const size_t num_ticks =
+            (size_t)(seconds / CHARGE_CONTROLLER_TICK_PERIOD_S);
+        for (size_t i = 0; i < num_ticks; i++)
+        {
+            App_ChargeController_Tick(charge_controller);
+        }
+    }
+
+    struct ChargeController *charge_controller;
+};
+
+TEST_F(ChargeControllerTest, current_setpoint_is_zero_until_started)
+{
+    TickForSeconds(1.0f);
+    ASSERT_EQ(
+        CHARGE_CONTROLLER_OFF, App_ChargeController_GetMode(charge_controller));
+    ASSERT_EQ(0.0f, App_ChargeController_GetCurrentSetpoint(charge_controller));
+}
+
+TEST_F(ChargeControllerTest, current_setpoint_ramps_up_but_drops_immediately)
+{
+    App_ChargeController_Start(charge_controller);
+
+    // The current ramps up at the slew rate
+    TickForSeconds(1.0f);
+    ASSERT_NEAR(
+        CHARGE_CONTROLLER_CURRENT_SLEW_RATE_A_PER_S,
+        App_ChargeController_GetCurrentSetpoint(charge_controller), 0.05f);
+
+    TickForSeconds(
+        CHARGE_CONTROLLER_MAX_CURRENT_A /
+        CHARGE_CONTROLLER_CURRENT_SLEW_RATE_A_PER_S);
+    ASSERT_FLOAT_EQ(
+        CHARGE_CONTROLLER_MAX_CURRENT_A,
+        App_ChargeController_GetCurrentSetpoint(charge_controller));
+    ASSERT_EQ(
+        CHARGE_CONTROLLER_CONSTANT_CURRENT,
+        App_ChargeController_GetMode(charge_controller));
+
+    // The current drops within a single tick
+    get_max_cell_temperature_fake.return_val =
+        CHARGE_CONTROLLER_CELL_TEMP_TO_STOP_CHARGING_DEGC;
+    App_ChargeController_Tick(charge_controller);
+    ASSERT_EQ(0.0f, App_ChargeController_GetCurrentSetpoint(charge_controller));
+}
+
+TEST_F(ChargeControllerTest, current_is_derated_by_cell_and_die_temperatures)
+{
+    App_ChargeController_Start(charge_controller);
+
+    struct
+    {
+        float cell_temperature;
+        float die_temperature;
+        float expected_derating_factor;
+    } test_cases[] = {
+        { CHARGE_CONTROLLER_CELL_TEMP_TO_START_DERATING_DEGC,
+          DIE_TEMP_TO_REENABLE_CHARGER_DEGC, 1.0f },
+        { (CHARGE_CONTROLLER_CELL_TEMP_TO_START_DERATING_DEGC +
+           CHARGE_CONTROLLER_CELL_TEMP_TO_STOP_CHARGING_DEGC) /
+              2.0f,
+          40.0f, 0.5f },
+        { 25.0f,
+          DIE_TEMP_TO_REENABLE_CHARGER_DEGC +
+              (DIE_TEMP_TO_DISABLE_CHARGER_DEGC -
+               DIE_TEMP_TO_REENABLE_CHARGER_DEGC) /
+                  4.0f,
+          0.75f },
+        { CHARGE_CONTROLLER_CELL_TEMP_TO_STOP_CHARGING_DEGC, 40.0f, 0.0f },
+        { 25.0f, DIE_TEMP_TO_DISABLE_CHARGER_DEGC, 0.0f },
+        // An invalid temperature must not allow any current
+        { NAN, 40.0f, 0.0f },
+        { 25.0f, NAN, 0.0f },
+    };
+
+    for (auto &test_case : test_cases)
+    {
+        get_max_cell_temperature_fake.return_val = test_case.cell_temperature;
+        get_max_die_temperature_fake.return_val  = test_case.die_temperature;
+
+        // Give the setpoint enough time to ramp up to the derated current
+        TickForSeconds(
+            CHARGE_CONTROLLER_MAX_CURRENT_A /
+                CHARGE_CONTROLLER_CURRENT_SLEW_RATE_A_PER_S +
+            1.0f);
+        ASSERT_NEAR(
+            test_case.expected_derating_factor,
+            App_ChargeController_GetDeratingFactor(charge_controller), 1e-4f);
+        ASSERT_NEAR(
+            test_case.expected_derating_factor *
+                CHARGE_CONTROLLER_MAX_CURRENT_A,
+            App_ChargeController_GetCurrentSetpoint(charge_controller), 1e-3f);
+    }
+}
+
+TEST_F(ChargeControllerTest, no_current_is_allowed_without_cell_temperatures)
+{
+    App_ChargeController_Destroy(charge_controller);
+    charge_controller = App_ChargeController_Create(
+        get_max_cell_voltage, get_min_cell_voltage, read_cell_temperatures,
+        get_max_cell_temperature, get_max_die_temperature);
+    App_ChargeController_Start(charge_controller);
+
+    // The cell temperatures have never been read
+    TickForSeconds(1.0f);
+    ASSERT_EQ(0.0f, App_ChargeController_GetDeratingFactor(charge_controller));
+    ASSERT_EQ(0.0f, App_ChargeController_GetCurrentSetpoint(charge_controller));
+    ASSERT_EQ(0, get_max_cell_temperature_fake.call_count);
+
+    ASSERT_EQ(
+        EXIT_CODE_OK,
+        App_ChargeController_ReadCellTemperatures(charge_controller));
+    TickForSeconds(1.0f);
+    ASSERT_EQ(1.0f, App_ChargeController_GetDeratingFactor(charge_controller));
+    ASSERT_GT(App_ChargeController_GetCurrentSetpoint(charge_controller), 0.0f);
+
+    // The current drops as soon as the cell temperatures can't be read
+    read_cell_temperatures_fake.return_val = EXIT_CODE_ERROR;
+    ASSERT_EQ(
+        EXIT_CODE_ERROR,
+        App_ChargeController_ReadCellTemperatures(charge_controller));
+    App_ChargeController_Tick(charge_controller);
+    ASSERT_EQ(0.0f, App_ChargeController_GetCurrentSetpoint(charge_controller));
+}
+
+TEST_F(ChargeControllerTest, cell_temperatures_are_pending_a_read_on_start)
+{
+    App_ChargeController_Stop(charge_controller);
+    ASSERT_FALSE(
+        App_ChargeController_IsCellTemperatureReadPending(charge_controller));
+
+    App_ChargeController_Start(charge_controller);
+    ASSERT_TRUE(
+        App_ChargeController_IsCellTemperatureReadPending(charge_controller));
+
+    // A failed read still services the pending read, so it isn't retried
+    // every tick
+    read_cell_temperatures_fake.return_val = EXIT_CODE_ERROR;
+    App_ChargeController_ReadCellTemperatures(charge_controller);
+    ASSERT_FALSE(
+        App_ChargeController_IsCellTemperatureReadPending(charge_controller));
+}
+
+TEST_F(ChargeControllerTest, current_is_capped_while_cells_are_balanced)
+{
+    App_ChargeController_Start(charge_controller);
+
+    // Reach the constant voltage phase with a large cell voltage spread
+    get_max_cell_voltage_fake.return_val =
+        CHARGE_CONTROLLER_TARGET_CELL_VOLTAGE;
+    get_min_cell_voltage_fake.return_val =
+        CHARGE_CONTROLLER_TARGET_CELL_VOLTAGE -
+        2.0f * CHARGE_CONTROLLER_BALANCING_CELL_VOLTAGE_SPREAD_V;
+    TickForSeconds(10.0f);
+    ASSERT_EQ(
+        CHARGE_CONTROLLER_CONSTANT_VOLTAGE,
+        App_ChargeController_GetMode(charge_controller));
+    ASSERT_LE(
+        App_ChargeController_GetCurrentSetpoint(charge_controller),
+        CHARGE_CONTROLLER_BALANCING_CURRENT_A);
+
+    // The charge can't complete until the spread is within the threshold,
+    // regardless of how little current the constant voltage loop requests
+    get_max_cell_voltage_fake.return_val =
+        CHARGE_CONTROLLER_TARGET_CELL_VOLTAGE + 0.1f;
+    TickForSeconds(2.0f * CHARGE_CONTROLLER_TERMINATION_TIME_S);
+    ASSERT_EQ(
+        CHARGE_CONTROLLER_CONSTANT_VOLTAGE,
+        App_ChargeController_GetMode(charge_controller));
+
+    get_min_cell_voltage_fake.return_val = get_max_cell_voltage_fake.return_val;
+    TickForSeconds(CHARGE_CONTROLLER_TERMINATION_TIME_S + 0.1f);
+    ASSERT_EQ(
+        CHARGE_CONTROLLER_COMPLETE,
+        App_ChargeController_GetMode(charge_controller));
+    ASSERT_EQ(0.0f, App_ChargeController_GetCurrentSetpoint(charge_controller));
+}
+
+TEST_F(ChargeControllerTest, charge_pack_model_with_cc_cv_profile)
+{
+    UsePackModel(0.2f, 0.2f, 25.0f);
+    App_ChargeController_Start(charge_controller);
+
+    float max_cell_voltage     = 0.0f;
+    float cc_time_s            = 0.0f;
+    float total_time_s         = 0.0f;
+    float previous_cv_current  = std::numeric_limits<float>::max();
+    bool  cv_current_increased = false;
+    while (App_ChargeController_GetMode(charge_controller) !=
+           CHARGE_CONTROLLER_COMPLETE)
+    {
+        // Give up after 3 hours of simulated time
+        ASSERT_LT(total_time_s, 3.0f * 3600.0f);
+
+        TickPackModel();
+        total_time_s += CHARGE_CONTROLLER_TICK_PERIOD_S;
+        max_cell_voltage = std::max(max_cell_voltage, pack.GetCellVoltage(0));
+
+        const float current =
+            App_ChargeController_GetCurrentSetpoint(charge_controller);
+        switch (App_ChargeController_GetMode(charge_controller))
+        {
+            case CHARGE_CONTROLLER_CONSTANT_CURRENT:
+                cc_time_s += CHARGE_CONTROLLER_TICK_PERIOD_S;
+                break;
+            case CHARGE_CONTROLLER_CONSTANT_VOLTAGE:
+                // Allow for the small ripple as the PI loop settles
+                cv_current_increased |= current > previous_cv_current + 0.05f;
+                previous_cv_current = current;
+                break;
+            default:
+                break;
+        }
+    }
+
+    // The constant current phase should charge at full current until the
+    // highest cell, including its IR drop, reaches the target voltage. Half of
+    // the initial ramp is lost compared to charging at full current.
+    const float cc_end_soc =
+        (CHARGE_CONTROLLER_TARGET_CELL_VOLTAGE - 3.4f -
+         CHARGE_CONTROLLER_MAX_CURRENT_A * PackModel::CELL_RESISTANCE_OHMS) /
+        0.8f;
+    const float expected_cc_time_s =
+        (cc_end_soc - 0.2f) * PackModel::CELL_CAPACITY_AS /
+            CHARGE_CONTROLLER_MAX_CURRENT_A +
+        0.5f * CHARGE_CONTROLLER_MAX_CURRENT_A /
+            CHARGE_CONTROLLER_CURRENT_SLEW_RATE_A_PER_S;
+    ASSERT_NEAR(expected_cc_time_s, cc_time_s, 0.02f * expected_cc_time_s);
+
+    // The current tapers off smoothly in the constant voltage phase and the
+    // highest cell never overshoots far past the target voltage
+    ASSERT_FALSE(cv_current_increased);
+    ASSERT_LT(max_cell_voltage, CHARGE_CONTROLLER_TARGET_CELL_VOLTAGE + 0.01f);
+    ASSERT_LT(max_cell_voltage, 4.2f);
+    ASSERT_GT(pack.soc[0], 0.9f);
+}
+
+TEST_F(ChargeControllerTest, charge_pack_model_at_thermal_limit)
+{
+    // At this ambient temperature, charging at full current would heat the
+    // cells past the temperature at which charging stops
+    UsePackModel(0.0f, 0.0f, 42.0f);
+    App_ChargeController_Start(charge_controller);
+
+    // Run for a few thermal time constants, staying in the constant current
+    // phase
+    for (size_t i = 0; i < (size_t)(
+                               3.0f / PackModel::COOLING_RATE_PER_S /
+                               CHARGE_CONTROLLER_TICK_PERIOD_S);
+         i++)
+    {
+        TickPackModel();
+    }
+    ASSERT_EQ(
+        CHARGE_CONTROLLER_CONSTANT_CURRENT,
+        App_ChargeController_GetMode(charge_controller));
+
+    // The pack should settle inside the derating band, where the heating at
+    // the derated current balances the cooling. This is the highest current
+    // that can be sustained at the thermal limit.
+    ASSERT_GT(
+        pack.temperature, CHARGE_CONTROLLER_CELL_TEMP_TO_START_DERATING_DEGC);
+    ASSERT_LT(
+        pack.temperature, CHARGE_CONTROLLER_CELL_TEMP_TO_STOP_CHARGING_DEGC);
+
+    const float expected_current =
+        CHARGE_CONTROLLER_MAX_CURRENT_A *
+        (CHARGE_CONTROLLER_CELL_TEMP_TO_STOP_CHARGING_DEGC - pack.temperature) /
+        (CHARGE_CONTROLLER_CELL_TEMP_TO_STOP_CHARGING_DEGC -
+         CHARGE_CONTROLLER_CELL_TEMP_TO_START_DERATING_DEGC);
+    ASSERT_NEAR(
+        expected_current,
+        App_ChargeController_GetCurrentSetpoint(charge_controller), 0.05f);
+
+    const float heating = PackModel::HEATING_DEGC_PER_J * pack.current *
+                          pack.current * PackModel::CELL_RESISTANCE_OHMS;
+    const float cooling = PackModel::COOLING_RATE_PER_S *
+                          (pack.temperature - pack.ambient_temperature);
+    ASSERT_NEAR(heating, cooling, 0.01f * cooling);
+}
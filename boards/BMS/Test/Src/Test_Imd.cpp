@@ -1,3 +1,4 @@
+#include <math.h>
 #include "Test_Imd.h"
 
 FAKE_VALUE_FUNC(float, get_pwm_frequency);
@@ -16,23 +17,29 @@ void ImdTest::SetImdCondition(
     };
 
     fake_pwm_frequency_return_val = mapping[condition_name];
+    App_Imd_Tick(imd_to_set);
     ASSERT_EQ(condition_name, App_Imd_GetCondition(imd_to_set).name);
 }
 
-void ImdTest::SetPwmFrequencyTolerance(struct Imd *&imd_to_set, float tolerance)
+void ImdTest::SetPwmFrequencyToleranceAndHysteresis(
+    struct Imd *&imd_to_set,
+    float        tolerance,
+    float        hysteresis)
 {
     TearDownObject(imd_to_set, App_Imd_Destroy);
     imd_to_set = App_Imd_Create(
-        get_pwm_frequency, tolerance, get_pwm_duty_cycle,
+        get_pwm_frequency, tolerance, hysteresis, get_pwm_duty_cycle,
         get_seconds_since_power_on);
 }
 
 void ImdTest::SetUp()
 {
-    constexpr float DEFAULT_FREQUENCY_TOLERANCE = 2.0f;
+    constexpr float DEFAULT_FREQUENCY_TOLERANCE  = 2.0f;
+    constexpr float DEFAULT_FREQUENCY_HYSTERESIS = 1.0f;
 
     imd = App_Imd_Create(
-        get_pwm_frequency, DEFAULT_FREQUENCY_TOLERANCE, get_pwm_duty_cycle,
+        get_pwm_frequency, DEFAULT_FREQUENCY_TOLERANCE,
+        DEFAULT_FREQUENCY_HYSTERESIS, get_pwm_duty_cycle,
         get_seconds_since_power_on);
 
     RESET_FAKE(get_pwm_frequency);
@@ -45,6 +52,12 @@ void ImdTest::TearDown()
     TearDownObject(imd, App_Imd_Destroy);
 }
 
+struct Imd_Condition ImdTest::TickAndGetCondition(void)
+{
+    App_Imd_Tick(imd);
+    return App_Imd_GetCondition(imd);
+}
+
 TEST_F(
     ImdTest,
     check_insulation_resistance_for_normal_and_undervoltage_conditions)
@@ -65,30 +78,29 @@ TEST_F(
         constexpr float MIN_VALID_DUTY_CYCLE = 5.0f;
 
         get_pwm_duty_cycle_fake.return_val = MIN_VALID_DUTY_CYCLE - 0.01f;
-        struct Imd_Condition condition     = App_Imd_GetCondition(imd);
+        struct Imd_Condition condition     = TickAndGetCondition();
         ASSERT_EQ(false, condition.pwm_encoding.valid_duty_cycle);
 
         get_pwm_duty_cycle_fake.return_val = MIN_VALID_DUTY_CYCLE;
-        condition                          = App_Imd_GetCondition(imd);
+        condition                          = TickAndGetCondition();
         ASSERT_EQ(true, condition.pwm_encoding.valid_duty_cycle);
         ASSERT_EQ(
             50000, condition.pwm_encoding.insulation_measurement_dcp_kohms);
 
         get_pwm_duty_cycle_fake.return_val =
             (MIN_VALID_DUTY_CYCLE + MAX_VALID_DUTY_CYCLE) / 2.0f;
-        condition = App_Imd_GetCondition(imd);
+        condition = TickAndGetCondition();
         ASSERT_EQ(true, condition.pwm_encoding.valid_duty_cycle);
         ASSERT_EQ(
             1200, condition.pwm_encoding.insulation_measurement_dcp_kohms);
 
         get_pwm_duty_cycle_fake.return_val = MAX_VALID_DUTY_CYCLE;
-        condition                          = App_Imd_GetCondition(imd);
+        condition                          = TickAndGetCondition();
         ASSERT_EQ(true, condition.pwm_encoding.valid_duty_cycle);
         ASSERT_EQ(0, condition.pwm_encoding.insulation_measurement_dcp_kohms);
 
         get_pwm_duty_cycle_fake.return_val = MAX_VALID_DUTY_CYCLE + 0.01f;
-        ASSERT_EQ(
-            false, App_Imd_GetCondition(imd).pwm_encoding.valid_duty_cycle);
+        ASSERT_EQ(false, TickAndGetCondition().pwm_encoding.valid_duty_cycle);
     }
 }
 
@@ -107,40 +119,40 @@ TEST_F(ImdTest, check_good_and_bad_evaluation_for_sst_condition)
     constexpr float BAD_MAX_DUTY_CYCLE = 95.0f;
 
     get_pwm_duty_cycle_fake.return_val = GOOD_MIN_DUTY_CYCLE - 0.1f;
-    ASSERT_EQ(false, App_Imd_GetCondition(imd).pwm_encoding.valid_duty_cycle);
+    ASSERT_EQ(false, TickAndGetCondition().pwm_encoding.valid_duty_cycle);
 
     get_pwm_duty_cycle_fake.return_val = GOOD_MIN_DUTY_CYCLE;
-    struct Imd_Condition condition     = App_Imd_GetCondition(imd);
+    struct Imd_Condition condition     = TickAndGetCondition();
     ASSERT_EQ(true, condition.pwm_encoding.valid_duty_cycle);
     ASSERT_EQ(SST_GOOD, condition.pwm_encoding.speed_start_status);
 
     get_pwm_duty_cycle_fake.return_val = GOOD_MAX_DUTY_CYCLE;
-    condition                          = App_Imd_GetCondition(imd);
+    condition                          = TickAndGetCondition();
     ASSERT_EQ(true, condition.pwm_encoding.valid_duty_cycle);
     ASSERT_EQ(SST_GOOD, condition.pwm_encoding.speed_start_status);
 
     get_pwm_duty_cycle_fake.return_val = GOOD_MAX_DUTY_CYCLE + 0.1f;
-    ASSERT_EQ(false, App_Imd_GetCondition(imd).pwm_encoding.valid_duty_cycle);
+    ASSERT_EQ(false, TickAndGetCondition().pwm_encoding.valid_duty_cycle);
 
     get_pwm_duty_cycle_fake.return_val =
         (GOOD_MIN_DUTY_CYCLE + BAD_MIN_DUTY_CYCLE) / 2.0f;
-    ASSERT_EQ(false, App_Imd_GetCondition(imd).pwm_encoding.valid_duty_cycle);
+    ASSERT_EQ(false, TickAndGetCondition().pwm_encoding.valid_duty_cycle);
 
     get_pwm_duty_cycle_fake.return_val = BAD_MIN_DUTY_CYCLE - 0.1f;
-    ASSERT_EQ(false, App_Imd_GetCondition(imd).pwm_encoding.valid_duty_cycle);
+    ASSERT_EQ(false, TickAndGetCondition().pwm_encoding.valid_duty_cycle);
 
     get_pwm_duty_cycle_fake.return_val = BAD_MIN_DUTY_CYCLE;
-    condition                          = App_Imd_GetCondition(imd);
+    condition                          = TickAndGetCondition();
     ASSERT_EQ(true, condition.pwm_encoding.valid_duty_cycle);
     ASSERT_EQ(SST_BAD, condition.pwm_encoding.speed_start_status);
 
     get_pwm_duty_cycle_fake.return_val = BAD_MAX_DUTY_CYCLE;
-    condition                          = App_Imd_GetCondition(imd);
+    condition                          = TickAndGetCondition();
     ASSERT_EQ(true, condition.pwm_encoding.valid_duty_cycle);
     ASSERT_EQ(SST_BAD, condition.pwm_encoding.speed_start_status);
 
     get_pwm_duty_cycle_fake.return_val = BAD_MAX_DUTY_CYCLE + 0.1f;
-    ASSERT_EQ(false, App_Imd_GetCondition(imd).pwm_encoding.valid_duty_cycle);
+    ASSERT_EQ(false, TickAndGetCondition().pwm_encoding.valid_duty_cycle);
 }
 
 TEST_F(ImdTest, check_pwm_encoding_for_device_error_condition)
@@ -154,16 +166,16 @@ TEST_F(ImdTest, check_pwm_encoding_for_device_error_condition)
     constexpr float MAX_VALID_DUTY_CYCLE = 52.5f;
 
     get_pwm_duty_cycle_fake.return_val = MIN_VALID_DUTY_CYCLE - 0.1f;
-    ASSERT_EQ(false, App_Imd_GetCondition(imd).pwm_encoding.valid_duty_cycle);
+    ASSERT_EQ(false, TickAndGetCondition().pwm_encoding.valid_duty_cycle);
 
     get_pwm_duty_cycle_fake.return_val = MIN_VALID_DUTY_CYCLE;
-    ASSERT_EQ(true, App_Imd_GetCondition(imd).pwm_encoding.valid_duty_cycle);
+    ASSERT_EQ(true, TickAndGetCondition().pwm_encoding.valid_duty_cycle);
 
     get_pwm_duty_cycle_fake.return_val = MAX_VALID_DUTY_CYCLE;
-    ASSERT_EQ(true, App_Imd_GetCondition(imd).pwm_encoding.valid_duty_cycle);
+    ASSERT_EQ(true, TickAndGetCondition().pwm_encoding.valid_duty_cycle);
 
     get_pwm_duty_cycle_fake.return_val = MAX_VALID_DUTY_CYCLE + 0.1f;
-    ASSERT_EQ(false, App_Imd_GetCondition(imd).pwm_encoding.valid_duty_cycle);
+    ASSERT_EQ(false, TickAndGetCondition().pwm_encoding.valid_duty_cycle);
 }
 
 TEST_F(ImdTest, check_pwm_encoding_for_earth_fault_condition)
@@ -177,16 +189,16 @@ TEST_F(ImdTest, check_pwm_encoding_for_earth_fault_condition)
     constexpr float MAX_VALID_DUTY_CYCLE = 52.5f;
 
     get_pwm_duty_cycle_fake.return_val = MIN_VALID_DUTY_CYCLE - 0.1f;
-    ASSERT_EQ(false, App_Imd_GetCondition(imd).pwm_encoding.valid_duty_cycle);
+    ASSERT_EQ(false, TickAndGetCondition().pwm_encoding.valid_duty_cycle);
 
     get_pwm_duty_cycle_fake.return_val = MIN_VALID_DUTY_CYCLE;
-    ASSERT_EQ(true, App_Imd_GetCondition(imd).pwm_encoding.valid_duty_cycle);
+    ASSERT_EQ(true, TickAndGetCondition().pwm_encoding.valid_duty_cycle);
 
     get_pwm_duty_cycle_fake.return_val = MAX_VALID_DUTY_CYCLE;
-    ASSERT_EQ(true, App_Imd_GetCondition(imd).pwm_encoding.valid_duty_cycle);
+    ASSERT_EQ(true, TickAndGetCondition().pwm_encoding.valid_duty_cycle);
 
     get_pwm_duty_cycle_fake.return_val = MAX_VALID_DUTY_CYCLE + 0.1f;
-    ASSERT_EQ(false, App_Imd_GetCondition(imd).pwm_encoding.valid_duty_cycle);
+    ASSERT_EQ(false, TickAndGetCondition().pwm_encoding.valid_duty_cycle);
 }
 
 TEST_F(ImdTest, check_mapping_for_frequency_to_condition)
@@ -232,11 +244,82 @@ TEST_F(ImdTest, check_mapping_for_frequency_to_condition)
         { 53.0f, IMD_INVALID },
     };
 
-    SetPwmFrequencyTolerance(imd, 2.0f);
-
     for (auto &entry : lookup_table)
     {
+        // Start from a new IMD each time, so the mapping isn't affected by the
+        // hysteresis around the previous condition
+        SetPwmFrequencyToleranceAndHysteresis(imd, 2.0f, 1.0f);
+
         get_pwm_frequency_fake.return_val = entry.frequency;
-        ASSERT_EQ(App_Imd_GetCondition(imd).name, entry.condition_name);
+        ASSERT_EQ(TickAndGetCondition().name, entry.condition_name);
+    }
+}
+
+TEST_F(ImdTest, check_hysteresis_for_frequency_to_condition)
+{
+    SetPwmFrequencyToleranceAndHysteresis(imd, 2.0f, 1.0f);
+    SetImdCondition(imd, IMD_NORMAL, get_pwm_frequency_fake.return_val);
+
+    // The frequency may drift past the tolerance without leaving the current
+    // condition, as long as it stays within the hysteresis
+    get_pwm_frequency_fake.return_val = 12.9f;
+    ASSERT_EQ(IMD_NORMAL, TickAndGetCondition().name);
+    get_pwm_frequency_fake.return_val = 7.1f;
+    ASSERT_EQ(IMD_NORMAL, TickAndGetCondition().name);
+
+    get_pwm_frequency_fake.return_val = 13.1f;
+    ASSERT_EQ(IMD_INVALID, TickAndGetCondition().name);
+
+    // Re-entering the condition requires the frequency to be back within the
+    // tolerance
+    get_pwm_frequency_fake.return_val = 12.9f;
+    ASSERT_EQ(IMD_INVALID, TickAndGetCondition().name);
+    get_pwm_frequency_fake.return_val = 12.0f;
+    ASSERT_EQ(IMD_NORMAL, TickAndGetCondition().name);
+
+    // Leaving the current condition through the hysteresis band of another
+    // condition switches to the other condition once within its tolerance
+    get_pwm_frequency_fake.return_val = 17.5f;
+    ASSERT_EQ(IMD_INVALID, TickAndGetCondition().name);
+    get_pwm_frequency_fake.return_val = 18.0f;
+    ASSERT_EQ(IMD_UNDERVOLTAGE_DETECTED, TickAndGetCondition().name);
+    get_pwm_frequency_fake.return_val = 17.5f;
+    ASSERT_EQ(IMD_UNDERVOLTAGE_DETECTED, TickAndGetCondition().name);
+}
+
+TEST_F(ImdTest, check_invalid_frequency_maps_to_invalid_condition)
+{
+    SetImdCondition(imd, IMD_NORMAL, get_pwm_frequency_fake.return_val);
+
+    // The PWM input reports NAN when the captured periods don't agree
+    get_pwm_frequency_fake.return_val = NAN;
+    struct Imd_Condition condition    = TickAndGetCondition();
+    ASSERT_EQ(IMD_INVALID, condition.name);
+    ASSERT_EQ(false, condition.pwm_encoding.valid_duty_cycle);
+}
+
+TEST_F(ImdTest, check_insulation_resistance_is_continuous_in_duty_cycle)
+{
+    SetImdCondition(imd, IMD_NORMAL, get_pwm_frequency_fake.return_val);
+
+    // The resistance saturates at 50MOhms, rather than overflowing, for duty
+    // cycles just above 5%
+    get_pwm_duty_cycle_fake.return_val = 6.0f;
+    ASSERT_EQ(
+        50000,
+        TickAndGetCondition().pwm_encoding.insulation_measurement_dcp_kohms);
+
+    // The resistance falls monotonically as the duty cycle rises
+    uint16_t previous_resistance = 50000;
+    for (float duty_cycle = 5.0f; duty_cycle <= 95.0f; duty_cycle += 0.1f)
+    {
+        get_pwm_duty_cycle_fake.return_val   = duty_cycle;
+        const struct Imd_Condition condition = TickAndGetCondition();
+        ASSERT_EQ(true, condition.pwm_encoding.valid_duty_cycle);
+        ASSERT_LE(
+            condition.pwm_encoding.insulation_measurement_dcp_kohms,
+            previous_resistance);
+        previous_resistance =
+            condition.pwm_encoding.insulation_measurement_dcp_kohms;
     }
 }
@@ -18,6 +18,8 @@ extern "C"
 #include "configs/App_AccumulatorConfigs.h"
 #include "configs/App_AccumulatorThresholds.h"
 #include "configs/App_CellMonitorsThresholds.h"
+#include "configs/App_PreChargeConfig.h"
+#include "configs/App_ChargeControllerConfig.h"
 }
 
 namespace StateMachineTest
@@ -79,6 +81,10 @@ FAKE_VOID_FUNC(open_air_positive);
 FAKE_VOID_FUNC(close_air_positive);
 FAKE_VOID_FUNC(enable_pre_charge);
 FAKE_VOID_FUNC(disable_pre_charge);
+FAKE_VALUE_FUNC(float, get_ts_voltage);
+FAKE_VALUE_FUNC(float, get_ts_current);
+FAKE_VALUE_FUNC(ExitCode, read_cell_temperatures);
+FAKE_VALUE_FUNC(float, get_max_cell_temperature);
 
 class BmsStateMachineTest : public BaseStateMachineTest
 {
@@ -94,7 +100,8 @@ class BmsStateMachineTest : public BaseStateMachineTest
         can_rx_interface = App_CanRx_Create();
 
         imd = App_Imd_Create(
-            get_pwm_frequency, IMD_FREQUENCY_TOLERANCE, get_pwm_duty_cycle,
+            get_pwm_frequency, IMD_FREQUENCY_TOLERANCE,
+            IMD_FREQUENCY_HYSTERESIS, get_pwm_duty_cycle,
             get_seconds_since_power_on);
 
         heartbeat_monitor = App_SharedHeartbeatMonitor_Create(
@@ -107,6 +114,10 @@ class BmsStateMachineTest : public BaseStateMachineTest
         charger = App_Charger_Create(
             enable_charger, disable_charger, is_charger_connected);
 
+        charge_controller = App_ChargeController_Create(
+            get_max_cell_voltage, get_min_cell_voltage, read_cell_temperatures,
+            get_max_cell_temperature, get_max_die_temp);
+
         bms_ok = App_OkStatus_Create(
             enable_bms_ok, disable_bms_ok, is_bms_ok_enabled);
 
@@ -134,8 +145,12 @@ class BmsStateMachineTest : public BaseStateMachineTest
             DIE_TEMP_TO_DISABLE_CELL_BALANCING_DEGC,
             DIE_TEMP_TO_DISABLE_CHARGER_DEGC);
 
-        pre_charge_sequence =
-            App_PreChargeSequence_Create(enable_pre_charge, disable_pre_charge);
+        pre_charge_sequence = App_PreChargeSequence_Create(
+            enable_pre_charge, disable_pre_charge, get_ts_voltage,
+            get_pack_voltage);
+
+        tractive_system =
+            App_TractiveSystem_Create(get_ts_voltage, get_ts_current);
 
         airs = App_Airs_Create(
             is_air_positive_closed, is_air_negative_closed, close_air_positive,
@@ -147,8 +162,9 @@ class BmsStateMachineTest : public BaseStateMachineTest
 
         world = App_BmsWorld_Create(
             can_tx_interface, can_rx_interface, imd, heartbeat_monitor,
-            rgb_led_sequence, charger, bms_ok, imd_ok, bspd_ok, accumulator,
-            cell_monitors, airs, pre_charge_sequence, error_table, clock);
+            rgb_led_sequence, charger, charge_controller, bms_ok, imd_ok,
+            bspd_ok, accumulator, cell_monitors, airs, pre_charge_sequence,
+            tractive_system, error_table, clock);
 
         // Default to starting the state machine in the `init` state
         state_machine =
@@ -194,6 +210,13 @@ class BmsStateMachineTest : public BaseStateMachineTest
         RESET_FAKE(get_max_die_temp);
         RESET_FAKE(is_air_negative_closed);
         RESET_FAKE(is_air_positive_closed);
+        RESET_FAKE(close_air_positive);
+        RESET_FAKE(enable_pre_charge);
+        RESET_FAKE(disable_pre_charge);
+        RESET_FAKE(get_ts_voltage);
+        RESET_FAKE(get_ts_current);
+        RESET_FAKE(read_cell_temperatures);
+        RESET_FAKE(get_max_cell_temperature);
 
         // The charger is connected to prevent other tests from entering the
         // fault state from the charge state
@@ -203,6 +226,11 @@ class BmsStateMachineTest : public BaseStateMachineTest
         // tests from entering the fault state
         get_min_cell_voltage_fake.return_val = 4.0f;
         get_max_cell_voltage_fake.return_val = 4.0f;
+
+        // A valid pack voltage prevents the pre-charge sequence from faulting
+        // as soon as it is started
+        get_pack_voltage_fake.return_val =
+            (MIN_PACK_VOLTAGE + MAX_PACK_VOLTAGE) / 2.0f;
     }
 
     void TearDown() override
@@ -215,6 +243,7 @@ class BmsStateMachineTest : public BaseStateMachineTest
         TearDownObject(heartbeat_monitor, App_SharedHeartbeatMonitor_Destroy);
         TearDownObject(rgb_led_sequence, App_SharedRgbLedSequence_Destroy);
         TearDownObject(charger, App_Charger_Destroy);
+        TearDownObject(charge_controller, App_ChargeController_Destroy);
         TearDownObject(bms_ok, App_OkStatus_Destroy);
         TearDownObject(imd_ok, App_OkStatus_Destroy);
         TearDownObject(bspd_ok, App_OkStatus_Destroy);
@@ -222,6 +251,7 @@ class BmsStateMachineTest : public BaseStateMachineTest
         TearDownObject(cell_monitors, App_CellMonitors_Destroy);
         TearDownObject(airs, App_Airs_Destroy);
         TearDownObject(pre_charge_sequence, App_PreChargeSequence_Destroy);
+        TearDownObject(tractive_system, App_TractiveSystem_Destroy);
         TearDownObject(error_table, App_SharedErrorTable_Destroy);
         TearDownObject(clock, App_SharedClock_Destroy);
     }
@@ -278,6 +308,27 @@ class BmsStateMachineTest : public BaseStateMachineTest
             overflow_choice, out_of_range_can_signal_getter(can_tx_interface));
     }
 
+    uint32_t RunNominalPreChargeSequence(void)
+    {
+        // Follow the nominal RC charging curve from the moment the pre-charge
+        // state is entered until the state machine leaves the pre-charge state
+        uint32_t elapsed_time_ms = 0;
+        while (App_SharedStateMachine_GetCurrentState(state_machine) ==
+                   App_GetPreChargeState() &&
+               elapsed_time_ms < PRE_CHARGE_TIMEOUT_MS)
+        {
+            get_ts_voltage_fake.return_val =
+                get_pack_voltage_fake.return_val *
+                (1.0f -
+                 expf(
+                     -(float)elapsed_time_ms / PRE_CHARGE_RC_TIME_CONSTANT_MS));
+            LetTimePass(state_machine, 1);
+            elapsed_time_ms++;
+        }
+
+        return elapsed_time_ms;
+    }
+
     void UpdateClock(
         struct StateMachine *state_machine,
         uint32_t             current_time_ms) override
@@ -304,6 +355,7 @@ class BmsStateMachineTest : public BaseStateMachineTest
     struct HeartbeatMonitor * heartbeat_monitor;
     struct RgbLedSequence *   rgb_led_sequence;
     struct Charger *          charger;
+    struct ChargeController * charge_controller;
     struct OkStatus *         bms_ok;
     struct OkStatus *         imd_ok;
     struct OkStatus *         bspd_ok;
@@ -311,6 +363,7 @@ class BmsStateMachineTest : public BaseStateMachineTest
     struct CellMonitors *     cell_monitors;
     struct Airs *             airs;
     struct PreChargeSequence *pre_charge_sequence;
+    struct TractiveSystem *   tractive_system;
     struct ErrorTable *       error_table;
     struct Clock *            clock;
 };
@@ -576,6 +629,30 @@ TEST_F(BmsStateMachineTest, charger_connection_status_in_all_states)
     }
 }
 
+TEST_F(
+    BmsStateMachineTest,
+    check_tractive_system_voltage_and_current_are_broadcasted_over_can_in_all_states)
+{
+    for (auto &state : GetAllStates())
+    {
+        SetInitialState(state);
+
+        get_ts_voltage_fake.return_val = 350.0f;
+        get_ts_current_fake.return_val = 120.0f;
+        LetTimePass(state_machine, 10);
+        ASSERT_FLOAT_EQ(
+            350.0f, App_CanTx_GetPeriodicSignal_TS_VOLTAGE(can_tx_interface));
+        ASSERT_FLOAT_EQ(
+            120.0f, App_CanTx_GetPeriodicSignal_TS_CURRENT(can_tx_interface));
+
+        // The current is negative while regenerating
+        get_ts_current_fake.return_val = -40.0f;
+        LetTimePass(state_machine, 10);
+        ASSERT_FLOAT_EQ(
+            -40.0f, App_CanTx_GetPeriodicSignal_TS_CURRENT(can_tx_interface));
+    }
+}
+
 // BMS-37
 TEST_F(BmsStateMachineTest, check_bms_ok_is_broadcasted_over_can_in_all_states)
 {
@@ -650,6 +727,81 @@ TEST_F(BmsStateMachineTest, charger_disconnects_in_charge_state)
         App_SharedStateMachine_GetCurrentState(state_machine));
 }
 
+TEST_F(BmsStateMachineTest, charger_is_disabled_once_charge_is_complete)
+{
+    SetInitialState(App_GetChargeState());
+
+    App_Charger_Enable(charger);
+
+    // Let the current ramp up in the constant current phase
+    LetTimePass(state_machine, 1000);
+    ASSERT_EQ(
+        CANMSGS_BMS_CHARGER_CHARGE_MODE_CONSTANT_CURRENT_CHOICE,
+        App_CanTx_GetPeriodicSignal_CHARGE_MODE(can_tx_interface));
+    ASSERT_GT(
+        App_CanTx_GetPeriodicSignal_CHARGER_CURRENT_SETPOINT(can_tx_interface),
+        0.0f);
+    ASSERT_EQ(true, App_Charger_IsEnabled(charger));
+
+    // Balanced cells above the target voltage leave nothing for the constant
+    // voltage loop to charge
+    get_min_cell_voltage_fake.return_val =
+        CHARGE_CONTROLLER_TARGET_CELL_VOLTAGE + 0.01f;
+    get_max_cell_voltage_fake.return_val =
+        CHARGE_CONTROLLER_TARGET_CELL_VOLTAGE + 0.01f;
+    LetTimePass(
+        state_machine,
+        (uint32_t)(CHARGE_CONTROLLER_TERMINATION_TIME_S * 1000.0f) + 1000U);
+    ASSERT_EQ(
+        CANMSGS_BMS_CHARGER_CHARGE_MODE_COMPLETE_CHOICE,
+        App_CanTx_GetPeriodicSignal_CHARGE_MODE(can_tx_interface));
+    ASSERT_EQ(
+        0.0f,
+        App_CanTx_GetPeriodicSignal_CHARGER_CURRENT_SETPOINT(can_tx_interface));
+    ASSERT_EQ(false, App_Charger_IsEnabled(charger));
+
+    // The charger must not be re-enabled by the die temperature hysteresis
+    LetTimePass(state_machine, 2000);
+    ASSERT_EQ(false, App_Charger_IsEnabled(charger));
+    ASSERT_EQ(
+        App_GetChargeState(),
+        App_SharedStateMachine_GetCurrentState(state_machine));
+}
+
+TEST_F(BmsStateMachineTest, charge_current_is_derated_by_cell_temperature)
+{
+    // Halfway through the derating curve, half of the current is allowed
+    get_max_cell_temperature_fake.return_val =
+        (CHARGE_CONTROLLER_CELL_TEMP_TO_START_DERATING_DEGC +
+         CHARGE_CONTROLLER_CELL_TEMP_TO_STOP_CHARGING_DEGC) /
+        2.0f;
+    SetInitialState(App_GetChargeState());
+
+    // The cell temperatures aren't read on entry, which may run in the 1kHz
+    // tick, but by the 100Hz tick before the controller first uses them
+    ASSERT_EQ(0, read_cell_temperatures_fake.call_count);
+    LetTimePass(state_machine, 10);
+    ASSERT_EQ(1, read_cell_temperatures_fake.call_count);
+
+    LetTimePass(
+        state_machine,
+        (uint32_t)(
+            CHARGE_CONTROLLER_MAX_CURRENT_A /
+            CHARGE_CONTROLLER_CURRENT_SLEW_RATE_A_PER_S * 1000.0f));
+    ASSERT_GT(read_cell_temperatures_fake.call_count, 1);
+    ASSERT_NEAR(
+        CHARGE_CONTROLLER_MAX_CURRENT_A / 2.0f,
+        App_CanTx_GetPeriodicSignal_CHARGER_CURRENT_SETPOINT(can_tx_interface),
+        0.01f);
+
+    // The current is cut once the cell temperatures can no longer be read
+    read_cell_temperatures_fake.return_val = EXIT_CODE_ERROR;
+    LetTimePass(state_machine, 1000);
+    ASSERT_EQ(
+        0.0f,
+        App_CanTx_GetPeriodicSignal_CHARGER_CURRENT_SETPOINT(can_tx_interface));
+}
+
 // BMS-38
 TEST_F(BmsStateMachineTest, check_airs_can_signals_for_all_states)
 {
@@ -916,4 +1068,136 @@ TEST_F(
         App_CanTx_GetPeriodicSignal_STATE(can_tx_interface));
 }
 
+// BMS-12
+TEST_F(
+    BmsStateMachineTest,
+    check_pre_charge_sequence_is_enabled_on_entry_and_disabled_on_exit)
+{
+    SetInitialState(App_GetPreChargeState());
+    ASSERT_EQ(1, enable_pre_charge_fake.call_count);
+    ASSERT_EQ(0, disable_pre_charge_fake.call_count);
+
+    // Opening AIR- aborts the pre-charge sequence
+    is_air_negative_closed_fake.return_val = false;
+    LetTimePass(state_machine, 10);
+    ASSERT_EQ(
+        CANMSGS_BMS_STATE_MACHINE_STATE_AIR_OPEN_CHOICE,
+        App_CanTx_GetPeriodicSignal_STATE(can_tx_interface));
+    ASSERT_EQ(1, disable_pre_charge_fake.call_count);
+    ASSERT_EQ(0, close_air_positive_fake.call_count);
+}
+
+// BMS-12
+TEST_F(
+    BmsStateMachineTest,
+    check_air_positive_closes_as_soon_as_pre_charge_is_complete)
+{
+    is_air_negative_closed_fake.return_val = true;
+    is_charger_connected_fake.return_val   = false;
+    SetInitialState(App_GetPreChargeState());
+
+    const uint32_t elapsed_time_ms = RunNominalPreChargeSequence();
+
+    // The sequence should complete a few samples after the voltage ratio
+    // crosses the threshold rather than after a fixed worst-case time
+    const float expected_time_ms =
+        -PRE_CHARGE_RC_TIME_CONSTANT_MS *
+        logf(1.0f - PRE_CHARGE_COMPLETE_VOLTAGE_RATIO);
+    ASSERT_NEAR(
+        expected_time_ms + PRE_CHARGE_COMPLETE_SAMPLES, elapsed_time_ms, 2.0f);
+    ASSERT_EQ(1, close_air_positive_fake.call_count);
+    ASSERT_EQ(1, disable_pre_charge_fake.call_count);
+    ASSERT_EQ(
+        CANMSGS_BMS_STATE_MACHINE_STATE_DRIVE_CHOICE,
+        App_CanTx_GetPeriodicSignal_STATE(can_tx_interface));
+    ASSERT_EQ(
+        CANMSGS_BMS_AIR_STATES_AIR_POSITIVE_CLOSED_CHOICE,
+        App_CanTx_GetPeriodicSignal_AIR_POSITIVE(can_tx_interface));
+    ASSERT_EQ(
+        CANMSGS_BMS_PRE_CHARGE_PRE_CHARGE_STATUS_COMPLETE_CHOICE,
+        App_CanTx_GetPeriodicSignal_PRE_CHARGE_STATUS(can_tx_interface));
+    ASSERT_GE(
+        App_CanTx_GetPeriodicSignal_PRE_CHARGE_VOLTAGE_RATIO(can_tx_interface),
+        PRE_CHARGE_COMPLETE_VOLTAGE_RATIO);
+
+    // The measured curve should be logged for offline analysis
+    uint32_t     num_samples;
+    const float *log = App_PreChargeSequence_GetVoltageRatioLog(
+        pre_charge_sequence, &num_samples);
+    ASSERT_EQ(
+        (elapsed_time_ms - 1) / PRE_CHARGE_LOG_PERIOD_MS + 1, num_samples);
+    for (uint32_t i = 0; i < num_samples; i++)
+    {
+        ASSERT_NEAR(
+            1.0f - expf(
+                       -(float)(i * PRE_CHARGE_LOG_PERIOD_MS) /
+                       PRE_CHARGE_RC_TIME_CONSTANT_MS),
+            log[i], 1e-4f);
+    }
+}
+
+// BMS-12
+TEST_F(
+    BmsStateMachineTest,
+    check_transition_from_pre_charge_state_to_charge_state)
+{
+    is_air_negative_closed_fake.return_val = true;
+    is_charger_connected_fake.return_val   = true;
+    SetInitialState(App_GetPreChargeState());
+
+    RunNominalPreChargeSequence();
+    ASSERT_EQ(
+        CANMSGS_BMS_STATE_MACHINE_STATE_CHARGE_CHOICE,
+        App_CanTx_GetPeriodicSignal_STATE(can_tx_interface));
+    ASSERT_EQ(1, close_air_positive_fake.call_count);
+}
+
+// BMS-12
+TEST_F(
+    BmsStateMachineTest,
+    check_transition_from_pre_charge_state_to_fault_state_if_ts_rises_too_fast)
+{
+    is_air_negative_closed_fake.return_val = true;
+    SetInitialState(App_GetPreChargeState());
+
+    // A TS voltage that jumps straight to the pack voltage indicates that the
+    // pre-charge resistor is shorted or AIR+ is welded
+    get_ts_voltage_fake.return_val = get_pack_voltage_fake.return_val;
+    LetTimePass(state_machine, PRE_CHARGE_FAULT_SAMPLES - 1);
+    ASSERT_EQ(
+        CANMSGS_BMS_STATE_MACHINE_STATE_PRE_CHARGE_CHOICE,
+        App_CanTx_GetPeriodicSignal_STATE(can_tx_interface));
+
+    LetTimePass(state_machine, 1);
+    ASSERT_EQ(
+        CANMSGS_BMS_STATE_MACHINE_STATE_FAULT_CHOICE,
+        App_CanTx_GetPeriodicSignal_STATE(can_tx_interface));
+    ASSERT_EQ(
+        CANMSGS_BMS_PRE_CHARGE_PRE_CHARGE_STATUS_RISE_TOO_FAST_CHOICE,
+        App_CanTx_GetPeriodicSignal_PRE_CHARGE_STATUS(can_tx_interface));
+    ASSERT_EQ(0, close_air_positive_fake.call_count);
+    ASSERT_EQ(1, disable_pre_charge_fake.call_count);
+}
+
+// BMS-12
+TEST_F(
+    BmsStateMachineTest,
+    check_transition_from_pre_charge_state_to_fault_state_if_ts_rises_too_slowly)
+{
+    is_air_negative_closed_fake.return_val = true;
+    SetInitialState(App_GetPreChargeState());
+
+    // A TS voltage that never rises indicates an open pre-charge circuit. This
+    // should be caught well before the pre-charge timeout.
+    get_ts_voltage_fake.return_val = 0.0f;
+    LetTimePass(state_machine, (uint32_t)PRE_CHARGE_RC_TIME_CONSTANT_MS / 4);
+    ASSERT_EQ(
+        CANMSGS_BMS_STATE_MACHINE_STATE_FAULT_CHOICE,
+        App_CanTx_GetPeriodicSignal_STATE(can_tx_interface));
+    ASSERT_EQ(
+        CANMSGS_BMS_PRE_CHARGE_PRE_CHARGE_STATUS_RISE_TOO_SLOW_CHOICE,
+        App_CanTx_GetPeriodicSignal_PRE_CHARGE_STATUS(can_tx_interface));
+    ASSERT_EQ(0, close_air_positive_fake.call_count);
+}
+
 } // namespace StateMachineTest
@@ -8,6 +8,11 @@
 #include "App_Buzzer.h"
 #include "App_BuzzerSignals.h"
 #include "App_Imu.h"
+#include "App_TractionControl.h"
+#include "App_TorqueVectoring.h"
+#include "App_LaunchControl.h"
+#include "App_Inverter.h"
+#include "App_PowerLimiter.h"
 #include "App_SharedErrorTable.h"
 #include "App_SharedClock.h"
 #include "App_SharedWaitSignal.h"
@@ -31,6 +36,12 @@ struct DcmWorld *App_DcmWorld_Create(
     struct BrakeLight *       brake_light,
     struct Buzzer *           buzzer,
     struct Imu *              imu,
+    struct TractionControl *  traction_control,
+    struct TorqueVectoring *  torque_vectoring,
+    struct LaunchControl *    launch_control,
+    struct Inverter *         left_inverter,
+    struct Inverter *         right_inverter,
+    struct PowerLimiter *     power_limiter,
     struct ErrorTable *       error_table,
     struct Clock *            clock,
     bool (*is_buzzer_on)(struct DcmWorld *),
@@ -93,6 +104,51 @@ struct Buzzer *App_DcmWorld_GetBuzzer(const struct DcmWorld *world);
  */
 struct Imu *App_DcmWorld_GetImu(const struct DcmWorld *world);
 
+/**
+ * Get the traction control for the given world
+ * @param world The world to get traction control for
+ * @return The traction control for the given world
+ */
+struct TractionControl *
+    App_DcmWorld_GetTractionControl(const struct DcmWorld *world);
+
+/**
+ * Get the torque vectoring for the given world
+ * @param world The world to get torque vectoring for
+ * @return The torque vectoring for the given world
+ */
+struct TorqueVectoring *
+    App_DcmWorld_GetTorqueVectoring(const struct DcmWorld *world);
+
+/**
+ * Get the launch control for the given world
+ * @param world The world to get launch control for
+ * @return The launch control for the given world
+ */
+struct LaunchControl *
+    App_DcmWorld_GetLaunchControl(const struct DcmWorld *world);
+
+/**
+ * Get the inverter of the left motor for the given world
+ * @param world The world to get the inverter of the left motor for
+ * @return The inverter of the left motor for the given world
+ */
+struct Inverter *App_DcmWorld_GetLeftInverter(const struct DcmWorld *world);
+
+/**
+ * Get the inverter of the right motor for the given world
+ * @param world The world to get the inverter of the right motor for
+ * @return The inverter of the right motor for the given world
+ */
+struct Inverter *App_DcmWorld_GetRightInverter(const struct DcmWorld *world);
+
+/**
+ * Get the power limiter for the given world
+ * @param world The world to get power limiter for
+ * @return The power limiter for the given world
+ */
+struct PowerLimiter *App_DcmWorld_GetPowerLimiter(const struct DcmWorld *world);
+
 /**
  * Get the error table for the given world
  * @param world The world to get error table for
@@ -7,13 +7,29 @@
 struct Imu;
 
 /**
- * Allocate and initialize an Imu.
+ * Allocate and initialize an Imu. Its accelerations and angular velocities
+ * are fused into the attitude and body-frame accelerations of the vehicle,
+ * with the mounting orientation in configs/App_ImuConfig.h.
  * @param get_acceleration_x A function that can be called to get the
  * acceleration (m/s^2) on the x-axis.
  * @param get_acceleration_y A function that can be called to get the
  * acceleration (m/s^2) on the y-axis.
  * @param get_acceleration_z A function that can be called to get the
  * acceleration (m/s^2) on the z-axis.
+ * @param get_filtered_acceleration_x A function that can be called to get the
+ * low pass filtered acceleration (m/s^2) on the x-axis.
+ * @param get_filtered_acceleration_y A function that can be called to get the
+ * low pass filtered acceleration (m/s^2) on the y-axis.
+ * @param get_filtered_acceleration_z A function that can be called to get the
+ * low pass filtered acceleration (m/s^2) on the z-axis.
+ * @param get_angular_velocity_x A function that can be called to get the
+ * angular velocity (rad/s) around the x-axis.
+ * @param get_angular_velocity_y A function that can be called to get the
+ * angular velocity (rad/s) around the y-axis.
+ * @param get_angular_velocity_z A function that can be called to get the
+ * angular velocity (rad/s) around the z-axis.
+ * @param get_cycle_count A function that can be called to get the number of
+ * CPU cycles elapsed, which is used to benchmark the sensor fusion.
  * @param min_acceleration The minimum acceleration (m/s^2) measurable by the
  * Imu for any given axis
  * @param max_acceleration The maximum acceleration (m/s^2) measurable by the
@@ -24,6 +40,13 @@ struct Imu *App_Imu_Create(
     float (*get_acceleration_x)(void),
     float (*get_acceleration_y)(void),
     float (*get_acceleration_z)(void),
+    float (*get_filtered_acceleration_x)(void),
+    float (*get_filtered_acceleration_y)(void),
+    float (*get_filtered_acceleration_z)(void),
+    float (*get_angular_velocity_x)(void),
+    float (*get_angular_velocity_y)(void),
+    float (*get_angular_velocity_z)(void),
+    uint32_t (*get_cycle_count)(void),
     float min_acceleration,
     float max_acceleration);
 
@@ -54,6 +77,61 @@ float App_Imu_GetAccelerationY(const struct Imu *imu);
  */
 float App_Imu_GetAccelerationZ(const struct Imu *imu);
 
+/**
+ * Update the sensor fusion of the given Imu with its newest measurements
+ * @note This function should be called every IMU_SENSOR_FUSION_PERIOD_S
+ * @param imu The given Imu to update the sensor fusion of.
+ */
+void App_Imu_UpdateSensorFusion(struct Imu *imu);
+
+/**
+ * Get the most CPU cycles a sensor fusion update of the given Imu took since
+ * the last call to this function
+ * @param imu The given Imu to get the sensor fusion benchmark from.
+ * @return The most CPU cycles a sensor fusion update took
+ */
+uint32_t App_Imu_TakeMaxSensorFusionCycles(struct Imu *imu);
+
+/**
+ * Get the longitudinal acceleration of the vehicle from the given Imu
+ * @param imu The given Imu to get the longitudinal acceleration from.
+ * @return The low pass filtered acceleration (m/s^2) along the vehicle's
+ * x-axis without gravity, which is positive when the vehicle speeds up.
+ */
+float App_Imu_GetLongitudinalAcceleration(const struct Imu *imu);
+
+/**
+ * Get the lateral acceleration of the vehicle from the given Imu
+ * @param imu The given Imu to get the lateral acceleration from.
+ * @return The low pass filtered acceleration (m/s^2) along the vehicle's
+ * y-axis without gravity, which is positive when the vehicle turns left.
+ */
+float App_Imu_GetLateralAcceleration(const struct Imu *imu);
+
+/**
+ * Get the yaw rate of the vehicle from the given Imu
+ * @param imu The given Imu to get the yaw rate from.
+ * @return The bias-corrected angular velocity (rad/s) around the vertical,
+ * which is positive when the vehicle turns left.
+ */
+float App_Imu_GetYawRate(const struct Imu *imu);
+
+/**
+ * Get the pitch of the vehicle from the given Imu
+ * @param imu The given Imu to get the pitch from.
+ * @return The pitch (rad), which is positive when the nose of the vehicle
+ * points down.
+ */
+float App_Imu_GetPitch(const struct Imu *imu);
+
+/**
+ * Get the roll of the vehicle from the given Imu
+ * @param imu The given Imu to get the roll from.
+ * @return The roll (rad), which is positive when the left side of the
+ * vehicle is up.
+ */
+float App_Imu_GetRoll(const struct Imu *imu);
+
 /**
  * Get the acceleration-x in-range check from the given Imu
  * @param imu The given Imu to get the acceleration-x in-range check from
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <stdint.h>
+
+// Each sample in the FIFO is the angular velocity on the x, y and z-axes
+// followed by the acceleration on the x, y and z-axes, as little-endian
+// signed 16-bit words
+#define IMU_FIFO_WORDS_PER_SAMPLE 6U
+#define IMU_FIFO_BYTES_PER_SAMPLE (2U * IMU_FIFO_WORDS_PER_SAMPLE)
+
+enum ImuAxis
+{
+    IMU_AXIS_X,
+    IMU_AXIS_Y,
+    IMU_AXIS_Z,
+    NUM_IMU_AXES,
+};
+
+struct ImuFifo;
+
+/**
+ * Allocate and initialize a FIFO, which processes the bursts of samples read
+ * from the FIFO of an IMU whenever it fills up to its watermark. The samples
+ * in a burst are only timestamped by the watermark interrupt, so the time of
+ * every sample is reconstructed from the sample period, which is estimated
+ * from the time between watermark interrupts to track the drift of the IMU's
+ * oscillator. The accelerations are low pass filtered with the cutoff
+ * frequency in configs/App_ImuConfig.h.
+ * @param acceleration_sensitivity The acceleration of one LSB, in m/s^2
+ * @param angular_velocity_sensitivity The angular velocity of one LSB, in rad/s
+ * @param nominal_sample_period_us The sample period of the IMU's output data
+ *                                 rate, in us
+ * @param watermark The number of samples in the FIFO of the IMU when its
+ *                  watermark interrupt fires
+ * @return The created FIFO, whose ownership is given to the caller
+ */
+struct ImuFifo *App_ImuFifo_Create(
+    float    acceleration_sensitivity,
+    float    angular_velocity_sensitivity,
+    float    nominal_sample_period_us,
+    uint32_t watermark);
+
+/**
+ * Deallocate the memory used by the given FIFO
+ * @param imu_fifo The FIFO to deallocate
+ */
+void App_ImuFifo_Destroy(struct ImuFifo *imu_fifo);
+
+/**
+ * Process a burst of samples read from the FIFO of an IMU with the given FIFO,
+ * and publish the newest sample
+ * @note This is safe to call from TaskImu while another context gets the
+ *       output of one axis. Every burst must hold every sample that
+ *       was in the FIFO of the IMU, so that the number of samples between two
+ *       watermark interrupts is known.
+ * @param imu_fifo The FIFO to process the burst with
+ * @param raw_data The num_samples * IMU_FIFO_BYTES_PER_SAMPLE bytes read from
+ *                 the FIFO of the IMU, oldest sample first
+ * @param num_samples The number of samples in the burst
+ * @param watermark_time_us The time at which the watermark interrupt for this
+ *                          burst fired, in us
+ */
+void App_ImuFifo_ProcessBurst(
+    struct ImuFifo *imu_fifo,
+    const uint8_t * raw_data,
+    uint32_t        num_samples,
+    uint32_t        watermark_time_us);
+
+/**
+ * Get the acceleration of the newest sample from the given FIFO
+ * @param imu_fifo The FIFO to get the acceleration from
+ * @param axis The axis to get the acceleration on
+ * @return The acceleration on the given axis, in m/s^2
+ */
+float App_ImuFifo_GetAcceleration(
+    const struct ImuFifo *imu_fifo,
+    enum ImuAxis          axis);
+
+/**
+ * Get the low pass filtered acceleration from the given FIFO
+ * @param imu_fifo The FIFO to get the filtered acceleration from
+ * @param axis The axis to get the filtered acceleration on
+ * @return The filtered acceleration on the given axis, in m/s^2
+ */
+float App_ImuFifo_GetFilteredAcceleration(
+    const struct ImuFifo *imu_fifo,
+    enum ImuAxis          axis);
+
+/**
+ * Get the angular velocity of the newest sample from the given FIFO
+ * @param imu_fifo The FIFO to get the angular velocity from
+ * @param axis The axis to get the angular velocity around
+ * @return The angular velocity around the given axis, in rad/s
+ */
+float App_ImuFifo_GetAngularVelocity(
+    const struct ImuFifo *imu_fifo,
+    enum ImuAxis          axis);
+
+/**
+ * Get the reconstructed time of the newest sample from the given FIFO
+ * @param imu_fifo The FIFO to get the time of the newest sample from
+ * @return The time at which the newest sample was measured, in us
+ */
+uint32_t App_ImuFifo_GetTimestampUs(const struct ImuFifo *imu_fifo);
+
+/**
+ * Get the estimated sample period of the IMU from the given FIFO
+ * @param imu_fifo The FIFO to get the sample period from
+ * @return The estimated sample period, in us
+ */
+float App_ImuFifo_GetSamplePeriodUs(const struct ImuFifo *imu_fifo);
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "App_ImuFifo.h"
+
+struct ImuFusion;
+
+/**
+ * Allocate and initialize a sensor fusion, which estimates the attitude of the
+ * vehicle and its body-frame accelerations from the accelerations and angular
+ * velocities measured by an Imu. The vehicle's x-axis points forward, y-axis to
+ * the left and z-axis up, and the measurements are rotated into these axes with
+ * the mounting orientation of the Imu.
+ *
+ * The direction of gravity is integrated from the bias-corrected angular
+ * velocities, and pulled towards the measured acceleration with a complementary
+ * filter whenever the vehicle isn't accelerating. The gyroscope bias is
+ * estimated while the vehicle is held still. The parameters of both filters are
+ * in configs/App_ImuConfig.h.
+ * @param mounting_roll The roll of the Imu relative to the vehicle, in rad
+ * @param mounting_pitch The pitch of the Imu relative to the vehicle, in rad
+ * @param mounting_yaw The yaw of the Imu relative to the vehicle, in rad
+ * @return The created sensor fusion, whose ownership is given to the caller
+ */
+struct ImuFusion *App_ImuFusion_Create(
+    float mounting_roll,
+    float mounting_pitch,
+    float mounting_yaw);
+
+/**
+ * Deallocate the memory used by the given sensor fusion
+ * @param imu_fusion The sensor fusion to deallocate
+ */
+void App_ImuFusion_Destroy(struct ImuFusion *imu_fusion);
+
+/**
+ * Update the given sensor fusion with the newest measurements of the Imu
+ * @note This function should be called every IMU_SENSOR_FUSION_PERIOD_S. Its
+ *       run time is bounded, as it only loops over the axes and takes three
+ *       square roots.
+ * @param imu_fusion The sensor fusion to update
+ * @param acceleration The acceleration measured on each axis of the Imu, in
+ *                     m/s^2. This should be low pass filtered, as the
+ *                     measurements are only sampled every update.
+ * @param angular_velocity The angular velocity measured around each axis of
+ *                         the Imu, in rad/s
+ */
+void App_ImuFusion_Update(
+    struct ImuFusion *imu_fusion,
+    const float       acceleration[NUM_IMU_AXES],
+    const float       angular_velocity[NUM_IMU_AXES]);
+
+/**
+ * Get the longitudinal acceleration of the vehicle from the given sensor fusion
+ * @param imu_fusion The sensor fusion to get the acceleration from
+ * @return The acceleration (m/s^2) along the vehicle's x-axis, without
+ *         gravity, which is positive when the vehicle speeds up
+ */
+float App_ImuFusion_GetLongitudinalAcceleration(
+    const struct ImuFusion *imu_fusion);
+
+/**
+ * Get the lateral acceleration of the vehicle from the given sensor fusion
+ * @param imu_fusion The sensor fusion to get the acceleration from
+ * @return The acceleration (m/s^2) along the vehicle's y-axis, without
+ *         gravity, which is positive when the vehicle turns left
+ */
+float App_ImuFusion_GetLateralAcceleration(const struct ImuFusion *imu_fusion);
+
+/**
+ * Get the yaw rate of the vehicle from the given sensor fusion
+ * @param imu_fusion The sensor fusion to get the yaw rate from
+ * @return The bias-corrected angular velocity (rad/s) around the vertical,
+ *         which is positive when the vehicle turns left
+ */
+float App_ImuFusion_GetYawRate(const struct ImuFusion *imu_fusion);
+
+/**
+ * Get the pitch of the vehicle from the given sensor fusion
+ * @param imu_fusion The sensor fusion to get the pitch from
+ * @return The pitch (rad), which is positive when the nose of the vehicle
+ *         points down
+ */
+float App_ImuFusion_GetPitch(const struct ImuFusion *imu_fusion);
+
+/**
+ * Get the roll of the vehicle from the given sensor fusion
+ * @param imu_fusion The sensor fusion to get the roll from
+ * @return The roll (rad), which is positive when the left side of the vehicle
+ *         is up
+ */
+float App_ImuFusion_GetRoll(const struct ImuFusion *imu_fusion);
+
+/**
+ * Get the gyroscope bias estimated by the given sensor fusion
+ * @param imu_fusion The sensor fusion to get the gyroscope bias from
+ * @param axis The vehicle's axis to get the gyroscope bias around
+ * @return The angular velocity (rad/s) measured around the given axis while
+ *         the vehicle is held still
+ */
+float App_ImuFusion_GetGyroBias(
+    const struct ImuFusion *imu_fusion,
+    enum ImuAxis            axis);
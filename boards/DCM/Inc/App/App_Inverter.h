@@ -0,0 +1,128 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+enum InverterFeedback
+{
+    INVERTER_FEEDBACK_SPEED,
+    INVERTER_FEEDBACK_CURRENT,
+    INVERTER_FEEDBACK_MOTOR_TEMPERATURE,
+    INVERTER_FEEDBACK_POWER_STAGE_TEMPERATURE,
+    NUM_INVERTER_FEEDBACKS,
+};
+
+struct Inverter;
+
+/**
+ * Allocate and initialize a BAMOCAR inverter, which is commanded with a torque
+ * or speed setpoint and subscribes to the cyclic feedback in enum
+ * InverterFeedback
+ * @param command_std_id The CAN ID the inverter receives commands on
+ * @param feedback_std_id The CAN ID the inverter sends feedback on
+ * @param transmit A function that can be called to send a CAN frame with the
+ *                 given ID, payload and DLC to the inverter
+ * @return The created inverter, whose ownership is given to the caller
+ */
+struct Inverter *App_Inverter_Create(
+    uint32_t command_std_id,
+    uint32_t feedback_std_id,
+    void (*transmit)(uint32_t std_id, const uint8_t *data, uint32_t dlc));
+
+/**
+ * Deallocate the memory used by the given inverter
+ * @param inverter The inverter to deallocate
+ */
+void App_Inverter_Destroy(struct Inverter *inverter);
+
+/**
+ * Command the given inverter with a torque setpoint, which is sent from the
+ * next tick onwards
+ * @param inverter The inverter to command
+ * @param torque_nm The torque setpoint, in Nm. It is clamped to
+ *                  ±INVERTER_MAX_TORQUE_NM.
+ */
+void App_Inverter_SetTorqueSetpoint(struct Inverter *inverter, float torque_nm);
+
+/**
+ * Command the given inverter with a speed setpoint, which is sent from the
+ * next tick onwards
+ * @param inverter The inverter to command
+ * @param speed_rpm The speed setpoint, in rpm. It is clamped to
+ *                  ±INVERTER_MAX_SPEED_RPM.
+ */
+void App_Inverter_SetSpeedSetpoint(struct Inverter *inverter, float speed_rpm);
+
+/**
+ * Send the setpoint of the given inverter every INVERTER_SETPOINT_PERIOD_MS,
+ * and (re)subscribe to any of its feedback that is stale. This is expected to
+ * be called at 1kHz.
+ * @param inverter The inverter to tick
+ * @param current_time_ms The current time, in milliseconds
+ */
+void App_Inverter_Tick(struct Inverter *inverter, uint32_t current_time_ms);
+
+/**
+ * Update the feedback of the given inverter with a received CAN frame
+ * @param inverter The inverter to update
+ * @param std_id The CAN ID of the received frame
+ * @param data The payload of the received frame
+ * @param dlc The DLC of the received frame
+ * @param current_time_ms The current time, in milliseconds
+ * @return true if the frame is feedback from the given inverter, else false
+ */
+bool App_Inverter_ProcessFrame(
+    struct Inverter *inverter,
+    uint32_t         std_id,
+    const uint8_t *  data,
+    uint32_t         dlc,
+    uint32_t         current_time_ms);
+
+/**
+ * Check if the given feedback of the given inverter is stale
+ * @param inverter The inverter to check
+ * @param feedback The feedback to check
+ * @return true if the feedback wasn't received within
+ *         INVERTER_STALE_FEEDBACK_PERIODS of its interval as of the last tick,
+ *         else false
+ */
+bool App_Inverter_IsFeedbackStale(
+    const struct Inverter *inverter,
+    enum InverterFeedback  feedback);
+
+/**
+ * Get the motor speed of the given inverter
+ * @param inverter The inverter to get the motor speed for
+ * @return The last motor speed received, in rpm
+ */
+float App_Inverter_GetSpeedRpm(const struct Inverter *inverter);
+
+/**
+ * Get the speed of the wheel driven by the motor of the given inverter through
+ * the gear reduction in configs/App_TractionControlConfig.h
+ * @param inverter The inverter to get the wheel speed for
+ * @return The wheel speed derived from the last motor speed received, in km/h
+ */
+float App_Inverter_GetWheelSpeedKph(const struct Inverter *inverter);
+
+/**
+ * Get the motor current of the given inverter
+ * @param inverter The inverter to get the motor current for
+ * @return The last motor current received, in A
+ */
+float App_Inverter_GetCurrentA(const struct Inverter *inverter);
+
+/**
+ * Get the motor temperature of the given inverter
+ * @param inverter The inverter to get the motor temperature for
+ * @return The last motor temperature received, in degC
+ */
+float App_Inverter_GetMotorTemperatureDegC(const struct Inverter *inverter);
+
+/**
+ * Get the power stage temperature of the given inverter
+ * @param inverter The inverter to get the power stage temperature for
+ * @return The last power stage temperature received, in degC
+ */
+float App_Inverter_GetPowerStageTemperatureDegC(
+    const struct Inverter *inverter);
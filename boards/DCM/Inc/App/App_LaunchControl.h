@@ -0,0 +1,100 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+enum LaunchControlStatus
+{
+    LAUNCH_CONTROL_DISABLED,
+    LAUNCH_CONTROL_ARMED,
+    LAUNCH_CONTROL_LAUNCHING,
+    LAUNCH_CONTROL_COMPLETE,
+    LAUNCH_CONTROL_ABORTED,
+};
+
+struct LaunchControl;
+
+/**
+ * Allocate and initialize a launch control, which holds the vehicle once armed
+ * and limits the torque request to the torque profile in
+ * configs/App_LaunchControlConfig.h once launched
+ * @return The created launch control, whose ownership is given to the caller
+ */
+struct LaunchControl *App_LaunchControl_Create(void);
+
+/**
+ * Deallocate the memory used by the given launch control
+ * @param launch_control The launch control to deallocate
+ */
+void App_LaunchControl_Destroy(struct LaunchControl *launch_control);
+
+/**
+ * Count how long the driver has held the conditions to arm the given launch
+ * control. This is expected to be called at 1kHz while driving.
+ * @param launch_control The launch control to arm
+ * @param is_arming_condition_held Whether launch control is selected, and the
+ *                                 brake is held with the vehicle stationary
+ * @return true once the arming condition has been held for
+ *         LAUNCH_CONTROL_ARMING_DURATION_MS, else false
+ */
+bool App_LaunchControl_UpdateArming(
+    struct LaunchControl *launch_control,
+    bool                  is_arming_condition_held);
+
+/**
+ * Enable the given launch control, which is armed until the driver launches
+ * @param launch_control The launch control to enable
+ * @param current_time_ms The current time, in milliseconds
+ */
+void App_LaunchControl_Enable(
+    struct LaunchControl *launch_control,
+    uint32_t              current_time_ms);
+
+/**
+ * Disable the given launch control, which stops limiting the torque request
+ * and restarts the arming. This is done when the drive state is entered, so
+ * the status of the last launch is kept until then.
+ * @param launch_control The launch control to disable
+ */
+void App_LaunchControl_Disable(struct LaunchControl *launch_control);
+
+/**
+ * Update the status and torque limit of the given launch control. This is
+ * expected to be called at 1kHz while enabled.
+ * @note The launch starts once the brake is released with the pedal pressed,
+ *       and is aborted if the pedal is lifted, the brake is pressed again or
+ *       launch control is deselected
+ * @param launch_control The launch control to update
+ * @param is_launch_control_selected Whether launch control is selected
+ * @param is_brake_actuated Whether the brake is actuated
+ * @param pedal_percentage The mapped accelerator pedal percentage
+ * @param current_time_ms The current time, in milliseconds
+ * @return The status of the given launch control. Once the status is
+ *         LAUNCH_CONTROL_COMPLETE or LAUNCH_CONTROL_ABORTED, it stays the same
+ *         until the launch control is enabled again.
+ */
+enum LaunchControlStatus App_LaunchControl_Tick(
+    struct LaunchControl *launch_control,
+    bool                  is_launch_control_selected,
+    bool                  is_brake_actuated,
+    float                 pedal_percentage,
+    uint32_t              current_time_ms);
+
+/**
+ * Limit the given torque request with the given launch control
+ * @param launch_control The launch control to limit the torque request with
+ * @param torque_request The torque request of each motor, in Nm
+ * @return Zero while armed, the lesser of the torque request and the torque
+ *         profile while launching, else the unchanged torque request, in Nm
+ */
+float App_LaunchControl_LimitTorqueRequest(
+    const struct LaunchControl *launch_control,
+    float                       torque_request);
+
+/**
+ * Get the status of the given launch control
+ * @param launch_control The launch control to get the status for
+ * @return The status of the given launch control
+ */
+enum LaunchControlStatus
+    App_LaunchControl_GetStatus(const struct LaunchControl *launch_control);
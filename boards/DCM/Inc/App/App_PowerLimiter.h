@@ -0,0 +1,55 @@
+#pragma once
+
+#include "App_TorqueVectoring.h"
+
+struct PowerLimiter;
+
+/**
+ * Allocate and initialize a power limiter, which scales the motor torque
+ * requests down so that the tractive system power stays under the given limit
+ * @param max_power_kw The most electrical power the tractive system may
+ *                     deliver, in kW
+ * @return The created power limiter, whose ownership is given to the caller
+ */
+struct PowerLimiter *App_PowerLimiter_Create(float max_power_kw);
+
+/**
+ * Deallocate the memory used by the given power limiter
+ * @param power_limiter The power limiter to deallocate
+ */
+void App_PowerLimiter_Destroy(struct PowerLimiter *power_limiter);
+
+/**
+ * Limit the given motor torque requests so that the electrical power predicted
+ * POWER_LIMITER_PREDICTION_HORIZON_S ahead stays under the limit. The
+ * predicted power is fed forward from the driven wheel speed and the
+ * acceleration, and corrected with the measured tractive system power.
+ * @note This function should be called at 1kHz with every torque request. Its
+ *       run time is bounded, as it has no loops or library calls.
+ * @param power_limiter The power limiter to limit the torque requests with
+ * @param motor_torque_requests The torque requests of the left and right
+ *                              motors, in Nm
+ * @param driven_wheel_speed_kph The average speed of the driven wheels, in km/h
+ * @param acceleration The longitudinal acceleration of the vehicle, in m/s^2
+ * @param ts_voltage The tractive system voltage, in V
+ * @param ts_current The current out of the accumulator, in A
+ * @return The torque requests of the left and right motors. If the power is
+ *         limited, both are scaled by the same factor so that torque
+ *         vectoring's split is kept.
+ */
+struct MotorTorqueRequests App_PowerLimiter_LimitTorqueRequests(
+    struct PowerLimiter *      power_limiter,
+    struct MotorTorqueRequests motor_torque_requests,
+    float                      driven_wheel_speed_kph,
+    float                      acceleration,
+    float                      ts_voltage,
+    float                      ts_current);
+
+/**
+ * Get the most total torque of both motors that the given power limiter
+ * allowed when it last limited the torque requests
+ * @param power_limiter The power limiter to get the torque limit of
+ * @return The most total torque of both motors, in Nm
+ */
+float App_PowerLimiter_GetMaxTotalTorqueNm(
+    const struct PowerLimiter *power_limiter);
@@ -6,3 +6,11 @@ struct DcmWorld;
 void App_SetPeriodicCanSignals_TorqueRequests(const struct DcmWorld *world);
 
 void App_SetPeriodicCanSignals_Imu(const struct DcmWorld *world);
+
+void App_SetPeriodicCanSignals_ImuSensorFusionBenchmark(
+    const struct DcmWorld *world);
+
+void App_SetPeriodicCanSignals_TorqueVectoringBenchmark(
+    const struct DcmWorld *world);
+
+void App_SetPeriodicCanSignals_Inverters(const struct DcmWorld *world);
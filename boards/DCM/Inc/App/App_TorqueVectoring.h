@@ -0,0 +1,81 @@
+#pragma once
+
+#include <stdint.h>
+
+struct TorqueVectoring;
+
+struct MotorTorqueRequests
+{
+    // The torque request of the left motor, in Nm
+    float left;
+
+    // The torque request of the right motor, in Nm
+    float right;
+};
+
+/**
+ * Allocate and initialize a torque vectoring, which splits the torque request
+ * between the left and right motors so that the vehicle follows the yaw rate
+ * of a reference model with the parameters in
+ * configs/App_TorqueVectoringConfig.h
+ * @param get_cycle_count A function that can be called to get the number of
+ * CPU cycles since the cycle counter was started, used to benchmark the torque
+ * allocation
+ * @return The created torque vectoring, whose ownership is given to the caller
+ */
+struct TorqueVectoring *
+    App_TorqueVectoring_Create(uint32_t (*get_cycle_count)(void));
+
+/**
+ * Deallocate the memory used by the given torque vectoring
+ * @param torque_vectoring The torque vectoring to deallocate
+ */
+void App_TorqueVectoring_Destroy(struct TorqueVectoring *torque_vectoring);
+
+/**
+ * Update the reference yaw rate of the given torque vectoring, and split the
+ * given torque request between the left and right motors
+ * @note This function should be called every TORQUE_VECTORING_PERIOD_S. Its
+ *       run time is bounded, as it has no loops or library calls.
+ * @param torque_vectoring The torque vectoring to split the torque request with
+ * @param torque_request The torque request of each motor, in Nm. Regen torque
+ *                       requests are split evenly.
+ * @param steering_angle The steering wheel angle, in deg
+ * @param vehicle_speed_kph The vehicle speed, in km/h
+ * @param yaw_rate The yaw rate of the vehicle, in rad/s
+ * @return The torque requests of the left and right motors. If the torque
+ *         request is positive, each is between 0 and MAX_TORQUE_REQUEST_NM, and
+ *         they add up to twice the torque request unless one of them would
+ *         exceed MAX_TORQUE_REQUEST_NM.
+ */
+struct MotorTorqueRequests App_TorqueVectoring_AllocateTorqueRequest(
+    struct TorqueVectoring *torque_vectoring,
+    float                   torque_request,
+    float                   steering_angle,
+    float                   vehicle_speed_kph,
+    float                   yaw_rate);
+
+/**
+ * Reset the reference yaw rate of the given torque vectoring, e.g. when it is
+ * disabled
+ * @param torque_vectoring The torque vectoring to reset
+ */
+void App_TorqueVectoring_Reset(struct TorqueVectoring *torque_vectoring);
+
+/**
+ * Get the reference yaw rate of the given torque vectoring
+ * @param torque_vectoring The torque vectoring to get the reference yaw rate of
+ * @return The reference yaw rate, in rad/s
+ */
+float App_TorqueVectoring_GetReferenceYawRate(
+    const struct TorqueVectoring *torque_vectoring);
+
+/**
+ * Get the most CPU cycles a torque allocation of the given torque vectoring
+ * took since the last call to this function
+ * @param torque_vectoring The torque vectoring to get the torque allocation
+ * benchmark from
+ * @return The most CPU cycles a torque allocation took
+ */
+uint32_t App_TorqueVectoring_TakeMaxTorqueAllocationCycles(
+    struct TorqueVectoring *torque_vectoring);
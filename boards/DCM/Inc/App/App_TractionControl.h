@@ -0,0 +1,70 @@
+#pragma once
+
+#include <stdbool.h>
+
+struct TractionControl;
+
+/**
+ * Allocate and initialize a traction control, which limits the torque request
+ * of each motor so that the driven wheels don't spin past the target slip ratio
+ * in configs/App_TractionControlConfig.h
+ * @return The created traction control, whose ownership is given to the caller
+ */
+struct TractionControl *App_TractionControl_Create(void);
+
+/**
+ * Deallocate the memory used by the given traction control
+ * @param traction_control The traction control to deallocate
+ */
+void App_TractionControl_Destroy(struct TractionControl *traction_control);
+
+/**
+ * Update the vehicle speed estimate and slip ratio of the given traction
+ * control, and limit the given torque request if the driven wheels spin
+ * @note This function should be called every TRACTION_CONTROL_PERIOD_S
+ * @param traction_control The traction control to limit the torque request with
+ * @param torque_request The torque request of each motor, in Nm. Regen torque
+ *                       requests are never limited.
+ * @param front_wheel_speed_kph The average speed of the front wheels, in km/h
+ * @param driven_wheel_speed_kph The average speed of the driven wheels, in km/h
+ * @param acceleration The longitudinal acceleration of the vehicle, in m/s^2
+ * @return The torque request of each motor after traction control, in Nm
+ */
+float App_TractionControl_LimitTorqueRequest(
+    struct TractionControl *traction_control,
+    float                   torque_request,
+    float                   front_wheel_speed_kph,
+    float                   driven_wheel_speed_kph,
+    float                   acceleration);
+
+/**
+ * Reset the torque cut and vehicle speed estimate of the given traction
+ * control, e.g. when it is disabled
+ * @param traction_control The traction control to reset
+ */
+void App_TractionControl_Reset(struct TractionControl *traction_control);
+
+/**
+ * Get the vehicle speed estimated by the given traction control
+ * @param traction_control The traction control to get the vehicle speed from
+ * @return The estimated vehicle speed, in km/h
+ */
+float App_TractionControl_GetVehicleSpeedKph(
+    const struct TractionControl *traction_control);
+
+/**
+ * Get the slip ratio of the driven wheels as of the last torque request limited
+ * by the given traction control
+ * @param traction_control The traction control to get the slip ratio from
+ * @return The slip ratio of the driven wheels
+ */
+float App_TractionControl_GetSlipRatio(
+    const struct TractionControl *traction_control);
+
+/**
+ * Check if the given traction control is cutting torque
+ * @param traction_control The traction control to check
+ * @return true if the last torque request was limited, else false
+ */
+bool App_TractionControl_IsActive(
+    const struct TractionControl *traction_control);
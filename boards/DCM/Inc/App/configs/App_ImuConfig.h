@@ -0,0 +1,53 @@
+#pragma once
+
+// The cutoff frequency of the low pass filter on the accelerations, in Hz. It
+// passes the vehicle dynamics and rejects the vibration of the chassis.
+#define IMU_ACCELERATION_FILTER_CUTOFF_HZ 10.0f
+
+// The sample period measured between two watermark interrupts is only trusted
+// if it is within this fraction of the nominal sample period, which rejects
+// bursts after a missed interrupt or a FIFO overrun
+#define IMU_MAX_SAMPLE_PERIOD_ERROR 0.05f
+
+// The weight of each trusted measurement in the sample period estimate
+#define IMU_SAMPLE_PERIOD_SMOOTHING_FACTOR 0.1f
+
+// The orientation of the Imu relative to the vehicle, whose x-axis points
+// forward, y-axis to the left and z-axis up. Starting from the vehicle's axes,
+// the Imu is rolled about the vehicle's x-axis, then pitched about its y-axis,
+// then yawed about its z-axis.
+#define IMU_MOUNTING_ROLL_DEG 0.0f
+#define IMU_MOUNTING_PITCH_DEG 0.0f
+#define IMU_MOUNTING_YAW_DEG 0.0f
+
+// The period at which the sensor fusion is updated, in s
+#define IMU_SENSOR_FUSION_PERIOD_S 0.001f
+
+// The time constant with which the direction of gravity measured by the
+// accelerometer corrects the drift of the attitude integrated from the
+// gyroscope, in s
+#define IMU_ATTITUDE_TIME_CONSTANT_S 2.0f
+
+// The measured acceleration is only gravity if its magnitude is within this
+// much of gravity, in m/s^2
+#define IMU_MAX_GRAVITY_ERROR_MS2 0.5f
+
+// While the vehicle moves, the correction of the attitude fades out as the
+// estimated acceleration of the vehicle grows to this magnitude, in m/s^2.
+// Otherwise, the accelerometer doesn't point up.
+#define IMU_MAX_ATTITUDE_CORRECTION_ACCELERATION_MS2 0.5f
+
+// The vehicle is held still if the measured acceleration is gravity and the
+// bias-corrected angular velocity stays below this magnitude, in rad/s, for
+// IMU_MIN_STATIONARY_DURATION_S. The magnitude is above the largest gyroscope
+// bias, so that the bias can be estimated before any of it is corrected.
+#define IMU_MAX_STATIONARY_ANGULAR_VELOCITY 0.25f
+#define IMU_MIN_STATIONARY_DURATION_S 1.0f
+
+// The time constant with which the gyroscope bias estimate follows the
+// angular velocity measured while the vehicle is held still, in s
+#define IMU_GYRO_BIAS_TIME_CONSTANT_S 5.0f
+
+// The largest gyroscope bias estimate on any axis, in rad/s. This is above
+// the zero-rate level of the LSM6DS33.
+#define IMU_MAX_GYRO_BIAS 0.2f
@@ -0,0 +1,62 @@
+#pragma once
+
+// The CAN IDs the inverters receive commands on and send feedback on. The
+// left inverter keeps the BAMOCAR default IDs, and the right inverter is
+// offset by one.
+#define LEFT_INVERTER_COMMAND_STD_ID 0x201U
+#define LEFT_INVERTER_FEEDBACK_STD_ID 0x181U
+#define RIGHT_INVERTER_COMMAND_STD_ID 0x202U
+#define RIGHT_INVERTER_FEEDBACK_STD_ID 0x182U
+
+// How often the setpoint is sent, in ms. The inverter disables the power stage
+// if its CAN timeout elapses without a new setpoint, so this must be well
+// under the timeout configured on the inverter.
+#define INVERTER_SETPOINT_PERIOD_MS 5U
+
+// The torque, speed and current that 100% of the inverter's range (32767
+// digits) corresponds to. These must match the M max, N max and I max pk
+// parameters configured on the inverter.
+#define INVERTER_MAX_TORQUE_NM 21.0f
+#define INVERTER_MAX_SPEED_RPM 8000.0f
+#define INVERTER_PEAK_CURRENT_A 200.0f
+
+// The intervals the inverter is asked to send each feedback at, in ms
+#define INVERTER_SPEED_FEEDBACK_PERIOD_MS 10U
+#define INVERTER_CURRENT_FEEDBACK_PERIOD_MS 10U
+#define INVERTER_TEMPERATURE_FEEDBACK_PERIOD_MS 100U
+
+// A feedback is stale once this many of its intervals pass without it, which
+// tolerates the odd frame lost to arbitration
+#define INVERTER_STALE_FEEDBACK_PERIODS 3U
+
+// How often the cyclic transmit request is repeated while a feedback is
+// stale, in ms. The inverter forgets its subscriptions when it resets.
+#define INVERTER_RESUBSCRIBE_PERIOD_MS 100U
+
+// clang-format off
+
+// Calibration of the temperature digits the inverter reports, as
+// { digits, degC } points in increasing order of digits. Temperatures between
+// two points are interpolated linearly, and temperatures outside the table are
+// clamped to its ends.
+#define INVERTER_TEMPERATURE_TABLE_LENGTH 6U
+#define INVERTER_MOTOR_TEMPERATURE_TABLE \
+{                                        \
+    { 9000.0f,  -20.0f },                \
+    { 11500.0f,  20.0f },                \
+    { 13500.0f,  60.0f },                \
+    { 15300.0f, 100.0f },                \
+    { 17000.0f, 140.0f },                \
+    { 18500.0f, 180.0f },                \
+}
+#define INVERTER_POWER_STAGE_TEMPERATURE_TABLE \
+{                                              \
+    { 16308.0f, -20.0f },                      \
+    { 17200.0f,  10.0f },                      \
+    { 18000.0f,  35.0f },                      \
+    { 18900.0f,  60.0f },                      \
+    { 19900.0f,  85.0f },                      \
+    { 21000.0f, 110.0f },                      \
+}
+
+// clang-format on
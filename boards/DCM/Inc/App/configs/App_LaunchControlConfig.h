@@ -0,0 +1,39 @@
+#pragma once
+
+// The DIM drive mode in which launch control can be armed. Launch control also
+// needs the traction control switch on, as traction control takes over from the
+// torque profile.
+#define LAUNCH_CONTROL_DRIVE_MODE \
+    CANMSGS_DIM_DRIVE_MODE_SWITCH_DRIVE_MODE_DRIVE_MODE_5_CHOICE
+
+// How long the brake must be held with the vehicle stationary to arm launch
+// control, in ms
+#define LAUNCH_CONTROL_ARMING_DURATION_MS 500U
+
+// Both front wheels must be slower than this for the vehicle to be stationary,
+// in km/h
+#define LAUNCH_CONTROL_MAX_STATIONARY_SPEED_KPH 1.0f
+
+// The mapped pedal percentage that launches the vehicle once the brake is
+// released, and below which the launch is aborted
+#define LAUNCH_CONTROL_MIN_PEDAL_PERCENTAGE 95.0f
+
+// How long after the brake is released the pedal may take to reach
+// LAUNCH_CONTROL_MIN_PEDAL_PERCENTAGE before the launch is aborted, in ms
+#define LAUNCH_CONTROL_MAX_PEDAL_DELAY_MS 500U
+
+// clang-format off
+
+// The torque limit during the launch, in % of MAX_TORQUE_REQUEST_NM, for every
+// LAUNCH_CONTROL_TORQUE_PROFILE_STEP_MS since the launch. The slip ratio isn't
+// meaningful until the vehicle rolls, so the torque is ramped up before the
+// profile hands over to traction control.
+#define LAUNCH_CONTROL_TORQUE_PROFILE_STEP_MS 25U
+#define LAUNCH_CONTROL_TORQUE_PROFILE_LENGTH 20U
+#define LAUNCH_CONTROL_TORQUE_PROFILE                       \
+{                                                           \
+    50, 55, 60, 64, 68, 72, 75, 78, 81, 84,                 \
+    87, 89, 91, 93, 95, 96, 97, 98, 99, 100,                \
+}
+
+// clang-format on
@@ -0,0 +1,25 @@
+#pragma once
+
+// The most electrical power the tractive system may deliver, in kW (FSAE EV2.2)
+#define POWER_LIMITER_MAX_POWER_KW 80.0f
+
+// The power limiter aims this far below the maximum power, in kW, so that
+// torque transients and measurement noise don't breach it
+#define POWER_LIMITER_MARGIN_KW 2.0f
+
+// How far ahead the motor speed is predicted, in s. This covers the delay of
+// the tractive system measurements from the BMS and of the inverters' torque
+// response, so the torque is cut before the power would exceed the limit.
+#define POWER_LIMITER_PREDICTION_HORIZON_S 0.02f
+
+// The efficiency of the motors and inverters, from mechanical to electrical
+// power
+#define POWER_LIMITER_DRIVETRAIN_EFFICIENCY 0.9f
+
+// The weight of the measured power on every tick in the estimate of the power
+// that the drivetrain efficiency doesn't account for
+#define POWER_LIMITER_CORRECTION_GAIN 0.01f
+
+// The motor speed is taken to be at least this when limiting the torque, in
+// rad/s, as the power at standstill is too small to limit
+#define POWER_LIMITER_MIN_MOTOR_SPEED_RAD_PER_S 50.0f
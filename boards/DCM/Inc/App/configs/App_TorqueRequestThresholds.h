@@ -1,4 +1,4 @@
 #pragma once
 
 // 21Nm is max torque each motor can handle
-#define MAX_TORQUE_REQUEST_NM 21.0f;
+#define MAX_TORQUE_REQUEST_NM 21.0f
@@ -0,0 +1,34 @@
+#pragma once
+
+// The period at which the torque vectoring is ticked, in s
+#define TORQUE_VECTORING_PERIOD_S 0.001f
+
+// Vehicle geometry of the yaw rate reference model. A positive steering angle
+// turns the vehicle left, which is a positive yaw rate.
+#define TORQUE_VECTORING_STEERING_RATIO 5.0f
+#define TORQUE_VECTORING_WHEELBASE_M 1.53f
+#define TORQUE_VECTORING_TRACK_WIDTH_M 1.2f
+
+// The understeer gradient of the reference model, in s^2/m. The reference yaw
+// rate of a steady-state turn is v * delta / (L + K * v^2).
+#define TORQUE_VECTORING_UNDERSTEER_GRADIENT_S2_PER_M 0.002f
+
+// The reference yaw rate is limited to what the tyres can sustain at this
+// lateral acceleration, in m/s^2
+#define TORQUE_VECTORING_MAX_LATERAL_ACCELERATION_MPS2 15.0f
+
+// The time constant of the lag of the reference yaw rate behind the steering,
+// in s
+#define TORQUE_VECTORING_REFERENCE_TIME_CONSTANT_S 0.05f
+
+// Gains of the right minus left motor torque, in Nm per rad/s of reference yaw
+// rate and Nm per rad/s of yaw rate error
+#define TORQUE_VECTORING_FEED_FORWARD_GAIN_NM_S 4.0f
+#define TORQUE_VECTORING_PROPORTIONAL_GAIN_NM_S 8.0f
+
+// The largest difference between the right and left motor torques, in Nm
+#define TORQUE_VECTORING_MAX_TORQUE_DIFFERENCE_NM 10.0f
+
+// The torque isn't vectored below this speed, where the yaw rate is too small
+// to control
+#define TORQUE_VECTORING_MIN_VEHICLE_SPEED_KPH 10.0f
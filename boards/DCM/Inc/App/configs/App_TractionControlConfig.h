@@ -0,0 +1,29 @@
+#pragma once
+
+// The period at which the traction control is ticked, in s
+#define TRACTION_CONTROL_PERIOD_S 0.001f
+
+// The slip ratio of the driven wheels that the traction control holds them at
+// when they spin, close to the peak of the longitudinal force of the tyres
+#define TRACTION_CONTROL_TARGET_SLIP_RATIO 0.1f
+
+// Slip ratios are relative to at least this speed, so that they stay bounded
+// when launching from standstill
+#define TRACTION_CONTROL_MIN_VEHICLE_SPEED_KPH 5.0f
+
+// The weight of the front wheel speed in the vehicle speed estimate on every
+// tick, which otherwise integrates the IMU acceleration. The front wheels
+// aren't driven, so they roll at the vehicle speed.
+#define TRACTION_CONTROL_WHEEL_SPEED_FUSION_GAIN 0.02f
+
+// Gains of the torque cut, in Nm per unit of slip ratio over the target and Nm
+// per unit of slip ratio over the target per s
+#define TRACTION_CONTROL_PROPORTIONAL_GAIN_NM 30.0f
+#define TRACTION_CONTROL_INTEGRAL_GAIN_NM_PER_S 300.0f
+
+// Vehicle parameters of the feed-forward, which is the motor torque that
+// accelerates the vehicle at its measured acceleration
+#define TRACTION_CONTROL_VEHICLE_MASS_KG 300.0f
+#define TRACTION_CONTROL_WHEEL_RADIUS_M 0.2286f
+#define TRACTION_CONTROL_GEAR_RATIO 4.5f
+#define TRACTION_CONTROL_NUM_MOTORS 2.0f
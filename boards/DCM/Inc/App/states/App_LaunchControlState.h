@@ -0,0 +1,18 @@
+#pragma once
+
+#include "App_SharedStateMachine.h"
+#include "App_DcmWorld.h"
+
+/**
+ * Get a pointer to the Launch Control state.
+ * @return A pointer to the Launch Control state. THIS SHOULD NOT BE MODIFIED
+ */
+const struct State *App_GetLaunchControlState(void);
+
+/**
+ * Check if the driver has selected launch control on the DIM
+ * @param world The world to check the DIM switches in
+ * @return true if the launch control drive mode is selected with traction
+ *         control switched on, else false
+ */
+bool App_LaunchControlState_IsSelected(const struct DcmWorld *world);
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * Send a CAN frame to an inverter
+ * @param std_id The CAN ID to send the frame with
+ * @param data The payload of the frame
+ * @param dlc The number of bytes in the payload, up to 8
+ */
+void Io_Inverter_Transmit(uint32_t std_id, const uint8_t *data, uint32_t dlc);
@@ -5,6 +5,13 @@
  *
  * The Application Note for this Imu can be found here:
  * https://www.pololu.com/file/0J1088/LSM6DS33-AN4682.pdf
+ *
+ * The accelerometer and gyroscope are sampled at the same output data rate
+ * into the on-chip FIFO. Whenever the FIFO fills up to its watermark, INT1
+ * interrupts the MCU and wakes up the task reading the FIFO, which burst reads
+ * the batch of samples over I2C with DMA. The CPU only handles a few
+ * interrupts per batch rather than a blocking register read per sample, and no
+ * I2C transfer is ever started from an interrupt.
  */
 
 #include <stdint.h>
@@ -12,6 +19,17 @@
 #include <stdbool.h>
 #include "App_SharedExitCode.h"
 
+/**
+ * Initialize the Imu, and start sampling it into its FIFO
+ * @note The shared cycle counter must be started before this is called
+ * @param hi2c The handle of the I2C peripheral the Imu is connected to. Its
+ *             RX DMA channel and event interrupt must be enabled.
+ * @return EXIT_CODE_OK if the Imu was configured
+ *         EXIT_CODE_ERROR if the Imu didn't respond with its identity
+ *         EXIT_CODE_TIMEOUT if the Imu couldn't be configured over I2C
+ */
+ExitCode Io_LSM6DS33_Init(I2C_HandleTypeDef *hi2c);
+
 /**
  * Get x acceleration from Imu
  * @return The acceleration (m/s^2) measured on the x-axis.
@@ -29,3 +47,49 @@ float Io_LSM6DS33_GetAccelerationY(void);
  * @return The acceleration (m/s^2) measured on the z-axis.
  */
 float Io_LSM6DS33_GetAccelerationZ(void);
+
+/**
+ * Get low pass filtered x acceleration from Imu
+ * @return The filtered acceleration (m/s^2) measured on the x-axis.
+ */
+float Io_LSM6DS33_GetFilteredAccelerationX(void);
+
+/**
+ * Get low pass filtered y acceleration from Imu
+ * @return The filtered acceleration (m/s^2) measured on the y-axis.
+ */
+float Io_LSM6DS33_GetFilteredAccelerationY(void);
+
+/**
+ * Get low pass filtered z acceleration from Imu
+ * @return The filtered acceleration (m/s^2) measured on the z-axis.
+ */
+float Io_LSM6DS33_GetFilteredAccelerationZ(void);
+
+/**
+ * Get x angular velocity from Imu
+ * @return The angular velocity (rad/s) measured around the x-axis.
+ */
+float Io_LSM6DS33_GetAngularVelocityX(void);
+
+/**
+ * Get y angular velocity from Imu
+ * @return The angular velocity (rad/s) measured around the y-axis.
+ */
+float Io_LSM6DS33_GetAngularVelocityY(void);
+
+/**
+ * Get z angular velocity from Imu
+ * @return The angular velocity (rad/s) measured around the z-axis.
+ */
+float Io_LSM6DS33_GetAngularVelocityZ(void);
+
+/**
+ * Wait for the FIFO of the Imu to reach its watermark, and burst read the
+ * samples in it. If the watermark interrupt doesn't fire for a while, the FIFO
+ * is read anyway if it is at its watermark, which restarts reading it after an
+ * I2C error or after a burst left a full watermark of samples behind.
+ * @note This must be called in a loop from a single task, at a priority above
+ *       the tasks that get the accelerations and angular velocities
+ */
+void Io_LSM6DS33_ReadFifoFromTask(void);
@@ -72,6 +72,7 @@ extern "C"
 #define TASK1KHZ_STACK_SIZE 512
 #define TASKCANRX_STACK_SIZE 512
 #define TASKCANTX_STACK_SIZE 512
+#define TASKIMU_STACK_SIZE 512
 #define UNUSED_ANALOG_IN1_Pin GPIO_PIN_0
 #define UNUSED_ANALOG_IN1_GPIO_Port GPIOA
 #define UNUSED_ANALOG_IN2_Pin GPIO_PIN_1
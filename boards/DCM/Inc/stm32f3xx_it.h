@@ -59,10 +59,14 @@ extern "C"
     void BusFault_Handler(void);
     void UsageFault_Handler(void);
     void DebugMon_Handler(void);
+    void EXTI4_IRQHandler(void);
+    void DMA1_Channel7_IRQHandler(void);
     void USB_HP_CAN_TX_IRQHandler(void);
     void USB_LP_CAN_RX0_IRQHandler(void);
     void CAN_RX1_IRQHandler(void);
     void TIM2_IRQHandler(void);
+    void I2C1_EV_IRQHandler(void);
+    void I2C1_ER_IRQHandler(void);
     /* USER CODE BEGIN EFP */
 
     /* USER CODE END EFP */
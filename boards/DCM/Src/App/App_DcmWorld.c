@@ -14,6 +14,12 @@ struct DcmWorld
     struct BrakeLight *       brake_light;
     struct Buzzer *           buzzer;
     struct Imu *              imu;
+    struct TractionControl *  traction_control;
+    struct TorqueVectoring *  torque_vectoring;
+    struct LaunchControl *    launch_control;
+    struct Inverter *         left_inverter;
+    struct Inverter *         right_inverter;
+    struct PowerLimiter *     power_limiter;
     struct ErrorTable *       error_table;
     struct WaitSignal *       buzzer_wait_signal;
     struct Clock *            clock;
@@ -27,6 +33,12 @@ struct DcmWorld *App_DcmWorld_Create(
     struct BrakeLight *const        brake_light,
     struct Buzzer *const            buzzer,
     struct Imu *const               imu,
+    struct TractionControl *const   traction_control,
+    struct TorqueVectoring *const   torque_vectoring,
+    struct LaunchControl *const     launch_control,
+    struct Inverter *const          left_inverter,
+    struct Inverter *const          right_inverter,
+    struct PowerLimiter *const      power_limiter,
     struct ErrorTable *const        error_table,
     struct Clock *const             clock,
     bool (*is_buzzer_on)(struct DcmWorld *),
@@ -42,6 +54,12 @@ struct DcmWorld *App_DcmWorld_Create(
     world->brake_light       = brake_light;
     world->buzzer            = buzzer;
     world->imu               = imu;
+    world->traction_control  = traction_control;
+    world->torque_vectoring  = torque_vectoring;
+    world->launch_control    = launch_control;
+    world->left_inverter     = left_inverter;
+    world->right_inverter    = right_inverter;
+    world->power_limiter     = power_limiter;
     world->error_table       = error_table;
     world->clock             = clock;
 
@@ -101,6 +119,42 @@ struct Imu *App_DcmWorld_GetImu(const struct DcmWorld *const world)
     return world->imu;
 }
 
+struct TractionControl *
+    App_DcmWorld_GetTractionControl(const struct DcmWorld *const world)
+{
+    return world->traction_control;
+}
+
+struct TorqueVectoring *
+    App_DcmWorld_GetTorqueVectoring(const struct DcmWorld *const world)
+{
+    return world->torque_vectoring;
+}
+
+struct LaunchControl *
+    App_DcmWorld_GetLaunchControl(const struct DcmWorld *const world)
+{
+    return world->launch_control;
+}
+
+struct Inverter *
+    App_DcmWorld_GetLeftInverter(const struct DcmWorld *const world)
+{
+    return world->left_inverter;
+}
+
+struct Inverter *
+    App_DcmWorld_GetRightInverter(const struct DcmWorld *const world)
+{
+    return world->right_inverter;
+}
+
+struct PowerLimiter *
+    App_DcmWorld_GetPowerLimiter(const struct DcmWorld *const world)
+{
+    return world->power_limiter;
+}
+
 struct ErrorTable *
     App_DcmWorld_GetErrorTable(const struct DcmWorld *const world)
 {
@@ -3,6 +3,10 @@
 
 #include "App_InRangeCheck.h"
 #include "App_Imu.h"
+#include "App_ImuFusion.h"
+#include "configs/App_ImuConfig.h"
+
+#define RAD_PER_DEG (3.14159265f / 180.0f)
 
 struct Imu
 {
@@ -13,6 +17,16 @@ struct Imu
     float (*get_acceleration_x)(void);
     float (*get_acceleration_y)(void);
     float (*get_acceleration_z)(void);
+    float (*get_filtered_acceleration_x)(void);
+    float (*get_filtered_acceleration_y)(void);
+    float (*get_filtered_acceleration_z)(void);
+    float (*get_angular_velocity_x)(void);
+    float (*get_angular_velocity_y)(void);
+    float (*get_angular_velocity_z)(void);
+    uint32_t (*get_cycle_count)(void);
+
+    struct ImuFusion *imu_fusion;
+    uint32_t          max_sensor_fusion_cycles;
 };
 
 float App_Imu_GetAccelerationX(const struct Imu *const imu)
@@ -30,6 +44,62 @@ float App_Imu_GetAccelerationZ(const struct Imu *const imu)
     return imu->get_acceleration_z();
 }
 
+void App_Imu_UpdateSensorFusion(struct Imu *const imu)
+{
+    const float acceleration[NUM_IMU_AXES] = {
+        imu->get_filtered_acceleration_x(),
+        imu->get_filtered_acceleration_y(),
+        imu->get_filtered_acceleration_z(),
+    };
+    const float angular_velocity[NUM_IMU_AXES] = {
+        imu->get_angular_velocity_x(),
+        imu->get_angular_velocity_y(),
+        imu->get_angular_velocity_z(),
+    };
+
+    const uint32_t start_cycles = imu->get_cycle_count();
+    App_ImuFusion_Update(imu->imu_fusion, acceleration, angular_velocity);
+    const uint32_t elapsed_cycles = imu->get_cycle_count() - start_cycles;
+
+    if (elapsed_cycles > imu->max_sensor_fusion_cycles)
+    {
+        imu->max_sensor_fusion_cycles = elapsed_cycles;
+    }
+}
+
+uint32_t App_Imu_TakeMaxSensorFusionCycles(struct Imu *const imu)
+{
+    const uint32_t max_sensor_fusion_cycles = imu->max_sensor_fusion_cycles;
+    imu->max_sensor_fusion_cycles           = 0U;
+
+    return max_sensor_fusion_cycles;
+}
+
+float App_Imu_GetLongitudinalAcceleration(const struct Imu *const imu)
+{
+    return App_ImuFusion_GetLongitudinalAcceleration(imu->imu_fusion);
+}
+
+float App_Imu_GetLateralAcceleration(const struct Imu *const imu)
+{
+    return App_ImuFusion_GetLateralAcceleration(imu->imu_fusion);
+}
+
+float App_Imu_GetYawRate(const struct Imu *const imu)
+{
+    return App_ImuFusion_GetYawRate(imu->imu_fusion);
+}
+
+float App_Imu_GetPitch(const struct Imu *const imu)
+{
+    return App_ImuFusion_GetPitch(imu->imu_fusion);
+}
+
+float App_Imu_GetRoll(const struct Imu *const imu)
+{
+    return App_ImuFusion_GetRoll(imu->imu_fusion);
+}
+
 struct InRangeCheck *
     App_Imu_GetAccelerationXInRangeCheck(const struct Imu *const imu)
 {
@@ -52,6 +122,13 @@ struct Imu *App_Imu_Create(
     float (*get_acceleration_x)(void),
     float (*get_acceleration_y)(void),
     float (*get_acceleration_z)(void),
+    float (*get_filtered_acceleration_x)(void),
+    float (*get_filtered_acceleration_y)(void),
+    float (*get_filtered_acceleration_z)(void),
+    float (*get_angular_velocity_x)(void),
+    float (*get_angular_velocity_y)(void),
+    float (*get_angular_velocity_z)(void),
+    uint32_t (*get_cycle_count)(void),
     float min_acceleration,
     float max_acceleration)
 {
@@ -69,6 +146,20 @@ struct Imu *App_Imu_Create(
     imu->get_acceleration_y = get_acceleration_y;
     imu->get_acceleration_z = get_acceleration_z;
 
+    imu->get_filtered_acceleration_x = get_filtered_acceleration_x;
+    imu->get_filtered_acceleration_y = get_filtered_acceleration_y;
+    imu->get_filtered_acceleration_z = get_filtered_acceleration_z;
+    imu->get_angular_velocity_x      = get_angular_velocity_x;
+    imu->get_angular_velocity_y      = get_angular_velocity_y;
+    imu->get_angular_velocity_z      = get_angular_velocity_z;
+    imu->get_cycle_count             = get_cycle_count;
+
+    imu->imu_fusion = App_ImuFusion_Create(
+        RAD_PER_DEG * IMU_MOUNTING_ROLL_DEG,
+        RAD_PER_DEG * IMU_MOUNTING_PITCH_DEG,
+        RAD_PER_DEG * IMU_MOUNTING_YAW_DEG);
+    imu->max_sensor_fusion_cycles = 0U;
+
     return imu;
 }
 
@@ -77,5 +168,6 @@ void App_Imu_Destroy(struct Imu *imu)
     free(imu->acceleration_x_in_range_check);
     free(imu->acceleration_y_in_range_check);
     free(imu->acceleration_z_in_range_check);
+    App_ImuFusion_Destroy(imu->imu_fusion);
     free(imu);
 }
@@ -0,0 +1,223 @@
+#include <assert.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "App_ImuFifo.h"
+#include "configs/App_ImuConfig.h"
+
+#define US_PER_S 1000000.0f
+#define PI 3.14159265f
+
+struct ImuFifo
+{
+    float    acceleration_sensitivity;
+    float    angular_velocity_sensitivity;
+    float    nominal_sample_period_us;
+    uint32_t watermark;
+
+    // The RC time constant of the acceleration filter, in us
+    float acceleration_filter_time_constant_us;
+
+    float    sample_period_us;
+    bool     has_previous_burst;
+    uint32_t previous_watermark_time_us;
+    uint32_t previous_num_samples;
+
+    // Written by TaskImu once each FIFO burst is read. Every output is 32 bits
+    // wide, so a reader never sees a partially written output.
+    volatile float    acceleration[NUM_IMU_AXES];
+    volatile float    filtered_acceleration[NUM_IMU_AXES];
+    volatile float    angular_velocity[NUM_IMU_AXES];
+    volatile uint32_t timestamp_us;
+    bool              has_sample;
+};
+
+/**
+ * Get a little-endian signed 16-bit word from the given bytes
+ * @param bytes The two bytes of the word, least significant byte first
+ * @return The word
+ */
+static int16_t App_GetWord(const uint8_t *bytes);
+
+/**
+ * Update the sample period estimate of the given FIFO with the time between
+ * the watermark interrupts of the previous burst and this burst
+ * @param imu_fifo The FIFO to update the sample period estimate of
+ * @param watermark_time_us The time at which the watermark interrupt for this
+ *                          burst fired, in us
+ */
+static void App_UpdateSamplePeriod(
+    struct ImuFifo *imu_fifo,
+    uint32_t        watermark_time_us);
+
+static int16_t App_GetWord(const uint8_t *const bytes)
+{
+    return (int16_t)((uint16_t)bytes[0] | (uint16_t)((uint16_t)bytes[1] << 8U));
+}
+
+static void App_UpdateSamplePeriod(
+    struct ImuFifo *const imu_fifo,
+    const uint32_t        watermark_time_us)
+{
+    if (!imu_fifo->has_previous_burst)
+    {
+        return;
+    }
+
+    // The previous watermark interrupt fired on the watermark-th sample of the
+    // previous burst, and this one on the watermark-th sample of this burst.
+    // Every sample of the previous burst was read, so there were as many
+    // samples in between as in the previous burst.
+    const float measured_sample_period_us =
+        (float)(watermark_time_us - imu_fifo->previous_watermark_time_us) /
+        (float)imu_fifo->previous_num_samples;
+    const float max_error_us =
+        IMU_MAX_SAMPLE_PERIOD_ERROR * imu_fifo->nominal_sample_period_us;
+
+    if (measured_sample_period_us >
+            imu_fifo->nominal_sample_period_us - max_error_us &&
+        measured_sample_period_us <
+            imu_fifo->nominal_sample_period_us + max_error_us)
+    {
+        imu_fifo->sample_period_us +=
+            IMU_SAMPLE_PERIOD_SMOOTHING_FACTOR *
+            (measured_sample_period_us - imu_fifo->sample_period_us);
+    }
+}
+
+struct ImuFifo *App_ImuFifo_Create(
+    const float    acceleration_sensitivity,
+    const float    angular_velocity_sensitivity,
+    const float    nominal_sample_period_us,
+    const uint32_t watermark)
+{
+    assert(nominal_sample_period_us > 0.0f);
+    assert(watermark > 0U);
+
+    struct ImuFifo *imu_fifo = malloc(sizeof(struct ImuFifo));
+    assert(imu_fifo != NULL);
+
+    imu_fifo->acceleration_sensitivity     = acceleration_sensitivity;
+    imu_fifo->angular_velocity_sensitivity = angular_velocity_sensitivity;
+    imu_fifo->nominal_sample_period_us     = nominal_sample_period_us;
+    imu_fifo->watermark                    = watermark;
+    imu_fifo->acceleration_filter_time_constant_us =
+        US_PER_S / (2.0f * PI * IMU_ACCELERATION_FILTER_CUTOFF_HZ);
+
+    imu_fifo->sample_period_us           = nominal_sample_period_us;
+    imu_fifo->has_previous_burst         = false;
+    imu_fifo->previous_watermark_time_us = 0U;
+    imu_fifo->previous_num_samples       = 0U;
+
+    for (uint32_t axis = 0U; axis < NUM_IMU_AXES; axis++)
+    {
+        imu_fifo->acceleration[axis]          = 0.0f;
+        imu_fifo->filtered_acceleration[axis] = 0.0f;
+        imu_fifo->angular_velocity[axis]      = 0.0f;
+    }
+    imu_fifo->timestamp_us = 0U;
+    imu_fifo->has_sample   = false;
+
+    return imu_fifo;
+}
+
+void App_ImuFifo_Destroy(struct ImuFifo *const imu_fifo)
+{
+    free(imu_fifo);
+}
+
+void App_ImuFifo_ProcessBurst(
+    struct ImuFifo *const imu_fifo,
+    const uint8_t *const  raw_data,
+    const uint32_t        num_samples,
+    const uint32_t        watermark_time_us)
+{
+    if (num_samples == 0U)
+    {
+        return;
+    }
+
+    App_UpdateSamplePeriod(imu_fifo, watermark_time_us);
+    imu_fifo->has_previous_burst         = true;
+    imu_fifo->previous_watermark_time_us = watermark_time_us;
+    imu_fifo->previous_num_samples       = num_samples;
+
+    for (uint32_t i = 0U; i < num_samples; i++)
+    {
+        const uint8_t *const sample = &raw_data[i * IMU_FIFO_BYTES_PER_SAMPLE];
+
+        // Samples after the watermark-th sample arrived while the watermark
+        // interrupt was being handled
+        const float samples_after_watermark =
+            (float)i - (float)(imu_fifo->watermark - 1U);
+        const uint32_t timestamp_us =
+            watermark_time_us +
+            (uint32_t)(int32_t)(
+                samples_after_watermark * imu_fifo->sample_period_us);
+
+        // The time between samples of different bursts depends on the jitter
+        // of the watermark interrupts, so it is taken from the timestamps
+        float smoothing_factor = 1.0f;
+
+        if (imu_fifo->has_sample)
+        {
+            const int32_t elapsed_us =
+                (int32_t)(timestamp_us - imu_fifo->timestamp_us);
+            const float dt_us = elapsed_us > 0 ? (float)elapsed_us : 0.0f;
+
+            smoothing_factor =
+                dt_us /
+                (imu_fifo->acceleration_filter_time_constant_us + dt_us);
+        }
+
+        for (uint32_t axis = 0U; axis < NUM_IMU_AXES; axis++)
+        {
+            const float angular_velocity =
+                (float)App_GetWord(&sample[2U * axis]) *
+                imu_fifo->angular_velocity_sensitivity;
+            const float acceleration =
+                (float)App_GetWord(&sample[2U * (NUM_IMU_AXES + axis)]) *
+                imu_fifo->acceleration_sensitivity;
+
+            imu_fifo->angular_velocity[axis] = angular_velocity;
+            imu_fifo->acceleration[axis]     = acceleration;
+            imu_fifo->filtered_acceleration[axis] +=
+                smoothing_factor *
+                (acceleration - imu_fifo->filtered_acceleration[axis]);
+        }
+
+        imu_fifo->timestamp_us = timestamp_us;
+        imu_fifo->has_sample   = true;
+    }
+}
+
+float App_ImuFifo_GetAcceleration(
+    const struct ImuFifo *const imu_fifo,
+    const enum ImuAxis          axis)
+{
+    return imu_fifo->acceleration[axis];
+}
+
+float App_ImuFifo_GetFilteredAcceleration(
+    const struct ImuFifo *const imu_fifo,
+    const enum ImuAxis          axis)
+{
+    return imu_fifo->filtered_acceleration[axis];
+}
+
+float App_ImuFifo_GetAngularVelocity(
+    const struct ImuFifo *const imu_fifo,
+    const enum ImuAxis          axis)
+{
+    return imu_fifo->angular_velocity[axis];
+}
+
+uint32_t App_ImuFifo_GetTimestampUs(const struct ImuFifo *const imu_fifo)
+{
+    return imu_fifo->timestamp_us;
+}
+
+float App_ImuFifo_GetSamplePeriodUs(const struct ImuFifo *const imu_fifo)
+{
+    return imu_fifo->sample_period_us;
+}
@@ -0,0 +1,332 @@
+#include <assert.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "App_ImuFusion.h"
+#include "configs/App_ImuConfig.h"
+
+#define GRAVITY_MS2 9.80665f
+
+struct ImuFusion
+{
+    // Rotates a vector from the Imu's axes into the vehicle's axes
+    float mounting_rotation[NUM_IMU_AXES][NUM_IMU_AXES];
+
+    // The unit vector pointing up, in the vehicle's axes. It is only measured
+    // once the vehicle isn't accelerating for the first time.
+    float up[NUM_IMU_AXES];
+    bool  is_up_measured;
+
+    float gyro_bias[NUM_IMU_AXES];
+    float stationary_duration_s;
+
+    float longitudinal_acceleration;
+    float lateral_acceleration;
+    float yaw_rate;
+};
+
+/**
+ * Rotate the given vector from the Imu's axes into the vehicle's axes
+ * @param imu_fusion The sensor fusion with the mounting orientation of the Imu
+ * @param imu_vector The vector in the Imu's axes
+ * @param vehicle_vector The vector in the vehicle's axes
+ */
+static void App_RotateIntoVehicleAxes(
+    const struct ImuFusion *imu_fusion,
+    const float             imu_vector[NUM_IMU_AXES],
+    float                   vehicle_vector[NUM_IMU_AXES]);
+
+/**
+ * Get the dot product of the given vectors
+ * @param a The first vector
+ * @param b The second vector
+ * @return The dot product of the given vectors
+ */
+static float
+    App_GetDotProduct(const float a[NUM_IMU_AXES], const float b[NUM_IMU_AXES]);
+
+/**
+ * Update the gyroscope bias estimate of the given sensor fusion while the
+ * vehicle is held still
+ * @param imu_fusion The sensor fusion to update the gyroscope bias of
+ * @param angular_velocity The angular velocity measured around each of the
+ *                         vehicle's axes, in rad/s
+ * @param is_acceleration_gravity Whether the magnitude of the measured
+ *                                acceleration is that of gravity
+ * @return true if the vehicle is held still, else false
+ */
+static bool App_UpdateGyroBias(
+    struct ImuFusion *imu_fusion,
+    const float       angular_velocity[NUM_IMU_AXES],
+    bool              is_acceleration_gravity);
+
+static void App_RotateIntoVehicleAxes(
+    const struct ImuFusion *const imu_fusion,
+    const float                   imu_vector[NUM_IMU_AXES],
+    float                         vehicle_vector[NUM_IMU_AXES])
+{
+    for (uint32_t row = 0U; row < NUM_IMU_AXES; row++)
+    {
+        vehicle_vector[row] =
+            App_GetDotProduct(imu_fusion->mounting_rotation[row], imu_vector);
+    }
+}
+
+static float
+    App_GetDotProduct(const float a[NUM_IMU_AXES], const float b[NUM_IMU_AXES])
+{
+    return a[IMU_AXIS_X] * b[IMU_AXIS_X] + a[IMU_AXIS_Y] * b[IMU_AXIS_Y] +
+           a[IMU_AXIS_Z] * b[IMU_AXIS_Z];
+}
+
+static bool App_UpdateGyroBias(
+    struct ImuFusion *const imu_fusion,
+    const float             angular_velocity[NUM_IMU_AXES],
+    const bool              is_acceleration_gravity)
+{
+    float corrected_angular_velocity[NUM_IMU_AXES];
+
+    for (uint32_t axis = 0U; axis < NUM_IMU_AXES; axis++)
+    {
+        corrected_angular_velocity[axis] =
+            angular_velocity[axis] - imu_fusion->gyro_bias[axis];
+    }
+
+    // A slow turn also passes these checks, so the vehicle must be held still
+    // for a while before the bias estimate follows the angular velocity
+    if (is_acceleration_gravity &&
+        App_GetDotProduct(
+            corrected_angular_velocity, corrected_angular_velocity) <
+            IMU_MAX_STATIONARY_ANGULAR_VELOCITY *
+                IMU_MAX_STATIONARY_ANGULAR_VELOCITY)
+    {
+        imu_fusion->stationary_duration_s += IMU_SENSOR_FUSION_PERIOD_S;
+    }
+    else
+    {
+        imu_fusion->stationary_duration_s = 0.0f;
+    }
+
+    if (imu_fusion->stationary_duration_s < IMU_MIN_STATIONARY_DURATION_S)
+    {
+        return false;
+    }
+
+    // Don't let the duration grow without bound while the vehicle is parked
+    imu_fusion->stationary_duration_s = IMU_MIN_STATIONARY_DURATION_S;
+
+    const float smoothing_factor =
+        IMU_SENSOR_FUSION_PERIOD_S /
+        (IMU_GYRO_BIAS_TIME_CONSTANT_S + IMU_SENSOR_FUSION_PERIOD_S);
+
+    for (uint32_t axis = 0U; axis < NUM_IMU_AXES; axis++)
+    {
+        const float gyro_bias =
+            imu_fusion->gyro_bias[axis] +
+            smoothing_factor * corrected_angular_velocity[axis];
+
+        imu_fusion->gyro_bias[axis] =
+            fminf(fmaxf(gyro_bias, -IMU_MAX_GYRO_BIAS), IMU_MAX_GYRO_BIAS);
+    }
+
+    return true;
+}
+
+struct ImuFusion *App_ImuFusion_Create(
+    const float mounting_roll,
+    const float mounting_pitch,
+    const float mounting_yaw)
+{
+    struct ImuFusion *imu_fusion = malloc(sizeof(struct ImuFusion));
+    assert(imu_fusion != NULL);
+
+    const float sin_roll  = sinf(mounting_roll);
+    const float cos_roll  = cosf(mounting_roll);
+    const float sin_pitch = sinf(mounting_pitch);
+    const float cos_pitch = cosf(mounting_pitch);
+    const float sin_yaw   = sinf(mounting_yaw);
+    const float cos_yaw   = cosf(mounting_yaw);
+
+    // The rotation about the x-axis, then about the y-axis, then about the
+    // z-axis
+    const float mounting_rotation[NUM_IMU_AXES][NUM_IMU_AXES] = {
+        { cos_yaw * cos_pitch,
+          cos_yaw * sin_pitch * sin_roll - sin_yaw * cos_roll,
+          cos_yaw * sin_pitch * cos_roll + sin_yaw * sin_roll },
+        { sin_yaw * cos_pitch,
+          sin_yaw * sin_pitch * sin_roll + cos_yaw * cos_roll,
+          sin_yaw * sin_pitch * cos_roll - cos_yaw * sin_roll },
+        { -sin_pitch, cos_pitch * sin_roll, cos_pitch * cos_roll },
+    };
+
+    for (uint32_t row = 0U; row < NUM_IMU_AXES; row++)
+    {
+        for (uint32_t column = 0U; column < NUM_IMU_AXES; column++)
+        {
+            imu_fusion->mounting_rotation[row][column] =
+                mounting_rotation[row][column];
+        }
+
+        imu_fusion->up[row]        = 0.0f;
+        imu_fusion->gyro_bias[row] = 0.0f;
+    }
+
+    imu_fusion->up[IMU_AXIS_Z]            = 1.0f;
+    imu_fusion->is_up_measured            = false;
+    imu_fusion->stationary_duration_s     = 0.0f;
+    imu_fusion->longitudinal_acceleration = 0.0f;
+    imu_fusion->lateral_acceleration      = 0.0f;
+    imu_fusion->yaw_rate                  = 0.0f;
+
+    return imu_fusion;
+}
+
+void App_ImuFusion_Destroy(struct ImuFusion *const imu_fusion)
+{
+    free(imu_fusion);
+}
+
+void App_ImuFusion_Update(
+    struct ImuFusion *const imu_fusion,
+    const float             acceleration[NUM_IMU_AXES],
+    const float             angular_velocity[NUM_IMU_AXES])
+{
+    float vehicle_acceleration[NUM_IMU_AXES];
+    float vehicle_angular_velocity[NUM_IMU_AXES];
+
+    App_RotateIntoVehicleAxes(imu_fusion, acceleration, vehicle_acceleration);
+    App_RotateIntoVehicleAxes(
+        imu_fusion, angular_velocity, vehicle_angular_velocity);
+
+    const float acceleration_magnitude =
+        sqrtf(App_GetDotProduct(vehicle_acceleration, vehicle_acceleration));
+    const bool is_acceleration_gravity =
+        fabsf(acceleration_magnitude - GRAVITY_MS2) < IMU_MAX_GRAVITY_ERROR_MS2;
+    const bool is_held_still = App_UpdateGyroBias(
+        imu_fusion, vehicle_angular_velocity, is_acceleration_gravity);
+
+    float corrected_angular_velocity[NUM_IMU_AXES];
+
+    for (uint32_t axis = 0U; axis < NUM_IMU_AXES; axis++)
+    {
+        corrected_angular_velocity[axis] =
+            vehicle_angular_velocity[axis] - imu_fusion->gyro_bias[axis];
+    }
+
+    // The up vector is fixed while the vehicle rotates under it, so in the
+    // vehicle's axes it rotates the opposite way: d(up)/dt = up x w
+    const float *const w                     = corrected_angular_velocity;
+    float *const       up                    = imu_fusion->up;
+    const float        up_rate[NUM_IMU_AXES] = {
+        up[IMU_AXIS_Y] * w[IMU_AXIS_Z] - up[IMU_AXIS_Z] * w[IMU_AXIS_Y],
+        up[IMU_AXIS_Z] * w[IMU_AXIS_X] - up[IMU_AXIS_X] * w[IMU_AXIS_Z],
+        up[IMU_AXIS_X] * w[IMU_AXIS_Y] - up[IMU_AXIS_Y] * w[IMU_AXIS_X],
+    };
+
+    for (uint32_t axis = 0U; axis < NUM_IMU_AXES; axis++)
+    {
+        up[axis] += IMU_SENSOR_FUSION_PERIOD_S * up_rate[axis];
+    }
+
+    // Without acceleration of its own, the vehicle only measures the reaction
+    // to gravity, which points up. The first such measurement sets the up
+    // vector, and later ones correct the drift of the integration. The
+    // magnitude of the measurement barely changes with a small acceleration,
+    // so while the vehicle moves, the correction fades out as the acceleration
+    // of the vehicle estimated with the integrated up vector grows.
+    float smoothing_factor = 0.0f;
+
+    if (!imu_fusion->is_up_measured)
+    {
+        smoothing_factor = is_acceleration_gravity ? 1.0f : 0.0f;
+    }
+    else
+    {
+        float own_acceleration[NUM_IMU_AXES];
+
+        for (uint32_t axis = 0U; axis < NUM_IMU_AXES; axis++)
+        {
+            own_acceleration[axis] =
+                vehicle_acceleration[axis] - GRAVITY_MS2 * up[axis];
+        }
+
+        // A vehicle held still isn't accelerating, however far the up vector
+        // has drifted
+        const float correction_weight =
+            is_held_still
+                ? 1.0f
+                : fmaxf(
+                      1.0f - sqrtf(App_GetDotProduct(
+                                 own_acceleration, own_acceleration)) /
+                                 IMU_MAX_ATTITUDE_CORRECTION_ACCELERATION_MS2,
+                      0.0f);
+
+        smoothing_factor =
+            correction_weight * IMU_SENSOR_FUSION_PERIOD_S /
+            (IMU_ATTITUDE_TIME_CONSTANT_S + IMU_SENSOR_FUSION_PERIOD_S);
+    }
+
+    if (smoothing_factor > 0.0f)
+    {
+        for (uint32_t axis = 0U; axis < NUM_IMU_AXES; axis++)
+        {
+            up[axis] += smoothing_factor *
+                        (vehicle_acceleration[axis] / acceleration_magnitude -
+                         up[axis]);
+        }
+
+        imu_fusion->is_up_measured = true;
+    }
+
+    const float up_magnitude = sqrtf(App_GetDotProduct(up, up));
+
+    for (uint32_t axis = 0U; axis < NUM_IMU_AXES; axis++)
+    {
+        up[axis] /= up_magnitude;
+    }
+
+    imu_fusion->longitudinal_acceleration =
+        vehicle_acceleration[IMU_AXIS_X] - GRAVITY_MS2 * up[IMU_AXIS_X];
+    imu_fusion->lateral_acceleration =
+        vehicle_acceleration[IMU_AXIS_Y] - GRAVITY_MS2 * up[IMU_AXIS_Y];
+    imu_fusion->yaw_rate = App_GetDotProduct(w, up);
+}
+
+float App_ImuFusion_GetLongitudinalAcceleration(
+    const struct ImuFusion *const imu_fusion)
+{
+    return imu_fusion->longitudinal_acceleration;
+}
+
+float App_ImuFusion_GetLateralAcceleration(
+    const struct ImuFusion *const imu_fusion)
+{
+    return imu_fusion->lateral_acceleration;
+}
+
+float App_ImuFusion_GetYawRate(const struct ImuFusion *const imu_fusion)
+{
+    return imu_fusion->yaw_rate;
+}
+
+float App_ImuFusion_GetPitch(const struct ImuFusion *const imu_fusion)
+{
+    // Rounding can leave the up vector slightly longer than 1
+    const float sin_pitch =
+        fminf(fmaxf(-imu_fusion->up[IMU_AXIS_X], -1.0f), 1.0f);
+
+    return asinf(sin_pitch);
+}
+
+float App_ImuFusion_GetRoll(const struct ImuFusion *const imu_fusion)
+{
+    return atan2f(imu_fusion->up[IMU_AXIS_Y], imu_fusion->up[IMU_AXIS_Z]);
+}
+
+float App_ImuFusion_GetGyroBias(
+    const struct ImuFusion *const imu_fusion,
+    const enum ImuAxis            axis)
+{
+    return imu_fusion->gyro_bias[axis];
+}
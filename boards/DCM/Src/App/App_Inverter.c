@@ -0,0 +1,425 @@
+#include <stdlib.h>
+#include <stdint.h>
+#include <assert.h>
+
+#ifdef __arm__
+#include <FreeRTOS.h>
+#include <semphr.h>
+#elif __unix__
+#include <pthread.h>
+#else
+#error "Could not determine what CPU this is being compiled for."
+#endif
+
+#include "App_Inverter.h"
+#include "configs/App_InverterConfig.h"
+#include "configs/App_TractionControlConfig.h"
+
+// The BAMOCAR multiplexes its registers over a single CAN ID in each direction,
+// with the register ID in the first byte followed by the little-endian value
+#define TORQUE_SETPOINT_REGISTER_ID 0x90U
+#define SPEED_SETPOINT_REGISTER_ID 0x31U
+#define CYCLIC_TRANSMIT_REQUEST_REGISTER_ID 0x3DU
+#define SPEED_REGISTER_ID 0x30U
+#define CURRENT_REGISTER_ID 0x20U
+#define MOTOR_TEMPERATURE_REGISTER_ID 0x49U
+#define POWER_STAGE_TEMPERATURE_REGISTER_ID 0x4AU
+
+// 100% of a scaled register's range, in digits
+#define MAX_DIGITS 32767.0f
+
+// The distance a wheel rolls per revolution per minute, in km/h
+#define KPH_PER_WHEEL_RPM (2.0f * 3.14159265f * 60.0f / 1000.0f)
+
+#define FRAME_DLC 3U
+
+// The cyclic transmit request carries the feedback period in a single byte
+static_assert(
+    INVERTER_SPEED_FEEDBACK_PERIOD_MS <= UINT8_MAX,
+    "The speed feedback period must fit in a cyclic transmit request");
+static_assert(
+    INVERTER_CURRENT_FEEDBACK_PERIOD_MS <= UINT8_MAX,
+    "The current feedback period must fit in a cyclic transmit request");
+static_assert(
+    INVERTER_TEMPERATURE_FEEDBACK_PERIOD_MS <= UINT8_MAX,
+    "The temperature feedback period must fit in a cyclic transmit request");
+
+struct TemperaturePoint
+{
+    float digits;
+    float temperature_degc;
+};
+
+static const uint8_t feedback_register_ids[NUM_INVERTER_FEEDBACKS] = {
+    [INVERTER_FEEDBACK_SPEED]             = SPEED_REGISTER_ID,
+    [INVERTER_FEEDBACK_CURRENT]           = CURRENT_REGISTER_ID,
+    [INVERTER_FEEDBACK_MOTOR_TEMPERATURE] = MOTOR_TEMPERATURE_REGISTER_ID,
+    [INVERTER_FEEDBACK_POWER_STAGE_TEMPERATURE] =
+        POWER_STAGE_TEMPERATURE_REGISTER_ID,
+};
+
+static const uint32_t feedback_periods_ms[NUM_INVERTER_FEEDBACKS] = {
+    [INVERTER_FEEDBACK_SPEED]   = INVERTER_SPEED_FEEDBACK_PERIOD_MS,
+    [INVERTER_FEEDBACK_CURRENT] = INVERTER_CURRENT_FEEDBACK_PERIOD_MS,
+    [INVERTER_FEEDBACK_MOTOR_TEMPERATURE] =
+        INVERTER_TEMPERATURE_FEEDBACK_PERIOD_MS,
+    [INVERTER_FEEDBACK_POWER_STAGE_TEMPERATURE] =
+        INVERTER_TEMPERATURE_FEEDBACK_PERIOD_MS,
+};
+
+static const struct TemperaturePoint
+    motor_temperature_table[INVERTER_TEMPERATURE_TABLE_LENGTH] =
+        INVERTER_MOTOR_TEMPERATURE_TABLE;
+static const struct TemperaturePoint
+    power_stage_temperature_table[INVERTER_TEMPERATURE_TABLE_LENGTH] =
+        INVERTER_POWER_STAGE_TEMPERATURE_TABLE;
+
+struct Inverter
+{
+    uint32_t command_std_id;
+    uint32_t feedback_std_id;
+    void (*transmit)(uint32_t std_id, const uint8_t *data, uint32_t dlc);
+
+    uint8_t  setpoint_register_id;
+    int16_t  setpoint_digits;
+    bool     has_sent_setpoint;
+    uint32_t setpoint_time_ms;
+
+    // The feedback is received on the CAN RX task and checked for staleness
+    // on the 1kHz task, so it is only written and its timestamps are only read
+    // with the mutex held. The digits are read without it, as a 16-bit load
+    // can't tear.
+    int16_t  feedback_digits[NUM_INVERTER_FEEDBACKS];
+    bool     is_feedback_received[NUM_INVERTER_FEEDBACKS];
+    uint32_t feedback_time_ms[NUM_INVERTER_FEEDBACKS];
+#ifdef __arm__
+    StaticSemaphore_t feedback_mutex_storage;
+    SemaphoreHandle_t feedback_mutex;
+#elif __unix__
+    pthread_mutex_t feedback_mutex;
+#endif
+
+    bool     is_feedback_stale[NUM_INVERTER_FEEDBACKS];
+    bool     is_subscribed[NUM_INVERTER_FEEDBACKS];
+    uint32_t subscription_time_ms[NUM_INVERTER_FEEDBACKS];
+};
+
+/**
+ * Convert the given value to digits of a scaled register
+ * @param value The value to convert
+ * @param max_value The value that 100% of the register's range corresponds to
+ * @return The value in digits, clamped to the register's range
+ */
+static int16_t App_ValueToDigits(float value, float max_value);
+
+/**
+ * Convert the given temperature digits with the given calibration table
+ * @param table The calibration table to interpolate
+ * @param digits The temperature digits reported by the inverter
+ * @return The temperature, in degC
+ */
+static float App_DigitsToTemperature(
+    const struct TemperaturePoint table[INVERTER_TEMPERATURE_TABLE_LENGTH],
+    int16_t                       digits);
+
+/**
+ * Send a frame to the given inverter that writes the given register
+ * @param inverter The inverter to send the frame to
+ * @param register_id The register to write
+ * @param value The 16-bit value to write, which is sent little-endian
+ */
+static void App_WriteRegister(
+    const struct Inverter *inverter,
+    uint8_t                register_id,
+    uint16_t               value);
+
+/**
+ * Ask the given inverter to send the given feedback cyclically
+ * @param inverter The inverter to subscribe to
+ * @param feedback The feedback to subscribe to
+ */
+static void App_Subscribe(
+    const struct Inverter *inverter,
+    enum InverterFeedback  feedback);
+
+/**
+ * Take the mutex guarding the feedback of the given inverter
+ * @param inverter The inverter to take the feedback mutex of
+ */
+static void App_LockFeedback(struct Inverter *inverter);
+
+/**
+ * Give back the mutex guarding the feedback of the given inverter
+ * @param inverter The inverter to give back the feedback mutex of
+ */
+static void App_UnlockFeedback(struct Inverter *inverter);
+
+static int16_t App_ValueToDigits(const float value, const float max_value)
+{
+    float digits = value / max_value * MAX_DIGITS;
+
+    if (digits > MAX_DIGITS)
+    {
+        digits = MAX_DIGITS;
+    }
+    else if (digits < -MAX_DIGITS)
+    {
+        digits = -MAX_DIGITS;
+    }
+
+    return (int16_t)(digits < 0.0f ? digits - 0.5f : digits + 0.5f);
+}
+
+static float App_DigitsToTemperature(
+    const struct TemperaturePoint table[INVERTER_TEMPERATURE_TABLE_LENGTH],
+    const int16_t                 digits)
+{
+    const float x = (float)digits;
+
+    if (x <= table[0].digits)
+    {
+        return table[0].temperature_degc;
+    }
+
+    for (uint32_t i = 1U; i < INVERTER_TEMPERATURE_TABLE_LENGTH; i++)
+    {
+        if (x <= table[i].digits)
+        {
+            const float fraction = (x - table[i - 1].digits) /
+                                   (table[i].digits - table[i - 1].digits);
+
+            return table[i - 1].temperature_degc +
+                   fraction * (table[i].temperature_degc -
+                               table[i - 1].temperature_degc);
+        }
+    }
+
+    return table[INVERTER_TEMPERATURE_TABLE_LENGTH - 1].temperature_degc;
+}
+
+static void App_WriteRegister(
+    const struct Inverter *const inverter,
+    const uint8_t                register_id,
+    const uint16_t               value)
+{
+    const uint8_t data[FRAME_DLC] = { register_id, (uint8_t)(value & 0xFFU),
+                                      (uint8_t)(value >> 8) };
+
+    inverter->transmit(inverter->command_std_id, data, FRAME_DLC);
+}
+
+static void App_Subscribe(
+    const struct Inverter *const inverter,
+    const enum InverterFeedback  feedback)
+{
+    const uint8_t data[FRAME_DLC] = {
+        CYCLIC_TRANSMIT_REQUEST_REGISTER_ID,
+        feedback_register_ids[feedback],
+        (uint8_t)feedback_periods_ms[feedback],
+    };
+
+    inverter->transmit(inverter->command_std_id, data, FRAME_DLC);
+}
+
+static void App_LockFeedback(struct Inverter *const inverter)
+{
+#ifdef __arm__
+    xSemaphoreTake(inverter->feedback_mutex, portMAX_DELAY);
+#elif __unix__
+    pthread_mutex_lock(&(inverter->feedback_mutex));
+#endif
+}
+
+static void App_UnlockFeedback(struct Inverter *const inverter)
+{
+#ifdef __arm__
+    xSemaphoreGive(inverter->feedback_mutex);
+#elif __unix__
+    pthread_mutex_unlock(&(inverter->feedback_mutex));
+#endif
+}
+
+struct Inverter *App_Inverter_Create(
+    const uint32_t command_std_id,
+    const uint32_t feedback_std_id,
+    void (*const transmit)(uint32_t, const uint8_t *, uint32_t))
+{
+    struct Inverter *inverter = malloc(sizeof(struct Inverter));
+    assert(inverter != NULL);
+
+    inverter->command_std_id  = command_std_id;
+    inverter->feedback_std_id = feedback_std_id;
+    inverter->transmit        = transmit;
+
+    inverter->setpoint_register_id = TORQUE_SETPOINT_REGISTER_ID;
+    inverter->setpoint_digits      = 0;
+    inverter->has_sent_setpoint    = false;
+    inverter->setpoint_time_ms     = 0U;
+
+    for (uint32_t i = 0U; i < NUM_INVERTER_FEEDBACKS; i++)
+    {
+        inverter->feedback_digits[i]      = 0;
+        inverter->is_feedback_received[i] = false;
+        inverter->feedback_time_ms[i]     = 0U;
+        inverter->is_feedback_stale[i]    = true;
+        inverter->is_subscribed[i]        = false;
+        inverter->subscription_time_ms[i] = 0U;
+    }
+
+#ifdef __arm__
+    inverter->feedback_mutex =
+        xSemaphoreCreateMutexStatic(&(inverter->feedback_mutex_storage));
+#elif __unix__
+    pthread_mutex_init(&(inverter->feedback_mutex), NULL);
+#endif
+
+    return inverter;
+}
+
+void App_Inverter_Destroy(struct Inverter *const inverter)
+{
+#ifdef __arm__
+    vSemaphoreDelete(inverter->feedback_mutex);
+#elif __unix__
+    pthread_mutex_destroy(&(inverter->feedback_mutex));
+#endif
+
+    free(inverter);
+}
+
+void App_Inverter_SetTorqueSetpoint(
+    struct Inverter *const inverter,
+    const float            torque_nm)
+{
+    inverter->setpoint_register_id = TORQUE_SETPOINT_REGISTER_ID;
+    inverter->setpoint_digits =
+        App_ValueToDigits(torque_nm, INVERTER_MAX_TORQUE_NM);
+}
+
+void App_Inverter_SetSpeedSetpoint(
+    struct Inverter *const inverter,
+    const float            speed_rpm)
+{
+    inverter->setpoint_register_id = SPEED_SETPOINT_REGISTER_ID;
+    inverter->setpoint_digits =
+        App_ValueToDigits(speed_rpm, INVERTER_MAX_SPEED_RPM);
+}
+
+void App_Inverter_Tick(
+    struct Inverter *const inverter,
+    const uint32_t         current_time_ms)
+{
+    if (!inverter->has_sent_setpoint ||
+        current_time_ms - inverter->setpoint_time_ms >=
+            INVERTER_SETPOINT_PERIOD_MS)
+    {
+        App_WriteRegister(
+            inverter, inverter->setpoint_register_id,
+            (uint16_t)inverter->setpoint_digits);
+        inverter->has_sent_setpoint = true;
+        inverter->setpoint_time_ms  = current_time_ms;
+    }
+
+    for (uint32_t i = 0U; i < NUM_INVERTER_FEEDBACKS; i++)
+    {
+        App_LockFeedback(inverter);
+        const bool     is_feedback_received = inverter->is_feedback_received[i];
+        const uint32_t feedback_time_ms     = inverter->feedback_time_ms[i];
+        App_UnlockFeedback(inverter);
+
+        // Feedback is received on the CAN RX task, so it may be timestamped a
+        // little after the current time of this tick
+        const int32_t feedback_age_ms =
+            (int32_t)(current_time_ms - feedback_time_ms);
+
+        inverter->is_feedback_stale[i] =
+            !is_feedback_received ||
+            feedback_age_ms >
+                (int32_t)(
+                    INVERTER_STALE_FEEDBACK_PERIODS * feedback_periods_ms[i]);
+
+        if (inverter->is_feedback_stale[i] &&
+            (!inverter->is_subscribed[i] ||
+             current_time_ms - inverter->subscription_time_ms[i] >=
+                 INVERTER_RESUBSCRIBE_PERIOD_MS))
+        {
+            App_Subscribe(inverter, (enum InverterFeedback)i);
+            inverter->is_subscribed[i]        = true;
+            inverter->subscription_time_ms[i] = current_time_ms;
+        }
+    }
+}
+
+bool App_Inverter_ProcessFrame(
+    struct Inverter *const inverter,
+    const uint32_t         std_id,
+    const uint8_t *const   data,
+    const uint32_t         dlc,
+    const uint32_t         current_time_ms)
+{
+    if (std_id != inverter->feedback_std_id)
+    {
+        return false;
+    }
+
+    if (dlc < FRAME_DLC)
+    {
+        return true;
+    }
+
+    for (uint32_t i = 0U; i < NUM_INVERTER_FEEDBACKS; i++)
+    {
+        if (data[0] == feedback_register_ids[i])
+        {
+            App_LockFeedback(inverter);
+            inverter->feedback_digits[i] =
+                (int16_t)((uint16_t)data[1] | (uint16_t)(data[2] << 8));
+            inverter->feedback_time_ms[i]     = current_time_ms;
+            inverter->is_feedback_received[i] = true;
+            App_UnlockFeedback(inverter);
+        }
+    }
+
+    return true;
+}
+
+bool App_Inverter_IsFeedbackStale(
+    const struct Inverter *const inverter,
+    const enum InverterFeedback  feedback)
+{
+    return inverter->is_feedback_stale[feedback];
+}
+
+float App_Inverter_GetSpeedRpm(const struct Inverter *const inverter)
+{
+    return (float)inverter->feedback_digits[INVERTER_FEEDBACK_SPEED] /
+           MAX_DIGITS * INVERTER_MAX_SPEED_RPM;
+}
+
+float App_Inverter_GetWheelSpeedKph(const struct Inverter *const inverter)
+{
+    return App_Inverter_GetSpeedRpm(inverter) / TRACTION_CONTROL_GEAR_RATIO *
+           TRACTION_CONTROL_WHEEL_RADIUS_M * KPH_PER_WHEEL_RPM;
+}
+
+float App_Inverter_GetCurrentA(const struct Inverter *const inverter)
+{
+    return (float)inverter->feedback_digits[INVERTER_FEEDBACK_CURRENT] /
+           MAX_DIGITS * INVERTER_PEAK_CURRENT_A;
+}
+
+float App_Inverter_GetMotorTemperatureDegC(
+    const struct Inverter *const inverter)
+{
+    return App_DigitsToTemperature(
+        motor_temperature_table,
+        inverter->feedback_digits[INVERTER_FEEDBACK_MOTOR_TEMPERATURE]);
+}
+
+float App_Inverter_GetPowerStageTemperatureDegC(
+    const struct Inverter *const inverter)
+{
+    return App_DigitsToTemperature(
+        power_stage_temperature_table,
+        inverter->feedback_digits[INVERTER_FEEDBACK_POWER_STAGE_TEMPERATURE]);
+}
@@ -0,0 +1,165 @@
+#include <stdlib.h>
+#include <assert.h>
+
+#include "App_LaunchControl.h"
+#include "configs/App_LaunchControlConfig.h"
+#include "configs/App_TorqueRequestThresholds.h"
+
+#define LAUNCH_CONTROL_TORQUE_PROFILE_DURATION_MS \
+    (LAUNCH_CONTROL_TORQUE_PROFILE_STEP_MS *      \
+     LAUNCH_CONTROL_TORQUE_PROFILE_LENGTH)
+
+#define TORQUE_PROFILE_NM_PER_PERCENT (0.01f * MAX_TORQUE_REQUEST_NM)
+
+static const float
+    torque_profile_percentage[LAUNCH_CONTROL_TORQUE_PROFILE_LENGTH] =
+        LAUNCH_CONTROL_TORQUE_PROFILE;
+
+struct LaunchControl
+{
+    enum LaunchControlStatus status;
+    uint32_t                 arming_tick_count;
+    uint32_t                 brake_release_time_ms;
+    uint32_t                 launch_time_ms;
+    float                    torque_limit;
+};
+
+struct LaunchControl *App_LaunchControl_Create(void)
+{
+    struct LaunchControl *launch_control = malloc(sizeof(struct LaunchControl));
+    assert(launch_control != NULL);
+
+    launch_control->brake_release_time_ms = 0U;
+    launch_control->launch_time_ms        = 0U;
+    App_LaunchControl_Disable(launch_control);
+
+    return launch_control;
+}
+
+void App_LaunchControl_Destroy(struct LaunchControl *launch_control)
+{
+    free(launch_control);
+}
+
+bool App_LaunchControl_UpdateArming(
+    struct LaunchControl *const launch_control,
+    const bool                  is_arming_condition_held)
+{
+    if (!is_arming_condition_held)
+    {
+        launch_control->arming_tick_count = 0U;
+        return false;
+    }
+
+    if (launch_control->arming_tick_count < LAUNCH_CONTROL_ARMING_DURATION_MS)
+    {
+        launch_control->arming_tick_count++;
+    }
+
+    return launch_control->arming_tick_count >=
+           LAUNCH_CONTROL_ARMING_DURATION_MS;
+}
+
+void App_LaunchControl_Enable(
+    struct LaunchControl *const launch_control,
+    const uint32_t              current_time_ms)
+{
+    launch_control->status                = LAUNCH_CONTROL_ARMED;
+    launch_control->brake_release_time_ms = current_time_ms;
+    launch_control->torque_limit          = 0.0f;
+}
+
+void App_LaunchControl_Disable(struct LaunchControl *const launch_control)
+{
+    launch_control->status            = LAUNCH_CONTROL_DISABLED;
+    launch_control->arming_tick_count = 0U;
+    launch_control->torque_limit      = 0.0f;
+}
+
+enum LaunchControlStatus App_LaunchControl_Tick(
+    struct LaunchControl *const launch_control,
+    const bool                  is_launch_control_selected,
+    const bool                  is_brake_actuated,
+    const float                 pedal_percentage,
+    const uint32_t              current_time_ms)
+{
+    const bool is_pedal_pressed =
+        pedal_percentage >= LAUNCH_CONTROL_MIN_PEDAL_PERCENTAGE;
+
+    if (!is_launch_control_selected &&
+        (launch_control->status == LAUNCH_CONTROL_ARMED ||
+         launch_control->status == LAUNCH_CONTROL_LAUNCHING))
+    {
+        launch_control->status = LAUNCH_CONTROL_ABORTED;
+    }
+
+    if (launch_control->status == LAUNCH_CONTROL_ARMED)
+    {
+        // The APPS and brake plausibility check on the FSM zeroes the mapped
+        // pedal percentage if the pedal is pressed while braking, so the
+        // driver releases the brake before flooring the pedal
+        if (is_brake_actuated)
+        {
+            launch_control->brake_release_time_ms = current_time_ms;
+        }
+        else if (is_pedal_pressed)
+        {
+            launch_control->status         = LAUNCH_CONTROL_LAUNCHING;
+            launch_control->launch_time_ms = current_time_ms;
+        }
+        else if (
+            current_time_ms - launch_control->brake_release_time_ms >
+            LAUNCH_CONTROL_MAX_PEDAL_DELAY_MS)
+        {
+            launch_control->status = LAUNCH_CONTROL_ABORTED;
+        }
+    }
+    else if (launch_control->status == LAUNCH_CONTROL_LAUNCHING)
+    {
+        if (is_brake_actuated || !is_pedal_pressed)
+        {
+            launch_control->status = LAUNCH_CONTROL_ABORTED;
+        }
+    }
+
+    if (launch_control->status == LAUNCH_CONTROL_LAUNCHING)
+    {
+        const uint32_t elapsed_time_ms =
+            current_time_ms - launch_control->launch_time_ms;
+
+        if (elapsed_time_ms >= LAUNCH_CONTROL_TORQUE_PROFILE_DURATION_MS)
+        {
+            launch_control->status = LAUNCH_CONTROL_COMPLETE;
+        }
+        else
+        {
+            launch_control->torque_limit =
+                TORQUE_PROFILE_NM_PER_PERCENT *
+                torque_profile_percentage
+                    [elapsed_time_ms / LAUNCH_CONTROL_TORQUE_PROFILE_STEP_MS];
+        }
+    }
+
+    return launch_control->status;
+}
+
+float App_LaunchControl_LimitTorqueRequest(
+    const struct LaunchControl *const launch_control,
+    const float                       torque_request)
+{
+    if (launch_control->status != LAUNCH_CONTROL_ARMED &&
+        launch_control->status != LAUNCH_CONTROL_LAUNCHING)
+    {
+        return torque_request;
+    }
+
+    return torque_request < launch_control->torque_limit
+               ? torque_request
+               : launch_control->torque_limit;
+}
+
+enum LaunchControlStatus App_LaunchControl_GetStatus(
+    const struct LaunchControl *const launch_control)
+{
+    return launch_control->status;
+}
@@ -0,0 +1,122 @@
+#include <stdlib.h>
+#include <assert.h>
+
+#include "App_PowerLimiter.h"
+#include "configs/App_PowerLimiterConfig.h"
+#include "configs/App_TractionControlConfig.h"
+
+#define W_PER_KW 1000.0f
+#define M_PER_S_PER_KPH (1.0f / 3.6f)
+
+struct PowerLimiter
+{
+    float max_power_w;
+
+    // The electrical power that the drivetrain efficiency doesn't account for,
+    // such as the inverters' switching losses and the accumulator's
+    // auxiliaries, in W
+    float unmodelled_power_w;
+
+    // The total torque of the last limited torque requests, and the most total
+    // torque that was allowed for them, in Nm
+    float last_total_torque_nm;
+    float max_total_torque_nm;
+};
+
+struct PowerLimiter *App_PowerLimiter_Create(const float max_power_kw)
+{
+    struct PowerLimiter *power_limiter = malloc(sizeof(struct PowerLimiter));
+    assert(power_limiter != NULL);
+
+    power_limiter->max_power_w          = max_power_kw * W_PER_KW;
+    power_limiter->unmodelled_power_w   = 0.0f;
+    power_limiter->last_total_torque_nm = 0.0f;
+    power_limiter->max_total_torque_nm  = 0.0f;
+
+    return power_limiter;
+}
+
+void App_PowerLimiter_Destroy(struct PowerLimiter *const power_limiter)
+{
+    free(power_limiter);
+}
+
+struct MotorTorqueRequests App_PowerLimiter_LimitTorqueRequests(
+    struct PowerLimiter *const power_limiter,
+    struct MotorTorqueRequests motor_torque_requests,
+    const float                driven_wheel_speed_kph,
+    const float                acceleration,
+    const float                ts_voltage,
+    const float                ts_current)
+{
+    float wheel_speed = driven_wheel_speed_kph * M_PER_S_PER_KPH;
+    if (wheel_speed < 0.0f)
+    {
+        wheel_speed = 0.0f;
+    }
+
+    const float motor_speed = wheel_speed * TRACTION_CONTROL_GEAR_RATIO /
+                              TRACTION_CONTROL_WHEEL_RADIUS_M;
+
+    // Correct the model with the measured power. The correction never goes
+    // below zero, so a BMS that isn't broadcasting can't loosen the limit.
+    const float modelled_power_w = power_limiter->last_total_torque_nm *
+                                   motor_speed /
+                                   POWER_LIMITER_DRIVETRAIN_EFFICIENCY;
+    const float measured_power_w = ts_voltage * ts_current;
+
+    power_limiter->unmodelled_power_w +=
+        POWER_LIMITER_CORRECTION_GAIN * (measured_power_w - modelled_power_w -
+                                         power_limiter->unmodelled_power_w);
+    if (power_limiter->unmodelled_power_w < 0.0f)
+    {
+        power_limiter->unmodelled_power_w = 0.0f;
+    }
+
+    // Limit the torque with the motor speed at the end of the horizon, as the
+    // power rises with the speed at constant torque
+    float predicted_motor_speed =
+        motor_speed + acceleration * TRACTION_CONTROL_GEAR_RATIO /
+                          TRACTION_CONTROL_WHEEL_RADIUS_M *
+                          POWER_LIMITER_PREDICTION_HORIZON_S;
+    if (predicted_motor_speed < POWER_LIMITER_MIN_MOTOR_SPEED_RAD_PER_S)
+    {
+        predicted_motor_speed = POWER_LIMITER_MIN_MOTOR_SPEED_RAD_PER_S;
+    }
+
+    float available_power_w = power_limiter->max_power_w -
+                              POWER_LIMITER_MARGIN_KW * W_PER_KW -
+                              power_limiter->unmodelled_power_w;
+    if (available_power_w < 0.0f)
+    {
+        available_power_w = 0.0f;
+    }
+
+    const float max_total_torque_nm = available_power_w *
+                                      POWER_LIMITER_DRIVETRAIN_EFFICIENCY /
+                                      predicted_motor_speed;
+    const float total_torque_nm =
+        motor_torque_requests.left + motor_torque_requests.right;
+
+    // Regenerative braking charges the accumulator, so only driving torque is
+    // limited
+    if (total_torque_nm > max_total_torque_nm)
+    {
+        const float scale = max_total_torque_nm / total_torque_nm;
+
+        motor_torque_requests.left *= scale;
+        motor_torque_requests.right *= scale;
+    }
+
+    power_limiter->last_total_torque_nm =
+        motor_torque_requests.left + motor_torque_requests.right;
+    power_limiter->max_total_torque_nm = max_total_torque_nm;
+
+    return motor_torque_requests;
+}
+
+float App_PowerLimiter_GetMaxTotalTorqueNm(
+    const struct PowerLimiter *const power_limiter)
+{
+    return power_limiter->max_total_torque_nm;
+}
@@ -6,12 +6,19 @@
 
 STATIC_DEFINE_APP_SET_PERIODIC_CAN_SIGNALS_IN_RANGE_CHECK(DcmCanTxInterface)
 
-// TODO: Implement PID controller to maintain DC bus power at 80kW
-// #680
 void App_SetPeriodicCanSignals_TorqueRequests(const struct DcmWorld *world)
 {
     struct DcmCanRxInterface *can_rx = App_DcmWorld_GetCanRx(world);
     struct DcmCanTxInterface *can_tx = App_DcmWorld_GetCanTx(world);
+    struct TractionControl *  traction_control =
+        App_DcmWorld_GetTractionControl(world);
+    struct TorqueVectoring *torque_vectoring =
+        App_DcmWorld_GetTorqueVectoring(world);
+    struct LaunchControl *launch_control = App_DcmWorld_GetLaunchControl(world);
+    struct Imu *          imu            = App_DcmWorld_GetImu(world);
+    struct PowerLimiter * power_limiter  = App_DcmWorld_GetPowerLimiter(world);
+    struct Inverter *     left_inverter  = App_DcmWorld_GetLeftInverter(world);
+    struct Inverter *     right_inverter = App_DcmWorld_GetRightInverter(world);
 
     // Regen allowed when braking or (speed > REGEN_WHEEL_SPEED_THRESHOLD_KPH
     // and AIRs closed)
@@ -64,7 +71,98 @@ void App_SetPeriodicCanSignals_TorqueRequests(const struct DcmWorld *world)
             MAX_TORQUE_REQUEST_NM;
     }
 
+    // Launch control holds the vehicle while armed, and ramps the torque up
+    // along its torque profile during a launch
+    torque_request =
+        App_LaunchControl_LimitTorqueRequest(launch_control, torque_request);
+
+    const float front_wheel_speed_kph =
+        0.5f *
+        (App_CanRx_FSM_WHEEL_SPEED_SENSOR_GetSignal_LEFT_WHEEL_SPEED(can_rx) +
+         App_CanRx_FSM_WHEEL_SPEED_SENSOR_GetSignal_RIGHT_WHEEL_SPEED(can_rx));
+
+    // The driven wheels have no speed sensors, so their speed is derived from
+    // the motor speeds fed back by the inverters. Without it, the front wheel
+    // speed is the best estimate of how fast they roll.
+    const bool is_driven_wheel_speed_stale =
+        App_Inverter_IsFeedbackStale(left_inverter, INVERTER_FEEDBACK_SPEED) ||
+        App_Inverter_IsFeedbackStale(right_inverter, INVERTER_FEEDBACK_SPEED);
+    const float driven_wheel_speed_kph =
+        is_driven_wheel_speed_stale
+            ? front_wheel_speed_kph
+            : 0.5f * (App_Inverter_GetWheelSpeedKph(left_inverter) +
+                      App_Inverter_GetWheelSpeedKph(right_inverter));
+
+    App_CanTx_SetPeriodicSignal_DRIVEN_WHEEL_SPEED_IS_STALE(
+        can_tx,
+        is_driven_wheel_speed_stale
+            ? CANMSGS_DCM_NON_CRITICAL_ERRORS_DRIVEN_WHEEL_SPEED_IS_STALE_TRUE_CHOICE
+            : CANMSGS_DCM_NON_CRITICAL_ERRORS_DRIVEN_WHEEL_SPEED_IS_STALE_FALSE_CHOICE);
+
+    // Traction control cuts the torque request if the driven wheels spin
+    // faster than the undriven front wheels by more than the target slip ratio.
+    // It can't tell if they spin without their speed, so it is disabled then.
+    if (App_CanRx_DIM_SWITCHES_GetSignal_TRACTION_CONTROL_SWITCH(can_rx) ==
+            CANMSGS_DIM_SWITCHES_TRACTION_CONTROL_SWITCH_ON_CHOICE &&
+        !is_driven_wheel_speed_stale)
+    {
+        torque_request = App_TractionControl_LimitTorqueRequest(
+            traction_control, torque_request, front_wheel_speed_kph,
+            driven_wheel_speed_kph, App_Imu_GetLongitudinalAcceleration(imu));
+    }
+    else
+    {
+        App_TractionControl_Reset(traction_control);
+    }
+
+    // Torque vectoring splits the torque request between the motors to follow
+    // the yaw rate the driver steers for
+    struct MotorTorqueRequests motor_torque_requests = {
+        .left  = torque_request,
+        .right = torque_request,
+    };
+
+    if (App_CanRx_DIM_SWITCHES_GetSignal_TORQUE_VECTORING_SWITCH(can_rx) ==
+        CANMSGS_DIM_SWITCHES_TORQUE_VECTORING_SWITCH_ON_CHOICE)
+    {
+        motor_torque_requests = App_TorqueVectoring_AllocateTorqueRequest(
+            torque_vectoring, torque_request,
+            App_CanRx_FSM_STEERING_ANGLE_SENSOR_GetSignal_STEERING_ANGLE(
+                can_rx),
+            front_wheel_speed_kph, App_Imu_GetYawRate(imu));
+    }
+    else
+    {
+        App_TorqueVectoring_Reset(torque_vectoring);
+    }
+
+    // The power limiter scales both motor torque requests down by the same
+    // factor, so the tractive system power stays under the 80kW limit
+    const float requested_total_torque_nm =
+        motor_torque_requests.left + motor_torque_requests.right;
+
+    motor_torque_requests = App_PowerLimiter_LimitTorqueRequests(
+        power_limiter, motor_torque_requests, driven_wheel_speed_kph,
+        App_Imu_GetLongitudinalAcceleration(imu),
+        App_CanRx_BMS_TRACTIVE_SYSTEM_GetSignal_TS_VOLTAGE(can_rx),
+        App_CanRx_BMS_TRACTIVE_SYSTEM_GetSignal_TS_CURRENT(can_rx));
+
+    const float limited_total_torque_nm =
+        motor_torque_requests.left + motor_torque_requests.right;
+
+    if (limited_total_torque_nm < requested_total_torque_nm)
+    {
+        torque_request *= limited_total_torque_nm / requested_total_torque_nm;
+    }
+
     App_CanTx_SetPeriodicSignal_TORQUE_REQUEST(can_tx, torque_request);
+    App_CanTx_SetPeriodicSignal_LEFT_TORQUE_REQUEST(
+        can_tx, motor_torque_requests.left);
+    App_CanTx_SetPeriodicSignal_RIGHT_TORQUE_REQUEST(
+        can_tx, motor_torque_requests.right);
+
+    App_Inverter_SetTorqueSetpoint(left_inverter, motor_torque_requests.left);
+    App_Inverter_SetTorqueSetpoint(right_inverter, motor_torque_requests.right);
 }
 
 void App_SetPeriodicCanSignals_Imu(const struct DcmWorld *world)
@@ -95,4 +193,50 @@ void App_SetPeriodicCanSignals_Imu(const struct DcmWorld *world)
         CANMSGS_DCM_NON_CRITICAL_ERRORS_ACCELERATION_Z_OUT_OF_RANGE_OK_CHOICE,
         CANMSGS_DCM_NON_CRITICAL_ERRORS_ACCELERATION_Z_OUT_OF_RANGE_UNDERFLOW_CHOICE,
         CANMSGS_DCM_NON_CRITICAL_ERRORS_ACCELERATION_Z_OUT_OF_RANGE_OVERFLOW_CHOICE);
+
+    App_CanTx_SetPeriodicSignal_LONGITUDINAL_ACCELERATION(
+        can_tx, App_Imu_GetLongitudinalAcceleration(imu));
+    App_CanTx_SetPeriodicSignal_LATERAL_ACCELERATION(
+        can_tx, App_Imu_GetLateralAcceleration(imu));
+    App_CanTx_SetPeriodicSignal_YAW_RATE(can_tx, App_Imu_GetYawRate(imu));
+    App_CanTx_SetPeriodicSignal_PITCH(can_tx, App_Imu_GetPitch(imu));
+    App_CanTx_SetPeriodicSignal_ROLL(can_tx, App_Imu_GetRoll(imu));
+}
+
+void App_SetPeriodicCanSignals_ImuSensorFusionBenchmark(
+    const struct DcmWorld *world)
+{
+    struct Imu *              imu    = App_DcmWorld_GetImu(world);
+    struct DcmCanTxInterface *can_tx = App_DcmWorld_GetCanTx(world);
+
+    App_CanTx_SetPeriodicSignal_MAX_SENSOR_FUSION_CYCLES(
+        can_tx, App_Imu_TakeMaxSensorFusionCycles(imu));
+}
+
+void App_SetPeriodicCanSignals_TorqueVectoringBenchmark(
+    const struct DcmWorld *world)
+{
+    struct TorqueVectoring *torque_vectoring =
+        App_DcmWorld_GetTorqueVectoring(world);
+    struct DcmCanTxInterface *can_tx = App_DcmWorld_GetCanTx(world);
+
+    App_CanTx_SetPeriodicSignal_MAX_TORQUE_ALLOCATION_CYCLES(
+        can_tx,
+        App_TorqueVectoring_TakeMaxTorqueAllocationCycles(torque_vectoring));
+}
+
+void App_SetPeriodicCanSignals_Inverters(const struct DcmWorld *world)
+{
+    struct Inverter *left_inverter   = App_DcmWorld_GetLeftInverter(world);
+    struct Inverter *right_inverter  = App_DcmWorld_GetRightInverter(world);
+    struct DcmCanTxInterface *can_tx = App_DcmWorld_GetCanTx(world);
+
+    App_CanTx_SetPeriodicSignal_LEFT_MOTOR_SPEED(
+        can_tx, App_Inverter_GetSpeedRpm(left_inverter));
+    App_CanTx_SetPeriodicSignal_RIGHT_MOTOR_SPEED(
+        can_tx, App_Inverter_GetSpeedRpm(right_inverter));
+    App_CanTx_SetPeriodicSignal_LEFT_MOTOR_CURRENT(
+        can_tx, App_Inverter_GetCurrentA(left_inverter));
+    App_CanTx_SetPeriodicSignal_RIGHT_MOTOR_CURRENT(
+        can_tx, App_Inverter_GetCurrentA(right_inverter));
 }
@@ -0,0 +1,193 @@
+#include <stdlib.h>
+#include <stdbool.h>
+#include <assert.h>
+
+#include "App_TorqueVectoring.h"
+#include "configs/App_TorqueVectoringConfig.h"
+#include "configs/App_TorqueRequestThresholds.h"
+
+#define KPH_PER_MPS 3.6f
+#define RAD_PER_DEG 0.0174533f
+
+struct TorqueVectoring
+{
+    float reference_yaw_rate;
+
+    uint32_t (*get_cycle_count)(void);
+    uint32_t max_torque_allocation_cycles;
+};
+
+/**
+ * Clamp the given value to [-limit, limit]
+ * @param value The value to clamp
+ * @param limit The non-negative limit of the magnitude of the value
+ * @return The clamped value
+ */
+static float App_ClampMagnitude(float value, float limit);
+
+/**
+ * Update the reference yaw rate of the given torque vectoring, and split the
+ * given torque request between the left and right motors
+ * @see App_TorqueVectoring_AllocateTorqueRequest
+ */
+static struct MotorTorqueRequests App_AllocateTorqueRequest(
+    struct TorqueVectoring *torque_vectoring,
+    float                   torque_request,
+    float                   steering_angle,
+    float                   vehicle_speed_kph,
+    float                   yaw_rate);
+
+static float App_ClampMagnitude(const float value, const float limit)
+{
+    if (value > limit)
+    {
+        return limit;
+    }
+
+    if (value < -limit)
+    {
+        return -limit;
+    }
+
+    return value;
+}
+
+static struct MotorTorqueRequests App_AllocateTorqueRequest(
+    struct TorqueVectoring *const torque_vectoring,
+    const float                   torque_request,
+    const float                   steering_angle,
+    const float                   vehicle_speed_kph,
+    const float                   yaw_rate)
+{
+    const float vehicle_speed = vehicle_speed_kph / KPH_PER_MPS;
+    const bool  is_over_min_speed =
+        vehicle_speed_kph > TORQUE_VECTORING_MIN_VEHICLE_SPEED_KPH;
+
+    // The steady-state yaw rate of a bicycle model with the configured
+    // understeer, which the tyres can only sustain up to the maximum lateral
+    // acceleration. The road wheel angle is small enough that tan(x) ~= x.
+    float steady_state_yaw_rate = 0.0f;
+
+    if (is_over_min_speed)
+    {
+        const float road_wheel_angle =
+            steering_angle * RAD_PER_DEG / TORQUE_VECTORING_STEERING_RATIO;
+
+        steady_state_yaw_rate = App_ClampMagnitude(
+            vehicle_speed * road_wheel_angle /
+                (TORQUE_VECTORING_WHEELBASE_M +
+                 TORQUE_VECTORING_UNDERSTEER_GRADIENT_S2_PER_M * vehicle_speed *
+                     vehicle_speed),
+            TORQUE_VECTORING_MAX_LATERAL_ACCELERATION_MPS2 / vehicle_speed);
+    }
+
+    // The vehicle can't yaw as soon as it is steered, so the reference lags
+    // behind the steady-state yaw rate
+    torque_vectoring->reference_yaw_rate +=
+        TORQUE_VECTORING_PERIOD_S /
+        (TORQUE_VECTORING_REFERENCE_TIME_CONSTANT_S +
+         TORQUE_VECTORING_PERIOD_S) *
+        (steady_state_yaw_rate - torque_vectoring->reference_yaw_rate);
+
+    struct MotorTorqueRequests motor_torque_requests = {
+        .left  = torque_request,
+        .right = torque_request,
+    };
+
+    if (!is_over_min_speed || torque_request <= 0.0f)
+    {
+        return motor_torque_requests;
+    }
+
+    // More torque on the right motor yaws the vehicle left. The torque
+    // difference is limited so that neither motor is asked for negative torque.
+    const float reference_yaw_rate = torque_vectoring->reference_yaw_rate;
+    float       torque_difference  = App_ClampMagnitude(
+        TORQUE_VECTORING_FEED_FORWARD_GAIN_NM_S * reference_yaw_rate +
+            TORQUE_VECTORING_PROPORTIONAL_GAIN_NM_S *
+                (reference_yaw_rate - yaw_rate),
+        TORQUE_VECTORING_MAX_TORQUE_DIFFERENCE_NM);
+    torque_difference =
+        App_ClampMagnitude(torque_difference, 2.0f * torque_request);
+
+    motor_torque_requests.left  = torque_request - 0.5f * torque_difference;
+    motor_torque_requests.right = torque_request + 0.5f * torque_difference;
+
+    // Keep the yaw moment rather than the total torque if the outer motor
+    // would exceed its maximum torque
+    const float outer_motor_torque_request = torque_difference > 0.0f
+                                                 ? motor_torque_requests.right
+                                                 : motor_torque_requests.left;
+
+    if (outer_motor_torque_request > MAX_TORQUE_REQUEST_NM)
+    {
+        const float excess = outer_motor_torque_request - MAX_TORQUE_REQUEST_NM;
+        motor_torque_requests.left -= excess;
+        motor_torque_requests.right -= excess;
+    }
+
+    return motor_torque_requests;
+}
+
+struct TorqueVectoring *
+    App_TorqueVectoring_Create(uint32_t (*const get_cycle_count)(void))
+{
+    struct TorqueVectoring *torque_vectoring =
+        malloc(sizeof(struct TorqueVectoring));
+    assert(torque_vectoring != NULL);
+
+    torque_vectoring->get_cycle_count              = get_cycle_count;
+    torque_vectoring->max_torque_allocation_cycles = 0U;
+    App_TorqueVectoring_Reset(torque_vectoring);
+
+    return torque_vectoring;
+}
+
+void App_TorqueVectoring_Destroy(struct TorqueVectoring *torque_vectoring)
+{
+    free(torque_vectoring);
+}
+
+struct MotorTorqueRequests App_TorqueVectoring_AllocateTorqueRequest(
+    struct TorqueVectoring *const torque_vectoring,
+    const float                   torque_request,
+    const float                   steering_angle,
+    const float                   vehicle_speed_kph,
+    const float                   yaw_rate)
+{
+    const uint32_t start_cycles = torque_vectoring->get_cycle_count();
+    const struct MotorTorqueRequests motor_torque_requests =
+        App_AllocateTorqueRequest(
+            torque_vectoring, torque_request, steering_angle, vehicle_speed_kph,
+            yaw_rate);
+    const uint32_t elapsed_cycles =
+        torque_vectoring->get_cycle_count() - start_cycles;
+
+    if (elapsed_cycles > torque_vectoring->max_torque_allocation_cycles)
+    {
+        torque_vectoring->max_torque_allocation_cycles = elapsed_cycles;
+    }
+
+    return motor_torque_requests;
+}
+
+void App_TorqueVectoring_Reset(struct TorqueVectoring *const torque_vectoring)
+{
+    torque_vectoring->reference_yaw_rate = 0.0f;
+}
+
+float App_TorqueVectoring_GetReferenceYawRate(
+    const struct TorqueVectoring *const torque_vectoring)
+{
+    return torque_vectoring->reference_yaw_rate;
+}
+
+uint32_t App_TorqueVectoring_TakeMaxTorqueAllocationCycles(
+    struct TorqueVectoring *const torque_vectoring)
+{
+    const uint32_t max_torque_allocation_cycles =
+        torque_vectoring->max_torque_allocation_cycles;
+    torque_vectoring->max_torque_allocation_cycles = 0U;
+
+    return max_torque_allocation_cycles;
+}
@@ -0,0 +1,174 @@
+#include <stdlib.h>
+#include <assert.h>
+
+#include "App_TractionControl.h"
+#include "configs/App_TractionControlConfig.h"
+
+#define KPH_PER_MPS 3.6f
+
+struct TractionControl
+{
+    bool  is_vehicle_speed_initialized;
+    float vehicle_speed_kph;
+    float slip_ratio;
+
+    // The torque is only cut once the slip ratio has exceeded the target, and
+    // until the cut torque is over the torque request again
+    bool  is_active;
+    float slip_ratio_error_integral;
+};
+
+/**
+ * Stop cutting the torque request, which resets the integral of the slip ratio
+ * over the target
+ * @param traction_control The traction control to stop cutting torque with
+ */
+static void App_StopCuttingTorque(struct TractionControl *traction_control);
+
+static void
+    App_StopCuttingTorque(struct TractionControl *const traction_control)
+{
+    traction_control->is_active                 = false;
+    traction_control->slip_ratio_error_integral = 0.0f;
+}
+
+struct TractionControl *App_TractionControl_Create(void)
+{
+    struct TractionControl *traction_control =
+        malloc(sizeof(struct TractionControl));
+    assert(traction_control != NULL);
+
+    traction_control->vehicle_speed_kph = 0.0f;
+    traction_control->slip_ratio        = 0.0f;
+    App_TractionControl_Reset(traction_control);
+
+    return traction_control;
+}
+
+void App_TractionControl_Destroy(struct TractionControl *traction_control)
+{
+    free(traction_control);
+}
+
+float App_TractionControl_LimitTorqueRequest(
+    struct TractionControl *const traction_control,
+    const float                   torque_request,
+    const float                   front_wheel_speed_kph,
+    const float                   driven_wheel_speed_kph,
+    const float                   acceleration)
+{
+    // Integrate the acceleration for a smooth vehicle speed between wheel speed
+    // updates, and correct its drift towards the front wheel speed
+    if (!traction_control->is_vehicle_speed_initialized)
+    {
+        traction_control->vehicle_speed_kph            = front_wheel_speed_kph;
+        traction_control->is_vehicle_speed_initialized = true;
+    }
+    else
+    {
+        traction_control->vehicle_speed_kph +=
+            KPH_PER_MPS * acceleration * TRACTION_CONTROL_PERIOD_S;
+        traction_control->vehicle_speed_kph +=
+            TRACTION_CONTROL_WHEEL_SPEED_FUSION_GAIN *
+            (front_wheel_speed_kph - traction_control->vehicle_speed_kph);
+    }
+
+    if (traction_control->vehicle_speed_kph < 0.0f)
+    {
+        traction_control->vehicle_speed_kph = 0.0f;
+    }
+
+    const float reference_speed_kph =
+        traction_control->vehicle_speed_kph >
+                TRACTION_CONTROL_MIN_VEHICLE_SPEED_KPH
+            ? traction_control->vehicle_speed_kph
+            : TRACTION_CONTROL_MIN_VEHICLE_SPEED_KPH;
+    traction_control->slip_ratio =
+        (driven_wheel_speed_kph - traction_control->vehicle_speed_kph) /
+        reference_speed_kph;
+
+    if (torque_request <= 0.0f)
+    {
+        App_StopCuttingTorque(traction_control);
+        return torque_request;
+    }
+
+    const float slip_ratio_error =
+        traction_control->slip_ratio - TRACTION_CONTROL_TARGET_SLIP_RATIO;
+
+    if (!traction_control->is_active)
+    {
+        if (slip_ratio_error <= 0.0f)
+        {
+            return torque_request;
+        }
+
+        traction_control->is_active = true;
+    }
+
+    // The integral needs no bound: it stops growing once the torque is fully
+    // cut, and is reset once the torque is no longer cut
+    const float slip_ratio_error_integral =
+        traction_control->slip_ratio_error_integral +
+        slip_ratio_error * TRACTION_CONTROL_PERIOD_S;
+
+    // The tyres can transmit at least the torque that accelerates the vehicle
+    // at its measured acceleration, and the PI terms cut the torque below that
+    // for as long as the wheels spin past the target slip ratio
+    const float feed_forward_torque =
+        TRACTION_CONTROL_VEHICLE_MASS_KG * acceleration *
+        TRACTION_CONTROL_WHEEL_RADIUS_M /
+        (TRACTION_CONTROL_GEAR_RATIO * TRACTION_CONTROL_NUM_MOTORS);
+    float torque_limit =
+        feed_forward_torque -
+        TRACTION_CONTROL_PROPORTIONAL_GAIN_NM * slip_ratio_error -
+        TRACTION_CONTROL_INTEGRAL_GAIN_NM_PER_S * slip_ratio_error_integral;
+
+    if (torque_limit >= torque_request)
+    {
+        App_StopCuttingTorque(traction_control);
+        return torque_request;
+    }
+
+    if (torque_limit <= 0.0f)
+    {
+        torque_limit = 0.0f;
+
+        // Stop integrating while the torque is fully cut, so that the torque
+        // comes back as soon as the wheels stop spinning
+        if (slip_ratio_error > 0.0f)
+        {
+            return torque_limit;
+        }
+    }
+
+    traction_control->slip_ratio_error_integral = slip_ratio_error_integral;
+
+    return torque_limit;
+}
+
+void App_TractionControl_Reset(struct TractionControl *const traction_control)
+{
+    // The vehicle speed isn't estimated while reset, so restart the estimate
+    // from the front wheel speed
+    traction_control->is_vehicle_speed_initialized = false;
+    App_StopCuttingTorque(traction_control);
+}
+
+float App_TractionControl_GetVehicleSpeedKph(
+    const struct TractionControl *const traction_control)
+{
+    return traction_control->vehicle_speed_kph;
+}
+
+float App_TractionControl_GetSlipRatio(
+    const struct TractionControl *const traction_control)
+{
+    return traction_control->slip_ratio;
+}
+
+bool App_TractionControl_IsActive(
+    const struct TractionControl *const traction_control)
+{
+    return traction_control->is_active;
+}
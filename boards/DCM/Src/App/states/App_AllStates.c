@@ -1,4 +1,5 @@
 #include "states/App_AllStates.h"
+#include "App_SetPeriodicCanSignals.h"
 
 void App_AllStatesRunOnTick1Hz(struct StateMachine *const state_machine)
 {
@@ -7,6 +8,8 @@ void App_AllStatesRunOnTick1Hz(struct StateMachine *const state_machine)
         App_DcmWorld_GetRgbLedSequence(world);
 
     App_SharedRgbLedSequence_Tick(rgb_led_sequence);
+    App_SetPeriodicCanSignals_ImuSensorFusionBenchmark(world);
+    App_SetPeriodicCanSignals_TorqueVectoringBenchmark(world);
 }
 
 void App_AllStatesRunOnTick100Hz(struct StateMachine *const state_machine)
@@ -24,3 +27,22 @@ void App_AllStatesRunOnTick100Hz(struct StateMachine *const state_machine)
     App_BrakeLight_SetLightStatus(
         brake_light, is_brake_actuated, is_regen_active);
 }
+
+void App_AllStatesRunOnTick1kHz(struct StateMachine *const state_machine)
+{
+    struct DcmWorld *world = App_SharedStateMachine_GetWorld(state_machine);
+    struct Imu *     imu   = App_DcmWorld_GetImu(world);
+    struct Clock *   clock = App_DcmWorld_GetClock(world);
+
+    // The sensor fusion runs in every state, so that the gyroscope bias is
+    // estimated while the vehicle waits to drive
+    App_Imu_UpdateSensorFusion(imu);
+
+    // The inverters disable their power stage if the setpoints stop, so they
+    // are commanded in every state
+    const uint32_t current_time_ms =
+        App_SharedClock_GetCurrentTimeInMilliseconds(clock);
+    App_Inverter_Tick(App_DcmWorld_GetLeftInverter(world), current_time_ms);
+    App_Inverter_Tick(App_DcmWorld_GetRightInverter(world), current_time_ms);
+    App_SetPeriodicCanSignals_Inverters(world);
+}
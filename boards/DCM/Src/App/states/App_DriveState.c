@@ -1,7 +1,9 @@
 #include "states/App_AllStates.h"
 #include "states/App_DriveState.h"
 #include "states/App_InitState.h"
+#include "states/App_LaunchControlState.h"
 #include "App_SetPeriodicCanSignals.h"
+#include "configs/App_LaunchControlConfig.h"
 
 #include "App_SharedMacros.h"
 
@@ -9,9 +11,19 @@ static void DriveStateRunOnEntry(struct StateMachine *const state_machine)
 {
     struct DcmWorld *world = App_SharedStateMachine_GetWorld(state_machine);
     struct DcmCanTxInterface *can_tx_interface = App_DcmWorld_GetCanTx(world);
+    struct LaunchControl *launch_control = App_DcmWorld_GetLaunchControl(world);
 
-    struct Buzzer *buzzer = App_DcmWorld_GetBuzzer(world);
-    App_Buzzer_TurnOn(buzzer);
+    // A launch hands the torque request back to the drive state once it is
+    // over, which doesn't sound the buzzer again
+    const enum LaunchControlStatus launch_control_status =
+        App_LaunchControl_GetStatus(launch_control);
+    if (launch_control_status != LAUNCH_CONTROL_COMPLETE &&
+        launch_control_status != LAUNCH_CONTROL_ABORTED)
+    {
+        struct Buzzer *buzzer = App_DcmWorld_GetBuzzer(world);
+        App_Buzzer_TurnOn(buzzer);
+    }
+    App_LaunchControl_Disable(launch_control);
 
     App_CanTx_SetPeriodicSignal_STATE(
         can_tx_interface, CANMSGS_DCM_STATE_MACHINE_STATE_DRIVE_CHOICE);
@@ -36,6 +48,35 @@ static void DriveStateRunOnTick100Hz(struct StateMachine *const state_machine)
     }
 
     App_SetPeriodicCanSignals_Imu(world);
+}
+
+static void DriveStateRunOnTick1kHz(struct StateMachine *const state_machine)
+{
+    App_AllStatesRunOnTick1kHz(state_machine);
+
+    struct DcmWorld *world = App_SharedStateMachine_GetWorld(state_machine);
+    struct DcmCanRxInterface *can_rx     = App_DcmWorld_GetCanRx(world);
+    struct LaunchControl *launch_control = App_DcmWorld_GetLaunchControl(world);
+
+    // Launch control is armed by holding the brake with the vehicle stationary
+    const bool is_vehicle_stationary =
+        App_CanRx_FSM_WHEEL_SPEED_SENSOR_GetSignal_LEFT_WHEEL_SPEED(can_rx) <
+            LAUNCH_CONTROL_MAX_STATIONARY_SPEED_KPH &&
+        App_CanRx_FSM_WHEEL_SPEED_SENSOR_GetSignal_RIGHT_WHEEL_SPEED(can_rx) <
+            LAUNCH_CONTROL_MAX_STATIONARY_SPEED_KPH;
+    const bool is_launch_control_armed = App_LaunchControl_UpdateArming(
+        launch_control,
+        App_LaunchControlState_IsSelected(world) && is_vehicle_stationary &&
+            App_CanRx_FSM_BRAKE_GetSignal_BRAKE_IS_ACTUATED(can_rx));
+
+    if (is_launch_control_armed)
+    {
+        App_SharedStateMachine_SetNextState(
+            state_machine, App_GetLaunchControlState());
+    }
+
+    // Traction control reacts to wheel spin within a tick, so the torque
+    // request is updated at the highest rate available
     App_SetPeriodicCanSignals_TorqueRequests(world);
 }
 
@@ -51,6 +92,7 @@ const struct State *App_GetDriveState(void)
         .run_on_entry      = DriveStateRunOnEntry,
         .run_on_tick_1Hz   = DriveStateRunOnTick1Hz,
         .run_on_tick_100Hz = DriveStateRunOnTick100Hz,
+        .run_on_tick_1kHz  = DriveStateRunOnTick1kHz,
         .run_on_exit       = DriveStateRunOnExit,
     };
 
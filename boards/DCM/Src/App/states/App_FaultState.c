@@ -8,8 +8,15 @@ static void FaultStateRunOnEntry(struct StateMachine *const state_machine)
 {
     struct DcmWorld *world = App_SharedStateMachine_GetWorld(state_machine);
     struct DcmCanTxInterface *can_tx_interface = App_DcmWorld_GetCanTx(world);
+    struct Inverter *left_inverter  = App_DcmWorld_GetLeftInverter(world);
+    struct Inverter *right_inverter = App_DcmWorld_GetRightInverter(world);
+
     App_CanTx_SetPeriodicSignal_STATE(
         can_tx_interface, CANMSGS_DCM_STATE_MACHINE_STATE_FAULT_CHOICE);
+
+    // Stop commanding the motors before the next setpoint is sent
+    App_Inverter_SetTorqueSetpoint(left_inverter, 0.0f);
+    App_Inverter_SetTorqueSetpoint(right_inverter, 0.0f);
 }
 
 static void FaultStateRunOnTick1Hz(struct StateMachine *const state_machine)
@@ -36,6 +43,11 @@ static void FaultStateRunOnTick100Hz(struct StateMachine *const state_machine)
     }
 }
 
+static void FaultStateRunOnTick1kHz(struct StateMachine *const state_machine)
+{
+    App_AllStatesRunOnTick1kHz(state_machine);
+}
+
 static void FaultStateRunOnExit(struct StateMachine *const state_machine)
 {
     UNUSED(state_machine);
@@ -48,6 +60,7 @@ const struct State *App_GetFaultState(void)
         .run_on_entry      = FaultStateRunOnEntry,
         .run_on_tick_1Hz   = FaultStateRunOnTick1Hz,
         .run_on_tick_100Hz = FaultStateRunOnTick100Hz,
+        .run_on_tick_1kHz  = FaultStateRunOnTick1kHz,
         .run_on_exit       = FaultStateRunOnExit,
     };
 
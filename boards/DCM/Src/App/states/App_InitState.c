@@ -8,9 +8,15 @@ static void InitStateRunOnEntry(struct StateMachine *const state_machine)
 {
     struct DcmWorld *world = App_SharedStateMachine_GetWorld(state_machine);
     struct DcmCanTxInterface *can_tx_interface = App_DcmWorld_GetCanTx(world);
+    struct Inverter *left_inverter  = App_DcmWorld_GetLeftInverter(world);
+    struct Inverter *right_inverter = App_DcmWorld_GetRightInverter(world);
 
     App_CanTx_SetPeriodicSignal_STATE(
         can_tx_interface, CANMSGS_DCM_STATE_MACHINE_STATE_INIT_CHOICE);
+
+    // Stop commanding the motors before the next setpoint is sent
+    App_Inverter_SetTorqueSetpoint(left_inverter, 0.0f);
+    App_Inverter_SetTorqueSetpoint(right_inverter, 0.0f);
 }
 
 static void InitStateRunOnTick1Hz(struct StateMachine *const state_machine)
@@ -31,6 +37,11 @@ static void InitStateRunOnTick100Hz(struct StateMachine *const state_machine)
     App_SharedStateMachine_SetNextState(state_machine, App_GetDriveState());
 }
 
+static void InitStateRunOnTick1kHz(struct StateMachine *const state_machine)
+{
+    App_AllStatesRunOnTick1kHz(state_machine);
+}
+
 static void InitStateRunOnExit(struct StateMachine *const state_machine)
 {
     UNUSED(state_machine);
@@ -43,6 +54,7 @@ const struct State *App_GetInitState(void)
         .run_on_entry      = InitStateRunOnEntry,
         .run_on_tick_1Hz   = InitStateRunOnTick1Hz,
         .run_on_tick_100Hz = InitStateRunOnTick100Hz,
+        .run_on_tick_1kHz  = InitStateRunOnTick1kHz,
         .run_on_exit       = InitStateRunOnExit,
     };
 
@@ -0,0 +1,102 @@
+#include "states/App_AllStates.h"
+#include "states/App_DriveState.h"
+#include "states/App_InitState.h"
+#include "states/App_LaunchControlState.h"
+#include "App_SetPeriodicCanSignals.h"
+#include "App_SharedMacros.h"
+#include "configs/App_LaunchControlConfig.h"
+
+static void
+    LaunchControlStateRunOnEntry(struct StateMachine *const state_machine)
+{
+    struct DcmWorld *world = App_SharedStateMachine_GetWorld(state_machine);
+    struct DcmCanTxInterface *can_tx_interface = App_DcmWorld_GetCanTx(world);
+    struct LaunchControl *launch_control = App_DcmWorld_GetLaunchControl(world);
+    struct Clock *        clock          = App_DcmWorld_GetClock(world);
+
+    App_CanTx_SetPeriodicSignal_STATE(
+        can_tx_interface,
+        CANMSGS_DCM_STATE_MACHINE_STATE_LAUNCH_CONTROL_CHOICE);
+
+    App_LaunchControl_Enable(
+        launch_control, App_SharedClock_GetCurrentTimeInMilliseconds(clock));
+}
+
+static void
+    LaunchControlStateRunOnTick1Hz(struct StateMachine *const state_machine)
+{
+    App_AllStatesRunOnTick1Hz(state_machine);
+}
+
+static void
+    LaunchControlStateRunOnTick100Hz(struct StateMachine *const state_machine)
+{
+    App_AllStatesRunOnTick100Hz(state_machine);
+
+    struct DcmWorld *world = App_SharedStateMachine_GetWorld(state_machine);
+    struct DcmCanRxInterface *can_rx = App_DcmWorld_GetCanRx(world);
+
+    if (App_CanRx_DIM_SWITCHES_GetSignal_START_SWITCH(can_rx) ==
+        CANMSGS_DIM_SWITCHES_START_SWITCH_OFF_CHOICE)
+    {
+        App_SharedStateMachine_SetNextState(state_machine, App_GetInitState());
+    }
+
+    App_SetPeriodicCanSignals_Imu(world);
+}
+
+static void
+    LaunchControlStateRunOnTick1kHz(struct StateMachine *const state_machine)
+{
+    App_AllStatesRunOnTick1kHz(state_machine);
+
+    struct DcmWorld *world = App_SharedStateMachine_GetWorld(state_machine);
+    struct DcmCanRxInterface *can_rx     = App_DcmWorld_GetCanRx(world);
+    struct LaunchControl *launch_control = App_DcmWorld_GetLaunchControl(world);
+    struct Clock *        clock          = App_DcmWorld_GetClock(world);
+
+    const enum LaunchControlStatus status = App_LaunchControl_Tick(
+        launch_control, App_LaunchControlState_IsSelected(world),
+        App_CanRx_FSM_BRAKE_GetSignal_BRAKE_IS_ACTUATED(can_rx),
+        App_CanRx_FSM_PEDAL_POSITION_GetSignal_MAPPED_PEDAL_PERCENTAGE(can_rx),
+        App_SharedClock_GetCurrentTimeInMilliseconds(clock));
+
+    // Traction control keeps running when the torque profile is complete, so
+    // the drive state takes over the torque request without a step
+    if (status == LAUNCH_CONTROL_COMPLETE || status == LAUNCH_CONTROL_ABORTED)
+    {
+        App_SharedStateMachine_SetNextState(state_machine, App_GetDriveState());
+    }
+
+    App_SetPeriodicCanSignals_TorqueRequests(world);
+}
+
+static void
+    LaunchControlStateRunOnExit(struct StateMachine *const state_machine)
+{
+    UNUSED(state_machine);
+}
+
+const struct State *App_GetLaunchControlState(void)
+{
+    static struct State launch_control_state = {
+        .name              = "LAUNCH_CONTROL",
+        .run_on_entry      = LaunchControlStateRunOnEntry,
+        .run_on_tick_1Hz   = LaunchControlStateRunOnTick1Hz,
+        .run_on_tick_100Hz = LaunchControlStateRunOnTick100Hz,
+        .run_on_tick_1kHz  = LaunchControlStateRunOnTick1kHz,
+        .run_on_exit       = LaunchControlStateRunOnExit,
+    };
+
+    return &launch_control_state;
+}
+
+bool App_LaunchControlState_IsSelected(const struct DcmWorld *const world)
+{
+    struct DcmCanRxInterface *can_rx = App_DcmWorld_GetCanRx(world);
+
+    return App_CanRx_DIM_DRIVE_MODE_SWITCH_GetSignal_DRIVE_MODE(can_rx) ==
+               LAUNCH_CONTROL_DRIVE_MODE &&
+           App_CanRx_DIM_SWITCHES_GetSignal_TRACTION_CONTROL_SWITCH(can_rx) ==
+               CANMSGS_DIM_SWITCHES_TRACTION_CONTROL_SWITCH_ON_CHOICE;
+}
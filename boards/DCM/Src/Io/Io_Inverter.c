@@ -0,0 +1,21 @@
+#include <assert.h>
+#include <string.h>
+
+#include "Io_Inverter.h"
+#include "Io_SharedCan.h"
+
+void Io_Inverter_Transmit(
+    const uint32_t       std_id,
+    const uint8_t *const data,
+    const uint32_t       dlc)
+{
+    struct CanMsg message;
+
+    assert(dlc <= sizeof(message.data));
+
+    message.std_id = std_id;
+    message.dlc    = dlc;
+    memcpy(message.data, data, dlc);
+
+    Io_SharedCan_TxMessageQueueSendtoBack(&message);
+}
@@ -1,26 +1,422 @@
+#include <assert.h>
+#include <stddef.h>
+#include <FreeRTOS.h>
+#include <task.h>
+#include "main.h"
 #include "Io_LSM6DS33.h"
+#include "Io_SharedCycleCounter.h"
+#include "Io_SharedFreeRTOS.h"
+#include "App_ImuFifo.h"
 
-struct LSM6DS33
+// The I2C address of the Imu with SA0 pulled high, shifted for the HAL
+#define IMU_I2C_ADDRESS (0x6BU << 1U)
+#define IMU_I2C_TIMEOUT_MS 10U
+
+// How long the FIFO is read without a watermark interrupt before it is checked
+// for being stalled at its watermark, in ms. This is well before the FIFO
+// overruns.
+#define IMU_FIFO_STALL_TIMEOUT_MS 10U
+
+#define FIFO_CTRL1 0x06U
+#define FIFO_CTRL2 0x07U
+#define FIFO_CTRL3 0x08U
+#define FIFO_CTRL4 0x09U
+#define FIFO_CTRL5 0x0AU
+#define INT1_CTRL 0x0DU
+#define WHO_AM_I 0x0FU
+#define CTRL1_XL 0x10U
+#define CTRL2_G 0x11U
+#define CTRL3_C 0x12U
+#define CTRL4_C 0x13U
+#define FIFO_STATUS1 0x3AU
+#define FIFO_DATA_OUT_L 0x3EU
+
+#define WHO_AM_I_VALUE 0x69U
+#define CTRL3_C_SW_RESET 0x01U
+#define FIFO_STATUS2_DIFF_FIFO_MASK 0x0FU
+#define FIFO_STATUS4_FIFO_PATTERN_MASK 0x03U
+
+// The accelerometer, gyroscope and FIFO all run at 833Hz
+#define SAMPLE_PERIOD_US (1000000.0f / 833.0f)
+
+// 0.122mg/LSB at +/-4g, and 17.5mdps/LSB at 500dps
+#define ACCELERATION_SENSITIVITY (0.122e-3f * 9.80665f)
+#define ANGULAR_VELOCITY_SENSITIVITY (17.5e-3f * 3.14159265f / 180.0f)
+
+// INT1 fires every FIFO_WATERMARK samples, i.e. at ~200Hz, which batches the
+// samples while keeping the newest one at most ~5ms old
+#define FIFO_WATERMARK 4U
+#define FIFO_WATERMARK_WORDS (FIFO_WATERMARK * IMU_FIFO_WORDS_PER_SAMPLE)
+
+// The most samples read in one burst. Samples left behind are read by the next
+// burst.
+#define MAX_SAMPLES_PER_BURST 16U
+
+struct RegisterValue
 {
-    // Acceleration in m/s^2
-    float accel_x;
-    float accel_y;
-    float accel_z;
+    uint8_t address;
+    uint8_t value;
+};
+
+// Written in order after a software reset. The FIFO is only switched to
+// continuous mode once both sensors are configured.
+static const struct RegisterValue register_values[] = {
+    // Block data update, and auto-increment the register address in bursts
+    { CTRL3_C, 0x44U },
+    // Use the anti-aliasing filter bandwidth set in CTRL1_XL
+    { CTRL4_C, 0x80U },
+    { FIFO_CTRL1, (uint8_t)(FIFO_WATERMARK_WORDS & 0xFFU) },
+    { FIFO_CTRL2, (uint8_t)(FIFO_WATERMARK_WORDS >> 8U) },
+    // Store every gyroscope and accelerometer sample without decimation
+    { FIFO_CTRL3, 0x09U },
+    { FIFO_CTRL4, 0x00U },
+    // Route the FIFO threshold to INT1
+    { INT1_CTRL, 0x08U },
+    // Accelerometer at 833Hz, +/-4g, with a 200Hz anti-aliasing filter
+    { CTRL1_XL, 0x79U },
+    // Gyroscope at 833Hz, 500dps
+    { CTRL2_G, 0x74U },
+    // FIFO at 833Hz, in continuous mode
+    { FIFO_CTRL5, 0x3EU },
 };
 
-static struct LSM6DS33 lsm_6ds33;
+static I2C_HandleTypeDef *_hi2c    = NULL;
+static struct ImuFifo *   imu_fifo = NULL;
+
+// Given by the watermark interrupt, and by the I2C interrupts once a transfer
+// completes or fails. The bursts are only ever started from the task.
+static struct StaticSemaphore watermark_semaphore = {
+    .handle  = NULL,
+    .storage = { { 0 } },
+};
+static struct StaticSemaphore transfer_semaphore = {
+    .handle  = NULL,
+    .storage = { { 0 } },
+};
+
+// The time of the last watermark interrupt, and whether the last transfer
+// completed without error
+static volatile uint32_t watermark_time_us;
+static volatile bool     is_transfer_ok;
+
+// FIFO_STATUS1 to FIFO_STATUS4
+static uint8_t fifo_status[4];
+
+// A burst starts with the words that are skipped to align it to a sample
+static uint8_t fifo_data
+    [(IMU_FIFO_WORDS_PER_SAMPLE - 1U) * 2U +
+     MAX_SAMPLES_PER_BURST * IMU_FIFO_BYTES_PER_SAMPLE];
+
+// The cycle counter wraps around after ~60s, so it is accumulated into a time
+// in us that wraps around after ~70 minutes
+static uint32_t last_cycles;
+static uint32_t remainder_cycles;
+static uint32_t current_time_us;
+
+/**
+ * Get the current time from the cycle counter
+ * @note This must be called at least once per wraparound of the cycle counter,
+ *       and never from two contexts at once
+ * @return The current time, in us
+ */
+static uint32_t Io_GetCurrentTimeUs(void);
+
+/**
+ * Read consecutive registers of the Imu, sleeping while the data is
+ * transferred with DMA
+ * @note This must only be called from the task reading the FIFO
+ * @param address The address of the first register to read
+ * @param data The buffer to read the registers into
+ * @param size The number of registers to read
+ * @return true if the registers were read, else false
+ */
+static bool Io_ReadRegisters(uint8_t address, uint8_t *data, uint16_t size);
+
+static uint32_t Io_GetCurrentTimeUs(void)
+{
+    const uint32_t cycles_per_us = SystemCoreClock / 1000000U;
+    const uint32_t cycles        = Io_SharedCycleCounter_GetCycleCount();
+
+    remainder_cycles += cycles - last_cycles;
+    last_cycles = cycles;
+
+    current_time_us += remainder_cycles / cycles_per_us;
+    remainder_cycles %= cycles_per_us;
+
+    return current_time_us;
+}
+
+static bool Io_ReadRegisters(
+    const uint8_t  address,
+    uint8_t *const data,
+    const uint16_t size)
+{
+    // Drop the completion of a transfer that timed out before
+    xSemaphoreTake(transfer_semaphore.handle, 0U);
+
+    // The register address is sent in blocking mode, which takes a few tens of
+    // us, and only the data phase is transferred with DMA
+    if (HAL_I2C_Mem_Read_DMA(
+            _hi2c, IMU_I2C_ADDRESS, address, I2C_MEMADD_SIZE_8BIT, data,
+            size) != HAL_OK)
+    {
+        return false;
+    }
+
+    if (xSemaphoreTake(
+            transfer_semaphore.handle, pdMS_TO_TICKS(IMU_I2C_TIMEOUT_MS)) !=
+        pdTRUE)
+    {
+        HAL_I2C_Master_Abort_IT(_hi2c, IMU_I2C_ADDRESS);
+        return false;
+    }
+
+    return is_transfer_ok;
+}
+
+ExitCode Io_LSM6DS33_Init(I2C_HandleTypeDef *const hi2c)
+{
+    assert(hi2c != NULL);
+
+    if (imu_fifo == NULL)
+    {
+        imu_fifo = App_ImuFifo_Create(
+            ACCELERATION_SENSITIVITY, ANGULAR_VELOCITY_SENSITIVITY,
+            SAMPLE_PERIOD_US, FIFO_WATERMARK);
+
+        watermark_semaphore.handle =
+            xSemaphoreCreateBinaryStatic(&watermark_semaphore.storage);
+        assert(watermark_semaphore.handle != NULL);
+
+        transfer_semaphore.handle =
+            xSemaphoreCreateBinaryStatic(&transfer_semaphore.storage);
+        assert(transfer_semaphore.handle != NULL);
+    }
+
+    last_cycles = Io_SharedCycleCounter_GetCycleCount();
+
+    uint8_t who_am_i = 0U;
+    if (HAL_I2C_Mem_Read(
+            hi2c, IMU_I2C_ADDRESS, WHO_AM_I, I2C_MEMADD_SIZE_8BIT, &who_am_i,
+            1U, IMU_I2C_TIMEOUT_MS) != HAL_OK)
+    {
+        return EXIT_CODE_TIMEOUT;
+    }
+
+    if (who_am_i != WHO_AM_I_VALUE)
+    {
+        return EXIT_CODE_ERROR;
+    }
+
+    // Reset the registers and the FIFO, and wait for the reset to finish
+    uint8_t ctrl3_c = CTRL3_C_SW_RESET;
+    if (HAL_I2C_Mem_Write(
+            hi2c, IMU_I2C_ADDRESS, CTRL3_C, I2C_MEMADD_SIZE_8BIT, &ctrl3_c, 1U,
+            IMU_I2C_TIMEOUT_MS) != HAL_OK)
+    {
+        return EXIT_CODE_TIMEOUT;
+    }
+
+    const uint32_t reset_start_ms = HAL_GetTick();
+    while ((ctrl3_c & CTRL3_C_SW_RESET) != 0U)
+    {
+        if (HAL_GetTick() - reset_start_ms > IMU_I2C_TIMEOUT_MS ||
+            HAL_I2C_Mem_Read(
+                hi2c, IMU_I2C_ADDRESS, CTRL3_C, I2C_MEMADD_SIZE_8BIT, &ctrl3_c,
+                1U, IMU_I2C_TIMEOUT_MS) != HAL_OK)
+        {
+            return EXIT_CODE_TIMEOUT;
+        }
+    }
+
+    for (size_t i = 0U;
+         i < sizeof(register_values) / sizeof(register_values[0]); i++)
+    {
+        uint8_t value = register_values[i].value;
+
+        if (HAL_I2C_Mem_Write(
+                hi2c, IMU_I2C_ADDRESS, register_values[i].address,
+                I2C_MEMADD_SIZE_8BIT, &value, 1U, IMU_I2C_TIMEOUT_MS) != HAL_OK)
+        {
+            return EXIT_CODE_TIMEOUT;
+        }
+    }
+
+    // Only read bursts once the Imu is configured
+    _hi2c = hi2c;
+
+    return EXIT_CODE_OK;
+}
+
+float Io_LSM6DS33_GetAccelerationX(void)
+{
+    return App_ImuFifo_GetAcceleration(imu_fifo, IMU_AXIS_X);
+}
+
+float Io_LSM6DS33_GetAccelerationY(void)
+{
+    return App_ImuFifo_GetAcceleration(imu_fifo, IMU_AXIS_Y);
+}
+
+float Io_LSM6DS33_GetAccelerationZ(void)
+{
+    return App_ImuFifo_GetAcceleration(imu_fifo, IMU_AXIS_Z);
+}
+
+float Io_LSM6DS33_GetFilteredAccelerationX(void)
+{
+    return App_ImuFifo_GetFilteredAcceleration(imu_fifo, IMU_AXIS_X);
+}
+
+float Io_LSM6DS33_GetFilteredAccelerationY(void)
+{
+    return App_ImuFifo_GetFilteredAcceleration(imu_fifo, IMU_AXIS_Y);
+}
+
+float Io_LSM6DS33_GetFilteredAccelerationZ(void)
+{
+    return App_ImuFifo_GetFilteredAcceleration(imu_fifo, IMU_AXIS_Z);
+}
+
+float Io_LSM6DS33_GetAngularVelocityX(void)
+{
+    return App_ImuFifo_GetAngularVelocity(imu_fifo, IMU_AXIS_X);
+}
+
+float Io_LSM6DS33_GetAngularVelocityY(void)
+{
+    return App_ImuFifo_GetAngularVelocity(imu_fifo, IMU_AXIS_Y);
+}
+
+float Io_LSM6DS33_GetAngularVelocityZ(void)
+{
+    return App_ImuFifo_GetAngularVelocity(imu_fifo, IMU_AXIS_Z);
+}
 
-float Io_LSM6DS33_GetAccelerationX()
+void Io_LSM6DS33_ReadFifoFromTask(void)
 {
-    return lsm_6ds33.accel_x;
+    uint32_t burst_watermark_time_us;
+
+    if (xSemaphoreTake(
+            watermark_semaphore.handle,
+            pdMS_TO_TICKS(IMU_FIFO_STALL_TIMEOUT_MS)) == pdTRUE)
+    {
+        burst_watermark_time_us = watermark_time_us;
+    }
+    else
+    {
+        // INT1 only interrupts on its rising edge, so it doesn't fire again
+        // after an I2C error, or after a burst left a full watermark of samples
+        // behind
+        if (_hi2c == NULL ||
+            HAL_GPIO_ReadPin(IMU_PIN_1_GPIO_Port, IMU_PIN_1_Pin) !=
+                GPIO_PIN_SET)
+        {
+            return;
+        }
+
+        // The watermark interrupt fired at some point before now, so the
+        // samples of this burst are timestamped late. The sample period
+        // measured for this burst is then likely to be rejected as out of
+        // tolerance.
+        taskENTER_CRITICAL();
+        burst_watermark_time_us = Io_GetCurrentTimeUs();
+        taskEXIT_CRITICAL();
+    }
+
+    if (!Io_ReadRegisters(FIFO_STATUS1, fifo_status, sizeof(fifo_status)))
+    {
+        return;
+    }
+
+    const uint32_t num_words =
+        (uint32_t)fifo_status[0] |
+        ((uint32_t)(fifo_status[1] & FIFO_STATUS2_DIFF_FIFO_MASK) << 8U);
+
+    // The pattern is the index of the next word within a sample. It is only
+    // non-zero after the FIFO overran, in which case the words up to the start
+    // of the next sample are skipped.
+    const uint32_t pattern =
+        (uint32_t)fifo_status[2] |
+        ((uint32_t)(fifo_status[3] & FIFO_STATUS4_FIFO_PATTERN_MASK) << 8U);
+
+    const uint32_t num_skipped_words =
+        (IMU_FIFO_WORDS_PER_SAMPLE - pattern % IMU_FIFO_WORDS_PER_SAMPLE) %
+        IMU_FIFO_WORDS_PER_SAMPLE;
+    uint32_t num_samples =
+        num_words > num_skipped_words
+            ? (num_words - num_skipped_words) / IMU_FIFO_WORDS_PER_SAMPLE
+            : 0U;
+
+    if (num_samples > MAX_SAMPLES_PER_BURST)
+    {
+        num_samples = MAX_SAMPLES_PER_BURST;
+    }
+
+    if (num_samples == 0U)
+    {
+        return;
+    }
+
+    // The register address wraps around from FIFO_DATA_OUT_H to
+    // FIFO_DATA_OUT_L, so every sample is read in a single burst
+    if (!Io_ReadRegisters(
+            FIFO_DATA_OUT_L, fifo_data,
+            (uint16_t)(
+                num_skipped_words * 2U +
+                num_samples * IMU_FIFO_BYTES_PER_SAMPLE)))
+    {
+        return;
+    }
+
+    App_ImuFifo_ProcessBurst(
+        imu_fifo, &fifo_data[num_skipped_words * 2U], num_samples,
+        burst_watermark_time_us);
 }
 
-float Io_LSM6DS33_GetAccelerationY()
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
 {
-    return lsm_6ds33.accel_y;
+    if (GPIO_Pin != IMU_PIN_1_Pin || _hi2c == NULL)
+    {
+        return;
+    }
+
+    // A watermark that fires while a burst is being read is read by the next
+    // burst, with the time of the latest watermark
+    watermark_time_us = Io_GetCurrentTimeUs();
+
+    BaseType_t is_higher_priority_task_woken = pdFALSE;
+    xSemaphoreGiveFromISR(
+        watermark_semaphore.handle, &is_higher_priority_task_woken);
+    portYIELD_FROM_ISR(is_higher_priority_task_woken);
 }
 
-float Io_LSM6DS33_GetAccelerationZ()
+void HAL_I2C_MemRxCpltCallback(I2C_HandleTypeDef *hi2c)
 {
-    return lsm_6ds33.accel_z;
+    if (hi2c != _hi2c)
+    {
+        return;
+    }
+
+    is_transfer_ok = true;
+
+    BaseType_t is_higher_priority_task_woken = pdFALSE;
+    xSemaphoreGiveFromISR(
+        transfer_semaphore.handle, &is_higher_priority_task_woken);
+    portYIELD_FROM_ISR(is_higher_priority_task_woken);
+}
+
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c)
+{
+    if (hi2c != _hi2c)
+    {
+        return;
+    }
+
+    is_transfer_ok = false;
+
+    BaseType_t is_higher_priority_task_woken = pdFALSE;
+    xSemaphoreGiveFromISR(
+        transfer_semaphore.handle, &is_higher_priority_task_woken);
+    portYIELD_FROM_ISR(is_higher_priority_task_woken);
 }
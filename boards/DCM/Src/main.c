@@ -38,12 +38,16 @@
 #include "Io_BrakeLight.h"
 #include "Io_Buzzer.h"
 #include "Io_LSM6DS33.h"
+#include "Io_SharedCycleCounter.h"
+#include "Io_Inverter.h"
 
 #include "App_DcmWorld.h"
 #include "App_SharedStateMachine.h"
 #include "states/App_InitState.h"
 #include "configs/App_HeartbeatMonitorConfig.h"
 #include "configs/App_AccelerationThresholds.h"
+#include "configs/App_InverterConfig.h"
+#include "configs/App_PowerLimiterConfig.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -66,6 +70,9 @@ ADC_HandleTypeDef hadc1;
 
 CAN_HandleTypeDef hcan;
 
+I2C_HandleTypeDef hi2c1;
+DMA_HandleTypeDef hdma_i2c1_rx;
+
 IWDG_HandleTypeDef hiwdg;
 
 osThreadId          Task1HzHandle;
@@ -83,6 +90,9 @@ osStaticThreadDef_t TaskCanTxControlBlock;
 osThreadId          Task100HzHandle;
 uint32_t            Task100HzBuffer[TASK100HZ_STACK_SIZE];
 osStaticThreadDef_t Task100HzControlBlock;
+osThreadId          TaskImuHandle;
+uint32_t            TaskImuBuffer[TASKIMU_STACK_SIZE];
+osStaticThreadDef_t TaskImuControlBlock;
 /* USER CODE BEGIN PV */
 struct DcmWorld *         world;
 struct StateMachine *     state_machine;
@@ -93,6 +103,12 @@ struct RgbLedSequence *   rgb_led_sequence;
 struct BrakeLight *       brake_light;
 struct Buzzer *           buzzer;
 struct Imu *              imu;
+struct TractionControl *  traction_control;
+struct TorqueVectoring *  torque_vectoring;
+struct LaunchControl *    launch_control;
+struct Inverter *         left_inverter;
+struct Inverter *         right_inverter;
+struct PowerLimiter *     power_limiter;
 struct ErrorTable *       error_table;
 struct Clock *            clock;
 /* USER CODE END PV */
@@ -100,14 +116,17 @@ struct Clock *            clock;
 /* Private function prototypes -----------------------------------------------*/
 void        SystemClock_Config(void);
 static void MX_GPIO_Init(void);
+static void MX_DMA_Init(void);
 static void MX_ADC1_Init(void);
 static void MX_CAN_Init(void);
 static void MX_IWDG_Init(void);
+static void MX_I2C1_Init(void);
 void        RunTask1Hz(void const *argument);
 void        RunTask1kHz(void const *argument);
 void        RunTaskCanRx(void const *argument);
 void        RunTaskCanTx(void const *argument);
 void        RunTask100Hz(void const *argument);
+void        RunTaskImu(void const *argument);
 
 /* USER CODE BEGIN PFP */
 
@@ -160,12 +179,18 @@ int main(void)
 
     /* Initialize all configured peripherals */
     MX_GPIO_Init();
+    MX_DMA_Init();
     MX_ADC1_Init();
     MX_CAN_Init();
     MX_IWDG_Init();
+    MX_I2C1_Init();
     /* USER CODE BEGIN 2 */
     __HAL_DBGMCU_FREEZE_IWDG();
     Io_SharedHardFaultHandler_Init();
+    Io_SharedCycleCounter_Init();
+
+    // Without the Imu, its accelerations and angular velocities stay at 0
+    Io_LSM6DS33_Init(&hi2c1);
 
     can_tx = App_CanTx_Create(
         Io_CanTx_EnqueueNonPeriodicMsg_DCM_STARTUP,
@@ -188,17 +213,38 @@ int main(void)
 
     imu = App_Imu_Create(
         Io_LSM6DS33_GetAccelerationX, Io_LSM6DS33_GetAccelerationY,
-        Io_LSM6DS33_GetAccelerationZ, MIN_ACCELERATION_MS2,
+        Io_LSM6DS33_GetAccelerationZ, Io_LSM6DS33_GetFilteredAccelerationX,
+        Io_LSM6DS33_GetFilteredAccelerationY,
+        Io_LSM6DS33_GetFilteredAccelerationZ, Io_LSM6DS33_GetAngularVelocityX,
+        Io_LSM6DS33_GetAngularVelocityY, Io_LSM6DS33_GetAngularVelocityZ,
+        Io_SharedCycleCounter_GetCycleCount, MIN_ACCELERATION_MS2,
         MAX_ACCELERATION_MS2);
 
+    traction_control = App_TractionControl_Create();
+
+    torque_vectoring =
+        App_TorqueVectoring_Create(Io_SharedCycleCounter_GetCycleCount);
+
+    launch_control = App_LaunchControl_Create();
+
+    left_inverter = App_Inverter_Create(
+        LEFT_INVERTER_COMMAND_STD_ID, LEFT_INVERTER_FEEDBACK_STD_ID,
+        Io_Inverter_Transmit);
+    right_inverter = App_Inverter_Create(
+        RIGHT_INVERTER_COMMAND_STD_ID, RIGHT_INVERTER_FEEDBACK_STD_ID,
+        Io_Inverter_Transmit);
+
+    power_limiter = App_PowerLimiter_Create(POWER_LIMITER_MAX_POWER_KW);
+
     error_table = App_SharedErrorTable_Create();
 
     clock = App_SharedClock_Create();
 
     world = App_DcmWorld_Create(
         can_tx, can_rx, heartbeat_monitor, rgb_led_sequence, brake_light,
-        buzzer, imu, error_table, clock, App_BuzzerSignals_IsOn,
-        App_BuzzerSignals_Callback);
+        buzzer, imu, traction_control, torque_vectoring, launch_control,
+        left_inverter, right_inverter, power_limiter, error_table, clock,
+        App_BuzzerSignals_IsOn, App_BuzzerSignals_Callback);
 
     Io_StackWaterMark_Init(can_tx);
     Io_SoftwareWatchdog_Init(can_tx);
@@ -256,6 +302,12 @@ int main(void)
         Task100HzBuffer, &Task100HzControlBlock);
     Task100HzHandle = osThreadCreate(osThread(Task100Hz), NULL);
 
+    /* definition and creation of TaskImu */
+    osThreadStaticDef(
+        TaskImu, RunTaskImu, osPriorityHigh, 0, TASKIMU_STACK_SIZE,
+        TaskImuBuffer, &TaskImuControlBlock);
+    TaskImuHandle = osThreadCreate(osThread(TaskImu), NULL);
+
     /* USER CODE BEGIN RTOS_THREADS */
     /* add threads, ... */
     // According to Percpio documentation, vTraceEnable() should be the last
@@ -319,8 +371,10 @@ void SystemClock_Config(void)
     {
         Error_Handler();
     }
-    PeriphClkInit.PeriphClockSelection = RCC_PERIPHCLK_ADC12;
-    PeriphClkInit.Adc12ClockSelection  = RCC_ADC12PLLCLK_DIV1;
+    PeriphClkInit.PeriphClockSelection =
+        RCC_PERIPHCLK_I2C1 | RCC_PERIPHCLK_ADC12;
+    PeriphClkInit.Adc12ClockSelection = RCC_ADC12PLLCLK_DIV1;
+    PeriphClkInit.I2c1ClockSelection  = RCC_I2C1CLKSOURCE_HSI;
     if (HAL_RCCEx_PeriphCLKConfig(&PeriphClkInit) != HAL_OK)
     {
         Error_Handler();
@@ -452,6 +506,64 @@ static void MX_IWDG_Init(void)
     /* USER CODE END IWDG_Init 2 */
 }
 
+/**
+ * @brief I2C1 Initialization Function
+ * @param None
+ * @retval None
+ */
+static void MX_I2C1_Init(void)
+{
+    /* USER CODE BEGIN I2C1_Init 0 */
+
+    /* USER CODE END I2C1_Init 0 */
+
+    /* USER CODE BEGIN I2C1_Init 1 */
+
+    /* USER CODE END I2C1_Init 1 */
+    hi2c1.Instance              = I2C1;
+    hi2c1.Init.Timing           = 0x00310309;
+    hi2c1.Init.OwnAddress1      = 0;
+    hi2c1.Init.AddressingMode   = I2C_ADDRESSINGMODE_7BIT;
+    hi2c1.Init.DualAddressMode  = I2C_DUALADDRESS_DISABLE;
+    hi2c1.Init.OwnAddress2      = 0;
+    hi2c1.Init.OwnAddress2Masks = I2C_OA2_NOMASK;
+    hi2c1.Init.GeneralCallMode  = I2C_GENERALCALL_DISABLE;
+    hi2c1.Init.NoStretchMode    = I2C_NOSTRETCH_DISABLE;
+    if (HAL_I2C_Init(&hi2c1) != HAL_OK)
+    {
+        Error_Handler();
+    }
+    /** Configure Analogue filter
+     */
+    if (HAL_I2CEx_ConfigAnalogFilter(&hi2c1, I2C_ANALOGFILTER_ENABLE) != HAL_OK)
+    {
+        Error_Handler();
+    }
+    /** Configure Digital filter
+     */
+    if (HAL_I2CEx_ConfigDigitalFilter(&hi2c1, 0) != HAL_OK)
+    {
+        Error_Handler();
+    }
+    /* USER CODE BEGIN I2C1_Init 2 */
+
+    /* USER CODE END I2C1_Init 2 */
+}
+
+/**
+ * Enable DMA controller clock
+ */
+static void MX_DMA_Init(void)
+{
+    /* DMA controller clock enable */
+    __HAL_RCC_DMA1_CLK_ENABLE();
+
+    /* DMA interrupt init */
+    /* DMA1_Channel7_IRQn interrupt configuration */
+    HAL_NVIC_SetPriority(DMA1_Channel7_IRQn, 5, 0);
+    HAL_NVIC_EnableIRQ(DMA1_Channel7_IRQn);
+}
+
 /**
  * @brief GPIO Initialization Function
  * @param None
@@ -522,13 +634,9 @@ static void MX_GPIO_Init(void)
     GPIO_InitStruct.Pull = GPIO_NOPULL;
     HAL_GPIO_Init(GPIOB, &GPIO_InitStruct);
 
-    /*Configure GPIO pins : PB6 PB7 */
-    GPIO_InitStruct.Pin       = GPIO_PIN_6 | GPIO_PIN_7;
-    GPIO_InitStruct.Mode      = GPIO_MODE_AF_OD;
-    GPIO_InitStruct.Pull      = GPIO_PULLUP;
-    GPIO_InitStruct.Speed     = GPIO_SPEED_FREQ_HIGH;
-    GPIO_InitStruct.Alternate = GPIO_AF4_I2C1;
-    HAL_GPIO_Init(GPIOB, &GPIO_InitStruct);
+    /* EXTI interrupt init*/
+    HAL_NVIC_SetPriority(EXTI4_IRQn, 5, 0);
+    HAL_NVIC_EnableIRQ(EXTI4_IRQn);
 }
 
 /* USER CODE BEGIN 4 */
@@ -588,6 +696,7 @@ void RunTask1kHz(void const *argument)
 
         App_SharedClock_SetCurrentTimeInMilliseconds(clock, current_time_ms);
         App_DcmWorld_UpdateWaitSignal(world, current_time_ms);
+        App_SharedStateMachine_Tick1kHz(state_machine);
         Io_CanTx_EnqueuePeriodicMsgs(can_tx, current_time_ms);
 
         // Watchdog check-in must be the last function called before putting the
@@ -615,6 +724,14 @@ void RunTaskCanRx(void const *argument)
         struct CanMsg message;
         Io_SharedCan_DequeueCanRxMessage(&message);
         Io_CanRx_UpdateRxTableWithMessage(can_rx, &message);
+
+        const uint32_t current_time_ms = osKernelSysTick() * portTICK_PERIOD_MS;
+        App_Inverter_ProcessFrame(
+            left_inverter, message.std_id, message.data, message.dlc,
+            current_time_ms);
+        App_Inverter_ProcessFrame(
+            right_inverter, message.std_id, message.data, message.dlc,
+            current_time_ms);
     }
     /* USER CODE END RunTaskCanRx */
 }
@@ -668,6 +785,25 @@ void RunTask100Hz(void const *argument)
     /* USER CODE END RunTask100Hz */
 }
 
+/* USER CODE BEGIN Header_RunTaskImu */
+/**
+ * @brief Function implementing the TaskImu thread.
+ * @param argument: Not used
+ * @retval None
+ */
+/* USER CODE END Header_RunTaskImu */
+void RunTaskImu(void const *argument)
+{
+    /* USER CODE BEGIN RunTaskImu */
+    UNUSED(argument);
+
+    for (;;)
+    {
+        Io_LSM6DS33_ReadFifoFromTask();
+    }
+    /* USER CODE END RunTaskImu */
+}
+
 /**
  * @brief  Period elapsed callback in non blocking mode
  * @note   This function is called  when TIM2 interrupt took place, inside
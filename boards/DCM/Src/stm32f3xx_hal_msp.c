@@ -24,6 +24,7 @@
 /* USER CODE BEGIN Includes */
 
 /* USER CODE END Includes */
+extern DMA_HandleTypeDef hdma_i2c1_rx;
 
 /* Private typedef -----------------------------------------------------------*/
 /* USER CODE BEGIN TD */
@@ -214,6 +215,98 @@ void HAL_CAN_MspDeInit(CAN_HandleTypeDef *hcan)
     }
 }
 
+/**
+ * @brief I2C MSP Initialization
+ * This function configures the hardware resources used in this example
+ * @param hi2c: I2C handle pointer
+ * @retval None
+ */
+void HAL_I2C_MspInit(I2C_HandleTypeDef *hi2c)
+{
+    GPIO_InitTypeDef GPIO_InitStruct = { 0 };
+    if (hi2c->Instance == I2C1)
+    {
+        /* USER CODE BEGIN I2C1_MspInit 0 */
+
+        /* USER CODE END I2C1_MspInit 0 */
+
+        __HAL_RCC_GPIOB_CLK_ENABLE();
+        /**I2C1 GPIO Configuration
+        PB6     ------> I2C1_SCL
+        PB7     ------> I2C1_SDA
+        */
+        GPIO_InitStruct.Pin       = GPIO_PIN_6 | GPIO_PIN_7;
+        GPIO_InitStruct.Mode      = GPIO_MODE_AF_OD;
+        GPIO_InitStruct.Pull      = GPIO_PULLUP;
+        GPIO_InitStruct.Speed     = GPIO_SPEED_FREQ_HIGH;
+        GPIO_InitStruct.Alternate = GPIO_AF4_I2C1;
+        HAL_GPIO_Init(GPIOB, &GPIO_InitStruct);
+
+        /* Peripheral clock enable */
+        __HAL_RCC_I2C1_CLK_ENABLE();
+
+        /* I2C1 DMA Init */
+        /* I2C1_RX Init */
+        hdma_i2c1_rx.Instance                 = DMA1_Channel7;
+        hdma_i2c1_rx.Init.Direction           = DMA_PERIPH_TO_MEMORY;
+        hdma_i2c1_rx.Init.PeriphInc           = DMA_PINC_DISABLE;
+        hdma_i2c1_rx.Init.MemInc              = DMA_MINC_ENABLE;
+        hdma_i2c1_rx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+        hdma_i2c1_rx.Init.MemDataAlignment    = DMA_MDATAALIGN_BYTE;
+        hdma_i2c1_rx.Init.Mode                = DMA_NORMAL;
+        hdma_i2c1_rx.Init.Priority            = DMA_PRIORITY_LOW;
+        if (HAL_DMA_Init(&hdma_i2c1_rx) != HAL_OK)
+        {
+            Error_Handler();
+        }
+
+        __HAL_LINKDMA(hi2c, hdmarx, hdma_i2c1_rx);
+
+        /* I2C1 interrupt Init */
+        HAL_NVIC_SetPriority(I2C1_EV_IRQn, 5, 0);
+        HAL_NVIC_EnableIRQ(I2C1_EV_IRQn);
+        HAL_NVIC_SetPriority(I2C1_ER_IRQn, 5, 0);
+        HAL_NVIC_EnableIRQ(I2C1_ER_IRQn);
+        /* USER CODE BEGIN I2C1_MspInit 1 */
+
+        /* USER CODE END I2C1_MspInit 1 */
+    }
+}
+
+/**
+ * @brief I2C MSP De-Initialization
+ * This function freeze the hardware resources used in this example
+ * @param hi2c: I2C handle pointer
+ * @retval None
+ */
+void HAL_I2C_MspDeInit(I2C_HandleTypeDef *hi2c)
+{
+    if (hi2c->Instance == I2C1)
+    {
+        /* USER CODE BEGIN I2C1_MspDeInit 0 */
+
+        /* USER CODE END I2C1_MspDeInit 0 */
+        /* Peripheral clock disable */
+        __HAL_RCC_I2C1_CLK_DISABLE();
+
+        /**I2C1 GPIO Configuration
+        PB6     ------> I2C1_SCL
+        PB7     ------> I2C1_SDA
+        */
+        HAL_GPIO_DeInit(GPIOB, GPIO_PIN_6 | GPIO_PIN_7);
+
+        /* I2C1 DMA DeInit */
+        HAL_DMA_DeInit(hi2c->hdmarx);
+
+        /* I2C1 interrupt DeInit */
+        HAL_NVIC_DisableIRQ(I2C1_EV_IRQn);
+        HAL_NVIC_DisableIRQ(I2C1_ER_IRQn);
+        /* USER CODE BEGIN I2C1_MspDeInit 1 */
+
+        /* USER CODE END I2C1_MspDeInit 1 */
+    }
+}
+
 /* USER CODE BEGIN 1 */
 
 /* USER CODE END 1 */
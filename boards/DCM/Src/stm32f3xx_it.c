@@ -60,6 +60,8 @@
 
 /* External variables --------------------------------------------------------*/
 extern CAN_HandleTypeDef hcan;
+extern DMA_HandleTypeDef hdma_i2c1_rx;
+extern I2C_HandleTypeDef hi2c1;
 extern TIM_HandleTypeDef htim2;
 
 /* USER CODE BEGIN EV */
@@ -162,6 +164,34 @@ void DebugMon_Handler(void)
 /* please refer to the startup file (startup_stm32f3xx.s).                    */
 /******************************************************************************/
 
+/**
+ * @brief This function handles EXTI line4 interrupt.
+ */
+void EXTI4_IRQHandler(void)
+{
+    /* USER CODE BEGIN EXTI4_IRQn 0 */
+
+    /* USER CODE END EXTI4_IRQn 0 */
+    HAL_GPIO_EXTI_IRQHandler(IMU_PIN_1_Pin);
+    /* USER CODE BEGIN EXTI4_IRQn 1 */
+
+    /* USER CODE END EXTI4_IRQn 1 */
+}
+
+/**
+ * @brief This function handles DMA1 channel7 global interrupt.
+ */
+void DMA1_Channel7_IRQHandler(void)
+{
+    /* USER CODE BEGIN DMA1_Channel7_IRQn 0 */
+
+    /* USER CODE END DMA1_Channel7_IRQn 0 */
+    HAL_DMA_IRQHandler(&hdma_i2c1_rx);
+    /* USER CODE BEGIN DMA1_Channel7_IRQn 1 */
+
+    /* USER CODE END DMA1_Channel7_IRQn 1 */
+}
+
 /**
  * @brief This function handles USB high priority or CAN_TX interrupts.
  */
@@ -218,6 +248,35 @@ void TIM2_IRQHandler(void)
     /* USER CODE END TIM2_IRQn 1 */
 }
 
+/**
+ * @brief This function handles I2C1 event global interrupt / I2C1 wake-up
+ * interrupt through EXTI line 23.
+ */
+void I2C1_EV_IRQHandler(void)
+{
+    /* USER CODE BEGIN I2C1_EV_IRQn 0 */
+
+    /* USER CODE END I2C1_EV_IRQn 0 */
+    HAL_I2C_EV_IRQHandler(&hi2c1);
+    /* USER CODE BEGIN I2C1_EV_IRQn 1 */
+
+    /* USER CODE END I2C1_EV_IRQn 1 */
+}
+
+/**
+ * @brief This function handles I2C1 error interrupt.
+ */
+void I2C1_ER_IRQHandler(void)
+{
+    /* USER CODE BEGIN I2C1_ER_IRQn 0 */
+
+    /* USER CODE END I2C1_ER_IRQn 0 */
+    HAL_I2C_ER_IRQHandler(&hi2c1);
+    /* USER CODE BEGIN I2C1_ER_IRQn 1 */
+
+    /* USER CODE END I2C1_ER_IRQn 1 */
+}
+
 /* USER CODE BEGIN 1 */
 
 /* USER CODE END 1 */
@@ -22,3 +22,16 @@ TEST(CanMsgsTest, torque_request_message_frequency)
 {
     ASSERT_GE(HZ_TO_MS(100), CANMSGS_DCM_TORQUE_REQUEST_CYCLE_TIME_MS);
 }
+
+TEST(CanMsgsTest, inverter_torque_requests_message_frequency)
+{
+    ASSERT_GE(
+        HZ_TO_MS(100), CANMSGS_DCM_INVERTER_TORQUE_REQUESTS_CYCLE_TIME_MS);
+}
+
+TEST(CanMsgsTest, imu_sensor_fusion_message_frequency)
+{
+    ASSERT_GE(HZ_TO_MS(100), CANMSGS_DCM_BODY_ACCELERATIONS_CYCLE_TIME_MS);
+    ASSERT_GE(HZ_TO_MS(100), CANMSGS_DCM_ATTITUDE_CYCLE_TIME_MS);
+    ASSERT_GE(HZ_TO_MS(100), CANMSGS_DCM_YAW_RATE_CYCLE_TIME_MS);
+}
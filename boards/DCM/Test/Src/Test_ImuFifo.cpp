@@ -0,0 +1,257 @@
+#include <cmath>
+#include <vector>
+#include "Test_Dcm.h"
+
+extern "C"
+{
+#include "App_ImuFifo.h"
+#include "configs/App_ImuConfig.h"
+}
+
+class ImuFifoTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        imu_fifo = App_ImuFifo_Create(
+            ACCELERATION_SENSITIVITY, ANGULAR_VELOCITY_SENSITIVITY,
+            NOMINAL_SAMPLE_PERIOD_US, WATERMARK);
+    }
+
+    void TearDown() override { TearDownObject(imu_fifo, App_ImuFifo_Destroy); }
+
+    struct Sample
+    {
+        int16_t angular_velocity[NUM_IMU_AXES];
+        int16_t acceleration[NUM_IMU_AXES];
+    };
+
+    // Pack samples the way the IMU outputs them from its FIFO
+    static std::vector<uint8_t> PackSamples(const std::vector<Sample> &samples)
+    {
+        std::vector<uint8_t> raw_data;
+
+        for (const Sample &sample : samples)
+        {
+            for (const int16_t word :
+                 { sample.angular_velocity[0], sample.angular_velocity[1],
+                   sample.angular_velocity[2], sample.acceleration[0],
+                   sample.acceleration[1], sample.acceleration[2] })
+            {
+                raw_data.push_back((uint8_t)((uint16_t)word & 0xFFU));
+                raw_data.push_back((uint8_t)((uint16_t)word >> 8U));
+            }
+        }
+
+        return raw_data;
+    }
+
+    // Simulate an IMU whose oscillator runs at the given sample period. Up to
+    // max_extra_samples samples arrive after each watermark interrupt before
+    // the burst is read, and the acceleration on the x-axis follows the given
+    // function of time.
+    void SimulateBursts(
+        float    sample_period_us,
+        uint32_t num_bursts,
+        float (*get_acceleration_x)(float time_s),
+        uint32_t max_extra_samples)
+    {
+        for (uint32_t burst = 0U; burst < num_bursts; burst++)
+        {
+            const uint32_t num_samples =
+                WATERMARK + burst % (max_extra_samples + 1U);
+            std::vector<Sample> samples;
+
+            for (uint32_t i = 0U; i < num_samples; i++)
+            {
+                const float time_s =
+                    (float)(next_sample_index + i) * sample_period_us / 1e6f;
+                Sample sample                   = {};
+                sample.acceleration[IMU_AXIS_X] = (int16_t)std::lround(
+                    get_acceleration_x(time_s) / ACCELERATION_SENSITIVITY);
+                samples.push_back(sample);
+            }
+
+            const uint32_t watermark_time_us = (uint32_t)std::lround(
+                (double)(next_sample_index + WATERMARK - 1U) *
+                sample_period_us);
+            App_ImuFifo_ProcessBurst(
+                imu_fifo, PackSamples(samples).data(), num_samples,
+                watermark_time_us);
+
+            next_sample_index += num_samples;
+        }
+    }
+
+    // 1g of vibration at ten times the cutoff frequency of the filter, on top
+    // of a constant 5m/s^2 acceleration
+    static float GetVibratingAcceleration(float time_s)
+    {
+        return 5.0f + 9.81f * std::sin(
+                                  2.0f * (float)M_PI * 10.0f *
+                                  IMU_ACCELERATION_FILTER_CUTOFF_HZ * time_s);
+    }
+
+    // The true time of the newest sample processed, in us
+    float GetNewestSampleTimeUs(float sample_period_us) const
+    {
+        return (float)(next_sample_index - 1U) * sample_period_us;
+    }
+
+    static constexpr float    ACCELERATION_SENSITIVITY     = 0.01f;
+    static constexpr float    ANGULAR_VELOCITY_SENSITIVITY = 0.001f;
+    static constexpr float    NOMINAL_SAMPLE_PERIOD_US     = 1000.0f;
+    static constexpr uint32_t WATERMARK                    = 4U;
+
+    struct ImuFifo *imu_fifo;
+    uint32_t        next_sample_index = 0U;
+};
+
+TEST_F(ImuFifoTest, samples_are_unpacked_and_scaled)
+{
+    const std::vector<Sample> samples = {
+        { { 1, 2, 3 }, { 4, 5, 6 } },
+        { { -100, 200, -32768 }, { 32767, -981, 0 } },
+    };
+
+    App_ImuFifo_ProcessBurst(
+        imu_fifo, PackSamples(samples).data(), samples.size(), 1000U);
+
+    // Only the newest sample is published
+    ASSERT_FLOAT_EQ(
+        -0.1f, App_ImuFifo_GetAngularVelocity(imu_fifo, IMU_AXIS_X));
+    ASSERT_FLOAT_EQ(0.2f, App_ImuFifo_GetAngularVelocity(imu_fifo, IMU_AXIS_Y));
+    ASSERT_FLOAT_EQ(
+        -32.768f, App_ImuFifo_GetAngularVelocity(imu_fifo, IMU_AXIS_Z));
+    ASSERT_FLOAT_EQ(327.67f, App_ImuFifo_GetAcceleration(imu_fifo, IMU_AXIS_X));
+    ASSERT_FLOAT_EQ(-9.81f, App_ImuFifo_GetAcceleration(imu_fifo, IMU_AXIS_Y));
+    ASSERT_FLOAT_EQ(0.0f, App_ImuFifo_GetAcceleration(imu_fifo, IMU_AXIS_Z));
+}
+
+TEST_F(ImuFifoTest, first_sample_initializes_filtered_acceleration)
+{
+    const std::vector<Sample> samples = { { { 0, 0, 0 }, { 100, -200, 981 } } };
+
+    App_ImuFifo_ProcessBurst(imu_fifo, PackSamples(samples).data(), 1U, 0U);
+
+    ASSERT_FLOAT_EQ(
+        1.0f, App_ImuFifo_GetFilteredAcceleration(imu_fifo, IMU_AXIS_X));
+    ASSERT_FLOAT_EQ(
+        -2.0f, App_ImuFifo_GetFilteredAcceleration(imu_fifo, IMU_AXIS_Y));
+    ASSERT_FLOAT_EQ(
+        9.81f, App_ImuFifo_GetFilteredAcceleration(imu_fifo, IMU_AXIS_Z));
+}
+
+TEST_F(ImuFifoTest, sample_times_are_reconstructed_from_watermark_interrupt)
+{
+    // Two samples arrived after the watermark-th sample, before the burst was
+    // read
+    const std::vector<Sample> samples(WATERMARK + 2U);
+
+    App_ImuFifo_ProcessBurst(
+        imu_fifo, PackSamples(samples).data(), samples.size(), 50000U);
+    ASSERT_EQ(
+        50000U + 2U * (uint32_t)NOMINAL_SAMPLE_PERIOD_US,
+        App_ImuFifo_GetTimestampUs(imu_fifo));
+
+    // An empty burst changes nothing
+    App_ImuFifo_ProcessBurst(imu_fifo, nullptr, 0U, 90000U);
+    ASSERT_EQ(
+        50000U + 2U * (uint32_t)NOMINAL_SAMPLE_PERIOD_US,
+        App_ImuFifo_GetTimestampUs(imu_fifo));
+}
+
+TEST_F(ImuFifoTest, sample_period_tracks_imu_oscillator_drift)
+{
+    // The IMU's oscillator runs 2% slow
+    const float sample_period_us = 1.02f * NOMINAL_SAMPLE_PERIOD_US;
+
+    SimulateBursts(
+        sample_period_us, 200U, [](float) { return 0.0f; }, 3U);
+
+    ASSERT_NEAR(
+        sample_period_us, App_ImuFifo_GetSamplePeriodUs(imu_fifo), 0.5f);
+
+    // With the nominal sample period, the newest sample of a burst with 3
+    // extra samples would be timestamped 60us early
+    ASSERT_NEAR(
+        GetNewestSampleTimeUs(sample_period_us),
+        (float)App_ImuFifo_GetTimestampUs(imu_fifo), 3.0f);
+}
+
+TEST_F(ImuFifoTest, sample_period_ignores_bursts_after_missed_interrupts)
+{
+    SimulateBursts(
+        NOMINAL_SAMPLE_PERIOD_US, 10U, [](float) { return 0.0f; }, 0U);
+
+    // The FIFO overran while interrupts were missed, so many more samples
+    // passed between the two watermark interrupts than were read
+    next_sample_index += 100U;
+    SimulateBursts(
+        NOMINAL_SAMPLE_PERIOD_US, 1U, [](float) { return 0.0f; }, 0U);
+
+    ASSERT_FLOAT_EQ(
+        NOMINAL_SAMPLE_PERIOD_US, App_ImuFifo_GetSamplePeriodUs(imu_fifo));
+
+    // The timestamps are still reconstructed from the watermark interrupt
+    ASSERT_EQ(
+        (uint32_t)GetNewestSampleTimeUs(NOMINAL_SAMPLE_PERIOD_US),
+        App_ImuFifo_GetTimestampUs(imu_fifo));
+}
+
+TEST_F(ImuFifoTest, filtered_acceleration_follows_steps)
+{
+    const float time_constant_s =
+        1.0f / (2.0f * (float)M_PI * IMU_ACCELERATION_FILTER_CUTOFF_HZ);
+
+    // A step from 0 to 10m/s^2, about one time constant in
+    SimulateBursts(
+        NOMINAL_SAMPLE_PERIOD_US, 1U, [](float) { return 0.0f; }, 0U);
+    const uint32_t num_bursts =
+        (uint32_t)(time_constant_s * 1e6f / NOMINAL_SAMPLE_PERIOD_US) /
+        WATERMARK;
+    SimulateBursts(
+        NOMINAL_SAMPLE_PERIOD_US, num_bursts, [](float) { return 10.0f; }, 0U);
+
+    const float elapsed_s =
+        (float)(num_bursts * WATERMARK) * NOMINAL_SAMPLE_PERIOD_US / 1e6f;
+    ASSERT_FLOAT_EQ(10.0f, App_ImuFifo_GetAcceleration(imu_fifo, IMU_AXIS_X));
+    ASSERT_NEAR(
+        10.0f * (1.0f - std::exp(-elapsed_s / time_constant_s)),
+        App_ImuFifo_GetFilteredAcceleration(imu_fifo, IMU_AXIS_X), 0.3f);
+
+    // Settled after ten time constants
+    SimulateBursts(
+        NOMINAL_SAMPLE_PERIOD_US, 10U * num_bursts, [](float) { return 10.0f; },
+        0U);
+    ASSERT_NEAR(
+        10.0f, App_ImuFifo_GetFilteredAcceleration(imu_fifo, IMU_AXIS_X),
+        0.01f);
+}
+
+TEST_F(ImuFifoTest, filtered_acceleration_rejects_chassis_vibration)
+{
+    SimulateBursts(
+        NOMINAL_SAMPLE_PERIOD_US, 500U, GetVibratingAcceleration, 2U);
+
+    float min_filtered_acceleration = INFINITY;
+    float max_filtered_acceleration = -INFINITY;
+
+    for (uint32_t i = 0U; i < 100U; i++)
+    {
+        SimulateBursts(
+            NOMINAL_SAMPLE_PERIOD_US, 1U, GetVibratingAcceleration, 0U);
+        const float filtered_acceleration =
+            App_ImuFifo_GetFilteredAcceleration(imu_fifo, IMU_AXIS_X);
+        min_filtered_acceleration =
+            std::fmin(min_filtered_acceleration, filtered_acceleration);
+        max_filtered_acceleration =
+            std::fmax(max_filtered_acceleration, filtered_acceleration);
+    }
+
+    // A first-order filter attenuates the vibration about tenfold
+    ASSERT_NEAR(
+        5.0f, 0.5f * (min_filtered_acceleration + max_filtered_acceleration),
+        0.5f);
+    ASSERT_LT(max_filtered_acceleration - min_filtered_acceleration, 2.5f);
+}
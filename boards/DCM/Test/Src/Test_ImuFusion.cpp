@@ -0,0 +1,382 @@
+#include <cmath>
+#include <random>
+#include "Test_Dcm.h"
+
+extern "C"
+{
+#include "App_ImuFusion.h"
+#include "configs/App_ImuConfig.h"
+}
+
+class ImuFusionTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        imu_fusion = App_ImuFusion_Create(0.0f, 0.0f, 0.0f);
+    }
+
+    void TearDown() override
+    {
+        TearDownObject(imu_fusion, App_ImuFusion_Destroy);
+    }
+
+    // The true motion of the vehicle, in the vehicle's axes
+    struct Motion
+    {
+        float longitudinal_acceleration;
+        float lateral_acceleration;
+        float pitch;
+        float roll;
+        float pitch_rate;
+        float roll_rate;
+        float yaw_rate;
+    };
+
+    // Get the acceleration the vehicle measures for the given motion, which is
+    // its own acceleration plus the reaction to gravity
+    static void
+        GetAcceleration(const Motion &motion, float acceleration[NUM_IMU_AXES])
+    {
+        acceleration[IMU_AXIS_X] =
+            motion.longitudinal_acceleration - GRAVITY * std::sin(motion.pitch);
+        acceleration[IMU_AXIS_Y] =
+            motion.lateral_acceleration +
+            GRAVITY * std::sin(motion.roll) * std::cos(motion.pitch);
+        acceleration[IMU_AXIS_Z] =
+            GRAVITY * std::cos(motion.roll) * std::cos(motion.pitch);
+    }
+
+    // Get the angular velocity the vehicle measures for the given motion, from
+    // the rates of its roll, pitch and yaw angles
+    static void GetAngularVelocity(
+        const Motion &motion,
+        float         angular_velocity[NUM_IMU_AXES])
+    {
+        const float sin_roll  = std::sin(motion.roll);
+        const float cos_roll  = std::cos(motion.roll);
+        const float sin_pitch = std::sin(motion.pitch);
+        const float cos_pitch = std::cos(motion.pitch);
+
+        angular_velocity[IMU_AXIS_X] =
+            motion.roll_rate - motion.yaw_rate * sin_pitch;
+        angular_velocity[IMU_AXIS_Y] = motion.pitch_rate * cos_roll +
+                                       motion.yaw_rate * sin_roll * cos_pitch;
+        angular_velocity[IMU_AXIS_Z] = -motion.pitch_rate * sin_roll +
+                                       motion.yaw_rate * cos_roll * cos_pitch;
+    }
+
+    // Update the sensor fusion with the given measurements for the given
+    // duration
+    void UpdateFor(
+        float       duration_s,
+        const float acceleration[NUM_IMU_AXES],
+        const float angular_velocity[NUM_IMU_AXES])
+    {
+        const uint32_t num_updates =
+            (uint32_t)std::lround(duration_s / IMU_SENSOR_FUSION_PERIOD_S);
+
+        for (uint32_t i = 0U; i < num_updates; i++)
+        {
+            App_ImuFusion_Update(imu_fusion, acceleration, angular_velocity);
+        }
+    }
+
+    // Update the sensor fusion with the measurements of the given motion for
+    // the given duration. The pitch and roll follow their rates.
+    void UpdateFor(float duration_s, Motion &motion)
+    {
+        const uint32_t num_updates =
+            (uint32_t)std::lround(duration_s / IMU_SENSOR_FUSION_PERIOD_S);
+
+        for (uint32_t i = 0U; i < num_updates; i++)
+        {
+            float acceleration[NUM_IMU_AXES];
+            float angular_velocity[NUM_IMU_AXES];
+            GetAcceleration(motion, acceleration);
+            GetAngularVelocity(motion, angular_velocity);
+            App_ImuFusion_Update(imu_fusion, acceleration, angular_velocity);
+
+            motion.pitch += IMU_SENSOR_FUSION_PERIOD_S * motion.pitch_rate;
+            motion.roll += IMU_SENSOR_FUSION_PERIOD_S * motion.roll_rate;
+        }
+    }
+
+    static constexpr float GRAVITY = 9.80665f;
+
+    struct ImuFusion *imu_fusion;
+};
+
+TEST_F(ImuFusionTest, level_vehicle_at_rest_has_no_attitude_or_acceleration)
+{
+    const float acceleration[NUM_IMU_AXES]     = { 0.0f, 0.0f, GRAVITY };
+    const float angular_velocity[NUM_IMU_AXES] = { 0.0f, 0.0f, 0.0f };
+
+    UpdateFor(1.0f, acceleration, angular_velocity);
+
+    ASSERT_NEAR(0.0f, App_ImuFusion_GetPitch(imu_fusion), 1e-6f);
+    ASSERT_NEAR(0.0f, App_ImuFusion_GetRoll(imu_fusion), 1e-6f);
+    ASSERT_NEAR(
+        0.0f, App_ImuFusion_GetLongitudinalAcceleration(imu_fusion), 1e-5f);
+    ASSERT_NEAR(0.0f, App_ImuFusion_GetLateralAcceleration(imu_fusion), 1e-5f);
+    ASSERT_NEAR(0.0f, App_ImuFusion_GetYawRate(imu_fusion), 1e-6f);
+}
+
+TEST_F(ImuFusionTest, first_measurement_of_gravity_sets_attitude)
+{
+    Motion motion = {};
+    motion.pitch  = 0.05f;
+    motion.roll   = -0.03f;
+
+    UpdateFor(IMU_SENSOR_FUSION_PERIOD_S, motion);
+
+    ASSERT_NEAR(0.05f, App_ImuFusion_GetPitch(imu_fusion), 1e-5f);
+    ASSERT_NEAR(-0.03f, App_ImuFusion_GetRoll(imu_fusion), 1e-5f);
+
+    // Gravity isn't mistaken for acceleration on a slope
+    ASSERT_NEAR(
+        0.0f, App_ImuFusion_GetLongitudinalAcceleration(imu_fusion), 1e-4f);
+    ASSERT_NEAR(0.0f, App_ImuFusion_GetLateralAcceleration(imu_fusion), 1e-4f);
+}
+
+TEST_F(ImuFusionTest, pitch_is_integrated_and_gravity_removed_while_braking)
+{
+    Motion motion = {};
+    UpdateFor(1.0f, motion);
+
+    // The nose dives while braking, and the measured acceleration is too large
+    // to correct the attitude with
+    motion.longitudinal_acceleration = -12.0f;
+    motion.pitch_rate                = 0.2f;
+    UpdateFor(0.25f, motion);
+    motion.pitch_rate = 0.0f;
+    UpdateFor(1.0f, motion);
+
+    ASSERT_NEAR(0.05f, App_ImuFusion_GetPitch(imu_fusion), 1e-3f);
+    ASSERT_NEAR(
+        -12.0f, App_ImuFusion_GetLongitudinalAcceleration(imu_fusion), 0.02f);
+}
+
+TEST_F(ImuFusionTest, roll_and_yaw_rate_are_tracked_while_cornering)
+{
+    Motion motion = {};
+    UpdateFor(1.0f, motion);
+
+    // Turning left, the body rolls to the right
+    motion.lateral_acceleration = 15.0f;
+    motion.yaw_rate             = 1.0f;
+    motion.roll_rate            = 0.1f;
+    UpdateFor(0.3f, motion);
+    motion.roll_rate = 0.0f;
+    UpdateFor(2.0f, motion);
+
+    ASSERT_NEAR(0.03f, App_ImuFusion_GetRoll(imu_fusion), 1e-3f);
+    ASSERT_NEAR(1.0f, App_ImuFusion_GetYawRate(imu_fusion), 1e-3f);
+    ASSERT_NEAR(15.0f, App_ImuFusion_GetLateralAcceleration(imu_fusion), 0.02f);
+}
+
+TEST_F(ImuFusionTest, gravity_corrects_attitude_drift_once_held_still)
+{
+    Motion motion = {};
+    UpdateFor(1.0f, motion);
+
+    // An angular velocity that doesn't match the measured acceleration, and is
+    // too large to be a gyroscope bias, tilts the attitude until gravity looks
+    // like acceleration of the vehicle
+    const float acceleration[NUM_IMU_AXES]     = { 0.0f, 0.0f, GRAVITY };
+    const float angular_velocity[NUM_IMU_AXES] = { 0.3f, 0.0f, 0.0f };
+    UpdateFor(1.0f, acceleration, angular_velocity);
+    ASSERT_GT(App_ImuFusion_GetRoll(imu_fusion), 0.25f);
+
+    // Once the vehicle is held still, the attitude returns to level
+    UpdateFor(
+        IMU_MIN_STATIONARY_DURATION_S + 10.0f * IMU_ATTITUDE_TIME_CONSTANT_S,
+        motion);
+    ASSERT_NEAR(0.0f, App_ImuFusion_GetRoll(imu_fusion), 1e-3f);
+}
+
+TEST_F(ImuFusionTest, gyro_bias_is_estimated_while_held_still)
+{
+    const float bias[NUM_IMU_AXES]         = { 0.02f, -0.15f, 0.1f };
+    const float acceleration[NUM_IMU_AXES] = { 0.0f, 0.0f, GRAVITY };
+
+    // The bias isn't estimated until the vehicle has been still for a while
+    UpdateFor(0.9f * IMU_MIN_STATIONARY_DURATION_S, acceleration, bias);
+    ASSERT_EQ(0.0f, App_ImuFusion_GetGyroBias(imu_fusion, IMU_AXIS_Z));
+
+    UpdateFor(
+        IMU_MIN_STATIONARY_DURATION_S + 8.0f * IMU_GYRO_BIAS_TIME_CONSTANT_S,
+        acceleration, bias);
+
+    for (uint32_t axis = 0U; axis < NUM_IMU_AXES; axis++)
+    {
+        ASSERT_NEAR(
+            bias[axis],
+            App_ImuFusion_GetGyroBias(imu_fusion, (enum ImuAxis)axis), 1e-4f);
+    }
+    ASSERT_NEAR(0.0f, App_ImuFusion_GetYawRate(imu_fusion), 1e-4f);
+    ASSERT_NEAR(0.0f, App_ImuFusion_GetPitch(imu_fusion), 5e-3f);
+    ASSERT_NEAR(0.0f, App_ImuFusion_GetRoll(imu_fusion), 5e-3f);
+}
+
+TEST_F(ImuFusionTest, gyro_bias_is_not_estimated_while_turning)
+{
+    Motion motion   = {};
+    motion.yaw_rate = 0.5f;
+
+    UpdateFor(10.0f * IMU_GYRO_BIAS_TIME_CONSTANT_S, motion);
+
+    ASSERT_EQ(0.0f, App_ImuFusion_GetGyroBias(imu_fusion, IMU_AXIS_Z));
+    ASSERT_NEAR(0.5f, App_ImuFusion_GetYawRate(imu_fusion), 1e-5f);
+}
+
+TEST_F(ImuFusionTest, gyro_bias_estimate_is_limited)
+{
+    const float acceleration[NUM_IMU_AXES]     = { 0.0f, 0.0f, GRAVITY };
+    const float angular_velocity[NUM_IMU_AXES] = { 0.0f, 0.0f, 0.24f };
+
+    UpdateFor(
+        IMU_MIN_STATIONARY_DURATION_S + 10.0f * IMU_GYRO_BIAS_TIME_CONSTANT_S,
+        acceleration, angular_velocity);
+
+    ASSERT_FLOAT_EQ(
+        IMU_MAX_GYRO_BIAS, App_ImuFusion_GetGyroBias(imu_fusion, IMU_AXIS_Z));
+}
+
+TEST_F(ImuFusionTest, mounting_orientation_is_corrected)
+{
+    TearDownObject(imu_fusion, App_ImuFusion_Destroy);
+
+    // The Imu is mounted upside down, with its x-axis pointing to the right
+    imu_fusion = App_ImuFusion_Create((float)M_PI, 0.0f, -0.5f * (float)M_PI);
+
+    // Rolled over, the Imu's y-axis points backward and its z-axis down
+    const float at_rest[NUM_IMU_AXES]          = { 0.0f, 0.0f, -GRAVITY };
+    const float angular_velocity[NUM_IMU_AXES] = { 0.0f, 0.0f, 0.0f };
+    UpdateFor(1.0f, at_rest, angular_velocity);
+    ASSERT_NEAR(0.0f, App_ImuFusion_GetPitch(imu_fusion), 1e-5f);
+    ASSERT_NEAR(0.0f, App_ImuFusion_GetRoll(imu_fusion), 1e-5f);
+
+    // Speeding up while turning left
+    const float turning[NUM_IMU_AXES]  = { -6.0f, -4.0f, -GRAVITY };
+    const float yaw_rate[NUM_IMU_AXES] = { 0.0f, 0.0f, -0.8f };
+    App_ImuFusion_Update(imu_fusion, turning, yaw_rate);
+    ASSERT_NEAR(
+        4.0f, App_ImuFusion_GetLongitudinalAcceleration(imu_fusion), 1e-4f);
+    ASSERT_NEAR(6.0f, App_ImuFusion_GetLateralAcceleration(imu_fusion), 1e-4f);
+    ASSERT_NEAR(0.8f, App_ImuFusion_GetYawRate(imu_fusion), 1e-4f);
+}
+
+TEST_F(ImuFusionTest, estimates_follow_a_simulated_lap)
+{
+    // Validate against a lap simulated with a biased and noisy Imu: waiting on
+    // the grid, then a straight, a left corner and braking, with the attitude
+    // the suspension settles into in each
+    struct Segment
+    {
+        float duration_s;
+        float longitudinal_acceleration;
+        float lateral_acceleration;
+        float yaw_rate;
+        float pitch;
+        float roll;
+    };
+    const Segment segments[] = {
+        { 30.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
+        { 3.0f, 8.0f, 0.0f, 0.0f, -0.02f, 0.0f },
+        { 4.0f, 0.0f, 15.0f, 1.0f, 0.0f, 0.03f },
+        { 2.0f, -12.0f, 0.0f, 0.0f, 0.03f, 0.0f },
+        { 3.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
+    };
+    const float gyro_bias[NUM_IMU_AXES] = { 0.03f, -0.05f, 0.08f };
+
+    // The suspension and the driver's inputs settle with this time constant
+    const float time_constant_s = 0.1f;
+    const float smoothing_factor =
+        IMU_SENSOR_FUSION_PERIOD_S /
+        (time_constant_s + IMU_SENSOR_FUSION_PERIOD_S);
+
+    std::mt19937                    generator(0U);
+    std::normal_distribution<float> acceleration_noise(0.0f, 0.05f);
+    std::normal_distribution<float> angular_velocity_noise(0.0f, 0.005f);
+
+    Motion   motion                         = {};
+    float    yaw_rate_squared_error_sum     = 0.0f;
+    float    acceleration_squared_error_sum = 0.0f;
+    float    attitude_squared_error_sum     = 0.0f;
+    uint32_t num_errors                     = 0U;
+
+    for (const Segment &segment : segments)
+    {
+        const uint32_t num_updates = (uint32_t)std::lround(
+            segment.duration_s / IMU_SENSOR_FUSION_PERIOD_S);
+
+        for (uint32_t i = 0U; i < num_updates; i++)
+        {
+            motion.longitudinal_acceleration +=
+                smoothing_factor * (segment.longitudinal_acceleration -
+                                    motion.longitudinal_acceleration);
+            motion.lateral_acceleration +=
+                smoothing_factor *
+                (segment.lateral_acceleration - motion.lateral_acceleration);
+            motion.yaw_rate +=
+                smoothing_factor * (segment.yaw_rate - motion.yaw_rate);
+            motion.pitch_rate = smoothing_factor *
+                                (segment.pitch - motion.pitch) /
+                                IMU_SENSOR_FUSION_PERIOD_S;
+            motion.roll_rate = smoothing_factor * (segment.roll - motion.roll) /
+                               IMU_SENSOR_FUSION_PERIOD_S;
+
+            float acceleration[NUM_IMU_AXES];
+            float angular_velocity[NUM_IMU_AXES];
+            GetAcceleration(motion, acceleration);
+            GetAngularVelocity(motion, angular_velocity);
+
+            for (uint32_t axis = 0U; axis < NUM_IMU_AXES; axis++)
+            {
+                acceleration[axis] += acceleration_noise(generator);
+                angular_velocity[axis] +=
+                    gyro_bias[axis] + angular_velocity_noise(generator);
+            }
+
+            App_ImuFusion_Update(imu_fusion, acceleration, angular_velocity);
+
+            motion.pitch += IMU_SENSOR_FUSION_PERIOD_S * motion.pitch_rate;
+            motion.roll += IMU_SENSOR_FUSION_PERIOD_S * motion.roll_rate;
+
+            // Only the lap is scored, once the gyroscope bias is estimated
+            if (&segment == &segments[0])
+            {
+                continue;
+            }
+
+            const float yaw_rate_error =
+                App_ImuFusion_GetYawRate(imu_fusion) - motion.yaw_rate;
+            const float longitudinal_acceleration_error =
+                App_ImuFusion_GetLongitudinalAcceleration(imu_fusion) -
+                motion.longitudinal_acceleration;
+            const float lateral_acceleration_error =
+                App_ImuFusion_GetLateralAcceleration(imu_fusion) -
+                motion.lateral_acceleration;
+            const float pitch_error =
+                App_ImuFusion_GetPitch(imu_fusion) - motion.pitch;
+            const float roll_error =
+                App_ImuFusion_GetRoll(imu_fusion) - motion.roll;
+
+            yaw_rate_squared_error_sum += yaw_rate_error * yaw_rate_error;
+            acceleration_squared_error_sum +=
+                longitudinal_acceleration_error *
+                    longitudinal_acceleration_error +
+                lateral_acceleration_error * lateral_acceleration_error;
+            attitude_squared_error_sum +=
+                pitch_error * pitch_error + roll_error * roll_error;
+            num_errors++;
+        }
+    }
+
+    // Without the bias estimate, the yaw rate would be 0.08rad/s off. Without
+    // the attitude, gravity would add up to 0.3m/s^2 to the accelerations.
+    ASSERT_LT(std::sqrt(yaw_rate_squared_error_sum / num_errors), 0.01f);
+    ASSERT_LT(std::sqrt(acceleration_squared_error_sum / num_errors), 0.1f);
+    ASSERT_LT(std::sqrt(attitude_squared_error_sum / num_errors), 0.005f);
+}
@@ -0,0 +1,320 @@
+#include <cmath>
+#include <map>
+#include "Test_Dcm.h"
+
+extern "C"
+{
+#include "App_Inverter.h"
+#include "configs/App_InverterConfig.h"
+#include "configs/App_TractionControlConfig.h"
+}
+
+// The registers of the BAMOCAR's CAN protocol
+#define TORQUE_SETPOINT_REGISTER_ID 0x90U
+#define SPEED_SETPOINT_REGISTER_ID 0x31U
+#define CYCLIC_TRANSMIT_REQUEST_REGISTER_ID 0x3DU
+#define SPEED_REGISTER_ID 0x30U
+#define CURRENT_REGISTER_ID 0x20U
+#define MOTOR_TEMPERATURE_REGISTER_ID 0x49U
+#define POWER_STAGE_TEMPERATURE_REGISTER_ID 0x4AU
+#define STOP_CYCLIC_TRANSMIT_INTERVAL 0xFFU
+
+// A host stand-in for a BAMOCAR inverter, which parses the frames sent to it
+// and sends the registers it's subscribed to back at their cyclic intervals
+class BamocarStandIn
+{
+  public:
+    struct Subscription
+    {
+        uint32_t interval_ms;
+        uint32_t next_transmit_time_ms;
+    };
+
+    void Receive(const uint32_t std_id, const uint8_t *data, const uint32_t dlc)
+    {
+        ASSERT_EQ(LEFT_INVERTER_COMMAND_STD_ID, std_id);
+        ASSERT_EQ(3U, dlc);
+
+        if (data[0] == CYCLIC_TRANSMIT_REQUEST_REGISTER_ID)
+        {
+            subscription_requests[data[1]]++;
+
+            if (data[2] == STOP_CYCLIC_TRANSMIT_INTERVAL)
+            {
+                subscriptions.erase(data[1]);
+            }
+            else
+            {
+                subscriptions[data[1]] = { data[2], current_time_ms };
+            }
+        }
+        else
+        {
+            setpoint_register_id = data[0];
+            setpoint_digits = (int16_t)((uint16_t)data[1] | (data[2] << 8));
+            num_setpoints_received++;
+        }
+    }
+
+    void Tick(struct Inverter *const inverter, const uint32_t time_ms)
+    {
+        current_time_ms = time_ms;
+
+        if (!is_online)
+        {
+            return;
+        }
+
+        for (auto &subscription : subscriptions)
+        {
+            if (time_ms < subscription.second.next_transmit_time_ms)
+            {
+                continue;
+            }
+
+            const uint16_t value   = (uint16_t)registers[subscription.first];
+            const uint8_t  data[3] = { subscription.first,
+                                      (uint8_t)(value & 0xFFU),
+                                      (uint8_t)(value >> 8) };
+
+            ASSERT_TRUE(App_Inverter_ProcessFrame(
+                inverter, LEFT_INVERTER_FEEDBACK_STD_ID, data, 3U, time_ms));
+            subscription.second.next_transmit_time_ms +=
+                subscription.second.interval_ms;
+        }
+    }
+
+    // An inverter that is reset forgets its subscriptions
+    void Reset(void) { subscriptions.clear(); }
+
+    bool                            is_online              = true;
+    uint32_t                        current_time_ms        = 0U;
+    uint8_t                         setpoint_register_id   = 0U;
+    int16_t                         setpoint_digits        = 0;
+    uint32_t                        num_setpoints_received = 0U;
+    std::map<uint8_t, int16_t>      registers;
+    std::map<uint8_t, Subscription> subscriptions;
+    std::map<uint8_t, uint32_t>     subscription_requests;
+};
+
+static BamocarStandIn *stand_in;
+
+static void TransmitToStandIn(
+    const uint32_t std_id,
+    const uint8_t *data,
+    const uint32_t dlc)
+{
+    stand_in->Receive(std_id, data, dlc);
+}
+
+class InverterTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        stand_in = &bamocar;
+        inverter = App_Inverter_Create(
+            LEFT_INVERTER_COMMAND_STD_ID, LEFT_INVERTER_FEEDBACK_STD_ID,
+            TransmitToStandIn);
+        current_time_ms = 0U;
+    }
+
+    void TearDown() override
+    {
+        TearDownObject(inverter, App_Inverter_Destroy);
+        stand_in = NULL;
+    }
+
+    void LetTimePass(const uint32_t time_ms)
+    {
+        for (uint32_t i = 0U; i < time_ms; i++)
+        {
+            bamocar.Tick(inverter, current_time_ms);
+            App_Inverter_Tick(inverter, current_time_ms);
+            current_time_ms++;
+        }
+    }
+
+    static int16_t ToDigits(const float value, const float max_value)
+    {
+        return (int16_t)std::lround(value / max_value * 32767.0f);
+    }
+
+    struct Inverter *inverter;
+    BamocarStandIn   bamocar;
+    uint32_t         current_time_ms;
+};
+
+TEST_F(InverterTest, torque_setpoint_is_sent_every_setpoint_period)
+{
+    App_Inverter_SetTorqueSetpoint(inverter, 10.5f);
+    LetTimePass(100U);
+
+    EXPECT_EQ(
+        100U / INVERTER_SETPOINT_PERIOD_MS, bamocar.num_setpoints_received);
+    EXPECT_EQ(TORQUE_SETPOINT_REGISTER_ID, bamocar.setpoint_register_id);
+    EXPECT_EQ(ToDigits(10.5f, INVERTER_MAX_TORQUE_NM), bamocar.setpoint_digits);
+
+    App_Inverter_SetTorqueSetpoint(inverter, -5.0f);
+    LetTimePass(INVERTER_SETPOINT_PERIOD_MS);
+
+    EXPECT_EQ(ToDigits(-5.0f, INVERTER_MAX_TORQUE_NM), bamocar.setpoint_digits);
+}
+
+TEST_F(InverterTest, speed_setpoint_is_sent_in_speed_register)
+{
+    App_Inverter_SetSpeedSetpoint(inverter, 2000.0f);
+    LetTimePass(INVERTER_SETPOINT_PERIOD_MS);
+
+    EXPECT_EQ(SPEED_SETPOINT_REGISTER_ID, bamocar.setpoint_register_id);
+    EXPECT_EQ(
+        ToDigits(2000.0f, INVERTER_MAX_SPEED_RPM), bamocar.setpoint_digits);
+}
+
+TEST_F(InverterTest, setpoints_are_clamped_to_inverter_range)
+{
+    App_Inverter_SetTorqueSetpoint(inverter, 2.0f * INVERTER_MAX_TORQUE_NM);
+    LetTimePass(INVERTER_SETPOINT_PERIOD_MS);
+    EXPECT_EQ(32767, bamocar.setpoint_digits);
+
+    App_Inverter_SetTorqueSetpoint(inverter, -2.0f * INVERTER_MAX_TORQUE_NM);
+    LetTimePass(INVERTER_SETPOINT_PERIOD_MS);
+    EXPECT_EQ(-32767, bamocar.setpoint_digits);
+
+    App_Inverter_SetSpeedSetpoint(inverter, 2.0f * INVERTER_MAX_SPEED_RPM);
+    LetTimePass(INVERTER_SETPOINT_PERIOD_MS);
+    EXPECT_EQ(32767, bamocar.setpoint_digits);
+}
+
+TEST_F(InverterTest, every_feedback_is_subscribed_to_once_while_received)
+{
+    LetTimePass(1000U);
+
+    ASSERT_EQ(4U, bamocar.subscriptions.size());
+    EXPECT_EQ(
+        INVERTER_SPEED_FEEDBACK_PERIOD_MS,
+        bamocar.subscriptions[SPEED_REGISTER_ID].interval_ms);
+    EXPECT_EQ(
+        INVERTER_CURRENT_FEEDBACK_PERIOD_MS,
+        bamocar.subscriptions[CURRENT_REGISTER_ID].interval_ms);
+    EXPECT_EQ(
+        INVERTER_TEMPERATURE_FEEDBACK_PERIOD_MS,
+        bamocar.subscriptions[MOTOR_TEMPERATURE_REGISTER_ID].interval_ms);
+    EXPECT_EQ(
+        INVERTER_TEMPERATURE_FEEDBACK_PERIOD_MS,
+        bamocar.subscriptions[POWER_STAGE_TEMPERATURE_REGISTER_ID].interval_ms);
+
+    // Feedback that keeps arriving is not polled for again
+    for (const auto &requests : bamocar.subscription_requests)
+    {
+        EXPECT_EQ(1U, requests.second);
+    }
+}
+
+TEST_F(InverterTest, feedback_is_scaled_to_physical_units)
+{
+    bamocar.registers[SPEED_REGISTER_ID] =
+        ToDigits(4000.0f, INVERTER_MAX_SPEED_RPM);
+    bamocar.registers[CURRENT_REGISTER_ID] =
+        ToDigits(-50.0f, INVERTER_PEAK_CURRENT_A);
+    bamocar.registers[MOTOR_TEMPERATURE_REGISTER_ID]       = 11500;
+    bamocar.registers[POWER_STAGE_TEMPERATURE_REGISTER_ID] = 17600;
+    LetTimePass(10U);
+
+    EXPECT_NEAR(4000.0f, App_Inverter_GetSpeedRpm(inverter), 0.5f);
+    EXPECT_NEAR(-50.0f, App_Inverter_GetCurrentA(inverter), 0.01f);
+
+    // On a point of the calibration table, and halfway between two points
+    EXPECT_FLOAT_EQ(20.0f, App_Inverter_GetMotorTemperatureDegC(inverter));
+    EXPECT_FLOAT_EQ(22.5f, App_Inverter_GetPowerStageTemperatureDegC(inverter));
+}
+
+TEST_F(InverterTest, wheel_speed_is_derived_from_motor_speed)
+{
+    // The wheel turns at the motor speed over the gear ratio, and rolls its
+    // circumference every revolution
+    bamocar.registers[SPEED_REGISTER_ID] =
+        ToDigits(4500.0f, INVERTER_MAX_SPEED_RPM);
+    LetTimePass(10U);
+
+    const float wheel_circumference_m =
+        2.0f * (float)M_PI * TRACTION_CONTROL_WHEEL_RADIUS_M;
+    EXPECT_NEAR(
+        4500.0f / TRACTION_CONTROL_GEAR_RATIO * wheel_circumference_m * 60.0f /
+            1000.0f,
+        App_Inverter_GetWheelSpeedKph(inverter), 0.01f);
+}
+
+TEST_F(InverterTest, temperatures_outside_calibration_table_are_clamped)
+{
+    bamocar.registers[MOTOR_TEMPERATURE_REGISTER_ID]       = 0;
+    bamocar.registers[POWER_STAGE_TEMPERATURE_REGISTER_ID] = 32767;
+    LetTimePass(10U);
+
+    EXPECT_FLOAT_EQ(-20.0f, App_Inverter_GetMotorTemperatureDegC(inverter));
+    EXPECT_FLOAT_EQ(
+        110.0f, App_Inverter_GetPowerStageTemperatureDegC(inverter));
+}
+
+TEST_F(InverterTest, feedback_is_stale_until_received_and_after_it_stops)
+{
+    bamocar.is_online = false;
+    LetTimePass(10U);
+
+    for (int i = 0; i < NUM_INVERTER_FEEDBACKS; i++)
+    {
+        EXPECT_TRUE(
+            App_Inverter_IsFeedbackStale(inverter, (enum InverterFeedback)i));
+    }
+
+    bamocar.is_online = true;
+    LetTimePass(40U);
+
+    for (int i = 0; i < NUM_INVERTER_FEEDBACKS; i++)
+    {
+        EXPECT_FALSE(
+            App_Inverter_IsFeedbackStale(inverter, (enum InverterFeedback)i));
+    }
+
+    // The speed and current go stale after missing
+    // INVERTER_STALE_FEEDBACK_PERIODS of their interval, while the slower
+    // temperatures are still fresh
+    bamocar.is_online = false;
+    LetTimePass(
+        INVERTER_STALE_FEEDBACK_PERIODS * INVERTER_SPEED_FEEDBACK_PERIOD_MS);
+
+    EXPECT_TRUE(
+        App_Inverter_IsFeedbackStale(inverter, INVERTER_FEEDBACK_SPEED));
+    EXPECT_TRUE(
+        App_Inverter_IsFeedbackStale(inverter, INVERTER_FEEDBACK_CURRENT));
+    EXPECT_FALSE(App_Inverter_IsFeedbackStale(
+        inverter, INVERTER_FEEDBACK_MOTOR_TEMPERATURE));
+    EXPECT_FALSE(App_Inverter_IsFeedbackStale(
+        inverter, INVERTER_FEEDBACK_POWER_STAGE_TEMPERATURE));
+}
+
+TEST_F(InverterTest, stale_feedback_is_subscribed_to_again_after_inverter_reset)
+{
+    LetTimePass(50U);
+    bamocar.Reset();
+
+    LetTimePass(INVERTER_RESUBSCRIBE_PERIOD_MS);
+
+    EXPECT_EQ(2U, bamocar.subscription_requests[SPEED_REGISTER_ID]);
+    EXPECT_EQ(2U, bamocar.subscription_requests[CURRENT_REGISTER_ID]);
+    EXPECT_FALSE(
+        App_Inverter_IsFeedbackStale(inverter, INVERTER_FEEDBACK_SPEED));
+    EXPECT_FALSE(
+        App_Inverter_IsFeedbackStale(inverter, INVERTER_FEEDBACK_CURRENT));
+}
+
+TEST_F(InverterTest, frames_from_other_ids_are_ignored)
+{
+    const uint8_t data[3] = { SPEED_REGISTER_ID, 0xFFU, 0x7FU };
+
+    EXPECT_FALSE(App_Inverter_ProcessFrame(
+        inverter, RIGHT_INVERTER_FEEDBACK_STD_ID, data, 3U, 0U));
+    EXPECT_FALSE(App_Inverter_ProcessFrame(
+        inverter, LEFT_INVERTER_COMMAND_STD_ID, data, 3U, 0U));
+    EXPECT_EQ(0.0f, App_Inverter_GetSpeedRpm(inverter));
+}
@@ -0,0 +1,232 @@
+#include <math.h>
+#include "Test_Dcm.h"
+
+extern "C"
+{
+#include "App_PowerLimiter.h"
+#include "configs/App_PowerLimiterConfig.h"
+#include "configs/App_TractionControlConfig.h"
+#include "configs/App_TorqueRequestThresholds.h"
+}
+
+namespace PowerLimiterTest
+{
+// A limit the test vehicle reaches well within its top speed, in kW
+#define TEST_MAX_POWER_KW 20.0f
+
+// The drivetrain of the test vehicle is less efficient than the power limiter
+// assumes, and has fixed losses that the power limiter doesn't model
+#define PLANT_EFFICIENCY 0.87
+#define PLANT_FIXED_LOSSES_KW 1.5
+
+class PowerLimiterTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        power_limiter = App_PowerLimiter_Create(TEST_MAX_POWER_KW);
+    }
+
+    void TearDown() override
+    {
+        TearDownObject(power_limiter, App_PowerLimiter_Destroy);
+    }
+
+    struct AccelerationResult
+    {
+        float max_power_kw;
+        float final_power_kw;
+        float final_left_torque_nm;
+        float final_right_torque_nm;
+        float vehicle_speed_at_first_limit_kph;
+    };
+
+    // Accelerate from the given speed with the given motor torque requests.
+    // The accumulator voltage sags with the current, and the BMS measurements
+    // are sampled every 10ms and arrive 10ms late.
+    AccelerationResult Accelerate(
+        struct MotorTorqueRequests motor_torque_requests,
+        float                      initial_speed_kph,
+        uint32_t                   duration_ms,
+        bool                       is_bms_broadcasting)
+    {
+        constexpr double   OPEN_CIRCUIT_VOLTAGE = 400.0;
+        constexpr double   INTERNAL_RESISTANCE  = 0.1;
+        constexpr uint32_t BMS_PERIOD_MS        = 10U;
+        constexpr double   MASS = TRACTION_CONTROL_VEHICLE_MASS_KG;
+        constexpr double   RATIO =
+            TRACTION_CONTROL_GEAR_RATIO / TRACTION_CONTROL_WHEEL_RADIUS_M;
+
+        double vehicle_speed_mps = initial_speed_kph / 3.6;
+        double acceleration      = 0.0;
+        double power_w           = 0.0;
+
+        float sampled_voltage = 0.0f, sampled_current = 0.0f;
+        float received_voltage = 0.0f, received_current = 0.0f;
+
+        AccelerationResult result               = {};
+        result.vehicle_speed_at_first_limit_kph = NAN;
+
+        struct MotorTorqueRequests limited = { 0.0f, 0.0f };
+
+        for (uint32_t ms = 0U; ms < duration_ms; ms++)
+        {
+            if (ms % BMS_PERIOD_MS == 0U && is_bms_broadcasting)
+            {
+                received_voltage = sampled_voltage;
+                received_current = sampled_current;
+            }
+
+            limited = App_PowerLimiter_LimitTorqueRequests(
+                power_limiter, motor_torque_requests,
+                (float)(vehicle_speed_mps * 3.6), (float)acceleration,
+                received_voltage, received_current);
+
+            if (isnan(result.vehicle_speed_at_first_limit_kph) &&
+                limited.left < motor_torque_requests.left)
+            {
+                result.vehicle_speed_at_first_limit_kph =
+                    (float)(vehicle_speed_mps * 3.6);
+            }
+
+            const double total_torque = limited.left + limited.right;
+            const double motor_speed  = vehicle_speed_mps * RATIO;
+            power_w = total_torque * motor_speed / PLANT_EFFICIENCY +
+                      PLANT_FIXED_LOSSES_KW * 1000.0;
+
+            // Solve P = (OCV - R * I) * I for the accumulator current
+            const double current =
+                (OPEN_CIRCUIT_VOLTAGE -
+                 sqrt(
+                     OPEN_CIRCUIT_VOLTAGE * OPEN_CIRCUIT_VOLTAGE -
+                     4.0 * INTERNAL_RESISTANCE * power_w)) /
+                (2.0 * INTERNAL_RESISTANCE);
+
+            if (ms % BMS_PERIOD_MS == 0U)
+            {
+                sampled_voltage =
+                    (float)(OPEN_CIRCUIT_VOLTAGE - INTERNAL_RESISTANCE * current);
+                sampled_current = (float)current;
+            }
+
+            result.max_power_kw =
+                fmaxf(result.max_power_kw, (float)(power_w / 1000.0));
+
+            acceleration = total_torque * RATIO / MASS;
+            vehicle_speed_mps += 1e-3 * acceleration;
+        }
+
+        result.final_power_kw        = (float)(power_w / 1000.0);
+        result.final_left_torque_nm  = limited.left;
+        result.final_right_torque_nm = limited.right;
+
+        return result;
+    }
+
+    struct PowerLimiter *power_limiter;
+};
+
+TEST_F(PowerLimiterTest, torque_requests_are_not_limited_below_power_limit)
+{
+    const struct MotorTorqueRequests requests = { MAX_TORQUE_REQUEST_NM,
+                                                  MAX_TORQUE_REQUEST_NM };
+
+    // Full torque at 40km/h draws about 10kW
+    for (uint32_t i = 0U; i < 1000U; i++)
+    {
+        const struct MotorTorqueRequests limited =
+            App_PowerLimiter_LimitTorqueRequests(
+                power_limiter, requests, 40.0f, 0.0f, 395.0f, 25.0f);
+        ASSERT_EQ(requests.left, limited.left);
+        ASSERT_EQ(requests.right, limited.right);
+    }
+}
+
+TEST_F(PowerLimiterTest, power_stays_under_limit_while_accelerating)
+{
+    const AccelerationResult result = Accelerate(
+        { MAX_TORQUE_REQUEST_NM, MAX_TORQUE_REQUEST_NM }, 40.0f, 10000U, true);
+
+    ASSERT_LE(result.max_power_kw, TEST_MAX_POWER_KW);
+
+    // The limiter shouldn't give away much more power than its margin
+    ASSERT_GT(
+        result.final_power_kw,
+        TEST_MAX_POWER_KW - 1.5f * POWER_LIMITER_MARGIN_KW);
+}
+
+TEST_F(PowerLimiterTest, torque_vectoring_split_is_kept_while_limited)
+{
+    const struct MotorTorqueRequests requests = { 0.5f * MAX_TORQUE_REQUEST_NM,
+                                                  MAX_TORQUE_REQUEST_NM };
+
+    const AccelerationResult result = Accelerate(requests, 40.0f, 10000U, true);
+
+    ASSERT_LT(result.final_right_torque_nm, requests.right);
+    ASSERT_NEAR(
+        requests.left / requests.right,
+        result.final_left_torque_nm / result.final_right_torque_nm, 1e-4f);
+    ASSERT_LE(result.max_power_kw, TEST_MAX_POWER_KW);
+}
+
+TEST_F(PowerLimiterTest, feed_forward_limits_power_without_bms_measurements)
+{
+    // Without the measured power, the limiter can't correct its model, but the
+    // torque is still limited from the wheel speed alone. The power only
+    // overshoots the margin by the fixed losses and about 1kW of efficiency
+    // error.
+    const AccelerationResult result = Accelerate(
+        { MAX_TORQUE_REQUEST_NM, MAX_TORQUE_REQUEST_NM }, 40.0f, 10000U, false);
+
+    ASSERT_LE(
+        result.max_power_kw, TEST_MAX_POWER_KW - POWER_LIMITER_MARGIN_KW +
+                                 (float)PLANT_FIXED_LOSSES_KW + 1.0f);
+}
+
+TEST_F(PowerLimiterTest, torque_is_limited_before_power_reaches_limit)
+{
+    // Full torque would draw the maximum power from this speed onwards
+    const float limit_speed_kph =
+        3.6f * (float)PLANT_EFFICIENCY *
+        (TEST_MAX_POWER_KW - (float)PLANT_FIXED_LOSSES_KW) * 1000.0f /
+        (2.0f * MAX_TORQUE_REQUEST_NM * TRACTION_CONTROL_GEAR_RATIO /
+         TRACTION_CONTROL_WHEEL_RADIUS_M);
+
+    const AccelerationResult result = Accelerate(
+        { MAX_TORQUE_REQUEST_NM, MAX_TORQUE_REQUEST_NM }, 40.0f, 10000U, true);
+
+    ASSERT_LT(result.vehicle_speed_at_first_limit_kph, limit_speed_kph);
+}
+
+TEST_F(PowerLimiterTest, regen_torque_requests_are_never_limited)
+{
+    const struct MotorTorqueRequests requests = { -MAX_TORQUE_REQUEST_NM,
+                                                  -MAX_TORQUE_REQUEST_NM };
+
+    const struct MotorTorqueRequests limited =
+        App_PowerLimiter_LimitTorqueRequests(
+            power_limiter, requests, 150.0f, -10.0f, 420.0f, -80.0f);
+
+    ASSERT_EQ(requests.left, limited.left);
+    ASSERT_EQ(requests.right, limited.right);
+}
+
+TEST_F(PowerLimiterTest, missing_bms_measurements_never_loosen_limit)
+{
+    const struct MotorTorqueRequests requests = { MAX_TORQUE_REQUEST_NM,
+                                                  MAX_TORQUE_REQUEST_NM };
+
+    const struct MotorTorqueRequests without_bms =
+        App_PowerLimiter_LimitTorqueRequests(
+            power_limiter, requests, 120.0f, 0.0f, 0.0f, 0.0f);
+
+    for (uint32_t i = 0U; i < 1000U; i++)
+    {
+        const struct MotorTorqueRequests limited =
+            App_PowerLimiter_LimitTorqueRequests(
+                power_limiter, requests, 120.0f, 0.0f, 0.0f, 0.0f);
+        ASSERT_LE(limited.left, without_bms.left);
+    }
+}
+
+} // namespace PowerLimiterTest
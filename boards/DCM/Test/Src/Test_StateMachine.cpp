@@ -9,11 +9,16 @@ extern "C"
 #include "states/App_InitState.h"
 #include "states/App_DriveState.h"
 #include "states/App_FaultState.h"
+#include "states/App_LaunchControlState.h"
 #include "configs/App_HeartbeatMonitorConfig.h"
 #include "configs/App_WaitSignalDuration.h"
 #include "configs/App_AccelerationThresholds.h"
 #include "configs/App_TorqueRequestThresholds.h"
 #include "configs/App_RegenThresholds.h"
+#include "configs/App_LaunchControlConfig.h"
+#include "configs/App_InverterConfig.h"
+#include "configs/App_PowerLimiterConfig.h"
+#include "configs/App_TractionControlConfig.h"
 }
 
 namespace StateMachineTest
@@ -39,6 +44,42 @@ FAKE_VOID_FUNC(turn_off_buzzer);
 FAKE_VALUE_FUNC(float, get_acceleration_x);
 FAKE_VALUE_FUNC(float, get_acceleration_y);
 FAKE_VALUE_FUNC(float, get_acceleration_z);
+FAKE_VALUE_FUNC(float, get_filtered_acceleration_x);
+FAKE_VALUE_FUNC(float, get_filtered_acceleration_y);
+FAKE_VALUE_FUNC(float, get_filtered_acceleration_z);
+FAKE_VALUE_FUNC(float, get_angular_velocity_x);
+FAKE_VALUE_FUNC(float, get_angular_velocity_y);
+FAKE_VALUE_FUNC(float, get_angular_velocity_z);
+FAKE_VALUE_FUNC(uint32_t, get_cycle_count);
+FAKE_VOID_FUNC(transmit_to_inverter, uint32_t, const uint8_t *, uint32_t);
+
+// The last torque setpoint sent to each inverter, in digits
+static int16_t left_inverter_torque_setpoint;
+static int16_t right_inverter_torque_setpoint;
+
+static void RecordInverterTorqueSetpoint(
+    const uint32_t std_id,
+    const uint8_t *data,
+    const uint32_t dlc)
+{
+    const uint8_t torque_setpoint_register_id = 0x90U;
+
+    if (dlc != 3U || data[0] != torque_setpoint_register_id)
+    {
+        return;
+    }
+
+    const int16_t setpoint = (int16_t)((uint16_t)data[1] | (data[2] << 8));
+
+    if (std_id == LEFT_INVERTER_COMMAND_STD_ID)
+    {
+        left_inverter_torque_setpoint = setpoint;
+    }
+    else if (std_id == RIGHT_INVERTER_COMMAND_STD_ID)
+    {
+        right_inverter_torque_setpoint = setpoint;
+    }
+}
 
 class DcmStateMachineTest : public BaseStateMachineTest
 {
@@ -67,16 +108,36 @@ class DcmStateMachineTest : public BaseStateMachineTest
 
         imu = App_Imu_Create(
             get_acceleration_x, get_acceleration_y, get_acceleration_z,
+            get_filtered_acceleration_x, get_filtered_acceleration_y,
+            get_filtered_acceleration_z, get_angular_velocity_x,
+            get_angular_velocity_y, get_angular_velocity_z, get_cycle_count,
             MIN_ACCELERATION_MS2, MAX_ACCELERATION_MS2);
 
+        traction_control = App_TractionControl_Create();
+
+        torque_vectoring = App_TorqueVectoring_Create(get_cycle_count);
+
+        launch_control = App_LaunchControl_Create();
+
+        left_inverter = App_Inverter_Create(
+            LEFT_INVERTER_COMMAND_STD_ID, LEFT_INVERTER_FEEDBACK_STD_ID,
+            transmit_to_inverter);
+        right_inverter = App_Inverter_Create(
+            RIGHT_INVERTER_COMMAND_STD_ID, RIGHT_INVERTER_FEEDBACK_STD_ID,
+            transmit_to_inverter);
+
+        power_limiter = App_PowerLimiter_Create(POWER_LIMITER_MAX_POWER_KW);
+
         error_table = App_SharedErrorTable_Create();
 
         clock = App_SharedClock_Create();
 
         world = App_DcmWorld_Create(
             can_tx_interface, can_rx_interface, heartbeat_monitor,
-            rgb_led_sequence, brake_light, buzzer, imu, error_table, clock,
-            App_BuzzerSignals_IsOn, App_BuzzerSignals_Callback);
+            rgb_led_sequence, brake_light, buzzer, imu, traction_control,
+            torque_vectoring, launch_control, left_inverter, right_inverter,
+            power_limiter, error_table, clock, App_BuzzerSignals_IsOn,
+            App_BuzzerSignals_Callback);
 
         // Default to starting the state machine in the `init` state
         state_machine =
@@ -88,12 +149,28 @@ class DcmStateMachineTest : public BaseStateMachineTest
         RESET_FAKE(get_acceleration_x);
         RESET_FAKE(get_acceleration_y);
         RESET_FAKE(get_acceleration_z);
+        RESET_FAKE(get_filtered_acceleration_x);
+        RESET_FAKE(get_filtered_acceleration_y);
+        RESET_FAKE(get_filtered_acceleration_z);
+        RESET_FAKE(get_angular_velocity_x);
+        RESET_FAKE(get_angular_velocity_y);
+        RESET_FAKE(get_angular_velocity_z);
+        RESET_FAKE(get_cycle_count);
         RESET_FAKE(heartbeat_timeout_callback);
         RESET_FAKE(turn_on_red_led);
         RESET_FAKE(turn_on_green_led);
         RESET_FAKE(turn_on_blue_led);
         RESET_FAKE(turn_on_brake_light);
         RESET_FAKE(turn_off_brake_light);
+        RESET_FAKE(turn_on_buzzer);
+        RESET_FAKE(transmit_to_inverter);
+
+        transmit_to_inverter_fake.custom_fake = RecordInverterTorqueSetpoint;
+        left_inverter_torque_setpoint         = 0;
+        right_inverter_torque_setpoint        = 0;
+
+        driven_wheel_speed_kph          = 0.0f;
+        is_inverter_speed_feedback_sent = true;
     }
 
     void TearDown() override
@@ -107,6 +184,12 @@ class DcmStateMachineTest : public BaseStateMachineTest
         TearDownObject(brake_light, App_BrakeLight_Destroy);
         TearDownObject(buzzer, App_Buzzer_Destroy);
         TearDownObject(imu, App_Imu_Destroy);
+        TearDownObject(traction_control, App_TractionControl_Destroy);
+        TearDownObject(torque_vectoring, App_TorqueVectoring_Destroy);
+        TearDownObject(launch_control, App_LaunchControl_Destroy);
+        TearDownObject(left_inverter, App_Inverter_Destroy);
+        TearDownObject(right_inverter, App_Inverter_Destroy);
+        TearDownObject(power_limiter, App_PowerLimiter_Destroy);
         TearDownObject(error_table, App_SharedErrorTable_Destroy);
         TearDownObject(clock, App_SharedClock_Destroy);
     }
@@ -126,9 +209,70 @@ class DcmStateMachineTest : public BaseStateMachineTest
             App_GetInitState(),
             App_GetDriveState(),
             App_GetFaultState(),
+            App_GetLaunchControlState(),
         };
     }
 
+    // Select launch control on the DIM, and hold the brake with the vehicle
+    // stationary in the drive state until launch control is armed
+    void ArmLaunchControl(void)
+    {
+        SetInitialState(App_GetDriveState());
+
+        App_CanRx_DIM_SWITCHES_SetSignal_START_SWITCH(
+            can_rx_interface, CANMSGS_DIM_SWITCHES_START_SWITCH_ON_CHOICE);
+        App_CanRx_DIM_SWITCHES_SetSignal_TRACTION_CONTROL_SWITCH(
+            can_rx_interface,
+            CANMSGS_DIM_SWITCHES_TRACTION_CONTROL_SWITCH_ON_CHOICE);
+        App_CanRx_DIM_DRIVE_MODE_SWITCH_SetSignal_DRIVE_MODE(
+            can_rx_interface, LAUNCH_CONTROL_DRIVE_MODE);
+        App_CanRx_FSM_BRAKE_SetSignal_BRAKE_IS_ACTUATED(can_rx_interface, true);
+
+        LetTimePass(state_machine, LAUNCH_CONTROL_ARMING_DURATION_MS);
+        ASSERT_EQ(
+            App_GetLaunchControlState(),
+            App_SharedStateMachine_GetCurrentState(state_machine));
+    }
+
+    // Release the brake and floor the accelerator pedal
+    void Launch(void)
+    {
+        App_CanRx_FSM_BRAKE_SetSignal_BRAKE_IS_ACTUATED(
+            can_rx_interface, false);
+        App_CanRx_FSM_PEDAL_POSITION_SetSignal_MAPPED_PEDAL_PERCENTAGE(
+            can_rx_interface, 100.0f);
+    }
+
+    // Send the motor speeds that the given driven wheel speed corresponds to
+    // from both inverters, as the inverters do every few ms while subscribed
+    void SendInverterSpeedFeedback(uint32_t current_time_ms)
+    {
+        const float motor_speed_rpm =
+            driven_wheel_speed_kph /
+            (2.0f * (float)M_PI * TRACTION_CONTROL_WHEEL_RADIUS_M * 60.0f /
+             1000.0f) *
+            TRACTION_CONTROL_GEAR_RATIO;
+        const uint16_t digits = (uint16_t)(int16_t)lroundf(
+            motor_speed_rpm / INVERTER_MAX_SPEED_RPM * 32767.0f);
+        const uint8_t data[3] = { 0x30U, (uint8_t)(digits & 0xFFU),
+                                  (uint8_t)(digits >> 8) };
+
+        App_Inverter_ProcessFrame(
+            left_inverter, LEFT_INVERTER_FEEDBACK_STD_ID, data, 3U,
+            current_time_ms);
+        App_Inverter_ProcessFrame(
+            right_inverter, RIGHT_INVERTER_FEEDBACK_STD_ID, data, 3U,
+            current_time_ms);
+    }
+
+    // Spin the driven wheels at the given speed from the next tick onwards
+    void SetDrivenWheelSpeed(float speed_kph)
+    {
+        driven_wheel_speed_kph = speed_kph;
+        SendInverterSpeedFeedback(
+            App_SharedClock_GetCurrentTimeInMilliseconds(clock));
+    }
+
     void UpdateClock(
         struct StateMachine *state_machine,
         uint32_t             current_time_ms) override
@@ -144,6 +288,11 @@ class DcmStateMachineTest : public BaseStateMachineTest
     {
         struct DcmWorld *world = App_SharedStateMachine_GetWorld(state_machine);
         App_DcmWorld_UpdateWaitSignal(world, current_time_ms);
+
+        if (is_inverter_speed_feedback_sent)
+        {
+            SendInverterSpeedFeedback(current_time_ms);
+        }
     }
 
     struct World *            world;
@@ -155,8 +304,17 @@ class DcmStateMachineTest : public BaseStateMachineTest
     struct BrakeLight *       brake_light;
     struct Buzzer *           buzzer;
     struct Imu *              imu;
+    struct TractionControl *  traction_control;
+    struct TorqueVectoring *  torque_vectoring;
+    struct LaunchControl *    launch_control;
+    struct Inverter *         left_inverter;
+    struct Inverter *         right_inverter;
+    struct PowerLimiter *     power_limiter;
     struct ErrorTable *       error_table;
     struct Clock *            clock;
+
+    float driven_wheel_speed_kph;
+    bool  is_inverter_speed_feedback_sent;
 };
 
 TEST_F(
@@ -200,6 +358,16 @@ TEST_F(DcmStateMachineTest, check_fault_state_is_broadcasted_over_can)
         App_CanTx_GetPeriodicSignal_STATE(can_tx_interface));
 }
 
+// DCM-21
+TEST_F(DcmStateMachineTest, check_launch_control_state_is_broadcasted_over_can)
+{
+    SetInitialState(App_GetLaunchControlState());
+
+    EXPECT_EQ(
+        CANMSGS_DCM_STATE_MACHINE_STATE_LAUNCH_CONTROL_CHOICE,
+        App_CanTx_GetPeriodicSignal_STATE(can_tx_interface));
+}
+
 TEST_F(DcmStateMachineTest, brake_light_control_in_all_states)
 {
     for (const auto &state : GetAllStates())
@@ -580,4 +748,498 @@ TEST_F(
         0.0f, App_CanTx_GetPeriodicSignal_TORQUE_REQUEST(can_tx_interface));
 }
 
+TEST_F(
+    DcmStateMachineTest,
+    traction_control_cuts_torque_request_only_when_switched_on_in_drive_state)
+{
+    SetInitialState(App_GetDriveState());
+
+    // Turn the DIM start switch on to prevent state transitions in
+    // the drive state.
+    App_CanRx_DIM_SWITCHES_SetSignal_START_SWITCH(
+        can_rx_interface, CANMSGS_DIM_SWITCHES_START_SWITCH_ON_CHOICE);
+
+    App_CanRx_FSM_PEDAL_POSITION_SetSignal_MAPPED_PEDAL_PERCENTAGE(
+        can_rx_interface, 100.0f);
+    const float expected_torque_request_value = MAX_TORQUE_REQUEST_NM;
+
+    // Spin the driven wheels at twice the speed of the front wheels
+    App_CanRx_FSM_WHEEL_SPEED_SENSOR_SetSignal_LEFT_WHEEL_SPEED(
+        can_rx_interface, 20.0f);
+    App_CanRx_FSM_WHEEL_SPEED_SENSOR_SetSignal_RIGHT_WHEEL_SPEED(
+        can_rx_interface, 20.0f);
+    SetDrivenWheelSpeed(40.0f);
+
+    // Check that the torque request isn't cut while traction control is off
+    App_CanRx_DIM_SWITCHES_SetSignal_TRACTION_CONTROL_SWITCH(
+        can_rx_interface,
+        CANMSGS_DIM_SWITCHES_TRACTION_CONTROL_SWITCH_OFF_CHOICE);
+    LetTimePass(state_machine, 10);
+    ASSERT_FLOAT_EQ(
+        expected_torque_request_value,
+        App_CanTx_GetPeriodicSignal_TORQUE_REQUEST(can_tx_interface));
+
+    // Check that the torque request is cut on the next 1kHz tick once traction
+    // control is on
+    App_CanRx_DIM_SWITCHES_SetSignal_TRACTION_CONTROL_SWITCH(
+        can_rx_interface,
+        CANMSGS_DIM_SWITCHES_TRACTION_CONTROL_SWITCH_ON_CHOICE);
+    LetTimePass(state_machine, 1);
+    ASSERT_FLOAT_EQ(
+        0.0f, App_CanTx_GetPeriodicSignal_TORQUE_REQUEST(can_tx_interface));
+    ASSERT_TRUE(App_TractionControl_IsActive(traction_control));
+
+    // Check that the torque request is restored once the wheels grip again
+    SetDrivenWheelSpeed(20.0f);
+    LetTimePass(state_machine, 1000);
+    ASSERT_FLOAT_EQ(
+        expected_torque_request_value,
+        App_CanTx_GetPeriodicSignal_TORQUE_REQUEST(can_tx_interface));
+}
+
+TEST_F(
+    DcmStateMachineTest,
+    traction_control_is_disabled_with_fault_when_driven_wheel_speed_is_stale)
+{
+    SetInitialState(App_GetDriveState());
+    App_CanRx_DIM_SWITCHES_SetSignal_START_SWITCH(
+        can_rx_interface, CANMSGS_DIM_SWITCHES_START_SWITCH_ON_CHOICE);
+    App_CanRx_DIM_SWITCHES_SetSignal_TRACTION_CONTROL_SWITCH(
+        can_rx_interface,
+        CANMSGS_DIM_SWITCHES_TRACTION_CONTROL_SWITCH_ON_CHOICE);
+    App_CanRx_FSM_PEDAL_POSITION_SetSignal_MAPPED_PEDAL_PERCENTAGE(
+        can_rx_interface, 100.0f);
+
+    // The driven wheels spin at twice the speed of the front wheels
+    App_CanRx_FSM_WHEEL_SPEED_SENSOR_SetSignal_LEFT_WHEEL_SPEED(
+        can_rx_interface, 20.0f);
+    App_CanRx_FSM_WHEEL_SPEED_SENSOR_SetSignal_RIGHT_WHEEL_SPEED(
+        can_rx_interface, 20.0f);
+    SetDrivenWheelSpeed(40.0f);
+    LetTimePass(state_machine, 10);
+    ASSERT_EQ(
+        CANMSGS_DCM_NON_CRITICAL_ERRORS_DRIVEN_WHEEL_SPEED_IS_STALE_FALSE_CHOICE,
+        App_CanTx_GetPeriodicSignal_DRIVEN_WHEEL_SPEED_IS_STALE(
+            can_tx_interface));
+    ASSERT_TRUE(App_TractionControl_IsActive(traction_control));
+
+    // Once the inverters stop sending their speeds, traction control can't
+    // tell if the driven wheels spin, so it stops cutting the torque
+    is_inverter_speed_feedback_sent = false;
+    LetTimePass(
+        state_machine,
+        INVERTER_STALE_FEEDBACK_PERIODS * INVERTER_SPEED_FEEDBACK_PERIOD_MS +
+            1U);
+    ASSERT_EQ(
+        CANMSGS_DCM_NON_CRITICAL_ERRORS_DRIVEN_WHEEL_SPEED_IS_STALE_TRUE_CHOICE,
+        App_CanTx_GetPeriodicSignal_DRIVEN_WHEEL_SPEED_IS_STALE(
+            can_tx_interface));
+    ASSERT_FALSE(App_TractionControl_IsActive(traction_control));
+    ASSERT_FLOAT_EQ(
+        MAX_TORQUE_REQUEST_NM,
+        App_CanTx_GetPeriodicSignal_TORQUE_REQUEST(can_tx_interface));
+
+    // Traction control is enabled again once the speeds are sent again
+    is_inverter_speed_feedback_sent = true;
+    LetTimePass(state_machine, 2);
+    ASSERT_EQ(
+        CANMSGS_DCM_NON_CRITICAL_ERRORS_DRIVEN_WHEEL_SPEED_IS_STALE_FALSE_CHOICE,
+        App_CanTx_GetPeriodicSignal_DRIVEN_WHEEL_SPEED_IS_STALE(
+            can_tx_interface));
+    ASSERT_TRUE(App_TractionControl_IsActive(traction_control));
+}
+
+TEST_F(
+    DcmStateMachineTest,
+    power_limiter_uses_driven_wheel_speed_from_inverter_feedback)
+{
+    SetInitialState(App_GetDriveState());
+    App_CanRx_DIM_SWITCHES_SetSignal_START_SWITCH(
+        can_rx_interface, CANMSGS_DIM_SWITCHES_START_SWITCH_ON_CHOICE);
+    App_CanRx_FSM_PEDAL_POSITION_SetSignal_MAPPED_PEDAL_PERCENTAGE(
+        can_rx_interface, 100.0f);
+    App_CanRx_FSM_WHEEL_SPEED_SENSOR_SetSignal_LEFT_WHEEL_SPEED(
+        can_rx_interface, 40.0f);
+    App_CanRx_FSM_WHEEL_SPEED_SENSOR_SetSignal_RIGHT_WHEEL_SPEED(
+        can_rx_interface, 40.0f);
+
+    // Without BMS measurements or acceleration, the most torque allowed is the
+    // power below the margin at the motor speed of the given wheel speed
+    const auto max_total_torque_nm = [](float wheel_speed_kph) {
+        return (POWER_LIMITER_MAX_POWER_KW - POWER_LIMITER_MARGIN_KW) *
+               1000.0f * POWER_LIMITER_DRIVETRAIN_EFFICIENCY /
+               (wheel_speed_kph / 3.6f * TRACTION_CONTROL_GEAR_RATIO /
+                TRACTION_CONTROL_WHEEL_RADIUS_M);
+    };
+
+    SetDrivenWheelSpeed(150.0f);
+    LetTimePass(state_machine, 10);
+    ASSERT_NEAR(
+        max_total_torque_nm(150.0f),
+        App_PowerLimiter_GetMaxTotalTorqueNm(power_limiter), 0.01f);
+
+    // The front wheel speed is used instead once the inverters stop sending
+    // their speeds
+    is_inverter_speed_feedback_sent = false;
+    LetTimePass(
+        state_machine,
+        INVERTER_STALE_FEEDBACK_PERIODS * INVERTER_SPEED_FEEDBACK_PERIOD_MS +
+            1U);
+    ASSERT_NEAR(
+        max_total_torque_nm(40.0f),
+        App_PowerLimiter_GetMaxTotalTorqueNm(power_limiter), 0.01f);
+}
+
+TEST_F(
+    DcmStateMachineTest,
+    torque_vectoring_splits_torque_request_only_when_switched_on_in_drive_state)
+{
+    SetInitialState(App_GetDriveState());
+
+    // Turn the DIM start switch on to prevent state transitions in
+    // the drive state.
+    App_CanRx_DIM_SWITCHES_SetSignal_START_SWITCH(
+        can_rx_interface, CANMSGS_DIM_SWITCHES_START_SWITCH_ON_CHOICE);
+
+    App_CanRx_FSM_PEDAL_POSITION_SetSignal_MAPPED_PEDAL_PERCENTAGE(
+        can_rx_interface, 50.0f);
+    const float expected_torque_request_value =
+        50.0f / 100.0f * MAX_TORQUE_REQUEST_NM;
+
+    // Steer left without the vehicle yawing yet
+    App_CanRx_FSM_WHEEL_SPEED_SENSOR_SetSignal_LEFT_WHEEL_SPEED(
+        can_rx_interface, 40.0f);
+    App_CanRx_FSM_WHEEL_SPEED_SENSOR_SetSignal_RIGHT_WHEEL_SPEED(
+        can_rx_interface, 40.0f);
+    App_CanRx_FSM_STEERING_ANGLE_SENSOR_SetSignal_STEERING_ANGLE(
+        can_rx_interface, 20.0f);
+
+    // Check that the torque request is split evenly while torque vectoring is
+    // off
+    App_CanRx_DIM_SWITCHES_SetSignal_TORQUE_VECTORING_SWITCH(
+        can_rx_interface,
+        CANMSGS_DIM_SWITCHES_TORQUE_VECTORING_SWITCH_OFF_CHOICE);
+    LetTimePass(state_machine, 100);
+    ASSERT_FLOAT_EQ(
+        expected_torque_request_value,
+        App_CanTx_GetPeriodicSignal_LEFT_TORQUE_REQUEST(can_tx_interface));
+    ASSERT_FLOAT_EQ(
+        expected_torque_request_value,
+        App_CanTx_GetPeriodicSignal_RIGHT_TORQUE_REQUEST(can_tx_interface));
+
+    // Check that the outer motor gets more torque once torque vectoring is on,
+    // without changing the total torque
+    App_CanRx_DIM_SWITCHES_SetSignal_TORQUE_VECTORING_SWITCH(
+        can_rx_interface,
+        CANMSGS_DIM_SWITCHES_TORQUE_VECTORING_SWITCH_ON_CHOICE);
+    LetTimePass(state_machine, 100);
+    const float left_torque_request =
+        App_CanTx_GetPeriodicSignal_LEFT_TORQUE_REQUEST(can_tx_interface);
+    const float right_torque_request =
+        App_CanTx_GetPeriodicSignal_RIGHT_TORQUE_REQUEST(can_tx_interface);
+    ASSERT_GT(right_torque_request, left_torque_request);
+    ASSERT_FLOAT_EQ(
+        2.0f * expected_torque_request_value,
+        left_torque_request + right_torque_request);
+    ASSERT_FLOAT_EQ(
+        expected_torque_request_value,
+        App_CanTx_GetPeriodicSignal_TORQUE_REQUEST(can_tx_interface));
+
+    // Check that torque goes back to the inner motor once the IMU measures the
+    // vehicle yawing left faster than the driver steers for
+    get_angular_velocity_z_fake.return_val = 2.0f;
+    LetTimePass(state_machine, 1);
+    ASSERT_GT(
+        App_CanTx_GetPeriodicSignal_LEFT_TORQUE_REQUEST(can_tx_interface),
+        App_CanTx_GetPeriodicSignal_RIGHT_TORQUE_REQUEST(can_tx_interface));
+}
+
+TEST_F(
+    DcmStateMachineTest,
+    inverters_are_commanded_with_motor_torque_requests_until_fault_state)
+{
+    SetInitialState(App_GetDriveState());
+
+    // Turn the DIM start switch on to prevent state transitions in
+    // the drive state.
+    App_CanRx_DIM_SWITCHES_SetSignal_START_SWITCH(
+        can_rx_interface, CANMSGS_DIM_SWITCHES_START_SWITCH_ON_CHOICE);
+    App_CanRx_FSM_PEDAL_POSITION_SetSignal_MAPPED_PEDAL_PERCENTAGE(
+        can_rx_interface, 50.0f);
+    LetTimePass(state_machine, 100);
+
+    const int16_t expected_torque_setpoint = (int16_t)lround(
+        50.0f / 100.0f * MAX_TORQUE_REQUEST_NM / INVERTER_MAX_TORQUE_NM *
+        32767.0f);
+    ASSERT_EQ(expected_torque_setpoint, left_inverter_torque_setpoint);
+    ASSERT_EQ(expected_torque_setpoint, right_inverter_torque_setpoint);
+
+    SetInitialState(App_GetFaultState());
+    LetTimePass(state_machine, INVERTER_SETPOINT_PERIOD_MS);
+    ASSERT_EQ(0, left_inverter_torque_setpoint);
+    ASSERT_EQ(0, right_inverter_torque_setpoint);
+}
+
+TEST_F(DcmStateMachineTest, torque_vectoring_benchmark_is_reported_every_second)
+{
+    SetInitialState(App_GetDriveState());
+
+    // Turn the DIM start switch on to prevent state transitions in
+    // the drive state.
+    App_CanRx_DIM_SWITCHES_SetSignal_START_SWITCH(
+        can_rx_interface, CANMSGS_DIM_SWITCHES_START_SWITCH_ON_CHOICE);
+    App_CanRx_DIM_SWITCHES_SetSignal_TORQUE_VECTORING_SWITCH(
+        can_rx_interface,
+        CANMSGS_DIM_SWITCHES_TORQUE_VECTORING_SWITCH_ON_CHOICE);
+
+    // Every torque allocation takes 100 cycles
+    static uint32_t cycle_count;
+    cycle_count                      = 0U;
+    get_cycle_count_fake.custom_fake = []() { return cycle_count += 100U; };
+
+    LetTimePass(state_machine, 1000);
+    ASSERT_EQ(
+        100U, App_CanTx_GetPeriodicSignal_MAX_TORQUE_ALLOCATION_CYCLES(
+                  can_tx_interface));
+
+    // Torque vectoring isn't run while it is off, so nothing is measured
+    App_CanRx_DIM_SWITCHES_SetSignal_TORQUE_VECTORING_SWITCH(
+        can_rx_interface,
+        CANMSGS_DIM_SWITCHES_TORQUE_VECTORING_SWITCH_OFF_CHOICE);
+    LetTimePass(state_machine, 1000);
+    ASSERT_EQ(
+        0U, App_CanTx_GetPeriodicSignal_MAX_TORQUE_ALLOCATION_CYCLES(
+                can_tx_interface));
+}
+
+TEST_F(DcmStateMachineTest, imu_sensor_fusion_runs_in_every_state)
+{
+    // The Imu is mounted level, and the vehicle is turning left
+    get_filtered_acceleration_z_fake.return_val = 9.81f;
+    get_angular_velocity_z_fake.return_val      = 0.5f;
+
+    // Every sensor fusion update takes 100 cycles
+    static uint32_t cycle_count;
+    cycle_count                      = 0U;
+    get_cycle_count_fake.custom_fake = []() { return cycle_count += 100U; };
+
+    for (const auto &state :
+         { App_GetInitState(), App_GetDriveState(), App_GetFaultState() })
+    {
+        SetInitialState(state);
+        const unsigned int call_count = get_cycle_count_fake.call_count;
+
+        // The cycle count is taken before and after every update
+        LetTimePass(state_machine, 10);
+        ASSERT_EQ(call_count + 2U * 10U, get_cycle_count_fake.call_count);
+        ASSERT_FLOAT_EQ(0.5f, App_Imu_GetYawRate(imu));
+    }
+
+    SetInitialState(App_GetDriveState());
+    LetTimePass(state_machine, 1000);
+    ASSERT_FLOAT_EQ(
+        0.5f, App_CanTx_GetPeriodicSignal_YAW_RATE(can_tx_interface));
+    ASSERT_NEAR(
+        0.0f, App_CanTx_GetPeriodicSignal_PITCH(can_tx_interface), 1e-6f);
+    ASSERT_NEAR(
+        0.0f, App_CanTx_GetPeriodicSignal_ROLL(can_tx_interface), 1e-6f);
+    ASSERT_NEAR(
+        0.0f,
+        App_CanTx_GetPeriodicSignal_LONGITUDINAL_ACCELERATION(can_tx_interface),
+        1e-6f);
+    ASSERT_EQ(
+        100U,
+        App_CanTx_GetPeriodicSignal_MAX_SENSOR_FUSION_CYCLES(can_tx_interface));
+}
+
+TEST_F(
+    DcmStateMachineTest,
+    launch_control_arms_when_brake_is_held_while_stationary)
+{
+    ArmLaunchControl();
+
+    // The brake must be held for the whole arming duration
+    SetInitialState(App_GetDriveState());
+    LetTimePass(state_machine, LAUNCH_CONTROL_ARMING_DURATION_MS - 1U);
+    App_CanRx_FSM_BRAKE_SetSignal_BRAKE_IS_ACTUATED(can_rx_interface, false);
+    LetTimePass(state_machine, 1);
+    App_CanRx_FSM_BRAKE_SetSignal_BRAKE_IS_ACTUATED(can_rx_interface, true);
+    LetTimePass(state_machine, LAUNCH_CONTROL_ARMING_DURATION_MS - 1U);
+    ASSERT_EQ(
+        App_GetDriveState(),
+        App_SharedStateMachine_GetCurrentState(state_machine));
+
+    // Launch control isn't armed while the vehicle is moving
+    App_CanRx_FSM_WHEEL_SPEED_SENSOR_SetSignal_LEFT_WHEEL_SPEED(
+        can_rx_interface, 2.0f * LAUNCH_CONTROL_MAX_STATIONARY_SPEED_KPH);
+    LetTimePass(state_machine, 2U * LAUNCH_CONTROL_ARMING_DURATION_MS);
+    ASSERT_EQ(
+        App_GetDriveState(),
+        App_SharedStateMachine_GetCurrentState(state_machine));
+    App_CanRx_FSM_WHEEL_SPEED_SENSOR_SetSignal_LEFT_WHEEL_SPEED(
+        can_rx_interface, 0.0f);
+
+    // Launch control isn't armed in other drive modes, or without traction
+    // control
+    App_CanRx_DIM_DRIVE_MODE_SWITCH_SetSignal_DRIVE_MODE(
+        can_rx_interface,
+        CANMSGS_DIM_DRIVE_MODE_SWITCH_DRIVE_MODE_DRIVE_MODE_1_CHOICE);
+    LetTimePass(state_machine, 2U * LAUNCH_CONTROL_ARMING_DURATION_MS);
+    ASSERT_EQ(
+        App_GetDriveState(),
+        App_SharedStateMachine_GetCurrentState(state_machine));
+    App_CanRx_DIM_DRIVE_MODE_SWITCH_SetSignal_DRIVE_MODE(
+        can_rx_interface, LAUNCH_CONTROL_DRIVE_MODE);
+    App_CanRx_DIM_SWITCHES_SetSignal_TRACTION_CONTROL_SWITCH(
+        can_rx_interface,
+        CANMSGS_DIM_SWITCHES_TRACTION_CONTROL_SWITCH_OFF_CHOICE);
+    LetTimePass(state_machine, 2U * LAUNCH_CONTROL_ARMING_DURATION_MS);
+    ASSERT_EQ(
+        App_GetDriveState(),
+        App_SharedStateMachine_GetCurrentState(state_machine));
+}
+
+TEST_F(DcmStateMachineTest, launch_control_holds_vehicle_while_armed)
+{
+    ArmLaunchControl();
+
+    // No torque is requested while armed, even with the pedal pressed
+    App_CanRx_FSM_PEDAL_POSITION_SetSignal_MAPPED_PEDAL_PERCENTAGE(
+        can_rx_interface, 20.0f);
+    LetTimePass(state_machine, 1000);
+    ASSERT_EQ(
+        App_GetLaunchControlState(),
+        App_SharedStateMachine_GetCurrentState(state_machine));
+    ASSERT_FLOAT_EQ(
+        0.0f, App_CanTx_GetPeriodicSignal_TORQUE_REQUEST(can_tx_interface));
+    ASSERT_EQ(
+        LAUNCH_CONTROL_ARMED, App_LaunchControl_GetStatus(launch_control));
+}
+
+TEST_F(
+    DcmStateMachineTest,
+    launch_control_follows_torque_profile_and_hands_over_to_traction_control)
+{
+    const float
+        torque_profile_percentage[LAUNCH_CONTROL_TORQUE_PROFILE_LENGTH] =
+            LAUNCH_CONTROL_TORQUE_PROFILE;
+
+    ArmLaunchControl();
+    const unsigned int buzzer_call_count = turn_on_buzzer_fake.call_count;
+
+    // The torque request follows the torque profile from the tick the pedal
+    // is floored
+    Launch();
+    LetTimePass(state_machine, 1);
+    ASSERT_EQ(
+        LAUNCH_CONTROL_LAUNCHING, App_LaunchControl_GetStatus(launch_control));
+    ASSERT_FLOAT_EQ(
+        0.01f * torque_profile_percentage[0] * MAX_TORQUE_REQUEST_NM,
+        App_CanTx_GetPeriodicSignal_TORQUE_REQUEST(can_tx_interface));
+
+    LetTimePass(state_machine, 10U * LAUNCH_CONTROL_TORQUE_PROFILE_STEP_MS);
+    ASSERT_FLOAT_EQ(
+        0.01f * torque_profile_percentage[10] * MAX_TORQUE_REQUEST_NM,
+        App_CanTx_GetPeriodicSignal_TORQUE_REQUEST(can_tx_interface));
+
+    // The driven wheels spin on the last tick of the torque profile, so
+    // traction control cuts the torque
+    LetTimePass(
+        state_machine, (LAUNCH_CONTROL_TORQUE_PROFILE_LENGTH - 10U) *
+                               LAUNCH_CONTROL_TORQUE_PROFILE_STEP_MS -
+                           2U);
+    SetDrivenWheelSpeed(10.0f);
+    LetTimePass(state_machine, 1);
+    ASSERT_EQ(
+        App_GetLaunchControlState(),
+        App_SharedStateMachine_GetCurrentState(state_machine));
+    ASSERT_TRUE(App_TractionControl_IsActive(traction_control));
+    ASSERT_FLOAT_EQ(
+        0.0f, App_CanTx_GetPeriodicSignal_TORQUE_REQUEST(can_tx_interface));
+
+    // Traction control keeps cutting the torque once the drive state takes
+    // over at the end of the torque profile, without sounding the buzzer
+    LetTimePass(state_machine, 1);
+    ASSERT_EQ(
+        App_GetDriveState(),
+        App_SharedStateMachine_GetCurrentState(state_machine));
+    ASSERT_EQ(
+        LAUNCH_CONTROL_DISABLED, App_LaunchControl_GetStatus(launch_control));
+    ASSERT_EQ(buzzer_call_count, turn_on_buzzer_fake.call_count);
+    LetTimePass(state_machine, 1);
+    ASSERT_TRUE(App_TractionControl_IsActive(traction_control));
+    ASSERT_FLOAT_EQ(
+        0.0f, App_CanTx_GetPeriodicSignal_TORQUE_REQUEST(can_tx_interface));
+
+    // The full torque request is restored once the wheels grip again
+    SetDrivenWheelSpeed(0.0f);
+    LetTimePass(state_machine, 1000);
+    ASSERT_FLOAT_EQ(
+        MAX_TORQUE_REQUEST_NM,
+        App_CanTx_GetPeriodicSignal_TORQUE_REQUEST(can_tx_interface));
+}
+
+TEST_F(DcmStateMachineTest, launch_control_aborts_when_pedal_is_lifted)
+{
+    ArmLaunchControl();
+    Launch();
+    LetTimePass(state_machine, 100);
+
+    // The drive state takes over with the torque the driver asks for
+    App_CanRx_FSM_PEDAL_POSITION_SetSignal_MAPPED_PEDAL_PERCENTAGE(
+        can_rx_interface, 50.0f);
+    LetTimePass(state_machine, 1);
+    ASSERT_EQ(
+        App_GetDriveState(),
+        App_SharedStateMachine_GetCurrentState(state_machine));
+    ASSERT_FLOAT_EQ(
+        0.5f * MAX_TORQUE_REQUEST_NM,
+        App_CanTx_GetPeriodicSignal_TORQUE_REQUEST(can_tx_interface));
+}
+
+TEST_F(
+    DcmStateMachineTest,
+    launch_control_aborts_when_pedal_is_not_floored_after_brake_release)
+{
+    ArmLaunchControl();
+
+    App_CanRx_FSM_BRAKE_SetSignal_BRAKE_IS_ACTUATED(can_rx_interface, false);
+    LetTimePass(state_machine, LAUNCH_CONTROL_MAX_PEDAL_DELAY_MS);
+    ASSERT_EQ(
+        App_GetLaunchControlState(),
+        App_SharedStateMachine_GetCurrentState(state_machine));
+
+    LetTimePass(state_machine, 1);
+    ASSERT_EQ(
+        App_GetDriveState(),
+        App_SharedStateMachine_GetCurrentState(state_machine));
+}
+
+TEST_F(DcmStateMachineTest, launch_control_aborts_when_deselected)
+{
+    ArmLaunchControl();
+
+    App_CanRx_DIM_SWITCHES_SetSignal_TRACTION_CONTROL_SWITCH(
+        can_rx_interface,
+        CANMSGS_DIM_SWITCHES_TRACTION_CONTROL_SWITCH_OFF_CHOICE);
+    LetTimePass(state_machine, 1);
+    ASSERT_EQ(
+        App_GetDriveState(),
+        App_SharedStateMachine_GetCurrentState(state_machine));
+
+    // Turning the start switch off while launching goes back to the init state
+    App_CanRx_DIM_SWITCHES_SetSignal_TRACTION_CONTROL_SWITCH(
+        can_rx_interface,
+        CANMSGS_DIM_SWITCHES_TRACTION_CONTROL_SWITCH_ON_CHOICE);
+    ArmLaunchControl();
+    Launch();
+    LetTimePass(state_machine, 1);
+    App_CanRx_DIM_SWITCHES_SetSignal_START_SWITCH(
+        can_rx_interface, CANMSGS_DIM_SWITCHES_START_SWITCH_OFF_CHOICE);
+    LetTimePass(state_machine, 10);
+    ASSERT_EQ(
+        App_GetInitState(),
+        App_SharedStateMachine_GetCurrentState(state_machine));
+}
+
 } // namespace StateMachineTest
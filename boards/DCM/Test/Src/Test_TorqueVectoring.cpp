@@ -0,0 +1,220 @@
+#include <cmath>
+#include "Test_Dcm.h"
+
+extern "C"
+{
+#include "App_TorqueVectoring.h"
+#include "configs/App_TorqueVectoringConfig.h"
+#include "configs/App_TorqueRequestThresholds.h"
+}
+
+FAKE_VALUE_FUNC(uint32_t, get_torque_vectoring_cycle_count);
+
+class TorqueVectoringTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        torque_vectoring =
+            App_TorqueVectoring_Create(get_torque_vectoring_cycle_count);
+        RESET_FAKE(get_torque_vectoring_cycle_count);
+    }
+
+    void TearDown() override
+    {
+        TearDownObject(torque_vectoring, App_TorqueVectoring_Destroy);
+    }
+
+    // Allocate the same torque request for long enough that the reference yaw
+    // rate settles
+    struct MotorTorqueRequests AllocateSteadyState(
+        float torque_request,
+        float steering_angle,
+        float vehicle_speed_kph,
+        float yaw_rate)
+    {
+        struct MotorTorqueRequests motor_torque_requests = { 0.0f, 0.0f };
+
+        for (uint32_t i = 0U; i < 1000U; i++)
+        {
+            motor_torque_requests = App_TorqueVectoring_AllocateTorqueRequest(
+                torque_vectoring, torque_request, steering_angle,
+                vehicle_speed_kph, yaw_rate);
+        }
+
+        return motor_torque_requests;
+    }
+
+    // The steady-state yaw rate of the reference model, in rad/s
+    static float
+        GetSteadyStateYawRate(float steering_angle, float vehicle_speed_kph)
+    {
+        const float vehicle_speed    = vehicle_speed_kph / 3.6f;
+        const float road_wheel_angle = steering_angle * (float)M_PI / 180.0f /
+                                       TORQUE_VECTORING_STEERING_RATIO;
+
+        return vehicle_speed * road_wheel_angle /
+               (TORQUE_VECTORING_WHEELBASE_M +
+                TORQUE_VECTORING_UNDERSTEER_GRADIENT_S2_PER_M * vehicle_speed *
+                    vehicle_speed);
+    }
+
+    struct TorqueVectoring *torque_vectoring;
+};
+
+TEST_F(TorqueVectoringTest, torque_request_is_split_evenly_when_going_straight)
+{
+    const struct MotorTorqueRequests motor_torque_requests =
+        AllocateSteadyState(10.0f, 0.0f, 60.0f, 0.0f);
+
+    ASSERT_EQ(10.0f, motor_torque_requests.left);
+    ASSERT_EQ(10.0f, motor_torque_requests.right);
+}
+
+TEST_F(TorqueVectoringTest, reference_yaw_rate_follows_bicycle_model)
+{
+    AllocateSteadyState(10.0f, 30.0f, 40.0f, 0.0f);
+    ASSERT_NEAR(
+        GetSteadyStateYawRate(30.0f, 40.0f),
+        App_TorqueVectoring_GetReferenceYawRate(torque_vectoring), 0.001f);
+
+    // The reference yaw rate lags behind the steering
+    App_TorqueVectoring_Reset(torque_vectoring);
+    App_TorqueVectoring_AllocateTorqueRequest(
+        torque_vectoring, 10.0f, 30.0f, 40.0f, 0.0f);
+    ASSERT_LT(
+        App_TorqueVectoring_GetReferenceYawRate(torque_vectoring),
+        0.1f * GetSteadyStateYawRate(30.0f, 40.0f));
+}
+
+TEST_F(TorqueVectoringTest, reference_yaw_rate_is_limited_by_lateral_grip)
+{
+    // At 80km/h, a 90 deg steering angle would take over 3g of lateral
+    // acceleration
+    const float vehicle_speed = 80.0f / 3.6f;
+    ASSERT_GT(
+        GetSteadyStateYawRate(90.0f, 80.0f) * vehicle_speed,
+        TORQUE_VECTORING_MAX_LATERAL_ACCELERATION_MPS2);
+
+    AllocateSteadyState(10.0f, 90.0f, 80.0f, 0.0f);
+    ASSERT_NEAR(
+        TORQUE_VECTORING_MAX_LATERAL_ACCELERATION_MPS2 / vehicle_speed,
+        App_TorqueVectoring_GetReferenceYawRate(torque_vectoring), 0.001f);
+
+    AllocateSteadyState(10.0f, -90.0f, 80.0f, 0.0f);
+    ASSERT_NEAR(
+        -TORQUE_VECTORING_MAX_LATERAL_ACCELERATION_MPS2 / vehicle_speed,
+        App_TorqueVectoring_GetReferenceYawRate(torque_vectoring), 0.001f);
+}
+
+TEST_F(TorqueVectoringTest, outer_motor_gets_more_torque_when_turning)
+{
+    const float reference_yaw_rate = GetSteadyStateYawRate(20.0f, 40.0f);
+
+    // Turning left at the reference yaw rate, only the feed-forward acts
+    struct MotorTorqueRequests motor_torque_requests =
+        AllocateSteadyState(10.0f, 20.0f, 40.0f, reference_yaw_rate);
+    ASSERT_NEAR(
+        TORQUE_VECTORING_FEED_FORWARD_GAIN_NM_S * reference_yaw_rate,
+        motor_torque_requests.right - motor_torque_requests.left, 0.001f);
+    ASSERT_FLOAT_EQ(
+        20.0f, motor_torque_requests.left + motor_torque_requests.right);
+
+    // Turning right mirrors the split
+    motor_torque_requests =
+        AllocateSteadyState(10.0f, -20.0f, 40.0f, -reference_yaw_rate);
+    ASSERT_NEAR(
+        -TORQUE_VECTORING_FEED_FORWARD_GAIN_NM_S * reference_yaw_rate,
+        motor_torque_requests.right - motor_torque_requests.left, 0.001f);
+}
+
+TEST_F(TorqueVectoringTest, yaw_rate_error_corrects_understeer_and_oversteer)
+{
+    const float reference_yaw_rate = GetSteadyStateYawRate(20.0f, 40.0f);
+    const float feed_forward_torque_difference =
+        TORQUE_VECTORING_FEED_FORWARD_GAIN_NM_S * reference_yaw_rate;
+
+    // Understeering, so even more torque goes to the outer motor
+    struct MotorTorqueRequests motor_torque_requests =
+        AllocateSteadyState(10.0f, 20.0f, 40.0f, 0.5f * reference_yaw_rate);
+    ASSERT_GT(
+        motor_torque_requests.right - motor_torque_requests.left,
+        feed_forward_torque_difference);
+
+    // Oversteering, so torque goes back to the inner motor
+    motor_torque_requests =
+        AllocateSteadyState(10.0f, 20.0f, 40.0f, 2.0f * reference_yaw_rate);
+    ASSERT_LT(
+        motor_torque_requests.right - motor_torque_requests.left,
+        feed_forward_torque_difference);
+}
+
+TEST_F(TorqueVectoringTest, motor_torque_requests_stay_within_motor_limits)
+{
+    // Both turning directions, while understeering badly enough to saturate
+    // the torque difference
+    for (const float steering_angle : { 90.0f, -90.0f })
+    {
+        for (float torque_request = 0.5f;
+             torque_request <= MAX_TORQUE_REQUEST_NM; torque_request += 0.5f)
+        {
+            const struct MotorTorqueRequests motor_torque_requests =
+                AllocateSteadyState(
+                    torque_request, steering_angle, 60.0f, 0.0f);
+            const float torque_difference = std::fabs(
+                motor_torque_requests.right - motor_torque_requests.left);
+
+            ASSERT_GE(motor_torque_requests.left, 0.0f);
+            ASSERT_GE(motor_torque_requests.right, 0.0f);
+            ASSERT_LE(motor_torque_requests.left, MAX_TORQUE_REQUEST_NM);
+            ASSERT_LE(motor_torque_requests.right, MAX_TORQUE_REQUEST_NM);
+            ASSERT_LE(
+                torque_difference,
+                TORQUE_VECTORING_MAX_TORQUE_DIFFERENCE_NM + 0.001f);
+
+            // Light torque requests are split without adding torque, and heavy
+            // ones give up total torque rather than yaw moment
+            ASSERT_LE(
+                motor_torque_requests.left + motor_torque_requests.right,
+                2.0f * torque_request + 0.001f);
+            if (torque_request >=
+                0.5f * TORQUE_VECTORING_MAX_TORQUE_DIFFERENCE_NM)
+            {
+                ASSERT_NEAR(
+                    TORQUE_VECTORING_MAX_TORQUE_DIFFERENCE_NM,
+                    torque_difference, 0.001f);
+            }
+        }
+    }
+}
+
+TEST_F(TorqueVectoringTest, torque_is_not_vectored_when_slow_or_regenerating)
+{
+    struct MotorTorqueRequests motor_torque_requests = AllocateSteadyState(
+        10.0f, 90.0f, TORQUE_VECTORING_MIN_VEHICLE_SPEED_KPH, 0.0f);
+    ASSERT_EQ(10.0f, motor_torque_requests.left);
+    ASSERT_EQ(10.0f, motor_torque_requests.right);
+
+    motor_torque_requests = AllocateSteadyState(-10.0f, 90.0f, 60.0f, 0.0f);
+    ASSERT_EQ(-10.0f, motor_torque_requests.left);
+    ASSERT_EQ(-10.0f, motor_torque_requests.right);
+}
+
+TEST_F(TorqueVectoringTest, max_torque_allocation_cycles_are_taken_and_reset)
+{
+    // Every torque allocation takes 100 cycles
+    static uint32_t cycle_count;
+    cycle_count                                       = 0U;
+    get_torque_vectoring_cycle_count_fake.custom_fake = []() {
+        return cycle_count += 100U;
+    };
+
+    App_TorqueVectoring_AllocateTorqueRequest(
+        torque_vectoring, 10.0f, 90.0f, 60.0f, 0.0f);
+    ASSERT_EQ(
+        100U,
+        App_TorqueVectoring_TakeMaxTorqueAllocationCycles(torque_vectoring));
+    ASSERT_EQ(
+        0U,
+        App_TorqueVectoring_TakeMaxTorqueAllocationCycles(torque_vectoring));
+}
@@ -0,0 +1,227 @@
+#include <math.h>
+#include "Test_Dcm.h"
+
+extern "C"
+{
+#include "App_TractionControl.h"
+#include "configs/App_TractionControlConfig.h"
+#include "configs/App_TorqueRequestThresholds.h"
+}
+
+class TractionControlTest : public testing::Test
+{
+  protected:
+    void SetUp() override { traction_control = App_TractionControl_Create(); }
+
+    void TearDown() override
+    {
+        TearDownObject(traction_control, App_TractionControl_Destroy);
+    }
+
+    struct LaunchResult
+    {
+        float vehicle_speed_kph;
+        float mean_slip_ratio;
+        float max_torque_cut;
+    };
+
+    // Launch from standstill with the accelerator pedal fully pressed, on a
+    // surface of the given peak friction coefficient. The rear axle follows a
+    // simplified Pacejka tyre model, and is simulated in steps much shorter
+    // than a traction control tick since the spin-up of the wheels is fast.
+    LaunchResult Launch(
+        float    peak_friction_coefficient,
+        bool     is_traction_control_enabled,
+        uint32_t duration_ms)
+    {
+        constexpr double STIFFNESS_FACTOR     = 10.0;
+        constexpr double SHAPE_FACTOR         = 1.9;
+        constexpr double REAR_AXLE_LOAD_RATIO = 0.5;
+        constexpr double REAR_AXLE_INERTIA    = 0.5;
+        constexpr double MIN_SLIP_SPEED_MPS   = 0.5;
+        constexpr double SUBSTEP_S            = 1e-5;
+        constexpr double MASS         = TRACTION_CONTROL_VEHICLE_MASS_KG;
+        constexpr double WHEEL_RADIUS = TRACTION_CONTROL_WHEEL_RADIUS_M;
+
+        const double rear_axle_load = REAR_AXLE_LOAD_RATIO * MASS * 9.81;
+
+        double vehicle_speed_mps      = 0.0;
+        double wheel_angular_velocity = 0.0;
+        double acceleration           = 0.0;
+
+        LaunchResult result     = { 0.0f, 0.0f, 0.0f };
+        double       slip_sum   = 0.0;
+        uint32_t     num_slips  = 0U;
+        const float  full_pedal = MAX_TORQUE_REQUEST_NM;
+
+        for (uint32_t ms = 0U; ms < duration_ms; ms++)
+        {
+            float torque_request = full_pedal;
+            if (is_traction_control_enabled)
+            {
+                torque_request = App_TractionControl_LimitTorqueRequest(
+                    traction_control, full_pedal,
+                    (float)(vehicle_speed_mps * 3.6),
+                    (float)(wheel_angular_velocity * WHEEL_RADIUS * 3.6),
+                    (float)acceleration);
+            }
+            result.max_torque_cut =
+                fmaxf(result.max_torque_cut, full_pedal - torque_request);
+
+            const double axle_torque = torque_request *
+                                       TRACTION_CONTROL_GEAR_RATIO *
+                                       TRACTION_CONTROL_NUM_MOTORS;
+            double slip_ratio = 0.0;
+
+            for (double t = 0.0; t < 1e-3; t += SUBSTEP_S)
+            {
+                slip_ratio = (wheel_angular_velocity * WHEEL_RADIUS -
+                              vehicle_speed_mps) /
+                             fmax(vehicle_speed_mps, MIN_SLIP_SPEED_MPS);
+
+                const double tyre_force =
+                    rear_axle_load * peak_friction_coefficient *
+                    sin(SHAPE_FACTOR * atan(STIFFNESS_FACTOR * slip_ratio));
+
+                wheel_angular_velocity +=
+                    SUBSTEP_S * (axle_torque - tyre_force * WHEEL_RADIUS) /
+                    REAR_AXLE_INERTIA;
+                acceleration = tyre_force / MASS;
+                vehicle_speed_mps += SUBSTEP_S * acceleration;
+            }
+
+            // Only average the slip once the vehicle is rolling
+            if (ms >= duration_ms / 2U)
+            {
+                slip_sum += slip_ratio;
+                num_slips++;
+            }
+        }
+
+        result.vehicle_speed_kph = (float)(vehicle_speed_mps * 3.6);
+        result.mean_slip_ratio   = (float)(slip_sum / num_slips);
+
+        return result;
+    }
+
+    struct TractionControl *traction_control;
+};
+
+TEST_F(TractionControlTest, torque_request_is_not_limited_below_target_slip)
+{
+    for (uint32_t i = 0U; i < 100U; i++)
+    {
+        ASSERT_EQ(
+            10.0f, App_TractionControl_LimitTorqueRequest(
+                       traction_control, 10.0f, 38.0f, 40.0f, 0.0f));
+    }
+
+    ASSERT_FALSE(App_TractionControl_IsActive(traction_control));
+    ASSERT_NEAR(
+        2.0f / 38.0f, App_TractionControl_GetSlipRatio(traction_control),
+        0.001f);
+}
+
+TEST_F(TractionControlTest, torque_is_cut_while_driven_wheels_spin)
+{
+    // The driven wheels spin at twice the vehicle speed, and the vehicle
+    // isn't accelerating, so the tyres can't transmit any torque
+    ASSERT_EQ(
+        0.0f, App_TractionControl_LimitTorqueRequest(
+                  traction_control, 10.0f, 20.0f, 40.0f, 0.0f));
+    ASSERT_TRUE(App_TractionControl_IsActive(traction_control));
+
+    // Once the wheels grip again, the torque is restored gradually
+    float previous_torque_request = 0.0f;
+    for (uint32_t i = 0U; i < 1000U; i++)
+    {
+        const float torque_request = App_TractionControl_LimitTorqueRequest(
+            traction_control, 10.0f, 20.0f, 20.0f, 0.0f);
+        ASSERT_GE(torque_request, previous_torque_request);
+        previous_torque_request = torque_request;
+    }
+
+    ASSERT_EQ(10.0f, previous_torque_request);
+    ASSERT_FALSE(App_TractionControl_IsActive(traction_control));
+}
+
+TEST_F(TractionControlTest, feed_forward_keeps_torque_that_tyres_can_transmit)
+{
+    // The tyres transmit the torque accelerating the vehicle at 2m/s^2, so the
+    // torque is only cut down to below that while slightly over the target
+    const float acceleration = 2.0f;
+    const float full_pedal   = MAX_TORQUE_REQUEST_NM;
+    const float feed_forward_torque =
+        TRACTION_CONTROL_VEHICLE_MASS_KG * acceleration *
+        TRACTION_CONTROL_WHEEL_RADIUS_M /
+        (TRACTION_CONTROL_GEAR_RATIO * TRACTION_CONTROL_NUM_MOTORS);
+
+    const float driven_wheel_speed_kph =
+        40.0f * (1.0f + TRACTION_CONTROL_TARGET_SLIP_RATIO + 0.01f);
+    const float torque_request = App_TractionControl_LimitTorqueRequest(
+        traction_control, full_pedal, 40.0f, driven_wheel_speed_kph,
+        acceleration);
+
+    ASSERT_LT(torque_request, feed_forward_torque);
+    ASSERT_GT(torque_request, 0.9f * feed_forward_torque);
+}
+
+TEST_F(TractionControlTest, regen_torque_requests_are_never_limited)
+{
+    ASSERT_EQ(
+        0.0f, App_TractionControl_LimitTorqueRequest(
+                  traction_control, 10.0f, 20.0f, 40.0f, 0.0f));
+
+    ASSERT_EQ(
+        -10.0f, App_TractionControl_LimitTorqueRequest(
+                    traction_control, -10.0f, 20.0f, 40.0f, 0.0f));
+    ASSERT_FALSE(App_TractionControl_IsActive(traction_control));
+}
+
+TEST_F(TractionControlTest, vehicle_speed_fuses_acceleration_and_wheel_speed)
+{
+    App_TractionControl_LimitTorqueRequest(
+        traction_control, 0.0f, 36.0f, 0.0f, 0.0f);
+    ASSERT_EQ(36.0f, App_TractionControl_GetVehicleSpeedKph(traction_control));
+
+    // Between wheel speed updates, the acceleration is integrated
+    App_TractionControl_LimitTorqueRequest(
+        traction_control, 0.0f, 36.0f, 0.0f, 10.0f);
+    ASSERT_GT(App_TractionControl_GetVehicleSpeedKph(traction_control), 36.0f);
+
+    // Without acceleration, the estimate converges to the wheel speed
+    for (uint32_t i = 0U; i < 1000U; i++)
+    {
+        App_TractionControl_LimitTorqueRequest(
+            traction_control, 0.0f, 54.0f, 0.0f, 0.0f);
+    }
+    ASSERT_NEAR(
+        54.0f, App_TractionControl_GetVehicleSpeedKph(traction_control), 0.01f);
+}
+
+TEST_F(TractionControlTest, traction_control_holds_target_slip_on_low_grip)
+{
+    const LaunchResult with_traction_control = Launch(0.3f, true, 3000U);
+
+    TearDownObject(traction_control, App_TractionControl_Destroy);
+    traction_control                            = App_TractionControl_Create();
+    const LaunchResult without_traction_control = Launch(0.3f, false, 3000U);
+
+    // Without traction control the wheels spin up far past the peak friction,
+    // and the vehicle accelerates much slower than with traction control
+    ASSERT_GT(without_traction_control.mean_slip_ratio, 10.0f);
+    ASSERT_NEAR(
+        TRACTION_CONTROL_TARGET_SLIP_RATIO,
+        with_traction_control.mean_slip_ratio, 0.02f);
+    ASSERT_GT(
+        with_traction_control.vehicle_speed_kph,
+        2.0f * without_traction_control.vehicle_speed_kph);
+}
+
+TEST_F(TractionControlTest, traction_control_does_not_cut_torque_on_high_grip)
+{
+    const LaunchResult result = Launch(1.0f, true, 3000U);
+
+    ASSERT_EQ(0.0f, result.max_torque_cut);
+    ASSERT_LT(result.mean_slip_ratio, TRACTION_CONTROL_TARGET_SLIP_RATIO);
+}
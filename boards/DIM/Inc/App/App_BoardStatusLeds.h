@@ -0,0 +1,47 @@
+#pragma once
+
+#include <stdint.h>
+#include "App_SharedErrorTable.h"
+#include "App_SharedRgbLed.h"
+
+struct BoardStatusLeds;
+
+/**
+ * Allocate and initialize the status LEDs of the boards, which show whether
+ * each board has a critical error (blinking red), a non-critical error (blue)
+ * or no error (green). The status LEDs are only recomputed when the error table
+ * notifies them that an error of their board was set or cleared.
+ * @note This registers the error changed callback of the given error table
+ * @param error_table The error table to show the errors of
+ * @param bms_status_led The status LED of the BMS
+ * @param dcm_status_led The status LED of the DCM
+ * @param dim_status_led The status LED of the DIM
+ * @param fsm_status_led The status LED of the FSM
+ * @param pdm_status_led The status LED of the PDM
+ * @return The created board status LEDs, whose ownership is given to the caller
+ */
+struct BoardStatusLeds *App_BoardStatusLeds_Create(
+    struct ErrorTable *error_table,
+    struct RgbLed *    bms_status_led,
+    struct RgbLed *    dcm_status_led,
+    struct RgbLed *    dim_status_led,
+    struct RgbLed *    fsm_status_led,
+    struct RgbLed *    pdm_status_led);
+
+/**
+ * Deallocate the memory used by the given board status LEDs, and stop them
+ * from watching their error table
+ * @param board_status_leds The board status LEDs to deallocate
+ */
+void App_BoardStatusLeds_Destroy(struct BoardStatusLeds *board_status_leds);
+
+/**
+ * Update the given board status LEDs, only writing to the LEDs whose colour
+ * changed since the last update
+ * @param board_status_leds The board status LEDs to update
+ * @param current_time_ms The current time, in ms, which times the blinking of
+ *                        every status LED
+ */
+void App_BoardStatusLeds_Tick(
+    struct BoardStatusLeds *board_status_leds,
+    uint32_t                current_time_ms);
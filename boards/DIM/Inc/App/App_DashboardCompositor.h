@@ -0,0 +1,126 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "App_SharedConstants.h"
+#include "App_SevenSegDisplays.h"
+#include "App_Led.h"
+
+// The sources of display requests. Each source has one request at a time, and
+// among requests of the same severity, the one from the source listed first
+// wins the 7-segment displays.
+enum DashboardSource
+{
+    DASHBOARD_SOURCE_CELL_MONITOR_OVER_TEMPERATURE,
+    DASHBOARD_SOURCE_ERRORS,
+    DASHBOARD_SOURCE_IMD,
+    DASHBOARD_SOURCE_BSPD,
+    DASHBOARD_SOURCE_PAGES,
+    NUM_DASHBOARD_SOURCES,
+};
+
+enum DashboardSeverity
+{
+    DASHBOARD_SEVERITY_INFO,
+    DASHBOARD_SEVERITY_WARNING,
+    DASHBOARD_SEVERITY_CRITICAL,
+};
+
+enum DashboardSevenSegFormat
+{
+    // The request doesn't use the 7-segment displays
+    DASHBOARD_SEVEN_SEG_NONE,
+    // An unsigned base-10 value, up to MAX_UNSIGNED_BASE10_VALUE
+    DASHBOARD_SEVEN_SEG_VALUE,
+    // A prefix followed by an unsigned base-10 value, up to
+    // MAX_PREFIXED_UNSIGNED_BASE10_VALUE
+    DASHBOARD_SEVEN_SEG_PREFIXED_VALUE,
+};
+
+enum DashboardLed
+{
+    DASHBOARD_IMD_LED,
+    DASHBOARD_BSPD_LED,
+    NUM_DASHBOARD_LEDS,
+};
+
+#define DASHBOARD_LED_MASK(led) (1U << (led))
+
+struct DashboardRequest
+{
+    enum DashboardSeverity severity;
+
+    // What to show on the 7-segment displays, if the request wins them. Values
+    // too large to be shown are clamped.
+    enum DashboardSevenSegFormat seven_seg_format;
+    enum HexDigit                prefix;
+    uint32_t                     value;
+
+    // The LEDs to turn on, as DASHBOARD_LED_MASK() bits. The LEDs of every
+    // request are shown together.
+    uint32_t led_mask;
+
+    // Whether the 7-segment displays and LEDs of the request blink
+    bool is_blinking;
+
+    // How long the request is shown for after it is posted, or 0 to show it
+    // until it is cancelled, in ms
+    uint32_t timeout_ms;
+};
+
+struct DashboardCompositor;
+
+/**
+ * Allocate and initialize a compositor, which arbitrates the requests posted by
+ * each source into a frame for the dashboard and renders the frame
+ * @param seven_seg_displays The group of 7-segment displays to render to
+ * @param imd_led The IMD LED to render to
+ * @param bspd_led The BSPD LED to render to
+ * @return The created compositor, whose ownership is given to the caller
+ */
+struct DashboardCompositor *App_DashboardCompositor_Create(
+    const struct SevenSegDisplays *seven_seg_displays,
+    const struct Led *             imd_led,
+    const struct Led *             bspd_led);
+
+/**
+ * Deallocate the memory used by the given compositor
+ * @param compositor The compositor to deallocate
+ */
+void App_DashboardCompositor_Destroy(struct DashboardCompositor *compositor);
+
+/**
+ * Post a request to the given compositor, replacing any request of the same
+ * source
+ * @note This must be called from the same task as App_DashboardCompositor_Tick
+ * @param compositor The compositor to post the request to
+ * @param source The source of the request
+ * @param request The request to post, which is copied
+ * @param current_time_ms The current time, from which the timeout of the
+ *                        request counts, in ms
+ */
+void App_DashboardCompositor_Post(
+    struct DashboardCompositor *   compositor,
+    enum DashboardSource           source,
+    const struct DashboardRequest *request,
+    uint32_t                       current_time_ms);
+
+/**
+ * Cancel the request of a source, if any
+ * @note This must be called from the same task as App_DashboardCompositor_Tick
+ * @param compositor The compositor to cancel the request of
+ * @param source The source whose request to cancel
+ */
+void App_DashboardCompositor_Cancel(
+    struct DashboardCompositor *compositor,
+    enum DashboardSource        source);
+
+/**
+ * Compose the frame for the current time from the active requests of the given
+ * compositor, and render the parts of it that changed since the last frame
+ * @param compositor The compositor to compose and render the frame of
+ * @param current_time_ms The current time, in ms
+ */
+void App_DashboardCompositor_Tick(
+    struct DashboardCompositor *compositor,
+    uint32_t                    current_time_ms);
@@ -11,6 +11,8 @@
 #include "App_BinarySwitch.h"
 #include "App_SharedErrorTable.h"
 #include "App_SharedRgbLed.h"
+#include "App_BoardStatusLeds.h"
+#include "App_DashboardCompositor.h"
 #include "App_SharedClock.h"
 
 struct DimWorld;
@@ -25,25 +27,27 @@ struct DimWorld;
  * caller
  */
 struct DimWorld *App_DimWorld_Create(
-    struct DimCanTxInterface *can_tx_interface,
-    struct DimCanRxInterface *can_rx_interface,
-    struct SevenSegDisplays * seven_seg_displays,
-    struct HeartbeatMonitor * heartbeat_monitor,
-    struct RegenPaddle *      regen_paddle,
-    struct RgbLedSequence *   rgb_led_sequence,
-    struct RotarySwitch *     drive_mode_switch,
-    struct Led *              imd_led,
-    struct Led *              bspd_led,
-    struct BinarySwitch *     start_switch,
-    struct BinarySwitch *     traction_control_switch,
-    struct BinarySwitch *     torque_vectoring_switch,
-    struct ErrorTable *       error_table,
-    struct RgbLed *           bms_status_led,
-    struct RgbLed *           dcm_status_led,
-    struct RgbLed *           dim_status_led,
-    struct RgbLed *           fsm_status_led,
-    struct RgbLed *           pdm_status_led,
-    struct Clock *            clock);
+    struct DimCanTxInterface *  can_tx_interface,
+    struct DimCanRxInterface *  can_rx_interface,
+    struct SevenSegDisplays *   seven_seg_displays,
+    struct HeartbeatMonitor *   heartbeat_monitor,
+    struct RegenPaddle *        regen_paddle,
+    struct RgbLedSequence *     rgb_led_sequence,
+    struct RotarySwitch *       drive_mode_switch,
+    struct Led *                imd_led,
+    struct Led *                bspd_led,
+    struct BinarySwitch *       start_switch,
+    struct BinarySwitch *       traction_control_switch,
+    struct BinarySwitch *       torque_vectoring_switch,
+    struct ErrorTable *         error_table,
+    struct RgbLed *             bms_status_led,
+    struct RgbLed *             dcm_status_led,
+    struct RgbLed *             dim_status_led,
+    struct RgbLed *             fsm_status_led,
+    struct RgbLed *             pdm_status_led,
+    struct BoardStatusLeds *    board_status_leds,
+    struct DashboardCompositor *dashboard_compositor,
+    struct Clock *              clock);
 
 /**
  * Deallocate the memory used by the given world
@@ -182,6 +186,22 @@ struct RgbLed *App_DimWorld_GetFsmStatusLed(const struct DimWorld *world);
  */
 struct RgbLed *App_DimWorld_GetPdmStatusLed(const struct DimWorld *world);
 
+/**
+ * Get the board status LEDs for the given world
+ * @param world The world to get board status LEDs for
+ * @return The board status LEDs for the given world
+ */
+struct BoardStatusLeds *
+    App_DimWorld_GetBoardStatusLeds(const struct DimWorld *world);
+
+/**
+ * Get the dashboard compositor for the given world
+ * @param world The world to get dashboard compositor for
+ * @return The dashboard compositor for the given world
+ */
+struct DashboardCompositor *
+    App_DimWorld_GetDashboardCompositor(const struct DimWorld *world);
+
 /**
  * Get the clock for the given world
  * @param world The world to get clock for
@@ -1,23 +1,40 @@
 #pragma once
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "App_SharedExitCode.h"
 
+struct RegenPaddleCalibration
+{
+    // The paddle voltage when the paddle is not pressed at all, in mV
+    uint32_t released_voltage_mv;
+
+    // The paddle voltage when the paddle is pressed all the way, in mV
+    uint32_t pressed_voltage_mv;
+};
+
 /**
- * Allocate and initialize a regen paddle
- * @param get_raw_paddle_position A function that can be called to get the raw
- *                                paddle position, where 0 means not pressed at
- *                                all and 100 means pressed all the way. Any
- *                                raw paddle position outside of this range is
- *                                considered invalid.
- * @param lower_deadzone Any raw paddle position >= 0 and less than or equal to
- *                       this value will map to a regen value of 0
- * @param upper_deadzone Any raw paddle position <= 100 and greater than or
- *                       equal to this value will map to a regen value of 100
+ * Allocate and initialize a regen paddle. Its endpoints are loaded from the
+ * stored calibration, or set to the defaults in App_RegenPaddleConfig.h if
+ * there is no stored calibration within the calibration window around them.
+ * @param get_paddle_voltage A function that can be called to get the paddle
+ *                           voltage in mV, which rises as the paddle is
+ *                           pressed
+ * @param load_calibration A function that can be called to load the stored
+ *                         calibration, which returns false if there is none
+ * @param save_calibration A function that can be called to store the given
+ *                         calibration
+ * @param lower_deadzone Any paddle position within this many % of the
+ *                       calibrated travel of the released end will map to a
+ *                       regen value of 0
+ * @param upper_deadzone Any paddle position at or beyond this many % of the
+ *                       calibrated travel will map to a regen value of 100
  * @return The created regen paddle, whose ownership is given to the caller
  */
 struct RegenPaddle *App_RegenPaddle_Create(
-    uint32_t (*get_raw_paddle_position)(void),
+    uint32_t (*get_paddle_voltage)(void),
+    bool (*load_calibration)(struct RegenPaddleCalibration *),
+    void (*save_calibration)(const struct RegenPaddleCalibration *),
     uint32_t lower_deadzone,
     uint32_t upper_deadzone);
 
@@ -28,26 +45,58 @@ struct RegenPaddle *App_RegenPaddle_Create(
 void App_RegenPaddle_Destroy(struct RegenPaddle *regen_paddle);
 
 /**
- * Get the raw paddle position for the given regen paddle, where 0 means not
- * pressed at all and 100 means pressed all the way
+ * Read the paddle voltage of the given regen paddle once, widen its
+ * calibrated endpoints if the voltage has been steady past either of them, and
+ * cache the raw and mapped paddle positions for the voltage
+ * @param regen_paddle The regen paddle to update
+ * @param current_time_ms The current time, in ms
+ */
+void App_RegenPaddle_Tick(
+    struct RegenPaddle *regen_paddle,
+    uint32_t            current_time_ms);
+
+/**
+ * Reset the endpoints of the given regen paddle to the defaults in
+ * App_RegenPaddleConfig.h, and overwrite the stored calibration with them the
+ * next time the paddle is released
+ * @note This must be called from the same task as App_RegenPaddle_Tick
+ * @param regen_paddle The regen paddle to reset the calibration of
+ */
+void App_RegenPaddle_ResetCalibration(struct RegenPaddle *regen_paddle);
+
+/**
+ * Store the calibration of the given regen paddle if its endpoints have moved
+ * far enough past the stored ones, or have been reset, while the paddle was
+ * released
+ * @note This may stall the CPU while flash is written, so it must be called
+ *       from a low rate task rather than the one calling App_RegenPaddle_Tick
+ * @param regen_paddle The regen paddle to store the calibration of
+ */
+void App_RegenPaddle_SaveCalibrationIfPending(struct RegenPaddle *regen_paddle);
+
+/**
+ * Get the raw paddle position for the given regen paddle as of the last tick,
+ * where 0 means not pressed at all and 100 means pressed all the way
  * @param regen_paddle The regen paddle to get raw paddle position for
  * @param returned_raw_paddle_position This will be set to the raw paddle
  *                                     position
- * @return ERROR_CODE_OUT_OF_RANGE If we read a raw paddle position that is not
- *                                 between 0 to 100 inclusive
+ * @return EXIT_CODE_OUT_OF_RANGE If the last paddle voltage was outside of the
+ *                                range the paddle sensor outputs, or if the
+ *                                regen paddle has not been ticked yet
  */
 ExitCode App_RegenPaddle_GetRawPaddlePosition(
     const struct RegenPaddle *regen_paddle,
     uint32_t *                returned_raw_paddle_position);
 
 /**
- * Get the mapped paddle position for the given regen paddle, where 0 means no
- * regen and 100 means maximum regen
+ * Get the mapped paddle position for the given regen paddle as of the last
+ * tick, where 0 means no regen and 100 means maximum regen
  * @param regen_paddle The regen paddle to get mapped paddle position for
  * @param returned_mapped_paddle_position This will be set to the mapped paddle
  *                                        position
- * @return ERROR_CODE_OUT_OF_RANGE If we read a raw paddle position that is not
- *                                 between 0 to 100 inclusive
+ * @return EXIT_CODE_OUT_OF_RANGE If the last paddle voltage was outside of the
+ *                                range the paddle sensor outputs, or if the
+ *                                regen paddle has not been ticked yet
  */
 ExitCode App_RegenPaddle_GetMappedPaddlePosition(
     const struct RegenPaddle *regen_paddle,
@@ -2,6 +2,7 @@
 
 #include <stdint.h>
 #include "App_SharedExitCode.h"
+#include "App_SharedConstants.h"
 
 struct SevenSegDisplay;
 
@@ -13,6 +14,11 @@ enum
     NUM_SEVEN_SEG_DISPLAYS,
 };
 
+// The largest values that can be shown on the group of 7-segment displays,
+// without and with a prefix
+#define MAX_UNSIGNED_BASE10_VALUE 999U
+#define MAX_PREFIXED_UNSIGNED_BASE10_VALUE 99U
+
 /**
  * Allocate and initialize a group of three 7-segment displays
  * @param left_seven_seg_display The left 7-segment display
@@ -67,3 +73,27 @@ ExitCode App_SevenSegDisplays_SetHexDigits(
 ExitCode App_SevenSegDisplays_SetUnsignedBase10Value(
     const struct SevenSegDisplays *seven_seg_displays,
     uint32_t                       value);
+
+/**
+ * Display an unsigned base-10 value on the given group of 7-segment displays,
+ * behind a hexadecimal prefix that tells the value apart from others. The
+ * prefix is shown on the most significant 7-segment display, and the value is
+ * zero-padded on the other two.
+ * @param seven_seg_displays The group of 7-segment displays to display the
+ *                           prefixed value on
+ * @param prefix The hexadecimal digit to display in front of the value
+ * @param value The unsigned base-10 value to display, up to
+ *              MAX_PREFIXED_UNSIGNED_BASE10_VALUE
+ * @return EXIT_CODE_INVALID_ARGS if the given value is out-of-bound
+ */
+ExitCode App_SevenSegDisplays_SetPrefixedUnsignedBase10Value(
+    const struct SevenSegDisplays *seven_seg_displays,
+    enum HexDigit                  prefix,
+    uint32_t                       value);
+
+/**
+ * Turn off every 7-segment display in the given group
+ * @param seven_seg_displays The group of 7-segment displays to turn off
+ */
+void App_SevenSegDisplays_TurnOff(
+    const struct SevenSegDisplays *seven_seg_displays);
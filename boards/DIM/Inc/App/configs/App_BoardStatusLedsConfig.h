@@ -0,0 +1,6 @@
+#pragma once
+
+// The status LED of a board with a critical error blinks red with this period,
+// spending half of it on and half of it off, so that it stands out from the
+// solid colours of the other boards
+#define BOARD_STATUS_LED_BLINK_PERIOD_MS 500U
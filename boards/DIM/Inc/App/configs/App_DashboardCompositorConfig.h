@@ -0,0 +1,12 @@
+#pragma once
+
+// Blinking requests are shown for the first half of each blink period and
+// hidden for the second half
+#define DASHBOARD_BLINK_PERIOD_MS 500U
+
+// The die temperature of the hottest cell monitor is shown as a blinking alert
+// while it is at or above this temperature, in degC. The alert is held for a
+// while after the temperature drops, so that the driver can still see a brief
+// excursion.
+#define DASHBOARD_CELL_MONITOR_OVER_TEMPERATURE_DEGC 90.0f
+#define DASHBOARD_CELL_MONITOR_OVER_TEMPERATURE_HOLD_MS 3000U
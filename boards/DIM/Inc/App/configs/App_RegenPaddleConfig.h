@@ -1,4 +1,34 @@
 #pragma once
 
+// Any paddle position within this many % of the calibrated travel of the
+// released (pressed) end maps to a regen of 0% (100%)
 #define REGEN_PADDLE_LOWER_DEADZONE 5
 #define REGEN_PADDLE_UPPER_DEADZONE 95
+
+// The paddle sensor never outputs a voltage outside of this range, so any
+// such voltage means that the sensor is open or shorted, in mV
+#define REGEN_PADDLE_MIN_VALID_VOLTAGE_MV 100U
+#define REGEN_PADDLE_MAX_VALID_VOLTAGE_MV 3200U
+
+// Until a calibration is learnt, the paddle is assumed to travel between these
+// voltages, which are inside the travel of any paddle sensor so that the full
+// regen range can always be reached, in mV
+#define REGEN_PADDLE_DEFAULT_RELEASED_VOLTAGE_MV 500U
+#define REGEN_PADDLE_DEFAULT_PRESSED_VOLTAGE_MV 2500U
+
+// The endpoints are never widened more than this far past the defaults, and a
+// stored calibration with an endpoint further than this from its default is
+// discarded, so a faulty sensor can't stretch the calibration until the full
+// regen range is out of reach, in mV
+#define REGEN_PADDLE_CALIBRATION_WINDOW_MV 400U
+
+// An endpoint is only widened to a voltage that has stayed within this band of
+// itself for this long, so noise and spikes are never learnt as endpoints, in
+// mV and ms
+#define REGEN_PADDLE_CALIBRATION_STEADY_BAND_MV 10U
+#define REGEN_PADDLE_CALIBRATION_STEADY_MS 100U
+
+// The learnt endpoints are only saved once either of them has moved this far
+// past the saved one, which bounds the number of times the calibration is
+// written to flash, in mV
+#define REGEN_PADDLE_CALIBRATION_SAVE_THRESHOLD_MV 20U
@@ -0,0 +1,17 @@
+#pragma once
+
+// While there is no error, the 7-segment displays cycle through a page for
+// each of these values. Each page is shown for long enough to be read at a
+// glance.
+#define STATE_OF_CHARGE_PAGE_DURATION_MS 4000U
+#define GLV_STATE_OF_CHARGE_PAGE_DURATION_MS 2000U
+#define TEMPERATURE_PAGE_DURATION_MS 2000U
+#define SEVEN_SEG_PAGES_PERIOD_MS                                              \
+    (STATE_OF_CHARGE_PAGE_DURATION_MS + GLV_STATE_OF_CHARGE_PAGE_DURATION_MS + \
+     TEMPERATURE_PAGE_DURATION_MS)
+
+// The pages other than the state of charge are told apart by a prefix on the
+// most significant 7-segment display: "b" for the GLV battery and "C" for
+// degrees Celsius
+#define GLV_STATE_OF_CHARGE_PAGE_PREFIX HEX_DIGIT_B
+#define TEMPERATURE_PAGE_PREFIX HEX_DIGIT_C
@@ -1,13 +1,19 @@
 #pragma once
 
+#include <stm32f3xx_hal.h>
+#include "App_SharedAdcPipeline.h"
+
 /**
- * Get the buffer for DMA controller to write raw ADC values into
- * @return Pointer to the buffer
+ * Initialize the ADC pipeline and start converting the ADC channels into a
+ * circular DMA buffer
+ * @param hadc The handle of the ADC converting the channels, whose conversions
+ *             are triggered by a timer
  */
-uint16_t *Io_Adc_GetRawAdcValues(void);
+void Io_Adc_Init(ADC_HandleTypeDef *hadc);
 
 /**
- * Get the voltage measured at ADC channel 12
- * @return The voltage measured at ADC channel 12, in volts
+ * Get the filtered voltage measured at ADC channel 12
+ * @return The voltage measured at ADC channel 12, in volts, and when it was
+ *         measured
  */
-float Io_Adc_GetChannel12Voltage(void);
+struct AdcChannelOutput Io_Adc_GetChannel12Output(void);
@@ -1,5 +1,27 @@
 #pragma once
 
+#include <stdbool.h>
 #include <stdint.h>
+#include "App_RegenPaddle.h"
 
-uint32_t Io_RegenPaddle_GetPaddlePosition(void);
+/**
+ * Get the voltage of the regen paddle sensor
+ * @return The filtered voltage of the regen paddle sensor, in mV
+ */
+uint32_t Io_RegenPaddle_GetPaddleVoltage(void);
+
+/**
+ * Load the regen paddle calibration stored in the calibration page of flash
+ * @param calibration This will be set to the stored calibration
+ * @return true if a calibration has been stored, else false
+ */
+bool Io_RegenPaddle_LoadCalibration(struct RegenPaddleCalibration *calibration);
+
+/**
+ * Store the given regen paddle calibration in the calibration page of flash
+ * @note The CPU stalls on any access to flash while the page is erased, for
+ *       up to a few tens of ms
+ * @param calibration The calibration to store
+ */
+void Io_RegenPaddle_SaveCalibration(
+    const struct RegenPaddleCalibration *calibration);
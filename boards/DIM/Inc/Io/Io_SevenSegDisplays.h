@@ -10,7 +10,9 @@ void Io_SevenSegDisplays_Init(SPI_HandleTypeDef *hspi);
 
 /**
  * Issue commands to the shift registers controlling the 7-segment displays via
- * the registered SPI bus
+ * the registered SPI bus, if they differ from what the 7-segment displays
+ * already show. The commands are shifted out by DMA and latched from the SPI
+ * transfer complete interrupt, so this doesn't block.
  */
 void Io_SevenSegDisplays_WriteCommands(void);
 
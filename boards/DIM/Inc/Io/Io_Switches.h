@@ -1,6 +1,48 @@
 #pragma once
 
 #include <stdbool.h>
+#include <stdint.h>
+#include "App_SharedDebouncedInputs.h"
+
+// The switches are sampled with this period, so a switch must read the same
+// level for DEBOUNCED_INPUTS_NUM_SAMPLES * SWITCHES_SAMPLE_PERIOD_MS = 20ms
+// before it changes state
+#define SWITCHES_SAMPLE_PERIOD_MS 5U
+
+// The bit of every switch input in the packed switch inputs
+enum SwitchInput
+{
+    START_SWITCH_INPUT,
+    TRACTION_CONTROL_SWITCH_INPUT,
+    TORQUE_VECTORING_SWITCH_INPUT,
+    DRIVE_MODE_1_INPUT,
+    DRIVE_MODE_2_INPUT,
+    DRIVE_MODE_3_INPUT,
+    DRIVE_MODE_4_INPUT,
+    DRIVE_MODE_5_INPUT,
+    NUM_SWITCH_INPUTS,
+};
+
+/**
+ * Initialize the switches
+ * @param switch_inputs The debounced inputs that the switches are sampled into
+ *                      and read from
+ */
+void Io_Switches_Init(const struct DebouncedInputs *switch_inputs);
+
+/**
+ * Read the raw level of every switch input
+ * @return The packed switch inputs, with bit i set if the switch input
+ *         i (See: enum SwitchInput) reads high
+ */
+uint32_t Io_Switches_ReadInputs(void);
+
+/**
+ * Get the debounced state of every switch input
+ * @return The packed switch inputs, with bit i set if the switch input
+ *         i (See: enum SwitchInput) is high
+ */
+uint32_t Io_Switches_GetStates(void);
 
 /**
  * Check if the start switch is turned on
@@ -74,7 +74,7 @@ extern "C"
 #define LSI_FREQUENCY 40000
 #define TIMx_FREQUENCY 72000000
 #define TIM2_PRESCALER 72
-#define ADC_FREQUENCY 1000
+#define ADC_FREQUENCY 8000
 #define BSPD_LED_Pin GPIO_PIN_13
 #define BSPD_LED_GPIO_Port GPIOC
 #define DIM_RED_Pin GPIO_PIN_14
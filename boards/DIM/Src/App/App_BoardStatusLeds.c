@@ -0,0 +1,210 @@
+#include <stdlib.h>
+#include <assert.h>
+#include "App_BoardStatusLeds.h"
+#include "configs/App_BoardStatusLedsConfig.h"
+
+enum BoardStatus
+{
+    BOARD_STATUS_NO_ERROR,
+    BOARD_STATUS_NON_CRITICAL_ERROR,
+    BOARD_STATUS_CRITICAL_ERROR,
+    NUM_BOARD_STATUSES,
+};
+
+enum StatusLedColour
+{
+    STATUS_LED_OFF,
+    STATUS_LED_RED,
+    STATUS_LED_GREEN,
+    STATUS_LED_BLUE,
+
+    // The colour of a status LED before it is first written to
+    STATUS_LED_UNKNOWN,
+};
+
+struct StatusLedPattern
+{
+    enum StatusLedColour colour;
+
+    // Whether the status LED blinks between its colour and off
+    bool is_blinking;
+};
+
+struct BoardStatusLeds
+{
+    struct ErrorTable *error_table;
+    struct RgbLed *    status_leds[NUM_BOARDS];
+
+    // Set when an error of the board is set or cleared, possibly from another
+    // task, and cleared when the status of the board is recomputed
+    volatile bool is_status_stale[NUM_BOARDS];
+
+    enum BoardStatus     statuses[NUM_BOARDS];
+    enum StatusLedColour colours[NUM_BOARDS];
+};
+
+static const struct StatusLedPattern patterns[NUM_BOARD_STATUSES] = {
+    [BOARD_STATUS_NO_ERROR]           = { STATUS_LED_GREEN, false },
+    [BOARD_STATUS_NON_CRITICAL_ERROR] = { STATUS_LED_BLUE, false },
+    [BOARD_STATUS_CRITICAL_ERROR]     = { STATUS_LED_RED, true },
+};
+
+/**
+ * Mark the status of the board of the given error as stale
+ * @param error The error that was set or cleared
+ * @param context The board status LEDs showing the error
+ */
+static void App_OnErrorChanged(const struct Error *error, void *context);
+
+/**
+ * Get the status of the given board from the given error table
+ * @param error_table The error table to get the status of the board from
+ * @param board The board to get the status of
+ * @return The status of the given board
+ */
+static enum BoardStatus
+    App_GetBoardStatus(const struct ErrorTable *error_table, enum Board board);
+
+/**
+ * Turn the given status LED to the given colour
+ * @param status_led The status LED to turn to the given colour
+ * @param colour The colour to turn the status LED to
+ */
+static void App_SetStatusLedColour(
+    const struct RgbLed *status_led,
+    enum StatusLedColour colour);
+
+static void App_OnErrorChanged(const struct Error *error, void *context)
+{
+    struct BoardStatusLeds *board_status_leds = context;
+    const enum Board        board             = App_SharedError_GetBoard(error);
+
+    if (board < NUM_BOARDS)
+    {
+        board_status_leds->is_status_stale[board] = true;
+    }
+}
+
+static enum BoardStatus
+    App_GetBoardStatus(const struct ErrorTable *error_table, enum Board board)
+{
+    if (App_SharedErrorTable_HasAnyCriticalErrorSetForBoard(error_table, board))
+    {
+        return BOARD_STATUS_CRITICAL_ERROR;
+    }
+    else if (App_SharedErrorTable_HasAnyNonCriticalErrorSetForBoard(
+                 error_table, board))
+    {
+        return BOARD_STATUS_NON_CRITICAL_ERROR;
+    }
+    else
+    {
+        return BOARD_STATUS_NO_ERROR;
+    }
+}
+
+static void App_SetStatusLedColour(
+    const struct RgbLed *status_led,
+    enum StatusLedColour colour)
+{
+    switch (colour)
+    {
+        case STATUS_LED_RED:
+        {
+            App_SharedRgbLed_TurnRed(status_led);
+        }
+        break;
+        case STATUS_LED_GREEN:
+        {
+            App_SharedRgbLed_TurnGreen(status_led);
+        }
+        break;
+        case STATUS_LED_BLUE:
+        {
+            App_SharedRgbLed_TurnBlue(status_led);
+        }
+        break;
+        case STATUS_LED_OFF:
+        case STATUS_LED_UNKNOWN:
+        default:
+        {
+            App_SharedRgbLed_TurnOff(status_led);
+        }
+        break;
+    }
+}
+
+struct BoardStatusLeds *App_BoardStatusLeds_Create(
+    struct ErrorTable *const error_table,
+    struct RgbLed *const     bms_status_led,
+    struct RgbLed *const     dcm_status_led,
+    struct RgbLed *const     dim_status_led,
+    struct RgbLed *const     fsm_status_led,
+    struct RgbLed *const     pdm_status_led)
+{
+    struct BoardStatusLeds *board_status_leds =
+        malloc(sizeof(struct BoardStatusLeds));
+    assert(board_status_leds != NULL);
+
+    board_status_leds->error_table      = error_table;
+    board_status_leds->status_leds[BMS] = bms_status_led;
+    board_status_leds->status_leds[DCM] = dcm_status_led;
+    board_status_leds->status_leds[DIM] = dim_status_led;
+    board_status_leds->status_leds[FSM] = fsm_status_led;
+    board_status_leds->status_leds[PDM] = pdm_status_led;
+
+    // Every status LED is written to on the first tick
+    for (size_t i = 0; i < NUM_BOARDS; i++)
+    {
+        board_status_leds->is_status_stale[i] = true;
+        board_status_leds->statuses[i]        = BOARD_STATUS_NO_ERROR;
+        board_status_leds->colours[i]         = STATUS_LED_UNKNOWN;
+    }
+
+    App_SharedErrorTable_SetErrorChangedCallback(
+        error_table, App_OnErrorChanged, board_status_leds);
+
+    return board_status_leds;
+}
+
+void App_BoardStatusLeds_Destroy(struct BoardStatusLeds *board_status_leds)
+{
+    App_SharedErrorTable_SetErrorChangedCallback(
+        board_status_leds->error_table, NULL, NULL);
+    free(board_status_leds);
+}
+
+void App_BoardStatusLeds_Tick(
+    struct BoardStatusLeds *const board_status_leds,
+    const uint32_t                current_time_ms)
+{
+    // Every blinking status LED is timed from the same clock, so they blink
+    // in phase with each other
+    const bool is_blink_on =
+        current_time_ms % BOARD_STATUS_LED_BLINK_PERIOD_MS <
+        BOARD_STATUS_LED_BLINK_PERIOD_MS / 2U;
+
+    for (size_t i = 0; i < NUM_BOARDS; i++)
+    {
+        if (board_status_leds->is_status_stale[i])
+        {
+            // Clear the flag before reading the error table, so an error that
+            // changes while we read it marks the status as stale again
+            board_status_leds->is_status_stale[i] = false;
+            board_status_leds->statuses[i] =
+                App_GetBoardStatus(board_status_leds->error_table, i);
+        }
+
+        const struct StatusLedPattern *pattern =
+            &patterns[board_status_leds->statuses[i]];
+        const enum StatusLedColour colour =
+            (pattern->is_blinking && !is_blink_on) ? STATUS_LED_OFF
+                                                   : pattern->colour;
+
+        if (colour != board_status_leds->colours[i])
+        {
+            App_SetStatusLedColour(board_status_leds->status_leds[i], colour);
+            board_status_leds->colours[i] = colour;
+        }
+    }
+}
@@ -0,0 +1,251 @@
+#include <stdlib.h>
+#include <assert.h>
+#include "App_DashboardCompositor.h"
+#include "configs/App_DashboardCompositorConfig.h"
+
+struct DashboardSlot
+{
+    bool                    is_active;
+    struct DashboardRequest request;
+    uint32_t                posted_time_ms;
+};
+
+struct DashboardFrame
+{
+    // DASHBOARD_SEVEN_SEG_NONE turns the 7-segment displays off. The prefix
+    // and value are only set when they are shown, so that equal frames
+    // compare equal.
+    enum DashboardSevenSegFormat seven_seg_format;
+    enum HexDigit                prefix;
+    uint32_t                     value;
+
+    uint32_t led_mask;
+};
+
+struct DashboardCompositor
+{
+    const struct SevenSegDisplays *seven_seg_displays;
+    const struct Led *             leds[NUM_DASHBOARD_LEDS];
+
+    struct DashboardSlot slots[NUM_DASHBOARD_SOURCES];
+
+    // The last frame that was rendered, if any
+    bool                  is_frame_rendered;
+    struct DashboardFrame rendered_frame;
+};
+
+/**
+ * Compose the frame for the current time from the active requests of the given
+ * compositor, expiring the requests that timed out
+ * @param compositor The compositor to compose the frame of
+ * @param current_time_ms The current time, in ms
+ * @param frame This will be set to the composed frame
+ */
+static void App_ComposeFrame(
+    struct DashboardCompositor *compositor,
+    uint32_t                    current_time_ms,
+    struct DashboardFrame *     frame);
+
+/**
+ * Render the parts of the given frame that differ from the last rendered frame
+ * of the given compositor
+ * @param compositor The compositor to render the frame of
+ * @param frame The frame to render
+ */
+static void App_RenderFrame(
+    struct DashboardCompositor * compositor,
+    const struct DashboardFrame *frame);
+
+static void App_ComposeFrame(
+    struct DashboardCompositor *const compositor,
+    const uint32_t                    current_time_ms,
+    struct DashboardFrame *const      frame)
+{
+    const bool is_blink_on = current_time_ms % DASHBOARD_BLINK_PERIOD_MS <
+                             DASHBOARD_BLINK_PERIOD_MS / 2U;
+    const struct DashboardRequest *seven_seg_request = NULL;
+
+    frame->seven_seg_format = DASHBOARD_SEVEN_SEG_NONE;
+    frame->prefix           = HEX_DIGIT_0;
+    frame->value            = 0U;
+    frame->led_mask         = 0U;
+
+    for (size_t source = 0U; source < NUM_DASHBOARD_SOURCES; source++)
+    {
+        struct DashboardSlot *const slot = &compositor->slots[source];
+
+        if (!slot->is_active)
+        {
+            continue;
+        }
+
+        const struct DashboardRequest *const request = &slot->request;
+
+        if (request->timeout_ms != 0U &&
+            current_time_ms - slot->posted_time_ms >= request->timeout_ms)
+        {
+            slot->is_active = false;
+            continue;
+        }
+
+        // Among requests of the same severity, the first source wins
+        if (request->seven_seg_format != DASHBOARD_SEVEN_SEG_NONE &&
+            (seven_seg_request == NULL ||
+             request->severity > seven_seg_request->severity))
+        {
+            seven_seg_request = request;
+        }
+
+        if (!request->is_blinking || is_blink_on)
+        {
+            frame->led_mask |= request->led_mask;
+        }
+    }
+
+    if (seven_seg_request == NULL ||
+        (seven_seg_request->is_blinking && !is_blink_on))
+    {
+        return;
+    }
+
+    frame->seven_seg_format = seven_seg_request->seven_seg_format;
+
+    if (seven_seg_request->seven_seg_format == DASHBOARD_SEVEN_SEG_VALUE)
+    {
+        frame->value = seven_seg_request->value < MAX_UNSIGNED_BASE10_VALUE
+                           ? seven_seg_request->value
+                           : MAX_UNSIGNED_BASE10_VALUE;
+    }
+    else
+    {
+        frame->prefix = seven_seg_request->prefix;
+        frame->value =
+            seven_seg_request->value < MAX_PREFIXED_UNSIGNED_BASE10_VALUE
+                ? seven_seg_request->value
+                : MAX_PREFIXED_UNSIGNED_BASE10_VALUE;
+    }
+}
+
+static void App_RenderFrame(
+    struct DashboardCompositor *const  compositor,
+    const struct DashboardFrame *const frame)
+{
+    const struct DashboardFrame *const rendered_frame =
+        &compositor->rendered_frame;
+
+    if (!compositor->is_frame_rendered ||
+        frame->seven_seg_format != rendered_frame->seven_seg_format ||
+        frame->prefix != rendered_frame->prefix ||
+        frame->value != rendered_frame->value)
+    {
+        switch (frame->seven_seg_format)
+        {
+            case DASHBOARD_SEVEN_SEG_VALUE:
+            {
+                App_SevenSegDisplays_SetUnsignedBase10Value(
+                    compositor->seven_seg_displays, frame->value);
+            }
+            break;
+            case DASHBOARD_SEVEN_SEG_PREFIXED_VALUE:
+            {
+                App_SevenSegDisplays_SetPrefixedUnsignedBase10Value(
+                    compositor->seven_seg_displays, frame->prefix,
+                    frame->value);
+            }
+            break;
+            case DASHBOARD_SEVEN_SEG_NONE:
+            default:
+            {
+                App_SevenSegDisplays_TurnOff(compositor->seven_seg_displays);
+            }
+            break;
+        }
+    }
+
+    for (size_t led = 0U; led < NUM_DASHBOARD_LEDS; led++)
+    {
+        const uint32_t led_mask  = DASHBOARD_LED_MASK(led);
+        const bool     is_led_on = (frame->led_mask & led_mask) != 0U;
+
+        if (compositor->is_frame_rendered &&
+            is_led_on == ((rendered_frame->led_mask & led_mask) != 0U))
+        {
+            continue;
+        }
+
+        if (is_led_on)
+        {
+            App_Led_TurnOn(compositor->leds[led]);
+        }
+        else
+        {
+            App_Led_TurnOff(compositor->leds[led]);
+        }
+    }
+
+    compositor->rendered_frame    = *frame;
+    compositor->is_frame_rendered = true;
+}
+
+struct DashboardCompositor *App_DashboardCompositor_Create(
+    const struct SevenSegDisplays *const seven_seg_displays,
+    const struct Led *const              imd_led,
+    const struct Led *const              bspd_led)
+{
+    struct DashboardCompositor *compositor =
+        malloc(sizeof(struct DashboardCompositor));
+    assert(compositor != NULL);
+
+    compositor->seven_seg_displays       = seven_seg_displays;
+    compositor->leds[DASHBOARD_IMD_LED]  = imd_led;
+    compositor->leds[DASHBOARD_BSPD_LED] = bspd_led;
+
+    for (size_t source = 0U; source < NUM_DASHBOARD_SOURCES; source++)
+    {
+        compositor->slots[source].is_active = false;
+    }
+
+    compositor->is_frame_rendered = false;
+
+    return compositor;
+}
+
+void App_DashboardCompositor_Destroy(
+    struct DashboardCompositor *const compositor)
+{
+    free(compositor);
+}
+
+void App_DashboardCompositor_Post(
+    struct DashboardCompositor *const    compositor,
+    const enum DashboardSource           source,
+    const struct DashboardRequest *const request,
+    const uint32_t                       current_time_ms)
+{
+    assert(source < NUM_DASHBOARD_SOURCES);
+
+    struct DashboardSlot *const slot = &compositor->slots[source];
+
+    slot->is_active      = true;
+    slot->request        = *request;
+    slot->posted_time_ms = current_time_ms;
+}
+
+void App_DashboardCompositor_Cancel(
+    struct DashboardCompositor *const compositor,
+    const enum DashboardSource        source)
+{
+    assert(source < NUM_DASHBOARD_SOURCES);
+
+    compositor->slots[source].is_active = false;
+}
+
+void App_DashboardCompositor_Tick(
+    struct DashboardCompositor *const compositor,
+    const uint32_t                    current_time_ms)
+{
+    struct DashboardFrame frame;
+
+    App_ComposeFrame(compositor, current_time_ms, &frame);
+    App_RenderFrame(compositor, &frame);
+}
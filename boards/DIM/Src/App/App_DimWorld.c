@@ -6,47 +6,51 @@
 
 struct DimWorld
 {
-    struct DimCanTxInterface *can_tx_interface;
-    struct DimCanRxInterface *can_rx_interface;
-    struct SevenSegDisplays * seven_seg_displays;
-    struct HeartbeatMonitor * heartbeat_monitor;
-    struct RegenPaddle *      regen_paddle;
-    struct RgbLedSequence *   rgb_led_sequence;
-    struct RotarySwitch *     drive_mode_switch;
-    struct Led *              imd_led;
-    struct Led *              bspd_led;
-    struct BinarySwitch *     start_switch;
-    struct BinarySwitch *     traction_control_switch;
-    struct BinarySwitch *     torque_vectoring_switch;
-    struct ErrorTable *       error_table;
-    struct RgbLed *           bms_status_led;
-    struct RgbLed *           dcm_status_led;
-    struct RgbLed *           dim_status_led;
-    struct RgbLed *           fsm_status_led;
-    struct RgbLed *           pdm_status_led;
-    struct Clock *            clock;
+    struct DimCanTxInterface *  can_tx_interface;
+    struct DimCanRxInterface *  can_rx_interface;
+    struct SevenSegDisplays *   seven_seg_displays;
+    struct HeartbeatMonitor *   heartbeat_monitor;
+    struct RegenPaddle *        regen_paddle;
+    struct RgbLedSequence *     rgb_led_sequence;
+    struct RotarySwitch *       drive_mode_switch;
+    struct Led *                imd_led;
+    struct Led *                bspd_led;
+    struct BinarySwitch *       start_switch;
+    struct BinarySwitch *       traction_control_switch;
+    struct BinarySwitch *       torque_vectoring_switch;
+    struct ErrorTable *         error_table;
+    struct RgbLed *             bms_status_led;
+    struct RgbLed *             dcm_status_led;
+    struct RgbLed *             dim_status_led;
+    struct RgbLed *             fsm_status_led;
+    struct RgbLed *             pdm_status_led;
+    struct BoardStatusLeds *    board_status_leds;
+    struct DashboardCompositor *dashboard_compositor;
+    struct Clock *              clock;
 };
 
 struct DimWorld *App_DimWorld_Create(
-    struct DimCanTxInterface *const can_tx_interface,
-    struct DimCanRxInterface *const can_rx_interface,
-    struct SevenSegDisplays *const  seven_seg_displays,
-    struct HeartbeatMonitor *const  heartbeat_monitor,
-    struct RegenPaddle *const       regen_paddle,
-    struct RgbLedSequence *const    rgb_led_sequence,
-    struct RotarySwitch *const      drive_mode_switch,
-    struct Led *const               imd_led,
-    struct Led *const               bspd_led,
-    struct BinarySwitch *const      start_switch,
-    struct BinarySwitch *const      traction_control_switch,
-    struct BinarySwitch *const      torque_vectoring_switch,
-    struct ErrorTable *const        error_table,
-    struct RgbLed *const            bms_status_led,
-    struct RgbLed *const            dcm_status_led,
-    struct RgbLed *const            dim_status_led,
-    struct RgbLed *const            fsm_status_led,
-    struct RgbLed *const            pdm_status_led,
-    struct Clock *const             clock)
+    struct DimCanTxInterface *const   can_tx_interface,
+    struct DimCanRxInterface *const   can_rx_interface,
+    struct SevenSegDisplays *const    seven_seg_displays,
+    struct HeartbeatMonitor *const    heartbeat_monitor,
+    struct RegenPaddle *const         regen_paddle,
+    struct RgbLedSequence *const      rgb_led_sequence,
+    struct RotarySwitch *const        drive_mode_switch,
+    struct Led *const                 imd_led,
+    struct Led *const                 bspd_led,
+    struct BinarySwitch *const        start_switch,
+    struct BinarySwitch *const        traction_control_switch,
+    struct BinarySwitch *const        torque_vectoring_switch,
+    struct ErrorTable *const          error_table,
+    struct RgbLed *const              bms_status_led,
+    struct RgbLed *const              dcm_status_led,
+    struct RgbLed *const              dim_status_led,
+    struct RgbLed *const              fsm_status_led,
+    struct RgbLed *const              pdm_status_led,
+    struct BoardStatusLeds *const     board_status_leds,
+    struct DashboardCompositor *const dashboard_compositor,
+    struct Clock *const               clock)
 {
     struct DimWorld *world = (struct DimWorld *)malloc(sizeof(struct DimWorld));
     assert(world != NULL);
@@ -69,6 +73,8 @@ struct DimWorld *App_DimWorld_Create(
     world->dim_status_led          = dim_status_led;
     world->fsm_status_led          = fsm_status_led;
     world->pdm_status_led          = pdm_status_led;
+    world->board_status_leds       = board_status_leds;
+    world->dashboard_compositor    = dashboard_compositor;
     world->clock                   = clock;
 
     return world;
@@ -180,6 +186,18 @@ struct RgbLed *App_DimWorld_GetPdmStatusLed(const struct DimWorld *world)
     return world->pdm_status_led;
 }
 
+struct BoardStatusLeds *
+    App_DimWorld_GetBoardStatusLeds(const struct DimWorld *world)
+{
+    return world->board_status_leds;
+}
+
+struct DashboardCompositor *
+    App_DimWorld_GetDashboardCompositor(const struct DimWorld *world)
+{
+    return world->dashboard_compositor;
+}
+
 struct Clock *App_DimWorld_GetClock(const struct DimWorld *world)
 {
     return world->clock;
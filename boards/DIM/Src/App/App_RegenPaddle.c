@@ -1,26 +1,181 @@
 #include <stdlib.h>
 #include <assert.h>
 #include "App_RegenPaddle.h"
+#include "configs/App_RegenPaddleConfig.h"
 
 struct RegenPaddle
 {
-    uint32_t (*get_raw_paddle_position)(void);
+    uint32_t (*get_paddle_voltage)(void);
+    void (*save_calibration)(const struct RegenPaddleCalibration *);
     uint32_t lower_deadzone;
     uint32_t upper_deadzone;
+
+    // The endpoints learnt so far, which only ever widen until they are reset
+    struct RegenPaddleCalibration calibration;
+
+    // The voltage that the paddle has stayed within
+    // REGEN_PADDLE_CALIBRATION_STEADY_BAND_MV of, and since when, in mV and ms
+    uint32_t steady_voltage_mv;
+    uint32_t steady_since_ms;
+
+    // The endpoints that have been, or are about to be, stored
+    struct RegenPaddleCalibration saved_calibration;
+
+    // The tick hands the calibration to be stored over to
+    // App_RegenPaddle_SaveCalibrationIfPending, which runs in another task.
+    // The tick only writes pending_calibration while no save is pending.
+    struct RegenPaddleCalibration pending_calibration;
+    volatile bool                 is_calibration_save_pending;
+
+    // Set when the calibration is reset, so that the defaults are stored even
+    // though they haven't moved past the stored endpoints
+    bool is_calibration_reset_pending;
+
+    // The paddle positions as of the last tick, in %
+    ExitCode exit_code;
+    uint32_t raw_paddle_position;
+    uint32_t mapped_paddle_position;
 };
 
+/**
+ * Check if the given calibration can be used to map paddle voltages
+ * @param calibration The calibration to check
+ * @return true if both endpoints are within REGEN_PADDLE_CALIBRATION_WINDOW_MV
+ *         of their defaults, else false
+ */
+static bool
+    App_IsCalibrationValid(const struct RegenPaddleCalibration *calibration);
+
+/**
+ * Widen the endpoints of the given calibration to a voltage past either of
+ * them, but no further than REGEN_PADDLE_CALIBRATION_WINDOW_MV past the
+ * defaults
+ * @param calibration The calibration to widen
+ * @param paddle_voltage The paddle voltage to widen the endpoints to, in mV
+ */
+static void App_WidenCalibration(
+    struct RegenPaddleCalibration *calibration,
+    uint32_t                       paddle_voltage);
+
+/**
+ * Set the endpoints of the given calibration to the defaults
+ * @param calibration The calibration to set to the defaults
+ */
+static void
+    App_SetDefaultCalibration(struct RegenPaddleCalibration *calibration);
+
+/**
+ * Check if either learnt endpoint of the given regen paddle has moved far
+ * enough past the saved one to be worth storing
+ * @param regen_paddle The regen paddle to check
+ * @return true if the learnt calibration should be stored, else false
+ */
+static bool
+    App_HasCalibrationMovedPastSaved(const struct RegenPaddle *regen_paddle);
+
+static bool App_IsCalibrationValid(
+    const struct RegenPaddleCalibration *const calibration)
+{
+    return calibration->released_voltage_mv +
+                   REGEN_PADDLE_CALIBRATION_WINDOW_MV >=
+               REGEN_PADDLE_DEFAULT_RELEASED_VOLTAGE_MV &&
+           calibration->released_voltage_mv <=
+               REGEN_PADDLE_DEFAULT_RELEASED_VOLTAGE_MV +
+                   REGEN_PADDLE_CALIBRATION_WINDOW_MV &&
+           calibration->pressed_voltage_mv +
+                   REGEN_PADDLE_CALIBRATION_WINDOW_MV >=
+               REGEN_PADDLE_DEFAULT_PRESSED_VOLTAGE_MV &&
+           calibration->pressed_voltage_mv <=
+               REGEN_PADDLE_DEFAULT_PRESSED_VOLTAGE_MV +
+                   REGEN_PADDLE_CALIBRATION_WINDOW_MV;
+}
+
+static void App_WidenCalibration(
+    struct RegenPaddleCalibration *const calibration,
+    const uint32_t                       paddle_voltage)
+{
+    const uint32_t min_released_voltage_mv =
+        REGEN_PADDLE_DEFAULT_RELEASED_VOLTAGE_MV -
+        REGEN_PADDLE_CALIBRATION_WINDOW_MV;
+    const uint32_t max_pressed_voltage_mv =
+        REGEN_PADDLE_DEFAULT_PRESSED_VOLTAGE_MV +
+        REGEN_PADDLE_CALIBRATION_WINDOW_MV;
+
+    if (paddle_voltage < calibration->released_voltage_mv)
+    {
+        calibration->released_voltage_mv =
+            paddle_voltage > min_released_voltage_mv ? paddle_voltage
+                                                     : min_released_voltage_mv;
+    }
+    else if (paddle_voltage > calibration->pressed_voltage_mv)
+    {
+        calibration->pressed_voltage_mv =
+            paddle_voltage < max_pressed_voltage_mv ? paddle_voltage
+                                                    : max_pressed_voltage_mv;
+    }
+}
+
+static void
+    App_SetDefaultCalibration(struct RegenPaddleCalibration *const calibration)
+{
+    calibration->released_voltage_mv = REGEN_PADDLE_DEFAULT_RELEASED_VOLTAGE_MV;
+    calibration->pressed_voltage_mv  = REGEN_PADDLE_DEFAULT_PRESSED_VOLTAGE_MV;
+}
+
+static bool App_HasCalibrationMovedPastSaved(
+    const struct RegenPaddle *const regen_paddle)
+{
+    // The learnt endpoints only ever widen, so they can't be inside the saved
+    // ones
+    return regen_paddle->saved_calibration.released_voltage_mv -
+                   regen_paddle->calibration.released_voltage_mv >=
+               REGEN_PADDLE_CALIBRATION_SAVE_THRESHOLD_MV ||
+           regen_paddle->calibration.pressed_voltage_mv -
+                   regen_paddle->saved_calibration.pressed_voltage_mv >=
+               REGEN_PADDLE_CALIBRATION_SAVE_THRESHOLD_MV;
+}
+
 struct RegenPaddle *App_RegenPaddle_Create(
-    uint32_t (*const get_raw_pedal_position)(void),
+    uint32_t (*const get_paddle_voltage)(void),
+    bool (*const load_calibration)(struct RegenPaddleCalibration *),
+    void (*const save_calibration)(const struct RegenPaddleCalibration *),
     uint32_t lower_deadzone,
     uint32_t upper_deadzone)
 {
+    assert(lower_deadzone < upper_deadzone && upper_deadzone <= 100U);
+
     struct RegenPaddle *regen_paddle = malloc(sizeof(struct RegenPaddle));
 
     assert(regen_paddle != NULL);
 
-    regen_paddle->get_raw_paddle_position = get_raw_pedal_position;
-    regen_paddle->lower_deadzone          = lower_deadzone;
-    regen_paddle->upper_deadzone          = upper_deadzone;
+    regen_paddle->get_paddle_voltage = get_paddle_voltage;
+    regen_paddle->save_calibration   = save_calibration;
+    regen_paddle->lower_deadzone     = lower_deadzone;
+    regen_paddle->upper_deadzone     = upper_deadzone;
+
+    struct RegenPaddleCalibration stored_calibration;
+
+    if (load_calibration(&stored_calibration) &&
+        App_IsCalibrationValid(&stored_calibration))
+    {
+        regen_paddle->calibration = stored_calibration;
+    }
+    else
+    {
+        App_SetDefaultCalibration(&regen_paddle->calibration);
+    }
+
+    regen_paddle->steady_voltage_mv = 0U;
+    regen_paddle->steady_since_ms   = 0U;
+
+    regen_paddle->saved_calibration            = regen_paddle->calibration;
+    regen_paddle->pending_calibration          = regen_paddle->calibration;
+    regen_paddle->is_calibration_save_pending  = false;
+    regen_paddle->is_calibration_reset_pending = false;
+
+    regen_paddle->exit_code              = EXIT_CODE_OUT_OF_RANGE;
+    regen_paddle->raw_paddle_position    = 0U;
+    regen_paddle->mapped_paddle_position = 0U;
 
     return regen_paddle;
 }
@@ -30,55 +185,134 @@ void App_RegenPaddle_Destroy(struct RegenPaddle *const regen_paddle)
     free(regen_paddle);
 }
 
-ExitCode App_RegenPaddle_GetRawPaddlePosition(
-    const struct RegenPaddle *const regen_paddle,
-    uint32_t *const                 returned_raw_paddle_position)
+void App_RegenPaddle_Tick(
+    struct RegenPaddle *const regen_paddle,
+    const uint32_t            current_time_ms)
 {
-    const uint32_t raw_paddle_position =
-        regen_paddle->get_raw_paddle_position();
-    ExitCode exit_code = EXIT_CODE_OK;
+    const uint32_t paddle_voltage = regen_paddle->get_paddle_voltage();
+
+    if (paddle_voltage + REGEN_PADDLE_CALIBRATION_STEADY_BAND_MV <
+            regen_paddle->steady_voltage_mv ||
+        paddle_voltage > regen_paddle->steady_voltage_mv +
+                             REGEN_PADDLE_CALIBRATION_STEADY_BAND_MV)
+    {
+        regen_paddle->steady_voltage_mv = paddle_voltage;
+        regen_paddle->steady_since_ms   = current_time_ms;
+    }
+
+    if (paddle_voltage < REGEN_PADDLE_MIN_VALID_VOLTAGE_MV ||
+        paddle_voltage > REGEN_PADDLE_MAX_VALID_VOLTAGE_MV)
+    {
+        regen_paddle->exit_code = EXIT_CODE_OUT_OF_RANGE;
+        return;
+    }
+
+    struct RegenPaddleCalibration *const calibration =
+        &regen_paddle->calibration;
+
+    if (current_time_ms - regen_paddle->steady_since_ms >=
+        REGEN_PADDLE_CALIBRATION_STEADY_MS)
+    {
+        App_WidenCalibration(calibration, paddle_voltage);
+    }
+
+    // A voltage past an endpoint that hasn't been widened to it yet maps to
+    // that endpoint
+    uint32_t clamped_paddle_voltage = paddle_voltage;
+
+    if (clamped_paddle_voltage < calibration->released_voltage_mv)
+    {
+        clamped_paddle_voltage = calibration->released_voltage_mv;
+    }
+    else if (clamped_paddle_voltage > calibration->pressed_voltage_mv)
+    {
+        clamped_paddle_voltage = calibration->pressed_voltage_mv;
+    }
 
-    if (raw_paddle_position > 100)
+    // Map the paddle voltage in integer mV, so the dead-band is applied to the
+    // full resolution of the voltage rather than to a rounded position
+    const uint32_t travel_mv =
+        calibration->pressed_voltage_mv - calibration->released_voltage_mv;
+    const uint32_t position_mv =
+        clamped_paddle_voltage - calibration->released_voltage_mv;
+    const uint32_t lower_deadzone_mv =
+        travel_mv * regen_paddle->lower_deadzone / 100U;
+    const uint32_t upper_deadzone_mv =
+        travel_mv * regen_paddle->upper_deadzone / 100U;
+
+    regen_paddle->raw_paddle_position = 100U * position_mv / travel_mv;
+
+    if (position_mv <= lower_deadzone_mv)
     {
-        exit_code = EXIT_CODE_OUT_OF_RANGE;
+        regen_paddle->mapped_paddle_position = 0U;
+    }
+    else if (position_mv >= upper_deadzone_mv)
+    {
+        regen_paddle->mapped_paddle_position = 100U;
     }
     else
     {
-        *returned_raw_paddle_position = raw_paddle_position;
+        regen_paddle->mapped_paddle_position =
+            100U * (position_mv - lower_deadzone_mv) /
+            (upper_deadzone_mv - lower_deadzone_mv);
     }
 
-    return exit_code;
+    regen_paddle->exit_code = EXIT_CODE_OK;
+
+    // Only hand the calibration over while the paddle is released, since
+    // storing it may stall the CPU for a while
+    if (regen_paddle->mapped_paddle_position == 0U &&
+        !regen_paddle->is_calibration_save_pending &&
+        (regen_paddle->is_calibration_reset_pending ||
+         App_HasCalibrationMovedPastSaved(regen_paddle)))
+    {
+        regen_paddle->saved_calibration            = *calibration;
+        regen_paddle->pending_calibration          = *calibration;
+        regen_paddle->is_calibration_save_pending  = true;
+        regen_paddle->is_calibration_reset_pending = false;
+    }
+}
+
+void App_RegenPaddle_ResetCalibration(struct RegenPaddle *const regen_paddle)
+{
+    App_SetDefaultCalibration(&regen_paddle->calibration);
+
+    // The endpoints only ever widen from here, so they are compared against
+    // the defaults rather than against the endpoints stored before the reset
+    App_SetDefaultCalibration(&regen_paddle->saved_calibration);
+    regen_paddle->is_calibration_reset_pending = true;
+}
+
+void App_RegenPaddle_SaveCalibrationIfPending(
+    struct RegenPaddle *const regen_paddle)
+{
+    if (regen_paddle->is_calibration_save_pending)
+    {
+        regen_paddle->save_calibration(&regen_paddle->pending_calibration);
+        regen_paddle->is_calibration_save_pending = false;
+    }
+}
+
+ExitCode App_RegenPaddle_GetRawPaddlePosition(
+    const struct RegenPaddle *const regen_paddle,
+    uint32_t *const                 returned_raw_paddle_position)
+{
+    if (EXIT_OK(regen_paddle->exit_code))
+    {
+        *returned_raw_paddle_position = regen_paddle->raw_paddle_position;
+    }
+
+    return regen_paddle->exit_code;
 }
 
 ExitCode App_RegenPaddle_GetMappedPaddlePosition(
     const struct RegenPaddle *const regen_paddle,
     uint32_t *const                 returned_mapped_paddle_position)
 {
-    const uint32_t raw_paddle_position =
-        regen_paddle->get_raw_paddle_position();
-    ExitCode exit_code = EXIT_CODE_OK;
-
-    if (raw_paddle_position > 100)
+    if (EXIT_OK(regen_paddle->exit_code))
     {
-        exit_code = EXIT_CODE_OUT_OF_RANGE;
+        *returned_mapped_paddle_position = regen_paddle->mapped_paddle_position;
     }
-    else
-    {
-        if (raw_paddle_position > regen_paddle->upper_deadzone)
-        {
-            *returned_mapped_paddle_position = 100;
-        }
-        else if (raw_paddle_position < regen_paddle->lower_deadzone)
-        {
-            *returned_mapped_paddle_position = 0;
-        }
-        else
-        {
-            *returned_mapped_paddle_position =
-                100 * (raw_paddle_position - regen_paddle->lower_deadzone) /
-                (regen_paddle->upper_deadzone - regen_paddle->lower_deadzone);
-        }
-    }
-
-    return exit_code;
+
+    return regen_paddle->exit_code;
 }
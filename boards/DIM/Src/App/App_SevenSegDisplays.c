@@ -1,6 +1,5 @@
 #include <stdlib.h>
 #include <assert.h>
-#include <math.h>
 
 #include "App_SharedExitCode.h"
 #include "App_SevenSegDisplays.h"
@@ -92,28 +91,65 @@ ExitCode App_SevenSegDisplays_SetUnsignedBase10Value(
     const struct SevenSegDisplays *const seven_seg_displays,
     uint32_t                             value)
 {
-    if (value > pow(10, NUM_SEVEN_SEG_DISPLAYS) - 1)
+    if (value > MAX_UNSIGNED_BASE10_VALUE)
     {
         return EXIT_CODE_INVALID_ARGS;
     }
 
-    uint8_t digits[NUM_SEVEN_SEG_DISPLAYS];
+    // Turn the base-10 value into individual digits, from the least
+    // significant digit. The divisors are constants, so this compiles to
+    // multiplications rather than divisions. We treat a value of 0 as having 1
+    // digit.
+    const uint8_t digits[NUM_SEVEN_SEG_DISPLAYS] = {
+        (uint8_t)(value % 10U),
+        (uint8_t)(value / 10U % 10U),
+        (uint8_t)(value / 100U),
+    };
+    size_t num_digits = 1;
+
+    if (value >= 100U)
+    {
+        num_digits = 3;
+    }
+    else if (value >= 10U)
+    {
+        num_digits = 2;
+    }
+
+    return App_SevenSegDisplays_SetHexDigits(
+        seven_seg_displays, digits, num_digits);
+}
 
-    // Turn the base-10 value into individual digits. We treat a value of 0
-    // as having 1 digit, which is why num_digits starts counting from 1.
-    for (uint8_t num_digits = 1; num_digits <= NUM_SEVEN_SEG_DISPLAYS;
-         num_digits++)
+ExitCode App_SevenSegDisplays_SetPrefixedUnsignedBase10Value(
+    const struct SevenSegDisplays *const seven_seg_displays,
+    const enum HexDigit                  prefix,
+    const uint32_t                       value)
+{
+    if (value > MAX_PREFIXED_UNSIGNED_BASE10_VALUE)
     {
-        digits[num_digits - 1] = (uint8_t)(value % 10);
-        value /= 10;
+        return EXIT_CODE_INVALID_ARGS;
+    }
 
-        if (value == 0)
-        {
-            App_SevenSegDisplays_SetHexDigits(
-                seven_seg_displays, digits, num_digits);
-            break;
-        }
+    const uint8_t digits[NUM_SEVEN_SEG_DISPLAYS] = {
+        (uint8_t)(value % 10U),
+        (uint8_t)(value / 10U),
+        (uint8_t)prefix,
+    };
+
+    return App_SevenSegDisplays_SetHexDigits(
+        seven_seg_displays, digits, NUM_SEVEN_SEG_DISPLAYS);
+}
+
+void App_SevenSegDisplays_TurnOff(
+    const struct SevenSegDisplays *const seven_seg_displays)
+{
+    const struct SevenSegHexDigit hex_digit = { .enabled = false };
+
+    for (size_t i = 0; i < NUM_SEVEN_SEG_DISPLAYS; i++)
+    {
+        App_SevenSegDisplay_SetHexDigit(
+            seven_seg_displays->displays[i], hex_digit);
     }
 
-    return EXIT_CODE_OK;
+    seven_seg_displays->display_value_callback();
 }
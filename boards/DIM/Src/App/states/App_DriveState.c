@@ -1,8 +1,11 @@
+#include <math.h>
 #include "states/App_DriveState.h"
 
 #include "App_SharedMacros.h"
 #include "App_SevenSegDisplays.h"
 #include "App_SharedExitCode.h"
+#include "configs/App_SevenSegPagesConfig.h"
+#include "configs/App_DashboardCompositorConfig.h"
 
 static void App_SetPeriodicCanSignals_DriveMode(
     struct DimCanTxInterface *can_tx,
@@ -80,6 +83,176 @@ static void App_SetPeriodicCanSignals_BinarySwitch(
     }
 }
 
+/**
+ * Get the request for the page of the 7-segment displays that is due at the
+ * given time, which is shown while no other request wins the 7-segment
+ * displays
+ * @param can_rx The CAN RX interface to get the value of the page from
+ * @param current_time_ms The current time, in ms
+ * @param request This will be set to the request for the page
+ */
+static void App_GetSevenSegPageRequest(
+    struct DimCanRxInterface *can_rx,
+    uint32_t                  current_time_ms,
+    struct DashboardRequest * request)
+{
+    const uint32_t page_time_ms = current_time_ms % SEVEN_SEG_PAGES_PERIOD_MS;
+
+    request->severity    = DASHBOARD_SEVERITY_INFO;
+    request->led_mask    = 0U;
+    request->is_blinking = false;
+    request->timeout_ms  = 0U;
+
+    if (page_time_ms < STATE_OF_CHARGE_PAGE_DURATION_MS)
+    {
+        request->seven_seg_format = DASHBOARD_SEVEN_SEG_VALUE;
+        request->prefix           = HEX_DIGIT_0;
+        request->value =
+            (uint32_t)App_CanRx_BMS_STATE_OF_CHARGE_GetSignal_STATE_OF_CHARGE(
+                can_rx);
+    }
+    else if (
+        page_time_ms <
+        STATE_OF_CHARGE_PAGE_DURATION_MS + GLV_STATE_OF_CHARGE_PAGE_DURATION_MS)
+    {
+        request->seven_seg_format = DASHBOARD_SEVEN_SEG_PREFIXED_VALUE;
+        request->prefix           = GLV_STATE_OF_CHARGE_PAGE_PREFIX;
+        request->value            = (uint32_t)fmaxf(
+            App_CanRx_PDM_GLV_BATTERY_GetSignal_GLV_STATE_OF_CHARGE(can_rx),
+            0.0f);
+    }
+    else
+    {
+        request->seven_seg_format = DASHBOARD_SEVEN_SEG_PREFIXED_VALUE;
+        request->prefix           = TEMPERATURE_PAGE_PREFIX;
+        request->value            = (uint32_t)fmaxf(
+            App_CanRx_BMS_MAX_CELL_MONITOR_GetSignal_MAX_CELL_MONITOR_DIE_TEMPERATURE(
+                can_rx),
+            0.0f);
+    }
+}
+
+/**
+ * Post the requests that the drive state shows on the dashboard, from the CAN
+ * signals and errors that are current
+ * @param dashboard_compositor The dashboard compositor to post the requests to
+ * @param can_rx The CAN RX interface to get the CAN signals from
+ * @param error_table The error table to get the errors from
+ * @param clock The clock to get the current time from
+ */
+static void App_PostDashboardRequests(
+    struct DashboardCompositor *dashboard_compositor,
+    struct DimCanRxInterface *  can_rx,
+    struct ErrorTable *         error_table,
+    struct Clock *              clock)
+{
+    const uint32_t current_time_ms =
+        App_SharedClock_GetCurrentTimeInMilliseconds(clock);
+
+    const float cell_monitor_die_temperature =
+        App_CanRx_BMS_MAX_CELL_MONITOR_GetSignal_MAX_CELL_MONITOR_DIE_TEMPERATURE(
+            can_rx);
+
+    // Reposting the alert while the temperature is too high restarts its
+    // timeout, which holds the alert after the temperature drops
+    if (cell_monitor_die_temperature >=
+        DASHBOARD_CELL_MONITOR_OVER_TEMPERATURE_DEGC)
+    {
+        const struct DashboardRequest over_temperature_request = {
+            .severity         = DASHBOARD_SEVERITY_CRITICAL,
+            .seven_seg_format = DASHBOARD_SEVEN_SEG_PREFIXED_VALUE,
+            .prefix           = TEMPERATURE_PAGE_PREFIX,
+            .value            = (uint32_t)cell_monitor_die_temperature,
+            .is_blinking      = true,
+            .timeout_ms       = DASHBOARD_CELL_MONITOR_OVER_TEMPERATURE_HOLD_MS,
+        };
+
+        App_DashboardCompositor_Post(
+            dashboard_compositor,
+            DASHBOARD_SOURCE_CELL_MONITOR_OVER_TEMPERATURE,
+            &over_temperature_request, current_time_ms);
+    }
+
+    struct ErrorList all_errors;
+    App_SharedErrorTable_GetAllErrors(error_table, &all_errors);
+
+    if (all_errors.num_errors == 0)
+    {
+        App_DashboardCompositor_Cancel(
+            dashboard_compositor, DASHBOARD_SOURCE_ERRORS);
+    }
+    else
+    {
+        // We want to display each error for one second, so we assume that the
+        // error set will not change much and just associate each second to
+        // a particular error. Errors that are set for less than N seconds,
+        // where N is the number of errors set, may not be displayed.
+        size_t error_index = App_SharedClock_GetCurrentTimeInSeconds(clock) %
+                             all_errors.num_errors;
+        struct Error *error = all_errors.errors[error_index];
+
+        // To avoid confusion between SoC and error IDs, the 7-segment
+        // displays will show the error IDs with an offset of 500. For
+        // example, if an error ID is 67, it will show up as 567 on the
+        // 7-segment displays.
+        const uint32_t error_id        = App_SharedError_GetId(error);
+        const uint32_t ERROR_ID_OFFSET = 500;
+
+        const struct DashboardRequest error_request = {
+            .severity = App_SharedErrorTable_HasAnyCriticalErrorSet(error_table)
+                            ? DASHBOARD_SEVERITY_CRITICAL
+                            : DASHBOARD_SEVERITY_WARNING,
+            .seven_seg_format = DASHBOARD_SEVEN_SEG_VALUE,
+            .value            = error_id + ERROR_ID_OFFSET,
+        };
+
+        App_DashboardCompositor_Post(
+            dashboard_compositor, DASHBOARD_SOURCE_ERRORS, &error_request,
+            current_time_ms);
+    }
+
+    if (App_CanRx_BMS_IMD_GetSignal_OK_HS(can_rx) ==
+        CANMSGS_BMS_IMD_OK_HS_FAULT_CHOICE)
+    {
+        const struct DashboardRequest imd_request = {
+            .severity = DASHBOARD_SEVERITY_CRITICAL,
+            .led_mask = DASHBOARD_LED_MASK(DASHBOARD_IMD_LED),
+        };
+
+        App_DashboardCompositor_Post(
+            dashboard_compositor, DASHBOARD_SOURCE_IMD, &imd_request,
+            current_time_ms);
+    }
+    else
+    {
+        App_DashboardCompositor_Cancel(
+            dashboard_compositor, DASHBOARD_SOURCE_IMD);
+    }
+
+    if (App_CanRx_FSM_NON_CRITICAL_ERRORS_GetSignal_BSPD_FAULT(can_rx))
+    {
+        const struct DashboardRequest bspd_request = {
+            .severity = DASHBOARD_SEVERITY_WARNING,
+            .led_mask = DASHBOARD_LED_MASK(DASHBOARD_BSPD_LED),
+        };
+
+        App_DashboardCompositor_Post(
+            dashboard_compositor, DASHBOARD_SOURCE_BSPD, &bspd_request,
+            current_time_ms);
+    }
+    else
+    {
+        App_DashboardCompositor_Cancel(
+            dashboard_compositor, DASHBOARD_SOURCE_BSPD);
+    }
+
+    struct DashboardRequest page_request;
+    App_GetSevenSegPageRequest(can_rx, current_time_ms, &page_request);
+    App_DashboardCompositor_Post(
+        dashboard_compositor, DASHBOARD_SOURCE_PAGES, &page_request,
+        current_time_ms);
+}
+
 static void DriveStateRunOnEntry(struct StateMachine *const state_machine)
 {
     struct DimWorld *world = App_SharedStateMachine_GetWorld(state_machine);
@@ -95,6 +268,8 @@ static void DriveStateRunOnTick1Hz(struct StateMachine *const state_machine)
         App_DimWorld_GetRgbLedSequence(world);
 
     App_SharedRgbLedSequence_Tick(rgb_led_sequence);
+    App_RegenPaddle_SaveCalibrationIfPending(
+        App_DimWorld_GetRegenPaddle(world));
 }
 
 static void DriveStateRunOnTick100Hz(struct StateMachine *const state_machine)
@@ -102,59 +277,29 @@ static void DriveStateRunOnTick100Hz(struct StateMachine *const state_machine)
     struct DimWorld *world = App_SharedStateMachine_GetWorld(state_machine);
     struct DimCanTxInterface *can_tx = App_DimWorld_GetCanTx(world);
     struct DimCanRxInterface *can_rx = App_DimWorld_GetCanRx(world);
-    struct SevenSegDisplays * seven_seg_displays =
-        App_DimWorld_GetSevenSegDisplays(world);
-    struct HeartbeatMonitor *heartbeat_monitor =
+    struct HeartbeatMonitor * heartbeat_monitor =
         App_DimWorld_GetHeartbeatMonitor(world);
-    struct RegenPaddle * regen_paddle = App_DimWorld_GetRegenPaddle(world);
     struct RotarySwitch *drive_mode_switch =
         App_DimWorld_GetDriveModeSwitch(world);
-    struct Led *         imd_led      = App_DimWorld_GetImdLed(world);
-    struct Led *         bspd_led     = App_DimWorld_GetBspdLed(world);
     struct BinarySwitch *start_switch = App_DimWorld_GetStartSwitch(world);
     struct BinarySwitch *traction_control_switch =
         App_DimWorld_GetTractionControlSwitch(world);
     struct BinarySwitch *torque_vectoring_switch =
         App_DimWorld_GetTorqueVectoringSwitch(world);
+    struct BoardStatusLeds *board_status_leds =
+        App_DimWorld_GetBoardStatusLeds(world);
+    struct DashboardCompositor *dashboard_compositor =
+        App_DimWorld_GetDashboardCompositor(world);
     struct ErrorTable *error_table = App_DimWorld_GetErrorTable(world);
     struct Clock *     clock       = App_DimWorld_GetClock(world);
 
     uint32_t buffer;
 
-    if (EXIT_OK(App_RegenPaddle_GetRawPaddlePosition(regen_paddle, &buffer)))
-    {
-        App_CanTx_SetPeriodicSignal_RAW_PADDLE_POSITION(can_tx, buffer);
-    }
-
-    if (EXIT_OK(App_RegenPaddle_GetMappedPaddlePosition(regen_paddle, &buffer)))
-    {
-        App_CanTx_SetPeriodicSignal_MAPPED_PADDLE_POSITION(can_tx, buffer);
-    }
-
     if (EXIT_OK(App_RotarySwitch_GetSwitchPosition(drive_mode_switch, &buffer)))
     {
         App_SetPeriodicCanSignals_DriveMode(can_tx, buffer);
     }
 
-    if (App_CanRx_BMS_IMD_GetSignal_OK_HS(can_rx) ==
-        CANMSGS_BMS_IMD_OK_HS_FAULT_CHOICE)
-    {
-        App_Led_TurnOn(imd_led);
-    }
-    else
-    {
-        App_Led_TurnOff(imd_led);
-    }
-
-    if (App_CanRx_FSM_NON_CRITICAL_ERRORS_GetSignal_BSPD_FAULT(can_rx))
-    {
-        App_Led_TurnOn(bspd_led);
-    }
-    else
-    {
-        App_Led_TurnOff(bspd_led);
-    }
-
     App_SetPeriodicCanSignals_BinarySwitch(
         can_tx, start_switch, App_CanTx_SetPeriodicSignal_START_SWITCH,
         CANMSGS_DIM_SWITCHES_START_SWITCH_ON_CHOICE,
@@ -172,75 +317,59 @@ static void DriveStateRunOnTick100Hz(struct StateMachine *const state_machine)
         CANMSGS_DIM_SWITCHES_START_SWITCH_ON_CHOICE,
         CANMSGS_DIM_SWITCHES_START_SWITCH_OFF_CHOICE);
 
-    struct RgbLed *board_status_leds[NUM_BOARDS] = {
-        [BMS] = App_DimWorld_GetBmsStatusLed(world),
-        [DCM] = App_DimWorld_GetDcmStatusLed(world),
-        [DIM] = App_DimWorld_GetDimStatusLed(world),
-        [FSM] = App_DimWorld_GetFsmStatusLed(world),
-        [PDM] = App_DimWorld_GetPdmStatusLed(world),
-    };
-
-    for (size_t i = 0; i < NUM_BOARDS; i++)
-    {
-        struct ErrorBoardList boards_with_critical_errors;
-        struct ErrorBoardList boards_with_non_critical_errors;
+    App_BoardStatusLeds_Tick(
+        board_status_leds, App_SharedClock_GetCurrentTimeInMilliseconds(clock));
 
-        App_SharedErrorTable_GetBoardsWithCriticalErrors(
-            error_table, &boards_with_critical_errors);
+    App_PostDashboardRequests(dashboard_compositor, can_rx, error_table, clock);
+    App_DashboardCompositor_Tick(
+        dashboard_compositor,
+        App_SharedClock_GetCurrentTimeInMilliseconds(clock));
 
-        App_SharedErrorTable_GetBoardsWithNonCriticalErrors(
-            error_table, &boards_with_non_critical_errors);
+    App_SharedHeartbeatMonitor_Tick(heartbeat_monitor);
+}
 
-        struct RgbLed *board_status_led = board_status_leds[i];
+static void DriveStateRunOnTick1kHz(struct StateMachine *const state_machine)
+{
+    struct DimWorld *world = App_SharedStateMachine_GetWorld(state_machine);
+    struct DimCanTxInterface *can_tx       = App_DimWorld_GetCanTx(world);
+    struct DimCanRxInterface *can_rx       = App_DimWorld_GetCanRx(world);
+    struct RegenPaddle *      regen_paddle = App_DimWorld_GetRegenPaddle(world);
+    struct Clock *            clock        = App_DimWorld_GetClock(world);
 
-        if (App_SharedError_IsBoardInList(&boards_with_critical_errors, i))
-        {
-            App_SharedRgbLed_TurnRed(board_status_led);
-        }
-        else if (App_SharedError_IsBoardInList(
-                     &boards_with_non_critical_errors, i))
-        {
-            App_SharedRgbLed_TurnBlue(board_status_led);
-        }
-        else
-        {
-            App_SharedRgbLed_TurnGreen(board_status_led);
-        }
+    // The command is cleared once it is handled, so that each command resets
+    // the calibration once
+    if (App_CanRx_DEBUG_REGEN_PADDLE_CALIBRATION_GetSignal_RESET_CALIBRATION(
+            can_rx))
+    {
+        App_RegenPaddle_ResetCalibration(regen_paddle);
+        App_CanRx_DEBUG_REGEN_PADDLE_CALIBRATION_SetSignal_RESET_CALIBRATION(
+            can_rx, false);
     }
 
-    struct ErrorList all_errors;
-    App_SharedErrorTable_GetAllErrors(error_table, &all_errors);
+    // The paddle is read once per tick, and both positions sent over CAN are
+    // mapped from that same reading
+    App_RegenPaddle_Tick(
+        regen_paddle, App_SharedClock_GetCurrentTimeInMilliseconds(clock));
 
-    if (all_errors.num_errors == 0)
+    uint32_t buffer;
+
+    if (EXIT_OK(App_RegenPaddle_GetRawPaddlePosition(regen_paddle, &buffer)))
     {
-        App_SevenSegDisplays_SetUnsignedBase10Value(
-            seven_seg_displays,
-            (uint32_t)App_CanRx_BMS_STATE_OF_CHARGE_GetSignal_STATE_OF_CHARGE(
-                can_rx));
+        App_CanTx_SetPeriodicSignal_RAW_PADDLE_POSITION(can_tx, buffer);
+    }
+
+    // An open or shorted paddle wire releases the paddle, so a fault in the
+    // middle of regen doesn't keep commanding the last mapped position
+    if (EXIT_OK(App_RegenPaddle_GetMappedPaddlePosition(regen_paddle, &buffer)))
+    {
+        App_CanTx_SetPeriodicSignal_MAPPED_PADDLE_POSITION(can_tx, buffer);
+        App_CanTx_SetPeriodicSignal_REGEN_PADDLE_OUT_OF_RANGE(can_tx, false);
     }
     else
     {
-        // We want to display each error for one second, so we assume that the
-        // error set will not change much and just associate each second to
-        // a particular error. Errors that are set for less than N seconds,
-        // where N is the number of errors set, may not be displayed.
-        size_t error_index = App_SharedClock_GetCurrentTimeInSeconds(clock) %
-                             all_errors.num_errors;
-        struct Error *error = all_errors.errors[error_index];
-
-        // To avoid confusion between SoC and error IDs, the 7-segment
-        // displays will show the error IDs with an offset of 500. For
-        // example, if an error ID is 67, it will show up as 567 on the
-        // 7-segment displays.
-        const uint32_t error_id             = App_SharedError_GetId(error);
-        const uint32_t ERROR_ID_OFFSET      = 500;
-        const uint32_t error_id_with_offset = error_id + ERROR_ID_OFFSET;
-
-        App_SevenSegDisplays_SetUnsignedBase10Value(
-            seven_seg_displays, error_id_with_offset);
+        App_CanTx_SetPeriodicSignal_MAPPED_PADDLE_POSITION(can_tx, 0U);
+        App_CanTx_SetPeriodicSignal_REGEN_PADDLE_OUT_OF_RANGE(can_tx, true);
     }
-
-    App_SharedHeartbeatMonitor_Tick(heartbeat_monitor);
 }
 
 static void DriveStateRunOnExit(struct StateMachine *const state_machine)
@@ -255,6 +384,7 @@ const struct State *App_GetDriveState(void)
         .run_on_entry      = DriveStateRunOnEntry,
         .run_on_tick_1Hz   = DriveStateRunOnTick1Hz,
         .run_on_tick_100Hz = DriveStateRunOnTick100Hz,
+        .run_on_tick_1kHz  = DriveStateRunOnTick1kHz,
         .run_on_exit       = DriveStateRunOnExit,
     };
 
@@ -1,48 +1,29 @@
-#include <limits.h>
-#include "main.h"
 #include "Io_DriveModeSwitch.h"
+#include "Io_Switches.h"
 
 uint32_t Io_DriveModeSwitch_GetPosition(void)
 {
-    uint32_t position = UINT_MAX;
+    static const enum SwitchInput drive_mode_inputs[] = {
+        DRIVE_MODE_1_INPUT, DRIVE_MODE_2_INPUT, DRIVE_MODE_3_INPUT,
+        DRIVE_MODE_4_INPUT, DRIVE_MODE_5_INPUT,
+    };
+    const uint32_t num_drive_mode_inputs =
+        sizeof(drive_mode_inputs) / sizeof(drive_mode_inputs[0]);
 
-    // The DRIVE_MODE pins are active high
-    if (HAL_GPIO_ReadPin(DRIVE_MODE1_GPIO_Port, DRIVE_MODE1_Pin) ==
-        GPIO_PIN_SET)
-    {
-        position = 0;
-    }
-    else if (
-        HAL_GPIO_ReadPin(DRIVE_MODE2_GPIO_Port, DRIVE_MODE2_Pin) ==
-        GPIO_PIN_SET)
-    {
-        position = 1;
-    }
-    else if (
-        HAL_GPIO_ReadPin(DRIVE_MODE3_GPIO_Port, DRIVE_MODE3_Pin) ==
-        GPIO_PIN_SET)
-    {
-        position = 2;
-    }
-    else if (
-        HAL_GPIO_ReadPin(DRIVE_MODE4_GPIO_Port, DRIVE_MODE4_Pin) ==
-        GPIO_PIN_SET)
-    {
-        position = 3;
-    }
-    else if (
-        HAL_GPIO_ReadPin(DRIVE_MODE5_GPIO_Port, DRIVE_MODE5_Pin) ==
-        GPIO_PIN_SET)
-    {
-        position = 4;
-    }
-    else
+    // The DRIVE_MODE pins are active high, and are read from one word of
+    // debounced switch states
+    const uint32_t states = Io_Switches_GetStates();
+
+    for (uint32_t position = 0; position < num_drive_mode_inputs; position++)
     {
-        // Pin 6 on the rotary switch is disconnected. If we rotate the rotary
-        // switch to the 6th position, then all other pins on the switch will
-        // read as low.
-        position = 5;
+        if ((states & (1U << drive_mode_inputs[position])) != 0U)
+        {
+            return position;
+        }
     }
 
-    return position;
+    // Pin 6 on the rotary switch is disconnected. If we rotate the rotary
+    // switch to the 6th position, then all other pins on the switch will
+    // read as low.
+    return num_drive_mode_inputs;
 }
@@ -1,8 +1,70 @@
+#include <stm32f3xx_hal.h>
 #include "Io_RegenPaddle.h"
 #include "Io_Adc.h"
 
-uint32_t Io_RegenPaddle_GetPaddlePosition(void)
+// Marks a calibration record as complete. It is programmed after the rest of
+// the record, so a record interrupted by a reset is never loaded.
+#define CALIBRATION_RECORD_MAGIC 0x52454750U
+
+struct CalibrationRecord
+{
+    struct RegenPaddleCalibration calibration;
+    uint32_t                      magic;
+};
+
+// The calibration page is left out of the FLASH region of the linker script,
+// so the program is never linked into it. Flashing the program only erases the
+// page under a mass erase, after which the paddle starts from the default
+// calibration again.
+extern const struct CalibrationRecord _calibration_page_start;
+
+uint32_t Io_RegenPaddle_GetPaddleVoltage(void)
 {
-    // 0V maps to 0% pressed and 3.3V maps to 100% pressed
-    return (uint32_t)(100.0f * Io_Adc_GetChannel12Voltage() / 3.3f);
+    return (uint32_t)(1000.0f * Io_Adc_GetChannel12Output().voltage);
+}
+
+bool Io_RegenPaddle_LoadCalibration(
+    struct RegenPaddleCalibration *const calibration)
+{
+    if (_calibration_page_start.magic != CALIBRATION_RECORD_MAGIC)
+    {
+        return false;
+    }
+
+    *calibration = _calibration_page_start.calibration;
+
+    return true;
+}
+
+void Io_RegenPaddle_SaveCalibration(
+    const struct RegenPaddleCalibration *const calibration)
+{
+    const uint32_t         page_address = (uint32_t)&_calibration_page_start;
+    const uint32_t         words[]      = { calibration->released_voltage_mv,
+                               calibration->pressed_voltage_mv,
+                               CALIBRATION_RECORD_MAGIC };
+    FLASH_EraseInitTypeDef erase_init   = {
+        .TypeErase   = FLASH_TYPEERASE_PAGES,
+        .PageAddress = page_address,
+        .NbPages     = 1U,
+    };
+    uint32_t page_error;
+
+    HAL_FLASH_Unlock();
+
+    if (HAL_FLASHEx_Erase(&erase_init, &page_error) == HAL_OK)
+    {
+        for (uint32_t i = 0U; i < sizeof(words) / sizeof(words[0]); i++)
+        {
+            if (HAL_FLASH_Program(
+                    FLASH_TYPEPROGRAM_WORD,
+                    page_address + i * (uint32_t)sizeof(words[0]),
+                    words[i]) != HAL_OK)
+            {
+                break;
+            }
+        }
+    }
+
+    HAL_FLASH_Lock();
 }
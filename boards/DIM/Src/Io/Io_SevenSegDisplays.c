@@ -1,5 +1,7 @@
 #include <stm32f3xx_hal.h>
 #include <assert.h>
+#include <stdbool.h>
+#include <string.h>
 
 #include "App_SevenSegDisplays.h"
 #include "Io_SevenSegDisplays.h"
@@ -31,9 +33,20 @@ struct CommandLookupTable
 static SPI_HandleTypeDef *_hspi;
 
 // The 7-segment displays are controlled by sending 8-bit command values to
-// shift registers via SPI
+// shift registers via SPI. The digit setters only update this shadow frame,
+// which is pushed to the shift registers by Io_SevenSegDisplays_WriteCommands.
 static uint8_t commands[NUM_SEVEN_SEG_DISPLAYS];
 
+// The frame being shifted out by the SPI DMA, which must stay untouched until
+// the transfer completes
+static uint8_t tx_commands[NUM_SEVEN_SEG_DISPLAYS];
+
+// The frame shown by the 7-segment displays, once the first frame is latched
+static uint8_t latched_commands[NUM_SEVEN_SEG_DISPLAYS];
+static bool    has_latched_commands = false;
+
+static volatile bool is_transfer_in_progress = false;
+
 // clang-format off
 static const struct CommandLookupTable command_lookup_table =
 {
@@ -76,15 +89,63 @@ void Io_SevenSegDisplays_Init(SPI_HandleTypeDef *const hspi)
 
 void Io_SevenSegDisplays_WriteCommands(void)
 {
+    // A transfer takes a few microseconds, so one still in progress has
+    // finished by the time the next frame is written. If not, the shadow
+    // frame is pushed by the next call instead.
+    if (is_transfer_in_progress)
+    {
+        return;
+    }
+
+    if (has_latched_commands &&
+        memcmp(commands, latched_commands, NUM_SEVEN_SEG_DISPLAYS) == 0)
+    {
+        return;
+    }
+
     // The 7-segment displays are daisy chained by shifting registers, so we
     // can't update them individually. Instead, we must update the 7-segment
     // displays all at once.
-    HAL_SPI_Transmit(_hspi, commands, NUM_SEVEN_SEG_DISPLAYS, 100U);
+    memcpy(tx_commands, commands, NUM_SEVEN_SEG_DISPLAYS);
+    is_transfer_in_progress = true;
+
+    if (HAL_SPI_Transmit_DMA(_hspi, tx_commands, NUM_SEVEN_SEG_DISPLAYS) !=
+        HAL_OK)
+    {
+        is_transfer_in_progress = false;
+    }
+}
+
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+    if (hspi != _hspi)
+    {
+        return;
+    }
 
     // A pulse to RCK transfers data from the shift registers to the storage
     // registers, completing the write command.
-    HAL_GPIO_TogglePin(SEVENSEG_RCK_3V3_GPIO_Port, SEVENSEG_RCK_3V3_Pin);
-    HAL_GPIO_TogglePin(SEVENSEG_RCK_3V3_GPIO_Port, SEVENSEG_RCK_3V3_Pin);
+    HAL_GPIO_WritePin(
+        SEVENSEG_RCK_3V3_GPIO_Port, SEVENSEG_RCK_3V3_Pin, GPIO_PIN_SET);
+    HAL_GPIO_WritePin(
+        SEVENSEG_RCK_3V3_GPIO_Port, SEVENSEG_RCK_3V3_Pin, GPIO_PIN_RESET);
+
+    memcpy(latched_commands, tx_commands, NUM_SEVEN_SEG_DISPLAYS);
+    has_latched_commands    = true;
+    is_transfer_in_progress = false;
+}
+
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi)
+{
+    if (hspi != _hspi)
+    {
+        return;
+    }
+
+    // The shift registers hold a partial frame, which is not latched. The
+    // shadow frame is pushed again by the next call to
+    // Io_SevenSegDisplays_WriteCommands.
+    is_transfer_in_progress = false;
 }
 
 void Io_SevenSegDisplays_SetLeftHexDigit(struct SevenSegHexDigit hex_digit)
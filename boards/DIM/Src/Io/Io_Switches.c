@@ -1,18 +1,68 @@
+#include <assert.h>
 #include <stm32f3xx.h>
 #include "main.h"
 #include "Io_Switches.h"
 
+struct SwitchPin
+{
+    GPIO_TypeDef *port;
+    uint16_t      pin;
+};
+
+static const struct SwitchPin switch_pins[NUM_SWITCH_INPUTS] = {
+    [START_SWITCH_INPUT]            = { IGNTN_GPIO_Port, IGNTN_Pin },
+    [TRACTION_CONTROL_SWITCH_INPUT] = { TRAC_CTRL_GPIO_Port, TRAC_CTRL_Pin },
+    [TORQUE_VECTORING_SWITCH_INPUT] = { TORQ_VECT_GPIO_Port, TORQ_VECT_Pin },
+    [DRIVE_MODE_1_INPUT] = { DRIVE_MODE1_GPIO_Port, DRIVE_MODE1_Pin },
+    [DRIVE_MODE_2_INPUT] = { DRIVE_MODE2_GPIO_Port, DRIVE_MODE2_Pin },
+    [DRIVE_MODE_3_INPUT] = { DRIVE_MODE3_GPIO_Port, DRIVE_MODE3_Pin },
+    [DRIVE_MODE_4_INPUT] = { DRIVE_MODE4_GPIO_Port, DRIVE_MODE4_Pin },
+    [DRIVE_MODE_5_INPUT] = { DRIVE_MODE5_GPIO_Port, DRIVE_MODE5_Pin },
+};
+
+static const struct DebouncedInputs *_switch_inputs = NULL;
+
+void Io_Switches_Init(const struct DebouncedInputs *const switch_inputs)
+{
+    assert(switch_inputs != NULL);
+    _switch_inputs = switch_inputs;
+}
+
+uint32_t Io_Switches_ReadInputs(void)
+{
+    uint32_t inputs = 0U;
+
+    // Read the input data registers directly, since this runs on every sample
+    // and the HAL would check the arguments of every read
+    for (uint32_t i = 0U; i < NUM_SWITCH_INPUTS; i++)
+    {
+        if ((switch_pins[i].port->IDR & switch_pins[i].pin) != 0U)
+        {
+            inputs |= 1U << i;
+        }
+    }
+
+    return inputs;
+}
+
+uint32_t Io_Switches_GetStates(void)
+{
+    return App_SharedDebouncedInputs_GetStates(_switch_inputs);
+}
+
 bool Io_Switches_StartSwitchIsTurnedOn(void)
 {
-    return HAL_GPIO_ReadPin(IGNTN_GPIO_Port, IGNTN_Pin) == GPIO_PIN_SET;
+    return App_SharedDebouncedInputs_IsHigh(_switch_inputs, START_SWITCH_INPUT);
 }
 
 bool Io_Switches_TractionControlSwitchIsTurnedOn(void)
 {
-    return HAL_GPIO_ReadPin(TRAC_CTRL_GPIO_Port, TRAC_CTRL_Pin) == GPIO_PIN_SET;
+    return App_SharedDebouncedInputs_IsHigh(
+        _switch_inputs, TRACTION_CONTROL_SWITCH_INPUT);
 }
 
 bool Io_Switches_TorqueVectoringSwitchIsTurnedOn(void)
 {
-    return HAL_GPIO_ReadPin(TORQ_VECT_GPIO_Port, TORQ_VECT_Pin) == GPIO_PIN_SET;
+    return App_SharedDebouncedInputs_IsHigh(
+        _switch_inputs, TORQUE_VECTORING_SWITCH_INPUT);
 }
@@ -50,6 +50,7 @@
 #include "Io_Switches.h"
 #include "Io_Adc.h"
 #include "Io_RgbLeds.h"
+#include "Io_SharedCycleCounter.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -70,6 +71,7 @@
 /* Private variables ---------------------------------------------------------*/
 ADC_HandleTypeDef hadc2;
 DMA_HandleTypeDef hdma_adc2;
+DMA_HandleTypeDef hdma_spi2_tx;
 
 CAN_HandleTypeDef hcan;
 
@@ -95,30 +97,33 @@ osThreadId          Task1HzHandle;
 uint32_t            Task1HzBuffer[TASK1HZ_STACK_SIZE];
 osStaticThreadDef_t Task1HzControlBlock;
 /* USER CODE BEGIN PV */
-struct DimWorld *         world;
-struct StateMachine *     state_machine;
-struct DimCanTxInterface *can_tx;
-struct DimCanRxInterface *can_rx;
-struct SevenSegDisplay *  left_seven_seg_display;
-struct SevenSegDisplay *  middle_seven_seg_display;
-struct SevenSegDisplay *  right_seven_seg_display;
-struct SevenSegDisplays * seven_seg_displays;
-struct HeartbeatMonitor * heartbeat_monitor;
-struct RegenPaddle *      regen_paddle;
-struct RgbLedSequence *   rgb_led_sequence;
-struct RotarySwitch *     drive_mode_switch;
-struct Led *              imd_led;
-struct Led *              bspd_led;
-struct BinarySwitch *     start_switch;
-struct BinarySwitch *     traction_control_switch;
-struct BinarySwitch *     torque_vectoring_switch;
-struct ErrorTable *       error_table;
-struct RgbLed *           bms_status_led;
-struct RgbLed *           dcm_status_led;
-struct RgbLed *           dim_status_led;
-struct RgbLed *           fsm_status_led;
-struct RgbLed *           pdm_status_led;
-struct Clock *            clock;
+struct DimWorld *           world;
+struct StateMachine *       state_machine;
+struct DimCanTxInterface *  can_tx;
+struct DimCanRxInterface *  can_rx;
+struct SevenSegDisplay *    left_seven_seg_display;
+struct SevenSegDisplay *    middle_seven_seg_display;
+struct SevenSegDisplay *    right_seven_seg_display;
+struct SevenSegDisplays *   seven_seg_displays;
+struct HeartbeatMonitor *   heartbeat_monitor;
+struct RegenPaddle *        regen_paddle;
+struct RgbLedSequence *     rgb_led_sequence;
+struct DebouncedInputs *    switch_inputs;
+struct RotarySwitch *       drive_mode_switch;
+struct Led *                imd_led;
+struct Led *                bspd_led;
+struct BinarySwitch *       start_switch;
+struct BinarySwitch *       traction_control_switch;
+struct BinarySwitch *       torque_vectoring_switch;
+struct ErrorTable *         error_table;
+struct RgbLed *             bms_status_led;
+struct RgbLed *             dcm_status_led;
+struct RgbLed *             dim_status_led;
+struct RgbLed *             fsm_status_led;
+struct RgbLed *             pdm_status_led;
+struct BoardStatusLeds *    board_status_leds;
+struct DashboardCompositor *dashboard_compositor;
+struct Clock *              clock;
 /* USER CODE END PV */
 
 /* Private function prototypes -----------------------------------------------*/
@@ -192,12 +197,11 @@ int main(void)
     /* USER CODE BEGIN 2 */
     __HAL_DBGMCU_FREEZE_IWDG();
 
-    HAL_ADC_Start_DMA(
-        &hadc2, (uint32_t *)Io_Adc_GetRawAdcValues(),
-        hadc2.Init.NbrOfConversion);
+    Io_Adc_Init(&hadc2);
     HAL_TIM_Base_Start(&htim2);
 
     Io_SharedHardFaultHandler_Init();
+    Io_SharedCycleCounter_Init();
 
     Io_SevenSegDisplays_Init(&hspi2);
 
@@ -223,13 +227,17 @@ int main(void)
         HEARTBEAT_MONITOR_BOARDS_TO_CHECK, Io_HeartbeatMonitor_TimeoutCallback);
 
     regen_paddle = App_RegenPaddle_Create(
-        Io_RegenPaddle_GetPaddlePosition, REGEN_PADDLE_LOWER_DEADZONE,
+        Io_RegenPaddle_GetPaddleVoltage, Io_RegenPaddle_LoadCalibration,
+        Io_RegenPaddle_SaveCalibration, REGEN_PADDLE_LOWER_DEADZONE,
         REGEN_PADDLE_UPPER_DEADZONE);
 
     rgb_led_sequence = App_SharedRgbLedSequence_Create(
         Io_RgbLedSequence_TurnOnRedLed, Io_RgbLedSequence_TurnOnBlueLed,
         Io_RgbLedSequence_TurnOnGreenLed);
 
+    switch_inputs = App_SharedDebouncedInputs_Create(Io_Switches_ReadInputs);
+    Io_Switches_Init(switch_inputs);
+
     drive_mode_switch = App_RotarySwitch_Create(
         Io_DriveModeSwitch_GetPosition, NUM_DRIVE_MODE_SWITCH_POSITIONS);
 
@@ -267,6 +275,13 @@ int main(void)
         Io_RgbLeds_TurnPdmStatusLedRed, Io_RgbLeds_TurnPdmStatusLedGreen,
         Io_RgbLeds_TurnPdmStatusLedBlue, Io_RgbLeds_TurnOffPdmStatusLed);
 
+    board_status_leds = App_BoardStatusLeds_Create(
+        error_table, bms_status_led, dcm_status_led, dim_status_led,
+        fsm_status_led, pdm_status_led);
+
+    dashboard_compositor =
+        App_DashboardCompositor_Create(seven_seg_displays, imd_led, bspd_led);
+
     clock = App_SharedClock_Create();
 
     world = App_DimWorld_Create(
@@ -274,7 +289,7 @@ int main(void)
         rgb_led_sequence, drive_mode_switch, imd_led, bspd_led, start_switch,
         traction_control_switch, torque_vectoring_switch, error_table,
         bms_status_led, dcm_status_led, dim_status_led, fsm_status_led,
-        pdm_status_led, clock);
+        pdm_status_led, board_status_leds, dashboard_compositor, clock);
 
     state_machine = App_SharedStateMachine_Create(world, App_GetDriveState());
 
@@ -606,9 +621,13 @@ static void MX_TIM2_Init(void)
 static void MX_DMA_Init(void)
 {
     /* DMA controller clock enable */
+    __HAL_RCC_DMA1_CLK_ENABLE();
     __HAL_RCC_DMA2_CLK_ENABLE();
 
     /* DMA interrupt init */
+    /* DMA1_Channel5_IRQn interrupt configuration */
+    HAL_NVIC_SetPriority(DMA1_Channel5_IRQn, 5, 0);
+    HAL_NVIC_EnableIRQ(DMA1_Channel5_IRQn);
     /* DMA2_Channel1_IRQn interrupt configuration */
     HAL_NVIC_SetPriority(DMA2_Channel1_IRQn, 5, 0);
     HAL_NVIC_EnableIRQ(DMA2_Channel1_IRQn);
@@ -717,10 +736,30 @@ void RunTask100Hz(void const *argument)
         Io_SharedSoftwareWatchdog_AllocateWatchdog();
     Io_SharedSoftwareWatchdog_InitWatchdog(watchdog, "TASK_100HZ", period_ms);
 
+    // The CPU time of the slowest tick over each second, in cycles
+    const uint32_t ticks_per_report = 1000U / period_ms;
+    uint32_t       num_ticks        = 0U;
+    uint32_t       max_tick_cycles  = 0U;
+
     /* Infinite loop */
     for (;;)
     {
+        const uint32_t tick_start_cycles =
+            Io_SharedCycleCounter_GetCycleCount();
         App_SharedStateMachine_Tick100Hz(state_machine);
+        const uint32_t tick_cycles =
+            Io_SharedCycleCounter_GetCycleCount() - tick_start_cycles;
+
+        max_tick_cycles =
+            max_tick_cycles > tick_cycles ? max_tick_cycles : tick_cycles;
+
+        if (++num_ticks >= ticks_per_report)
+        {
+            App_CanTx_SetPeriodicSignal_MAX_TICK_100HZ_CYCLES(
+                can_tx, max_tick_cycles);
+            num_ticks       = 0U;
+            max_tick_cycles = 0U;
+        }
 
         // Watchdog check-in must be the last function called before putting the
         // task to sleep.
@@ -790,14 +829,27 @@ void RunTask1kHz(void const *argument)
         Io_SharedSoftwareWatchdog_AllocateWatchdog();
     Io_SharedSoftwareWatchdog_InitWatchdog(watchdog, "TASK_1KHZ", period_ms);
 
+    // Sampling on elapsed time rather than on multiples of the period means a
+    // late wake-up delays a sample instead of skipping it
+    uint32_t last_switches_sample_time_ms =
+        PreviousWakeTime * portTICK_PERIOD_MS;
+
     /* Infinite loop */
     for (;;)
     {
         const uint32_t current_time_ms = osKernelSysTick() * portTICK_PERIOD_MS;
 
         App_SharedClock_SetCurrentTimeInMilliseconds(clock, current_time_ms);
+        App_SharedStateMachine_Tick1kHz(state_machine);
         Io_CanTx_EnqueuePeriodicMsgs(can_tx, current_time_ms);
 
+        if (current_time_ms - last_switches_sample_time_ms >=
+            SWITCHES_SAMPLE_PERIOD_MS)
+        {
+            App_SharedDebouncedInputs_Sample(switch_inputs);
+            last_switches_sample_time_ms = current_time_ms;
+        }
+
         // Watchdog check-in must be the last function called before putting the
         // task to sleep.
         Io_SharedSoftwareWatchdog_CheckInWatchdog(watchdog);
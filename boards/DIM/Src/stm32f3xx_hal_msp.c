@@ -25,6 +25,7 @@
 
 /* USER CODE END Includes */
 extern DMA_HandleTypeDef hdma_adc2;
+extern DMA_HandleTypeDef hdma_spi2_tx;
 
 /* Private typedef -----------------------------------------------------------*/
 /* USER CODE BEGIN TD */
@@ -261,6 +262,23 @@ void HAL_SPI_MspInit(SPI_HandleTypeDef *hspi)
         GPIO_InitStruct.Alternate = GPIO_AF5_SPI2;
         HAL_GPIO_Init(GPIOB, &GPIO_InitStruct);
 
+        /* SPI2 DMA Init */
+        /* SPI2_TX Init */
+        hdma_spi2_tx.Instance                 = DMA1_Channel5;
+        hdma_spi2_tx.Init.Direction           = DMA_MEMORY_TO_PERIPH;
+        hdma_spi2_tx.Init.PeriphInc           = DMA_PINC_DISABLE;
+        hdma_spi2_tx.Init.MemInc              = DMA_MINC_ENABLE;
+        hdma_spi2_tx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+        hdma_spi2_tx.Init.MemDataAlignment    = DMA_MDATAALIGN_BYTE;
+        hdma_spi2_tx.Init.Mode                = DMA_NORMAL;
+        hdma_spi2_tx.Init.Priority            = DMA_PRIORITY_LOW;
+        if (HAL_DMA_Init(&hdma_spi2_tx) != HAL_OK)
+        {
+            Error_Handler();
+        }
+
+        __HAL_LINKDMA(hspi, hdmatx, hdma_spi2_tx);
+
         /* SPI2 interrupt Init */
         HAL_NVIC_SetPriority(SPI2_IRQn, 5, 0);
         HAL_NVIC_EnableIRQ(SPI2_IRQn);
@@ -292,6 +310,9 @@ void HAL_SPI_MspDeInit(SPI_HandleTypeDef *hspi)
         */
         HAL_GPIO_DeInit(GPIOB, SEVENSEG_SRCK_3V3_Pin | SEVENSEG_SEROUT_3V3_Pin);
 
+        /* SPI2 DMA DeInit */
+        HAL_DMA_DeInit(hspi->hdmatx);
+
         /* SPI2 interrupt DeInit */
         HAL_NVIC_DisableIRQ(SPI2_IRQn);
         /* USER CODE BEGIN SPI2_MspDeInit 1 */
@@ -59,6 +59,7 @@
 
 /* External variables --------------------------------------------------------*/
 extern DMA_HandleTypeDef hdma_adc2;
+extern DMA_HandleTypeDef hdma_spi2_tx;
 extern CAN_HandleTypeDef hcan;
 extern SPI_HandleTypeDef hspi2;
 extern TIM_HandleTypeDef htim6;
@@ -163,6 +164,20 @@ void DebugMon_Handler(void)
 /* please refer to the startup file (startup_stm32f3xx.s).                    */
 /******************************************************************************/
 
+/**
+ * @brief This function handles DMA1 channel5 global interrupt.
+ */
+void DMA1_Channel5_IRQHandler(void)
+{
+    /* USER CODE BEGIN DMA1_Channel5_IRQn 0 */
+
+    /* USER CODE END DMA1_Channel5_IRQn 0 */
+    HAL_DMA_IRQHandler(&hdma_spi2_tx);
+    /* USER CODE BEGIN DMA1_Channel5_IRQn 1 */
+
+    /* USER CODE END DMA1_Channel5_IRQn 1 */
+}
+
 /**
  * @brief This function handles USB high priority or CAN_TX interrupts.
  */
@@ -0,0 +1,127 @@
+#include "Test_Dim.h"
+
+extern "C"
+{
+#include "App_BoardStatusLeds.h"
+#include "configs/App_BoardStatusLedsConfig.h"
+}
+
+FAKE_VOID_FUNC(turn_bms_led_red);
+FAKE_VOID_FUNC(turn_bms_led_green);
+FAKE_VOID_FUNC(turn_bms_led_blue);
+FAKE_VOID_FUNC(turn_off_bms_led);
+FAKE_VOID_FUNC(turn_other_led_red);
+FAKE_VOID_FUNC(turn_other_led_green);
+FAKE_VOID_FUNC(turn_other_led_blue);
+FAKE_VOID_FUNC(turn_off_other_led);
+
+class BoardStatusLedsTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        error_table = App_SharedErrorTable_Create();
+        bms_led     = App_SharedRgbLed_Create(
+            turn_bms_led_red, turn_bms_led_green, turn_bms_led_blue,
+            turn_off_bms_led);
+        other_led = App_SharedRgbLed_Create(
+            turn_other_led_red, turn_other_led_green, turn_other_led_blue,
+            turn_off_other_led);
+        board_status_leds = App_BoardStatusLeds_Create(
+            error_table, bms_led, other_led, other_led, other_led, other_led);
+
+        RESET_FAKE(turn_bms_led_red);
+        RESET_FAKE(turn_bms_led_green);
+        RESET_FAKE(turn_bms_led_blue);
+        RESET_FAKE(turn_off_bms_led);
+        RESET_FAKE(turn_other_led_red);
+        RESET_FAKE(turn_other_led_green);
+        RESET_FAKE(turn_other_led_blue);
+        RESET_FAKE(turn_off_other_led);
+    }
+
+    void TearDown() override
+    {
+        TearDownObject(board_status_leds, App_BoardStatusLeds_Destroy);
+        TearDownObject(error_table, App_SharedErrorTable_Destroy);
+        TearDownObject(bms_led, App_SharedRgbLed_Destroy);
+        TearDownObject(other_led, App_SharedRgbLed_Destroy);
+    }
+
+    struct ErrorTable *     error_table;
+    struct RgbLed *         bms_led;
+    struct RgbLed *         other_led;
+    struct BoardStatusLeds *board_status_leds;
+};
+
+TEST_F(BoardStatusLedsTest, every_status_led_is_written_to_on_the_first_tick)
+{
+    App_BoardStatusLeds_Tick(board_status_leds, 0);
+    ASSERT_EQ(1, turn_bms_led_green_fake.call_count);
+    ASSERT_EQ(NUM_BOARDS - 1, turn_other_led_green_fake.call_count);
+
+    for (uint32_t time_ms = 10; time_ms < 1000; time_ms += 10)
+    {
+        App_BoardStatusLeds_Tick(board_status_leds, time_ms);
+    }
+    ASSERT_EQ(1, turn_bms_led_green_fake.call_count);
+    ASSERT_EQ(NUM_BOARDS - 1, turn_other_led_green_fake.call_count);
+}
+
+TEST_F(BoardStatusLedsTest, only_the_status_led_of_the_changed_board_is_written)
+{
+    App_BoardStatusLeds_Tick(board_status_leds, 0);
+
+    App_SharedErrorTable_SetError(
+        error_table, BMS_NON_CRITICAL_WATCHDOG_TIMEOUT, true);
+    App_BoardStatusLeds_Tick(board_status_leds, 10);
+    ASSERT_EQ(1, turn_bms_led_blue_fake.call_count);
+    ASSERT_EQ(NUM_BOARDS - 1, turn_other_led_green_fake.call_count);
+    ASSERT_EQ(0, turn_other_led_blue_fake.call_count);
+
+    // Setting an error that is already set doesn't change anything
+    App_SharedErrorTable_SetError(
+        error_table, BMS_NON_CRITICAL_WATCHDOG_TIMEOUT, true);
+    App_BoardStatusLeds_Tick(board_status_leds, 20);
+    ASSERT_EQ(1, turn_bms_led_blue_fake.call_count);
+
+    App_SharedErrorTable_SetError(
+        error_table, BMS_NON_CRITICAL_WATCHDOG_TIMEOUT, false);
+    App_BoardStatusLeds_Tick(board_status_leds, 30);
+    ASSERT_EQ(2, turn_bms_led_green_fake.call_count);
+}
+
+TEST_F(BoardStatusLedsTest, error_set_and_cleared_between_ticks_is_not_shown)
+{
+    App_BoardStatusLeds_Tick(board_status_leds, 0);
+
+    App_SharedErrorTable_SetError(
+        error_table, BMS_AIR_SHUTDOWN_MAX_CELL_VOLTAGE_OUT_OF_RANGE, true);
+    App_SharedErrorTable_SetError(
+        error_table, BMS_AIR_SHUTDOWN_MAX_CELL_VOLTAGE_OUT_OF_RANGE, false);
+    App_BoardStatusLeds_Tick(board_status_leds, 10);
+
+    ASSERT_EQ(0, turn_bms_led_red_fake.call_count);
+    ASSERT_EQ(1, turn_bms_led_green_fake.call_count);
+}
+
+TEST_F(BoardStatusLedsTest, status_led_blinks_red_with_critical_error)
+{
+    App_SharedErrorTable_SetError(
+        error_table, BMS_AIR_SHUTDOWN_MAX_CELL_VOLTAGE_OUT_OF_RANGE, true);
+    App_SharedErrorTable_SetError(
+        error_table, BMS_NON_CRITICAL_WATCHDOG_TIMEOUT, true);
+
+    // Tick through 10 blink periods, writing to the status LED once every
+    // half period
+    for (uint32_t time_ms = 0; time_ms < 10 * BOARD_STATUS_LED_BLINK_PERIOD_MS;
+         time_ms += 10)
+    {
+        App_BoardStatusLeds_Tick(board_status_leds, time_ms);
+    }
+
+    ASSERT_EQ(10, turn_bms_led_red_fake.call_count);
+    ASSERT_EQ(10, turn_off_bms_led_fake.call_count);
+    ASSERT_EQ(0, turn_bms_led_blue_fake.call_count);
+    ASSERT_EQ(0, turn_off_other_led_fake.call_count);
+}
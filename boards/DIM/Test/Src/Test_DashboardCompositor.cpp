@@ -0,0 +1,271 @@
+#include "Test_Dim.h"
+
+extern "C"
+{
+#include "App_DashboardCompositor.h"
+#include "App_SevenSegDisplays.h"
+#include "App_SevenSegDisplay.h"
+#include "App_Led.h"
+#include "configs/App_DashboardCompositorConfig.h"
+}
+
+namespace DashboardCompositorTest
+{
+FAKE_VOID_FUNC(set_right_hex_digit, struct SevenSegHexDigit);
+FAKE_VOID_FUNC(set_middle_hex_digit, struct SevenSegHexDigit);
+FAKE_VOID_FUNC(set_left_hex_digit, struct SevenSegHexDigit);
+FAKE_VOID_FUNC(display_value_callback);
+FAKE_VOID_FUNC(turn_on_imd_led);
+FAKE_VOID_FUNC(turn_off_imd_led);
+FAKE_VOID_FUNC(turn_on_bspd_led);
+FAKE_VOID_FUNC(turn_off_bspd_led);
+
+class DashboardCompositorTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        left_seven_seg_display = App_SevenSegDisplay_Create(set_left_hex_digit);
+        middle_seven_seg_display =
+            App_SevenSegDisplay_Create(set_middle_hex_digit);
+        right_seven_seg_display =
+            App_SevenSegDisplay_Create(set_right_hex_digit);
+        seven_seg_displays = App_SevenSegDisplays_Create(
+            left_seven_seg_display, middle_seven_seg_display,
+            right_seven_seg_display, display_value_callback);
+        imd_led    = App_Led_Create(turn_on_imd_led, turn_off_imd_led);
+        bspd_led   = App_Led_Create(turn_on_bspd_led, turn_off_bspd_led);
+        compositor = App_DashboardCompositor_Create(
+            seven_seg_displays, imd_led, bspd_led);
+
+        RESET_FAKE(set_right_hex_digit);
+        RESET_FAKE(set_middle_hex_digit);
+        RESET_FAKE(set_left_hex_digit);
+        RESET_FAKE(display_value_callback);
+        RESET_FAKE(turn_on_imd_led);
+        RESET_FAKE(turn_off_imd_led);
+        RESET_FAKE(turn_on_bspd_led);
+        RESET_FAKE(turn_off_bspd_led);
+    }
+
+    void TearDown() override
+    {
+        TearDownObject(compositor, App_DashboardCompositor_Destroy);
+        TearDownObject(left_seven_seg_display, App_SevenSegDisplay_Destroy);
+        TearDownObject(middle_seven_seg_display, App_SevenSegDisplay_Destroy);
+        TearDownObject(right_seven_seg_display, App_SevenSegDisplay_Destroy);
+        TearDownObject(seven_seg_displays, App_SevenSegDisplays_Destroy);
+        TearDownObject(imd_led, App_Led_Destroy);
+        TearDownObject(bspd_led, App_Led_Destroy);
+    }
+
+    // Post a request that shows the given value on the 7-segment displays
+    void PostValue(
+        enum DashboardSource   source,
+        enum DashboardSeverity severity,
+        uint32_t               value,
+        uint32_t               current_time_ms)
+    {
+        struct DashboardRequest request = {};
+        request.severity                = severity;
+        request.seven_seg_format        = DASHBOARD_SEVEN_SEG_VALUE;
+        request.value                   = value;
+
+        App_DashboardCompositor_Post(
+            compositor, source, &request, current_time_ms);
+    }
+
+    // Get the value shown on the 7-segment displays, where each display that
+    // is turned off counts as 0
+    uint32_t GetShownValue(void)
+    {
+        uint32_t value = 0;
+
+        if (set_right_hex_digit_fake.arg0_val.enabled)
+        {
+            value += 100U * set_right_hex_digit_fake.arg0_val.value;
+        }
+        if (set_middle_hex_digit_fake.arg0_val.enabled)
+        {
+            value += 10U * set_middle_hex_digit_fake.arg0_val.value;
+        }
+        if (set_left_hex_digit_fake.arg0_val.enabled)
+        {
+            value += set_left_hex_digit_fake.arg0_val.value;
+        }
+
+        return value;
+    }
+
+    struct SevenSegDisplay *    left_seven_seg_display;
+    struct SevenSegDisplay *    middle_seven_seg_display;
+    struct SevenSegDisplay *    right_seven_seg_display;
+    struct SevenSegDisplays *   seven_seg_displays;
+    struct Led *                imd_led;
+    struct Led *                bspd_led;
+    struct DashboardCompositor *compositor;
+};
+
+TEST_F(DashboardCompositorTest, first_frame_is_rendered_without_requests)
+{
+    App_DashboardCompositor_Tick(compositor, 0);
+    ASSERT_EQ(1, display_value_callback_fake.call_count);
+    ASSERT_EQ(false, set_left_hex_digit_fake.arg0_val.enabled);
+    ASSERT_EQ(false, set_middle_hex_digit_fake.arg0_val.enabled);
+    ASSERT_EQ(false, set_right_hex_digit_fake.arg0_val.enabled);
+    ASSERT_EQ(1, turn_off_imd_led_fake.call_count);
+    ASSERT_EQ(1, turn_off_bspd_led_fake.call_count);
+    ASSERT_EQ(0, turn_on_imd_led_fake.call_count);
+    ASSERT_EQ(0, turn_on_bspd_led_fake.call_count);
+}
+
+TEST_F(DashboardCompositorTest, highest_severity_request_wins_seven_seg)
+{
+    PostValue(DASHBOARD_SOURCE_PAGES, DASHBOARD_SEVERITY_INFO, 80, 0);
+    App_DashboardCompositor_Tick(compositor, 0);
+    ASSERT_EQ(80, GetShownValue());
+
+    PostValue(DASHBOARD_SOURCE_ERRORS, DASHBOARD_SEVERITY_WARNING, 510, 0);
+    App_DashboardCompositor_Tick(compositor, 0);
+    ASSERT_EQ(510, GetShownValue());
+
+    // A later source only wins with a higher severity
+    PostValue(DASHBOARD_SOURCE_PAGES, DASHBOARD_SEVERITY_WARNING, 81, 0);
+    App_DashboardCompositor_Tick(compositor, 0);
+    ASSERT_EQ(510, GetShownValue());
+
+    PostValue(DASHBOARD_SOURCE_PAGES, DASHBOARD_SEVERITY_CRITICAL, 82, 0);
+    App_DashboardCompositor_Tick(compositor, 0);
+    ASSERT_EQ(82, GetShownValue());
+
+    // Once the winning request is cancelled, the next one is shown
+    App_DashboardCompositor_Cancel(compositor, DASHBOARD_SOURCE_PAGES);
+    App_DashboardCompositor_Tick(compositor, 0);
+    ASSERT_EQ(510, GetShownValue());
+}
+
+TEST_F(DashboardCompositorTest, leds_of_every_request_are_shown)
+{
+    struct DashboardRequest imd_request = {};
+    imd_request.severity                = DASHBOARD_SEVERITY_CRITICAL;
+    imd_request.led_mask                = DASHBOARD_LED_MASK(DASHBOARD_IMD_LED);
+    struct DashboardRequest bspd_request = {};
+    bspd_request.severity                = DASHBOARD_SEVERITY_WARNING;
+    bspd_request.led_mask = DASHBOARD_LED_MASK(DASHBOARD_BSPD_LED);
+
+    App_DashboardCompositor_Post(
+        compositor, DASHBOARD_SOURCE_IMD, &imd_request, 0);
+    App_DashboardCompositor_Post(
+        compositor, DASHBOARD_SOURCE_BSPD, &bspd_request, 0);
+    PostValue(DASHBOARD_SOURCE_PAGES, DASHBOARD_SEVERITY_INFO, 80, 0);
+    App_DashboardCompositor_Tick(compositor, 0);
+    ASSERT_EQ(1, turn_on_imd_led_fake.call_count);
+    ASSERT_EQ(1, turn_on_bspd_led_fake.call_count);
+
+    // Requests without 7-segment content don't hide the others
+    ASSERT_EQ(80, GetShownValue());
+
+    App_DashboardCompositor_Cancel(compositor, DASHBOARD_SOURCE_IMD);
+    App_DashboardCompositor_Tick(compositor, 10);
+    ASSERT_EQ(1, turn_off_imd_led_fake.call_count);
+    ASSERT_EQ(0, turn_off_bspd_led_fake.call_count);
+}
+
+TEST_F(DashboardCompositorTest, blinking_request_is_hidden_half_the_time)
+{
+    struct DashboardRequest request = {};
+    request.severity                = DASHBOARD_SEVERITY_CRITICAL;
+    request.seven_seg_format        = DASHBOARD_SEVEN_SEG_PREFIXED_VALUE;
+    request.prefix                  = HEX_DIGIT_C;
+    request.value                   = 91;
+    request.led_mask                = DASHBOARD_LED_MASK(DASHBOARD_IMD_LED);
+    request.is_blinking             = true;
+
+    App_DashboardCompositor_Post(
+        compositor, DASHBOARD_SOURCE_CELL_MONITOR_OVER_TEMPERATURE, &request,
+        0);
+    PostValue(DASHBOARD_SOURCE_PAGES, DASHBOARD_SEVERITY_INFO, 80, 0);
+
+    App_DashboardCompositor_Tick(compositor, 0);
+    ASSERT_EQ(true, set_right_hex_digit_fake.arg0_val.enabled);
+    ASSERT_EQ(HEX_DIGIT_C, set_right_hex_digit_fake.arg0_val.value);
+    ASSERT_EQ(1, turn_on_imd_led_fake.call_count);
+
+    // The displays are turned off rather than showing the losing request
+    App_DashboardCompositor_Tick(compositor, DASHBOARD_BLINK_PERIOD_MS / 2);
+    ASSERT_EQ(false, set_left_hex_digit_fake.arg0_val.enabled);
+    ASSERT_EQ(false, set_middle_hex_digit_fake.arg0_val.enabled);
+    ASSERT_EQ(false, set_right_hex_digit_fake.arg0_val.enabled);
+    ASSERT_EQ(1, turn_off_imd_led_fake.call_count);
+
+    App_DashboardCompositor_Tick(compositor, DASHBOARD_BLINK_PERIOD_MS);
+    ASSERT_EQ(true, set_right_hex_digit_fake.arg0_val.enabled);
+    ASSERT_EQ(2, turn_on_imd_led_fake.call_count);
+}
+
+TEST_F(DashboardCompositorTest, request_expires_after_its_timeout)
+{
+    struct DashboardRequest request = {};
+    request.severity                = DASHBOARD_SEVERITY_WARNING;
+    request.seven_seg_format        = DASHBOARD_SEVEN_SEG_VALUE;
+    request.value                   = 510;
+    request.timeout_ms              = 1000;
+
+    App_DashboardCompositor_Post(
+        compositor, DASHBOARD_SOURCE_ERRORS, &request, 100);
+    PostValue(DASHBOARD_SOURCE_PAGES, DASHBOARD_SEVERITY_INFO, 80, 100);
+
+    App_DashboardCompositor_Tick(compositor, 1099);
+    ASSERT_EQ(510, GetShownValue());
+
+    App_DashboardCompositor_Tick(compositor, 1100);
+    ASSERT_EQ(80, GetShownValue());
+
+    // Reposting a request restarts its timeout
+    App_DashboardCompositor_Post(
+        compositor, DASHBOARD_SOURCE_ERRORS, &request, 1200);
+    App_DashboardCompositor_Tick(compositor, 2100);
+    ASSERT_EQ(510, GetShownValue());
+    App_DashboardCompositor_Tick(compositor, 2200);
+    ASSERT_EQ(80, GetShownValue());
+}
+
+TEST_F(DashboardCompositorTest, frame_is_only_rendered_when_it_changes)
+{
+    for (uint32_t current_time_ms = 0; current_time_ms < 1000;
+         current_time_ms += 10)
+    {
+        PostValue(
+            DASHBOARD_SOURCE_PAGES, DASHBOARD_SEVERITY_INFO, 80,
+            current_time_ms);
+        App_DashboardCompositor_Tick(compositor, current_time_ms);
+    }
+    ASSERT_EQ(1, display_value_callback_fake.call_count);
+    ASSERT_EQ(1, turn_off_imd_led_fake.call_count);
+    ASSERT_EQ(1, turn_off_bspd_led_fake.call_count);
+
+    PostValue(DASHBOARD_SOURCE_PAGES, DASHBOARD_SEVERITY_INFO, 81, 1000);
+    App_DashboardCompositor_Tick(compositor, 1000);
+    ASSERT_EQ(2, display_value_callback_fake.call_count);
+    ASSERT_EQ(1, turn_off_imd_led_fake.call_count);
+}
+
+TEST_F(DashboardCompositorTest, values_too_large_to_show_are_clamped)
+{
+    PostValue(DASHBOARD_SOURCE_PAGES, DASHBOARD_SEVERITY_INFO, 1234, 0);
+    App_DashboardCompositor_Tick(compositor, 0);
+    ASSERT_EQ(MAX_UNSIGNED_BASE10_VALUE, GetShownValue());
+
+    struct DashboardRequest request = {};
+    request.seven_seg_format        = DASHBOARD_SEVEN_SEG_PREFIXED_VALUE;
+    request.prefix                  = HEX_DIGIT_B;
+    request.value                   = 123;
+    App_DashboardCompositor_Post(
+        compositor, DASHBOARD_SOURCE_PAGES, &request, 0);
+    App_DashboardCompositor_Tick(compositor, 0);
+    ASSERT_EQ(HEX_DIGIT_B, set_right_hex_digit_fake.arg0_val.value);
+    ASSERT_EQ(9, set_middle_hex_digit_fake.arg0_val.value);
+    ASSERT_EQ(9, set_left_hex_digit_fake.arg0_val.value);
+}
+
+} // namespace DashboardCompositorTest
@@ -3,18 +3,39 @@
 extern "C"
 {
 #include "App_RegenPaddle.h"
+#include "configs/App_RegenPaddleConfig.h"
 }
 
-FAKE_VALUE_FUNC(uint32_t, get_raw_paddle_position);
+FAKE_VALUE_FUNC(uint32_t, get_paddle_voltage);
+FAKE_VALUE_FUNC(bool, load_calibration, struct RegenPaddleCalibration *);
+FAKE_VOID_FUNC(save_calibration, const struct RegenPaddleCalibration *);
+
+// The stored calibration, in which 1% of the paddle travel is 20mV
+static constexpr uint32_t STORED_RELEASED_VOLTAGE_MV = 600U;
+static constexpr uint32_t STORED_PRESSED_VOLTAGE_MV  = 2600U;
+
+static bool load_stored_calibration(struct RegenPaddleCalibration *calibration)
+{
+    calibration->released_voltage_mv = STORED_RELEASED_VOLTAGE_MV;
+    calibration->pressed_voltage_mv  = STORED_PRESSED_VOLTAGE_MV;
+    return true;
+}
 
 class RegenPaddleTest : public testing::Test
 {
   protected:
     void SetUp() override
     {
-        regen_paddle = App_RegenPaddle_Create(
-            get_raw_paddle_position, DEFAULT_LOWER_DEADZONE,
-            DEFAULT_UPPER_DEADZONE);
+        RESET_FAKE(get_paddle_voltage);
+        RESET_FAKE(load_calibration);
+        RESET_FAKE(save_calibration);
+
+        current_time_ms = 0U;
+
+        load_calibration_fake.custom_fake = load_stored_calibration;
+        regen_paddle                      = App_RegenPaddle_Create(
+            get_paddle_voltage, load_calibration, save_calibration,
+            DEFAULT_LOWER_DEADZONE, DEFAULT_UPPER_DEADZONE);
     }
 
     void TearDown() override
@@ -22,39 +43,66 @@ class RegenPaddleTest : public testing::Test
         TearDownObject(regen_paddle, App_RegenPaddle_Destroy);
     }
 
+    // Tick the regen paddle with the voltage at the given paddle position, in
+    // % of the stored calibrated travel
+    void TickAtPaddlePosition(uint32_t paddle_position)
+    {
+        TickAtVoltageForMs(
+            STORED_RELEASED_VOLTAGE_MV +
+                paddle_position *
+                    (STORED_PRESSED_VOLTAGE_MV - STORED_RELEASED_VOLTAGE_MV) /
+                    100U,
+            1U);
+    }
+
+    // Tick the regen paddle every ms for the given duration with the given
+    // paddle voltage
+    void TickAtVoltageForMs(uint32_t paddle_voltage_mv, uint32_t duration_ms)
+    {
+        get_paddle_voltage_fake.return_val = paddle_voltage_mv;
+        for (uint32_t ms = 0U; ms < duration_ms; ms++)
+        {
+            App_RegenPaddle_Tick(regen_paddle, current_time_ms++);
+        }
+    }
+
+    // How many ticks a voltage must be held for to be steady enough to widen
+    // an endpoint
+    const uint32_t      STEADY_TICKS = REGEN_PADDLE_CALIBRATION_STEADY_MS + 1U;
     const uint32_t      DEFAULT_LOWER_DEADZONE = 5;
     const uint32_t      DEFAULT_UPPER_DEADZONE = 95;
+    uint32_t            current_time_ms;
     struct RegenPaddle *regen_paddle;
 };
 
 TEST_F(RegenPaddleTest, lower_deadzone)
 {
     uint32_t buffer;
-    get_raw_paddle_position_fake.return_val = DEFAULT_LOWER_DEADZONE - 1;
+    TickAtPaddlePosition(DEFAULT_LOWER_DEADZONE - 1);
     ASSERT_EQ(
         EXIT_CODE_OK,
         App_RegenPaddle_GetRawPaddlePosition(regen_paddle, &buffer));
-    ASSERT_EQ(get_raw_paddle_position_fake.return_val, buffer);
+    ASSERT_EQ(DEFAULT_LOWER_DEADZONE - 1, buffer);
     ASSERT_EQ(
         EXIT_CODE_OK,
         App_RegenPaddle_GetMappedPaddlePosition(regen_paddle, &buffer));
     ASSERT_EQ(0, buffer);
 
-    get_raw_paddle_position_fake.return_val = DEFAULT_LOWER_DEADZONE;
+    TickAtPaddlePosition(DEFAULT_LOWER_DEADZONE);
     ASSERT_EQ(
         EXIT_CODE_OK,
         App_RegenPaddle_GetRawPaddlePosition(regen_paddle, &buffer));
-    ASSERT_EQ(get_raw_paddle_position_fake.return_val, buffer);
+    ASSERT_EQ(DEFAULT_LOWER_DEADZONE, buffer);
     ASSERT_EQ(
         EXIT_CODE_OK,
         App_RegenPaddle_GetMappedPaddlePosition(regen_paddle, &buffer));
     ASSERT_EQ(0, buffer);
 
-    get_raw_paddle_position_fake.return_val = DEFAULT_LOWER_DEADZONE + 1;
+    TickAtPaddlePosition(DEFAULT_LOWER_DEADZONE + 1);
     ASSERT_EQ(
         EXIT_CODE_OK,
         App_RegenPaddle_GetRawPaddlePosition(regen_paddle, &buffer));
-    ASSERT_EQ(get_raw_paddle_position_fake.return_val, buffer);
+    ASSERT_EQ(DEFAULT_LOWER_DEADZONE + 1, buffer);
     ASSERT_EQ(
         EXIT_CODE_OK,
         App_RegenPaddle_GetMappedPaddlePosition(regen_paddle, &buffer));
@@ -64,51 +112,50 @@ TEST_F(RegenPaddleTest, lower_deadzone)
 TEST_F(RegenPaddleTest, upper_deadzone)
 {
     uint32_t buffer;
-    get_raw_paddle_position_fake.return_val = DEFAULT_UPPER_DEADZONE - 1;
+    TickAtPaddlePosition(DEFAULT_UPPER_DEADZONE - 1);
     ASSERT_EQ(
         EXIT_CODE_OK,
         App_RegenPaddle_GetRawPaddlePosition(regen_paddle, &buffer));
-    ASSERT_EQ(get_raw_paddle_position_fake.return_val, buffer);
+    ASSERT_EQ(DEFAULT_UPPER_DEADZONE - 1, buffer);
     ASSERT_EQ(
         EXIT_CODE_OK,
         App_RegenPaddle_GetMappedPaddlePosition(regen_paddle, &buffer));
     ASSERT_NE(100, buffer);
 
-    get_raw_paddle_position_fake.return_val = DEFAULT_UPPER_DEADZONE;
+    TickAtPaddlePosition(DEFAULT_UPPER_DEADZONE);
     ASSERT_EQ(
         EXIT_CODE_OK,
         App_RegenPaddle_GetRawPaddlePosition(regen_paddle, &buffer));
-    ASSERT_EQ(get_raw_paddle_position_fake.return_val, buffer);
+    ASSERT_EQ(DEFAULT_UPPER_DEADZONE, buffer);
     ASSERT_EQ(
         EXIT_CODE_OK,
         App_RegenPaddle_GetMappedPaddlePosition(regen_paddle, &buffer));
     ASSERT_EQ(100, buffer);
 
-    get_raw_paddle_position_fake.return_val = DEFAULT_UPPER_DEADZONE + 1;
+    TickAtPaddlePosition(DEFAULT_UPPER_DEADZONE + 1);
     ASSERT_EQ(
         EXIT_CODE_OK,
         App_RegenPaddle_GetRawPaddlePosition(regen_paddle, &buffer));
-    ASSERT_EQ(get_raw_paddle_position_fake.return_val, buffer);
+    ASSERT_EQ(DEFAULT_UPPER_DEADZONE + 1, buffer);
     ASSERT_EQ(
         EXIT_CODE_OK,
         App_RegenPaddle_GetMappedPaddlePosition(regen_paddle, &buffer));
     ASSERT_EQ(100, buffer);
 }
 
-TEST_F(RegenPaddleTest, invalid_paddle_positions)
+TEST_F(RegenPaddleTest, invalid_paddle_voltages)
 {
     uint32_t buffer;
-    get_raw_paddle_position_fake.return_val = 100;
+
+    // Positions aren't available until the paddle is ticked
     ASSERT_EQ(
-        EXIT_CODE_OK,
+        EXIT_CODE_OUT_OF_RANGE,
         App_RegenPaddle_GetRawPaddlePosition(regen_paddle, &buffer));
-    ASSERT_EQ(get_raw_paddle_position_fake.return_val, buffer);
     ASSERT_EQ(
-        EXIT_CODE_OK,
+        EXIT_CODE_OUT_OF_RANGE,
         App_RegenPaddle_GetMappedPaddlePosition(regen_paddle, &buffer));
-    ASSERT_EQ(100, buffer);
 
-    get_raw_paddle_position_fake.return_val = 101;
+    TickAtVoltageForMs(REGEN_PADDLE_MIN_VALID_VOLTAGE_MV - 1, STEADY_TICKS);
     ASSERT_EQ(
         EXIT_CODE_OUT_OF_RANGE,
         App_RegenPaddle_GetRawPaddlePosition(regen_paddle, &buffer));
@@ -116,11 +163,246 @@ TEST_F(RegenPaddleTest, invalid_paddle_positions)
         EXIT_CODE_OUT_OF_RANGE,
         App_RegenPaddle_GetMappedPaddlePosition(regen_paddle, &buffer));
 
-    get_raw_paddle_position_fake.return_val = 102;
+    TickAtVoltageForMs(REGEN_PADDLE_MAX_VALID_VOLTAGE_MV + 1, STEADY_TICKS);
     ASSERT_EQ(
         EXIT_CODE_OUT_OF_RANGE,
         App_RegenPaddle_GetRawPaddlePosition(regen_paddle, &buffer));
     ASSERT_EQ(
         EXIT_CODE_OUT_OF_RANGE,
         App_RegenPaddle_GetMappedPaddlePosition(regen_paddle, &buffer));
+
+    // Invalid voltages are not learnt as endpoints
+    TickAtPaddlePosition(100);
+    ASSERT_EQ(
+        EXIT_CODE_OK,
+        App_RegenPaddle_GetRawPaddlePosition(regen_paddle, &buffer));
+    ASSERT_EQ(100, buffer);
+}
+
+TEST_F(RegenPaddleTest, paddle_is_read_once_per_tick)
+{
+    uint32_t buffer;
+    TickAtPaddlePosition(50);
+    ASSERT_EQ(1, get_paddle_voltage_fake.call_count);
+
+    // The positions are cached until the next tick
+    get_paddle_voltage_fake.return_val = STORED_PRESSED_VOLTAGE_MV;
+    App_RegenPaddle_GetRawPaddlePosition(regen_paddle, &buffer);
+    ASSERT_EQ(50, buffer);
+    App_RegenPaddle_GetMappedPaddlePosition(regen_paddle, &buffer);
+    ASSERT_EQ(50, buffer);
+    ASSERT_EQ(1, get_paddle_voltage_fake.call_count);
+}
+
+TEST_F(RegenPaddleTest, default_calibration_is_used_without_valid_stored_one)
+{
+    uint32_t buffer;
+
+    // A stored calibration with an endpoint outside of the calibration window
+    // is discarded
+    load_calibration_fake.custom_fake =
+        [](struct RegenPaddleCalibration *calibration) {
+            calibration->released_voltage_mv =
+                REGEN_PADDLE_DEFAULT_RELEASED_VOLTAGE_MV +
+                REGEN_PADDLE_CALIBRATION_WINDOW_MV + 1U;
+            calibration->pressed_voltage_mv =
+                REGEN_PADDLE_DEFAULT_PRESSED_VOLTAGE_MV;
+            return true;
+        };
+    TearDownObject(regen_paddle, App_RegenPaddle_Destroy);
+    regen_paddle = App_RegenPaddle_Create(
+        get_paddle_voltage, load_calibration, save_calibration,
+        DEFAULT_LOWER_DEADZONE, DEFAULT_UPPER_DEADZONE);
+
+    TickAtVoltageForMs(
+        (REGEN_PADDLE_DEFAULT_RELEASED_VOLTAGE_MV +
+         REGEN_PADDLE_DEFAULT_PRESSED_VOLTAGE_MV) /
+            2U,
+        1U);
+    App_RegenPaddle_GetRawPaddlePosition(regen_paddle, &buffer);
+    ASSERT_EQ(50, buffer);
+
+    load_calibration_fake.custom_fake =
+        [](struct RegenPaddleCalibration *calibration) {
+            calibration->released_voltage_mv =
+                REGEN_PADDLE_DEFAULT_RELEASED_VOLTAGE_MV;
+            calibration->pressed_voltage_mv =
+                REGEN_PADDLE_DEFAULT_PRESSED_VOLTAGE_MV +
+                REGEN_PADDLE_CALIBRATION_WINDOW_MV + 1U;
+            return true;
+        };
+    TearDownObject(regen_paddle, App_RegenPaddle_Destroy);
+    regen_paddle = App_RegenPaddle_Create(
+        get_paddle_voltage, load_calibration, save_calibration,
+        DEFAULT_LOWER_DEADZONE, DEFAULT_UPPER_DEADZONE);
+
+    App_RegenPaddle_Tick(regen_paddle, current_time_ms++);
+    App_RegenPaddle_GetRawPaddlePosition(regen_paddle, &buffer);
+    ASSERT_EQ(50, buffer);
+
+    // So is a missing one
+    load_calibration_fake.custom_fake = NULL;
+    load_calibration_fake.return_val  = false;
+    TearDownObject(regen_paddle, App_RegenPaddle_Destroy);
+    regen_paddle = App_RegenPaddle_Create(
+        get_paddle_voltage, load_calibration, save_calibration,
+        DEFAULT_LOWER_DEADZONE, DEFAULT_UPPER_DEADZONE);
+
+    App_RegenPaddle_Tick(regen_paddle, current_time_ms++);
+    App_RegenPaddle_GetRawPaddlePosition(regen_paddle, &buffer);
+    ASSERT_EQ(50, buffer);
+}
+
+TEST_F(RegenPaddleTest, endpoints_widen_to_the_paddle_travel)
+{
+    uint32_t buffer;
+
+    // Holding the paddle past the pressed end moves the pressed end, so the
+    // paddle still maps to 100%
+    TickAtVoltageForMs(STORED_PRESSED_VOLTAGE_MV + 200U, STEADY_TICKS);
+    App_RegenPaddle_GetRawPaddlePosition(regen_paddle, &buffer);
+    ASSERT_EQ(100, buffer);
+
+    // The old pressed end is now 2000 / 2200 of the travel
+    TickAtVoltageForMs(STORED_PRESSED_VOLTAGE_MV, 1U);
+    App_RegenPaddle_GetRawPaddlePosition(regen_paddle, &buffer);
+    ASSERT_EQ(90, buffer);
+
+    // Holding the paddle past the released end moves the released end
+    TickAtVoltageForMs(STORED_RELEASED_VOLTAGE_MV - 200U, STEADY_TICKS);
+    App_RegenPaddle_GetRawPaddlePosition(regen_paddle, &buffer);
+    ASSERT_EQ(0, buffer);
+
+    TickAtVoltageForMs(
+        (STORED_RELEASED_VOLTAGE_MV + STORED_PRESSED_VOLTAGE_MV) / 2U, 1U);
+    App_RegenPaddle_GetRawPaddlePosition(regen_paddle, &buffer);
+    ASSERT_EQ(50, buffer);
+}
+
+TEST_F(RegenPaddleTest, endpoints_dont_widen_to_unsteady_voltages)
+{
+    uint32_t buffer;
+
+    // A voltage past the pressed end that isn't held for long enough maps to
+    // the pressed end, but doesn't move it
+    TickAtVoltageForMs(STORED_PRESSED_VOLTAGE_MV + 200U, STEADY_TICKS - 1U);
+    App_RegenPaddle_GetRawPaddlePosition(regen_paddle, &buffer);
+    ASSERT_EQ(100, buffer);
+
+    TickAtVoltageForMs(STORED_PRESSED_VOLTAGE_MV, 1U);
+    App_RegenPaddle_GetRawPaddlePosition(regen_paddle, &buffer);
+    ASSERT_EQ(100, buffer);
+
+    // Neither does one that keeps moving by more than the steady band
+    for (uint32_t i = 0U; i < 10U * STEADY_TICKS; i++)
+    {
+        TickAtVoltageForMs(
+            STORED_PRESSED_VOLTAGE_MV + 200U +
+                (i % 2U) * (REGEN_PADDLE_CALIBRATION_STEADY_BAND_MV + 1U),
+            1U);
+    }
+
+    TickAtVoltageForMs(STORED_PRESSED_VOLTAGE_MV, 1U);
+    App_RegenPaddle_GetRawPaddlePosition(regen_paddle, &buffer);
+    ASSERT_EQ(100, buffer);
+
+    TickAtVoltageForMs(STORED_RELEASED_VOLTAGE_MV, 1U);
+    App_RegenPaddle_SaveCalibrationIfPending(regen_paddle);
+    ASSERT_EQ(0, save_calibration_fake.call_count);
+}
+
+TEST_F(RegenPaddleTest, endpoints_dont_widen_past_the_calibration_window)
+{
+    uint32_t buffer;
+
+    const uint32_t max_pressed_voltage_mv =
+        REGEN_PADDLE_DEFAULT_PRESSED_VOLTAGE_MV +
+        REGEN_PADDLE_CALIBRATION_WINDOW_MV;
+
+    TickAtVoltageForMs(REGEN_PADDLE_MAX_VALID_VOLTAGE_MV, 10U * STEADY_TICKS);
+    App_RegenPaddle_GetRawPaddlePosition(regen_paddle, &buffer);
+    ASSERT_EQ(100, buffer);
+
+    // The pressed end stops at the edge of the window, so the stored pressed
+    // end is 2000 / 2300 of the travel
+    TickAtVoltageForMs(STORED_PRESSED_VOLTAGE_MV, 1U);
+    App_RegenPaddle_GetRawPaddlePosition(regen_paddle, &buffer);
+    ASSERT_EQ(86, buffer);
+
+    TickAtVoltageForMs(STORED_RELEASED_VOLTAGE_MV, 1U);
+    App_RegenPaddle_SaveCalibrationIfPending(regen_paddle);
+    ASSERT_EQ(1, save_calibration_fake.call_count);
+    ASSERT_EQ(
+        max_pressed_voltage_mv,
+        save_calibration_fake.arg0_val->pressed_voltage_mv);
+}
+
+TEST_F(RegenPaddleTest, calibration_is_saved_when_released_and_changed)
+{
+    // Endpoints that move less than the threshold aren't saved
+    TickAtVoltageForMs(
+        STORED_RELEASED_VOLTAGE_MV -
+            (REGEN_PADDLE_CALIBRATION_SAVE_THRESHOLD_MV - 1U),
+        STEADY_TICKS);
+    App_RegenPaddle_SaveCalibrationIfPending(regen_paddle);
+    ASSERT_EQ(0, save_calibration_fake.call_count);
+
+    // Endpoints that move further aren't saved while the paddle is pressed
+    TickAtVoltageForMs(
+        STORED_PRESSED_VOLTAGE_MV + REGEN_PADDLE_CALIBRATION_SAVE_THRESHOLD_MV,
+        STEADY_TICKS);
+    App_RegenPaddle_SaveCalibrationIfPending(regen_paddle);
+    ASSERT_EQ(0, save_calibration_fake.call_count);
+
+    // Until it is released
+    TickAtVoltageForMs(STORED_RELEASED_VOLTAGE_MV, 1U);
+    ASSERT_EQ(0, save_calibration_fake.call_count);
+    App_RegenPaddle_SaveCalibrationIfPending(regen_paddle);
+    ASSERT_EQ(1, save_calibration_fake.call_count);
+    ASSERT_EQ(
+        STORED_RELEASED_VOLTAGE_MV -
+            (REGEN_PADDLE_CALIBRATION_SAVE_THRESHOLD_MV - 1U),
+        save_calibration_fake.arg0_val->released_voltage_mv);
+    ASSERT_EQ(
+        STORED_PRESSED_VOLTAGE_MV + REGEN_PADDLE_CALIBRATION_SAVE_THRESHOLD_MV,
+        save_calibration_fake.arg0_val->pressed_voltage_mv);
+
+    // The saved calibration is only saved once
+    TickAtVoltageForMs(STORED_RELEASED_VOLTAGE_MV, 1U);
+    App_RegenPaddle_SaveCalibrationIfPending(regen_paddle);
+    ASSERT_EQ(1, save_calibration_fake.call_count);
+}
+
+TEST_F(RegenPaddleTest, reset_calibration_is_saved_when_released)
+{
+    uint32_t buffer;
+
+    TickAtVoltageForMs(STORED_PRESSED_VOLTAGE_MV + 200U, STEADY_TICKS);
+    TickAtVoltageForMs(STORED_RELEASED_VOLTAGE_MV, 1U);
+    App_RegenPaddle_SaveCalibrationIfPending(regen_paddle);
+    ASSERT_EQ(1, save_calibration_fake.call_count);
+
+    // The paddle is mapped against the defaults right away
+    App_RegenPaddle_ResetCalibration(regen_paddle);
+    TickAtVoltageForMs(
+        (REGEN_PADDLE_DEFAULT_RELEASED_VOLTAGE_MV +
+         REGEN_PADDLE_DEFAULT_PRESSED_VOLTAGE_MV) /
+            2U,
+        1U);
+    App_RegenPaddle_GetRawPaddlePosition(regen_paddle, &buffer);
+    ASSERT_EQ(50, buffer);
+
+    // But the defaults aren't saved until the paddle is released
+    App_RegenPaddle_SaveCalibrationIfPending(regen_paddle);
+    ASSERT_EQ(1, save_calibration_fake.call_count);
+
+    TickAtVoltageForMs(REGEN_PADDLE_DEFAULT_RELEASED_VOLTAGE_MV, 1U);
+    App_RegenPaddle_SaveCalibrationIfPending(regen_paddle);
+    ASSERT_EQ(2, save_calibration_fake.call_count);
+    ASSERT_EQ(
+        REGEN_PADDLE_DEFAULT_RELEASED_VOLTAGE_MV,
+        save_calibration_fake.arg0_val->released_voltage_mv);
+    ASSERT_EQ(
+        REGEN_PADDLE_DEFAULT_PRESSED_VOLTAGE_MV,
+        save_calibration_fake.arg0_val->pressed_voltage_mv);
 }
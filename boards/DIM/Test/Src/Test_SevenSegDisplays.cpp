@@ -319,3 +319,43 @@ TEST_F(
     ASSERT_EQ(EXIT_CODE_INVALID_ARGS, exit_code);
     ASSERT_EQ(0, display_value_callback_fake.call_count);
 }
+
+TEST_F(SevenSegDisplaysTest, set_valid_prefixed_unsigned_base10_values)
+{
+    App_SevenSegDisplays_SetPrefixedUnsignedBase10Value(
+        seven_seg_displays, HEX_DIGIT_C, 7);
+    ASSERT_EQ(true, set_left_hex_digit_fake.arg0_history[0].enabled);
+    ASSERT_EQ(true, set_middle_hex_digit_fake.arg0_history[0].enabled);
+    ASSERT_EQ(true, set_right_hex_digit_fake.arg0_history[0].enabled);
+    ASSERT_EQ(7, set_left_hex_digit_fake.arg0_history[0].value);
+    ASSERT_EQ(0, set_middle_hex_digit_fake.arg0_history[0].value);
+    ASSERT_EQ(HEX_DIGIT_C, set_right_hex_digit_fake.arg0_history[0].value);
+
+    App_SevenSegDisplays_SetPrefixedUnsignedBase10Value(
+        seven_seg_displays, HEX_DIGIT_B, 99);
+    ASSERT_EQ(9, set_left_hex_digit_fake.arg0_history[1].value);
+    ASSERT_EQ(9, set_middle_hex_digit_fake.arg0_history[1].value);
+    ASSERT_EQ(HEX_DIGIT_B, set_right_hex_digit_fake.arg0_history[1].value);
+    ASSERT_EQ(2, display_value_callback_fake.call_count);
+}
+
+TEST_F(SevenSegDisplaysTest, set_invalid_prefixed_unsigned_base10_values)
+{
+    ExitCode exit_code = App_SevenSegDisplays_SetPrefixedUnsignedBase10Value(
+        seven_seg_displays, HEX_DIGIT_C, 100);
+    ASSERT_EQ(EXIT_CODE_INVALID_ARGS, exit_code);
+
+    ASSERT_EQ(0, set_left_hex_digit_fake.call_count);
+    ASSERT_EQ(0, set_middle_hex_digit_fake.call_count);
+    ASSERT_EQ(0, set_right_hex_digit_fake.call_count);
+    ASSERT_EQ(0, display_value_callback_fake.call_count);
+}
+
+TEST_F(SevenSegDisplaysTest, turn_off_every_7_seg_display)
+{
+    App_SevenSegDisplays_TurnOff(seven_seg_displays);
+    ASSERT_EQ(false, set_left_hex_digit_fake.arg0_val.enabled);
+    ASSERT_EQ(false, set_middle_hex_digit_fake.arg0_val.enabled);
+    ASSERT_EQ(false, set_right_hex_digit_fake.arg0_val.enabled);
+    ASSERT_EQ(1, display_value_callback_fake.call_count);
+}
@@ -15,6 +15,9 @@ extern "C"
 #include "configs/App_RotarySwitchConfig.h"
 #include "configs/App_RegenPaddleConfig.h"
 #include "configs/App_HeartbeatMonitorConfig.h"
+#include "configs/App_SevenSegPagesConfig.h"
+#include "configs/App_BoardStatusLedsConfig.h"
+#include "configs/App_DashboardCompositorConfig.h"
 }
 
 namespace StateMachineTest
@@ -37,7 +40,25 @@ FAKE_VOID_FUNC(
     enum HeartbeatOneHot,
     enum HeartbeatOneHot);
 
-FAKE_VALUE_FUNC(uint32_t, get_raw_paddle_position);
+FAKE_VALUE_FUNC(uint32_t, get_paddle_voltage);
+FAKE_VALUE_FUNC(
+    bool,
+    load_regen_paddle_calibration,
+    struct RegenPaddleCalibration *);
+FAKE_VOID_FUNC(
+    save_regen_paddle_calibration,
+    const struct RegenPaddleCalibration *);
+
+// Get the paddle voltage at the given paddle position, in % of the default
+// calibrated travel
+static uint32_t GetPaddleVoltage(uint32_t paddle_position)
+{
+    return REGEN_PADDLE_DEFAULT_RELEASED_VOLTAGE_MV +
+           paddle_position *
+               (REGEN_PADDLE_DEFAULT_PRESSED_VOLTAGE_MV -
+                REGEN_PADDLE_DEFAULT_RELEASED_VOLTAGE_MV) /
+               100U;
+}
 
 FAKE_VOID_FUNC(turn_on_red_led);
 FAKE_VOID_FUNC(turn_on_green_led);
@@ -106,7 +127,8 @@ class DimStateMachineTest : public BaseStateMachineTest
             HEARTBEAT_MONITOR_BOARDS_TO_CHECK, heartbeat_timeout_callback);
 
         regen_paddle = App_RegenPaddle_Create(
-            get_raw_paddle_position, REGEN_PADDLE_LOWER_DEADZONE,
+            get_paddle_voltage, load_regen_paddle_calibration,
+            save_regen_paddle_calibration, REGEN_PADDLE_LOWER_DEADZONE,
             REGEN_PADDLE_UPPER_DEADZONE);
 
         rgb_led_sequence = App_SharedRgbLedSequence_Create(
@@ -149,6 +171,13 @@ class DimStateMachineTest : public BaseStateMachineTest
             turn_pdm_status_led_red, turn_pdm_status_led_green,
             turn_pdm_status_led_blue, turn_off_pdm_status_led);
 
+        board_status_leds = App_BoardStatusLeds_Create(
+            error_table, bms_status_led, dcm_status_led, dim_status_led,
+            fsm_status_led, pdm_status_led);
+
+        dashboard_compositor = App_DashboardCompositor_Create(
+            seven_seg_displays, imd_led, bspd_led);
+
         clock = App_SharedClock_Create();
 
         world = App_DimWorld_Create(
@@ -157,7 +186,7 @@ class DimStateMachineTest : public BaseStateMachineTest
             drive_mode_switch, imd_led, bspd_led, start_switch,
             traction_control_switch, torque_vectoring_switch, error_table,
             bms_status_led, dcm_status_led, dim_status_led, fsm_status_led,
-            pdm_status_led, clock);
+            pdm_status_led, board_status_leds, dashboard_compositor, clock);
 
         // Default to starting the state machine in the `Drive` state
         state_machine =
@@ -171,6 +200,9 @@ class DimStateMachineTest : public BaseStateMachineTest
         RESET_FAKE(set_left_hex_digit);
         RESET_FAKE(display_value_callback);
         RESET_FAKE(get_current_ms);
+        RESET_FAKE(get_paddle_voltage);
+        RESET_FAKE(load_regen_paddle_calibration);
+        RESET_FAKE(save_regen_paddle_calibration);
         RESET_FAKE(heartbeat_timeout_callback);
         RESET_FAKE(get_drive_mode_switch_position);
         RESET_FAKE(turn_on_red_led);
@@ -224,6 +256,8 @@ class DimStateMachineTest : public BaseStateMachineTest
         TearDownObject(start_switch, App_BinarySwitch_Destroy);
         TearDownObject(traction_control_switch, App_BinarySwitch_Destroy);
         TearDownObject(torque_vectoring_switch, App_BinarySwitch_Destroy);
+        TearDownObject(board_status_leds, App_BoardStatusLeds_Destroy);
+        TearDownObject(dashboard_compositor, App_DashboardCompositor_Destroy);
         TearDownObject(error_table, App_SharedErrorTable_Destroy);
         TearDownObject(bms_status_led, App_SharedRgbLed_Destroy);
         TearDownObject(dcm_status_led, App_SharedRgbLed_Destroy);
@@ -260,30 +294,32 @@ class DimStateMachineTest : public BaseStateMachineTest
         UNUSED(current_time_ms);
     }
 
-    struct World *            world;
-    struct StateMachine *     state_machine;
-    struct DimCanTxInterface *can_tx_interface;
-    struct DimCanRxInterface *can_rx_interface;
-    struct SevenSegDisplay *  left_seven_seg_display;
-    struct SevenSegDisplay *  middle_seven_seg_display;
-    struct SevenSegDisplay *  right_seven_seg_display;
-    struct SevenSegDisplays * seven_seg_displays;
-    struct HeartbeatMonitor * heartbeat_monitor;
-    struct RgbLedSequence *   rgb_led_sequence;
-    struct RegenPaddle *      regen_paddle;
-    struct Led *              imd_led;
-    struct Led *              bspd_led;
-    struct BinarySwitch *     start_switch;
-    struct BinarySwitch *     traction_control_switch;
-    struct BinarySwitch *     torque_vectoring_switch;
-    struct RotarySwitch *     drive_mode_switch;
-    struct ErrorTable *       error_table;
-    struct RgbLed *           bms_status_led;
-    struct RgbLed *           dcm_status_led;
-    struct RgbLed *           dim_status_led;
-    struct RgbLed *           fsm_status_led;
-    struct RgbLed *           pdm_status_led;
-    struct Clock *            clock;
+    struct World *              world;
+    struct StateMachine *       state_machine;
+    struct DimCanTxInterface *  can_tx_interface;
+    struct DimCanRxInterface *  can_rx_interface;
+    struct SevenSegDisplay *    left_seven_seg_display;
+    struct SevenSegDisplay *    middle_seven_seg_display;
+    struct SevenSegDisplay *    right_seven_seg_display;
+    struct SevenSegDisplays *   seven_seg_displays;
+    struct HeartbeatMonitor *   heartbeat_monitor;
+    struct RgbLedSequence *     rgb_led_sequence;
+    struct RegenPaddle *        regen_paddle;
+    struct Led *                imd_led;
+    struct Led *                bspd_led;
+    struct BinarySwitch *       start_switch;
+    struct BinarySwitch *       traction_control_switch;
+    struct BinarySwitch *       torque_vectoring_switch;
+    struct RotarySwitch *       drive_mode_switch;
+    struct ErrorTable *         error_table;
+    struct RgbLed *             bms_status_led;
+    struct RgbLed *             dcm_status_led;
+    struct RgbLed *             dim_status_led;
+    struct RgbLed *             fsm_status_led;
+    struct RgbLed *             pdm_status_led;
+    struct BoardStatusLeds *    board_status_leds;
+    struct DashboardCompositor *dashboard_compositor;
+    struct Clock *              clock;
 };
 
 // DIM-12
@@ -329,6 +365,47 @@ TEST_F(
     ASSERT_EQ(1, set_right_hex_digit_fake.arg0_history[2].value);
 }
 
+TEST_F(
+    DimStateMachineTest,
+    check_7_seg_displays_cycle_through_pages_in_drive_state_if_there_is_no_error)
+{
+    App_CanRx_BMS_STATE_OF_CHARGE_SetSignal_STATE_OF_CHARGE(
+        can_rx_interface, 80.0f);
+    App_CanRx_PDM_GLV_BATTERY_SetSignal_GLV_STATE_OF_CHARGE(
+        can_rx_interface, 55.0f);
+    App_CanRx_BMS_MAX_CELL_MONITOR_SetSignal_MAX_CELL_MONITOR_DIE_TEMPERATURE(
+        can_rx_interface, 42.0f);
+
+    // The state of charge of the tractive battery
+    LetTimePass(state_machine, STATE_OF_CHARGE_PAGE_DURATION_MS - 10);
+    ASSERT_EQ(true, set_left_hex_digit_fake.arg0_val.enabled);
+    ASSERT_EQ(true, set_middle_hex_digit_fake.arg0_val.enabled);
+    ASSERT_EQ(false, set_right_hex_digit_fake.arg0_val.enabled);
+    ASSERT_EQ(0, set_left_hex_digit_fake.arg0_val.value);
+    ASSERT_EQ(8, set_middle_hex_digit_fake.arg0_val.value);
+
+    // The state of charge of the GLV battery, prefixed with "b"
+    LetTimePass(state_machine, GLV_STATE_OF_CHARGE_PAGE_DURATION_MS);
+    ASSERT_EQ(true, set_right_hex_digit_fake.arg0_val.enabled);
+    ASSERT_EQ(5, set_left_hex_digit_fake.arg0_val.value);
+    ASSERT_EQ(5, set_middle_hex_digit_fake.arg0_val.value);
+    ASSERT_EQ(
+        GLV_STATE_OF_CHARGE_PAGE_PREFIX,
+        set_right_hex_digit_fake.arg0_val.value);
+
+    // The temperature, prefixed with "C"
+    LetTimePass(state_machine, TEMPERATURE_PAGE_DURATION_MS);
+    ASSERT_EQ(true, set_right_hex_digit_fake.arg0_val.enabled);
+    ASSERT_EQ(2, set_left_hex_digit_fake.arg0_val.value);
+    ASSERT_EQ(4, set_middle_hex_digit_fake.arg0_val.value);
+    ASSERT_EQ(TEMPERATURE_PAGE_PREFIX, set_right_hex_digit_fake.arg0_val.value);
+
+    // Back to the state of charge of the tractive battery
+    LetTimePass(state_machine, STATE_OF_CHARGE_PAGE_DURATION_MS);
+    ASSERT_EQ(false, set_right_hex_digit_fake.arg0_val.enabled);
+    ASSERT_EQ(8, set_middle_hex_digit_fake.arg0_val.value);
+}
+
 // DIM-9
 TEST_F(
     DimStateMachineTest,
@@ -403,11 +480,10 @@ TEST_F(
     DimStateMachineTest,
     check_raw_paddle_position_is_broadcasted_over_can_in_drive_state)
 {
-    get_raw_paddle_position_fake.return_val = 50;
+    get_paddle_voltage_fake.return_val = GetPaddleVoltage(50);
     LetTimePass(state_machine, 10);
     ASSERT_EQ(
-        get_raw_paddle_position_fake.return_val,
-        App_CanTx_GetPeriodicSignal_RAW_PADDLE_POSITION(can_tx_interface));
+        50, App_CanTx_GetPeriodicSignal_RAW_PADDLE_POSITION(can_tx_interface));
 }
 
 // DIM-7
@@ -415,10 +491,10 @@ TEST_F(
     DimStateMachineTest,
     check_mapped_paddle_position_is_broadcasted_over_can_in_drive_state)
 {
-    get_raw_paddle_position_fake.return_val = 50;
+    get_paddle_voltage_fake.return_val = GetPaddleVoltage(50);
     LetTimePass(state_machine, 10);
     ASSERT_EQ(
-        get_raw_paddle_position_fake.return_val,
+        50,
         App_CanTx_GetPeriodicSignal_MAPPED_PADDLE_POSITION(can_tx_interface));
 }
 
@@ -428,34 +504,34 @@ TEST_F(
     check_deadzones_for_mapped_paddle_position_in_drive_state)
 {
     // <= 5% maps to 0 %
-    get_raw_paddle_position_fake.return_val = 4;
+    get_paddle_voltage_fake.return_val = GetPaddleVoltage(4);
     LetTimePass(state_machine, 10);
     ASSERT_EQ(
         0,
         App_CanTx_GetPeriodicSignal_MAPPED_PADDLE_POSITION(can_tx_interface));
-    get_raw_paddle_position_fake.return_val = 5;
+    get_paddle_voltage_fake.return_val = GetPaddleVoltage(5);
     LetTimePass(state_machine, 10);
     ASSERT_EQ(
         0,
         App_CanTx_GetPeriodicSignal_MAPPED_PADDLE_POSITION(can_tx_interface));
-    get_raw_paddle_position_fake.return_val = 6;
+    get_paddle_voltage_fake.return_val = GetPaddleVoltage(6);
     LetTimePass(state_machine, 10);
     ASSERT_NE(
         0,
         App_CanTx_GetPeriodicSignal_MAPPED_PADDLE_POSITION(can_tx_interface));
 
     // >= 95% maps to 100%
-    get_raw_paddle_position_fake.return_val = 94;
+    get_paddle_voltage_fake.return_val = GetPaddleVoltage(94);
     LetTimePass(state_machine, 10);
     ASSERT_NE(
         100,
         App_CanTx_GetPeriodicSignal_MAPPED_PADDLE_POSITION(can_tx_interface));
-    get_raw_paddle_position_fake.return_val = 95;
+    get_paddle_voltage_fake.return_val = GetPaddleVoltage(95);
     LetTimePass(state_machine, 10);
     ASSERT_EQ(
         100,
         App_CanTx_GetPeriodicSignal_MAPPED_PADDLE_POSITION(can_tx_interface));
-    get_raw_paddle_position_fake.return_val = 96;
+    get_paddle_voltage_fake.return_val = GetPaddleVoltage(96);
     LetTimePass(state_machine, 10);
     ASSERT_EQ(
         100,
@@ -825,4 +901,221 @@ TEST_F(DimStateMachineTest, pdm_board_status_led_control_with_multiple_errors)
     ASSERT_EQ(0, turn_pdm_status_led_blue_fake.call_count);
 }
 
+TEST_F(
+    DimStateMachineTest,
+    board_status_leds_are_only_written_to_when_their_colour_changes)
+{
+    // Every status LED is written to once, on the first tick
+    LetTimePass(state_machine, 10);
+    ASSERT_EQ(1, turn_bms_status_led_green_fake.call_count);
+    ASSERT_EQ(1, turn_pdm_status_led_green_fake.call_count);
+
+    // While no error changes, no status LED is written to again
+    LetTimePass(state_machine, 1000);
+    ASSERT_EQ(1, turn_bms_status_led_green_fake.call_count);
+    ASSERT_EQ(1, turn_pdm_status_led_green_fake.call_count);
+
+    // Only the status LED of the board with a new error is written to
+    App_SharedErrorTable_SetError(
+        error_table, PDM_NON_CRITICAL_STACK_WATERMARK_ABOVE_THRESHOLD_TASK1HZ,
+        true);
+    LetTimePass(state_machine, 1000);
+    ASSERT_EQ(1, turn_pdm_status_led_blue_fake.call_count);
+    ASSERT_EQ(1, turn_bms_status_led_green_fake.call_count);
+    ASSERT_EQ(0, turn_off_bms_status_led_fake.call_count);
+}
+
+TEST_F(DimStateMachineTest, board_status_led_blinks_with_critical_error)
+{
+    App_SharedErrorTable_SetError(
+        error_table, BMS_AIR_SHUTDOWN_CHARGER_DISCONNECTED_IN_CHARGE_STATE,
+        true);
+
+    // The BMS LED is red for the first half of each blink period and off for
+    // the second half
+    LetTimePass(state_machine, 10);
+    ASSERT_EQ(1, turn_bms_status_led_red_fake.call_count);
+    ASSERT_EQ(0, turn_off_bms_status_led_fake.call_count);
+
+    LetTimePass(state_machine, BOARD_STATUS_LED_BLINK_PERIOD_MS / 2);
+    ASSERT_EQ(1, turn_bms_status_led_red_fake.call_count);
+    ASSERT_EQ(1, turn_off_bms_status_led_fake.call_count);
+
+    LetTimePass(state_machine, BOARD_STATUS_LED_BLINK_PERIOD_MS * 2);
+    ASSERT_EQ(3, turn_bms_status_led_red_fake.call_count);
+    ASSERT_EQ(3, turn_off_bms_status_led_fake.call_count);
+
+    // The other status LEDs don't blink
+    ASSERT_EQ(1, turn_dcm_status_led_green_fake.call_count);
+    ASSERT_EQ(0, turn_off_dcm_status_led_fake.call_count);
+
+    // Once the error is cleared, the BMS LED stops blinking and turns green
+    App_SharedErrorTable_SetError(
+        error_table, BMS_AIR_SHUTDOWN_CHARGER_DISCONNECTED_IN_CHARGE_STATE,
+        false);
+    LetTimePass(state_machine, BOARD_STATUS_LED_BLINK_PERIOD_MS * 2);
+    ASSERT_EQ(1, turn_bms_status_led_green_fake.call_count);
+    ASSERT_EQ(3, turn_bms_status_led_red_fake.call_count);
+    ASSERT_EQ(3, turn_off_bms_status_led_fake.call_count);
+}
+
+TEST_F(
+    DimStateMachineTest,
+    regen_paddle_positions_are_updated_every_1ms_in_drive_state)
+{
+    get_paddle_voltage_fake.return_val = GetPaddleVoltage(50);
+    LetTimePass(state_machine, 1);
+    ASSERT_EQ(
+        50, App_CanTx_GetPeriodicSignal_RAW_PADDLE_POSITION(can_tx_interface));
+    ASSERT_EQ(1, get_paddle_voltage_fake.call_count);
+
+    get_paddle_voltage_fake.return_val = GetPaddleVoltage(96);
+    LetTimePass(state_machine, 1);
+    ASSERT_EQ(
+        100,
+        App_CanTx_GetPeriodicSignal_MAPPED_PADDLE_POSITION(can_tx_interface));
+    ASSERT_EQ(2, get_paddle_voltage_fake.call_count);
+}
+
+TEST_F(DimStateMachineTest, regen_paddle_is_released_when_out_of_range)
+{
+    get_paddle_voltage_fake.return_val = GetPaddleVoltage(50);
+    LetTimePass(state_machine, 1);
+    ASSERT_EQ(
+        50,
+        App_CanTx_GetPeriodicSignal_MAPPED_PADDLE_POSITION(can_tx_interface));
+    ASSERT_FALSE(App_CanTx_GetPeriodicSignal_REGEN_PADDLE_OUT_OF_RANGE(
+        can_tx_interface));
+
+    // An open paddle wire stops commanding regen and is flagged as an error
+    get_paddle_voltage_fake.return_val = REGEN_PADDLE_MAX_VALID_VOLTAGE_MV + 1U;
+    LetTimePass(state_machine, 1);
+    ASSERT_EQ(
+        0,
+        App_CanTx_GetPeriodicSignal_MAPPED_PADDLE_POSITION(can_tx_interface));
+    ASSERT_TRUE(App_CanTx_GetPeriodicSignal_REGEN_PADDLE_OUT_OF_RANGE(
+        can_tx_interface));
+
+    // The error clears once the paddle is back in range
+    get_paddle_voltage_fake.return_val = GetPaddleVoltage(50);
+    LetTimePass(state_machine, 1);
+    ASSERT_EQ(
+        50,
+        App_CanTx_GetPeriodicSignal_MAPPED_PADDLE_POSITION(can_tx_interface));
+    ASSERT_FALSE(App_CanTx_GetPeriodicSignal_REGEN_PADDLE_OUT_OF_RANGE(
+        can_tx_interface));
+}
+
+TEST_F(
+    DimStateMachineTest,
+    learnt_regen_paddle_calibration_is_saved_once_paddle_is_released)
+{
+    // Pressing the paddle past the default pressed end widens the calibration,
+    // which isn't saved while the paddle is pressed
+    get_paddle_voltage_fake.return_val =
+        REGEN_PADDLE_DEFAULT_PRESSED_VOLTAGE_MV + 100U;
+    LetTimePass(state_machine, 1000);
+    ASSERT_EQ(
+        100, App_CanTx_GetPeriodicSignal_RAW_PADDLE_POSITION(can_tx_interface));
+    ASSERT_EQ(0, save_regen_paddle_calibration_fake.call_count);
+
+    get_paddle_voltage_fake.return_val =
+        REGEN_PADDLE_DEFAULT_RELEASED_VOLTAGE_MV;
+    LetTimePass(state_machine, 1000);
+    ASSERT_EQ(1, save_regen_paddle_calibration_fake.call_count);
+    ASSERT_EQ(
+        REGEN_PADDLE_DEFAULT_RELEASED_VOLTAGE_MV,
+        save_regen_paddle_calibration_fake.arg0_val->released_voltage_mv);
+    ASSERT_EQ(
+        REGEN_PADDLE_DEFAULT_PRESSED_VOLTAGE_MV + 100U,
+        save_regen_paddle_calibration_fake.arg0_val->pressed_voltage_mv);
+
+    // The calibration is only saved again once it changes
+    LetTimePass(state_machine, 2000);
+    ASSERT_EQ(1, save_regen_paddle_calibration_fake.call_count);
+}
+
+TEST_F(DimStateMachineTest, regen_paddle_calibration_is_reset_over_can)
+{
+    get_paddle_voltage_fake.return_val =
+        REGEN_PADDLE_DEFAULT_PRESSED_VOLTAGE_MV + 100U;
+    LetTimePass(state_machine, 1000);
+    get_paddle_voltage_fake.return_val =
+        REGEN_PADDLE_DEFAULT_RELEASED_VOLTAGE_MV;
+    LetTimePass(state_machine, 1000);
+    ASSERT_EQ(1, save_regen_paddle_calibration_fake.call_count);
+
+    // The defaults overwrite the learnt calibration
+    App_CanRx_DEBUG_REGEN_PADDLE_CALIBRATION_SetSignal_RESET_CALIBRATION(
+        can_rx_interface, true);
+    LetTimePass(state_machine, 1000);
+    ASSERT_EQ(2, save_regen_paddle_calibration_fake.call_count);
+    ASSERT_EQ(
+        REGEN_PADDLE_DEFAULT_RELEASED_VOLTAGE_MV,
+        save_regen_paddle_calibration_fake.arg0_val->released_voltage_mv);
+    ASSERT_EQ(
+        REGEN_PADDLE_DEFAULT_PRESSED_VOLTAGE_MV,
+        save_regen_paddle_calibration_fake.arg0_val->pressed_voltage_mv);
+
+    // Each command resets the calibration once
+    ASSERT_FALSE(
+        App_CanRx_DEBUG_REGEN_PADDLE_CALIBRATION_GetSignal_RESET_CALIBRATION(
+            can_rx_interface));
+    LetTimePass(state_machine, 2000);
+    ASSERT_EQ(2, save_regen_paddle_calibration_fake.call_count);
+}
+
+TEST_F(
+    DimStateMachineTest,
+    cell_monitor_over_temperature_alert_blinks_over_errors_in_drive_state)
+{
+    App_SharedErrorTable_SetError(error_table, (enum ErrorId)(10), true);
+    App_CanRx_BMS_MAX_CELL_MONITOR_SetSignal_MAX_CELL_MONITOR_DIE_TEMPERATURE(
+        can_rx_interface, DASHBOARD_CELL_MONITOR_OVER_TEMPERATURE_DEGC + 1.0f);
+
+    // The alert is shown as "C" followed by the temperature, for the first
+    // half of each blink period
+    LetTimePass(state_machine, 10);
+    ASSERT_EQ(true, set_right_hex_digit_fake.arg0_val.enabled);
+    ASSERT_EQ(TEMPERATURE_PAGE_PREFIX, set_right_hex_digit_fake.arg0_val.value);
+    ASSERT_EQ(9, set_middle_hex_digit_fake.arg0_val.value);
+    ASSERT_EQ(1, set_left_hex_digit_fake.arg0_val.value);
+
+    LetTimePass(state_machine, DASHBOARD_BLINK_PERIOD_MS / 2);
+    ASSERT_EQ(false, set_left_hex_digit_fake.arg0_val.enabled);
+    ASSERT_EQ(false, set_middle_hex_digit_fake.arg0_val.enabled);
+    ASSERT_EQ(false, set_right_hex_digit_fake.arg0_val.enabled);
+
+    // The alert is held for a while after the temperature drops, after which
+    // the error is shown again
+    App_CanRx_BMS_MAX_CELL_MONITOR_SetSignal_MAX_CELL_MONITOR_DIE_TEMPERATURE(
+        can_rx_interface, 42.0f);
+    LetTimePass(state_machine, DASHBOARD_BLINK_PERIOD_MS / 2);
+    ASSERT_EQ(TEMPERATURE_PAGE_PREFIX, set_right_hex_digit_fake.arg0_val.value);
+
+    LetTimePass(state_machine, DASHBOARD_CELL_MONITOR_OVER_TEMPERATURE_HOLD_MS);
+    ASSERT_EQ(true, set_right_hex_digit_fake.arg0_val.enabled);
+    ASSERT_EQ(5, set_right_hex_digit_fake.arg0_val.value);
+    ASSERT_EQ(1, set_middle_hex_digit_fake.arg0_val.value);
+    ASSERT_EQ(0, set_left_hex_digit_fake.arg0_val.value);
+}
+
+TEST_F(
+    DimStateMachineTest,
+    seven_seg_displays_are_only_written_to_when_the_frame_changes)
+{
+    App_CanRx_BMS_STATE_OF_CHARGE_SetSignal_STATE_OF_CHARGE(
+        can_rx_interface, 80.0f);
+    LetTimePass(state_machine, 10);
+    ASSERT_EQ(1, display_value_callback_fake.call_count);
+
+    LetTimePass(state_machine, 1000);
+    ASSERT_EQ(1, display_value_callback_fake.call_count);
+
+    App_CanRx_BMS_STATE_OF_CHARGE_SetSignal_STATE_OF_CHARGE(
+        can_rx_interface, 81.0f);
+    LetTimePass(state_machine, 10);
+    ASSERT_EQ(2, display_value_callback_fake.call_count);
+}
+
 } // namespace StateMachineTest
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <stdbool.h>
+#include <stdint.h>
 
 struct AcceleratorPedals;
 
@@ -18,6 +19,8 @@ struct AcceleratorPedals;
  * the counter value of the primary encoder to 0
  * @param reset_secondary_encoder_counter A function that can be called to reset
  * the counter value of the secondary encoder to 0
+ * @param get_cycle_count A function that can be called to get the free-running
+ * CPU cycle count, used to benchmark the pedal maps
  * @param primary_encoder_fully_pressed_value The value of the primary encoder
  * counter calibrated to the pedal box corresponding to when the pedal is fully
  * pressed
@@ -34,6 +37,7 @@ struct AcceleratorPedals *App_AcceleratorPedals_Create(
     uint32_t (*get_secondary_encoder_counter_value)(void),
     void (*reset_primary_encoder_counter)(void),
     void (*reset_secondary_encoder_counter)(void),
+    uint32_t (*get_cycle_count)(void),
     uint32_t primary_encoder_fully_pressed_value,
     uint32_t secondary_encoder_fully_pressed_value);
 
@@ -64,6 +68,23 @@ bool App_AcceleratorPedals_IsPrimaryEncoderAlarmActive(
 bool App_AcceleratorPedals_IsSecondaryEncoderAlarmActive(
     const struct AcceleratorPedals *accelerator_pedals);
 
+/**
+ * Sample the encoder of each accelerator pedal once and map the pedal
+ * percentages that are returned until the next tick
+ * @param accelerator_pedals The pair of accelerator pedals to tick
+ */
+void App_AcceleratorPedals_Tick(struct AcceleratorPedals *accelerator_pedals);
+
+/**
+ * Get the maximum number of CPU cycles taken to map the pedal percentages in a
+ * tick since the last call, and reset the maximum
+ * @param accelerator_pedals The pair of accelerator pedals to get the maximum
+ * number of cycles for
+ * @return The maximum number of CPU cycles taken to map the pedal percentages
+ */
+uint32_t App_AcceleratorPedals_TakeMaxPedalMapCycles(
+    struct AcceleratorPedals *accelerator_pedals);
+
 /**
  * Get the pedal percentage of the primary accelerator pedal, a value in [0,
  * 100]
@@ -83,3 +104,37 @@ float App_AcceleratorPedals_GetPrimaryPedalPercentage(
  */
 float App_AcceleratorPedals_GetSecondaryPedalPercentage(
     const struct AcceleratorPedals *accelerator_pedals);
+
+/**
+ * Select the pedal curve that maps the primary pedal percentage to the mapped
+ * pedal percentage of the given pair of accelerator pedals. The mapped pedal
+ * percentage blends into the new pedal curve over PEDAL_CURVE_BLEND_TICKS
+ * ticks, and a different pedal curve can only be selected once it has.
+ * @param accelerator_pedals The pair of accelerator pedals to select the pedal
+ * curve for
+ * @param pedal_curve The index of the pedal curve in PEDAL_CURVES, which must
+ * be less than NUM_PEDAL_CURVES
+ */
+void App_AcceleratorPedals_SetPedalCurve(
+    struct AcceleratorPedals *accelerator_pedals,
+    uint32_t                  pedal_curve);
+
+/**
+ * Get the selected pedal curve of the given pair of accelerator pedals
+ * @param accelerator_pedals The pair of accelerator pedals to get the selected
+ * pedal curve of
+ * @return The index of the selected pedal curve in PEDAL_CURVES
+ */
+uint32_t App_AcceleratorPedals_GetPedalCurve(
+    const struct AcceleratorPedals *accelerator_pedals);
+
+/**
+ * Get the mapped pedal percentage of the given pair of accelerator pedals, a
+ * value in [0, 100]. This is the pedal percentage of the primary accelerator
+ * pedal mapped with the selected pedal curve, which is used to request torque.
+ * @param accelerator_pedals The pair of accelerator pedals to get the mapped
+ * pedal percentage from
+ * @return The mapped pedal percentage of the given pair of accelerator pedals
+ */
+float App_AcceleratorPedals_GetMappedPedalPercentage(
+    const struct AcceleratorPedals *accelerator_pedals);
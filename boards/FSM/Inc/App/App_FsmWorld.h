@@ -10,6 +10,8 @@
 #include "App_SharedSignal.h"
 #include "App_SharedClock.h"
 #include "App_AcceleratorPedals.h"
+#include "App_WheelDynamics.h"
+#include "App_SharedLatencyHistogram.h"
 
 struct FsmWorld;
 
@@ -35,6 +37,8 @@ struct FsmWorld *App_FsmWorld_Create(
     struct RgbLedSequence *   rgb_led_sequence,
     struct Clock *            clock,
     struct AcceleratorPedals *papps_and_sapps,
+    struct WheelDynamics *    wheel_dynamics,
+    struct LatencyHistogram * pedal_latency_histogram,
 
     bool (*has_apps_and_brake_plausibility_failure)(struct FsmWorld *),
     bool (*is_apps_and_brake_plausibility_ok)(struct FsmWorld *),
@@ -164,3 +168,21 @@ struct Clock *App_FsmWorld_GetClock(const struct FsmWorld *world);
  */
 struct AcceleratorPedals *
     App_FsmWorld_GetPappsAndSapps(const struct FsmWorld *world);
+
+/**
+ * Get the wheel dynamics for the given world
+ * @param world The world to get the wheel dynamics for
+ * @return The wheel dynamics for the given world
+ */
+struct WheelDynamics *
+    App_FsmWorld_GetWheelDynamics(const struct FsmWorld *world);
+
+/**
+ * Get the histogram of the latency from sampling the accelerator pedal
+ * encoders to adding the resulting CAN message to a CAN TX mailbox for the
+ * given world
+ * @param world The world to get the pedal latency histogram for
+ * @return The pedal latency histogram for the given world
+ */
+struct LatencyHistogram *
+    App_FsmWorld_GetPedalLatencyHistogram(const struct FsmWorld *world);
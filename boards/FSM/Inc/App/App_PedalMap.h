@@ -0,0 +1,91 @@
+#pragma once
+
+#include <stdint.h>
+
+// The mapped value of a fully pressed pedal. Mapped values are fixed-point
+// fractions of this full scale, so 50% is PEDAL_MAP_FULL_SCALE / 2.
+#define PEDAL_MAP_FULL_SCALE (1U << 16U)
+
+// The pedal travel at each end of the encoder range that is ignored, so the
+// pedal reads 0% when released and 100% when fully pressed despite small
+// offsets in the pedal box
+#define PEDAL_MAP_DEADZONE_PERCENT 3U
+
+// A pedal curve gives the mapped pedal percentage at evenly spaced points of
+// pedal travel, from 0% to 100% pedal travel
+#define PEDAL_MAP_NUM_CURVE_POINTS 11U
+
+// The pedal travel between the deadzones is split into at most this many
+// equally sized segments, and the pedal curve is tabulated at each end of
+// every segment. The segment size is a power of two encoder counts so that
+// looking up the table needs no division.
+#define PEDAL_MAP_MAX_SEGMENTS 32U
+
+struct PedalMap;
+
+/**
+ * Allocate and initialize a map from the encoder counter value of an
+ * accelerator pedal to a mapped pedal value. The pedal curve is tabulated
+ * here, and again whenever the calibration or pedal curve changes, so mapping
+ * a counter value is only a table look-up and an interpolation in integer
+ * math.
+ * @param encoder_fully_pressed_value The value of the encoder counter
+ *                                    calibrated to the pedal box corresponding
+ *                                    to when the pedal is fully pressed
+ * @param pedal_curve The mapped pedal percentage at each of the
+ *                    PEDAL_MAP_NUM_CURVE_POINTS points of pedal travel. It
+ *                    must start at 0%, end at 100% and never decrease.
+ * @return The created pedal map, whose ownership is given to the caller
+ */
+struct PedalMap *App_PedalMap_Create(
+    uint32_t      encoder_fully_pressed_value,
+    const uint8_t pedal_curve[PEDAL_MAP_NUM_CURVE_POINTS]);
+
+/**
+ * Deallocate the memory used by the given pedal map
+ * @param pedal_map The pedal map to deallocate
+ */
+void App_PedalMap_Destroy(struct PedalMap *pedal_map);
+
+/**
+ * Recalibrate the given pedal map and tabulate its pedal curve again
+ * @param pedal_map The pedal map to recalibrate
+ * @param encoder_fully_pressed_value The value of the encoder counter
+ *                                    corresponding to when the pedal is fully
+ *                                    pressed
+ */
+void App_PedalMap_SetEncoderFullyPressedValue(
+    struct PedalMap *pedal_map,
+    uint32_t         encoder_fully_pressed_value);
+
+/**
+ * Change the pedal curve of the given pedal map and tabulate it
+ * @param pedal_map The pedal map to change the pedal curve of
+ * @param pedal_curve The mapped pedal percentage at each of the
+ *                    PEDAL_MAP_NUM_CURVE_POINTS points of pedal travel. It
+ *                    must start at 0%, end at 100% and never decrease.
+ */
+void App_PedalMap_SetPedalCurve(
+    struct PedalMap *pedal_map,
+    const uint8_t    pedal_curve[PEDAL_MAP_NUM_CURVE_POINTS]);
+
+/**
+ * Get the value of the encoder counter corresponding to when the pedal is
+ * fully pressed for the given pedal map
+ * @param pedal_map The pedal map to get the fully pressed value of
+ * @return The value of the encoder counter when the pedal is fully pressed
+ */
+uint32_t
+    App_PedalMap_GetEncoderFullyPressedValue(const struct PedalMap *pedal_map);
+
+/**
+ * Map an encoder counter value with the given pedal map
+ * @param pedal_map The pedal map to map the encoder counter value with
+ * @param encoder_counter_value The current counter value of the encoder. A
+ *                              value above the fully pressed value is an
+ *                              underflow of the encoder counter, and maps to 0.
+ * @return The mapped pedal value, in [0, PEDAL_MAP_FULL_SCALE]
+ */
+uint32_t App_PedalMap_MapEncoderCounterValue(
+    const struct PedalMap *pedal_map,
+    uint32_t               encoder_counter_value);
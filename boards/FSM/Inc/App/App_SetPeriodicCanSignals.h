@@ -10,3 +10,6 @@ void App_SetPeriodicSignals_SteeringAngleInRangeCheck(
 void App_SetPeriodicSignals_Brake(const struct FsmWorld *world);
 void App_SetPeriodicSignals_AcceleratorPedal(const struct FsmWorld *world);
 void App_SetPeriodicSignals_MotorShutdownFaults(const struct FsmWorld *world);
+void App_SetPeriodicSignals_WheelDynamics(const struct FsmWorld *world);
+void App_SetPeriodicSignals_PedalLatency(const struct FsmWorld *world);
+void App_SetPeriodicSignals_PedalMapBenchmark(const struct FsmWorld *world);
@@ -0,0 +1,46 @@
+#pragma once
+
+struct WheelDynamics;
+
+/**
+ * Allocate and initialize the wheel dynamics of the front wheels
+ * @param get_left_wheel_speed_kph A function that returns the left wheel speed
+ *                                 in km/h
+ * @param get_right_wheel_speed_kph A function that returns the right wheel
+ *                                  speed in km/h
+ * @param get_left_wheel_acceleration_mps2 A function that returns the left
+ *                                         wheel acceleration in m/s^2
+ * @param get_right_wheel_acceleration_mps2 A function that returns the right
+ *                                          wheel acceleration in m/s^2
+ * @return The created wheel dynamics, whose ownership is given to the caller
+ */
+struct WheelDynamics *App_WheelDynamics_Create(
+    float (*get_left_wheel_speed_kph)(void),
+    float (*get_right_wheel_speed_kph)(void),
+    float (*get_left_wheel_acceleration_mps2)(void),
+    float (*get_right_wheel_acceleration_mps2)(void));
+
+/**
+ * Deallocate the memory used by the given wheel dynamics
+ * @param wheel_dynamics The wheel dynamics to deallocate
+ */
+void App_WheelDynamics_Destroy(struct WheelDynamics *wheel_dynamics);
+
+/**
+ * Get the wheel acceleration of the given wheel dynamics. The front wheels
+ * aren't driven, so their average acceleration follows the acceleration of
+ * the car.
+ * @param wheel_dynamics The wheel dynamics to get the acceleration of
+ * @return The average acceleration of the front wheels, in m/s^2
+ */
+float App_WheelDynamics_GetAccelerationMps2(
+    const struct WheelDynamics *wheel_dynamics);
+
+/**
+ * Get the difference between the left and right wheel speeds of the given
+ * wheel dynamics, which grows when cornering or when a wheel slips or locks
+ * @param wheel_dynamics The wheel dynamics to get the speed difference of
+ * @return The left wheel speed minus the right wheel speed, in km/h
+ */
+float App_WheelDynamics_GetSpeedDifferenceKph(
+    const struct WheelDynamics *wheel_dynamics);
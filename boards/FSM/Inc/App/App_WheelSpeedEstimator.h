@@ -0,0 +1,85 @@
+#pragma once
+
+#include <stdint.h>
+
+// The number of most recent reluctor ring edges that are kept for estimation.
+// This must exceed the most edges in a counting window at top speed.
+#define WHEEL_SPEED_ESTIMATOR_MAX_EDGES 32U
+
+// The window over which edges are counted at high speed
+#define WHEEL_SPEED_ESTIMATOR_COUNTING_WINDOW_MS 10U
+
+// The fewest edge intervals in the counting window for the wheel speed to be
+// estimated by counting edges. With fewer intervals, the wheel speed is
+// estimated from the period between the two most recent edges instead.
+#define WHEEL_SPEED_ESTIMATOR_MIN_COUNTED_INTERVALS 4U
+
+// The time without any edge after which the wheel is stationary. This must be
+// shorter than one timer period.
+#define WHEEL_SPEED_ESTIMATOR_TIMEOUT_MS 500U
+
+// The window over which the wheel acceleration is differentiated. A longer
+// window trades latency for less noise from the quantized wheel speed.
+#define WHEEL_SPEED_ESTIMATOR_ACCELERATION_WINDOW_MS 25U
+
+struct WheelSpeedEstimator;
+
+/**
+ * Allocate and initialize a wheel speed estimator for a wheel speed sensor
+ * whose reluctor ring edges are captured by a timer. At low speed, few edges
+ * arrive per update, so the speed is measured from the period between the two
+ * most recent edges. At high speed, single periods are only a few timer ticks
+ * long, so the speed is measured by counting the edges in a fixed window,
+ * timed from the first to the last edge in the window.
+ * @param timer_frequency_hz The frequency of the timer capturing the edges
+ * @param timer_period_ticks The number of ticks before the timer counter wraps
+ *                           around (i.e. The auto-reload register + 1)
+ * @param distance_per_edge_m The distance travelled by the wheel between two
+ *                            edges, in m
+ * @return The created wheel speed estimator, whose ownership is given to the
+ *         caller
+ */
+struct WheelSpeedEstimator *App_WheelSpeedEstimator_Create(
+    float    timer_frequency_hz,
+    uint32_t timer_period_ticks,
+    float    distance_per_edge_m);
+
+/**
+ * Deallocate the memory used by the given wheel speed estimator
+ * @param wheel_speed_estimator The wheel speed estimator to deallocate
+ */
+void App_WheelSpeedEstimator_Destroy(
+    struct WheelSpeedEstimator *wheel_speed_estimator);
+
+/**
+ * Update the given wheel speed estimator with the edges captured since the
+ * last update
+ * @note This function should be called at 1kHz
+ * @param wheel_speed_estimator The wheel speed estimator to update
+ * @param captures The counter values captured since the last update, oldest
+ *                 first
+ * @param num_captures The number of counter values in captures
+ * @param current_time_ms The current time, in ms
+ */
+void App_WheelSpeedEstimator_Update(
+    struct WheelSpeedEstimator *wheel_speed_estimator,
+    const uint32_t *            captures,
+    uint32_t                    num_captures,
+    uint32_t                    current_time_ms);
+
+/**
+ * Get the wheel speed of the given wheel speed estimator
+ * @param wheel_speed_estimator The wheel speed estimator to get the speed of
+ * @return The wheel speed as of the last update, in km/h
+ */
+float App_WheelSpeedEstimator_GetSpeedKph(
+    const struct WheelSpeedEstimator *wheel_speed_estimator);
+
+/**
+ * Get the wheel acceleration of the given wheel speed estimator
+ * @param wheel_speed_estimator The wheel speed estimator to get the
+ *                              acceleration of
+ * @return The wheel acceleration as of the last update, in m/s^2
+ */
+float App_WheelSpeedEstimator_GetAccelerationMps2(
+    const struct WheelSpeedEstimator *wheel_speed_estimator);
@@ -0,0 +1,38 @@
+#pragma once
+
+// clang-format off
+
+// Each pedal curve is the mapped pedal percentage at 0%, 10%, ..., 100% pedal
+// travel
+#define LINEAR_PEDAL_CURVE      { 0, 10, 20, 30, 40, 50, 60, 70, 80, 90, 100 }
+
+// (Pedal travel)^1.5
+#define PROGRESSIVE_PEDAL_CURVE { 0,  3,  9, 16, 25, 35, 46, 59, 72, 85, 100 }
+
+// (Pedal travel)^2, for fine control at low torque
+#define QUADRATIC_PEDAL_CURVE   { 0,  1,  4,  9, 16, 25, 36, 49, 64, 81, 100 }
+
+// (Pedal travel)^0.7
+#define AGGRESSIVE_PEDAL_CURVE  { 0, 20, 32, 43, 53, 62, 70, 78, 86, 93, 100 }
+
+// Gentle at both ends of the pedal travel
+#define S_PEDAL_CURVE           { 0,  3, 10, 22, 35, 50, 65, 78, 90, 97, 100 }
+
+// The pedal curve for each drive mode, in the order of the DIM drive mode
+// switch positions (DRIVE_MODE_1, ..., DRIVE_MODE_5)
+#define NUM_PEDAL_CURVES 5U
+#define PEDAL_CURVES             \
+{                                \
+    LINEAR_PEDAL_CURVE,          \
+    PROGRESSIVE_PEDAL_CURVE,     \
+    QUADRATIC_PEDAL_CURVE,       \
+    AGGRESSIVE_PEDAL_CURVE,      \
+    S_PEDAL_CURVE,               \
+}
+
+// The number of 1kHz ticks over which the mapped pedal percentage blends from
+// the previous pedal curve into a newly selected one, so that switching drive
+// mode while the pedal is pressed does not step the torque request
+#define PEDAL_CURVE_BLEND_TICKS 500U
+
+// clang-format on
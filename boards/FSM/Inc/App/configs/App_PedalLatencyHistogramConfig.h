@@ -0,0 +1,7 @@
+#pragma once
+
+// The latency from sampling the accelerator pedal encoders to adding the
+// resulting FSM_PEDAL_POSITION message to a CAN TX mailbox is counted in bins
+// of [0, 250us), [250us, 500us), ..., [1750us, infinity)
+#define PEDAL_LATENCY_HISTOGRAM_BIN_WIDTH_US 250U
+#define PEDAL_LATENCY_HISTOGRAM_NUM_BINS 8U
@@ -4,42 +4,24 @@
 
 /**
  * Initializes the primary and secondary flow meter
+ * @note The rising edges of both flow meters are transferred into circular
+ *       buffers using DMA, so they don't interrupt the CPU
  * @param htim : The timer handle for both flow meters
  */
 void Io_FlowMeters_Init(TIM_HandleTypeDef *htim);
 
 /**
- * Get flow rate (L/min) from the primary flow meter
+ * Get flow rate (L/min) from the primary flow meter. This processes every
+ * rising edge captured since the last call, so it should be called
+ * periodically. If the flow meter is inactive (i.e. It has been unplugged or
+ * unpowered), the flow rate is 0L/min.
  */
 float Io_FlowMeters_GetPrimaryFlowRate(void);
 
 /**
- * Get flow rate (L/min) from the secondary flow meter
+ * Get flow rate (L/min) from the secondary flow meter. This processes every
+ * rising edge captured since the last call, so it should be called
+ * periodically. If the flow meter is inactive (i.e. It has been unplugged or
+ * unpowered), the flow rate is 0L/min.
  */
 float Io_FlowMeters_GetSecondaryFlowRate(void);
-
-/**
- * Update the frequency for the primary and secondary flow meter's PWM outputs.
- * @note This function should be called in the input capture callback function.
- * @param htim: The handle of the timer that triggered the input capture
- *              callback function
- */
-void Io_FlowMeters_InputCaptureCallback(TIM_HandleTypeDef *htim);
-
-/**
- * Check if the PWM signal of the primary flow meter is active. If it is
- * inactive (i.e. It has been unplugged or unpowered), set the frequency to NaN.
- *
- * @note This function should be called in the timer overflow interrupt
- *       for the PWM signal of the primary flow meter.
- */
-void Io_FlowMeters_CheckIfPrimaryIsActive(void);
-
-/**
- * Check if the PWM signal of the secondary flow meter is active. If it is
- * inactive (i.e. It has been unplugged or unpowered), set the frequency to NaN.
- *
- * @note This function should be called in the timer overflow interrupt
- *       for the PWM signal of the primary flow meter.
- */
-void Io_FlowMeters_CheckIfSecondaryIsActive(void);
@@ -0,0 +1,22 @@
+#pragma once
+
+struct LatencyHistogram;
+
+/**
+ * Start measuring the latency from sampling the accelerator pedal encoders to
+ * adding the resulting FSM_PEDAL_POSITION message to a CAN TX mailbox. The
+ * latency is timed with the cycle counter of the CPU, so it has sub-us
+ * resolution.
+ * @note This registers the CAN TX message callbacks of the shared CAN library,
+ *       and the shared cycle counter must be started before this is called
+ * @param latency_histogram The histogram to record every measured latency in
+ */
+void Io_PedalLatency_Init(struct LatencyHistogram *latency_histogram);
+
+/**
+ * Mark the time at which the accelerator pedal encoders are sampled. The next
+ * FSM_PEDAL_POSITION message to be enqueued carries this sample.
+ * @note This function should be called right before the accelerator pedal
+ *       encoders are read
+ */
+void Io_PedalLatency_MarkEncoderSample(void);
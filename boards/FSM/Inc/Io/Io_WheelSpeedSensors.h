@@ -4,6 +4,8 @@
 
 /**
  * Initialize the left and right wheel speed sensors
+ * @note The rising edges of both wheel speed sensors are transferred into
+ *       circular buffers using DMA, so they don't interrupt the CPU
  * @param htim_left_wheel_speed Timer handle for the left wheel speed
  * @param htim_right_wheel_speed Timer handle for the right wheel speed
  */
@@ -12,41 +14,38 @@ void Io_WheelSpeedSensors_Init(
     TIM_HandleTypeDef *htim_right_wheel_speed);
 
 /**
- * Get the wheel speed in km/h from the left wheel speed sensor
- * @return The wheel speed in km/h
+ * Update the wheel speed and acceleration of the left and right wheel speed
+ * sensors with every rising edge captured since the last update
+ * @note This function should be called at 1kHz
  */
-float Io_WheelSpeedSensors_GetLeftSpeedKph(void);
+void Io_WheelSpeedSensors_Update(void);
 
 /**
- * Get the wheel speed in km/h from the right wheel speed sensor
+ * Get the wheel speed in km/h from the left wheel speed sensor, as of the last
+ * update. If the sensor is inactive (i.e. It has been unplugged or unpowered),
+ * the wheel speed is 0km/h.
  * @return The wheel speed in km/h
  */
-float Io_WheelSpeedSensors_GetRightSpeedKph(void);
+float Io_WheelSpeedSensors_GetLeftSpeedKph(void);
 
 /**
- * Update the frequency for the left and right wheel speed sensors.
- * @note This function should be called in the input capture callback function.
- * @param htim The handle of the timer that triggered the input capture callback
- * function
+ * Get the wheel speed in km/h from the right wheel speed sensor, as of the
+ * last update. If the sensor is inactive (i.e. It has been unplugged or
+ * unpowered), the wheel speed is 0km/h.
+ * @return The wheel speed in km/h
  */
-void Io_WheelSpeedSensors_InputCaptureCallback(TIM_HandleTypeDef *htim);
+float Io_WheelSpeedSensors_GetRightSpeedKph(void);
 
 /**
- * Check if the PWM signal of the left wheel speed sensor is active. If
- * it is inactive (i.e. It has been unplugged or unpowered), set the frequency
- * to NaN.
- *
- * @note This function should be called in the timer overflow interrupt
- *       for the PWM signal of the left wheel speed sensor.
+ * Get the wheel acceleration in m/s^2 from the left wheel speed sensor, as of
+ * the last update
+ * @return The wheel acceleration in m/s^2
  */
-void Io_WheelSpeedSensors_CheckIfLeftSensorIsActive(void);
+float Io_WheelSpeedSensors_GetLeftAccelerationMps2(void);
 
 /**
- * Check if the PWM signal of the right wheel speed sensor is active. If
- * it is inactive (i.e. It has been unplugged or unpowered), set the frequency
- * to NaN.
- *
- * @note This function should be called in the timer overflow interrupt
- *       for the PWM signal of the right wheel speed sensor.
+ * Get the wheel acceleration in m/s^2 from the right wheel speed sensor, as of
+ * the last update
+ * @return The wheel acceleration in m/s^2
  */
-void Io_WheelSpeedSensors_CheckIfRightSensorIsActive(void);
+float Io_WheelSpeedSensors_GetRightAccelerationMps2(void);
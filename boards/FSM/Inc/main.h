@@ -86,7 +86,7 @@ extern "C"
 #define TIM17_PRESCALER \
     (TIMx_FREQUENCY / TIM17_AUTO_RELOAD_REG / TIM17_PWM_MINIMUM_FREQUENCY)
 #define TIM3_PRESCALER 72
-#define ADC_FREQUENCY 1000
+#define ADC_FREQUENCY 8000
 #define TIM1_AUTO_RELOAD_REG 3599
 #define TIM2_AUTO_RELOAD_REG 1799
 #define SECONDARY_APPS_A_Pin GPIO_PIN_0
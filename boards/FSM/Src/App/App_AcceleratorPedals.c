@@ -2,6 +2,8 @@
 #include <stdlib.h>
 #include <stdint.h>
 #include "App_AcceleratorPedals.h"
+#include "App_PedalMap.h"
+#include "configs/App_PedalCurves.h"
 
 struct AcceleratorPedals
 {
@@ -11,68 +13,82 @@ struct AcceleratorPedals
     uint32_t (*get_secondary_encoder_counter_value)(void);
     void (*reset_primary_encoder_counter)(void);
     void (*reset_secondary_encoder_counter)(void);
+    uint32_t (*get_cycle_count)(void);
 
-    uint32_t primary_encoder_fully_pressed_value;
-    uint32_t secondary_encoder_fully_pressed_value;
+    // The pedal travel of each pedal, mapped linearly
+    struct PedalMap *primary_pedal_map;
+    struct PedalMap *secondary_pedal_map;
+
+    // The primary pedal travel, mapped with the selected pedal curve and with
+    // the pedal curve that was selected before it
+    struct PedalMap *curved_pedal_map;
+    struct PedalMap *previous_curved_pedal_map;
+    uint32_t         pedal_curve;
+
+    // The number of ticks left until the mapped pedal percentage has blended
+    // from the previous pedal curve into the selected pedal curve
+    uint32_t blend_ticks_remaining;
+
+    // The pedal percentages mapped from the encoder counter values sampled on
+    // the last tick
+    float primary_pedal_percentage;
+    float secondary_pedal_percentage;
+    float mapped_pedal_percentage;
+
+    uint32_t max_pedal_map_cycles;
 };
 
+static const uint8_t linear_pedal_curve[PEDAL_MAP_NUM_CURVE_POINTS] =
+    LINEAR_PEDAL_CURVE;
+static const uint8_t pedal_curves[NUM_PEDAL_CURVES]
+                                 [PEDAL_MAP_NUM_CURVE_POINTS] = PEDAL_CURVES;
+
+/**
+ * Convert a mapped pedal value to a pedal percentage
+ * @param mapped_value The mapped pedal value, in [0, PEDAL_MAP_FULL_SCALE]
+ * @return The pedal percentage, a value in [0, 100]
+ */
+static float App_GetPedalPercentage(uint32_t mapped_value);
+
 /**
- * Get the pedal percentage, a value in [0, 100]
- * @param encoder_fully_pressed_value The value of the encoder counter when the
- * given accelerator pedal is fully pressed
- * @param encoder_counter_value The current counter value of the encoder for the
- * given accelerator pedal
- * @param reset_encoder_counter A function that can be called to reset the
- * counter value of the encoder for the given accelerator pedal to 0
- * @return The pedal percentage of the given accelerator pedal
+ * Map the primary encoder counter value with the selected pedal curve, blended
+ * with the previous pedal curve while the pedal curve is changing
+ * @param accelerator_pedals The pair of accelerator pedals to map the primary
+ * encoder counter value for
+ * @param encoder_counter_value The counter value of the primary encoder
+ * @return The mapped pedal value, in [0, PEDAL_MAP_FULL_SCALE]
  */
-static float App_GetPedalPercentage(
-    uint32_t encoder_fully_pressed_value,
-    uint32_t encoder_counter_value,
-    void (*reset_encoder_counter)(void));
-
-static float App_GetPedalPercentage(
-    uint32_t encoder_fully_pressed_value,
-    uint32_t encoder_counter_value,
-    void (*reset_encoder_counter)(void))
+static uint32_t App_MapCurvedPedalValue(
+    const struct AcceleratorPedals *accelerator_pedals,
+    uint32_t                        encoder_counter_value);
+
+static float App_GetPedalPercentage(const uint32_t mapped_value)
 {
-    const float percent_deflection = 0.03f;
-    const float low_end_deadzone_threshold =
-        (float)encoder_fully_pressed_value * percent_deflection;
+    return (float)mapped_value * (100.0f / (float)PEDAL_MAP_FULL_SCALE);
+}
 
-    // TODO: Determine the high end deadzone threshold #666
-    // Currently setting the high end deadzone threshold to be 3% less than
-    // the maximum encoder value when the pedal is completely pressed
-    const float high_end_deadzone_threshold =
-        (float)encoder_fully_pressed_value * (1.0f - percent_deflection);
+static uint32_t App_MapCurvedPedalValue(
+    const struct AcceleratorPedals *const accelerator_pedals,
+    const uint32_t                        encoder_counter_value)
+{
+    const uint32_t value = App_PedalMap_MapEncoderCounterValue(
+        accelerator_pedals->curved_pedal_map, encoder_counter_value);
 
-    if (encoder_counter_value > encoder_fully_pressed_value)
-    {
-        // If the accelerator pedal underflows, reset the corresponding
-        // encoder's counter register and set the pedal percentage to 0.0%
-        reset_encoder_counter();
-        return 0.0f;
-    }
-    else if (encoder_counter_value <= low_end_deadzone_threshold)
+    if (accelerator_pedals->blend_ticks_remaining == 0U)
     {
-        // Set the pedal percentage to 0.0% when the pedal is within the
-        // low end deadzone
-        return 0.0f;
-    }
-    else if (
-        encoder_counter_value <= encoder_fully_pressed_value &&
-        encoder_counter_value >= high_end_deadzone_threshold)
-    {
-        // Set the mapped pedal percentage to 100% when the pedal is within the
-        // high end deadzone
-        return 100.0f;
+        return value;
     }
 
-    // Pedal % = 100% * (encoder value - low end deadzone threshold) /
-    // (high end deadzone threshold - low end deadzone threshold)
-    return 100.0f *
-           ((float)encoder_counter_value - low_end_deadzone_threshold) /
-           (high_end_deadzone_threshold - low_end_deadzone_threshold);
+    // Both pedal curves map the same pedal travel, so the blend is 0% when the
+    // pedal is released and 100% when it is fully pressed
+    const uint32_t previous_value = App_PedalMap_MapEncoderCounterValue(
+        accelerator_pedals->previous_curved_pedal_map, encoder_counter_value);
+    const uint32_t remaining = accelerator_pedals->blend_ticks_remaining;
+
+    return (uint32_t)(
+        ((uint64_t)value * (PEDAL_CURVE_BLEND_TICKS - remaining) +
+         (uint64_t)previous_value * remaining) /
+        PEDAL_CURVE_BLEND_TICKS);
 }
 
 struct AcceleratorPedals *App_AcceleratorPedals_Create(
@@ -82,6 +98,7 @@ struct AcceleratorPedals *App_AcceleratorPedals_Create(
     uint32_t (*get_secondary_encoder_counter_value)(void),
     void (*reset_primary_encoder_counter)(void),
     void (*reset_secondary_encoder_counter)(void),
+    uint32_t (*get_cycle_count)(void),
     uint32_t primary_encoder_fully_pressed_value,
     uint32_t secondary_encoder_fully_pressed_value)
 {
@@ -101,17 +118,33 @@ struct AcceleratorPedals *App_AcceleratorPedals_Create(
         reset_primary_encoder_counter;
     accelerator_pedals->reset_secondary_encoder_counter =
         reset_secondary_encoder_counter;
+    accelerator_pedals->get_cycle_count = get_cycle_count;
+
+    accelerator_pedals->primary_pedal_map = App_PedalMap_Create(
+        primary_encoder_fully_pressed_value, linear_pedal_curve);
+    accelerator_pedals->secondary_pedal_map = App_PedalMap_Create(
+        secondary_encoder_fully_pressed_value, linear_pedal_curve);
+    accelerator_pedals->curved_pedal_map = App_PedalMap_Create(
+        primary_encoder_fully_pressed_value, pedal_curves[0]);
+    accelerator_pedals->previous_curved_pedal_map = App_PedalMap_Create(
+        primary_encoder_fully_pressed_value, pedal_curves[0]);
+    accelerator_pedals->pedal_curve           = 0U;
+    accelerator_pedals->blend_ticks_remaining = 0U;
 
-    accelerator_pedals->primary_encoder_fully_pressed_value =
-        primary_encoder_fully_pressed_value;
-    accelerator_pedals->secondary_encoder_fully_pressed_value =
-        secondary_encoder_fully_pressed_value;
+    accelerator_pedals->primary_pedal_percentage   = 0.0f;
+    accelerator_pedals->secondary_pedal_percentage = 0.0f;
+    accelerator_pedals->mapped_pedal_percentage    = 0.0f;
+    accelerator_pedals->max_pedal_map_cycles       = 0U;
 
     return accelerator_pedals;
 }
 
 void App_AcceleratorPedals_Destroy(struct AcceleratorPedals *accelerator_pedals)
 {
+    App_PedalMap_Destroy(accelerator_pedals->primary_pedal_map);
+    App_PedalMap_Destroy(accelerator_pedals->secondary_pedal_map);
+    App_PedalMap_Destroy(accelerator_pedals->curved_pedal_map);
+    App_PedalMap_Destroy(accelerator_pedals->previous_curved_pedal_map);
     free(accelerator_pedals);
 }
 
@@ -127,20 +160,120 @@ bool App_AcceleratorPedals_IsSecondaryEncoderAlarmActive(
     return accelerator_pedals->is_secondary_encoder_alarm_active();
 }
 
+void App_AcceleratorPedals_Tick(
+    struct AcceleratorPedals *const accelerator_pedals)
+{
+    // Sample each encoder once, so every pedal percentage of this tick is
+    // mapped from the same pedal travel
+    const uint32_t primary_encoder_counter_value =
+        accelerator_pedals->get_primary_encoder_counter_value();
+    const uint32_t secondary_encoder_counter_value =
+        accelerator_pedals->get_secondary_encoder_counter_value();
+
+    // If an accelerator pedal underflows, reset the corresponding encoder's
+    // counter register. The pedal map maps the underflow to 0%.
+    if (primary_encoder_counter_value >
+        App_PedalMap_GetEncoderFullyPressedValue(
+            accelerator_pedals->primary_pedal_map))
+    {
+        accelerator_pedals->reset_primary_encoder_counter();
+    }
+    if (secondary_encoder_counter_value >
+        App_PedalMap_GetEncoderFullyPressedValue(
+            accelerator_pedals->secondary_pedal_map))
+    {
+        accelerator_pedals->reset_secondary_encoder_counter();
+    }
+
+    if (accelerator_pedals->blend_ticks_remaining > 0U)
+    {
+        accelerator_pedals->blend_ticks_remaining--;
+    }
+
+    // TODO: Determine the high end deadzone threshold #666
+    // The pedal map currently sets the high end deadzone threshold to be 3%
+    // less than the maximum encoder value when the pedal is completely pressed
+    const uint32_t start_cycles  = accelerator_pedals->get_cycle_count();
+    const uint32_t primary_value = App_PedalMap_MapEncoderCounterValue(
+        accelerator_pedals->primary_pedal_map, primary_encoder_counter_value);
+    const uint32_t secondary_value = App_PedalMap_MapEncoderCounterValue(
+        accelerator_pedals->secondary_pedal_map,
+        secondary_encoder_counter_value);
+    const uint32_t mapped_value = App_MapCurvedPedalValue(
+        accelerator_pedals, primary_encoder_counter_value);
+    const uint32_t elapsed_cycles =
+        accelerator_pedals->get_cycle_count() - start_cycles;
+
+    if (elapsed_cycles > accelerator_pedals->max_pedal_map_cycles)
+    {
+        accelerator_pedals->max_pedal_map_cycles = elapsed_cycles;
+    }
+
+    accelerator_pedals->primary_pedal_percentage =
+        App_GetPedalPercentage(primary_value);
+    accelerator_pedals->secondary_pedal_percentage =
+        App_GetPedalPercentage(secondary_value);
+    accelerator_pedals->mapped_pedal_percentage =
+        App_GetPedalPercentage(mapped_value);
+}
+
+uint32_t App_AcceleratorPedals_TakeMaxPedalMapCycles(
+    struct AcceleratorPedals *const accelerator_pedals)
+{
+    const uint32_t max_pedal_map_cycles =
+        accelerator_pedals->max_pedal_map_cycles;
+    accelerator_pedals->max_pedal_map_cycles = 0U;
+
+    return max_pedal_map_cycles;
+}
+
 float App_AcceleratorPedals_GetPrimaryPedalPercentage(
     const struct AcceleratorPedals *const accelerator_pedals)
 {
-    return App_GetPedalPercentage(
-        accelerator_pedals->primary_encoder_fully_pressed_value,
-        accelerator_pedals->get_primary_encoder_counter_value(),
-        accelerator_pedals->reset_primary_encoder_counter);
+    return accelerator_pedals->primary_pedal_percentage;
 }
 
 float App_AcceleratorPedals_GetSecondaryPedalPercentage(
     const struct AcceleratorPedals *const accelerator_pedals)
 {
-    return App_GetPedalPercentage(
-        accelerator_pedals->secondary_encoder_fully_pressed_value,
-        accelerator_pedals->get_secondary_encoder_counter_value(),
-        accelerator_pedals->reset_secondary_encoder_counter);
+    return accelerator_pedals->secondary_pedal_percentage;
+}
+
+void App_AcceleratorPedals_SetPedalCurve(
+    struct AcceleratorPedals *const accelerator_pedals,
+    const uint32_t                  pedal_curve)
+{
+    assert(pedal_curve < NUM_PEDAL_CURVES);
+
+    // Only tabulate the pedal curve when it changes, and let the mapped pedal
+    // percentage finish blending into the last pedal curve first so that it
+    // never steps
+    if (pedal_curve != accelerator_pedals->pedal_curve &&
+        accelerator_pedals->blend_ticks_remaining == 0U)
+    {
+        struct PedalMap *const previous_curved_pedal_map =
+            accelerator_pedals->curved_pedal_map;
+
+        accelerator_pedals->curved_pedal_map =
+            accelerator_pedals->previous_curved_pedal_map;
+        accelerator_pedals->previous_curved_pedal_map =
+            previous_curved_pedal_map;
+
+        App_PedalMap_SetPedalCurve(
+            accelerator_pedals->curved_pedal_map, pedal_curves[pedal_curve]);
+        accelerator_pedals->pedal_curve           = pedal_curve;
+        accelerator_pedals->blend_ticks_remaining = PEDAL_CURVE_BLEND_TICKS;
+    }
+}
+
+uint32_t App_AcceleratorPedals_GetPedalCurve(
+    const struct AcceleratorPedals *const accelerator_pedals)
+{
+    return accelerator_pedals->pedal_curve;
+}
+
+float App_AcceleratorPedals_GetMappedPedalPercentage(
+    const struct AcceleratorPedals *const accelerator_pedals)
+{
+    return accelerator_pedals->mapped_pedal_percentage;
 }
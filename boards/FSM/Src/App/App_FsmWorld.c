@@ -27,6 +27,8 @@ struct FsmWorld
     struct SignalNode *       signals_head;
     struct Clock *            clock;
     struct AcceleratorPedals *papps_and_sapps;
+    struct WheelDynamics *    wheel_dynamics;
+    struct LatencyHistogram * pedal_latency_histogram;
 };
 
 /**
@@ -57,6 +59,8 @@ struct FsmWorld *App_FsmWorld_Create(
     struct RgbLedSequence *const    rgb_led_sequence,
     struct Clock *const             clock,
     struct AcceleratorPedals *const papps_and_sapps,
+    struct WheelDynamics *const     wheel_dynamics,
+    struct LatencyHistogram *const  pedal_latency_histogram,
 
     bool (*const has_apps_and_brake_plausibility_failure)(struct FsmWorld *),
     bool (*const is_apps_and_brake_plausibility_ok)(struct FsmWorld *),
@@ -96,6 +100,8 @@ struct FsmWorld *App_FsmWorld_Create(
     world->signals_head                     = NULL;
     world->clock                            = clock;
     world->papps_and_sapps                  = papps_and_sapps;
+    world->wheel_dynamics                   = wheel_dynamics;
+    world->pedal_latency_histogram          = pedal_latency_histogram;
 
     struct SignalCallback papps_callback = {
         .entry_condition_high_duration_ms = PAPPS_ENTRY_HIGH_MS,
@@ -260,3 +266,15 @@ struct Clock *App_FsmWorld_GetClock(const struct FsmWorld *const world)
 {
     return world->clock;
 }
+
+struct WheelDynamics *
+    App_FsmWorld_GetWheelDynamics(const struct FsmWorld *const world)
+{
+    return world->wheel_dynamics;
+}
+
+struct LatencyHistogram *
+    App_FsmWorld_GetPedalLatencyHistogram(const struct FsmWorld *const world)
+{
+    return world->pedal_latency_histogram;
+}
@@ -0,0 +1,200 @@
+#include <assert.h>
+#include <stdlib.h>
+
+#include "App_PedalMap.h"
+
+// Encoder counter values are compared against the deadzone thresholds in
+// hundredths of a count, so the thresholds are exact for any fully pressed
+// value
+#define POSITION_SCALE 100U
+
+// The tabulated pedal curve keeps this many more fractional bits than mapped
+// values, so interpolating a linear pedal curve rounds to the exact result
+#define TABLE_FRACTION_BITS 8U
+#define TABLE_FULL_SCALE ((uint64_t)PEDAL_MAP_FULL_SCALE << TABLE_FRACTION_BITS)
+
+struct PedalMap
+{
+    uint32_t encoder_fully_pressed_value;
+    uint8_t  pedal_curve[PEDAL_MAP_NUM_CURVE_POINTS];
+
+    // The deadzone thresholds, in hundredths of an encoder count
+    uint32_t low_end_deadzone_threshold;
+    uint32_t high_end_deadzone_threshold;
+
+    // The pedal curve tabulated at the ends of each segment of pedal travel,
+    // in (PEDAL_MAP_FULL_SCALE << TABLE_FRACTION_BITS) full scale
+    uint32_t segment_size_shift;
+    uint32_t table[PEDAL_MAP_MAX_SEGMENTS + 1U];
+};
+
+/**
+ * Evaluate the given pedal curve, interpolating between its points
+ * @param pedal_curve The pedal curve to evaluate
+ * @param travel The pedal travel to evaluate the pedal curve at, which may be
+ *               past full_travel
+ * @param full_travel The pedal travel between the deadzones
+ * @return The pedal curve at the given pedal travel, in TABLE_FULL_SCALE full
+ *         scale. This may exceed TABLE_FULL_SCALE past the end of the pedal
+ *         travel.
+ */
+static uint32_t App_EvaluatePedalCurve(
+    const uint8_t pedal_curve[PEDAL_MAP_NUM_CURVE_POINTS],
+    uint32_t      travel,
+    uint32_t      full_travel);
+
+/**
+ * Tabulate the pedal curve of the given pedal map for its calibration
+ * @param pedal_map The pedal map to tabulate the pedal curve of
+ */
+static void App_TabulatePedalCurve(struct PedalMap *pedal_map);
+
+static uint32_t App_EvaluatePedalCurve(
+    const uint8_t  pedal_curve[PEDAL_MAP_NUM_CURVE_POINTS],
+    const uint32_t travel,
+    const uint32_t full_travel)
+{
+    const uint64_t position =
+        (uint64_t)travel * (PEDAL_MAP_NUM_CURVE_POINTS - 1U);
+    uint32_t index = (uint32_t)(position / full_travel);
+
+    // Past the end of the pedal travel, the last segment of the pedal curve is
+    // extended so the last segment of the table has the same slope
+    if (index > PEDAL_MAP_NUM_CURVE_POINTS - 2U)
+    {
+        index = PEDAL_MAP_NUM_CURVE_POINTS - 2U;
+    }
+
+    // The pedal curve between its two points, in percent * full_travel
+    const uint64_t remainder = position - (uint64_t)index * full_travel;
+    const uint64_t percentage =
+        (uint64_t)pedal_curve[index] * full_travel +
+        (uint64_t)(pedal_curve[index + 1U] - pedal_curve[index]) * remainder;
+    const uint64_t divisor = 100U * (uint64_t)full_travel;
+
+    return (uint32_t)((percentage * TABLE_FULL_SCALE + divisor / 2U) / divisor);
+}
+
+static void App_TabulatePedalCurve(struct PedalMap *const pedal_map)
+{
+    const uint32_t encoder_fully_pressed_value =
+        pedal_map->encoder_fully_pressed_value;
+
+    pedal_map->low_end_deadzone_threshold =
+        encoder_fully_pressed_value * PEDAL_MAP_DEADZONE_PERCENT;
+    pedal_map->high_end_deadzone_threshold =
+        encoder_fully_pressed_value *
+        (POSITION_SCALE - PEDAL_MAP_DEADZONE_PERCENT);
+
+    const uint32_t full_travel = pedal_map->high_end_deadzone_threshold -
+                                 pedal_map->low_end_deadzone_threshold;
+
+    pedal_map->segment_size_shift = 0U;
+    while ((full_travel >> pedal_map->segment_size_shift) >=
+           PEDAL_MAP_MAX_SEGMENTS)
+    {
+        pedal_map->segment_size_shift++;
+    }
+
+    // The last segment may extend past the end of the pedal travel, and any
+    // segments after it are unused
+    const uint32_t num_segments =
+        (full_travel >> pedal_map->segment_size_shift) + 1U;
+
+    for (uint32_t i = 0U; i <= PEDAL_MAP_MAX_SEGMENTS; i++)
+    {
+        if (full_travel == 0U || i > num_segments)
+        {
+            pedal_map->table[i] = 0U;
+            continue;
+        }
+
+        pedal_map->table[i] = App_EvaluatePedalCurve(
+            pedal_map->pedal_curve, i << pedal_map->segment_size_shift,
+            full_travel);
+    }
+}
+
+struct PedalMap *App_PedalMap_Create(
+    const uint32_t encoder_fully_pressed_value,
+    const uint8_t  pedal_curve[PEDAL_MAP_NUM_CURVE_POINTS])
+{
+    struct PedalMap *pedal_map = malloc(sizeof(struct PedalMap));
+    assert(pedal_map != NULL);
+
+    pedal_map->encoder_fully_pressed_value = encoder_fully_pressed_value;
+    App_PedalMap_SetPedalCurve(pedal_map, pedal_curve);
+
+    return pedal_map;
+}
+
+void App_PedalMap_Destroy(struct PedalMap *pedal_map)
+{
+    free(pedal_map);
+}
+
+void App_PedalMap_SetEncoderFullyPressedValue(
+    struct PedalMap *const pedal_map,
+    const uint32_t         encoder_fully_pressed_value)
+{
+    assert(encoder_fully_pressed_value <= UINT32_MAX / POSITION_SCALE);
+
+    pedal_map->encoder_fully_pressed_value = encoder_fully_pressed_value;
+    App_TabulatePedalCurve(pedal_map);
+}
+
+void App_PedalMap_SetPedalCurve(
+    struct PedalMap *const pedal_map,
+    const uint8_t          pedal_curve[PEDAL_MAP_NUM_CURVE_POINTS])
+{
+    assert(pedal_curve[0] == 0U);
+    assert(pedal_curve[PEDAL_MAP_NUM_CURVE_POINTS - 1U] == 100U);
+
+    for (uint32_t i = 0U; i < PEDAL_MAP_NUM_CURVE_POINTS; i++)
+    {
+        assert(i == 0U || pedal_curve[i] >= pedal_curve[i - 1U]);
+        pedal_map->pedal_curve[i] = pedal_curve[i];
+    }
+
+    App_PedalMap_SetEncoderFullyPressedValue(
+        pedal_map, pedal_map->encoder_fully_pressed_value);
+}
+
+uint32_t App_PedalMap_GetEncoderFullyPressedValue(
+    const struct PedalMap *const pedal_map)
+{
+    return pedal_map->encoder_fully_pressed_value;
+}
+
+uint32_t App_PedalMap_MapEncoderCounterValue(
+    const struct PedalMap *const pedal_map,
+    const uint32_t               encoder_counter_value)
+{
+    if (encoder_counter_value > pedal_map->encoder_fully_pressed_value)
+    {
+        return 0U;
+    }
+
+    const uint32_t position = encoder_counter_value * POSITION_SCALE;
+
+    if (position <= pedal_map->low_end_deadzone_threshold)
+    {
+        return 0U;
+    }
+    else if (position >= pedal_map->high_end_deadzone_threshold)
+    {
+        return PEDAL_MAP_FULL_SCALE;
+    }
+
+    // Interpolate between the ends of the segment containing the pedal travel
+    const uint32_t travel   = position - pedal_map->low_end_deadzone_threshold;
+    const uint32_t shift    = pedal_map->segment_size_shift;
+    const uint32_t segment  = travel >> shift;
+    const uint32_t fraction = travel & ((1U << shift) - 1U);
+    const uint32_t start    = pedal_map->table[segment];
+    const uint32_t end      = pedal_map->table[segment + 1U];
+    const uint32_t value =
+        start + (uint32_t)(((uint64_t)(end - start) * fraction) >> shift);
+
+    return (value + (1U << (TABLE_FRACTION_BITS - 1U))) >> TABLE_FRACTION_BITS;
+}
@@ -1,5 +1,7 @@
 #include "App_SharedSetPeriodicCanSignals.h"
 #include "App_SetPeriodicCanSignals.h"
+#include "configs/App_PedalCurves.h"
+#include "configs/App_PedalLatencyHistogramConfig.h"
 
 STATIC_DEFINE_APP_SET_PERIODIC_CAN_SIGNALS_IN_RANGE_CHECK(FsmCanTxInterface)
 
@@ -115,11 +117,21 @@ void App_SetPeriodicSignals_Brake(const struct FsmWorld *world)
 void App_SetPeriodicSignals_AcceleratorPedal(const struct FsmWorld *world)
 {
     struct FsmCanTxInterface *can_tx = App_FsmWorld_GetCanTx(world);
+    struct FsmCanRxInterface *can_rx = App_FsmWorld_GetCanRx(world);
 
     struct Brake *            brake = App_FsmWorld_GetBrake(world);
     struct AcceleratorPedals *papps_and_sapps =
         App_FsmWorld_GetPappsAndSapps(world);
 
+    // The pedal curves are in the order of the drive mode switch positions.
+    // Keep the selected pedal curve while the drive mode is invalid.
+    const uint8_t drive_mode =
+        App_CanRx_DIM_DRIVE_MODE_SWITCH_GetSignal_DRIVE_MODE(can_rx);
+    if (drive_mode < NUM_PEDAL_CURVES)
+    {
+        App_AcceleratorPedals_SetPedalCurve(papps_and_sapps, drive_mode);
+    }
+
     const float papps_pedal_percentage =
         App_AcceleratorPedals_GetPrimaryPedalPercentage(papps_and_sapps);
 
@@ -136,7 +148,8 @@ void App_SetPeriodicSignals_AcceleratorPedal(const struct FsmWorld *world)
     else
     {
         App_CanTx_SetPeriodicSignal_MAPPED_PEDAL_PERCENTAGE(
-            can_tx, papps_pedal_percentage);
+            can_tx,
+            App_AcceleratorPedals_GetMappedPedalPercentage(papps_and_sapps));
     }
 }
 
@@ -163,3 +176,56 @@ void App_SetPeriodicSignals_MotorShutdownFaults(const struct FsmWorld *world)
         can_tx,
         CANMSGS_FSM_MOTOR_SHUTDOWN_ERRORS_SECONDARY_FLOW_RATE_HAS_UNDERFLOW_FALSE_CHOICE);
 }
+
+void App_SetPeriodicSignals_WheelDynamics(const struct FsmWorld *world)
+{
+    struct FsmCanTxInterface *can_tx = App_FsmWorld_GetCanTx(world);
+
+    struct WheelDynamics *wheel_dynamics = App_FsmWorld_GetWheelDynamics(world);
+
+    App_CanTx_SetPeriodicSignal_WHEEL_ACCELERATION(
+        can_tx, App_WheelDynamics_GetAccelerationMps2(wheel_dynamics));
+    App_CanTx_SetPeriodicSignal_WHEEL_SPEED_DIFFERENCE(
+        can_tx, App_WheelDynamics_GetSpeedDifferenceKph(wheel_dynamics));
+}
+
+void App_SetPeriodicSignals_PedalLatency(const struct FsmWorld *world)
+{
+    struct FsmCanTxInterface *can_tx = App_FsmWorld_GetCanTx(world);
+
+    struct LatencyHistogram *pedal_latency_histogram =
+        App_FsmWorld_GetPedalLatencyHistogram(world);
+
+    void (*const set_bin_signals[PEDAL_LATENCY_HISTOGRAM_NUM_BINS])(
+        struct FsmCanTxInterface *, uint8_t) = {
+        App_CanTx_SetPeriodicSignal_PEDAL_LATENCY_BIN_0,
+        App_CanTx_SetPeriodicSignal_PEDAL_LATENCY_BIN_1,
+        App_CanTx_SetPeriodicSignal_PEDAL_LATENCY_BIN_2,
+        App_CanTx_SetPeriodicSignal_PEDAL_LATENCY_BIN_3,
+        App_CanTx_SetPeriodicSignal_PEDAL_LATENCY_BIN_4,
+        App_CanTx_SetPeriodicSignal_PEDAL_LATENCY_BIN_5,
+        App_CanTx_SetPeriodicSignal_PEDAL_LATENCY_BIN_6,
+        App_CanTx_SetPeriodicSignal_PEDAL_LATENCY_BIN_7,
+    };
+
+    for (uint32_t bin = 0U; bin < PEDAL_LATENCY_HISTOGRAM_NUM_BINS; bin++)
+    {
+        const uint32_t count = App_SharedLatencyHistogram_TakeBinCount(
+            pedal_latency_histogram, bin);
+
+        // A bin that counts most of the latencies saturates, but the rare long
+        // latencies in the upper bins are what matter
+        set_bin_signals[bin](
+            can_tx, count > UINT8_MAX ? UINT8_MAX : (uint8_t)count);
+    }
+}
+
+void App_SetPeriodicSignals_PedalMapBenchmark(const struct FsmWorld *world)
+{
+    struct FsmCanTxInterface *can_tx = App_FsmWorld_GetCanTx(world);
+    struct AcceleratorPedals *papps_and_sapps =
+        App_FsmWorld_GetPappsAndSapps(world);
+
+    App_CanTx_SetPeriodicSignal_MAX_PEDAL_MAP_CYCLES(
+        can_tx, App_AcceleratorPedals_TakeMaxPedalMapCycles(papps_and_sapps));
+}
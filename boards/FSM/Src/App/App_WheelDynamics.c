@@ -0,0 +1,50 @@
+#include <stdlib.h>
+#include <assert.h>
+#include "App_WheelDynamics.h"
+
+struct WheelDynamics
+{
+    float (*get_left_wheel_speed_kph)(void);
+    float (*get_right_wheel_speed_kph)(void);
+    float (*get_left_wheel_acceleration_mps2)(void);
+    float (*get_right_wheel_acceleration_mps2)(void);
+};
+
+struct WheelDynamics *App_WheelDynamics_Create(
+    float (*const get_left_wheel_speed_kph)(void),
+    float (*const get_right_wheel_speed_kph)(void),
+    float (*const get_left_wheel_acceleration_mps2)(void),
+    float (*const get_right_wheel_acceleration_mps2)(void))
+{
+    struct WheelDynamics *wheel_dynamics = malloc(sizeof(struct WheelDynamics));
+    assert(wheel_dynamics != NULL);
+
+    wheel_dynamics->get_left_wheel_speed_kph  = get_left_wheel_speed_kph;
+    wheel_dynamics->get_right_wheel_speed_kph = get_right_wheel_speed_kph;
+    wheel_dynamics->get_left_wheel_acceleration_mps2 =
+        get_left_wheel_acceleration_mps2;
+    wheel_dynamics->get_right_wheel_acceleration_mps2 =
+        get_right_wheel_acceleration_mps2;
+
+    return wheel_dynamics;
+}
+
+void App_WheelDynamics_Destroy(struct WheelDynamics *wheel_dynamics)
+{
+    free(wheel_dynamics);
+}
+
+float App_WheelDynamics_GetAccelerationMps2(
+    const struct WheelDynamics *const wheel_dynamics)
+{
+    return (wheel_dynamics->get_left_wheel_acceleration_mps2() +
+            wheel_dynamics->get_right_wheel_acceleration_mps2()) /
+           2.0f;
+}
+
+float App_WheelDynamics_GetSpeedDifferenceKph(
+    const struct WheelDynamics *const wheel_dynamics)
+{
+    return wheel_dynamics->get_left_wheel_speed_kph() -
+           wheel_dynamics->get_right_wheel_speed_kph();
+}
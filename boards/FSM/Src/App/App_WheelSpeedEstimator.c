@@ -0,0 +1,294 @@
+#include <assert.h>
+#include <stdlib.h>
+
+#include "App_WheelSpeedEstimator.h"
+
+#define MPS_TO_KPH_CONVERSION_FACTOR 3.6f
+
+// One speed sample is kept per update, so the oldest sample is one
+// acceleration window old when updating at 1kHz
+#define NUM_SPEED_SAMPLES (WHEEL_SPEED_ESTIMATOR_ACCELERATION_WINDOW_MS + 1U)
+
+struct WheelSpeedEstimator
+{
+    float    timer_frequency_hz;
+    uint32_t timer_period_ticks;
+    float    distance_per_edge_m;
+
+    // The times of the most recent edges, in timer ticks. The timer counter
+    // wrapping around is undone, so the time between any two edges is the
+    // (unsigned) difference between them.
+    uint32_t edge_ticks[WHEEL_SPEED_ESTIMATOR_MAX_EDGES];
+    uint32_t newest_edge_index;
+    uint32_t num_edges;
+    uint32_t last_capture;
+    uint32_t last_edge_time_ms;
+
+    float    speed_samples_mps[NUM_SPEED_SAMPLES];
+    uint32_t speed_sample_times_ms[NUM_SPEED_SAMPLES];
+    uint32_t newest_speed_sample_index;
+    uint32_t num_speed_samples;
+
+    float speed_mps;
+    float acceleration_mps2;
+};
+
+/**
+ * Get the time of an edge of the given wheel speed estimator
+ * @param wheel_speed_estimator The wheel speed estimator to get the edge of
+ * @param age The age of the edge, where 0 is the most recent edge
+ * @return The time of the edge, in timer ticks
+ */
+static uint32_t App_GetEdgeTicks(
+    const struct WheelSpeedEstimator *wheel_speed_estimator,
+    uint32_t                          age);
+
+/**
+ * Estimate the frequency at which edges arrive for the given wheel speed
+ * estimator
+ * @param wheel_speed_estimator The wheel speed estimator to estimate for
+ * @param current_time_ms The current time, in ms
+ * @return The frequency at which edges arrive, in Hz
+ */
+static float App_EstimateEdgeFrequency(
+    const struct WheelSpeedEstimator *wheel_speed_estimator,
+    uint32_t                          current_time_ms);
+
+/**
+ * Add a speed sample to the given wheel speed estimator, and differentiate the
+ * speed over the acceleration window
+ * @param wheel_speed_estimator The wheel speed estimator to add the sample to
+ * @param speed_mps The speed, in m/s
+ * @param current_time_ms The current time, in ms
+ */
+static void App_UpdateAcceleration(
+    struct WheelSpeedEstimator *wheel_speed_estimator,
+    float                       speed_mps,
+    uint32_t                    current_time_ms);
+
+static uint32_t App_GetEdgeTicks(
+    const struct WheelSpeedEstimator *const wheel_speed_estimator,
+    const uint32_t                          age)
+{
+    const uint32_t index = (wheel_speed_estimator->newest_edge_index +
+                            WHEEL_SPEED_ESTIMATOR_MAX_EDGES - age) %
+                           WHEEL_SPEED_ESTIMATOR_MAX_EDGES;
+
+    return wheel_speed_estimator->edge_ticks[index];
+}
+
+static float App_EstimateEdgeFrequency(
+    const struct WheelSpeedEstimator *const wheel_speed_estimator,
+    const uint32_t                          current_time_ms)
+{
+    if (wheel_speed_estimator->num_edges < 2U)
+    {
+        return 0.0f;
+    }
+
+    const float timer_frequency_hz = wheel_speed_estimator->timer_frequency_hz;
+    const uint32_t newest_edge_ticks =
+        App_GetEdgeTicks(wheel_speed_estimator, 0U);
+    const uint32_t counting_window_ticks = (uint32_t)(
+        timer_frequency_hz * WHEEL_SPEED_ESTIMATOR_COUNTING_WINDOW_MS /
+        1000.0f);
+
+    // Count the edge intervals that end within the counting window
+    uint32_t num_intervals = 0U;
+
+    while (num_intervals + 1U < wheel_speed_estimator->num_edges &&
+           newest_edge_ticks - App_GetEdgeTicks(
+                                   wheel_speed_estimator, num_intervals + 1U) <=
+               counting_window_ticks)
+    {
+        num_intervals++;
+    }
+
+    if (num_intervals >= WHEEL_SPEED_ESTIMATOR_MIN_COUNTED_INTERVALS)
+    {
+        const uint32_t elapsed_ticks =
+            newest_edge_ticks -
+            App_GetEdgeTicks(wheel_speed_estimator, num_intervals);
+
+        return (float)num_intervals * timer_frequency_hz / (float)elapsed_ticks;
+    }
+
+    // Too few edges to count, so measure the period of the last edge interval
+    const uint32_t period_ticks =
+        newest_edge_ticks - App_GetEdgeTicks(wheel_speed_estimator, 1U);
+
+    if (period_ticks == 0U)
+    {
+        return 0.0f;
+    }
+
+    float frequency_hz = timer_frequency_hz / (float)period_ticks;
+
+    // If the wheel is decelerating, the next edge is overdue and the wheel
+    // can't be faster than if that edge arrived right now
+    const uint32_t elapsed_ms =
+        current_time_ms - wheel_speed_estimator->last_edge_time_ms;
+
+    if ((float)elapsed_ms * frequency_hz > 1000.0f)
+    {
+        frequency_hz = 1000.0f / (float)elapsed_ms;
+    }
+
+    return frequency_hz;
+}
+
+static void App_UpdateAcceleration(
+    struct WheelSpeedEstimator *const wheel_speed_estimator,
+    const float                       speed_mps,
+    const uint32_t                    current_time_ms)
+{
+    wheel_speed_estimator->newest_speed_sample_index =
+        (wheel_speed_estimator->newest_speed_sample_index + 1U) %
+        NUM_SPEED_SAMPLES;
+    wheel_speed_estimator
+        ->speed_samples_mps[wheel_speed_estimator->newest_speed_sample_index] =
+        speed_mps;
+    wheel_speed_estimator->speed_sample_times_ms
+        [wheel_speed_estimator->newest_speed_sample_index] = current_time_ms;
+
+    if (wheel_speed_estimator->num_speed_samples < NUM_SPEED_SAMPLES)
+    {
+        wheel_speed_estimator->num_speed_samples++;
+    }
+
+    const uint32_t oldest_speed_sample_index =
+        (wheel_speed_estimator->newest_speed_sample_index + NUM_SPEED_SAMPLES +
+         1U - wheel_speed_estimator->num_speed_samples) %
+        NUM_SPEED_SAMPLES;
+    const uint32_t elapsed_ms =
+        current_time_ms -
+        wheel_speed_estimator->speed_sample_times_ms[oldest_speed_sample_index];
+
+    if (elapsed_ms == 0U)
+    {
+        wheel_speed_estimator->acceleration_mps2 = 0.0f;
+        return;
+    }
+
+    wheel_speed_estimator->acceleration_mps2 =
+        (speed_mps -
+         wheel_speed_estimator->speed_samples_mps[oldest_speed_sample_index]) *
+        1000.0f / (float)elapsed_ms;
+}
+
+struct WheelSpeedEstimator *App_WheelSpeedEstimator_Create(
+    const float    timer_frequency_hz,
+    const uint32_t timer_period_ticks,
+    const float    distance_per_edge_m)
+{
+    assert(timer_frequency_hz > 0.0f);
+    assert(timer_period_ticks > 0U);
+    assert(distance_per_edge_m > 0.0f);
+    assert(
+        (float)WHEEL_SPEED_ESTIMATOR_TIMEOUT_MS <
+        1000.0f * (float)timer_period_ticks / timer_frequency_hz);
+
+    struct WheelSpeedEstimator *wheel_speed_estimator =
+        malloc(sizeof(struct WheelSpeedEstimator));
+    assert(wheel_speed_estimator != NULL);
+
+    wheel_speed_estimator->timer_frequency_hz  = timer_frequency_hz;
+    wheel_speed_estimator->timer_period_ticks  = timer_period_ticks;
+    wheel_speed_estimator->distance_per_edge_m = distance_per_edge_m;
+
+    for (uint32_t i = 0U; i < WHEEL_SPEED_ESTIMATOR_MAX_EDGES; i++)
+    {
+        wheel_speed_estimator->edge_ticks[i] = 0U;
+    }
+    wheel_speed_estimator->newest_edge_index = 0U;
+    wheel_speed_estimator->num_edges         = 0U;
+    wheel_speed_estimator->last_capture      = 0U;
+    wheel_speed_estimator->last_edge_time_ms = 0U;
+
+    for (uint32_t i = 0U; i < NUM_SPEED_SAMPLES; i++)
+    {
+        wheel_speed_estimator->speed_samples_mps[i]     = 0.0f;
+        wheel_speed_estimator->speed_sample_times_ms[i] = 0U;
+    }
+    wheel_speed_estimator->newest_speed_sample_index = 0U;
+    wheel_speed_estimator->num_speed_samples         = 0U;
+
+    wheel_speed_estimator->speed_mps         = 0.0f;
+    wheel_speed_estimator->acceleration_mps2 = 0.0f;
+
+    return wheel_speed_estimator;
+}
+
+void App_WheelSpeedEstimator_Destroy(
+    struct WheelSpeedEstimator *wheel_speed_estimator)
+{
+    free(wheel_speed_estimator);
+}
+
+void App_WheelSpeedEstimator_Update(
+    struct WheelSpeedEstimator *const wheel_speed_estimator,
+    const uint32_t *const             captures,
+    const uint32_t                    num_captures,
+    const uint32_t                    current_time_ms)
+{
+    // The timer may have wrapped around more than once since the last edge, so
+    // the next edge can't be timed from it. The subtraction is well-defined
+    // when the millisecond counter wraps.
+    if (current_time_ms - wheel_speed_estimator->last_edge_time_ms >
+        WHEEL_SPEED_ESTIMATOR_TIMEOUT_MS)
+    {
+        wheel_speed_estimator->num_edges = 0U;
+    }
+
+    for (uint32_t i = 0U; i < num_captures; i++)
+    {
+        uint32_t edge_ticks = captures[i];
+
+        if (wheel_speed_estimator->num_edges > 0U)
+        {
+            // The timer counter may have wrapped around between two edges
+            edge_ticks =
+                App_GetEdgeTicks(wheel_speed_estimator, 0U) +
+                (captures[i] + wheel_speed_estimator->timer_period_ticks -
+                 wheel_speed_estimator->last_capture) %
+                    wheel_speed_estimator->timer_period_ticks;
+        }
+
+        wheel_speed_estimator->newest_edge_index =
+            (wheel_speed_estimator->newest_edge_index + 1U) %
+            WHEEL_SPEED_ESTIMATOR_MAX_EDGES;
+        wheel_speed_estimator
+            ->edge_ticks[wheel_speed_estimator->newest_edge_index] = edge_ticks;
+        wheel_speed_estimator->last_capture = captures[i];
+
+        if (wheel_speed_estimator->num_edges < WHEEL_SPEED_ESTIMATOR_MAX_EDGES)
+        {
+            wheel_speed_estimator->num_edges++;
+        }
+    }
+
+    if (num_captures > 0U)
+    {
+        wheel_speed_estimator->last_edge_time_ms = current_time_ms;
+    }
+
+    wheel_speed_estimator->speed_mps =
+        App_EstimateEdgeFrequency(wheel_speed_estimator, current_time_ms) *
+        wheel_speed_estimator->distance_per_edge_m;
+
+    App_UpdateAcceleration(
+        wheel_speed_estimator, wheel_speed_estimator->speed_mps,
+        current_time_ms);
+}
+
+float App_WheelSpeedEstimator_GetSpeedKph(
+    const struct WheelSpeedEstimator *const wheel_speed_estimator)
+{
+    return MPS_TO_KPH_CONVERSION_FACTOR * wheel_speed_estimator->speed_mps;
+}
+
+float App_WheelSpeedEstimator_GetAccelerationMps2(
+    const struct WheelSpeedEstimator *const wheel_speed_estimator)
+{
+    return wheel_speed_estimator->acceleration_mps2;
+}
@@ -27,7 +27,6 @@ static void
     App_SetPeriodicSignals_WheelSpeedInRangeChecks(world);
     App_SetPeriodicSignals_SteeringAngleInRangeCheck(world);
     App_SetPeriodicSignals_Brake(world);
-    App_SetPeriodicSignals_AcceleratorPedal(world);
     App_SetPeriodicSignals_MotorShutdownFaults(world);
 
     if (App_CanRx_BMS_AIR_STATES_GetSignal_AIR_POSITIVE(can_rx) ==
@@ -40,6 +39,12 @@ static void
     }
 }
 
+static void
+    AirClosedStateRunOnTick1kHz(struct StateMachine *const state_machine)
+{
+    App_AllStatesRunOnTick1kHz(state_machine);
+}
+
 static void AirClosedStateRunOnExit(struct StateMachine *const state_machine)
 {
     UNUSED(state_machine);
@@ -52,6 +57,7 @@ const struct State *App_GetAirClosedState(void)
         .run_on_entry      = AirClosedStateRunOnEntry,
         .run_on_tick_1Hz   = AirClosedStateRunOnTick1Hz,
         .run_on_tick_100Hz = AirClosedStateRunOnTick100Hz,
+        .run_on_tick_1kHz  = AirClosedStateRunOnTick1kHz,
         .run_on_exit       = AirClosedStateRunOnExit,
     };
 
@@ -1,4 +1,5 @@
 #include "states/App_AllStates.h"
+#include "App_SetPeriodicCanSignals.h"
 
 void App_AllStatesRunOnTick1Hz(struct StateMachine *const state_machine)
 {
@@ -7,4 +8,21 @@ void App_AllStatesRunOnTick1Hz(struct StateMachine *const state_machine)
         App_FsmWorld_GetRgbLedSequence(world);
 
     App_SharedRgbLedSequence_Tick(rgb_led_sequence);
+    App_SetPeriodicSignals_PedalLatency(world);
+    App_SetPeriodicSignals_PedalMapBenchmark(world);
+}
+
+void App_AllStatesRunOnTick1kHz(struct StateMachine *const state_machine)
+{
+    struct FsmWorld *world = App_SharedStateMachine_GetWorld(state_machine);
+    struct AcceleratorPedals *papps_and_sapps =
+        App_FsmWorld_GetPappsAndSapps(world);
+
+    App_AcceleratorPedals_Tick(papps_and_sapps);
+
+    // The APPS and brake plausibility signals are updated right after this
+    // on-tick function, so a fault overrides the mapped pedal percentage
+    // before FSM_PEDAL_POSITION is enqueued in the same tick
+    App_SetPeriodicSignals_AcceleratorPedal(world);
+    App_SetPeriodicSignals_WheelDynamics(world);
 }
@@ -1,4 +1,6 @@
+#include <assert.h>
 #include <stm32f3xx.h>
+#include "App_SharedAdcPipeline.h"
 #include "Io_SharedAdc.h"
 #include "Io_Adc.h"
 
@@ -10,8 +12,8 @@
 // For example, suppose we are measuring ADC channel 2, 4, and 7, which have
 // rank 3, 1, and 2 respectively. The ADC will measure the channel 4, then
 // channel 7, and finally channel 2. This order is important because it
-// determines the order in which the DMA writes data to our raw_adc_values
-// buffer.
+// determines the order in which the DMA writes data to each scan in our
+// raw_adc_values buffer.
 //
 // The following enum is used to index into raw_adc_values, which means it must
 // be ordered in ascending ranks. If we were writing an enum for the earlier
@@ -31,28 +33,59 @@ enum
     NUM_ADC_CHANNELS
 };
 
-static uint16_t raw_adc_values[NUM_ADC_CHANNELS];
-static float    adc_voltages[NUM_ADC_CHANNELS];
+// TIM3 triggers a scan at ADC_FREQUENCY, and this many scans are averaged into
+// one sample per channel
+#define ADC_OVERSAMPLING_RATIO 8U
+#define NUM_RAW_ADC_VALUES_PER_BLOCK (ADC_OVERSAMPLING_RATIO * NUM_ADC_CHANNELS)
 
-void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef *hadc)
+// The DMA controller writes into one half of this buffer while the other half
+// is processed
+static uint16_t            raw_adc_values[2U * NUM_RAW_ADC_VALUES_PER_BLOCK];
+static struct AdcPipeline *adc_pipeline;
+
+void Io_Adc_Init(ADC_HandleTypeDef *const hadc)
 {
-    adc_voltages[CHANNEL_1] = Io_SharedAdc_ConvertRawAdcValueToVoltage(
-        hadc, raw_adc_values[CHANNEL_1]);
-    adc_voltages[CHANNEL_3] = Io_SharedAdc_ConvertRawAdcValueToVoltage(
-        hadc, raw_adc_values[CHANNEL_3]);
+    assert(hadc->Init.NbrOfConversion == NUM_ADC_CHANNELS);
+
+    // The steering angle is smoothed, while spikes in the brake pressure are
+    // rejected without smoothing (and delaying) brake pressure steps
+    const struct AdcChannelConfig channel_configs[NUM_ADC_CHANNELS] = {
+        [CHANNEL_1] = { .filter_type          = ADC_FILTER_IIR,
+                        .iir_smoothing_factor = 0.2f },
+        [CHANNEL_3] = { .filter_type        = ADC_FILTER_MEDIAN,
+                        .median_window_size = 3U },
+    };
+
+    adc_pipeline = App_SharedAdcPipeline_Create(
+        NUM_ADC_CHANNELS, ADC_OVERSAMPLING_RATIO, ADC_REFERENCE_VOLTAGE,
+        Io_SharedAdc_GetFullScale(hadc), channel_configs);
+
+    HAL_ADC_Start_DMA(
+        hadc, (uint32_t *)raw_adc_values,
+        sizeof(raw_adc_values) / sizeof(raw_adc_values[0]));
 }
 
-uint16_t *Io_Adc_GetRawAdcValues(void)
+void HAL_ADC_ConvHalfCpltCallback(ADC_HandleTypeDef *hadc)
+{
+    UNUSED(hadc);
+    App_SharedAdcPipeline_ProcessBlock(
+        adc_pipeline, &raw_adc_values[0], HAL_GetTick());
+}
+
+void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef *hadc)
 {
-    return raw_adc_values;
+    UNUSED(hadc);
+    App_SharedAdcPipeline_ProcessBlock(
+        adc_pipeline, &raw_adc_values[NUM_RAW_ADC_VALUES_PER_BLOCK],
+        HAL_GetTick());
 }
 
-float Io_Adc_GetChannel1Voltage(void)
+struct AdcChannelOutput Io_Adc_GetChannel1Output(void)
 {
-    return adc_voltages[CHANNEL_1];
+    return App_SharedAdcPipeline_GetOutput(adc_pipeline, CHANNEL_1);
 }
 
-float Io_Adc_GetChannel3Voltage(void)
+struct AdcChannelOutput Io_Adc_GetChannel3Output(void)
 {
-    return adc_voltages[CHANNEL_3];
+    return App_SharedAdcPipeline_GetOutput(adc_pipeline, CHANNEL_3);
 }
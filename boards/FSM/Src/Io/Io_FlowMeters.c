@@ -1,57 +1,83 @@
 #include <assert.h>
 #include "main.h"
-#include "Io_SharedFreqOnlyPwmInput.h"
+#include "Io_SharedDmaInputCapture.h"
+#include "App_SharedCaptureFrequency.h"
 #include "Io_FlowMeters.h"
 
-static struct FreqOnlyPwmInput *primary_flow_meter, *secondary_flow_meter;
+// The flow meters output 7.5Hz per L/min, so this holds the rising edges of
+// several task periods between two reads of the flow rate
+#define FLOW_METER_MAX_CAPTURES 32U
 
-void Io_FlowMeters_Init(TIM_HandleTypeDef *htim)
+// Below 0.27L/min (2Hz), the flow rate is reported as 0L/min
+#define FLOW_METER_TIMEOUT_MS 500U
+
+struct FlowMeter
 {
-    assert(htim != NULL);
+    struct DmaInputCapture * dma_input_capture;
+    struct CaptureFrequency *capture_frequency;
+};
 
-    primary_flow_meter = Io_SharedFreqOnlyPwmInput_Create(
-        htim, TIMx_FREQUENCY / TIM4_PRESCALER, TIM_CHANNEL_1,
-        TIM4_AUTO_RELOAD_REG, HAL_TIM_ACTIVE_CHANNEL_1);
-    secondary_flow_meter = Io_SharedFreqOnlyPwmInput_Create(
-        htim, TIMx_FREQUENCY / TIM4_PRESCALER, TIM_CHANNEL_2,
-        TIM4_AUTO_RELOAD_REG, HAL_TIM_ACTIVE_CHANNEL_2);
-}
+static struct FlowMeter primary_flow_meter, secondary_flow_meter;
 
-float Io_FlowMeters_GetPrimaryFlowRate(void)
+/**
+ * Initialize the given flow meter
+ * @param flow_meter The flow meter to initialize
+ * @param htim The handle of the timer capturing the flow meter
+ * @param tim_channel The timer channel capturing the flow meter
+ */
+static void Io_InitFlowMeter(
+    struct FlowMeter * flow_meter,
+    TIM_HandleTypeDef *htim,
+    uint32_t           tim_channel);
+
+/**
+ * Get the flow rate (L/min) of the given flow meter, from the rising edges
+ * captured since the last call
+ * @param flow_meter The flow meter to get the flow rate of
+ * @return The flow rate in L/min
+ */
+static float Io_GetFlowRate(struct FlowMeter *flow_meter);
+
+static void Io_InitFlowMeter(
+    struct FlowMeter *const  flow_meter,
+    TIM_HandleTypeDef *const htim,
+    const uint32_t           tim_channel)
 {
-    return Io_SharedFreqOnlyPwmInput_GetFrequency(primary_flow_meter) / 7.5f;
+    flow_meter->dma_input_capture = Io_SharedDmaInputCapture_Create(
+        htim, tim_channel, 1U, FLOW_METER_MAX_CAPTURES);
+    flow_meter->capture_frequency = App_SharedCaptureFrequency_Create(
+        TIMx_FREQUENCY / TIM4_PRESCALER, TIM4_AUTO_RELOAD_REG + 1U,
+        FLOW_METER_TIMEOUT_MS);
 }
 
-float Io_FlowMeters_GetSecondaryFlowRate(void)
+static float Io_GetFlowRate(struct FlowMeter *const flow_meter)
 {
-    return Io_SharedFreqOnlyPwmInput_GetFrequency(secondary_flow_meter) / 7.5f;
+    uint32_t       captures[FLOW_METER_MAX_CAPTURES];
+    const uint32_t num_captures = Io_SharedDmaInputCapture_Read(
+        flow_meter->dma_input_capture, captures, FLOW_METER_MAX_CAPTURES);
+
+    App_SharedCaptureFrequency_Update(
+        flow_meter->capture_frequency, captures, num_captures, HAL_GetTick());
+
+    return App_SharedCaptureFrequency_GetFrequency(
+               flow_meter->capture_frequency) /
+           7.5f;
 }
 
-void Io_FlowMeters_InputCaptureCallback(TIM_HandleTypeDef *htim)
+void Io_FlowMeters_Init(TIM_HandleTypeDef *htim)
 {
-    if (htim == Io_SharedFreqOnlyPwmInput_GetTimerHandle(primary_flow_meter) &&
-        htim->Channel ==
-            Io_SharedFreqOnlyPwmInput_GetTimerActiveChannel(primary_flow_meter))
-    {
-        Io_SharedFreqOnlyPwmInput_Tick(primary_flow_meter);
-    }
-
-    else if (
-        htim ==
-            Io_SharedFreqOnlyPwmInput_GetTimerHandle(secondary_flow_meter) &&
-        htim->Channel == Io_SharedFreqOnlyPwmInput_GetTimerActiveChannel(
-                             secondary_flow_meter))
-    {
-        Io_SharedFreqOnlyPwmInput_Tick(secondary_flow_meter);
-    }
+    assert(htim != NULL);
+
+    Io_InitFlowMeter(&primary_flow_meter, htim, TIM_CHANNEL_1);
+    Io_InitFlowMeter(&secondary_flow_meter, htim, TIM_CHANNEL_2);
 }
 
-void Io_FlowMeters_CheckIfPrimaryIsActive(void)
+float Io_FlowMeters_GetPrimaryFlowRate(void)
 {
-    Io_SharedFreqOnlyPwmInput_CheckIfPwmIsActive(primary_flow_meter);
+    return Io_GetFlowRate(&primary_flow_meter);
 }
 
-void Io_FlowMeters_CheckIfSecondaryIsActive(void)
+float Io_FlowMeters_GetSecondaryFlowRate(void)
 {
-    Io_SharedFreqOnlyPwmInput_CheckIfPwmIsActive(secondary_flow_meter);
+    return Io_GetFlowRate(&secondary_flow_meter);
 }
@@ -22,5 +22,6 @@ float Io_MSP3002K5P3N1_GetPressurePsi(void)
         2500.0f / (MAX_INPUT_VOLTAGE - MIN_INPUT_VOLTAGE);
 
     // Brake pressure = (ADC Voltage - Min Input Voltage) * Psi Per Volt
-    return PSI_PER_VOLT * (Io_Adc_GetChannel3Voltage() - MIN_INPUT_VOLTAGE);
+    return PSI_PER_VOLT *
+           (Io_Adc_GetChannel3Output().voltage - MIN_INPUT_VOLTAGE);
 }
@@ -0,0 +1,122 @@
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stm32f3xx_hal.h>
+
+#include "Io_PedalLatency.h"
+#include "Io_SharedCan.h"
+#include "Io_SharedCycleCounter.h"
+#include "App_CanMsgs.h"
+#include "App_SharedLatencyHistogram.h"
+
+// The sample times of the FSM_PEDAL_POSITION messages waiting in the CAN TX
+// queue, oldest first. This must hold more samples than the CAN TX queue can
+// hold messages.
+#define MAX_PENDING_SAMPLES 32U
+
+static struct LatencyHistogram *_latency_histogram = NULL;
+
+// The cycle count at which the accelerator pedal encoders were last sampled
+static volatile uint32_t last_sample_cycles;
+
+// A single-producer single-consumer ring: the enqueuing and discarded
+// callbacks only write the write index, and the dequeued callback only writes
+// the read index. The sample time is pushed before its message is enqueued, so
+// the CAN TX task always finds it when it dequeues the message.
+static volatile uint32_t pending_sample_cycles[MAX_PENDING_SAMPLES];
+static volatile uint32_t pending_samples_write_index;
+static volatile uint32_t pending_samples_read_index;
+
+// Whether the sample time of the message being enqueued was pushed. This is
+// only written by the enqueuing callback and read by the discarded callback,
+// which both run in the context that enqueues the message. That is only ever
+// the 1kHz task, as FSM_PEDAL_POSITION is a periodic message, so this relies
+// on there being a single producer and isn't guarded.
+static volatile bool is_sample_pushed;
+
+/**
+ * Push the sample time of a CAN message that is about to be sent to the CAN TX
+ * queue
+ * @param message The CAN message that is about to be sent to the CAN TX queue
+ */
+static void Io_TxMessageEnqueuingCallback(const struct CanMsg *message);
+
+/**
+ * Pop the sample time of a CAN message that was discarded because the CAN TX
+ * queue is full
+ * @param message The CAN message that was discarded
+ */
+static void Io_TxMessageDiscardedCallback(const struct CanMsg *message);
+
+/**
+ * Record the latency of a CAN message that was added to a CAN TX mailbox
+ * @param message The CAN message that was added to a CAN TX mailbox
+ */
+static void Io_TxMessageDequeuedCallback(const struct CanMsg *message);
+
+static void Io_TxMessageEnqueuingCallback(const struct CanMsg *const message)
+{
+    if (message->std_id != CANMSGS_FSM_PEDAL_POSITION_FRAME_ID)
+    {
+        return;
+    }
+
+    const uint32_t next_write_index =
+        (pending_samples_write_index + 1U) % MAX_PENDING_SAMPLES;
+
+    is_sample_pushed = next_write_index != pending_samples_read_index;
+
+    if (is_sample_pushed)
+    {
+        pending_sample_cycles[pending_samples_write_index] = last_sample_cycles;
+        pending_samples_write_index                        = next_write_index;
+    }
+}
+
+static void Io_TxMessageDiscardedCallback(const struct CanMsg *const message)
+{
+    if (message->std_id != CANMSGS_FSM_PEDAL_POSITION_FRAME_ID ||
+        !is_sample_pushed)
+    {
+        return;
+    }
+
+    // The discarded message never reaches the CAN TX task, so nothing pops
+    // the newest sample time but us
+    pending_samples_write_index =
+        (pending_samples_write_index + MAX_PENDING_SAMPLES - 1U) %
+        MAX_PENDING_SAMPLES;
+}
+
+static void Io_TxMessageDequeuedCallback(const struct CanMsg *const message)
+{
+    if (message->std_id != CANMSGS_FSM_PEDAL_POSITION_FRAME_ID ||
+        pending_samples_read_index == pending_samples_write_index)
+    {
+        return;
+    }
+
+    const uint32_t elapsed_cycles =
+        Io_SharedCycleCounter_GetCycleCount() -
+        pending_sample_cycles[pending_samples_read_index];
+    pending_samples_read_index =
+        (pending_samples_read_index + 1U) % MAX_PENDING_SAMPLES;
+
+    App_SharedLatencyHistogram_Record(
+        _latency_histogram, elapsed_cycles / (SystemCoreClock / 1000000U));
+}
+
+void Io_PedalLatency_Init(struct LatencyHistogram *const latency_histogram)
+{
+    assert(latency_histogram != NULL);
+    _latency_histogram = latency_histogram;
+
+    Io_SharedCan_SetTxMessageCallbacks(
+        Io_TxMessageEnqueuingCallback, Io_TxMessageDiscardedCallback,
+        Io_TxMessageDequeuedCallback);
+}
+
+void Io_PedalLatency_MarkEncoderSample(void)
+{
+    last_sample_cycles = Io_SharedCycleCounter_GetCycleCount();
+}
@@ -8,5 +8,5 @@ float Io_SteeringAngleSensor_GetAngleDegree(void)
     const float STEERING_ANGLE_VOLTAGE_OFFSET = 1.9f;
     const float DEGREE_PER_VOLT               = 360.0f / 3.3f;
     return DEGREE_PER_VOLT *
-           (Io_Adc_GetChannel1Voltage() - STEERING_ANGLE_VOLTAGE_OFFSET);
+           (Io_Adc_GetChannel1Output().voltage - STEERING_ANGLE_VOLTAGE_OFFSET);
 }
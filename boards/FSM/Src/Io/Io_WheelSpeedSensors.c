@@ -1,18 +1,78 @@
 #include <assert.h>
 #include <math.h>
 #include "Io_WheelSpeedSensors.h"
-#include "Io_SharedFreqOnlyPwmInput.h"
+#include "Io_SharedDmaInputCapture.h"
+#include "App_WheelSpeedEstimator.h"
 #include "main.h"
 
 // Note: Unit for length is measured in metres unless specified
-static const float  MPS_TO_KPH_CONVERSION_FACTOR = 3.6f;
-static const size_t RELUCTOR_RING_TOOTH_COUNT    = 48;
-static const float  TIRE_DIAMETER                = 0.4572f;
+static const size_t RELUCTOR_RING_TOOTH_COUNT = 48;
+static const float  TIRE_DIAMETER             = 0.4572f;
 static const float  ARC_LENGTH_PER_RELUCTOR_TOOTH =
     (float)(((float)M_PI * TIRE_DIAMETER) / (float)RELUCTOR_RING_TOOTH_COUNT);
 
-static struct FreqOnlyPwmInput *left_wheel_speed_sensor,
-    *right_wheel_speed_sensor;
+// At 150km/h, a reluctor tooth passes every 0.7ms, so this holds the rising
+// edges of several task periods between two updates
+#define WHEEL_SPEED_MAX_CAPTURES 64U
+
+struct WheelSpeedSensor
+{
+    struct DmaInputCapture *    dma_input_capture;
+    struct WheelSpeedEstimator *wheel_speed_estimator;
+};
+
+static struct WheelSpeedSensor left_wheel_speed_sensor,
+    right_wheel_speed_sensor;
+
+/**
+ * Initialize the given wheel speed sensor
+ * @param wheel_speed_sensor The wheel speed sensor to initialize
+ * @param htim The handle of the timer capturing the wheel speed sensor
+ * @param timer_frequency_hz The frequency of the timer
+ * @param timer_auto_reload_reg The auto-reload register of the timer
+ */
+static void Io_InitWheelSpeedSensor(
+    struct WheelSpeedSensor *wheel_speed_sensor,
+    TIM_HandleTypeDef *      htim,
+    float                    timer_frequency_hz,
+    uint32_t                 timer_auto_reload_reg);
+
+/**
+ * Update the wheel speed estimator of the given wheel speed sensor with the
+ * rising edges captured since the last update
+ * @param wheel_speed_sensor The wheel speed sensor to update
+ * @param current_time_ms The current time, in ms
+ */
+static void Io_UpdateWheelSpeedSensor(
+    struct WheelSpeedSensor *wheel_speed_sensor,
+    uint32_t                 current_time_ms);
+
+static void Io_InitWheelSpeedSensor(
+    struct WheelSpeedSensor *const wheel_speed_sensor,
+    TIM_HandleTypeDef *const       htim,
+    const float                    timer_frequency_hz,
+    const uint32_t                 timer_auto_reload_reg)
+{
+    wheel_speed_sensor->dma_input_capture = Io_SharedDmaInputCapture_Create(
+        htim, TIM_CHANNEL_1, 1U, WHEEL_SPEED_MAX_CAPTURES);
+    wheel_speed_sensor->wheel_speed_estimator = App_WheelSpeedEstimator_Create(
+        timer_frequency_hz, timer_auto_reload_reg + 1U,
+        ARC_LENGTH_PER_RELUCTOR_TOOTH);
+}
+
+static void Io_UpdateWheelSpeedSensor(
+    struct WheelSpeedSensor *const wheel_speed_sensor,
+    const uint32_t                 current_time_ms)
+{
+    uint32_t       captures[WHEEL_SPEED_MAX_CAPTURES];
+    const uint32_t num_captures = Io_SharedDmaInputCapture_Read(
+        wheel_speed_sensor->dma_input_capture, captures,
+        WHEEL_SPEED_MAX_CAPTURES);
+
+    App_WheelSpeedEstimator_Update(
+        wheel_speed_sensor->wheel_speed_estimator, captures, num_captures,
+        current_time_ms);
+}
 
 void Io_WheelSpeedSensors_Init(
     TIM_HandleTypeDef *htim_left_wheel_speed_sensor,
@@ -21,53 +81,42 @@ void Io_WheelSpeedSensors_Init(
     assert(htim_left_wheel_speed_sensor != NULL);
     assert(htim_right_wheel_speed_sensor != NULL);
 
-    left_wheel_speed_sensor = Io_SharedFreqOnlyPwmInput_Create(
-        htim_left_wheel_speed_sensor, TIMx_FREQUENCY / TIM16_PRESCALER,
-        TIM_CHANNEL_1, TIM16_AUTO_RELOAD_REG, HAL_TIM_ACTIVE_CHANNEL_1);
-
-    right_wheel_speed_sensor = Io_SharedFreqOnlyPwmInput_Create(
-        htim_right_wheel_speed_sensor, TIMx_FREQUENCY / TIM17_PRESCALER,
-        TIM_CHANNEL_1, TIM17_AUTO_RELOAD_REG, HAL_TIM_ACTIVE_CHANNEL_1);
+    Io_InitWheelSpeedSensor(
+        &left_wheel_speed_sensor, htim_left_wheel_speed_sensor,
+        TIMx_FREQUENCY / TIM16_PRESCALER, TIM16_AUTO_RELOAD_REG);
+    Io_InitWheelSpeedSensor(
+        &right_wheel_speed_sensor, htim_right_wheel_speed_sensor,
+        TIMx_FREQUENCY / TIM17_PRESCALER, TIM17_AUTO_RELOAD_REG);
 }
 
-float Io_WheelSpeedSensors_GetLeftSpeedKph(void)
+void Io_WheelSpeedSensors_Update(void)
 {
-    return MPS_TO_KPH_CONVERSION_FACTOR * ARC_LENGTH_PER_RELUCTOR_TOOTH *
-           Io_SharedFreqOnlyPwmInput_GetFrequency(left_wheel_speed_sensor);
+    const uint32_t current_time_ms = HAL_GetTick();
+
+    Io_UpdateWheelSpeedSensor(&left_wheel_speed_sensor, current_time_ms);
+    Io_UpdateWheelSpeedSensor(&right_wheel_speed_sensor, current_time_ms);
 }
 
-float Io_WheelSpeedSensors_GetRightSpeedKph(void)
+float Io_WheelSpeedSensors_GetLeftSpeedKph(void)
 {
-    return MPS_TO_KPH_CONVERSION_FACTOR * ARC_LENGTH_PER_RELUCTOR_TOOTH *
-           Io_SharedFreqOnlyPwmInput_GetFrequency(right_wheel_speed_sensor);
+    return App_WheelSpeedEstimator_GetSpeedKph(
+        left_wheel_speed_sensor.wheel_speed_estimator);
 }
 
-void Io_WheelSpeedSensors_InputCaptureCallback(TIM_HandleTypeDef *htim)
+float Io_WheelSpeedSensors_GetRightSpeedKph(void)
 {
-    if (htim ==
-            Io_SharedFreqOnlyPwmInput_GetTimerHandle(left_wheel_speed_sensor) &&
-        htim->Channel == Io_SharedFreqOnlyPwmInput_GetTimerActiveChannel(
-                             left_wheel_speed_sensor))
-    {
-        Io_SharedFreqOnlyPwmInput_Tick(left_wheel_speed_sensor);
-    }
-
-    else if (
-        htim == Io_SharedFreqOnlyPwmInput_GetTimerHandle(
-                    right_wheel_speed_sensor) &&
-        htim->Channel == Io_SharedFreqOnlyPwmInput_GetTimerActiveChannel(
-                             right_wheel_speed_sensor))
-    {
-        Io_SharedFreqOnlyPwmInput_Tick(right_wheel_speed_sensor);
-    }
+    return App_WheelSpeedEstimator_GetSpeedKph(
+        right_wheel_speed_sensor.wheel_speed_estimator);
 }
 
-void Io_WheelSpeedSensors_CheckIfRightSensorIsActive(void)
+float Io_WheelSpeedSensors_GetLeftAccelerationMps2(void)
 {
-    Io_SharedFreqOnlyPwmInput_CheckIfPwmIsActive(right_wheel_speed_sensor);
+    return App_WheelSpeedEstimator_GetAccelerationMps2(
+        left_wheel_speed_sensor.wheel_speed_estimator);
 }
 
-void Io_WheelSpeedSensors_CheckIfLeftSensorIsActive(void)
+float Io_WheelSpeedSensors_GetRightAccelerationMps2(void)
 {
-    Io_SharedFreqOnlyPwmInput_CheckIfPwmIsActive(left_wheel_speed_sensor);
+    return App_WheelSpeedEstimator_GetAccelerationMps2(
+        right_wheel_speed_sensor.wheel_speed_estimator);
 }
@@ -31,12 +31,14 @@
 #include "Io_SharedSoftwareWatchdog.h"
 #include "Io_SharedCan.h"
 #include "Io_SharedHardFaultHandler.h"
+#include "Io_SharedCycleCounter.h"
 #include "Io_StackWaterMark.h"
 #include "Io_SoftwareWatchdog.h"
 #include "Io_FlowMeters.h"
 #include "Io_HeartbeatMonitor.h"
 #include "Io_RgbLedSequence.h"
 #include "Io_WheelSpeedSensors.h"
+#include "Io_PedalLatency.h"
 #include "Io_SteeringAngleSensor.h"
 #include "Io_MSP3002K5P3N1.h"
 #include "Io_Adc.h"
@@ -49,6 +51,7 @@
 #include "App_SharedStateMachine.h"
 #include "App_AcceleratorPedalSignals.h"
 #include "App_FlowMeterSignals.h"
+#include "App_WheelDynamics.h"
 #include "states/App_AirOpenState.h"
 #include "configs/App_HeartbeatMonitorConfig.h"
 #include "configs/App_FlowRateThresholds.h"
@@ -56,6 +59,7 @@
 #include "configs/App_SteeringAngleThresholds.h"
 #include "configs/App_BrakePressureThresholds.h"
 #include "configs/App_AcceleratorPedalThresholds.h"
+#include "configs/App_PedalLatencyHistogramConfig.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -76,6 +80,10 @@
 /* Private variables ---------------------------------------------------------*/
 ADC_HandleTypeDef hadc2;
 DMA_HandleTypeDef hdma_adc2;
+DMA_HandleTypeDef hdma_tim4_ch1;
+DMA_HandleTypeDef hdma_tim4_ch2;
+DMA_HandleTypeDef hdma_tim16_ch1_up;
+DMA_HandleTypeDef hdma_tim17_ch1_up;
 
 CAN_HandleTypeDef hcan;
 
@@ -118,6 +126,8 @@ struct HeartbeatMonitor * heartbeat_monitor;
 struct RgbLedSequence *   rgb_led_sequence;
 struct Clock *            clock;
 struct AcceleratorPedals *papps_and_sapps;
+struct WheelDynamics *    wheel_dynamics;
+struct LatencyHistogram * pedal_latency_histogram;
 /* USER CODE END PV */
 
 /* Private function prototypes -----------------------------------------------*/
@@ -204,12 +214,11 @@ int main(void)
     /* USER CODE BEGIN 2 */
     __HAL_DBGMCU_FREEZE_IWDG();
 
-    HAL_ADC_Start_DMA(
-        &hadc2, (uint32_t *)Io_Adc_GetRawAdcValues(),
-        hadc2.Init.NbrOfConversion);
+    Io_Adc_Init(&hadc2);
     HAL_TIM_Base_Start(&htim3);
 
     Io_SharedHardFaultHandler_Init();
+    Io_SharedCycleCounter_Init();
 
     Io_FlowMeters_Init(&htim4);
     primary_flow_meter_in_range_check = App_InRangeCheck_Create(
@@ -226,6 +235,11 @@ int main(void)
     right_wheel_speed_sensor_in_range_check = App_InRangeCheck_Create(
         Io_WheelSpeedSensors_GetRightSpeedKph, MIN_RIGHT_WHEEL_SPEED_KPH,
         MAX_RIGHT_WHEEL_SPEED_KPH);
+    wheel_dynamics = App_WheelDynamics_Create(
+        Io_WheelSpeedSensors_GetLeftSpeedKph,
+        Io_WheelSpeedSensors_GetRightSpeedKph,
+        Io_WheelSpeedSensors_GetLeftAccelerationMps2,
+        Io_WheelSpeedSensors_GetRightAccelerationMps2);
 
     steering_angle_sensor_in_range_check = App_InRangeCheck_Create(
         Io_SteeringAngleSensor_GetAngleDegree, MIN_STEERING_ANGLE_DEG,
@@ -261,7 +275,12 @@ int main(void)
         Io_SecondaryScancon2RMHF_GetEncoderCounter,
         Io_PrimaryScancon2RMHF_ResetEncoderCounter,
         Io_SecondaryScancon2RMHF_ResetEncoderCounter,
-        PAPPS_ENCODER_FULLY_PRESSED_VALUE, SAPPS_ENCODER_FULLY_PRESSED_VALUE);
+        Io_SharedCycleCounter_GetCycleCount, PAPPS_ENCODER_FULLY_PRESSED_VALUE,
+        SAPPS_ENCODER_FULLY_PRESSED_VALUE);
+
+    pedal_latency_histogram = App_SharedLatencyHistogram_Create(
+        PEDAL_LATENCY_HISTOGRAM_BIN_WIDTH_US, PEDAL_LATENCY_HISTOGRAM_NUM_BINS);
+    Io_PedalLatency_Init(pedal_latency_histogram);
 
     world = App_FsmWorld_Create(
         can_tx, can_rx, heartbeat_monitor, primary_flow_meter_in_range_check,
@@ -269,7 +288,7 @@ int main(void)
         left_wheel_speed_sensor_in_range_check,
         right_wheel_speed_sensor_in_range_check,
         steering_angle_sensor_in_range_check, brake, rgb_led_sequence, clock,
-        papps_and_sapps,
+        papps_and_sapps, wheel_dynamics, pedal_latency_histogram,
 
         App_AcceleratorPedalSignals_HasAppsAndBrakePlausibilityFailure,
         App_AcceleratorPedalSignals_IsAppsAndBrakePlausibilityOk,
@@ -826,8 +845,21 @@ static void MX_DMA_Init(void)
 {
     /* DMA controller clock enable */
     __HAL_RCC_DMA2_CLK_ENABLE();
+    __HAL_RCC_DMA1_CLK_ENABLE();
 
     /* DMA interrupt init */
+    /* DMA1_Channel1_IRQn interrupt configuration */
+    HAL_NVIC_SetPriority(DMA1_Channel1_IRQn, 5, 0);
+    HAL_NVIC_EnableIRQ(DMA1_Channel1_IRQn);
+    /* DMA1_Channel3_IRQn interrupt configuration */
+    HAL_NVIC_SetPriority(DMA1_Channel3_IRQn, 5, 0);
+    HAL_NVIC_EnableIRQ(DMA1_Channel3_IRQn);
+    /* DMA1_Channel4_IRQn interrupt configuration */
+    HAL_NVIC_SetPriority(DMA1_Channel4_IRQn, 5, 0);
+    HAL_NVIC_EnableIRQ(DMA1_Channel4_IRQn);
+    /* DMA1_Channel7_IRQn interrupt configuration */
+    HAL_NVIC_SetPriority(DMA1_Channel7_IRQn, 5, 0);
+    HAL_NVIC_EnableIRQ(DMA1_Channel7_IRQn);
     /* DMA2_Channel1_IRQn interrupt configuration */
     HAL_NVIC_SetPriority(DMA2_Channel1_IRQn, 5, 0);
     HAL_NVIC_EnableIRQ(DMA2_Channel1_IRQn);
@@ -959,6 +991,9 @@ void RunTask1kHz(void const *argument)
         const uint32_t current_time_ms = osKernelSysTick() * portTICK_PERIOD_MS;
 
         App_SharedClock_SetCurrentTimeInMilliseconds(clock, current_time_ms);
+        Io_WheelSpeedSensors_Update();
+        Io_PedalLatency_MarkEncoderSample();
+        App_SharedStateMachine_Tick1kHz(state_machine);
         App_FsmWorld_UpdateSignals(world, current_time_ms);
         Io_CanTx_EnqueuePeriodicMsgs(can_tx, current_time_ms);
 
@@ -1053,19 +1088,7 @@ void RunTask100Hz(void const *argument)
 void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
 {
     /* USER CODE BEGIN Callback 0 */
-    if (htim->Instance == TIM4)
-    {
-        Io_FlowMeters_CheckIfPrimaryIsActive();
-        Io_FlowMeters_CheckIfSecondaryIsActive();
-    }
-    else if (htim->Instance == TIM16)
-    {
-        Io_WheelSpeedSensors_CheckIfLeftSensorIsActive();
-    }
-    else if (htim->Instance == TIM17)
-    {
-        Io_WheelSpeedSensors_CheckIfRightSensorIsActive();
-    }
+
     /* USER CODE END Callback 0 */
     if (htim->Instance == TIM6)
     {
@@ -3,6 +3,7 @@
 extern "C"
 {
 #include "App_AcceleratorPedals.h"
+#include "configs/App_PedalCurves.h"
 }
 
 FAKE_VALUE_FUNC(bool, is_primary_encoder_alarm_active);
@@ -11,6 +12,7 @@ FAKE_VALUE_FUNC(uint32_t, get_primary_encoder_counter);
 FAKE_VALUE_FUNC(bool, is_secondary_encoder_alarm_active);
 FAKE_VOID_FUNC(reset_secondary_encoder_counter);
 FAKE_VALUE_FUNC(uint32_t, get_secondary_encoder_counter);
+FAKE_VALUE_FUNC(uint32_t, get_accelerator_pedals_cycle_count);
 
 class AcceleratorPedalTest : public testing::Test
 {
@@ -25,14 +27,15 @@ class AcceleratorPedalTest : public testing::Test
         accelerator_pedal_pair = App_AcceleratorPedals_Create(
             is_primary_encoder_alarm_active, is_secondary_encoder_alarm_active,
             get_primary_encoder_counter, get_secondary_encoder_counter,
-            reset_primary_encoder_counter, reset_secondary_encoder_counter, 0U,
-            0U);
+            reset_primary_encoder_counter, reset_secondary_encoder_counter,
+            get_accelerator_pedals_cycle_count, 0U, 0U);
         RESET_FAKE(is_primary_encoder_alarm_active);
         RESET_FAKE(reset_primary_encoder_counter);
         RESET_FAKE(get_primary_encoder_counter);
         RESET_FAKE(is_secondary_encoder_alarm_active);
         RESET_FAKE(reset_secondary_encoder_counter);
         RESET_FAKE(get_secondary_encoder_counter);
+        RESET_FAKE(get_accelerator_pedals_cycle_count);
     }
 
     void TearDown() override
@@ -70,3 +73,65 @@ TEST_F(AcceleratorPedalTest, inactive_secondary_alarm)
     ASSERT_FALSE(App_AcceleratorPedals_IsSecondaryEncoderAlarmActive(
         accelerator_pedal_pair));
 }
+
+TEST_F(AcceleratorPedalTest, pedal_curve_can_be_selected)
+{
+    ASSERT_EQ(0U, App_AcceleratorPedals_GetPedalCurve(accelerator_pedal_pair));
+
+    App_AcceleratorPedals_SetPedalCurve(accelerator_pedal_pair, 2U);
+    ASSERT_EQ(2U, App_AcceleratorPedals_GetPedalCurve(accelerator_pedal_pair));
+}
+
+TEST_F(AcceleratorPedalTest, mapped_pedal_percentage_resets_underflowed_encoder)
+{
+    get_primary_encoder_counter_fake.return_val = 1U;
+    App_AcceleratorPedals_Tick(accelerator_pedal_pair);
+    ASSERT_EQ(
+        0.0f,
+        App_AcceleratorPedals_GetMappedPedalPercentage(accelerator_pedal_pair));
+    ASSERT_EQ(1U, reset_primary_encoder_counter_fake.call_count);
+}
+
+TEST_F(AcceleratorPedalTest, encoders_are_read_once_per_tick)
+{
+    App_AcceleratorPedals_Tick(accelerator_pedal_pair);
+    App_AcceleratorPedals_GetPrimaryPedalPercentage(accelerator_pedal_pair);
+    App_AcceleratorPedals_GetSecondaryPedalPercentage(accelerator_pedal_pair);
+    App_AcceleratorPedals_GetMappedPedalPercentage(accelerator_pedal_pair);
+
+    ASSERT_EQ(1U, get_primary_encoder_counter_fake.call_count);
+    ASSERT_EQ(1U, get_secondary_encoder_counter_fake.call_count);
+}
+
+TEST_F(AcceleratorPedalTest, pedal_curve_cannot_change_until_blended)
+{
+    App_AcceleratorPedals_SetPedalCurve(accelerator_pedal_pair, 2U);
+    App_AcceleratorPedals_SetPedalCurve(accelerator_pedal_pair, 3U);
+    ASSERT_EQ(2U, App_AcceleratorPedals_GetPedalCurve(accelerator_pedal_pair));
+
+    for (uint32_t i = 0U; i < PEDAL_CURVE_BLEND_TICKS; i++)
+    {
+        App_AcceleratorPedals_Tick(accelerator_pedal_pair);
+    }
+
+    App_AcceleratorPedals_SetPedalCurve(accelerator_pedal_pair, 3U);
+    ASSERT_EQ(3U, App_AcceleratorPedals_GetPedalCurve(accelerator_pedal_pair));
+}
+
+TEST_F(AcceleratorPedalTest, max_pedal_map_cycles_are_taken_and_reset)
+{
+    static uint32_t cycle_count;
+    cycle_count                                         = 0U;
+    get_accelerator_pedals_cycle_count_fake.custom_fake = []() {
+        return cycle_count += 100U;
+    };
+
+    App_AcceleratorPedals_Tick(accelerator_pedal_pair);
+
+    ASSERT_EQ(
+        100U,
+        App_AcceleratorPedals_TakeMaxPedalMapCycles(accelerator_pedal_pair));
+    ASSERT_EQ(
+        0U,
+        App_AcceleratorPedals_TakeMaxPedalMapCycles(accelerator_pedal_pair));
+}
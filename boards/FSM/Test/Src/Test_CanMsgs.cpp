@@ -29,3 +29,18 @@ TEST(CanMsgsTest, flow_meter_message_frequency)
     // This includes the primary and secondary flow meter
     ASSERT_GE(HZ_TO_MS(1), CANMSGS_FSM_FLOW_METER_CYCLE_TIME_MS);
 }
+
+TEST(CanMsgsTest, wheel_dynamics_message_frequency)
+{
+    // The wheel dynamics are updated every 1kHz tick, but only sent at up to
+    // 200Hz to keep their 8-byte frame from taking a quarter of the bus
+    ASSERT_GE(HZ_TO_MS(100), CANMSGS_FSM_WHEEL_DYNAMICS_CYCLE_TIME_MS);
+    ASSERT_LE(HZ_TO_MS(200), CANMSGS_FSM_WHEEL_DYNAMICS_CYCLE_TIME_MS);
+}
+
+TEST(CanMsgsTest, pedal_position_message_frequency)
+{
+    // The mapped pedal percentage is enqueued in the same 1kHz tick that the
+    // accelerator pedal encoders are sampled in
+    ASSERT_GE(HZ_TO_MS(1000), CANMSGS_FSM_PEDAL_POSITION_CYCLE_TIME_MS);
+}
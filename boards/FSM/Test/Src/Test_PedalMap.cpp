@@ -0,0 +1,157 @@
+#include "Test_Fsm.h"
+
+extern "C"
+{
+#include "App_PedalMap.h"
+#include "configs/App_PedalCurves.h"
+}
+
+class PedalMapTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        pedal_map = App_PedalMap_Create(900U, linear_pedal_curve);
+    }
+
+    void TearDown() override
+    {
+        TearDownObject(pedal_map, App_PedalMap_Destroy);
+    }
+
+    // The pedal percentage computed in float with a linear map between the
+    // deadzones, as the accelerator pedals were mapped before the pedal map
+    static float GetLinearPedalPercentage(
+        uint32_t encoder_fully_pressed_value,
+        uint32_t encoder_counter_value)
+    {
+        const float percent_deflection = 0.03f;
+        const float low_end_deadzone_threshold =
+            (float)encoder_fully_pressed_value * percent_deflection;
+        const float high_end_deadzone_threshold =
+            (float)encoder_fully_pressed_value * (1.0f - percent_deflection);
+
+        if (encoder_counter_value > encoder_fully_pressed_value)
+        {
+            return 0.0f;
+        }
+        else if (encoder_counter_value <= low_end_deadzone_threshold)
+        {
+            return 0.0f;
+        }
+        else if (encoder_counter_value >= high_end_deadzone_threshold)
+        {
+            return 100.0f;
+        }
+
+        return 100.0f *
+               ((float)encoder_counter_value - low_end_deadzone_threshold) /
+               (high_end_deadzone_threshold - low_end_deadzone_threshold);
+    }
+
+    float GetPedalPercentage(uint32_t encoder_counter_value)
+    {
+        return (float)App_PedalMap_MapEncoderCounterValue(
+                   pedal_map, encoder_counter_value) *
+               100.0f / (float)PEDAL_MAP_FULL_SCALE;
+    }
+
+    const uint8_t linear_pedal_curve[PEDAL_MAP_NUM_CURVE_POINTS] =
+        LINEAR_PEDAL_CURVE;
+    const uint8_t pedal_curves[NUM_PEDAL_CURVES][PEDAL_MAP_NUM_CURVE_POINTS] =
+        PEDAL_CURVES;
+
+    struct PedalMap *pedal_map;
+};
+
+TEST_F(PedalMapTest, linear_pedal_curve_is_equivalent_to_linear_mapping)
+{
+    for (const uint32_t encoder_fully_pressed_value :
+         { 0U, 1U, 33U, 450U, 900U, 1000U, 4095U, 65535U })
+    {
+        App_PedalMap_SetEncoderFullyPressedValue(
+            pedal_map, encoder_fully_pressed_value);
+
+        for (uint32_t encoder_counter_value = 0U;
+             encoder_counter_value <= encoder_fully_pressed_value + 1U;
+             encoder_counter_value++)
+        {
+            ASSERT_NEAR(
+                GetLinearPedalPercentage(
+                    encoder_fully_pressed_value, encoder_counter_value),
+                GetPedalPercentage(encoder_counter_value), 0.002f);
+        }
+    }
+}
+
+TEST_F(PedalMapTest, deadzones_map_to_exactly_0_and_100_percent)
+{
+    for (uint32_t pedal_curve = 0U; pedal_curve < NUM_PEDAL_CURVES;
+         pedal_curve++)
+    {
+        App_PedalMap_SetPedalCurve(pedal_map, pedal_curves[pedal_curve]);
+
+        ASSERT_EQ(0U, App_PedalMap_MapEncoderCounterValue(pedal_map, 0U));
+        ASSERT_EQ(0U, App_PedalMap_MapEncoderCounterValue(pedal_map, 27U));
+        ASSERT_LT(0U, App_PedalMap_MapEncoderCounterValue(pedal_map, 28U));
+        ASSERT_GT(
+            PEDAL_MAP_FULL_SCALE,
+            App_PedalMap_MapEncoderCounterValue(pedal_map, 872U));
+        ASSERT_EQ(
+            PEDAL_MAP_FULL_SCALE,
+            App_PedalMap_MapEncoderCounterValue(pedal_map, 873U));
+        ASSERT_EQ(
+            PEDAL_MAP_FULL_SCALE,
+            App_PedalMap_MapEncoderCounterValue(pedal_map, 900U));
+
+        // An underflow of the encoder counter
+        ASSERT_EQ(0U, App_PedalMap_MapEncoderCounterValue(pedal_map, 901U));
+    }
+}
+
+TEST_F(PedalMapTest, pedal_curves_never_decrease_and_follow_their_points)
+{
+    for (uint32_t pedal_curve = 0U; pedal_curve < NUM_PEDAL_CURVES;
+         pedal_curve++)
+    {
+        App_PedalMap_SetPedalCurve(pedal_map, pedal_curves[pedal_curve]);
+
+        uint32_t previous_value = 0U;
+        for (uint32_t encoder_counter_value = 0U; encoder_counter_value <= 900U;
+             encoder_counter_value++)
+        {
+            const uint32_t value = App_PedalMap_MapEncoderCounterValue(
+                pedal_map, encoder_counter_value);
+            ASSERT_GE(value, previous_value);
+            previous_value = value;
+        }
+
+        // 27 + 84.6 encoder counts per 10% of pedal travel
+        for (uint32_t i = 0U; i < PEDAL_MAP_NUM_CURVE_POINTS; i++)
+        {
+            const uint32_t encoder_counter_value =
+                (2700U + i * 8460U + 50U) / 100U;
+            ASSERT_NEAR(
+                pedal_curves[pedal_curve][i],
+                GetPedalPercentage(encoder_counter_value), 1.0f);
+        }
+    }
+}
+
+TEST_F(PedalMapTest, pedal_curve_is_tabulated_again_after_recalibration)
+{
+    const uint8_t quadratic_pedal_curve[PEDAL_MAP_NUM_CURVE_POINTS] =
+        QUADRATIC_PEDAL_CURVE;
+    App_PedalMap_SetPedalCurve(pedal_map, quadratic_pedal_curve);
+
+    // Half pedal travel is a quarter of the mapped pedal percentage. The table
+    // cuts the corners of the pedal curve slightly at its points.
+    ASSERT_EQ(900U, App_PedalMap_GetEncoderFullyPressedValue(pedal_map));
+    ASSERT_NEAR(25.0f, GetPedalPercentage(450U), 0.5f);
+
+    App_PedalMap_SetEncoderFullyPressedValue(pedal_map, 450U);
+    ASSERT_EQ(450U, App_PedalMap_GetEncoderFullyPressedValue(pedal_map));
+    ASSERT_NEAR(25.0f, GetPedalPercentage(225U), 0.5f);
+    ASSERT_EQ(100.0f, GetPedalPercentage(450U));
+    ASSERT_EQ(0.0f, GetPedalPercentage(451U));
+}
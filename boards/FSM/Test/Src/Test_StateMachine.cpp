@@ -19,6 +19,8 @@ extern "C"
 #include "configs/App_BrakePressureThresholds.h"
 #include "configs/App_AcceleratorPedalThresholds.h"
 #include "configs/App_SignalCallbackDurations.h"
+#include "configs/App_PedalLatencyHistogramConfig.h"
+#include "configs/App_PedalCurves.h"
 }
 
 namespace StateMachineTest
@@ -45,6 +47,8 @@ FAKE_VOID_FUNC(turn_on_green_led);
 FAKE_VOID_FUNC(turn_on_blue_led);
 FAKE_VALUE_FUNC(float, get_left_wheel_speed);
 FAKE_VALUE_FUNC(float, get_right_wheel_speed);
+FAKE_VALUE_FUNC(float, get_left_wheel_acceleration);
+FAKE_VALUE_FUNC(float, get_right_wheel_acceleration);
 FAKE_VALUE_FUNC(float, get_steering_angle);
 FAKE_VALUE_FUNC(float, get_brake_pressure);
 FAKE_VALUE_FUNC(bool, is_brake_actuated);
@@ -55,6 +59,7 @@ FAKE_VOID_FUNC(reset_papps_encoder_counter);
 FAKE_VALUE_FUNC(uint32_t, get_papps_encoder_counter);
 FAKE_VOID_FUNC(reset_sapps_encoder_counter);
 FAKE_VALUE_FUNC(uint32_t, get_sapps_encoder_counter);
+FAKE_VALUE_FUNC(uint32_t, get_cycle_count);
 
 class FsmStateMachineTest : public BaseStateMachineTest
 {
@@ -106,15 +111,24 @@ class FsmStateMachineTest : public BaseStateMachineTest
             is_papps_encoder_alarm_active, is_sapps_encoder_alarm_active,
             get_papps_encoder_counter, get_sapps_encoder_counter,
             reset_papps_encoder_counter, reset_sapps_encoder_counter,
-            PAPPS_ENCODER_FULLY_PRESSED_VALUE,
+            get_cycle_count, PAPPS_ENCODER_FULLY_PRESSED_VALUE,
             SAPPS_ENCODER_FULLY_PRESSED_VALUE);
 
+        wheel_dynamics = App_WheelDynamics_Create(
+            get_left_wheel_speed, get_right_wheel_speed,
+            get_left_wheel_acceleration, get_right_wheel_acceleration);
+
+        pedal_latency_histogram = App_SharedLatencyHistogram_Create(
+            PEDAL_LATENCY_HISTOGRAM_BIN_WIDTH_US,
+            PEDAL_LATENCY_HISTOGRAM_NUM_BINS);
+
         world = App_FsmWorld_Create(
             can_tx_interface, can_rx_interface, heartbeat_monitor,
             primary_flow_rate_in_range_check,
             secondary_flow_rate_in_range_check, left_wheel_speed_in_range_check,
             right_wheel_speed_in_range_check, steering_angle_in_range_check,
-            brake, rgb_led_sequence, clock, papps_and_sapps,
+            brake, rgb_led_sequence, clock, papps_and_sapps, wheel_dynamics,
+            pedal_latency_histogram,
 
             App_AcceleratorPedalSignals_HasAppsAndBrakePlausibilityFailure,
             App_AcceleratorPedalSignals_IsAppsAndBrakePlausibilityOk,
@@ -152,6 +166,8 @@ class FsmStateMachineTest : public BaseStateMachineTest
         RESET_FAKE(turn_on_blue_led);
         RESET_FAKE(get_left_wheel_speed);
         RESET_FAKE(get_right_wheel_speed);
+        RESET_FAKE(get_left_wheel_acceleration);
+        RESET_FAKE(get_right_wheel_acceleration);
         RESET_FAKE(get_steering_angle);
         RESET_FAKE(get_brake_pressure);
         RESET_FAKE(is_brake_actuated);
@@ -162,6 +178,7 @@ class FsmStateMachineTest : public BaseStateMachineTest
         RESET_FAKE(get_papps_encoder_counter);
         RESET_FAKE(reset_sapps_encoder_counter);
         RESET_FAKE(get_sapps_encoder_counter);
+        RESET_FAKE(get_cycle_count);
     }
 
     void TearDown() override
@@ -184,6 +201,9 @@ class FsmStateMachineTest : public BaseStateMachineTest
         TearDownObject(rgb_led_sequence, App_SharedRgbLedSequence_Destroy);
         TearDownObject(clock, App_SharedClock_Destroy);
         TearDownObject(papps_and_sapps, App_AcceleratorPedals_Destroy);
+        TearDownObject(wheel_dynamics, App_WheelDynamics_Destroy);
+        TearDownObject(
+            pedal_latency_histogram, App_SharedLatencyHistogram_Destroy);
     }
 
     void SetInitialState(const struct State *const initial_state)
@@ -394,6 +414,8 @@ class FsmStateMachineTest : public BaseStateMachineTest
     struct RgbLedSequence *   rgb_led_sequence;
     struct Clock *            clock;
     struct AcceleratorPedals *papps_and_sapps;
+    struct WheelDynamics *    wheel_dynamics;
+    struct LatencyHistogram * pedal_latency_histogram;
 };
 
 // FSM-10
@@ -442,6 +464,173 @@ TEST_F(FsmStateMachineTest, check_right_wheel_speed_can_signals_in_all_states)
         CANMSGS_FSM_NON_CRITICAL_ERRORS_RIGHT_WHEEL_SPEED_OUT_OF_RANGE_OVERFLOW_CHOICE);
 }
 
+TEST_F(FsmStateMachineTest, check_wheel_dynamics_can_signals_in_all_states)
+{
+    for (const auto &state : GetAllStates())
+    {
+        SetInitialState(state);
+
+        get_left_wheel_speed_fake.return_val         = 42.0f;
+        get_right_wheel_speed_fake.return_val        = 40.0f;
+        get_left_wheel_acceleration_fake.return_val  = 3.0f;
+        get_right_wheel_acceleration_fake.return_val = 5.0f;
+
+        // The wheel dynamics are published on every 1kHz tick
+        LetTimePass(state_machine, 1);
+        ASSERT_EQ(
+            4.0f,
+            App_CanTx_GetPeriodicSignal_WHEEL_ACCELERATION(can_tx_interface));
+        ASSERT_EQ(
+            2.0f, App_CanTx_GetPeriodicSignal_WHEEL_SPEED_DIFFERENCE(
+                      can_tx_interface));
+
+        get_right_wheel_acceleration_fake.return_val = -9.0f;
+        get_right_wheel_speed_fake.return_val        = 45.0f;
+        LetTimePass(state_machine, 1);
+        ASSERT_EQ(
+            -3.0f,
+            App_CanTx_GetPeriodicSignal_WHEEL_ACCELERATION(can_tx_interface));
+        ASSERT_EQ(
+            -3.0f, App_CanTx_GetPeriodicSignal_WHEEL_SPEED_DIFFERENCE(
+                       can_tx_interface));
+    }
+}
+
+TEST_F(FsmStateMachineTest, check_pedal_latency_can_signals_in_all_states)
+{
+    for (const auto &state : GetAllStates())
+    {
+        SetInitialState(state);
+
+        for (uint32_t i = 0; i < 300; i++)
+        {
+            App_SharedLatencyHistogram_Record(pedal_latency_histogram, 100);
+        }
+        App_SharedLatencyHistogram_Record(
+            pedal_latency_histogram, 2 * PEDAL_LATENCY_HISTOGRAM_BIN_WIDTH_US);
+        App_SharedLatencyHistogram_Record(pedal_latency_histogram, UINT32_MAX);
+
+        // The histogram is reported on the 1Hz tick
+        LetTimePass(state_machine, 1000);
+        ASSERT_EQ(
+            UINT8_MAX,
+            App_CanTx_GetPeriodicSignal_PEDAL_LATENCY_BIN_0(can_tx_interface));
+        ASSERT_EQ(
+            0,
+            App_CanTx_GetPeriodicSignal_PEDAL_LATENCY_BIN_1(can_tx_interface));
+        ASSERT_EQ(
+            1,
+            App_CanTx_GetPeriodicSignal_PEDAL_LATENCY_BIN_2(can_tx_interface));
+        ASSERT_EQ(
+            1,
+            App_CanTx_GetPeriodicSignal_PEDAL_LATENCY_BIN_7(can_tx_interface));
+
+        // Every report only counts the latencies since the last report
+        LetTimePass(state_machine, 1000);
+        ASSERT_EQ(
+            0,
+            App_CanTx_GetPeriodicSignal_PEDAL_LATENCY_BIN_0(can_tx_interface));
+        ASSERT_EQ(
+            0,
+            App_CanTx_GetPeriodicSignal_PEDAL_LATENCY_BIN_7(can_tx_interface));
+    }
+}
+
+TEST_F(
+    FsmStateMachineTest,
+    mapped_pedal_percentage_follows_pedal_curve_of_drive_mode_in_all_states)
+{
+    for (const auto &state : GetAllStates())
+    {
+        SetInitialState(state);
+
+        RESET_FAKE(is_brake_actuated);
+        get_papps_encoder_counter_fake.return_val =
+            GetEncoderCounterFromPedalPercentage(
+                50, PAPPS_ENCODER_FULLY_PRESSED_VALUE);
+        get_sapps_encoder_counter_fake.return_val =
+            GetEncoderCounterFromPedalPercentage(
+                50, SAPPS_ENCODER_FULLY_PRESSED_VALUE);
+
+        // The first drive mode maps the pedal linearly
+        App_CanRx_DIM_DRIVE_MODE_SWITCH_SetSignal_DRIVE_MODE(
+            can_rx_interface,
+            CANMSGS_DIM_DRIVE_MODE_SWITCH_DRIVE_MODE_DRIVE_MODE_1_CHOICE);
+        LetTimePass(state_machine, PEDAL_CURVE_BLEND_TICKS + 1);
+        ASSERT_EQ(
+            50, App_CanTx_GetPeriodicSignal_MAPPED_PEDAL_PERCENTAGE(
+                    can_tx_interface));
+
+        // The third drive mode maps the pedal quadratically, but the mapped
+        // pedal percentage blends into it instead of stepping
+        App_CanRx_DIM_DRIVE_MODE_SWITCH_SetSignal_DRIVE_MODE(
+            can_rx_interface,
+            CANMSGS_DIM_DRIVE_MODE_SWITCH_DRIVE_MODE_DRIVE_MODE_3_CHOICE);
+        LetTimePass(state_machine, 1);
+        ASSERT_EQ(
+            50, App_CanTx_GetPeriodicSignal_MAPPED_PEDAL_PERCENTAGE(
+                    can_tx_interface));
+        LetTimePass(state_machine, PEDAL_CURVE_BLEND_TICKS / 2);
+        ASSERT_NEAR(
+            37.5f,
+            App_CanTx_GetPeriodicSignal_MAPPED_PEDAL_PERCENTAGE(
+                can_tx_interface),
+            0.5f);
+
+        // The pedal percentages of each pedal are still linear
+        LetTimePass(state_machine, PEDAL_CURVE_BLEND_TICKS / 2);
+        ASSERT_NEAR(
+            25.0f,
+            App_CanTx_GetPeriodicSignal_MAPPED_PEDAL_PERCENTAGE(
+                can_tx_interface),
+            0.5f);
+        ASSERT_EQ(
+            50, App_CanTx_GetPeriodicSignal_PAPPS_MAPPED_PEDAL_PERCENTAGE(
+                    can_tx_interface));
+        ASSERT_EQ(
+            50, App_CanTx_GetPeriodicSignal_SAPPS_MAPPED_PEDAL_PERCENTAGE(
+                    can_tx_interface));
+
+        // An invalid drive mode keeps the last pedal curve
+        App_CanRx_DIM_DRIVE_MODE_SWITCH_SetSignal_DRIVE_MODE(
+            can_rx_interface,
+            CANMSGS_DIM_DRIVE_MODE_SWITCH_DRIVE_MODE_DRIVE_MODE_INVALID_CHOICE);
+        LetTimePass(state_machine, 1);
+        ASSERT_NEAR(
+            25.0f,
+            App_CanTx_GetPeriodicSignal_MAPPED_PEDAL_PERCENTAGE(
+                can_tx_interface),
+            0.5f);
+
+        App_CanRx_DIM_DRIVE_MODE_SWITCH_SetSignal_DRIVE_MODE(
+            can_rx_interface,
+            CANMSGS_DIM_DRIVE_MODE_SWITCH_DRIVE_MODE_DRIVE_MODE_1_CHOICE);
+        LetTimePass(state_machine, PEDAL_CURVE_BLEND_TICKS + 1);
+        ASSERT_EQ(
+            50, App_CanTx_GetPeriodicSignal_MAPPED_PEDAL_PERCENTAGE(
+                    can_tx_interface));
+    }
+}
+
+TEST_F(FsmStateMachineTest, pedal_map_benchmark_runs_in_every_state)
+{
+    static uint32_t cycle_count;
+    cycle_count                      = 0U;
+    get_cycle_count_fake.custom_fake = []() { return cycle_count += 100U; };
+
+    for (const auto &state : GetAllStates())
+    {
+        SetInitialState(state);
+
+        // The maximum cycles taken to map the pedals are reported on the 1Hz
+        // tick
+        LetTimePass(state_machine, 1000);
+        ASSERT_EQ(
+            100U,
+            App_CanTx_GetPeriodicSignal_MAX_PEDAL_MAP_CYCLES(can_tx_interface));
+    }
+}
+
 // FSM-14
 TEST_F(FsmStateMachineTest, check_primary_flow_rate_can_signals_in_all_states)
 {
@@ -686,10 +875,7 @@ TEST_F(
 
         is_brake_actuated_fake.return_val = true;
 
-        LetTimePass(state_machine, 9);
-        ASSERT_EQ(
-            5, round(App_CanTx_GetPeriodicSignal_MAPPED_PEDAL_PERCENTAGE(
-                   can_tx_interface)));
+        // The mapped pedal percentage is updated on every 1kHz tick
         LetTimePass(state_machine, 1);
         ASSERT_EQ(
             0, App_CanTx_GetPeriodicSignal_MAPPED_PEDAL_PERCENTAGE(
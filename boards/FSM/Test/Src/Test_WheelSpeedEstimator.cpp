@@ -0,0 +1,160 @@
+#include <math.h>
+#include "Test_Fsm.h"
+
+extern "C"
+{
+#include "App_WheelSpeedEstimator.h"
+}
+
+class WheelSpeedEstimatorTest : public testing::Test
+{
+  protected:
+    static constexpr double   TIMER_FREQUENCY_HZ  = 65536.0;
+    static constexpr uint32_t TIMER_PERIOD_TICKS  = 65536U;
+    static constexpr double   DISTANCE_PER_EDGE_M = M_PI * 0.4572 / 48.0;
+    static constexpr uint32_t MAX_CAPTURES        = 16U;
+
+    void SetUp() override
+    {
+        wheel_speed_estimator = App_WheelSpeedEstimator_Create(
+            (float)TIMER_FREQUENCY_HZ, TIMER_PERIOD_TICKS,
+            (float)DISTANCE_PER_EDGE_M);
+        current_time_ms = 0U;
+        speed_mps       = 0.0;
+        distance_m      = 0.0;
+        next_edge_m     = DISTANCE_PER_EDGE_M;
+        timer_ticks     = 0.0;
+    }
+
+    void TearDown() override
+    {
+        TearDownObject(wheel_speed_estimator, App_WheelSpeedEstimator_Destroy);
+    }
+
+    // Simulate the wheel speed sensor for the given duration, updating the
+    // estimator at 1kHz. The wheel speed changes linearly from its current
+    // speed to the given final speed.
+    void DriveTo(double final_speed_kph, uint32_t duration_ms)
+    {
+        // Simulate in 1us steps, so edges are captured with tick resolution
+        const uint32_t steps_per_ms = 1000U;
+        const double   dt_s         = 1e-6;
+        const double   acceleration_mps2 =
+            (final_speed_kph / 3.6 - speed_mps) / (duration_ms / 1000.0);
+
+        for (uint32_t ms = 0U; ms < duration_ms; ms++)
+        {
+            uint32_t captures[MAX_CAPTURES];
+            uint32_t num_captures = 0U;
+
+            for (uint32_t step = 0U; step < steps_per_ms; step++)
+            {
+                speed_mps += acceleration_mps2 * dt_s;
+                distance_m += speed_mps * dt_s;
+                timer_ticks += TIMER_FREQUENCY_HZ * dt_s;
+
+                if (distance_m >= next_edge_m)
+                {
+                    ASSERT_TRUE(num_captures < MAX_CAPTURES);
+                    captures[num_captures++] =
+                        (uint32_t)timer_ticks % TIMER_PERIOD_TICKS;
+                    next_edge_m += DISTANCE_PER_EDGE_M;
+                }
+            }
+
+            current_time_ms++;
+            App_WheelSpeedEstimator_Update(
+                wheel_speed_estimator, captures, num_captures, current_time_ms);
+        }
+    }
+
+    float GetSpeedKph(void)
+    {
+        return App_WheelSpeedEstimator_GetSpeedKph(wheel_speed_estimator);
+    }
+
+    float GetAccelerationMps2(void)
+    {
+        return App_WheelSpeedEstimator_GetAccelerationMps2(
+            wheel_speed_estimator);
+    }
+
+    struct WheelSpeedEstimator *wheel_speed_estimator;
+    uint32_t                    current_time_ms;
+    double                      speed_mps;
+    double                      distance_m;
+    double                      next_edge_m;
+    double                      timer_ticks;
+};
+
+TEST_F(WheelSpeedEstimatorTest, stationary_wheel_is_0kph)
+{
+    DriveTo(0.0, 1000U);
+    ASSERT_EQ(0.0f, GetSpeedKph());
+    ASSERT_EQ(0.0f, GetAccelerationMps2());
+}
+
+TEST_F(WheelSpeedEstimatorTest, speed_is_accurate_across_the_speed_range)
+{
+    // From a few edges per second, where the period between edges is
+    // measured, to over a thousand edges per second, where edges are counted
+    for (const double speed_kph : { 2.0, 10.0, 30.0, 60.0, 100.0, 150.0 })
+    {
+        DriveTo(speed_kph, 200U);
+        DriveTo(speed_kph, 800U);
+        ASSERT_NEAR(speed_kph, GetSpeedKph(), speed_kph * 0.005);
+    }
+}
+
+TEST_F(WheelSpeedEstimatorTest, speed_is_not_stuck_after_wheel_lock)
+{
+    DriveTo(20.0, 500U);
+    DriveTo(20.0, 500U);
+
+    // The wheel locks, so no more edges arrive. Rather than holding the last
+    // measured speed until the timeout, the speed decays as the next edge
+    // becomes more and more overdue.
+    speed_mps                = 0.0;
+    float previous_speed_kph = GetSpeedKph();
+    for (uint32_t i = 0U; i < WHEEL_SPEED_ESTIMATOR_TIMEOUT_MS / 10U; i++)
+    {
+        DriveTo(0.0, 10U);
+        ASSERT_LE(GetSpeedKph(), previous_speed_kph);
+        previous_speed_kph = GetSpeedKph();
+    }
+    ASSERT_LT(GetSpeedKph(), 0.5f);
+
+    DriveTo(0.0, 10U);
+    ASSERT_EQ(0.0f, GetSpeedKph());
+}
+
+TEST_F(WheelSpeedEstimatorTest, acceleration_is_estimated)
+{
+    // Accelerate at 5m/s^2 then brake at 10m/s^2, through both the measured
+    // period and counted edges ranges
+    DriveTo(5.0, 1000U);
+    DriveTo(95.0, 5000U);
+    ASSERT_NEAR(5.0f, GetAccelerationMps2(), 1.0f);
+
+    DriveTo(59.0, 1000U);
+    ASSERT_NEAR(-10.0f, GetAccelerationMps2(), 1.0f);
+
+    DriveTo(59.0, 500U);
+    ASSERT_NEAR(0.0f, GetAccelerationMps2(), 1.0f);
+}
+
+TEST_F(WheelSpeedEstimatorTest, wheel_restarts_after_timeout)
+{
+    DriveTo(40.0, 500U);
+    DriveTo(40.0, 500U);
+
+    // Stop for longer than a timer period, so timing the next edge from the
+    // last edge before the stop would give the wrong speed
+    speed_mps = 0.0;
+    DriveTo(0.0, 1500U);
+    ASSERT_EQ(0.0f, GetSpeedKph());
+
+    DriveTo(12.0, 1U);
+    DriveTo(12.0, 999U);
+    ASSERT_NEAR(12.0f, GetSpeedKph(), 12.0f * 0.005f);
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <stdint.h>
+#include "App_SharedAdcPipeline.h"
+
+// The gain of a resistor divider between a signal and an ADC pin, which
+// converts the voltage at the pin back to the voltage of the signal
+#define DIVIDER_GAIN(top_ohms, bottom_ohms) \
+    (((top_ohms) + (bottom_ohms)) / (bottom_ohms))
+
+struct AnalogSenseChannelConfig
+{
+    // How the voltage at the ADC pin is filtered
+    struct AdcChannelConfig filter;
+
+    // The sensed quantity is gain * V_pin + offset, in the units of the
+    // quantity (e.g. V for a divided rail, or A for a current sense output)
+    float gain;
+    float offset;
+};
+
+struct AnalogSenseOutput
+{
+    // The filtered and calibrated value of the channel, in the units of the
+    // sensed quantity
+    float value;
+
+    // The time at which the last scan contributing to the value finished, in
+    // ms
+    uint32_t timestamp_ms;
+};
+
+struct AnalogSense;
+
+/**
+ * Allocate and initialize the analog front-end of an ADC scanning several
+ * channels. Each block of scans is oversampled and filtered by an ADC
+ * pipeline, and the filtered pin voltage of each channel is calibrated to the
+ * quantity it senses.
+ * @note This function does __not__ take ownership of the channel configs,
+ *       which must be kept alive for the lifetime of the analog front-end
+ * @param channel_configs The config of each channel, in the order the channels
+ *                        are converted in a scan
+ * @param num_channels The number of channels converted in each scan, at most
+ *                     ADC_PIPELINE_MAX_CHANNELS
+ * @param oversampling_ratio The number of scans decimated to one sample
+ * @param reference_voltage The voltage corresponding to a raw value of
+ *                          full_scale, in V
+ * @param full_scale The largest raw value of the ADC
+ * @return The created analog front-end, whose ownership is given to the caller
+ */
+struct AnalogSense *App_AnalogSense_Create(
+    const struct AnalogSenseChannelConfig *channel_configs,
+    uint32_t                               num_channels,
+    uint32_t                               oversampling_ratio,
+    float                                  reference_voltage,
+    uint32_t                               full_scale);
+
+/**
+ * Deallocate the memory used by the given analog front-end
+ * @param analog_sense The analog front-end to deallocate
+ */
+void App_AnalogSense_Destroy(struct AnalogSense *analog_sense);
+
+/**
+ * Oversample and filter one block of scans
+ * @note This is safe to call from the DMA interrupt while another context
+ *       gets the output of a channel
+ * @param analog_sense The analog front-end to process the block with
+ * @param raw_adc_values The raw values of oversampling_ratio consecutive scans
+ * @param timestamp_ms The time at which the last scan of the block finished,
+ *                     in ms
+ */
+void App_AnalogSense_ProcessBlock(
+    struct AnalogSense *analog_sense,
+    const uint16_t *    raw_adc_values,
+    uint32_t            timestamp_ms);
+
+/**
+ * Get the calibrated output of a channel
+ * @param analog_sense The analog front-end to get the output from
+ * @param channel The index of the channel in a scan
+ * @return The sensed quantity of the channel and when it was converted, as of
+ *         the last processed block. Before any block is processed, this is the
+ *         offset of the channel at 0ms.
+ */
+struct AnalogSenseOutput App_AnalogSense_GetOutput(
+    const struct AnalogSense *analog_sense,
+    uint32_t                  channel);
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "App_SharedExitCode.h"
+
+// The most efuses whose current sense outputs can be scheduled
+#define CURRENT_SENSE_MAX_EFUSES 4U
+
+// The number of channels multiplexed onto the current sense output of an efuse
+#define NUM_EFUSE_CHANNELS 2U
+
+struct CurrentSenseSample
+{
+    // The current of the channel, in A
+    float current;
+
+    // The time at which the conversion of the current finished, in ms
+    uint32_t timestamp_ms;
+};
+
+struct CurrentSenseScheduler;
+
+/**
+ * Allocate and initialize a scheduler that cycles the current sense output of
+ * every efuse between its channels. On every tick, each efuse whose selected
+ * channel was sampled (or timed out) is switched to its next channel, so every
+ * channel of every efuse is sampled every NUM_EFUSE_CHANNELS ticks.
+ * @param num_efuses The number of efuses, at most CURRENT_SENSE_MAX_EFUSES
+ * @param select_channel A function that can be called to switch the current
+ *                       sense output of the given efuse to the given channel
+ * @param is_output_valid A function that can be called to check if the current
+ *                        sense output of the given efuse is valid (i.e. its
+ *                        CSNS_SYNC pin is asserted)
+ * @return The created scheduler, whose ownership is given to the caller
+ */
+struct CurrentSenseScheduler *App_CurrentSenseScheduler_Create(
+    uint32_t num_efuses,
+    ExitCode (*select_channel)(uint32_t efuse, uint32_t channel),
+    bool (*is_output_valid)(uint32_t efuse));
+
+/**
+ * Deallocate the memory used by the given scheduler
+ * @param scheduler The scheduler to deallocate
+ */
+void App_CurrentSenseScheduler_Destroy(struct CurrentSenseScheduler *scheduler);
+
+/**
+ * Publish the sample of each efuse's selected channel, and switch each efuse
+ * that was sampled or timed out to its next channel. This is expected to be
+ * called at a fixed rate.
+ * @param scheduler The scheduler to tick
+ */
+void App_CurrentSenseScheduler_Tick(struct CurrentSenseScheduler *scheduler);
+
+/**
+ * Process the conversion of the current sense output of every efuse
+ * @note This is safe to call from the ADC DMA interrupt while the scheduler
+ *       is ticked by a task that it preempts
+ * @param scheduler The scheduler to process the conversion with
+ * @param currents The current converted from the current sense output of each
+ *                 efuse, in A
+ * @param timestamp_ms The time at which the conversion finished, in ms
+ */
+void App_CurrentSenseScheduler_ProcessConversion(
+    struct CurrentSenseScheduler *scheduler,
+    const float *                 currents,
+    uint32_t                      timestamp_ms);
+
+/**
+ * Get the last published sample of a channel of an efuse
+ * @param scheduler The scheduler to get the sample from
+ * @param efuse The index of the efuse
+ * @param channel The channel of the efuse
+ * @return The current of the channel and when it was converted. Before the
+ *         channel is sampled, this is 0A at 0ms.
+ */
+struct CurrentSenseSample App_CurrentSenseScheduler_GetSample(
+    const struct CurrentSenseScheduler *scheduler,
+    uint32_t                            efuse,
+    uint32_t                            channel);
+
+/**
+ * Get the number of samples of an efuse that were missed, because its
+ * current sense output couldn't be switched to the next channel or wasn't
+ * valid before the timeout
+ * @param scheduler The scheduler to get the number of missed samples from
+ * @param efuse The index of the efuse
+ * @return The number of missed samples of the efuse
+ */
+uint32_t App_CurrentSenseScheduler_GetNumMissedSamples(
+    const struct CurrentSenseScheduler *scheduler,
+    uint32_t                            efuse);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <stdbool.h>
+#include <stdint.h>
 
 /**
  * Allocate and initialize low voltage battery
@@ -14,12 +15,26 @@
  * @param has_boost_fault A function that can be called to check if the boost
  *                        controller IC for the low voltage batterise has a
  *                        fault
+ * @param get_battery_voltage A function that can be called to get the voltage
+ *                            of the low voltage battery, in V
+ * @param get_load_current A function that can be called to get the total
+ *                         current drawn from the boost controller output by
+ *                         the loads, in A
+ * @param get_load_voltage A function that can be called to get the voltage of
+ *                         the boost controller output, in V
+ * @param is_ocv_correction_enabled Whether the state of charge is initialized
+ *                                  and corrected at rest from the open-circuit
+ *                                  voltage, rather than counted from full
  * @return The created low voltage battery, whose ownership is given to the
  *         caller
  */
 struct LowVoltageBattery *App_LowVoltageBattery_Create(
     bool (*has_charge_fault)(void),
-    bool (*has_boost_fault)(void));
+    bool (*has_boost_fault)(void),
+    float (*get_battery_voltage)(void),
+    float (*get_load_current)(void),
+    float (*get_load_voltage)(void),
+    bool is_ocv_correction_enabled);
 
 /**
  * Deallocate the memory used by the given low voltage battery
@@ -44,3 +59,39 @@ bool App_LowVoltageBattery_HasChargeFault(
  */
 bool App_LowVoltageBattery_HasBoostControllerFault(
     const struct LowVoltageBattery *low_voltage_battery);
+
+/**
+ * Update the state of charge and time to empty of the given low voltage
+ * battery. The state of charge is counted from the charge drawn by the loads
+ * since the last update, and corrected towards the state of charge looked up
+ * from the open-circuit voltage whenever the battery has been at rest. On the
+ * first update, it is initialized from the open-circuit voltage.
+ * @note This is expected to be called periodically, at 10Hz to 100Hz
+ * @param low_voltage_battery The low voltage battery to update
+ * @param current_time_ms The current time, in ms
+ */
+void App_LowVoltageBattery_UpdateStateOfCharge(
+    struct LowVoltageBattery *low_voltage_battery,
+    uint32_t                  current_time_ms);
+
+/**
+ * Get the state of charge of the given low voltage battery
+ * @param low_voltage_battery The low voltage battery to get the state of
+ *                            charge of
+ * @return The state of charge of the given low voltage battery as of its last
+ *         update, in %
+ */
+float App_LowVoltageBattery_GetStateOfCharge(
+    const struct LowVoltageBattery *low_voltage_battery);
+
+/**
+ * Get the estimated time until the given low voltage battery is empty, at the
+ * smoothed current drawn from it
+ * @param low_voltage_battery The low voltage battery to get the time to empty
+ *                            of
+ * @return The time to empty of the given low voltage battery as of its last
+ *         update, in minutes. This is LV_BATTERY_MAX_TIME_TO_EMPTY_MIN if the
+ *         battery isn't discharging.
+ */
+float App_LowVoltageBattery_GetTimeToEmpty(
+    const struct LowVoltageBattery *low_voltage_battery);
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// The most outputs that can be protected
+#define OUTPUT_PROTECTION_MAX_OUTPUTS 8U
+
+// The shed priority of an output that is never shed
+#define SHED_PRIORITY_NEVER 0U
+
+// Whether an output is used, and its trip curve, retries and shed priority
+struct OutputProtectionConfig
+{
+    // Whether the output is turned on at all. Outputs with nothing to power
+    // are left off, and protection never turns them on.
+    bool is_enabled_by_default;
+
+    // The current the output can carry indefinitely, in A. Above it, the
+    // output heats up by the excess I²t, and below it the output cools down
+    // at the same rate.
+    float rated_current;
+
+    // The excess I²t at which the output trips, in A²s. An output carrying a
+    // constant current I > rated_current trips after
+    // trip_i2t / (I² - rated_current²) seconds, so short inrush spikes pass
+    // while sustained overloads trip.
+    float trip_i2t;
+
+    // The current at which the output trips immediately, in A
+    float instantaneous_trip_current;
+
+    // The delay before a tripped output is retried, in ms. The delay doubles
+    // with every retry, and the output stays off after max_retries retries.
+    uint32_t retry_delay_ms;
+    uint32_t max_retries;
+
+    // Outputs with higher shed priorities are shed first when the LV battery
+    // voltage sags, and outputs with SHED_PRIORITY_NEVER are never shed
+    uint32_t shed_priority;
+};
+
+struct OutputProtection;
+
+/**
+ * Allocate and initialize the protection of a set of outputs, which trips
+ * each output on its I²t curve, retries it with backoff, and sheds outputs by
+ * priority while the LV battery voltage sags
+ * @note This function does __not__ take ownership of the configs, which must
+ *       be kept alive for the lifetime of the created protection
+ * @param configs The config of each output, indexed by output
+ * @param num_outputs The number of outputs, at most
+ *                    OUTPUT_PROTECTION_MAX_OUTPUTS
+ * @param tick_period_ms The period at which the protection is ticked, in ms
+ * @param get_current A function that can be called to get the current of the
+ *                    given output, in A
+ * @param set_enabled A function that can be called to turn the given output on
+ *                    or off
+ * @param delatch_faults A function that can be called to delatch the faults of
+ *                       the efuse of the given output before it is retried
+ * @param get_lv_battery_voltage A function that can be called to get the LV
+ *                               battery voltage, in V, or NULL to never shed
+ *                               outputs
+ * @return The created protection, whose ownership is given to the caller
+ */
+struct OutputProtection *App_OutputProtection_Create(
+    const struct OutputProtectionConfig *configs,
+    uint32_t                             num_outputs,
+    uint32_t                             tick_period_ms,
+    float (*get_current)(uint32_t output),
+    void (*set_enabled)(uint32_t output, bool is_enabled),
+    void (*delatch_faults)(uint32_t output),
+    float (*get_lv_battery_voltage)(void));
+
+/**
+ * Deallocate the memory used by the given protection
+ * @param protection The protection to deallocate
+ */
+void App_OutputProtection_Destroy(struct OutputProtection *protection);
+
+/**
+ * Update the I²t of every output, trip or retry outputs, shed or restore
+ * outputs, and turn every output that is enabled by default on or off to
+ * match. This is expected to be called every tick_period_ms.
+ * @param protection The protection to tick
+ */
+void App_OutputProtection_Tick(struct OutputProtection *protection);
+
+/**
+ * Check if an output is turned on
+ * @param protection The protection to check
+ * @param output The index of the output
+ * @return true if the output is enabled by default and is neither tripped nor
+ *         shed, else false
+ */
+bool App_OutputProtection_IsOutputEnabled(
+    const struct OutputProtection *protection,
+    uint32_t                       output);
+
+/**
+ * Check if an output is tripped and waiting to be retried, or has run out of
+ * retries
+ * @param protection The protection to check
+ * @param output The index of the output
+ * @return true if the output is tripped, else false
+ */
+bool App_OutputProtection_IsOutputTripped(
+    const struct OutputProtection *protection,
+    uint32_t                       output);
+
+/**
+ * Check if an output has tripped after its last retry, which leaves it off
+ * until the protection is re-created
+ * @param protection The protection to check
+ * @param output The index of the output
+ * @return true if the output is latched off, else false
+ */
+bool App_OutputProtection_IsOutputLatchedOff(
+    const struct OutputProtection *protection,
+    uint32_t                       output);
+
+/**
+ * Check if an output is shed because the LV battery voltage sagged
+ * @param protection The protection to check
+ * @param output The index of the output
+ * @return true if the output is shed, else false
+ */
+bool App_OutputProtection_IsOutputShed(
+    const struct OutputProtection *protection,
+    uint32_t                       output);
+
+/**
+ * Get how close an output is to tripping on its I²t curve
+ * @param protection The protection to get the thermal load from
+ * @param output The index of the output
+ * @return The excess I²t of the output as a fraction of its trip_i2t, where 0
+ *         is cold and 1 trips the output
+ */
+float App_OutputProtection_GetThermalLoad(
+    const struct OutputProtection *protection,
+    uint32_t                       output);
@@ -6,6 +6,7 @@
 #include "App_SharedHeartbeatMonitor.h"
 #include "App_SharedRgbLedSequence.h"
 #include "App_LowVoltageBattery.h"
+#include "App_OutputProtection.h"
 #include "App_SharedClock.h"
 
 struct PdmWorld;
@@ -35,6 +36,7 @@ struct PdmWorld *App_PdmWorld_Create(
     struct HeartbeatMonitor * heartbeat_monitor,
     struct RgbLedSequence *   rgb_led_sequence,
     struct LowVoltageBattery *low_voltage_battery,
+    struct OutputProtection * output_protection,
     struct Clock *            clock);
 
 /**
@@ -158,6 +160,14 @@ struct RgbLedSequence *
 struct LowVoltageBattery *
     App_PdmWorld_GetLowVoltageBattery(const struct PdmWorld *world);
 
+/**
+ * Get the output protection for the given world
+ * @param world The world to get output protection for
+ * @return The output protection for the given world
+ */
+struct OutputProtection *
+    App_PdmWorld_GetOutputProtection(const struct PdmWorld *world);
+
 /**
  * Get the clock for the given world
  * @param world The world to get clock for
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "App_AnalogSense.h"
+
+// The channels converted by the ADC, in the order of their ranks in a scan
+enum AnalogSenseChannel
+{
+    ANALOG_SENSE_VBAT,                 // ADC1_IN1
+    ANALOG_SENSE_24V_ACC,              // ADC1_IN2
+    ANALOG_SENSE_24V_AUX,              // ADC1_IN3 (24V boost output)
+    ANALOG_SENSE_CSNS_AUX1_AUX2,       // ADC1_IN6
+    ANALOG_SENSE_CSNS_AIR_SHDN_LV_PWR, // ADC1_IN7
+    ANALOG_SENSE_CSNS_DI_BL_DI_BR,     // ADC1_IN8
+    ANALOG_SENSE_CSNS_DI_FL_DI_FR,     // ADC1_IN9
+    NUM_ANALOG_SENSE_CHANNELS,
+};
+
+// The resistor dividers between the sensed rails and the ADC pins, in ohms.
+// These put VBAT (~10.3V full scale) and the 24V rails (~30.2V full scale)
+// within the 3.3V ADC range, but are yet to be checked against the divider
+// resistors on the PDM schematic. Until they are, LOAD_SHEDDING_ENABLED and
+// LV_BATTERY_OCV_CORRECTION_ENABLED keep the features that act on the sensed
+// VBAT voltage disabled.
+#define VBAT_SENSE_DIVIDER_TOP_OHMS 100e3f
+#define VBAT_SENSE_DIVIDER_BOTTOM_OHMS 47e3f
+#define _24V_SENSE_DIVIDER_TOP_OHMS 220e3f
+#define _24V_SENSE_DIVIDER_BOTTOM_OHMS 27e3f
+
+// The load current of an efuse channel per volt at its CSNS pin, in A/V
+#define CURRENT_SENSE_AMPS_PER_VOLT 500.0f
+
+// The weight of each new sample of a rail voltage. At 4kHz, this smooths out
+// switching ripple with a time constant of about 5ms.
+#define RAIL_VOLTAGE_IIR_SMOOTHING_FACTOR 0.05f
+
+// The current sense outputs are published unfiltered, as they are multiplexed
+// between channels and must be sampled as soon as they are valid
+// clang-format off
+static const struct AnalogSenseChannelConfig
+    analog_sense_channel_configs[NUM_ANALOG_SENSE_CHANNELS] = {
+    [ANALOG_SENSE_VBAT] = {
+        { ADC_FILTER_IIR, RAIL_VOLTAGE_IIR_SMOOTHING_FACTOR, 0U },
+        DIVIDER_GAIN(VBAT_SENSE_DIVIDER_TOP_OHMS, VBAT_SENSE_DIVIDER_BOTTOM_OHMS),
+        0.0f,
+    },
+    [ANALOG_SENSE_24V_ACC] = {
+        { ADC_FILTER_IIR, RAIL_VOLTAGE_IIR_SMOOTHING_FACTOR, 0U },
+        DIVIDER_GAIN(_24V_SENSE_DIVIDER_TOP_OHMS, _24V_SENSE_DIVIDER_BOTTOM_OHMS),
+        0.0f,
+    },
+    [ANALOG_SENSE_24V_AUX] = {
+        { ADC_FILTER_IIR, RAIL_VOLTAGE_IIR_SMOOTHING_FACTOR, 0U },
+        DIVIDER_GAIN(_24V_SENSE_DIVIDER_TOP_OHMS, _24V_SENSE_DIVIDER_BOTTOM_OHMS),
+        0.0f,
+    },
+    [ANALOG_SENSE_CSNS_AUX1_AUX2] = {
+        { ADC_FILTER_NONE, 0.0f, 0U }, CURRENT_SENSE_AMPS_PER_VOLT, 0.0f,
+    },
+    [ANALOG_SENSE_CSNS_AIR_SHDN_LV_PWR] = {
+        { ADC_FILTER_NONE, 0.0f, 0U }, CURRENT_SENSE_AMPS_PER_VOLT, 0.0f,
+    },
+    [ANALOG_SENSE_CSNS_DI_BL_DI_BR] = {
+        { ADC_FILTER_NONE, 0.0f, 0U }, CURRENT_SENSE_AMPS_PER_VOLT, 0.0f,
+    },
+    [ANALOG_SENSE_CSNS_DI_FL_DI_FR] = {
+        { ADC_FILTER_NONE, 0.0f, 0U }, CURRENT_SENSE_AMPS_PER_VOLT, 0.0f,
+    },
+};
+// clang-format on
@@ -0,0 +1,11 @@
+#pragma once
+
+// The number of conversions discarded after the current sense output of an
+// efuse is switched to another channel. The first conversion may have started
+// before the switch, and the next lets the output settle.
+#define CURRENT_SENSE_DISCARDED_CONVERSIONS 2U
+
+// The number of ticks to wait for a valid conversion of the selected channel of
+// an efuse, before its sample is counted as missed and the next channel is
+// selected anyway
+#define CURRENT_SENSE_TIMEOUT_TICKS 3U
@@ -0,0 +1,46 @@
+#pragma once
+
+// The LV battery is a pack of 18650 cells, NUM_SERIES_CELLS in series
+#define LV_BATTERY_NUM_SERIES_CELLS 2U
+#define LV_BATTERY_CAPACITY_AH 6.0f
+
+// The loads are powered from the 24V AUX rail, which the boost controller
+// steps up from the LV battery with this efficiency
+#define LV_BATTERY_BOOST_EFFICIENCY 0.9f
+
+// The battery is at rest once its current stays under LV_BATTERY_REST_CURRENT
+// for LV_BATTERY_REST_TIME_MS, by when its terminal voltage has relaxed to its
+// open-circuit voltage
+#define LV_BATTERY_REST_CURRENT 0.2f
+#define LV_BATTERY_REST_TIME_MS 30000U
+
+// While at rest, the state of charge converges to the one looked up from the
+// open-circuit voltage with this time constant, so a noisy voltage doesn't
+// make the state of charge jump
+#define LV_BATTERY_OCV_CORRECTION_TIME_CONSTANT_S 10.0f
+
+// The state of charge is only initialized and corrected from the open-circuit
+// voltage once the VBAT sense divider in App_AnalogSenseConfig.h is checked
+// against the PDM schematic, as a wrong divider ratio skews every OCV lookup.
+// Until then, the state of charge is counted down from
+// LV_BATTERY_UNCORRECTED_INITIAL_STATE_OF_CHARGE, as the battery is charged
+// off the car before it is installed.
+#define LV_BATTERY_OCV_CORRECTION_ENABLED false
+#define LV_BATTERY_UNCORRECTED_INITIAL_STATE_OF_CHARGE 100.0f
+
+// The current that the time to empty is estimated from is smoothed with this
+// time constant, so it doesn't jump whenever a load is switched
+#define LV_BATTERY_CURRENT_TIME_CONSTANT_S 30.0f
+
+// The longest time to empty that is reported, in minutes, which is also
+// reported while the battery isn't discharging
+#define LV_BATTERY_MAX_TIME_TO_EMPTY_MIN 999.0f
+
+// The open-circuit voltage of one cell at each 10% step of state of charge,
+// from 0% to 100%
+#define LV_BATTERY_OCV_TABLE_SIZE 11U
+#define LV_BATTERY_CELL_OCV_TABLE                                             \
+    {                                                                         \
+        3.00f, 3.45f, 3.55f, 3.62f, 3.68f, 3.74f, 3.81f, 3.90f, 3.98f, 4.08f, \
+            4.20f                                                             \
+    }
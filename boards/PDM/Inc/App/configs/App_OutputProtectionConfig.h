@@ -0,0 +1,49 @@
+#pragma once
+
+// Once an output stays on for this long without tripping, its retries are
+// reset and its next trip is retried after the shortest delay again
+#define OUTPUT_PROTECTION_RETRY_RESET_MS 10000U
+
+// Outputs are only shed once the VBAT sense divider in App_AnalogSenseConfig.h
+// is checked against the PDM schematic, as a wrong divider ratio moves the
+// LV battery voltage at which outputs are shed
+#define LOAD_SHEDDING_ENABLED false
+
+// The LV battery voltage under which one more priority level of outputs is
+// shed, in V
+#define LOAD_SHED_VOLTAGE 6.4f
+
+// The LV battery voltage over which one more priority level of shed outputs
+// is restored, in V. This is kept above LOAD_SHED_VOLTAGE so that restoring an
+// output doesn't drag the battery straight back into shedding it.
+#define LOAD_RESTORE_VOLTAGE 6.8f
+
+// How long the LV battery voltage must stay under LOAD_SHED_VOLTAGE before the
+// next priority level is shed, which also gives the battery time to recover
+// after each level is shed
+#define LOAD_SHED_DWELL_MS 200U
+
+// How long the LV battery voltage must stay over LOAD_RESTORE_VOLTAGE before
+// the next priority level is restored
+#define LOAD_RESTORE_DWELL_MS 2000U
+
+// The config of each efuse output, indexed by EFUSE_OUTPUT_*. Outputs are
+// enabled by default to match their level in MX_GPIO_Init, so outputs with
+// nothing to power stay off. Adding an output to the protection only takes a
+// row in this table.
+// clang-format off
+#define OUTPUT_PROTECTION_CONFIGS                                                           \
+{                                                                                           \
+    /* Enabled by default, rated current (A), trip I²t (A²s),                               \
+       instantaneous trip current (A), retry delay (ms), max retries,                       \
+       shed priority */                                                                     \
+    [EFUSE_OUTPUT_AUX1]     = { false, 1.0f, 4.0f, 8.0f, 1000U, 3U, 2U },                   \
+    [EFUSE_OUTPUT_AUX2]     = { false, 1.0f, 4.0f, 8.0f, 1000U, 3U, 1U },                   \
+    [EFUSE_OUTPUT_AIR_SHDN] = { true, 2.5f, 25.0f, 15.0f, 100U, 5U, SHED_PRIORITY_NEVER },  \
+    [EFUSE_OUTPUT_LV_PWR]   = { true, 2.5f, 25.0f, 15.0f, 100U, 5U, SHED_PRIORITY_NEVER },  \
+    [EFUSE_OUTPUT_DI_BL]    = { false, 2.5f, 25.0f, 15.0f, 500U, 3U, SHED_PRIORITY_NEVER }, \
+    [EFUSE_OUTPUT_DI_BR]    = { false, 2.5f, 25.0f, 15.0f, 500U, 3U, SHED_PRIORITY_NEVER }, \
+    [EFUSE_OUTPUT_DI_FL]    = { false, 2.5f, 25.0f, 15.0f, 500U, 3U, SHED_PRIORITY_NEVER }, \
+    [EFUSE_OUTPUT_DI_FR]    = { true, 2.5f, 25.0f, 15.0f, 500U, 3U, SHED_PRIORITY_NEVER },  \
+}
+// clang-format on
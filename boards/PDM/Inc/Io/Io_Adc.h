@@ -1,51 +1,26 @@
 #pragma once
 
 #include <stdint.h>
+#include <stm32f3xx_hal.h>
+#include "configs/App_AnalogSenseConfig.h"
 
 /**
- * Get the buffer for DMA controller to write raw ADC values into
- * @return Pointer to the buffer
+ * Initialize the analog front-end and start converting the ADC channels into a
+ * circular DMA buffer
+ * @param hadc The handle of the ADC converting the channels, whose conversions
+ *             are triggered by a timer
+ * @param block_processed A function that is called from the DMA interrupt
+ *                        once the output of every channel is updated, with
+ *                        the time at which the last scan finished in ms
  */
-uint16_t *Io_Adc_GetRawAdcValues(void);
+void Io_Adc_Init(
+    ADC_HandleTypeDef *hadc,
+    void (*block_processed)(uint32_t timestamp_ms));
 
 /**
- * Get the voltage measured at ADC channel 1
- * @return The voltage measured at ADC channel 1, in volts
+ * Get the calibrated output of an ADC channel
+ * @param channel The channel to get the output of
+ * @return The sensed quantity of the channel, in the units of its calibration,
+ *         and when it was measured
  */
-float Io_Adc_GetChannel1Voltage(void);
-
-/**
- * Get the voltage measured at ADC channel 2
- * @return The voltage measured at ADC channel 2, in volts
- */
-float Io_Adc_GetChannel2Voltage(void);
-
-/**
- * Get the voltage measured at ADC channel 3
- * @return The voltage measured at ADC channel 3, in volts
- */
-float Io_Adc_GetChannel3Voltage(void);
-
-/**
- * Get the voltage measured at ADC channel 6
- * @return The voltage measured at ADC channel 6, in volts
- */
-float Io_Adc_GetChannel6Voltage(void);
-
-/**
- * Get the voltage measured at ADC channel 7
- * @return The voltage measured at ADC channel 7, in volts
- */
-float Io_Adc_GetChannel7Voltage(void);
-
-/**
- * Get the voltage measured at ADC channel 8
- * @return The voltage measured at ADC channel 8, in volts
- */
-float Io_Adc_GetChannel8Voltage(void);
-
-/**
- * Get the voltage measured at ADC channel 9
- * @return The voltage measured at ADC channel 9, in volts
- */
-float Io_Adc_GetChannel9Voltage(void);
+struct AnalogSenseOutput Io_Adc_GetOutput(enum AnalogSenseChannel channel);
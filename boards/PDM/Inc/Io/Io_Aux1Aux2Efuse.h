@@ -8,9 +8,9 @@
 
 /**
  * Initialize the Aux1Aux2 efuse.
- * @param spi_handle Handle to the SPI peripheral used for the Efuse
+ * @note The efuse is created by Io_Efuses_Init, which must be called first
  */
-void Io_Aux1Aux2Efuse_Init(SPI_HandleTypeDef *spi_handle);
+void Io_Aux1Aux2Efuse_Init(void);
 
 /**
  * Enable the Aux 1 channel output for the Aux1Aux2 efuse.
@@ -1,5 +1,36 @@
 #pragma once
 
+#include <stdint.h>
+#include "App_CurrentSenseScheduler.h"
+
+/**
+ * Initialize the current sense of the efuse channels
+ * @param scheduler The scheduler that switches the current sense output of
+ *                  each efuse between its channels
+ */
+void Io_CurrentSense_Init(struct CurrentSenseScheduler *scheduler);
+
+/**
+ * Convert the current sense output of every efuse to a current, and pass it to
+ * the current sense scheduler. This is expected to be called from the ADC DMA
+ * interrupt whenever a block of conversions is processed.
+ * @param timestamp_ms The time at which the conversions finished, in ms
+ */
+void Io_CurrentSense_ProcessAdcBlock(uint32_t timestamp_ms);
+
+/**
+ * Get the current of an output of an efuse, in amps
+ * @param output The output to get the current of, as an enum EfuseOutput
+ * @return The current of the output, in amps
+ */
+float Io_CurrentSense_GetOutputCurrent(uint32_t output);
+
+/**
+ * Get the total current of every output of the efuses, in amps
+ * @return The total current of every output of the efuses, in amps
+ */
+float Io_CurrentSense_GetTotalOutputCurrent(void);
+
 /**
  * Get the auxiliary 1 current, in amps
  * @return The auxiliary 1 current, in amps
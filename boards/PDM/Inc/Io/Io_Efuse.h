@@ -17,9 +17,9 @@ struct Efuse_Context;
 /**
  * Allocate and initialize an efuse.
  * @param get_channel_0_current A function that can be called to get the
- * measured current for channel 0
+ * measured current for channel 0, or NULL if it isn't measured
  * @param get_channel_1_current A function that can be called to get the
- * measured current for channel 1
+ * measured current for channel 1, or NULL if it isn't measured
  * @param hspi Handle to the SPI peripheral used for the efuse
  * @param chip_select_port Handle to efuse's chip-select GPIO port
  * @param chip_select_port Handle to efuse's chip-select GPIO pin
@@ -92,6 +92,8 @@ void Io_Efuse_DisableChannel1(const struct Efuse_Context *const efuse);
  *                  CSNS_FUNCTION_CURRENT_SUM - Current sensing for summed
  * channels (for Parallel mode)
  * @param efuse Pointer to the efuse structure for the efuse being configured
+ * @note Nothing is sent to the efuse if the monitoring function is already
+ *       selected
  * @return EXIT_CODE_OK if the channel configuration was successful
  *         EXIT_CODE_TIMEOUT if one of the SPI writes timed-out
  */
@@ -131,17 +133,47 @@ bool Io_Efuse_IsEfuseInFailSafeMode(const struct Efuse_Context *const efuse);
  */
 void Io_Efuse_DelatchFaults(const struct Efuse_Context *const efuse);
 
+/**
+ * Delatch the latchable faults of the given efuse's channel 0, leaving its
+ * input pin high
+ * @param efuse Pointer to the given efuse
+ * @note Channel 1 is left untouched
+ */
+void Io_Efuse_DelatchChannel0Faults(const struct Efuse_Context *const efuse);
+
+/**
+ * Delatch the latchable faults of the given efuse's channel 1, leaving its
+ * input pin high
+ * @param efuse Pointer to the given efuse
+ * @note Channel 0 is left untouched
+ */
+void Io_Efuse_DelatchChannel1Faults(const struct Efuse_Context *const efuse);
+
+/**
+ * Check if the current sense output of the given efuse is within its specified
+ * accuracy, which is signalled by the efuse pulling its CSNS_SYNC pin low.
+ * @param efuse Pointer to the efuse structure for the efuse being checked
+ * @return true if the current sense output is valid, else false
+ */
+bool Io_Efuse_IsCurrentSenseSynced(const struct Efuse_Context *const efuse);
+
 /**
  * Get the channel 0 current reading in Amps [A] for the given efuse.
+ * @note The current sense output of the efuse is not switched to channel 0
+ *       here, as the current sense scheduler switches it between channels
  * @param efuse Pointer to the given efuse
- * @return The channel 0 current if the current was measured, else NAN
+ * @return The last channel 0 current measured, else NAN if channel 0's
+ *         current isn't measured
  */
 float Io_Efuse_GetChannel0Current(struct Efuse_Context *const efuse);
 
 /**
  * Get the channel 1 current reading in Amps [A] for the given efuse.
+ * @note The current sense output of the efuse is not switched to channel 1
+ *       here, as the current sense scheduler switches it between channels
  * @param efuse Pointer to the given efuse
- * @return The channel 1 current if the current was measured, else NAN
+ * @return The last channel 1 current measured, else NAN if channel 1's
+ *         current isn't measured
  */
 float Io_Efuse_GetChannel1Current(struct Efuse_Context *const efuse);
 
@@ -150,6 +182,8 @@ float Io_Efuse_GetChannel1Current(struct Efuse_Context *const efuse);
  * @param register_address Serial input register being written to
  * @param register_value The value being written to the serial input register
  * @param efuse Pointer to efuse structure being written to
+ * @note Nothing is sent to the efuse if the register is known to hold the
+ *       value already
  * @return EXIT_CODE_OK if the write was successful
  *         EXIT_CODE_TIMEOUT if the SPI write timed-out
  */
@@ -0,0 +1,92 @@
+/**
+ * @brief Shadow of the serial input registers of a 22XS4200 efuse, so that
+ *        register writes that wouldn't change anything skip the SPI bus
+ * @note This is independent of the HAL, as the efuse's SPI frames are sent
+ *       with the given transfer function
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "App_SharedExitCode.h"
+
+struct Efuse_Context;
+struct EfuseRegisterCache;
+
+/**
+ * Allocate and initialize a register cache for an efuse, with every register
+ * unknown
+ * @param transfer_frame A function that can be called to send the given 16-bit
+ *                       SPI frame to the given efuse, and to receive the frame
+ *                       it sends back at the same time
+ * @param efuse The efuse to send the SPI frames to
+ * @return The created register cache, whose ownership is given to the caller
+ */
+struct EfuseRegisterCache *Io_EfuseRegisterCache_Create(
+    ExitCode (*transfer_frame)(
+        const struct Efuse_Context *efuse,
+        uint16_t                    tx_data,
+        uint16_t *                  rx_data),
+    const struct Efuse_Context *efuse);
+
+/**
+ * Deallocate the memory used by the given register cache
+ * @param register_cache The register cache to deallocate
+ */
+void Io_EfuseRegisterCache_Destroy(struct EfuseRegisterCache *register_cache);
+
+/**
+ * Forget the contents of every register, so the next write to each register is
+ * sent to the efuse, and set the watchdog-in bit of the next frame
+ * @param register_cache The register cache to reset
+ */
+void Io_EfuseRegisterCache_Reset(struct EfuseRegisterCache *register_cache);
+
+/**
+ * Write the given value to a serial input register of the efuse, unless the
+ * register is known to hold the value already
+ * @note Writes to the status (STATR_s) and calibration (CALR_s) registers are
+ *       commands rather than settings, so they are always sent
+ * @param register_cache The register cache of the efuse to write to
+ * @param register_address Serial input register being written to
+ * @param register_value The value being written to the serial input register
+ * @return EXIT_CODE_OK if the register holds the value
+ *         EXIT_CODE_TIMEOUT if the SPI write timed-out
+ */
+ExitCode Io_EfuseRegisterCache_WriteRegister(
+    struct EfuseRegisterCache *register_cache,
+    uint8_t                    register_address,
+    uint16_t                   register_value);
+
+/**
+ * Write the given bits of a serial input register of the efuse, and keep its
+ * other bits. The register is only read back from the efuse if its contents
+ * are unknown, and is only written if the bits change.
+ * @param register_cache The register cache of the efuse to write to
+ * @param si_register_address Serial input register being written to
+ * @param so_register_address Serial output register that reads back the
+ *                            serial input register
+ * @param mask The bits of the register being written
+ * @param bits The new value of the bits in mask
+ * @return EXIT_CODE_OK if the register holds the bits
+ *         EXIT_CODE_TIMEOUT if one of the SPI transfers timed-out
+ */
+ExitCode Io_EfuseRegisterCache_WriteRegisterBits(
+    struct EfuseRegisterCache *register_cache,
+    uint8_t                    si_register_address,
+    uint8_t                    so_register_address,
+    uint16_t                   mask,
+    uint16_t                   bits);
+
+/**
+ * Read a serial output register of the efuse
+ * @param register_cache The register cache of the efuse to read from
+ * @param register_address Serial output register being read from
+ * @param register_value The value read back from the serial output register
+ * @return EXIT_CODE_OK if the read was successful
+ *         EXIT_CODE_TIMEOUT if one of the SPI transfers timed-out
+ */
+ExitCode Io_EfuseRegisterCache_ReadRegister(
+    struct EfuseRegisterCache *register_cache,
+    uint8_t                    register_address,
+    uint16_t *                 register_value);
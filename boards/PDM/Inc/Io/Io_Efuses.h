@@ -0,0 +1,77 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "main.h"
+#include "App_SharedExitCode.h"
+
+// The efuses on the PDM, in the order their current sense outputs are
+// converted by the ADC
+enum EfuseId
+{
+    EFUSE_AUX1_AUX2,
+    EFUSE_AIR_SHDN_LV_PWR,
+    EFUSE_DI_BL_DI_BR,
+    EFUSE_DI_FL_DI_FR,
+    NUM_EFUSES,
+};
+
+// The outputs switched by the efuses, where output n is channel n % 2 of efuse
+// n / 2
+enum EfuseOutput
+{
+    EFUSE_OUTPUT_AUX1,
+    EFUSE_OUTPUT_AUX2,
+    EFUSE_OUTPUT_AIR_SHDN,
+    EFUSE_OUTPUT_LV_PWR,
+    EFUSE_OUTPUT_DI_BL,
+    EFUSE_OUTPUT_DI_BR,
+    EFUSE_OUTPUT_DI_FL,
+    EFUSE_OUTPUT_DI_FR,
+    NUM_EFUSE_OUTPUTS,
+};
+
+struct Efuse_Context;
+
+/**
+ * Create every efuse on the PDM
+ * @param spi_handle Handle to the SPI peripheral shared by the efuses
+ */
+void Io_Efuses_Init(SPI_HandleTypeDef *spi_handle);
+
+/**
+ * Get an efuse on the PDM
+ * @param efuse_id The efuse to get
+ * @return The efuse, which is owned by this module
+ */
+struct Efuse_Context *Io_Efuses_GetEfuse(enum EfuseId efuse_id);
+
+/**
+ * Switch the current sense output of an efuse to one of its channels
+ * @param efuse_id The efuse to switch, as an enum EfuseId
+ * @param channel The channel to switch to (0 or 1)
+ * @return EXIT_CODE_OK if the current sense output is switched to the channel
+ *         EXIT_CODE_TIMEOUT if one of the SPI transfers timed-out
+ */
+ExitCode Io_Efuses_SelectCurrentSense(uint32_t efuse_id, uint32_t channel);
+
+/**
+ * Check if the current sense output of an efuse is valid
+ * @param efuse_id The efuse to check, as an enum EfuseId
+ * @return true if the efuse's CSNS_SYNC pin is asserted, else false
+ */
+bool Io_Efuses_IsCurrentSenseSynced(uint32_t efuse_id);
+
+/**
+ * Turn an output of an efuse on or off
+ * @param output The output to turn on or off, as an enum EfuseOutput
+ * @param is_enabled true to turn the output on, else false
+ */
+void Io_Efuses_SetOutputEnabled(uint32_t output, bool is_enabled);
+
+/**
+ * Delatch the faults of an output's efuse channel, and leave the output as it
+ * was last turned on or off. The other output of the efuse is left untouched.
+ * @param output The output whose efuse to delatch, as an enum EfuseOutput
+ */
+void Io_Efuses_DelatchOutputFaults(uint32_t output);
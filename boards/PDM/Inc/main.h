@@ -72,6 +72,9 @@ extern "C"
 #define TASK1KHZ_STACK_SIZE 512
 #define TASKCANRX_STACK_SIZE 512
 #define TASKCANTX_STACK_SIZE 512
+#define TIMx_FREQUENCY 72000000
+#define TIM3_PRESCALER 72
+#define ADC_FREQUENCY 8000
 #define STATUS_R_Pin GPIO_PIN_13
 #define STATUS_R_GPIO_Port GPIOC
 #define STATUS_G_Pin GPIO_PIN_14
@@ -0,0 +1,73 @@
+#include <assert.h>
+#include <stdlib.h>
+
+#include "App_AnalogSense.h"
+
+struct AnalogSense
+{
+    const struct AnalogSenseChannelConfig *channel_configs;
+    uint32_t                               num_channels;
+    struct AdcPipeline *                   adc_pipeline;
+};
+
+struct AnalogSense *App_AnalogSense_Create(
+    const struct AnalogSenseChannelConfig *const channel_configs,
+    const uint32_t                               num_channels,
+    const uint32_t                               oversampling_ratio,
+    const float                                  reference_voltage,
+    const uint32_t                               full_scale)
+{
+    assert(num_channels > 0U && num_channels <= ADC_PIPELINE_MAX_CHANNELS);
+
+    struct AnalogSense *analog_sense = malloc(sizeof(struct AnalogSense));
+    assert(analog_sense != NULL);
+
+    struct AdcChannelConfig filters[ADC_PIPELINE_MAX_CHANNELS];
+
+    for (uint32_t i = 0U; i < num_channels; i++)
+    {
+        filters[i] = channel_configs[i].filter;
+    }
+
+    analog_sense->channel_configs = channel_configs;
+    analog_sense->num_channels    = num_channels;
+    analog_sense->adc_pipeline    = App_SharedAdcPipeline_Create(
+        num_channels, oversampling_ratio, reference_voltage, full_scale,
+        filters);
+
+    return analog_sense;
+}
+
+void App_AnalogSense_Destroy(struct AnalogSense *const analog_sense)
+{
+    App_SharedAdcPipeline_Destroy(analog_sense->adc_pipeline);
+    free(analog_sense);
+}
+
+void App_AnalogSense_ProcessBlock(
+    struct AnalogSense *const analog_sense,
+    const uint16_t *const     raw_adc_values,
+    const uint32_t            timestamp_ms)
+{
+    App_SharedAdcPipeline_ProcessBlock(
+        analog_sense->adc_pipeline, raw_adc_values, timestamp_ms);
+}
+
+struct AnalogSenseOutput App_AnalogSense_GetOutput(
+    const struct AnalogSense *const analog_sense,
+    const uint32_t                  channel)
+{
+    assert(channel < analog_sense->num_channels);
+
+    const struct AnalogSenseChannelConfig *const config =
+        &analog_sense->channel_configs[channel];
+    const struct AdcChannelOutput adc_output =
+        App_SharedAdcPipeline_GetOutput(analog_sense->adc_pipeline, channel);
+
+    const struct AnalogSenseOutput output = {
+        .value        = config->gain * adc_output.voltage + config->offset,
+        .timestamp_ms = adc_output.timestamp_ms,
+    };
+
+    return output;
+}
@@ -0,0 +1,209 @@
+#include <assert.h>
+#include <stdlib.h>
+
+#include "App_CurrentSenseScheduler.h"
+#include "configs/App_CurrentSenseSchedulerConfig.h"
+
+struct EfuseCurrentSense
+{
+    uint32_t selected_channel;
+    bool     is_channel_selected;
+    uint32_t ticks_since_armed;
+    uint32_t num_missed_samples;
+
+    struct CurrentSenseSample samples[NUM_EFUSE_CHANNELS];
+
+    // Shared with the DMA interrupt. A conversion is only sampled while the
+    // efuse is armed, and the sample is published by the next tick. The tick
+    // arms the efuse last, and the interrupt marks the sample pending last.
+    volatile bool     is_armed;
+    volatile uint32_t conversions_to_discard;
+    volatile bool     has_pending_sample;
+    volatile float    pending_current;
+    volatile uint32_t pending_timestamp_ms;
+};
+
+struct CurrentSenseScheduler
+{
+    uint32_t num_efuses;
+    ExitCode (*select_channel)(uint32_t efuse, uint32_t channel);
+    bool (*is_output_valid)(uint32_t efuse);
+
+    struct EfuseCurrentSense efuses[CURRENT_SENSE_MAX_EFUSES];
+};
+
+/**
+ * Publish the pending sample of the given efuse, or count it as missed if the
+ * efuse timed out
+ * @param efuse The efuse to publish the sample of
+ * @return true if the efuse is done with its selected channel, else false if
+ *         it is still waiting for a valid conversion
+ */
+static bool App_PublishSample(struct EfuseCurrentSense *efuse);
+
+static bool App_PublishSample(struct EfuseCurrentSense *const efuse)
+{
+    if (!efuse->is_armed)
+    {
+        return true;
+    }
+
+    if (efuse->has_pending_sample)
+    {
+        efuse->is_armed = false;
+
+        efuse->samples[efuse->selected_channel].current =
+            efuse->pending_current;
+        efuse->samples[efuse->selected_channel].timestamp_ms =
+            efuse->pending_timestamp_ms;
+
+        return true;
+    }
+
+    efuse->ticks_since_armed++;
+
+    if (efuse->ticks_since_armed < CURRENT_SENSE_TIMEOUT_TICKS)
+    {
+        return false;
+    }
+
+    efuse->is_armed = false;
+    efuse->num_missed_samples++;
+
+    return true;
+}
+
+struct CurrentSenseScheduler *App_CurrentSenseScheduler_Create(
+    const uint32_t num_efuses,
+    ExitCode (*const select_channel)(uint32_t, uint32_t),
+    bool (*const is_output_valid)(uint32_t))
+{
+    assert(num_efuses <= CURRENT_SENSE_MAX_EFUSES);
+
+    struct CurrentSenseScheduler *scheduler =
+        malloc(sizeof(struct CurrentSenseScheduler));
+    assert(scheduler != NULL);
+
+    scheduler->num_efuses      = num_efuses;
+    scheduler->select_channel  = select_channel;
+    scheduler->is_output_valid = is_output_valid;
+
+    for (uint32_t i = 0U; i < CURRENT_SENSE_MAX_EFUSES; i++)
+    {
+        struct EfuseCurrentSense *const efuse = &scheduler->efuses[i];
+
+        efuse->selected_channel    = 0U;
+        efuse->is_channel_selected = false;
+        efuse->ticks_since_armed   = 0U;
+        efuse->num_missed_samples  = 0U;
+
+        for (uint32_t channel = 0U; channel < NUM_EFUSE_CHANNELS; channel++)
+        {
+            efuse->samples[channel].current      = 0.0f;
+            efuse->samples[channel].timestamp_ms = 0U;
+        }
+
+        efuse->is_armed               = false;
+        efuse->conversions_to_discard = 0U;
+        efuse->has_pending_sample     = false;
+        efuse->pending_current        = 0.0f;
+        efuse->pending_timestamp_ms   = 0U;
+    }
+
+    return scheduler;
+}
+
+void App_CurrentSenseScheduler_Destroy(
+    struct CurrentSenseScheduler *const scheduler)
+{
+    free(scheduler);
+}
+
+void App_CurrentSenseScheduler_Tick(
+    struct CurrentSenseScheduler *const scheduler)
+{
+    for (uint32_t i = 0U; i < scheduler->num_efuses; i++)
+    {
+        struct EfuseCurrentSense *const efuse = &scheduler->efuses[i];
+
+        if (!App_PublishSample(efuse))
+        {
+            continue;
+        }
+
+        const uint32_t next_channel =
+            efuse->is_channel_selected
+                ? (efuse->selected_channel + 1U) % NUM_EFUSE_CHANNELS
+                : 0U;
+
+        // The efuse is disarmed while its current sense output is switched, so
+        // conversions from before the switch are never sampled
+        if (scheduler->select_channel(i, next_channel) != EXIT_CODE_OK)
+        {
+            // Which channel the efuse outputs is unknown, so the switch is
+            // retried on the next tick
+            efuse->num_missed_samples++;
+            continue;
+        }
+
+        efuse->selected_channel       = next_channel;
+        efuse->is_channel_selected    = true;
+        efuse->ticks_since_armed      = 0U;
+        efuse->has_pending_sample     = false;
+        efuse->conversions_to_discard = CURRENT_SENSE_DISCARDED_CONVERSIONS;
+        efuse->is_armed               = true;
+    }
+}
+
+void App_CurrentSenseScheduler_ProcessConversion(
+    struct CurrentSenseScheduler *const scheduler,
+    const float *const                  currents,
+    const uint32_t                      timestamp_ms)
+{
+    for (uint32_t i = 0U; i < scheduler->num_efuses; i++)
+    {
+        struct EfuseCurrentSense *const efuse = &scheduler->efuses[i];
+
+        if (!efuse->is_armed || efuse->has_pending_sample)
+        {
+            continue;
+        }
+
+        if (efuse->conversions_to_discard > 0U)
+        {
+            efuse->conversions_to_discard--;
+            continue;
+        }
+
+        // The current sense output is only within its specified accuracy
+        // while CSNS_SYNC is asserted
+        if (!scheduler->is_output_valid(i))
+        {
+            continue;
+        }
+
+        efuse->pending_current      = currents[i];
+        efuse->pending_timestamp_ms = timestamp_ms;
+        efuse->has_pending_sample   = true;
+    }
+}
+
+struct CurrentSenseSample App_CurrentSenseScheduler_GetSample(
+    const struct CurrentSenseScheduler *const scheduler,
+    const uint32_t                            efuse,
+    const uint32_t                            channel)
+{
+    assert(efuse < scheduler->num_efuses);
+    assert(channel < NUM_EFUSE_CHANNELS);
+
+    return scheduler->efuses[efuse].samples[channel];
+}
+
+uint32_t App_CurrentSenseScheduler_GetNumMissedSamples(
+    const struct CurrentSenseScheduler *const scheduler,
+    const uint32_t                            efuse)
+{
+    assert(efuse < scheduler->num_efuses);
+
+    return scheduler->efuses[efuse].num_missed_samples;
+}
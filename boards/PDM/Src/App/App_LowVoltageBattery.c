@@ -1,24 +1,155 @@
 #include <stdlib.h>
 #include <assert.h>
+#include <math.h>
 #include "App_LowVoltageBattery.h"
+#include "configs/App_LowVoltageBatteryConfig.h"
+
+#define SECONDS_PER_HOUR 3600.0f
+#define MINUTES_PER_HOUR 60.0f
+#define MS_PER_SECOND 1000.0f
 
 struct LowVoltageBattery
 {
     bool (*is_overvoltage)(void);
     bool (*has_charge_fault)(void);
     bool (*has_boost_fault)(void);
+    float (*get_battery_voltage)(void);
+    float (*get_load_current)(void);
+    float (*get_load_voltage)(void);
+    bool is_ocv_correction_enabled;
+
+    // Whether the state of charge has been initialized from the open-circuit
+    // voltage
+    bool     is_state_of_charge_initialized;
+    uint32_t last_update_ms;
+
+    // How long the battery current has been under LV_BATTERY_REST_CURRENT, in
+    // ms
+    uint32_t rest_duration_ms;
+
+    // The state of charge, in %
+    float state_of_charge;
+
+    // The current drawn from the battery, smoothed for the time to empty, in A
+    float filtered_current;
+
+    // The time to empty, in minutes
+    float time_to_empty;
 };
 
+/**
+ * Look up the state of charge of the battery from its open-circuit voltage,
+ * interpolating linearly between the entries of the OCV table
+ * @param battery_voltage The open-circuit voltage of the battery, in V
+ * @return The state of charge of the battery, in %
+ */
+static float App_GetStateOfChargeFromOpenCircuitVoltage(float battery_voltage);
+
+/**
+ * Get the current drawn from the battery by the loads on the boost controller
+ * output, which draw their power from the battery through the boost controller
+ * @param low_voltage_battery The low voltage battery to get the current of
+ * @param battery_voltage The voltage of the battery, in V
+ * @return The current drawn from the battery, in A
+ */
+static float App_GetBatteryCurrent(
+    const struct LowVoltageBattery *low_voltage_battery,
+    float                           battery_voltage);
+
+/**
+ * Update the time to empty of the given low voltage battery from its state of
+ * charge and smoothed current
+ * @param low_voltage_battery The low voltage battery to update
+ */
+static void
+    App_UpdateTimeToEmpty(struct LowVoltageBattery *low_voltage_battery);
+
+static float App_GetStateOfChargeFromOpenCircuitVoltage(float battery_voltage)
+{
+    static const float cell_ocv_table[LV_BATTERY_OCV_TABLE_SIZE] =
+        LV_BATTERY_CELL_OCV_TABLE;
+    const float state_of_charge_step =
+        100.0f / (float)(LV_BATTERY_OCV_TABLE_SIZE - 1U);
+    const float cell_voltage =
+        battery_voltage / (float)LV_BATTERY_NUM_SERIES_CELLS;
+
+    if (cell_voltage <= cell_ocv_table[0])
+    {
+        return 0.0f;
+    }
+
+    for (uint32_t i = 1U; i < LV_BATTERY_OCV_TABLE_SIZE; i++)
+    {
+        if (cell_voltage < cell_ocv_table[i])
+        {
+            const float fraction = (cell_voltage - cell_ocv_table[i - 1U]) /
+                                   (cell_ocv_table[i] - cell_ocv_table[i - 1U]);
+
+            return ((float)(i - 1U) + fraction) * state_of_charge_step;
+        }
+    }
+
+    return 100.0f;
+}
+
+static float App_GetBatteryCurrent(
+    const struct LowVoltageBattery *const low_voltage_battery,
+    const float                           battery_voltage)
+{
+    if (battery_voltage <= 0.0f)
+    {
+        return 0.0f;
+    }
+
+    const float load_power = low_voltage_battery->get_load_current() *
+                             low_voltage_battery->get_load_voltage();
+
+    return load_power / (battery_voltage * LV_BATTERY_BOOST_EFFICIENCY);
+}
+
+static void
+    App_UpdateTimeToEmpty(struct LowVoltageBattery *const low_voltage_battery)
+{
+    if (low_voltage_battery->filtered_current <= 0.0f)
+    {
+        low_voltage_battery->time_to_empty = LV_BATTERY_MAX_TIME_TO_EMPTY_MIN;
+        return;
+    }
+
+    const float remaining_capacity_ah =
+        low_voltage_battery->state_of_charge / 100.0f * LV_BATTERY_CAPACITY_AH;
+
+    low_voltage_battery->time_to_empty = fminf(
+        remaining_capacity_ah / low_voltage_battery->filtered_current *
+            MINUTES_PER_HOUR,
+        LV_BATTERY_MAX_TIME_TO_EMPTY_MIN);
+}
+
 struct LowVoltageBattery *App_LowVoltageBattery_Create(
     bool (*has_charge_fault)(void),
-    bool (*has_boost_fault)(void))
+    bool (*has_boost_fault)(void),
+    float (*get_battery_voltage)(void),
+    float (*get_load_current)(void),
+    float (*get_load_voltage)(void),
+    bool is_ocv_correction_enabled)
 {
     struct LowVoltageBattery *low_voltage_battery =
         malloc(sizeof(struct LowVoltageBattery));
     assert(low_voltage_battery != NULL);
 
-    low_voltage_battery->has_charge_fault = has_charge_fault;
-    low_voltage_battery->has_boost_fault  = has_boost_fault;
+    low_voltage_battery->has_charge_fault          = has_charge_fault;
+    low_voltage_battery->has_boost_fault           = has_boost_fault;
+    low_voltage_battery->get_battery_voltage       = get_battery_voltage;
+    low_voltage_battery->get_load_current          = get_load_current;
+    low_voltage_battery->get_load_voltage          = get_load_voltage;
+    low_voltage_battery->is_ocv_correction_enabled = is_ocv_correction_enabled;
+
+    low_voltage_battery->is_state_of_charge_initialized = false;
+    low_voltage_battery->last_update_ms                 = 0U;
+    low_voltage_battery->rest_duration_ms               = 0U;
+    low_voltage_battery->state_of_charge                = 0.0f;
+    low_voltage_battery->filtered_current               = 0.0f;
+    low_voltage_battery->time_to_empty = LV_BATTERY_MAX_TIME_TO_EMPTY_MIN;
 
     return low_voltage_battery;
 }
@@ -46,3 +177,81 @@ bool App_LowVoltageBattery_HasBoostControllerFault(
 {
     return low_voltage_battery->has_boost_fault();
 }
+
+void App_LowVoltageBattery_UpdateStateOfCharge(
+    struct LowVoltageBattery *const low_voltage_battery,
+    const uint32_t                  current_time_ms)
+{
+    const float battery_voltage = low_voltage_battery->get_battery_voltage();
+    const float battery_current =
+        App_GetBatteryCurrent(low_voltage_battery, battery_voltage);
+    const float ocv_state_of_charge =
+        App_GetStateOfChargeFromOpenCircuitVoltage(battery_voltage);
+
+    if (!low_voltage_battery->is_state_of_charge_initialized)
+    {
+        low_voltage_battery->is_state_of_charge_initialized = true;
+        low_voltage_battery->last_update_ms                 = current_time_ms;
+        low_voltage_battery->state_of_charge =
+            low_voltage_battery->is_ocv_correction_enabled
+                ? ocv_state_of_charge
+                : LV_BATTERY_UNCORRECTED_INITIAL_STATE_OF_CHARGE;
+        low_voltage_battery->filtered_current = battery_current;
+        App_UpdateTimeToEmpty(low_voltage_battery);
+        return;
+    }
+
+    const uint32_t elapsed_ms =
+        current_time_ms - low_voltage_battery->last_update_ms;
+    const float elapsed_s               = (float)elapsed_ms / MS_PER_SECOND;
+    low_voltage_battery->last_update_ms = current_time_ms;
+
+    // Count the charge drawn from the battery since the last update
+    float state_of_charge = low_voltage_battery->state_of_charge -
+                            battery_current * elapsed_s / SECONDS_PER_HOUR /
+                                LV_BATTERY_CAPACITY_AH * 100.0f;
+
+    if (fabsf(battery_current) < LV_BATTERY_REST_CURRENT)
+    {
+        if (low_voltage_battery->rest_duration_ms < LV_BATTERY_REST_TIME_MS)
+        {
+            low_voltage_battery->rest_duration_ms += elapsed_ms;
+        }
+    }
+    else
+    {
+        low_voltage_battery->rest_duration_ms = 0U;
+    }
+
+    // Once the battery has relaxed, its terminal voltage is its open-circuit
+    // voltage, which corrects the drift of the counted charge and re-anchors
+    // the state of charge after the battery is charged
+    if (low_voltage_battery->is_ocv_correction_enabled &&
+        low_voltage_battery->rest_duration_ms >= LV_BATTERY_REST_TIME_MS)
+    {
+        state_of_charge +=
+            (ocv_state_of_charge - state_of_charge) *
+            fminf(elapsed_s / LV_BATTERY_OCV_CORRECTION_TIME_CONSTANT_S, 1.0f);
+    }
+
+    low_voltage_battery->state_of_charge =
+        fminf(fmaxf(state_of_charge, 0.0f), 100.0f);
+
+    low_voltage_battery->filtered_current +=
+        (battery_current - low_voltage_battery->filtered_current) *
+        fminf(elapsed_s / LV_BATTERY_CURRENT_TIME_CONSTANT_S, 1.0f);
+
+    App_UpdateTimeToEmpty(low_voltage_battery);
+}
+
+float App_LowVoltageBattery_GetStateOfCharge(
+    const struct LowVoltageBattery *const low_voltage_battery)
+{
+    return low_voltage_battery->state_of_charge;
+}
+
+float App_LowVoltageBattery_GetTimeToEmpty(
+    const struct LowVoltageBattery *const low_voltage_battery)
+{
+    return low_voltage_battery->time_to_empty;
+}
@@ -0,0 +1,345 @@
+#include <assert.h>
+#include <stdlib.h>
+
+#include "App_OutputProtection.h"
+#include "configs/App_OutputProtectionConfig.h"
+
+// The shed priority threshold while no output is shed
+#define NO_OUTPUTS_SHED UINT32_MAX
+
+struct ProtectedOutput
+{
+    // The excess I²t of the output, in A²s
+    float i2t;
+
+    bool     is_tripped;
+    bool     is_latched_off;
+    uint32_t num_retries;
+    uint32_t ms_until_retry;
+    uint32_t ms_since_enabled;
+
+    // Whether the output was last turned on or off
+    bool is_enabled;
+};
+
+struct OutputProtection
+{
+    const struct OutputProtectionConfig *configs;
+    uint32_t                             num_outputs;
+    uint32_t                             tick_period_ms;
+    float (*get_current)(uint32_t output);
+    void (*set_enabled)(uint32_t output, bool is_enabled);
+    void (*delatch_faults)(uint32_t output);
+    float (*get_lv_battery_voltage)(void);
+
+    struct ProtectedOutput outputs[OUTPUT_PROTECTION_MAX_OUTPUTS];
+
+    // Every output with a shed priority at or above this threshold is shed
+    uint32_t shed_priority_threshold;
+    uint32_t ms_under_shed_voltage;
+    uint32_t ms_over_restore_voltage;
+};
+
+/**
+ * Trip an output, and schedule its next retry if it has any left
+ * @param output The output to trip
+ * @param config The config of the output
+ */
+static void App_TripOutput(
+    struct ProtectedOutput *             output,
+    const struct OutputProtectionConfig *config);
+
+/**
+ * Update the I²t of an output, and trip it if it crossed its trip curve or
+ * retry it once its retry delay is over
+ * @param protection The protection of the output
+ * @param index The index of the output
+ */
+static void
+    App_ProtectOutput(struct OutputProtection *protection, uint32_t index);
+
+/**
+ * Shed the next priority level of outputs while the LV battery voltage sags,
+ * and restore the last priority level of shed outputs once it recovers
+ * @param protection The protection to shed or restore outputs of
+ */
+static void App_ShedOutputs(struct OutputProtection *protection);
+
+static void App_TripOutput(
+    struct ProtectedOutput *const              output,
+    const struct OutputProtectionConfig *const config)
+{
+    output->is_tripped       = true;
+    output->ms_since_enabled = 0U;
+
+    if (output->num_retries >= config->max_retries)
+    {
+        output->is_latched_off = true;
+        return;
+    }
+
+    output->ms_until_retry = config->retry_delay_ms << output->num_retries;
+    output->num_retries++;
+}
+
+static void App_ProtectOutput(
+    struct OutputProtection *const protection,
+    const uint32_t                 index)
+{
+    struct ProtectedOutput *const output = &protection->outputs[index];
+    const struct OutputProtectionConfig *const config =
+        &protection->configs[index];
+
+    // An output that is off carries no current, so it cools down
+    const float current =
+        output->is_enabled ? protection->get_current(index) : 0.0f;
+    const float dt = (float)protection->tick_period_ms / 1000.0f;
+
+    output->i2t +=
+        (current * current - config->rated_current * config->rated_current) *
+        dt;
+
+    if (output->i2t < 0.0f)
+    {
+        output->i2t = 0.0f;
+    }
+    else if (output->i2t > config->trip_i2t)
+    {
+        output->i2t = config->trip_i2t;
+    }
+
+    if (output->is_latched_off)
+    {
+        return;
+    }
+
+    if (output->is_tripped)
+    {
+        if (output->ms_until_retry > protection->tick_period_ms)
+        {
+            output->ms_until_retry -= protection->tick_period_ms;
+            return;
+        }
+
+        // The efuse may have latched its own fault on the same overload
+        protection->delatch_faults(index);
+        output->is_tripped = false;
+        return;
+    }
+
+    if (current >= config->instantaneous_trip_current ||
+        output->i2t >= config->trip_i2t)
+    {
+        App_TripOutput(output, config);
+        return;
+    }
+
+    if (output->is_enabled)
+    {
+        output->ms_since_enabled += protection->tick_period_ms;
+
+        if (output->ms_since_enabled >= OUTPUT_PROTECTION_RETRY_RESET_MS)
+        {
+            output->num_retries = 0U;
+        }
+    }
+}
+
+static void App_ShedOutputs(struct OutputProtection *const protection)
+{
+    const float voltage = protection->get_lv_battery_voltage();
+
+    if (voltage < LOAD_SHED_VOLTAGE)
+    {
+        protection->ms_over_restore_voltage = 0U;
+        protection->ms_under_shed_voltage += protection->tick_period_ms;
+
+        if (protection->ms_under_shed_voltage < LOAD_SHED_DWELL_MS)
+        {
+            return;
+        }
+        protection->ms_under_shed_voltage = 0U;
+
+        // Shed the highest shed priority that isn't shed yet
+        uint32_t next_threshold = SHED_PRIORITY_NEVER;
+        for (uint32_t i = 0U; i < protection->num_outputs; i++)
+        {
+            const uint32_t priority = protection->configs[i].shed_priority;
+
+            if (priority < protection->shed_priority_threshold &&
+                priority > next_threshold)
+            {
+                next_threshold = priority;
+            }
+        }
+
+        if (next_threshold != SHED_PRIORITY_NEVER)
+        {
+            protection->shed_priority_threshold = next_threshold;
+        }
+    }
+    else if (voltage > LOAD_RESTORE_VOLTAGE)
+    {
+        protection->ms_under_shed_voltage = 0U;
+        protection->ms_over_restore_voltage += protection->tick_period_ms;
+
+        if (protection->ms_over_restore_voltage < LOAD_RESTORE_DWELL_MS)
+        {
+            return;
+        }
+        protection->ms_over_restore_voltage = 0U;
+
+        // Restore the lowest shed priority that is shed, by raising the
+        // threshold to the next shed priority above it
+        uint32_t next_threshold = NO_OUTPUTS_SHED;
+        for (uint32_t i = 0U; i < protection->num_outputs; i++)
+        {
+            const uint32_t priority = protection->configs[i].shed_priority;
+
+            if (priority > protection->shed_priority_threshold &&
+                priority < next_threshold)
+            {
+                next_threshold = priority;
+            }
+        }
+        protection->shed_priority_threshold = next_threshold;
+    }
+    else
+    {
+        protection->ms_under_shed_voltage   = 0U;
+        protection->ms_over_restore_voltage = 0U;
+    }
+}
+
+struct OutputProtection *App_OutputProtection_Create(
+    const struct OutputProtectionConfig *const configs,
+    const uint32_t                             num_outputs,
+    const uint32_t                             tick_period_ms,
+    float (*const get_current)(uint32_t),
+    void (*const set_enabled)(uint32_t, bool),
+    void (*const delatch_faults)(uint32_t),
+    float (*const get_lv_battery_voltage)(void))
+{
+    assert(configs != NULL);
+    assert(num_outputs <= OUTPUT_PROTECTION_MAX_OUTPUTS);
+    assert(tick_period_ms > 0U);
+
+    struct OutputProtection *protection =
+        malloc(sizeof(struct OutputProtection));
+    assert(protection != NULL);
+
+    protection->configs                = configs;
+    protection->num_outputs            = num_outputs;
+    protection->tick_period_ms         = tick_period_ms;
+    protection->get_current            = get_current;
+    protection->set_enabled            = set_enabled;
+    protection->delatch_faults         = delatch_faults;
+    protection->get_lv_battery_voltage = get_lv_battery_voltage;
+
+    protection->shed_priority_threshold = NO_OUTPUTS_SHED;
+    protection->ms_under_shed_voltage   = 0U;
+    protection->ms_over_restore_voltage = 0U;
+
+    for (uint32_t i = 0U; i < num_outputs; i++)
+    {
+        assert(configs[i].shed_priority != NO_OUTPUTS_SHED);
+
+        struct ProtectedOutput *const output = &protection->outputs[i];
+
+        output->i2t              = 0.0f;
+        output->is_tripped       = false;
+        output->is_latched_off   = false;
+        output->num_retries      = 0U;
+        output->ms_until_retry   = 0U;
+        output->ms_since_enabled = 0U;
+        output->is_enabled       = configs[i].is_enabled_by_default;
+
+        set_enabled(i, output->is_enabled);
+    }
+
+    return protection;
+}
+
+void App_OutputProtection_Destroy(struct OutputProtection *const protection)
+{
+    free(protection);
+}
+
+void App_OutputProtection_Tick(struct OutputProtection *const protection)
+{
+    for (uint32_t i = 0U; i < protection->num_outputs; i++)
+    {
+        App_ProtectOutput(protection, i);
+    }
+
+    if (protection->get_lv_battery_voltage != NULL)
+    {
+        App_ShedOutputs(protection);
+    }
+
+    for (uint32_t i = 0U; i < protection->num_outputs; i++)
+    {
+        struct ProtectedOutput *const output = &protection->outputs[i];
+
+        const bool is_enabled =
+            protection->configs[i].is_enabled_by_default &&
+            !output->is_tripped &&
+            !App_OutputProtection_IsOutputShed(protection, i);
+
+        if (is_enabled != output->is_enabled)
+        {
+            protection->set_enabled(i, is_enabled);
+            output->is_enabled       = is_enabled;
+            output->ms_since_enabled = 0U;
+        }
+    }
+}
+
+bool App_OutputProtection_IsOutputEnabled(
+    const struct OutputProtection *const protection,
+    const uint32_t                       output)
+{
+    assert(output < protection->num_outputs);
+
+    return protection->outputs[output].is_enabled;
+}
+
+bool App_OutputProtection_IsOutputTripped(
+    const struct OutputProtection *const protection,
+    const uint32_t                       output)
+{
+    assert(output < protection->num_outputs);
+
+    return protection->outputs[output].is_tripped;
+}
+
+bool App_OutputProtection_IsOutputLatchedOff(
+    const struct OutputProtection *const protection,
+    const uint32_t                       output)
+{
+    assert(output < protection->num_outputs);
+
+    return protection->outputs[output].is_latched_off;
+}
+
+bool App_OutputProtection_IsOutputShed(
+    const struct OutputProtection *const protection,
+    const uint32_t                       output)
+{
+    assert(output < protection->num_outputs);
+
+    const uint32_t priority = protection->configs[output].shed_priority;
+
+    return priority != SHED_PRIORITY_NEVER &&
+           priority >= protection->shed_priority_threshold;
+}
+
+float App_OutputProtection_GetThermalLoad(
+    const struct OutputProtection *const protection,
+    const uint32_t                       output)
+{
+    assert(output < protection->num_outputs);
+
+    return protection->outputs[output].i2t /
+           protection->configs[output].trip_i2t;
+}
@@ -21,6 +21,7 @@ struct PdmWorld
     struct HeartbeatMonitor * heartbeat_monitor;
     struct RgbLedSequence *   rgb_led_sequence;
     struct LowVoltageBattery *low_voltage_battery;
+    struct OutputProtection * output_protection;
     struct Clock *            clock;
 };
 
@@ -40,6 +41,7 @@ struct PdmWorld *App_PdmWorld_Create(
     struct HeartbeatMonitor *const  heartbeat_monitor,
     struct RgbLedSequence *const    rgb_led_sequence,
     struct LowVoltageBattery *const low_voltage_battery,
+    struct OutputProtection *const  output_protection,
     struct Clock *const             clock)
 {
     struct PdmWorld *world = (struct PdmWorld *)malloc(sizeof(struct PdmWorld));
@@ -64,6 +66,7 @@ struct PdmWorld *App_PdmWorld_Create(
     world->heartbeat_monitor   = heartbeat_monitor;
     world->rgb_led_sequence    = rgb_led_sequence;
     world->low_voltage_battery = low_voltage_battery;
+    world->output_protection   = output_protection;
     world->clock               = clock;
 
     return world;
@@ -164,6 +167,12 @@ struct LowVoltageBattery *
     return world->low_voltage_battery;
 }
 
+struct OutputProtection *
+    App_PdmWorld_GetOutputProtection(const struct PdmWorld *const world)
+{
+    return world->output_protection;
+}
+
 struct Clock *App_PdmWorld_GetClock(const struct PdmWorld *const world)
 {
     return world->clock;
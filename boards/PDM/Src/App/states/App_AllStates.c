@@ -15,6 +15,7 @@ void App_AllStatesRunOnTick100Hz(struct StateMachine *const state_machine)
     struct PdmCanTxInterface *can_tx = App_PdmWorld_GetCanTx(world);
     struct LowVoltageBattery *low_voltage_battery =
         App_PdmWorld_GetLowVoltageBattery(world);
+    struct Clock *clock = App_PdmWorld_GetClock(world);
 
     if (App_LowVoltageBattery_HasChargeFault(low_voltage_battery))
     {
@@ -33,4 +34,21 @@ void App_AllStatesRunOnTick100Hz(struct StateMachine *const state_machine)
     {
         App_CanTx_SetPeriodicSignal_BOOST_PGOOD_FAULT(can_tx, false);
     }
+
+    App_LowVoltageBattery_UpdateStateOfCharge(
+        low_voltage_battery,
+        App_SharedClock_GetCurrentTimeInMilliseconds(clock));
+    App_CanTx_SetPeriodicSignal_GLV_STATE_OF_CHARGE(
+        can_tx, App_LowVoltageBattery_GetStateOfCharge(low_voltage_battery));
+    App_CanTx_SetPeriodicSignal_GLV_TIME_TO_EMPTY(
+        can_tx, App_LowVoltageBattery_GetTimeToEmpty(low_voltage_battery));
+}
+
+void App_AllStatesRunOnTick1kHz(struct StateMachine *const state_machine)
+{
+    struct PdmWorld *world = App_SharedStateMachine_GetWorld(state_machine);
+    struct OutputProtection *output_protection =
+        App_PdmWorld_GetOutputProtection(world);
+
+    App_OutputProtection_Tick(output_protection);
 }
@@ -39,6 +39,11 @@ static void InitStateRunOnTick100Hz(struct StateMachine *const state_machine)
     App_CanTx_SetPeriodicSignal_AIR_SHUTDOWN_CURRENT(can_tx, NAN);
 }
 
+static void InitStateRunOnTick1kHz(struct StateMachine *const state_machine)
+{
+    App_AllStatesRunOnTick1kHz(state_machine);
+}
+
 static void InitStateRunOnExit(struct StateMachine *const state_machine)
 {
     UNUSED(state_machine);
@@ -51,6 +56,7 @@ const struct State *App_GetInitState()
         .run_on_entry      = InitStateRunOnEntry,
         .run_on_tick_1Hz   = InitStateRunOnTick1Hz,
         .run_on_tick_100Hz = InitStateRunOnTick100Hz,
+        .run_on_tick_1kHz  = InitStateRunOnTick1kHz,
         .run_on_exit       = InitStateRunOnExit,
     };
 
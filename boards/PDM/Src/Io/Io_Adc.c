@@ -1,98 +1,67 @@
+#include <assert.h>
 #include <stm32f3xx.h>
 #include "Io_SharedAdc.h"
 #include "Io_Adc.h"
+#include "configs/App_AnalogSenseConfig.h"
 
 // In STM32 terminology, each ADC pin corresponds to an ADC channel (See:
 // ADCEx_channels). If there are multiple ADC channels being measured, the ADC
 // measures them based on "rank" (See: ADCEx_regular_rank). The rank starts
 // counting at 1, and the lower the rank, the higher the measurement priority.
 //
-// For example, suppose we are measuring ADC channel 2, 4, and 7, which have
-// rank 3, 1, and 2 respectively. The ADC will measure the channel 4, then
-// channel 7, and finally channel 2. This order is important because it
-// determines the order in which the DMA writes data to our raw_adc_values
-// buffer.
-//
-// The following enum is used to index into raw_adc_values, which means it must
-// be ordered in ascending ranks. If we were writing an enum for the earlier
-// example, it would look like:
-//
-// enum
-// {
-//     CHANNEL_4, // Rank 1
-//     CHANNEL_7, // Rank 2
-//     CHANNEL_2, // Rank 3
-//     NUM_ADC_CHANNELS,
-// };
-enum
-{
-    CHANNEL_1,
-    CHANNEL_2,
-    CHANNEL_3,
-    CHANNEL_6,
-    CHANNEL_7,
-    CHANNEL_8,
-    CHANNEL_9,
-    NUM_ADC_CHANNELS
-};
+// This order determines the order in which the DMA writes data to each scan in
+// our raw_adc_values buffer, so enum AnalogSenseChannel must be ordered in
+// ascending ranks.
 
-static uint16_t raw_adc_values[NUM_ADC_CHANNELS];
-static float    adc_voltages[NUM_ADC_CHANNELS];
+// TIM3 triggers a scan at ADC_FREQUENCY, and this many scans are averaged into
+// one sample per channel
+#define ADC_OVERSAMPLING_RATIO 2U
+#define NUM_RAW_ADC_VALUES_PER_BLOCK \
+    (ADC_OVERSAMPLING_RATIO * NUM_ANALOG_SENSE_CHANNELS)
 
-void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef *hadc)
-{
-    adc_voltages[CHANNEL_1] = Io_SharedAdc_ConvertRawAdcValueToVoltage(
-        hadc, raw_adc_values[CHANNEL_1]);
-    adc_voltages[CHANNEL_2] = Io_SharedAdc_ConvertRawAdcValueToVoltage(
-        hadc, raw_adc_values[CHANNEL_2]);
-    adc_voltages[CHANNEL_3] = Io_SharedAdc_ConvertRawAdcValueToVoltage(
-        hadc, raw_adc_values[CHANNEL_3]);
-    adc_voltages[CHANNEL_6] = Io_SharedAdc_ConvertRawAdcValueToVoltage(
-        hadc, raw_adc_values[CHANNEL_6]);
-    adc_voltages[CHANNEL_7] = Io_SharedAdc_ConvertRawAdcValueToVoltage(
-        hadc, raw_adc_values[CHANNEL_7]);
-    adc_voltages[CHANNEL_8] = Io_SharedAdc_ConvertRawAdcValueToVoltage(
-        hadc, raw_adc_values[CHANNEL_8]);
-    adc_voltages[CHANNEL_9] = Io_SharedAdc_ConvertRawAdcValueToVoltage(
-        hadc, raw_adc_values[CHANNEL_9]);
-}
+// The DMA controller writes into one half of this buffer while the other half
+// is processed
+static uint16_t            raw_adc_values[2U * NUM_RAW_ADC_VALUES_PER_BLOCK];
+static struct AnalogSense *analog_sense;
+static void (*block_processed_callback)(uint32_t timestamp_ms);
 
-uint16_t *Io_Adc_GetRawAdcValues(void)
+void Io_Adc_Init(
+    ADC_HandleTypeDef *const hadc,
+    void (*const block_processed)(uint32_t timestamp_ms))
 {
-    return raw_adc_values;
-}
+    assert(hadc->Init.NbrOfConversion == NUM_ANALOG_SENSE_CHANNELS);
 
-float Io_Adc_GetChannel1Voltage(void)
-{
-    return adc_voltages[CHANNEL_1];
-}
+    analog_sense = App_AnalogSense_Create(
+        analog_sense_channel_configs, NUM_ANALOG_SENSE_CHANNELS,
+        ADC_OVERSAMPLING_RATIO, ADC_REFERENCE_VOLTAGE,
+        Io_SharedAdc_GetFullScale(hadc));
+    block_processed_callback = block_processed;
 
-float Io_Adc_GetChannel2Voltage(void)
-{
-    return adc_voltages[CHANNEL_2];
-}
-
-float Io_Adc_GetChannel3Voltage(void)
-{
-    return adc_voltages[CHANNEL_3];
+    HAL_ADC_Start_DMA(
+        hadc, (uint32_t *)raw_adc_values,
+        sizeof(raw_adc_values) / sizeof(raw_adc_values[0]));
 }
 
-float Io_Adc_GetChannel6Voltage(void)
+void HAL_ADC_ConvHalfCpltCallback(ADC_HandleTypeDef *hadc)
 {
-    return adc_voltages[CHANNEL_6];
+    UNUSED(hadc);
+    const uint32_t timestamp_ms = HAL_GetTick();
+    App_AnalogSense_ProcessBlock(
+        analog_sense, &raw_adc_values[0], timestamp_ms);
+    block_processed_callback(timestamp_ms);
 }
 
-float Io_Adc_GetChannel7Voltage(void)
-{
-    return adc_voltages[CHANNEL_7];
-}
-
-float Io_Adc_GetChannel8Voltage(void)
+void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef *hadc)
 {
-    return adc_voltages[CHANNEL_8];
+    UNUSED(hadc);
+    const uint32_t timestamp_ms = HAL_GetTick();
+    App_AnalogSense_ProcessBlock(
+        analog_sense, &raw_adc_values[NUM_RAW_ADC_VALUES_PER_BLOCK],
+        timestamp_ms);
+    block_processed_callback(timestamp_ms);
 }
 
-float Io_Adc_GetChannel9Voltage(void)
+struct AnalogSenseOutput Io_Adc_GetOutput(const enum AnalogSenseChannel channel)
 {
-    return adc_voltages[CHANNEL_9];
+    return App_AnalogSense_GetOutput(analog_sense, channel);
 }
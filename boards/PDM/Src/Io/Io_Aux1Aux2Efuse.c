@@ -1,18 +1,12 @@
 #include "Io_Aux1Aux2Efuse.h"
+#include "Io_Efuses.h"
 #include "configs/Io_EfuseConfig.h"
 
 static struct Efuse_Context *aux1_aux2_efuse;
 
-void Io_Aux1Aux2Efuse_Init(SPI_HandleTypeDef *const spi_handle)
+void Io_Aux1Aux2Efuse_Init(void)
 {
-    assert(spi_handle != NULL);
-
-    aux1_aux2_efuse = Io_Efuse_Create(
-        Io_CurrentSense_GetAux1Current, Io_CurrentSense_GetAux2Current,
-        spi_handle, CSB_AUX1_AUX2_GPIO_Port, CSB_AUX1_AUX2_Pin,
-        FSOB_AUX1_AUX2_GPIO_Port, FSOB_AUX1_AUX2_Pin, FSB_AUX1_AUX2_GPIO_Port,
-        FSB_AUX1_AUX2_Pin, CUR_SYNC_AUX1_AUX2_GPIO_Port, CUR_SYNC_AUX1_AUX2_Pin,
-        PIN_AUX1_GPIO_Port, PIN_AUX1_Pin, PIN_AUX2_GPIO_Port, PIN_AUX2_Pin);
+    aux1_aux2_efuse = Io_Efuses_GetEfuse(EFUSE_AUX1_AUX2);
 }
 
 void Io_Aux1Aux2Efuse_EnableAux1(void)
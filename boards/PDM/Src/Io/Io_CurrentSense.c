@@ -1,44 +1,95 @@
+#include <assert.h>
 #include "Io_CurrentSense.h"
 #include "Io_Adc.h"
+#include "Io_Efuses.h"
 #include "main.h"
 
-float Io_CurrentSense_GetAux1Current(void)
+static struct CurrentSenseScheduler *current_sense_scheduler;
+
+void Io_CurrentSense_Init(struct CurrentSenseScheduler *const scheduler)
 {
-    // Aux1 Current = ADC Voltage * Current Gain Ratio
+    assert(scheduler != NULL);
 
-    const float LOW_CURRENT_SENSE_GAIN_RATIO = 500.0f;
-    return (Io_Adc_GetChannel6Voltage() * LOW_CURRENT_SENSE_GAIN_RATIO);
+    current_sense_scheduler = scheduler;
 }
 
-float Io_CurrentSense_GetAux2Current(void)
+void Io_CurrentSense_ProcessAdcBlock(const uint32_t timestamp_ms)
+{
+    // The current sense output of each efuse is wired to its own ADC channel,
+    // which is calibrated to the load current of the selected channel
+    const float currents[NUM_EFUSES] = {
+        [EFUSE_AUX1_AUX2] = Io_Adc_GetOutput(ANALOG_SENSE_CSNS_AUX1_AUX2).value,
+        [EFUSE_AIR_SHDN_LV_PWR] =
+            Io_Adc_GetOutput(ANALOG_SENSE_CSNS_AIR_SHDN_LV_PWR).value,
+        [EFUSE_DI_BL_DI_BR] =
+            Io_Adc_GetOutput(ANALOG_SENSE_CSNS_DI_BL_DI_BR).value,
+        [EFUSE_DI_FL_DI_FR] =
+            Io_Adc_GetOutput(ANALOG_SENSE_CSNS_DI_FL_DI_FR).value,
+    };
+
+    App_CurrentSenseScheduler_ProcessConversion(
+        current_sense_scheduler, currents, timestamp_ms);
+}
+
+float Io_CurrentSense_GetOutputCurrent(const uint32_t output)
+{
+    assert(output < NUM_EFUSE_OUTPUTS);
+
+    return App_CurrentSenseScheduler_GetSample(
+               current_sense_scheduler, output / NUM_EFUSE_CHANNELS,
+               output % NUM_EFUSE_CHANNELS)
+        .current;
+}
+
+float Io_CurrentSense_GetTotalOutputCurrent(void)
+{
+    float total_current = 0.0f;
+
+    for (uint32_t output = 0U; output < NUM_EFUSE_OUTPUTS; output++)
+    {
+        total_current += Io_CurrentSense_GetOutputCurrent(output);
+    }
+
+    return total_current;
+}
+
+float Io_CurrentSense_GetAux1Current(void)
 {
-    // Aux2 Current = ADC Voltage * Current Gain Ratio
+    return Io_CurrentSense_GetOutputCurrent(EFUSE_OUTPUT_AUX1);
+}
 
-    const float LOW_CURRENT_SENSE_GAIN_RATIO = 500.0f;
-    return (Io_Adc_GetChannel7Voltage() * LOW_CURRENT_SENSE_GAIN_RATIO);
+float Io_CurrentSense_GetAux2Current(void)
+{
+    return Io_CurrentSense_GetOutputCurrent(EFUSE_OUTPUT_AUX2);
 }
 
 float Io_CurrentSense_GetLeftInverterCurrent(void)
 {
-    return 0.5f;
+    return Io_CurrentSense_GetOutputCurrent(EFUSE_OUTPUT_DI_FL) +
+           Io_CurrentSense_GetOutputCurrent(EFUSE_OUTPUT_DI_BL);
 }
 
 float Io_CurrentSense_GetRightInverterCurrent(void)
 {
-    return 0.5f;
+    return Io_CurrentSense_GetOutputCurrent(EFUSE_OUTPUT_DI_FR) +
+           Io_CurrentSense_GetOutputCurrent(EFUSE_OUTPUT_DI_BR);
 }
 
 float Io_CurrentSense_GetEnergyMeterCurrent(void)
 {
-    return 0.5f;
+    // The energy meter isn't powered through an efuse on this PDM, so none of
+    // its current is sensed
+    return 0.0f;
 }
 
 float Io_CurrentSense_GetCanCurrent(void)
 {
-    return 0.5f;
+    // The CAN transceivers aren't powered through an efuse on this PDM, so none
+    // of their current is sensed
+    return 0.0f;
 }
 
 float Io_CurrentSense_GetAirShutdownCurrent(void)
 {
-    return 0.5f;
+    return Io_CurrentSense_GetOutputCurrent(EFUSE_OUTPUT_AIR_SHDN);
 }
@@ -2,6 +2,7 @@
 #include <math.h>
 #include <stdlib.h>
 #include "Io_Efuse.h"
+#include "Io_EfuseRegisterCache.h"
 #include "configs/Io_EfuseConfig.h"
 
 struct Efuse_Context
@@ -25,121 +26,32 @@ struct Efuse_Context
     GPIO_TypeDef *channel_1_port;
     uint16_t      channel_1_pin;
 
-    // The current state of the watchdog-in bit (bit 15). If the watchdog is
-    // enabled its state must be alternated at least once within the watchdog
-    // timeout period.
-    bool wdin_bit_to_set;
+    struct EfuseRegisterCache *register_cache;
 };
 
 /**
- * Calculate the parity of the SPI command to be sent to the efuse and
- * set/clear the parity bit. Using the XOR sum of bits method taken from:
- * https://en.wikipedia.org/wiki/Parity_bit#Parity
- * @param spi_command Original SPI command without the parity bit set/cleared
+ * Send a 16-bit SPI frame to the given efuse in blocking mode, and receive the
+ * frame the efuse sends back at the same time
+ * @param efuse Pointer to the efuse the frame is sent to
+ * @param tx_data The frame being sent to the efuse
+ * @param rx_data The frame received from the efuse
+ * @return EXIT_CODE_OK if the transfer was successful
+ *         EXIT_CODE_TIMEOUT if the SPI transfer timed-out
  */
-static void Io_Efuse_CalculateParityBit(uint16_t *serial_data_input);
+static ExitCode Io_Efuse_TransferFrame(
+    const struct Efuse_Context *efuse,
+    uint16_t                    tx_data,
+    uint16_t *                  rx_data);
 
-/**
- * Write SPI data to efuse in blocking mode
- * @param tx_data Pointer to data being sent to the efuse
- * @param efuse_spi_handle Handle to the efuse's SPI peripheral
- * @param nss_port Handle to the GPIO port of the efuse's NSS pin
- * @param nss_pin Efuse's GPIO NSS pin
- * @return EXIT_CODE_OK if the write was successful
- *         EXIT_CODE_TIMEOUT if the SPI write timed-out
- */
-static ExitCode Io_Efuse_WriteToEfuse(
-    uint16_t *         tx_data,
-    SPI_HandleTypeDef *efuse_spi_handle,
-    GPIO_TypeDef *     nss_port,
-    uint16_t           nss_pin);
-
-/**
- * Read SPI data from efuse in blocking mode
- * @param tx_data Pointer to data being sent to the efuse
- * @param rx_data Pointer to data being received from the efuse
- * @param efuse_spi_handle Handle to the efuse's SPI peripheral
- * @param nss_port Handle to the GPIO port of the efuse's NSS pin
- * @param nss_pin Efuse's GPIO NSS pin
- * @return EXIT_CODE_OK if the read was successful
- *         EXIT_CODE_TIMEOUT if the SPI read timed-out
- */
-static ExitCode Io_Efuse_ReadFromEfuse(
-    uint16_t *         tx_data,
-    uint16_t *         rx_data,
-    SPI_HandleTypeDef *efuse_spi_handle,
-    GPIO_TypeDef *     nss_port,
-    uint16_t           nss_pin);
-
-static void Io_Efuse_CalculateParityBit(uint16_t *serial_data_input)
+static ExitCode Io_Efuse_TransferFrame(
+    const struct Efuse_Context *const efuse,
+    uint16_t                          tx_data,
+    uint16_t *const                   rx_data)
 {
-    uint16_t _serial_data_input = *serial_data_input;
-    bool     parity_bit;
-
-    for (parity_bit = 0; _serial_data_input > 0; _serial_data_input >>= 1)
-    {
-        parity_bit ^= READ_BIT(_serial_data_input, 1U);
-    }
-
-    if (parity_bit)
-    {
-        SET_BIT_UINT16(*serial_data_input, PARITY_BIT);
-    }
-    else
-    {
-        CLEAR_BIT_UINT16(*serial_data_input, PARITY_BIT);
-    }
-}
-
-static ExitCode Io_Efuse_WriteToEfuse(
-    uint16_t *         tx_data,
-    SPI_HandleTypeDef *efuse_spi_handle,
-    GPIO_TypeDef *     nss_port,
-    uint16_t           nss_pin)
-{
-    HAL_StatusTypeDef status = HAL_OK;
-
-    HAL_GPIO_WritePin(nss_port, nss_pin, GPIO_PIN_RESET);
-    status = HAL_SPI_TransmitReceive(
-        efuse_spi_handle, (uint8_t *)tx_data, (uint8_t *)tx_data, 1U, 100U);
-    HAL_GPIO_WritePin(nss_port, nss_pin, GPIO_PIN_SET);
-
-    if (status != HAL_OK)
-    {
-        return EXIT_CODE_TIMEOUT;
-    }
-
-    return EXIT_CODE_OK;
-}
-
-static ExitCode Io_Efuse_ReadFromEfuse(
-    uint16_t *         tx_data,
-    uint16_t *         rx_data,
-    SPI_HandleTypeDef *efuse_spi_handle,
-    GPIO_TypeDef *     nss_port,
-    uint16_t           nss_pin)
-{
-    // Send the command stored in tx_data to the status register, to read the
-    // data from the register address specified in tx_data
-    HAL_GPIO_WritePin(nss_port, nss_pin, GPIO_PIN_RESET);
-    HAL_StatusTypeDef status = HAL_SPI_TransmitReceive(
-        efuse_spi_handle, (uint8_t *)tx_data, (uint8_t *)rx_data, 1U, 100U);
-    HAL_GPIO_WritePin(nss_port, nss_pin, GPIO_PIN_SET);
-
-    if (status != HAL_OK)
-    {
-        return EXIT_CODE_TIMEOUT;
-    }
-
-    // Receive data from the register address specified in tx_data by sending
-    // dummy data
-    *tx_data = 0xFFFF;
-    // The data read from the register specified in tx_data is stored in rx_data
-    // after the SPI transfer
-    HAL_GPIO_WritePin(nss_port, nss_pin, GPIO_PIN_RESET);
-    status = HAL_SPI_TransmitReceive(
-        efuse_spi_handle, (uint8_t *)tx_data, (uint8_t *)rx_data, 1U, 100U);
-    HAL_GPIO_WritePin(nss_port, nss_pin, GPIO_PIN_SET);
+    HAL_GPIO_WritePin(efuse->nss_port, efuse->nss_pin, GPIO_PIN_RESET);
+    const HAL_StatusTypeDef status = HAL_SPI_TransmitReceive(
+        efuse->spi_handle, (uint8_t *)&tx_data, (uint8_t *)rx_data, 1U, 100U);
+    HAL_GPIO_WritePin(efuse->nss_port, efuse->nss_pin, GPIO_PIN_SET);
 
     if (status != HAL_OK)
     {
@@ -186,11 +98,18 @@ struct Efuse_Context *Io_Efuse_Create(
     efuse_context->channel_0_pin         = channel_0_pin;
     efuse_context->channel_1_port        = channel_1_port;
     efuse_context->channel_1_pin         = channel_1_pin;
-    efuse_context->wdin_bit_to_set       = true;
+    efuse_context->register_cache =
+        Io_EfuseRegisterCache_Create(Io_Efuse_TransferFrame, efuse_context);
 
     return efuse_context;
 }
 
+void Io_Efuse_Destroy(struct Efuse_Context *const efuse)
+{
+    Io_EfuseRegisterCache_Destroy(efuse->register_cache);
+    free(efuse);
+}
+
 void Io_Efuse_EnableChannel0(const struct Efuse_Context *const efuse)
 {
     HAL_GPIO_WritePin(
@@ -219,32 +138,20 @@ ExitCode Io_Efuse_ConfigureChannelMonitoring(
     uint8_t                     monitoring_function,
     struct Efuse_Context *const efuse)
 {
-    uint16_t register_value;
-
-    // Read the original contents of the GCR Register
-    RETURN_CODE_IF_EXIT_NOT_OK(
-        Io_Efuse_ReadRegister(SI_GCR_ADDR, &register_value, efuse));
-
-    // Clear the previous monitoring configuration
-    CLEAR_BIT_UINT16(register_value, (CSNS1_EN_MASK | CSNS0_EN_MASK));
-
-    // Set the new monitoring configuration
-    SET_BIT_UINT16(
-        register_value,
-        (monitoring_function & (CSNS1_EN_MASK | CSNS0_EN_MASK)));
-
-    // Write back new monitoring configuration to the efuse
-    RETURN_CODE_IF_EXIT_NOT_OK(
-        Io_Efuse_WriteRegister(SI_GCR_ADDR, register_value, efuse));
-
-    return EXIT_CODE_OK;
+    // The GCR Register is only read back if its contents are unknown, and only
+    // written if the monitoring configuration changes
+    return Io_EfuseRegisterCache_WriteRegisterBits(
+        efuse->register_cache, SI_GCR_ADDR, SO_GCR_ADDR,
+        CSNS1_EN_MASK | CSNS0_EN_MASK, monitoring_function);
 }
 
 ExitCode Io_Efuse_ExitFailSafeMode(struct Efuse_Context *const efuse)
 {
     // Set the WDIN bit (15th bit) to exit out of fail-safe mode. The parity bit
-    // (14th bit) will automatically be set in Io_Efuse_WriteRegister.
-    efuse->wdin_bit_to_set = true;
+    // (14th bit) will automatically be set in Io_Efuse_WriteRegister. The
+    // registers can't be trusted after fail-safe mode, so every register is
+    // written again.
+    Io_EfuseRegisterCache_Reset(efuse->register_cache);
 
     RETURN_CODE_IF_EXIT_NOT_OK(
         Io_Efuse_WriteRegister(SI_STATR_0_ADDR, 0x0000, efuse));
@@ -274,14 +181,26 @@ bool Io_Efuse_IsEfuseInFailSafeMode(const struct Efuse_Context *const efuse)
 
 void Io_Efuse_DelatchFaults(const struct Efuse_Context *const efuse)
 {
-    // Delatch the latchable faults by alternating channel 0's and channel 1's
-    // input pins high->low->high.
+    Io_Efuse_DelatchChannel0Faults(efuse);
+    Io_Efuse_DelatchChannel1Faults(efuse);
+}
+
+void Io_Efuse_DelatchChannel0Faults(const struct Efuse_Context *const efuse)
+{
+    // Delatch the latchable faults by alternating channel 0's input pin
+    // high->low->high
     HAL_GPIO_WritePin(
         efuse->channel_0_port, efuse->channel_0_pin, GPIO_PIN_SET);
     HAL_GPIO_WritePin(
         efuse->channel_0_port, efuse->channel_0_pin, GPIO_PIN_RESET);
     HAL_GPIO_WritePin(
         efuse->channel_0_port, efuse->channel_0_pin, GPIO_PIN_SET);
+}
+
+void Io_Efuse_DelatchChannel1Faults(const struct Efuse_Context *const efuse)
+{
+    // Delatch the latchable faults by alternating channel 1's input pin
+    // high->low->high
     HAL_GPIO_WritePin(
         efuse->channel_1_port, efuse->channel_1_pin, GPIO_PIN_SET);
     HAL_GPIO_WritePin(
@@ -290,44 +209,31 @@ void Io_Efuse_DelatchFaults(const struct Efuse_Context *const efuse)
         efuse->channel_1_port, efuse->channel_1_pin, GPIO_PIN_SET);
 }
 
+bool Io_Efuse_IsCurrentSenseSynced(const struct Efuse_Context *const efuse)
+{
+    return HAL_GPIO_ReadPin(
+               efuse->current_sync_port, efuse->current_sync_pin) ==
+           GPIO_PIN_RESET;
+}
+
 float Io_Efuse_GetChannel0Current(struct Efuse_Context *const efuse)
 {
-    if (Io_Efuse_ConfigureChannelMonitoring(CSNS_FUNCTION_CURRENT_CH0, efuse) !=
-        EXIT_CODE_OK)
+    if (efuse->get_channel_0_current == NULL)
     {
-        // Return NAN if selecting the current sense channel fails
         return NAN;
     }
 
-    if (HAL_GPIO_ReadPin(efuse->current_sync_port, efuse->current_sync_pin) ==
-        GPIO_PIN_RESET)
-    {
-        return efuse->get_channel_0_current();
-    }
-
-    // Return NAN if the current sense output signal is not within the specified
-    // accuracy range
-    return NAN;
+    return efuse->get_channel_0_current();
 }
 
 float Io_Efuse_GetChannel1Current(struct Efuse_Context *const efuse)
 {
-    if (Io_Efuse_ConfigureChannelMonitoring(CSNS_FUNCTION_CURRENT_CH1, efuse) !=
-        EXIT_CODE_OK)
+    if (efuse->get_channel_1_current == NULL)
     {
-        // Return NAN if selecting the current sense channel fails
         return NAN;
     }
 
-    if (HAL_GPIO_ReadPin(efuse->current_sync_port, efuse->current_sync_pin) ==
-        GPIO_PIN_RESET)
-    {
-        return efuse->get_channel_1_current();
-    }
-
-    // Return NAN if the current sense output signal is not within the specified
-    // accuracy range
-    return NAN;
+    return efuse->get_channel_1_current();
 }
 
 ExitCode Io_Efuse_WriteRegister(
@@ -335,30 +241,8 @@ ExitCode Io_Efuse_WriteRegister(
     uint16_t                    register_value,
     struct Efuse_Context *const efuse)
 {
-    // Place the register address into bits 10->13
-    uint16_t tx_data =
-        (uint16_t)(((register_address & EFUSE_ADDR_MASK) << EFUSE_ADDR_SHIFT));
-
-    // Place register value to be written into bits 0->8
-    tx_data = (uint16_t)(tx_data | (register_value & EFUSE_SI_DATA_MASK));
-
-    // Invert watchdog bit state (Note: It is safe to do so even if the watchdog
-    // is disabled)
-    if (efuse->wdin_bit_to_set)
-    {
-        SET_BIT_UINT16(tx_data, WATCHDOG_BIT);
-    }
-    else
-    {
-        CLEAR_BIT_UINT16(tx_data, WATCHDOG_BIT);
-    }
-
-    // Invert watchdog bit state for next write
-    efuse->wdin_bit_to_set = !efuse->wdin_bit_to_set;
-    Io_Efuse_CalculateParityBit(&tx_data);
-
-    return Io_Efuse_WriteToEfuse(
-        &tx_data, efuse->spi_handle, efuse->nss_port, efuse->nss_pin);
+    return Io_EfuseRegisterCache_WriteRegister(
+        efuse->register_cache, register_address, register_value);
 }
 
 ExitCode Io_Efuse_ReadRegister(
@@ -366,35 +250,6 @@ ExitCode Io_Efuse_ReadRegister(
     uint16_t *                  register_value,
     struct Efuse_Context *const efuse)
 {
-    // Place the Status Register address into bits 10->13
-    uint16_t tx_data =
-        (uint16_t)((SI_STATR_0_ADDR & EFUSE_ADDR_MASK) << EFUSE_ADDR_SHIFT);
-
-    // Shift bit 3 of the address (SOA3: the channel number) to the 13th bit
-    tx_data = (uint16_t)(
-        tx_data | ((register_address & SOA3_MASK) << EFUSE_ADDR_SHIFT) |
-        (register_address & (SOA2_MASK | SOA1_MASK | SOA0_MASK)));
-
-    // Invert watchdog bit state (Note: It is safe to do so even if the watchdog
-    // is disabled)
-    if (efuse->wdin_bit_to_set)
-    {
-        SET_BIT_UINT16(tx_data, WATCHDOG_BIT);
-    }
-    else
-    {
-        CLEAR_BIT_UINT16(tx_data, WATCHDOG_BIT);
-    }
-
-    // Invert watchdog bit state for next write
-    efuse->wdin_bit_to_set = !efuse->wdin_bit_to_set;
-    Io_Efuse_CalculateParityBit(&tx_data);
-    ExitCode exit_code = Io_Efuse_ReadFromEfuse(
-        &tx_data, register_value, efuse->spi_handle, efuse->nss_port,
-        efuse->nss_pin);
-
-    // Only return register contents and clear bits 9->15
-    *register_value = READ_BIT(*register_value, EFUSE_SO_DATA_MASK);
-
-    return exit_code;
+    return Io_EfuseRegisterCache_ReadRegister(
+        efuse->register_cache, register_address, register_value);
 }
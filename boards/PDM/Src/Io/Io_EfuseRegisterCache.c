@@ -0,0 +1,214 @@
+#include <assert.h>
+#include <stdlib.h>
+#include "Io_EfuseRegisterCache.h"
+#include "configs/Io_EfuseConfig.h"
+
+#define NUM_SI_REGISTERS (EFUSE_ADDR_MASK + 1U)
+
+// The serial input registers that hold settings, which keep their value until
+// they are written again
+#define CACHEABLE_SI_REGISTERS                                               \
+    ((1U << SI_PWMR_0_ADDR) | (1U << SI_CONFR_0_ADDR) |                      \
+     (1U << SI_OCR_0_ADDR) | (1U << SI_RETRY_0_ADDR) | (1U << SI_GCR_ADDR) | \
+     (1U << SI_PWMR_1_ADDR) | (1U << SI_CONFR_1_ADDR) |                      \
+     (1U << SI_OCR_1_ADDR) | (1U << SI_RETRY_1_ADDR))
+
+// Sent to clock out the serial output register selected by the previous frame
+#define DUMMY_FRAME 0xFFFFU
+
+struct EfuseRegisterCache
+{
+    ExitCode (*transfer_frame)(
+        const struct Efuse_Context *efuse,
+        uint16_t                    tx_data,
+        uint16_t *                  rx_data);
+    const struct Efuse_Context *efuse;
+
+    uint16_t si_register_values[NUM_SI_REGISTERS];
+
+    // A bit for each serial input register, which is set if the register's
+    // value is known
+    uint16_t known_si_registers;
+
+    // The current state of the watchdog-in bit (bit 15). If the watchdog is
+    // enabled its state must be alternated at least once within the watchdog
+    // timeout period.
+    bool wdin_bit_to_set;
+};
+
+/**
+ * Set the watchdog-in bit of the given SPI frame and alternate it for the next
+ * frame, then set/clear the parity bit so the frame has an even number of set
+ * bits
+ * @param register_cache The register cache of the efuse the frame is sent to
+ * @param tx_data The SPI frame without the watchdog-in and parity bits
+ * @return The SPI frame with the watchdog-in and parity bits
+ */
+static uint16_t
+    Io_FinishFrame(struct EfuseRegisterCache *register_cache, uint16_t tx_data);
+
+static uint16_t Io_FinishFrame(
+    struct EfuseRegisterCache *const register_cache,
+    uint16_t                         tx_data)
+{
+    // Invert watchdog bit state (Note: It is safe to do so even if the watchdog
+    // is disabled)
+    if (register_cache->wdin_bit_to_set)
+    {
+        SET_BIT_UINT16(tx_data, WATCHDOG_BIT);
+    }
+    else
+    {
+        CLEAR_BIT_UINT16(tx_data, WATCHDOG_BIT);
+    }
+    register_cache->wdin_bit_to_set = !register_cache->wdin_bit_to_set;
+
+    // Using the XOR sum of bits method taken from:
+    // https://en.wikipedia.org/wiki/Parity_bit#Parity
+    bool parity_bit = false;
+    for (uint16_t bits = tx_data; bits > 0U; bits >>= 1)
+    {
+        parity_bit ^= (bits & 1U);
+    }
+
+    if (parity_bit)
+    {
+        SET_BIT_UINT16(tx_data, PARITY_BIT);
+    }
+
+    return tx_data;
+}
+
+struct EfuseRegisterCache *Io_EfuseRegisterCache_Create(
+    ExitCode (*const transfer_frame)(
+        const struct Efuse_Context *efuse,
+        uint16_t                    tx_data,
+        uint16_t *                  rx_data),
+    const struct Efuse_Context *const efuse)
+{
+    struct EfuseRegisterCache *register_cache =
+        malloc(sizeof(struct EfuseRegisterCache));
+    assert(register_cache != NULL);
+
+    register_cache->transfer_frame = transfer_frame;
+    register_cache->efuse          = efuse;
+
+    for (uint32_t i = 0U; i < NUM_SI_REGISTERS; i++)
+    {
+        register_cache->si_register_values[i] = 0U;
+    }
+
+    Io_EfuseRegisterCache_Reset(register_cache);
+
+    return register_cache;
+}
+
+void Io_EfuseRegisterCache_Destroy(
+    struct EfuseRegisterCache *const register_cache)
+{
+    free(register_cache);
+}
+
+void Io_EfuseRegisterCache_Reset(
+    struct EfuseRegisterCache *const register_cache)
+{
+    register_cache->known_si_registers = 0U;
+    register_cache->wdin_bit_to_set    = true;
+}
+
+ExitCode Io_EfuseRegisterCache_WriteRegister(
+    struct EfuseRegisterCache *const register_cache,
+    const uint8_t                    register_address,
+    const uint16_t                   register_value)
+{
+    const uint8_t  address      = register_address & EFUSE_ADDR_MASK;
+    const uint16_t value        = register_value & EFUSE_SI_DATA_MASK;
+    const uint16_t register_bit = (uint16_t)(1U << address);
+
+    if ((register_cache->known_si_registers & register_bit) != 0U &&
+        register_cache->si_register_values[address] == value)
+    {
+        return EXIT_CODE_OK;
+    }
+
+    // Place the register address into bits 10->13, and the register value to
+    // be written into bits 0->8
+    const uint16_t tx_data = Io_FinishFrame(
+        register_cache, (uint16_t)((address << EFUSE_ADDR_SHIFT) | value));
+    uint16_t rx_data;
+
+    if (register_cache->transfer_frame(
+            register_cache->efuse, tx_data, &rx_data) != EXIT_CODE_OK)
+    {
+        // The efuse may or may not have latched the frame
+        CLEAR_BIT_UINT16(register_cache->known_si_registers, register_bit);
+        return EXIT_CODE_TIMEOUT;
+    }
+
+    if ((CACHEABLE_SI_REGISTERS & register_bit) != 0U)
+    {
+        register_cache->si_register_values[address] = value;
+        SET_BIT_UINT16(register_cache->known_si_registers, register_bit);
+    }
+
+    return EXIT_CODE_OK;
+}
+
+ExitCode Io_EfuseRegisterCache_WriteRegisterBits(
+    struct EfuseRegisterCache *const register_cache,
+    const uint8_t                    si_register_address,
+    const uint8_t                    so_register_address,
+    const uint16_t                   mask,
+    const uint16_t                   bits)
+{
+    const uint8_t  address        = si_register_address & EFUSE_ADDR_MASK;
+    const uint16_t register_bit   = (uint16_t)(1U << address);
+    uint16_t       register_value = register_cache->si_register_values[address];
+
+    if ((register_cache->known_si_registers & register_bit) == 0U)
+    {
+        const ExitCode exit_code = Io_EfuseRegisterCache_ReadRegister(
+            register_cache, so_register_address, &register_value);
+        if (exit_code != EXIT_CODE_OK)
+        {
+            return exit_code;
+        }
+    }
+
+    CLEAR_BIT_UINT16(register_value, mask);
+    SET_BIT_UINT16(register_value, bits & mask);
+
+    return Io_EfuseRegisterCache_WriteRegister(
+        register_cache, address, register_value);
+}
+
+ExitCode Io_EfuseRegisterCache_ReadRegister(
+    struct EfuseRegisterCache *const register_cache,
+    const uint8_t                    register_address,
+    uint16_t *const                  register_value)
+{
+    // Place the Status Register address into bits 10->13, and shift bit 3 of
+    // the address (SOA3: the channel number) to the 13th bit
+    uint16_t tx_data =
+        (uint16_t)((SI_STATR_0_ADDR & EFUSE_ADDR_MASK) << EFUSE_ADDR_SHIFT);
+    tx_data = (uint16_t)(
+        tx_data | ((register_address & SOA3_MASK) << EFUSE_ADDR_SHIFT) |
+        (register_address & (SOA2_MASK | SOA1_MASK | SOA0_MASK)));
+    tx_data = Io_FinishFrame(register_cache, tx_data);
+
+    // The efuse sends the register selected by a frame during the next frame,
+    // so a dummy frame follows the command
+    uint16_t rx_data;
+    if (register_cache->transfer_frame(
+            register_cache->efuse, tx_data, &rx_data) != EXIT_CODE_OK ||
+        register_cache->transfer_frame(
+            register_cache->efuse, DUMMY_FRAME, &rx_data) != EXIT_CODE_OK)
+    {
+        return EXIT_CODE_TIMEOUT;
+    }
+
+    // Only return register contents and clear bits 9->15
+    *register_value = rx_data & EFUSE_SO_DATA_MASK;
+
+    return EXIT_CODE_OK;
+}
@@ -0,0 +1,181 @@
+#include <assert.h>
+#include "Io_Efuses.h"
+#include "Io_Efuse.h"
+#include "Io_CurrentSense.h"
+#include "configs/Io_EfuseConfig.h"
+
+struct EfusePins
+{
+    float (*get_channel_0_current)(void);
+    float (*get_channel_1_current)(void);
+    GPIO_TypeDef *nss_port;
+    uint16_t      nss_pin;
+    GPIO_TypeDef *fsob_port;
+    uint16_t      fsob_pin;
+    GPIO_TypeDef *fsb_port;
+    uint16_t      fsb_pin;
+    GPIO_TypeDef *current_sync_port;
+    uint16_t      current_sync_pin;
+    GPIO_TypeDef *channel_0_port;
+    uint16_t      channel_0_pin;
+    GPIO_TypeDef *channel_1_port;
+    uint16_t      channel_1_pin;
+};
+
+// clang-format off
+static const struct EfusePins efuse_pins[NUM_EFUSES] = {
+    [EFUSE_AUX1_AUX2] = {
+        Io_CurrentSense_GetAux1Current, Io_CurrentSense_GetAux2Current,
+        CSB_AUX1_AUX2_GPIO_Port, CSB_AUX1_AUX2_Pin,
+        FSOB_AUX1_AUX2_GPIO_Port, FSOB_AUX1_AUX2_Pin,
+        FSB_AUX1_AUX2_GPIO_Port, FSB_AUX1_AUX2_Pin,
+        CUR_SYNC_AUX1_AUX2_GPIO_Port, CUR_SYNC_AUX1_AUX2_Pin,
+        PIN_AUX1_GPIO_Port, PIN_AUX1_Pin,
+        PIN_AUX2_GPIO_Port, PIN_AUX2_Pin,
+    },
+    [EFUSE_AIR_SHDN_LV_PWR] = {
+        Io_CurrentSense_GetAirShutdownCurrent, NULL,
+        CSB_AIR_SHDN_LV_PWR_GPIO_Port, CSB_AIR_SHDN_LV_PWR_Pin,
+        FSOB_AIR_SHDN_LV_PWR_GPIO_Port, FSOB_AIR_SHDN_LV_PWR_Pin,
+        FSB_AIR_SHDN_LV_PWR_GPIO_Port, FSB_AIR_SHDN_LV_PWR_Pin,
+        CUR_SYNC_AIR_SHDN_LV_PWR_GPIO_Port, CUR_SYNC_AIR_SHDN_LV_PWR_Pin,
+        PIN_AIR_SHDN_GPIO_Port, PIN_AIR_SHDN_Pin,
+        PIN_LV_PWR_GPIO_Port, PIN_LV_PWR_Pin,
+    },
+    [EFUSE_DI_BL_DI_BR] = {
+        NULL, NULL,
+        CSB_DI_BL_DI_BR_GPIO_Port, CSB_DI_BL_DI_BR_Pin,
+        FSOB_DI_BL_DI_BR_GPIO_Port, FSOB_DI_BL_DI_BR_Pin,
+        FSB_DI_BL_DI_BR_GPIO_Port, FSB_DI_BL_DI_BR_Pin,
+        CUR_SYNC_DI_BL_DI_BR_GPIO_Port, CUR_SYNC_DI_BL_DI_BR_Pin,
+        PIN_DI_BL_GPIO_Port, PIN_DI_BL_Pin,
+        PIN_DI_BR_GPIO_Port, PIN_DI_BR_Pin,
+    },
+    [EFUSE_DI_FL_DI_FR] = {
+        NULL, NULL,
+        CSB_DI_FL_DI_FR_GPIO_Port, CSB_DI_FL_DI_FR_Pin,
+        FSOB_DI_FL_DI_FR_GPIO_Port, FSOB_DI_FL_DI_FR_Pin,
+        FSB_DI_FL_DI_FR_GPIO_Port, FSB_DI_FL_DI_FR_Pin,
+        CUR_SYNC_DI_FL_DI_FR_GPIO_Port, CUR_SYNC_DI_FL_DI_FR_Pin,
+        PIN_DI_FL_GPIO_Port, PIN_DI_FL_Pin,
+        PIN_DI_FR_GPIO_Port, PIN_DI_FR_Pin,
+    },
+};
+// clang-format on
+
+static const uint8_t csns_functions[] = {
+    CSNS_FUNCTION_CURRENT_CH0,
+    CSNS_FUNCTION_CURRENT_CH1,
+};
+
+static struct Efuse_Context *efuses[NUM_EFUSES];
+static bool                  is_output_enabled[NUM_EFUSE_OUTPUTS];
+
+/**
+ * Drive the input pin of an output to its last requested state
+ * @param output The output to drive, as an enum EfuseOutput
+ */
+static void Io_ApplyOutput(uint32_t output);
+
+static void Io_ApplyOutput(const uint32_t output)
+{
+    const struct Efuse_Context *const efuse =
+        efuses[output / NUM_EFUSE_CHANNELS];
+
+    if (output % NUM_EFUSE_CHANNELS == 0U)
+    {
+        if (is_output_enabled[output])
+        {
+            Io_Efuse_EnableChannel0(efuse);
+        }
+        else
+        {
+            Io_Efuse_DisableChannel0(efuse);
+        }
+    }
+    else
+    {
+        if (is_output_enabled[output])
+        {
+            Io_Efuse_EnableChannel1(efuse);
+        }
+        else
+        {
+            Io_Efuse_DisableChannel1(efuse);
+        }
+    }
+}
+
+void Io_Efuses_Init(SPI_HandleTypeDef *const spi_handle)
+{
+    assert(spi_handle != NULL);
+
+    for (uint32_t i = 0U; i < NUM_EFUSES; i++)
+    {
+        const struct EfusePins *const pins = &efuse_pins[i];
+
+        efuses[i] = Io_Efuse_Create(
+            pins->get_channel_0_current, pins->get_channel_1_current,
+            spi_handle, pins->nss_port, pins->nss_pin, pins->fsob_port,
+            pins->fsob_pin, pins->fsb_port, pins->fsb_pin,
+            pins->current_sync_port, pins->current_sync_pin,
+            pins->channel_0_port, pins->channel_0_pin, pins->channel_1_port,
+            pins->channel_1_pin);
+    }
+}
+
+struct Efuse_Context *Io_Efuses_GetEfuse(const enum EfuseId efuse_id)
+{
+    assert(efuse_id < NUM_EFUSES);
+
+    return efuses[efuse_id];
+}
+
+ExitCode Io_Efuses_SelectCurrentSense(
+    const uint32_t efuse_id,
+    const uint32_t channel)
+{
+    assert(efuse_id < NUM_EFUSES);
+    assert(channel < sizeof(csns_functions) / sizeof(csns_functions[0]));
+
+    // Switching channels only costs one SPI frame, as the efuse's GCR register
+    // is cached
+    return Io_Efuse_ConfigureChannelMonitoring(
+        csns_functions[channel], efuses[efuse_id]);
+}
+
+bool Io_Efuses_IsCurrentSenseSynced(const uint32_t efuse_id)
+{
+    assert(efuse_id < NUM_EFUSES);
+
+    return Io_Efuse_IsCurrentSenseSynced(efuses[efuse_id]);
+}
+
+void Io_Efuses_SetOutputEnabled(const uint32_t output, const bool is_enabled)
+{
+    assert(output < NUM_EFUSE_OUTPUTS);
+
+    is_output_enabled[output] = is_enabled;
+    Io_ApplyOutput(output);
+}
+
+void Io_Efuses_DelatchOutputFaults(const uint32_t output)
+{
+    assert(output < NUM_EFUSE_OUTPUTS);
+
+    struct Efuse_Context *const efuse = efuses[output / NUM_EFUSE_CHANNELS];
+
+    // Only the input pin of the output's own channel is toggled, so the other
+    // output of the efuse doesn't glitch on. The pin is left high, so the
+    // output is driven back to its last requested state.
+    if (output % NUM_EFUSE_CHANNELS == 0U)
+    {
+        Io_Efuse_DelatchChannel0Faults(efuse);
+    }
+    else
+    {
+        Io_Efuse_DelatchChannel1Faults(efuse);
+    }
+
+    Io_ApplyOutput(output);
+}
@@ -1,18 +1,17 @@
 #include "Io_VoltageSense.h"
-
-// TODO: Fix hard-coded values once the ADC is configured
+#include "Io_Adc.h"
 
 float Io_VoltageSense_GetVbatVoltage(void)
 {
-    return 7.0f;
+    return Io_Adc_GetOutput(ANALOG_SENSE_VBAT).value;
 }
 
 float Io_VoltageSense_Get24vAuxVoltage(void)
 {
-    return 23.0f;
+    return Io_Adc_GetOutput(ANALOG_SENSE_24V_AUX).value;
 }
 
 float Io_VoltageSense_Get24vAccVoltage(void)
 {
-    return 23.0f;
+    return Io_Adc_GetOutput(ANALOG_SENSE_24V_ACC).value;
 }
@@ -35,11 +35,15 @@
 #include "Io_SoftwareWatchdog.h"
 #include "Io_VoltageSense.h"
 #include "Io_CurrentSense.h"
+#include "Io_Adc.h"
+#include "Io_Efuses.h"
 #include "Io_HeartbeatMonitor.h"
 #include "Io_RgbLedSequence.h"
 #include "Io_LT3650.h"
 #include "Io_LTC3786.h"
 
+#include "App_CurrentSenseScheduler.h"
+#include "App_OutputProtection.h"
 #include "App_PdmWorld.h"
 #include "App_SharedConstants.h"
 #include "App_SharedStateMachine.h"
@@ -47,6 +51,8 @@
 #include "configs/App_CurrentLimits.h"
 #include "configs/App_VoltageLimits.h"
 #include "configs/App_HeartbeatMonitorConfig.h"
+#include "configs/App_LowVoltageBatteryConfig.h"
+#include "configs/App_OutputProtectionConfig.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -66,6 +72,7 @@
 
 /* Private variables ---------------------------------------------------------*/
 ADC_HandleTypeDef hadc1;
+DMA_HandleTypeDef hdma_adc1;
 
 CAN_HandleTypeDef hcan;
 
@@ -73,6 +80,8 @@ IWDG_HandleTypeDef hiwdg;
 
 SPI_HandleTypeDef hspi2;
 
+TIM_HandleTypeDef htim3;
+
 osThreadId          Task1HzHandle;
 uint32_t            Task1HzBuffer[TASK1HZ_STACK_SIZE];
 osStaticThreadDef_t Task1HzControlBlock;
@@ -89,33 +98,40 @@ osThreadId          Task100HzHandle;
 uint32_t            Task100HzBuffer[TASK100HZ_STACK_SIZE];
 osStaticThreadDef_t Task100HzControlBlock;
 /* USER CODE BEGIN PV */
-struct PdmWorld *         world;
-struct StateMachine *     state_machine;
-struct PdmCanTxInterface *can_tx;
-struct PdmCanRxInterface *can_rx;
-struct InRangeCheck *     vbat_voltage_in_range_check;
-struct InRangeCheck *     _24v_aux_voltage_in_range_check;
-struct InRangeCheck *     _24v_acc_voltage_in_range_check;
-struct InRangeCheck *     aux1_current_in_range_check;
-struct InRangeCheck *     aux2_current_in_range_check;
-struct InRangeCheck *     left_inverter_current_in_range_check;
-struct InRangeCheck *     right_inverter_current_in_range_check;
-struct InRangeCheck *     energy_meter_current_in_range_check;
-struct InRangeCheck *     can_current_in_range_check;
-struct InRangeCheck *     air_shutdown_current_in_range_check;
-struct HeartbeatMonitor * heartbeat_monitor;
-struct RgbLedSequence *   rgb_led_sequence;
-struct LowVoltageBattery *low_voltage_battery;
-struct Clock *            clock;
+struct PdmWorld *             world;
+struct StateMachine *         state_machine;
+struct PdmCanTxInterface *    can_tx;
+struct PdmCanRxInterface *    can_rx;
+struct InRangeCheck *         vbat_voltage_in_range_check;
+struct InRangeCheck *         _24v_aux_voltage_in_range_check;
+struct InRangeCheck *         _24v_acc_voltage_in_range_check;
+struct InRangeCheck *         aux1_current_in_range_check;
+struct InRangeCheck *         aux2_current_in_range_check;
+struct InRangeCheck *         left_inverter_current_in_range_check;
+struct InRangeCheck *         right_inverter_current_in_range_check;
+struct InRangeCheck *         energy_meter_current_in_range_check;
+struct InRangeCheck *         can_current_in_range_check;
+struct InRangeCheck *         air_shutdown_current_in_range_check;
+struct HeartbeatMonitor *     heartbeat_monitor;
+struct RgbLedSequence *       rgb_led_sequence;
+struct LowVoltageBattery *    low_voltage_battery;
+struct Clock *                clock;
+struct CurrentSenseScheduler *current_sense_scheduler;
+struct OutputProtection *     output_protection;
+
+static const struct OutputProtectionConfig
+    output_protection_configs[NUM_EFUSE_OUTPUTS] = OUTPUT_PROTECTION_CONFIGS;
 /* USER CODE END PV */
 
 /* Private function prototypes -----------------------------------------------*/
 void        SystemClock_Config(void);
 static void MX_GPIO_Init(void);
+static void MX_DMA_Init(void);
 static void MX_CAN_Init(void);
 static void MX_SPI2_Init(void);
 static void MX_ADC1_Init(void);
 static void MX_IWDG_Init(void);
+static void MX_TIM3_Init(void);
 void        RunTask1Hz(void const *argument);
 void        RunTask1kHz(void const *argument);
 void        RunTaskCanRx(void const *argument);
@@ -174,10 +190,12 @@ int main(void)
 
     /* Initialize all configured peripherals */
     MX_GPIO_Init();
+    MX_DMA_Init();
     MX_CAN_Init();
     MX_SPI2_Init();
     MX_ADC1_Init();
     MX_IWDG_Init();
+    MX_TIM3_Init();
     /* USER CODE BEGIN 2 */
     __HAL_DBGMCU_FREEZE_IWDG();
     Io_SharedHardFaultHandler_Init();
@@ -188,6 +206,20 @@ int main(void)
 
     can_rx = App_CanRx_Create();
 
+    Io_Efuses_Init(&hspi2);
+    current_sense_scheduler = App_CurrentSenseScheduler_Create(
+        NUM_EFUSES, Io_Efuses_SelectCurrentSense,
+        Io_Efuses_IsCurrentSenseSynced);
+    Io_CurrentSense_Init(current_sense_scheduler);
+    Io_Adc_Init(&hadc1, Io_CurrentSense_ProcessAdcBlock);
+    HAL_TIM_Base_Start(&htim3);
+
+    output_protection = App_OutputProtection_Create(
+        output_protection_configs, NUM_EFUSE_OUTPUTS, 1U,
+        Io_CurrentSense_GetOutputCurrent, Io_Efuses_SetOutputEnabled,
+        Io_Efuses_DelatchOutputFaults,
+        LOAD_SHEDDING_ENABLED ? Io_VoltageSense_GetVbatVoltage : NULL);
+
     vbat_voltage_in_range_check = App_InRangeCheck_Create(
         Io_VoltageSense_GetVbatVoltage, VBAT_MIN_VOLTAGE, VBAT_MAX_VOLTAGE);
 
@@ -203,7 +235,7 @@ int main(void)
         Io_CurrentSense_GetAux1Current, AUX1_MIN_CURRENT, AUX1_MAX_CURRENT);
 
     aux2_current_in_range_check = App_InRangeCheck_Create(
-        Io_CurrentSense_GetAux1Current, AUX2_MIN_CURRENT, AUX2_MAX_CURRENT);
+        Io_CurrentSense_GetAux2Current, AUX2_MIN_CURRENT, AUX2_MAX_CURRENT);
 
     left_inverter_current_in_range_check = App_InRangeCheck_Create(
         Io_CurrentSense_GetLeftInverterCurrent, LEFT_INVERTER_MIN_CURRENT,
@@ -232,8 +264,10 @@ int main(void)
         Io_RgbLedSequence_TurnOnRedLed, Io_RgbLedSequence_TurnOnBlueLed,
         Io_RgbLedSequence_TurnOnGreenLed);
 
-    low_voltage_battery =
-        App_LowVoltageBattery_Create(Io_LT3650_HasFault, Io_LTC3786_HasFault);
+    low_voltage_battery = App_LowVoltageBattery_Create(
+        Io_LT3650_HasFault, Io_LTC3786_HasFault, Io_VoltageSense_GetVbatVoltage,
+        Io_CurrentSense_GetTotalOutputCurrent, Io_VoltageSense_Get24vAuxVoltage,
+        LV_BATTERY_OCV_CORRECTION_ENABLED);
 
     clock = App_SharedClock_Create();
 
@@ -245,7 +279,7 @@ int main(void)
         right_inverter_current_in_range_check,
         energy_meter_current_in_range_check, can_current_in_range_check,
         air_shutdown_current_in_range_check, heartbeat_monitor,
-        rgb_led_sequence, low_voltage_battery, clock);
+        rgb_led_sequence, low_voltage_battery, output_protection, clock);
 
     state_machine = App_SharedStateMachine_Create(world, App_GetInitState());
 
@@ -396,14 +430,14 @@ static void MX_ADC1_Init(void)
     hadc1.Instance                   = ADC1;
     hadc1.Init.ClockPrescaler        = ADC_CLOCK_ASYNC_DIV1;
     hadc1.Init.Resolution            = ADC_RESOLUTION_12B;
-    hadc1.Init.ScanConvMode          = ADC_SCAN_DISABLE;
+    hadc1.Init.ScanConvMode          = ADC_SCAN_ENABLE;
     hadc1.Init.ContinuousConvMode    = DISABLE;
     hadc1.Init.DiscontinuousConvMode = DISABLE;
-    hadc1.Init.ExternalTrigConvEdge  = ADC_EXTERNALTRIGCONVEDGE_NONE;
-    hadc1.Init.ExternalTrigConv      = ADC_SOFTWARE_START;
+    hadc1.Init.ExternalTrigConvEdge  = ADC_EXTERNALTRIGCONVEDGE_RISING;
+    hadc1.Init.ExternalTrigConv      = ADC_EXTERNALTRIGCONV_T3_TRGO;
     hadc1.Init.DataAlign             = ADC_DATAALIGN_RIGHT;
-    hadc1.Init.NbrOfConversion       = 1;
-    hadc1.Init.DMAContinuousRequests = DISABLE;
+    hadc1.Init.NbrOfConversion       = 7;
+    hadc1.Init.DMAContinuousRequests = ENABLE;
     hadc1.Init.EOCSelection          = ADC_EOC_SINGLE_CONV;
     hadc1.Init.LowPowerAutoWait      = DISABLE;
     hadc1.Init.Overrun               = ADC_OVR_DATA_OVERWRITTEN;
@@ -423,13 +457,61 @@ static void MX_ADC1_Init(void)
     sConfig.Channel      = ADC_CHANNEL_1;
     sConfig.Rank         = ADC_REGULAR_RANK_1;
     sConfig.SingleDiff   = ADC_SINGLE_ENDED;
-    sConfig.SamplingTime = ADC_SAMPLETIME_1CYCLE_5;
+    sConfig.SamplingTime = ADC_SAMPLETIME_61CYCLES_5;
     sConfig.OffsetNumber = ADC_OFFSET_NONE;
     sConfig.Offset       = 0;
     if (HAL_ADC_ConfigChannel(&hadc1, &sConfig) != HAL_OK)
     {
         Error_Handler();
     }
+    /** Configure Regular Channel
+     */
+    sConfig.Channel = ADC_CHANNEL_2;
+    sConfig.Rank    = ADC_REGULAR_RANK_2;
+    if (HAL_ADC_ConfigChannel(&hadc1, &sConfig) != HAL_OK)
+    {
+        Error_Handler();
+    }
+    /** Configure Regular Channel
+     */
+    sConfig.Channel = ADC_CHANNEL_3;
+    sConfig.Rank    = ADC_REGULAR_RANK_3;
+    if (HAL_ADC_ConfigChannel(&hadc1, &sConfig) != HAL_OK)
+    {
+        Error_Handler();
+    }
+    /** Configure Regular Channel
+     */
+    sConfig.Channel = ADC_CHANNEL_6;
+    sConfig.Rank    = ADC_REGULAR_RANK_4;
+    if (HAL_ADC_ConfigChannel(&hadc1, &sConfig) != HAL_OK)
+    {
+        Error_Handler();
+    }
+    /** Configure Regular Channel
+     */
+    sConfig.Channel = ADC_CHANNEL_7;
+    sConfig.Rank    = ADC_REGULAR_RANK_5;
+    if (HAL_ADC_ConfigChannel(&hadc1, &sConfig) != HAL_OK)
+    {
+        Error_Handler();
+    }
+    /** Configure Regular Channel
+     */
+    sConfig.Channel = ADC_CHANNEL_8;
+    sConfig.Rank    = ADC_REGULAR_RANK_6;
+    if (HAL_ADC_ConfigChannel(&hadc1, &sConfig) != HAL_OK)
+    {
+        Error_Handler();
+    }
+    /** Configure Regular Channel
+     */
+    sConfig.Channel = ADC_CHANNEL_9;
+    sConfig.Rank    = ADC_REGULAR_RANK_7;
+    if (HAL_ADC_ConfigChannel(&hadc1, &sConfig) != HAL_OK)
+    {
+        Error_Handler();
+    }
     /* USER CODE BEGIN ADC1_Init 2 */
 
     /* USER CODE END ADC1_Init 2 */
@@ -537,6 +619,63 @@ static void MX_SPI2_Init(void)
     /* USER CODE END SPI2_Init 2 */
 }
 
+/**
+ * @brief TIM3 Initialization Function
+ * @param None
+ * @retval None
+ */
+static void MX_TIM3_Init(void)
+{
+    /* USER CODE BEGIN TIM3_Init 0 */
+
+    /* USER CODE END TIM3_Init 0 */
+
+    TIM_ClockConfigTypeDef  sClockSourceConfig = { 0 };
+    TIM_MasterConfigTypeDef sMasterConfig      = { 0 };
+
+    /* USER CODE BEGIN TIM3_Init 1 */
+
+    /* USER CODE END TIM3_Init 1 */
+    htim3.Instance         = TIM3;
+    htim3.Init.Prescaler   = TIM3_PRESCALER - 1;
+    htim3.Init.CounterMode = TIM_COUNTERMODE_UP;
+    htim3.Init.Period = (TIMx_FREQUENCY / TIM3_PRESCALER / ADC_FREQUENCY) - 1;
+    htim3.Init.ClockDivision     = TIM_CLOCKDIVISION_DIV1;
+    htim3.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
+    if (HAL_TIM_Base_Init(&htim3) != HAL_OK)
+    {
+        Error_Handler();
+    }
+    sClockSourceConfig.ClockSource = TIM_CLOCKSOURCE_INTERNAL;
+    if (HAL_TIM_ConfigClockSource(&htim3, &sClockSourceConfig) != HAL_OK)
+    {
+        Error_Handler();
+    }
+    sMasterConfig.MasterOutputTrigger = TIM_TRGO_UPDATE;
+    sMasterConfig.MasterSlaveMode     = TIM_MASTERSLAVEMODE_DISABLE;
+    if (HAL_TIMEx_MasterConfigSynchronization(&htim3, &sMasterConfig) != HAL_OK)
+    {
+        Error_Handler();
+    }
+    /* USER CODE BEGIN TIM3_Init 2 */
+
+    /* USER CODE END TIM3_Init 2 */
+}
+
+/**
+ * Enable DMA controller clock
+ */
+static void MX_DMA_Init(void)
+{
+    /* DMA controller clock enable */
+    __HAL_RCC_DMA1_CLK_ENABLE();
+
+    /* DMA interrupt init */
+    /* DMA1_Channel1_IRQn interrupt configuration */
+    HAL_NVIC_SetPriority(DMA1_Channel1_IRQn, 5, 0);
+    HAL_NVIC_EnableIRQ(DMA1_Channel1_IRQn);
+}
+
 /**
  * @brief GPIO Initialization Function
  * @param None
@@ -735,6 +874,8 @@ void RunTask1kHz(void const *argument)
         const uint32_t current_time_ms = osKernelSysTick() * portTICK_PERIOD_MS;
 
         App_SharedClock_SetCurrentTimeInMilliseconds(clock, current_time_ms);
+        App_CurrentSenseScheduler_Tick(current_sense_scheduler);
+        App_SharedStateMachine_Tick1kHz(state_machine);
         Io_CanTx_EnqueuePeriodicMsgs(can_tx, current_time_ms);
 
         // Watchdog check-in must be the last function called before putting the
@@ -0,0 +1,157 @@
+#include <cmath>
+#include "Test_Pdm.h"
+
+extern "C"
+{
+#include "App_AnalogSense.h"
+#include "configs/App_AnalogSenseConfig.h"
+}
+
+#define OVERSAMPLING_RATIO 2U
+#define REFERENCE_VOLTAGE 3.3f
+#define FULL_SCALE 4095U
+
+// The resolution of a rail voltage is one LSB scaled up by its divider
+#define VOLTAGE_TOLERANCE 0.01f
+#define CURRENT_TOLERANCE 0.5f
+
+class AnalogSenseTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        analog_sense = App_AnalogSense_Create(
+            analog_sense_channel_configs, NUM_ANALOG_SENSE_CHANNELS,
+            OVERSAMPLING_RATIO, REFERENCE_VOLTAGE, FULL_SCALE);
+
+        for (uint32_t channel = 0U; channel < NUM_ANALOG_SENSE_CHANNELS;
+             channel++)
+        {
+            sensed_values[channel] = 0.0f;
+        }
+    }
+
+    void TearDown() override
+    {
+        TearDownObject(analog_sense, App_AnalogSense_Destroy);
+    }
+
+    // Convert the sensed value of every channel back through its calibration
+    // to the raw value an ideal ADC would convert at its pin, then process a
+    // block of scans of these raw values
+    void ProcessBlock(uint32_t timestamp_ms)
+    {
+        uint16_t raw_adc_values[OVERSAMPLING_RATIO * NUM_ANALOG_SENSE_CHANNELS];
+
+        for (uint32_t channel = 0U; channel < NUM_ANALOG_SENSE_CHANNELS;
+             channel++)
+        {
+            const struct AnalogSenseChannelConfig *config =
+                &analog_sense_channel_configs[channel];
+            const float pin_voltage =
+                (sensed_values[channel] - config->offset) / config->gain;
+            const uint16_t raw_adc_value = (uint16_t)std::lround(
+                pin_voltage / REFERENCE_VOLTAGE * (float)FULL_SCALE);
+
+            for (uint32_t scan = 0U; scan < OVERSAMPLING_RATIO; scan++)
+            {
+                raw_adc_values[scan * NUM_ANALOG_SENSE_CHANNELS + channel] =
+                    raw_adc_value;
+            }
+        }
+
+        App_AnalogSense_ProcessBlock(
+            analog_sense, raw_adc_values, timestamp_ms);
+    }
+
+    float GetValue(uint32_t channel)
+    {
+        return App_AnalogSense_GetOutput(analog_sense, channel).value;
+    }
+
+    struct AnalogSense *analog_sense;
+    float               sensed_values[NUM_ANALOG_SENSE_CHANNELS];
+};
+
+TEST_F(AnalogSenseTest, outputs_are_zero_before_the_first_block)
+{
+    for (uint32_t channel = 0U; channel < NUM_ANALOG_SENSE_CHANNELS; channel++)
+    {
+        const struct AnalogSenseOutput output =
+            App_AnalogSense_GetOutput(analog_sense, channel);
+        ASSERT_EQ(analog_sense_channel_configs[channel].offset, output.value);
+        ASSERT_EQ(0U, output.timestamp_ms);
+    }
+}
+
+TEST_F(AnalogSenseTest, rails_are_calibrated_through_their_dividers)
+{
+    sensed_values[ANALOG_SENSE_VBAT]    = 7.2f;
+    sensed_values[ANALOG_SENSE_24V_ACC] = 24.0f;
+    sensed_values[ANALOG_SENSE_24V_AUX] = 23.5f;
+    ProcessBlock(1U);
+
+    ASSERT_NEAR(7.2f, GetValue(ANALOG_SENSE_VBAT), VOLTAGE_TOLERANCE);
+    ASSERT_NEAR(24.0f, GetValue(ANALOG_SENSE_24V_ACC), VOLTAGE_TOLERANCE);
+    ASSERT_NEAR(23.5f, GetValue(ANALOG_SENSE_24V_AUX), VOLTAGE_TOLERANCE);
+    ASSERT_EQ(
+        1U, App_AnalogSense_GetOutput(analog_sense, ANALOG_SENSE_VBAT)
+                .timestamp_ms);
+}
+
+TEST_F(AnalogSenseTest, rails_cover_their_in_range_checks)
+{
+    // The highest rail voltages that are still in range must not clip at the
+    // ADC's full scale
+    const float max_pin_voltages[] = {
+        8.5f / DIVIDER_GAIN(
+                   VBAT_SENSE_DIVIDER_TOP_OHMS, VBAT_SENSE_DIVIDER_BOTTOM_OHMS),
+        26.0f /
+            DIVIDER_GAIN(
+                _24V_SENSE_DIVIDER_TOP_OHMS, _24V_SENSE_DIVIDER_BOTTOM_OHMS),
+    };
+
+    for (const float max_pin_voltage : max_pin_voltages)
+    {
+        ASSERT_LT(max_pin_voltage, REFERENCE_VOLTAGE);
+    }
+}
+
+TEST_F(AnalogSenseTest, current_sense_outputs_are_calibrated_to_amps)
+{
+    sensed_values[ANALOG_SENSE_CSNS_AUX1_AUX2]       = 1.0f;
+    sensed_values[ANALOG_SENSE_CSNS_AIR_SHDN_LV_PWR] = 2.5f;
+    sensed_values[ANALOG_SENSE_CSNS_DI_BL_DI_BR]     = 10.0f;
+    sensed_values[ANALOG_SENSE_CSNS_DI_FL_DI_FR]     = 0.0f;
+    ProcessBlock(1U);
+
+    ASSERT_NEAR(1.0f, GetValue(ANALOG_SENSE_CSNS_AUX1_AUX2), CURRENT_TOLERANCE);
+    ASSERT_NEAR(
+        2.5f, GetValue(ANALOG_SENSE_CSNS_AIR_SHDN_LV_PWR), CURRENT_TOLERANCE);
+    ASSERT_NEAR(
+        10.0f, GetValue(ANALOG_SENSE_CSNS_DI_BL_DI_BR), CURRENT_TOLERANCE);
+    ASSERT_EQ(0.0f, GetValue(ANALOG_SENSE_CSNS_DI_FL_DI_FR));
+}
+
+TEST_F(AnalogSenseTest, rail_ripple_is_smoothed_but_current_steps_are_not)
+{
+    sensed_values[ANALOG_SENSE_VBAT]           = 7.2f;
+    sensed_values[ANALOG_SENSE_CSNS_AUX1_AUX2] = 0.0f;
+    ProcessBlock(1U);
+
+    sensed_values[ANALOG_SENSE_VBAT]           = 6.0f;
+    sensed_values[ANALOG_SENSE_CSNS_AUX1_AUX2] = 5.0f;
+    ProcessBlock(2U);
+
+    // A single sagging block barely moves the rail voltage, while the current
+    // sense output follows its channel straight away
+    ASSERT_GT(GetValue(ANALOG_SENSE_VBAT), 7.0f);
+    ASSERT_NEAR(5.0f, GetValue(ANALOG_SENSE_CSNS_AUX1_AUX2), CURRENT_TOLERANCE);
+
+    // A sustained sag settles within a few time constants
+    for (uint32_t timestamp_ms = 3U; timestamp_ms < 200U; timestamp_ms++)
+    {
+        ProcessBlock(timestamp_ms);
+    }
+    ASSERT_NEAR(6.0f, GetValue(ANALOG_SENSE_VBAT), VOLTAGE_TOLERANCE);
+}
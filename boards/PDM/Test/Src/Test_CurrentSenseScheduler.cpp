@@ -0,0 +1,259 @@
+#include "Test_Pdm.h"
+
+extern "C"
+{
+#include "App_CurrentSenseScheduler.h"
+#include "configs/App_CurrentSenseSchedulerConfig.h"
+}
+
+FAKE_VALUE_FUNC(ExitCode, select_channel, uint32_t, uint32_t);
+FAKE_VALUE_FUNC(bool, is_output_valid, uint32_t);
+
+// The ADC converts the current sense outputs this many times per tick
+#define CONVERSIONS_PER_TICK 4U
+
+// A stand-in for the efuses. The current sense output of an efuse follows the
+// selected channel one conversion late, and switching channels fails while
+// the efuse's SPI frames are lost.
+static float    load_currents[CURRENT_SENSE_MAX_EFUSES][NUM_EFUSE_CHANNELS];
+static uint32_t selected_channels[CURRENT_SENSE_MAX_EFUSES];
+static float    csns_currents[CURRENT_SENSE_MAX_EFUSES];
+static bool     is_csns_sync_asserted[CURRENT_SENSE_MAX_EFUSES];
+static bool     are_frames_lost[CURRENT_SENSE_MAX_EFUSES];
+
+static ExitCode SelectChannel(uint32_t efuse, uint32_t channel)
+{
+    if (are_frames_lost[efuse])
+    {
+        return EXIT_CODE_TIMEOUT;
+    }
+
+    selected_channels[efuse] = channel;
+
+    return EXIT_CODE_OK;
+}
+
+static bool IsOutputValid(uint32_t efuse)
+{
+    return is_csns_sync_asserted[efuse];
+}
+
+class CurrentSenseSchedulerTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        scheduler = App_CurrentSenseScheduler_Create(
+            CURRENT_SENSE_MAX_EFUSES, select_channel, is_output_valid);
+
+        RESET_FAKE(select_channel);
+        RESET_FAKE(is_output_valid);
+        FFF_RESET_HISTORY();
+
+        select_channel_fake.custom_fake  = SelectChannel;
+        is_output_valid_fake.custom_fake = IsOutputValid;
+
+        for (uint32_t efuse = 0U; efuse < CURRENT_SENSE_MAX_EFUSES; efuse++)
+        {
+            for (uint32_t channel = 0U; channel < NUM_EFUSE_CHANNELS; channel++)
+            {
+                load_currents[efuse][channel] =
+                    (float)(10U * efuse + channel + 1U);
+            }
+            selected_channels[efuse]     = 0U;
+            csns_currents[efuse]         = 0.0f;
+            is_csns_sync_asserted[efuse] = true;
+            are_frames_lost[efuse]       = false;
+        }
+
+        num_conversions = 0U;
+    }
+
+    void TearDown() override
+    {
+        TearDownObject(scheduler, App_CurrentSenseScheduler_Destroy);
+    }
+
+    // Tick the scheduler, then convert the current sense outputs until the
+    // next tick
+    void Tick(void)
+    {
+        App_CurrentSenseScheduler_Tick(scheduler);
+
+        for (uint32_t i = 0U; i < CONVERSIONS_PER_TICK; i++)
+        {
+            num_conversions++;
+            App_CurrentSenseScheduler_ProcessConversion(
+                scheduler, csns_currents, num_conversions);
+
+            for (uint32_t efuse = 0U; efuse < CURRENT_SENSE_MAX_EFUSES; efuse++)
+            {
+                csns_currents[efuse] =
+                    load_currents[efuse][selected_channels[efuse]];
+            }
+        }
+    }
+
+    void AssertAllSamplesAreCorrect(void)
+    {
+        for (uint32_t efuse = 0U; efuse < CURRENT_SENSE_MAX_EFUSES; efuse++)
+        {
+            for (uint32_t channel = 0U; channel < NUM_EFUSE_CHANNELS; channel++)
+            {
+                const struct CurrentSenseSample sample =
+                    App_CurrentSenseScheduler_GetSample(
+                        scheduler, efuse, channel);
+
+                if (sample.timestamp_ms != 0U)
+                {
+                    ASSERT_EQ(load_currents[efuse][channel], sample.current);
+                }
+            }
+        }
+    }
+
+    struct CurrentSenseScheduler *scheduler;
+    uint32_t                      num_conversions;
+};
+
+TEST_F(CurrentSenseSchedulerTest, samples_are_zero_before_the_first_tick)
+{
+    for (uint32_t efuse = 0U; efuse < CURRENT_SENSE_MAX_EFUSES; efuse++)
+    {
+        for (uint32_t channel = 0U; channel < NUM_EFUSE_CHANNELS; channel++)
+        {
+            const struct CurrentSenseSample sample =
+                App_CurrentSenseScheduler_GetSample(scheduler, efuse, channel);
+            ASSERT_EQ(0.0f, sample.current);
+            ASSERT_EQ(0U, sample.timestamp_ms);
+        }
+    }
+}
+
+TEST_F(CurrentSenseSchedulerTest, every_channel_is_sampled_every_other_tick)
+{
+    for (uint32_t tick = 0U; tick < 100U; tick++)
+    {
+        Tick();
+        AssertAllSamplesAreCorrect();
+
+        // Every efuse is switched once per tick, and no sample is missed
+        ASSERT_EQ(
+            CURRENT_SENSE_MAX_EFUSES * (tick + 1U),
+            select_channel_fake.call_count);
+
+        if (tick < NUM_EFUSE_CHANNELS)
+        {
+            continue;
+        }
+
+        for (uint32_t efuse = 0U; efuse < CURRENT_SENSE_MAX_EFUSES; efuse++)
+        {
+            ASSERT_EQ(
+                0U, App_CurrentSenseScheduler_GetNumMissedSamples(
+                        scheduler, efuse));
+
+            for (uint32_t channel = 0U; channel < NUM_EFUSE_CHANNELS; channel++)
+            {
+                const struct CurrentSenseSample sample =
+                    App_CurrentSenseScheduler_GetSample(
+                        scheduler, efuse, channel);
+
+                ASSERT_GT(
+                    sample.timestamp_ms,
+                    num_conversions -
+                        (NUM_EFUSE_CHANNELS + 1U) * CONVERSIONS_PER_TICK);
+            }
+        }
+    }
+}
+
+TEST_F(
+    CurrentSenseSchedulerTest,
+    conversions_from_before_a_switch_are_discarded)
+{
+    Tick();
+
+    // The first conversion after each switch still holds the previous channel
+    // of the efuse, so it would corrupt every other sample if it was used
+    for (uint32_t tick = 0U; tick < 20U; tick++)
+    {
+        Tick();
+        AssertAllSamplesAreCorrect();
+    }
+
+    // The first sample of each switch is taken after the discarded
+    // conversions
+    const struct CurrentSenseSample sample =
+        App_CurrentSenseScheduler_GetSample(scheduler, 0U, 0U);
+    ASSERT_EQ(
+        0U, (sample.timestamp_ms - 1U - CURRENT_SENSE_DISCARDED_CONVERSIONS) %
+                CONVERSIONS_PER_TICK);
+}
+
+TEST_F(CurrentSenseSchedulerTest, conversions_are_only_sampled_with_csns_sync)
+{
+    is_csns_sync_asserted[1] = false;
+
+    for (uint32_t tick = 0U; tick < 1U + 10U * CURRENT_SENSE_TIMEOUT_TICKS;
+         tick++)
+    {
+        Tick();
+        AssertAllSamplesAreCorrect();
+    }
+
+    // The efuse times out on its selected channel, then moves on
+    for (uint32_t channel = 0U; channel < NUM_EFUSE_CHANNELS; channel++)
+    {
+        ASSERT_EQ(
+            0U, App_CurrentSenseScheduler_GetSample(scheduler, 1U, channel)
+                    .timestamp_ms);
+    }
+    ASSERT_EQ(
+        10U, App_CurrentSenseScheduler_GetNumMissedSamples(scheduler, 1U));
+    ASSERT_EQ(0U, App_CurrentSenseScheduler_GetNumMissedSamples(scheduler, 0U));
+
+    is_csns_sync_asserted[1] = true;
+
+    for (uint32_t tick = 0U; tick < CURRENT_SENSE_TIMEOUT_TICKS + 2U; tick++)
+    {
+        Tick();
+    }
+
+    AssertAllSamplesAreCorrect();
+    for (uint32_t channel = 0U; channel < NUM_EFUSE_CHANNELS; channel++)
+    {
+        ASSERT_NE(
+            0U, App_CurrentSenseScheduler_GetSample(scheduler, 1U, channel)
+                    .timestamp_ms);
+    }
+}
+
+TEST_F(CurrentSenseSchedulerTest, failed_switch_is_retried_on_the_next_tick)
+{
+    Tick();
+    Tick();
+    ASSERT_EQ(1U, selected_channels[2]);
+
+    are_frames_lost[2] = true;
+    Tick();
+    ASSERT_EQ(1U, App_CurrentSenseScheduler_GetNumMissedSamples(scheduler, 2U));
+
+    // A conversion of the channel the efuse was left on isn't sampled, as the
+    // switch may have gone through
+    const uint32_t timestamp_ms =
+        App_CurrentSenseScheduler_GetSample(scheduler, 2U, 1U).timestamp_ms;
+    are_frames_lost[2] = false;
+    Tick();
+    ASSERT_EQ(
+        timestamp_ms,
+        App_CurrentSenseScheduler_GetSample(scheduler, 2U, 1U).timestamp_ms);
+    ASSERT_EQ(0U, selected_channels[2]);
+
+    Tick();
+    AssertAllSamplesAreCorrect();
+    ASSERT_GT(
+        App_CurrentSenseScheduler_GetSample(scheduler, 2U, 0U).timestamp_ms,
+        timestamp_ms);
+    ASSERT_EQ(1U, App_CurrentSenseScheduler_GetNumMissedSamples(scheduler, 2U));
+}
@@ -0,0 +1,241 @@
+#include "Test_Pdm.h"
+
+extern "C"
+{
+#include "Io_EfuseRegisterCache.h"
+#include "configs/Io_EfuseConfig.h"
+}
+
+FAKE_VALUE_FUNC(
+    ExitCode,
+    transfer_frame,
+    const struct Efuse_Context *,
+    uint16_t,
+    uint16_t *);
+
+// A stand-in for the 22XS4200 on the other end of the SPI bus. A STATR_s
+// frame selects the serial output register that is sent back during the next
+// frame, and every other frame writes a serial input register.
+static uint16_t si_registers[EFUSE_ADDR_MASK + 1U];
+static uint16_t selected_so_register;
+static bool     are_frames_lost;
+
+static ExitCode TransferFrameToEfuse(
+    const struct Efuse_Context *efuse,
+    uint16_t                    tx_data,
+    uint16_t *                  rx_data)
+{
+    (void)efuse;
+
+    if (are_frames_lost)
+    {
+        return EXIT_CODE_TIMEOUT;
+    }
+
+    // The SO registers that read back the SI registers are at the same
+    // addresses, apart from GCR which has no channel
+    *rx_data = si_registers[selected_so_register];
+
+    if (tx_data == 0xFFFFU)
+    {
+        return EXIT_CODE_OK;
+    }
+
+    const uint8_t address = (tx_data >> EFUSE_ADDR_SHIFT) & EFUSE_ADDR_MASK;
+
+    if ((address & ~SOA3_MASK) == SI_STATR_0_ADDR)
+    {
+        selected_so_register = (uint16_t)(
+            (address & SOA3_MASK) |
+            (tx_data & (SOA2_MASK | SOA1_MASK | SOA0_MASK)));
+    }
+    else
+    {
+        si_registers[address] = tx_data & EFUSE_SI_DATA_MASK;
+    }
+
+    return EXIT_CODE_OK;
+}
+
+class EfuseRegisterCacheTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        register_cache = Io_EfuseRegisterCache_Create(transfer_frame, NULL);
+
+        RESET_FAKE(transfer_frame);
+        FFF_RESET_HISTORY();
+
+        transfer_frame_fake.custom_fake = TransferFrameToEfuse;
+        for (uint16_t &si_register : si_registers)
+        {
+            si_register = 0U;
+        }
+        selected_so_register = SO_STATR_ADDR;
+        are_frames_lost      = false;
+    }
+
+    void TearDown() override
+    {
+        TearDownObject(register_cache, Io_EfuseRegisterCache_Destroy);
+    }
+
+    ExitCode SelectCurrentSense(uint8_t monitoring_function)
+    {
+        return Io_EfuseRegisterCache_WriteRegisterBits(
+            register_cache, SI_GCR_ADDR, SO_GCR_ADDR,
+            CSNS1_EN_MASK | CSNS0_EN_MASK, monitoring_function);
+    }
+
+    struct EfuseRegisterCache *register_cache;
+};
+
+TEST_F(EfuseRegisterCacheTest, current_sense_selection_skips_spi_when_unchanged)
+{
+    // Selecting the current sense used to read back GCR over two frames and
+    // write it in a third, every time a current was sampled
+    si_registers[SI_GCR_ADDR] = GCR_CONFIG;
+
+    ASSERT_EQ(EXIT_CODE_OK, SelectCurrentSense(CSNS_FUNCTION_CURRENT_CH0));
+    ASSERT_EQ(3U, transfer_frame_fake.call_count);
+    ASSERT_EQ(
+        GCR_CONFIG | CSNS_FUNCTION_CURRENT_CH0, si_registers[SI_GCR_ADDR]);
+
+    for (uint32_t i = 0U; i < 100U; i++)
+    {
+        ASSERT_EQ(EXIT_CODE_OK, SelectCurrentSense(CSNS_FUNCTION_CURRENT_CH0));
+    }
+    ASSERT_EQ(3U, transfer_frame_fake.call_count);
+}
+
+TEST_F(EfuseRegisterCacheTest, alternating_current_sense_costs_one_frame_each)
+{
+    si_registers[SI_GCR_ADDR] = GCR_CONFIG;
+
+    ASSERT_EQ(EXIT_CODE_OK, SelectCurrentSense(CSNS_FUNCTION_CURRENT_CH0));
+    const unsigned int frames_to_learn_gcr = transfer_frame_fake.call_count;
+
+    // Sampling both channels of an efuse in turn used to cost 3 frames per
+    // sample
+    for (uint32_t i = 0U; i < 50U; i++)
+    {
+        ASSERT_EQ(EXIT_CODE_OK, SelectCurrentSense(CSNS_FUNCTION_CURRENT_CH1));
+        ASSERT_EQ(
+            GCR_CONFIG | CSNS_FUNCTION_CURRENT_CH1, si_registers[SI_GCR_ADDR]);
+        ASSERT_EQ(EXIT_CODE_OK, SelectCurrentSense(CSNS_FUNCTION_CURRENT_CH0));
+        ASSERT_EQ(
+            GCR_CONFIG | CSNS_FUNCTION_CURRENT_CH0, si_registers[SI_GCR_ADDR]);
+    }
+
+    ASSERT_EQ(frames_to_learn_gcr + 100U, transfer_frame_fake.call_count);
+}
+
+TEST_F(EfuseRegisterCacheTest, written_registers_are_not_read_back)
+{
+    ASSERT_EQ(
+        EXIT_CODE_OK, Io_EfuseRegisterCache_WriteRegister(
+                          register_cache, SI_GCR_ADDR, GCR_CONFIG));
+    ASSERT_EQ(1U, transfer_frame_fake.call_count);
+
+    ASSERT_EQ(EXIT_CODE_OK, SelectCurrentSense(CSNS_FUNCTION_TEMPERATURE));
+    ASSERT_EQ(2U, transfer_frame_fake.call_count);
+    ASSERT_EQ(
+        GCR_CONFIG | CSNS_FUNCTION_TEMPERATURE, si_registers[SI_GCR_ADDR]);
+}
+
+TEST_F(EfuseRegisterCacheTest, unchanged_configuration_is_not_rewritten)
+{
+    const uint8_t channel_registers[] = { SI_RETRY_0_ADDR, SI_CONFR_0_ADDR,
+                                          SI_OCR_0_ADDR,   SI_RETRY_1_ADDR,
+                                          SI_CONFR_1_ADDR, SI_OCR_1_ADDR };
+
+    for (uint32_t i = 0U; i < 2U; i++)
+    {
+        for (uint8_t address : channel_registers)
+        {
+            ASSERT_EQ(
+                EXIT_CODE_OK, Io_EfuseRegisterCache_WriteRegister(
+                                  register_cache, address, RETRY_CONFIG));
+        }
+    }
+
+    ASSERT_EQ(6U, transfer_frame_fake.call_count);
+}
+
+TEST_F(EfuseRegisterCacheTest, status_register_writes_are_always_sent)
+{
+    for (uint32_t i = 0U; i < 3U; i++)
+    {
+        ASSERT_EQ(
+            EXIT_CODE_OK, Io_EfuseRegisterCache_WriteRegister(
+                              register_cache, SI_STATR_0_ADDR, 0x0000));
+    }
+
+    ASSERT_EQ(3U, transfer_frame_fake.call_count);
+}
+
+TEST_F(EfuseRegisterCacheTest, reset_forgets_every_register)
+{
+    ASSERT_EQ(
+        EXIT_CODE_OK, Io_EfuseRegisterCache_WriteRegister(
+                          register_cache, SI_GCR_ADDR, GCR_CONFIG));
+
+    // The efuse lost its registers, e.g. in fail-safe mode
+    si_registers[SI_GCR_ADDR] = 0U;
+    Io_EfuseRegisterCache_Reset(register_cache);
+
+    ASSERT_EQ(
+        EXIT_CODE_OK, Io_EfuseRegisterCache_WriteRegister(
+                          register_cache, SI_GCR_ADDR, GCR_CONFIG));
+    ASSERT_EQ(2U, transfer_frame_fake.call_count);
+    ASSERT_EQ(GCR_CONFIG, si_registers[SI_GCR_ADDR]);
+}
+
+TEST_F(EfuseRegisterCacheTest, failed_write_is_retried)
+{
+    are_frames_lost = true;
+    ASSERT_EQ(
+        EXIT_CODE_TIMEOUT, Io_EfuseRegisterCache_WriteRegister(
+                               register_cache, SI_GCR_ADDR, GCR_CONFIG));
+
+    are_frames_lost = false;
+    ASSERT_EQ(
+        EXIT_CODE_OK, Io_EfuseRegisterCache_WriteRegister(
+                          register_cache, SI_GCR_ADDR, GCR_CONFIG));
+    ASSERT_EQ(2U, transfer_frame_fake.call_count);
+    ASSERT_EQ(GCR_CONFIG, si_registers[SI_GCR_ADDR]);
+}
+
+TEST_F(EfuseRegisterCacheTest, frames_alternate_watchdog_bit_with_even_parity)
+{
+    for (uint8_t i = 0U; i < 4U; i++)
+    {
+        ASSERT_EQ(
+            EXIT_CODE_OK, Io_EfuseRegisterCache_WriteRegister(
+                              register_cache, SI_PWMR_0_ADDR, i));
+    }
+
+    for (uint8_t i = 0U; i < 4U; i++)
+    {
+        const uint16_t frame = transfer_frame_fake.arg1_history[i];
+
+        ASSERT_EQ(i % 2U == 0U, (frame & WATCHDOG_BIT) != 0U);
+        ASSERT_EQ(0, __builtin_popcount(frame) % 2);
+        ASSERT_EQ(
+            (SI_PWMR_0_ADDR << EFUSE_ADDR_SHIFT) | i,
+            frame & ~(WATCHDOG_BIT | PARITY_BIT));
+    }
+}
+
+TEST_F(EfuseRegisterCacheTest, read_clocks_out_selected_register)
+{
+    si_registers[SO_OCR_1_ADDR] = 0xA5U;
+
+    uint16_t register_value = 0U;
+    ASSERT_EQ(
+        EXIT_CODE_OK, Io_EfuseRegisterCache_ReadRegister(
+                          register_cache, SO_OCR_1_ADDR, &register_value));
+    ASSERT_EQ(0xA5U, register_value);
+    ASSERT_EQ(2U, transfer_frame_fake.call_count);
+}
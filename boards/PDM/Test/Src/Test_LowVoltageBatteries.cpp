@@ -3,20 +3,33 @@
 extern "C"
 {
 #include "App_LowVoltageBattery.h"
+#include "configs/App_LowVoltageBatteryConfig.h"
 }
 
+#define SOC_TOLERANCE 0.5f
+
 FAKE_VALUE_FUNC(bool, has_charge_fault);
 FAKE_VALUE_FUNC(bool, has_boost_fault);
+FAKE_VALUE_FUNC(float, get_battery_voltage);
+FAKE_VALUE_FUNC(float, get_load_current);
+FAKE_VALUE_FUNC(float, get_load_voltage);
 
 class LowVoltageBatteryTest : public testing::Test
 {
   protected:
     void SetUp() override
     {
-        low_voltage_battery =
-            App_LowVoltageBattery_Create(has_charge_fault, has_boost_fault);
+        low_voltage_battery = App_LowVoltageBattery_Create(
+            has_charge_fault, has_boost_fault, get_battery_voltage,
+            get_load_current, get_load_voltage, true);
         RESET_FAKE(has_charge_fault);
         RESET_FAKE(has_boost_fault);
+        RESET_FAKE(get_battery_voltage);
+        RESET_FAKE(get_load_current);
+        RESET_FAKE(get_load_voltage);
+
+        get_load_voltage_fake.return_val = 24.0f;
+        current_time_ms                  = 0U;
     }
 
     void TearDown() override
@@ -24,7 +37,35 @@ class LowVoltageBatteryTest : public testing::Test
         TearDownObject(low_voltage_battery, App_LowVoltageBattery_Destroy);
     }
 
+    // Update the state of charge every 10ms for the given duration, with the
+    // battery at the given voltage and the loads drawing the given current
+    void RunProfile(
+        uint32_t duration_ms,
+        float    battery_voltage,
+        float    load_current)
+    {
+        get_battery_voltage_fake.return_val = battery_voltage;
+        get_load_current_fake.return_val    = load_current;
+
+        for (uint32_t elapsed_ms = 0U; elapsed_ms < duration_ms;
+             elapsed_ms += 10U)
+        {
+            current_time_ms += 10U;
+            App_LowVoltageBattery_UpdateStateOfCharge(
+                low_voltage_battery, current_time_ms);
+        }
+    }
+
+    // The current drawn from the battery at the given voltage by the loads,
+    // through the boost controller
+    static float GetBatteryCurrent(float battery_voltage, float load_current)
+    {
+        return load_current * 24.0f /
+               (battery_voltage * LV_BATTERY_BOOST_EFFICIENCY);
+    }
+
     struct LowVoltageBattery *low_voltage_battery;
+    uint32_t                  current_time_ms;
 };
 
 TEST_F(LowVoltageBatteryTest, has_charge_fault)
@@ -52,3 +93,140 @@ TEST_F(LowVoltageBatteryTest, does_not_have_boost_fault)
     ASSERT_FALSE(
         App_LowVoltageBattery_HasBoostControllerFault(low_voltage_battery));
 }
+
+TEST_F(LowVoltageBatteryTest, state_of_charge_is_initialized_from_ocv)
+{
+    // 3.74V per cell is 50% on the OCV table
+    RunProfile(10U, 7.48f, 0.0f);
+    ASSERT_NEAR(
+        50.0f, App_LowVoltageBattery_GetStateOfCharge(low_voltage_battery),
+        SOC_TOLERANCE);
+
+    TearDownObject(low_voltage_battery, App_LowVoltageBattery_Destroy);
+    SetUp();
+
+    // Between entries of the OCV table, the state of charge is interpolated
+    RunProfile(10U, 7.55f, 0.0f);
+    ASSERT_NEAR(
+        55.0f, App_LowVoltageBattery_GetStateOfCharge(low_voltage_battery),
+        SOC_TOLERANCE);
+}
+
+TEST_F(LowVoltageBatteryTest, state_of_charge_saturates_outside_ocv_table)
+{
+    RunProfile(10U, 9.0f, 0.0f);
+    ASSERT_EQ(
+        100.0f, App_LowVoltageBattery_GetStateOfCharge(low_voltage_battery));
+
+    TearDownObject(low_voltage_battery, App_LowVoltageBattery_Destroy);
+    SetUp();
+
+    RunProfile(10U, 5.0f, 0.0f);
+    ASSERT_EQ(
+        0.0f, App_LowVoltageBattery_GetStateOfCharge(low_voltage_battery));
+}
+
+TEST_F(LowVoltageBatteryTest, discharge_is_coulomb_counted)
+{
+    const float battery_voltage = 7.48f;
+    const float load_current    = 1.0f;
+
+    // The terminal voltage doesn't sag in this profile, so the state of charge
+    // only falls by the charge drawn from the battery
+    RunProfile(10U, battery_voltage, load_current);
+    const float initial_state_of_charge =
+        App_LowVoltageBattery_GetStateOfCharge(low_voltage_battery);
+
+    RunProfile(10U * 60U * 1000U, battery_voltage, load_current);
+
+    const float expected_drop =
+        GetBatteryCurrent(battery_voltage, load_current) * (10.0f / 60.0f) /
+        LV_BATTERY_CAPACITY_AH * 100.0f;
+    ASSERT_NEAR(
+        initial_state_of_charge - expected_drop,
+        App_LowVoltageBattery_GetStateOfCharge(low_voltage_battery),
+        SOC_TOLERANCE);
+}
+
+TEST_F(LowVoltageBatteryTest, state_of_charge_is_corrected_from_ocv_at_rest)
+{
+    // Start at 50% and draw a heavy load, which sags the terminal voltage
+    // without the counted state of charge following it
+    RunProfile(10U, 7.48f, 0.0f);
+    RunProfile(1000U, 6.4f, 4.0f);
+    const float loaded_state_of_charge =
+        App_LowVoltageBattery_GetStateOfCharge(low_voltage_battery);
+    ASSERT_GT(loaded_state_of_charge, 45.0f);
+
+    // After charging, the battery rests at 4.08V per cell (90%). Until it has
+    // rested for long enough, the state of charge isn't corrected.
+    RunProfile(LV_BATTERY_REST_TIME_MS - 1000U, 8.16f, 0.0f);
+    ASSERT_NEAR(
+        loaded_state_of_charge,
+        App_LowVoltageBattery_GetStateOfCharge(low_voltage_battery),
+        SOC_TOLERANCE);
+
+    // Once it has, the state of charge converges to the OCV
+    RunProfile(
+        1000U +
+            (uint32_t)(
+                10.0f * LV_BATTERY_OCV_CORRECTION_TIME_CONSTANT_S * 1000.0f),
+        8.16f, 0.0f);
+    ASSERT_NEAR(
+        90.0f, App_LowVoltageBattery_GetStateOfCharge(low_voltage_battery),
+        SOC_TOLERANCE);
+}
+
+TEST_F(LowVoltageBatteryTest, state_of_charge_is_counted_from_full_without_ocv)
+{
+    TearDownObject(low_voltage_battery, App_LowVoltageBattery_Destroy);
+    low_voltage_battery = App_LowVoltageBattery_Create(
+        has_charge_fault, has_boost_fault, get_battery_voltage,
+        get_load_current, get_load_voltage, false);
+
+    // 3.74V per cell is 50% on the OCV table, which is ignored
+    RunProfile(10U, 7.48f, 0.0f);
+    ASSERT_EQ(
+        LV_BATTERY_UNCORRECTED_INITIAL_STATE_OF_CHARGE,
+        App_LowVoltageBattery_GetStateOfCharge(low_voltage_battery));
+
+    // Nor is the state of charge corrected towards it at rest
+    RunProfile(
+        LV_BATTERY_REST_TIME_MS +
+            (uint32_t)(
+                10.0f * LV_BATTERY_OCV_CORRECTION_TIME_CONSTANT_S * 1000.0f),
+        7.48f, 0.0f);
+    ASSERT_EQ(
+        LV_BATTERY_UNCORRECTED_INITIAL_STATE_OF_CHARGE,
+        App_LowVoltageBattery_GetStateOfCharge(low_voltage_battery));
+}
+
+TEST_F(LowVoltageBatteryTest, time_to_empty_follows_smoothed_current)
+{
+    const float battery_voltage = 7.48f;
+
+    // While the battery isn't discharging, the time to empty saturates
+    RunProfile(10U, battery_voltage, 0.0f);
+    ASSERT_EQ(
+        LV_BATTERY_MAX_TIME_TO_EMPTY_MIN,
+        App_LowVoltageBattery_GetTimeToEmpty(low_voltage_battery));
+
+    // A brief load barely moves the time to empty
+    RunProfile(100U, battery_voltage, 2.0f);
+    ASSERT_GT(
+        App_LowVoltageBattery_GetTimeToEmpty(low_voltage_battery), 500.0f);
+
+    // A sustained load settles to the remaining charge over its current
+    RunProfile(
+        (uint32_t)(10.0f * LV_BATTERY_CURRENT_TIME_CONSTANT_S * 1000.0f),
+        battery_voltage, 2.0f);
+    const float remaining_capacity_ah =
+        App_LowVoltageBattery_GetStateOfCharge(low_voltage_battery) / 100.0f *
+        LV_BATTERY_CAPACITY_AH;
+    const float expected_time_to_empty =
+        remaining_capacity_ah / GetBatteryCurrent(battery_voltage, 2.0f) *
+        60.0f;
+    ASSERT_NEAR(
+        expected_time_to_empty,
+        App_LowVoltageBattery_GetTimeToEmpty(low_voltage_battery), 1.0f);
+}
@@ -0,0 +1,337 @@
+#include "Test_Pdm.h"
+
+extern "C"
+{
+#include "App_OutputProtection.h"
+#include "configs/App_OutputProtectionConfig.h"
+}
+
+FAKE_VALUE_FUNC(float, get_current, uint32_t);
+FAKE_VOID_FUNC(set_enabled, uint32_t, bool);
+FAKE_VOID_FUNC(delatch_faults, uint32_t);
+FAKE_VALUE_FUNC(float, get_lv_battery_voltage);
+
+#define TICK_PERIOD_MS 1U
+#define NUM_OUTPUTS 3U
+
+#define AUX_OUTPUT 0U
+#define FAN_OUTPUT 1U
+#define SHUTDOWN_OUTPUT 2U
+
+#define NOMINAL_VOLTAGE 7.2f
+#define SAGGING_VOLTAGE 6.0f
+#define RECOVERING_VOLTAGE 6.6f
+
+// clang-format off
+static const struct OutputProtectionConfig configs[NUM_OUTPUTS] = {
+    [AUX_OUTPUT]      = { true, 1.0f, 4.0f, 8.0f, 1000U, 3U, 2U },
+    [FAN_OUTPUT]      = { true, 2.0f, 20.0f, 15.0f, 500U, 1U, 1U },
+    [SHUTDOWN_OUTPUT] = { true, 2.0f, 20.0f, 15.0f, 100U, 5U, SHED_PRIORITY_NEVER },
+};
+
+// An output with nothing to power
+static const struct OutputProtectionConfig unused_output_configs[1] = {
+    { false, 1.0f, 4.0f, 8.0f, 1000U, 3U, SHED_PRIORITY_NEVER },
+};
+// clang-format on
+
+// A stand-in for the efuse outputs, which only carry their load current while
+// they are turned on
+static float load_currents[NUM_OUTPUTS];
+static bool  is_output_on[NUM_OUTPUTS];
+
+static float GetCurrent(uint32_t output)
+{
+    return is_output_on[output] ? load_currents[output] : 0.0f;
+}
+
+static void SetEnabled(uint32_t output, bool is_enabled)
+{
+    is_output_on[output] = is_enabled;
+}
+
+class OutputProtectionTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        RESET_FAKE(get_current);
+        RESET_FAKE(set_enabled);
+        RESET_FAKE(delatch_faults);
+        RESET_FAKE(get_lv_battery_voltage);
+        FFF_RESET_HISTORY();
+
+        get_current_fake.custom_fake           = GetCurrent;
+        set_enabled_fake.custom_fake           = SetEnabled;
+        get_lv_battery_voltage_fake.return_val = NOMINAL_VOLTAGE;
+
+        for (uint32_t output = 0U; output < NUM_OUTPUTS; output++)
+        {
+            load_currents[output] = 0.0f;
+            is_output_on[output]  = false;
+        }
+
+        protection = App_OutputProtection_Create(
+            configs, NUM_OUTPUTS, TICK_PERIOD_MS, get_current, set_enabled,
+            delatch_faults, get_lv_battery_voltage);
+    }
+
+    void TearDown() override
+    {
+        TearDownObject(protection, App_OutputProtection_Destroy);
+    }
+
+    void TickForMs(uint32_t duration_ms)
+    {
+        for (uint32_t ms = 0U; ms < duration_ms; ms += TICK_PERIOD_MS)
+        {
+            App_OutputProtection_Tick(protection);
+        }
+    }
+
+    struct OutputProtection *protection;
+};
+
+TEST_F(OutputProtectionTest, every_output_is_turned_on_when_created)
+{
+    for (uint32_t output = 0U; output < NUM_OUTPUTS; output++)
+    {
+        ASSERT_TRUE(is_output_on[output]);
+        ASSERT_TRUE(App_OutputProtection_IsOutputEnabled(protection, output));
+    }
+    ASSERT_EQ(NUM_OUTPUTS, set_enabled_fake.call_count);
+}
+
+TEST_F(OutputProtectionTest, output_that_is_disabled_by_default_stays_off)
+{
+    App_OutputProtection_Destroy(protection);
+    RESET_FAKE(set_enabled);
+    set_enabled_fake.custom_fake = SetEnabled;
+    is_output_on[0]              = true;
+
+    protection = App_OutputProtection_Create(
+        unused_output_configs, 1U, TICK_PERIOD_MS, get_current, set_enabled,
+        delatch_faults, get_lv_battery_voltage);
+    ASSERT_FALSE(is_output_on[0]);
+    ASSERT_FALSE(App_OutputProtection_IsOutputEnabled(protection, 0U));
+
+    // Neither recovering from a sag nor running without a trip turns it on
+    get_lv_battery_voltage_fake.return_val = SAGGING_VOLTAGE;
+    TickForMs(LOAD_SHED_DWELL_MS);
+    get_lv_battery_voltage_fake.return_val = NOMINAL_VOLTAGE;
+    TickForMs(LOAD_RESTORE_DWELL_MS + OUTPUT_PROTECTION_RETRY_RESET_MS);
+
+    ASSERT_FALSE(is_output_on[0]);
+    ASSERT_FALSE(App_OutputProtection_IsOutputEnabled(protection, 0U));
+    ASSERT_EQ(0U, get_current_fake.call_count);
+    for (uint32_t call = 0U; call < set_enabled_fake.call_count; call++)
+    {
+        ASSERT_FALSE(set_enabled_fake.arg1_history[call]);
+    }
+}
+
+TEST_F(OutputProtectionTest, inrush_spike_does_not_trip)
+{
+    // A 6A inrush decaying to 0.8A over 50ms adds well under the trip I²t
+    for (uint32_t ms = 0U; ms < 50U; ms++)
+    {
+        load_currents[AUX_OUTPUT] = 6.0f - 0.1f * (float)ms;
+        TickForMs(1U);
+    }
+    ASSERT_GT(
+        App_OutputProtection_GetThermalLoad(protection, AUX_OUTPUT), 0.0f);
+
+    load_currents[AUX_OUTPUT] = 0.8f;
+    TickForMs(10000U);
+
+    ASSERT_TRUE(is_output_on[AUX_OUTPUT]);
+    ASSERT_FALSE(App_OutputProtection_IsOutputTripped(protection, AUX_OUTPUT));
+    ASSERT_EQ(
+        0.0f, App_OutputProtection_GetThermalLoad(protection, AUX_OUTPUT));
+}
+
+TEST_F(OutputProtectionTest, sustained_overload_trips_on_its_curve)
+{
+    // At 2A, the output heats up by (2² - 1²) = 3A²s every second, so it trips
+    // after 4 / 3 seconds
+    load_currents[AUX_OUTPUT] = 2.0f;
+
+    TickForMs(1300U);
+    ASSERT_TRUE(is_output_on[AUX_OUTPUT]);
+    ASSERT_NEAR(
+        1.3f * 3.0f / 4.0f,
+        App_OutputProtection_GetThermalLoad(protection, AUX_OUTPUT), 0.01f);
+
+    TickForMs(50U);
+    ASSERT_FALSE(is_output_on[AUX_OUTPUT]);
+    ASSERT_TRUE(App_OutputProtection_IsOutputTripped(protection, AUX_OUTPUT));
+
+    // The other outputs are unaffected
+    ASSERT_TRUE(is_output_on[FAN_OUTPUT]);
+    ASSERT_TRUE(is_output_on[SHUTDOWN_OUTPUT]);
+}
+
+TEST_F(OutputProtectionTest, short_circuit_trips_immediately)
+{
+    load_currents[FAN_OUTPUT] = 30.0f;
+    TickForMs(1U);
+
+    ASSERT_FALSE(is_output_on[FAN_OUTPUT]);
+    ASSERT_TRUE(App_OutputProtection_IsOutputTripped(protection, FAN_OUTPUT));
+}
+
+TEST_F(OutputProtectionTest, tripped_output_is_retried_with_backoff)
+{
+    load_currents[AUX_OUTPUT] = 10.0f;
+    TickForMs(1U);
+    ASSERT_FALSE(is_output_on[AUX_OUTPUT]);
+
+    // Each retry waits twice as long as the last, and delatches the efuse
+    // before turning the output back on
+    uint32_t retry_delay_ms = configs[AUX_OUTPUT].retry_delay_ms;
+    for (uint32_t retry = 0U; retry < configs[AUX_OUTPUT].max_retries; retry++)
+    {
+        TickForMs(retry_delay_ms - TICK_PERIOD_MS);
+        ASSERT_FALSE(is_output_on[AUX_OUTPUT]);
+        ASSERT_EQ(retry, delatch_faults_fake.call_count);
+
+        TickForMs(TICK_PERIOD_MS);
+        ASSERT_TRUE(is_output_on[AUX_OUTPUT]);
+        ASSERT_EQ(retry + 1U, delatch_faults_fake.call_count);
+        ASSERT_EQ(AUX_OUTPUT, delatch_faults_fake.arg0_val);
+
+        // The short circuit is still there
+        TickForMs(TICK_PERIOD_MS);
+        ASSERT_FALSE(is_output_on[AUX_OUTPUT]);
+
+        retry_delay_ms *= 2U;
+    }
+
+    // Out of retries, so the output stays off
+    ASSERT_TRUE(
+        App_OutputProtection_IsOutputLatchedOff(protection, AUX_OUTPUT));
+    TickForMs(60000U);
+    ASSERT_FALSE(is_output_on[AUX_OUTPUT]);
+    ASSERT_EQ(configs[AUX_OUTPUT].max_retries, delatch_faults_fake.call_count);
+}
+
+TEST_F(OutputProtectionTest, retries_are_reset_after_running_without_a_trip)
+{
+    // Use up the only retry of the output
+    load_currents[FAN_OUTPUT] = 30.0f;
+    TickForMs(1U);
+    load_currents[FAN_OUTPUT] = 1.0f;
+    TickForMs(configs[FAN_OUTPUT].retry_delay_ms);
+    ASSERT_TRUE(is_output_on[FAN_OUTPUT]);
+
+    // After running cleanly for long enough, the output can be retried again
+    TickForMs(OUTPUT_PROTECTION_RETRY_RESET_MS);
+    load_currents[FAN_OUTPUT] = 30.0f;
+    TickForMs(1U);
+    ASSERT_FALSE(
+        App_OutputProtection_IsOutputLatchedOff(protection, FAN_OUTPUT));
+    load_currents[FAN_OUTPUT] = 1.0f;
+    TickForMs(configs[FAN_OUTPUT].retry_delay_ms);
+    ASSERT_TRUE(is_output_on[FAN_OUTPUT]);
+
+    // Tripping again straight away latches the output off
+    load_currents[FAN_OUTPUT] = 30.0f;
+    TickForMs(1U);
+    ASSERT_TRUE(
+        App_OutputProtection_IsOutputLatchedOff(protection, FAN_OUTPUT));
+}
+
+TEST_F(OutputProtectionTest, retried_output_remembers_its_heat)
+{
+    // Trip on a sustained 2A overload, which leaves the output at its trip I²t
+    load_currents[AUX_OUTPUT] = 2.0f;
+    while (is_output_on[AUX_OUTPUT])
+    {
+        TickForMs(TICK_PERIOD_MS);
+    }
+
+    // The output cools by 1A²s over its 1s retry delay, so the same overload
+    // trips it again after a third of a second rather than 4 / 3 seconds
+    TickForMs(configs[AUX_OUTPUT].retry_delay_ms);
+    ASSERT_TRUE(is_output_on[AUX_OUTPUT]);
+    TickForMs(300U);
+    ASSERT_TRUE(is_output_on[AUX_OUTPUT]);
+    TickForMs(50U);
+    ASSERT_FALSE(is_output_on[AUX_OUTPUT]);
+}
+
+TEST_F(OutputProtectionTest, outputs_are_shed_by_priority_while_voltage_sags)
+{
+    get_lv_battery_voltage_fake.return_val = SAGGING_VOLTAGE;
+
+    // The highest shed priority is shed first
+    TickForMs(LOAD_SHED_DWELL_MS - TICK_PERIOD_MS);
+    ASSERT_TRUE(is_output_on[AUX_OUTPUT]);
+    TickForMs(TICK_PERIOD_MS);
+    ASSERT_FALSE(is_output_on[AUX_OUTPUT]);
+    ASSERT_TRUE(App_OutputProtection_IsOutputShed(protection, AUX_OUTPUT));
+    ASSERT_TRUE(is_output_on[FAN_OUTPUT]);
+
+    // Then the next, if the voltage still sags
+    TickForMs(LOAD_SHED_DWELL_MS);
+    ASSERT_FALSE(is_output_on[FAN_OUTPUT]);
+    ASSERT_TRUE(App_OutputProtection_IsOutputShed(protection, FAN_OUTPUT));
+
+    // An output that is never shed stays on
+    TickForMs(10U * LOAD_SHED_DWELL_MS);
+    ASSERT_TRUE(is_output_on[SHUTDOWN_OUTPUT]);
+    ASSERT_FALSE(
+        App_OutputProtection_IsOutputShed(protection, SHUTDOWN_OUTPUT));
+
+    // Shed outputs aren't tripped, so they aren't retried
+    ASSERT_FALSE(App_OutputProtection_IsOutputTripped(protection, AUX_OUTPUT));
+    ASSERT_EQ(0U, delatch_faults_fake.call_count);
+}
+
+TEST_F(OutputProtectionTest, shed_outputs_are_restored_with_hysteresis)
+{
+    get_lv_battery_voltage_fake.return_val = SAGGING_VOLTAGE;
+    TickForMs(2U * LOAD_SHED_DWELL_MS);
+    ASSERT_FALSE(is_output_on[AUX_OUTPUT]);
+    ASSERT_FALSE(is_output_on[FAN_OUTPUT]);
+
+    // Between the shed and restore voltages, nothing changes
+    get_lv_battery_voltage_fake.return_val = RECOVERING_VOLTAGE;
+    TickForMs(10U * LOAD_RESTORE_DWELL_MS);
+    ASSERT_FALSE(is_output_on[AUX_OUTPUT]);
+    ASSERT_FALSE(is_output_on[FAN_OUTPUT]);
+
+    // The last shed priority is restored first
+    get_lv_battery_voltage_fake.return_val = NOMINAL_VOLTAGE;
+    TickForMs(LOAD_RESTORE_DWELL_MS);
+    ASSERT_FALSE(is_output_on[AUX_OUTPUT]);
+    ASSERT_TRUE(is_output_on[FAN_OUTPUT]);
+
+    // A dip while restoring starts the restore dwell over
+    get_lv_battery_voltage_fake.return_val = RECOVERING_VOLTAGE;
+    TickForMs(1U);
+    get_lv_battery_voltage_fake.return_val = NOMINAL_VOLTAGE;
+    TickForMs(LOAD_RESTORE_DWELL_MS - TICK_PERIOD_MS);
+    ASSERT_FALSE(is_output_on[AUX_OUTPUT]);
+    TickForMs(TICK_PERIOD_MS);
+    ASSERT_TRUE(is_output_on[AUX_OUTPUT]);
+    ASSERT_FALSE(App_OutputProtection_IsOutputShed(protection, AUX_OUTPUT));
+}
+
+TEST_F(OutputProtectionTest, outputs_are_not_shed_without_lv_battery_voltage)
+{
+    App_OutputProtection_Destroy(protection);
+    protection = App_OutputProtection_Create(
+        configs, NUM_OUTPUTS, TICK_PERIOD_MS, get_current, set_enabled,
+        delatch_faults, NULL);
+
+    get_lv_battery_voltage_fake.return_val = SAGGING_VOLTAGE;
+    TickForMs(10U * LOAD_SHED_DWELL_MS);
+
+    for (uint32_t output = 0U; output < NUM_OUTPUTS; output++)
+    {
+        ASSERT_TRUE(is_output_on[output]);
+        ASSERT_FALSE(App_OutputProtection_IsOutputShed(protection, output));
+    }
+    ASSERT_EQ(0U, get_lv_battery_voltage_fake.call_count);
+}
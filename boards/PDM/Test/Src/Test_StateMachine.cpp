@@ -13,6 +13,8 @@ extern "C"
 #include "configs/App_VoltageLimits.h"
 #include "configs/App_CurrentLimits.h"
 #include "configs/App_HeartbeatMonitorConfig.h"
+#include "configs/App_LowVoltageBatteryConfig.h"
+#include "configs/App_OutputProtectionConfig.h"
 }
 
 namespace StateMachineTest
@@ -40,6 +42,7 @@ FAKE_VALUE_FUNC(float, GetRightInverterCurrent);
 FAKE_VALUE_FUNC(float, GetEnergyMeterCurrent);
 FAKE_VALUE_FUNC(float, GetCanCurrent);
 FAKE_VALUE_FUNC(float, GetAirShutdownCurrent);
+FAKE_VALUE_FUNC(float, GetLowVoltageLoadCurrent);
 
 FAKE_VALUE_FUNC(uint32_t, get_current_ms);
 FAKE_VOID_FUNC(
@@ -54,6 +57,16 @@ FAKE_VOID_FUNC(turn_on_blue_led);
 FAKE_VALUE_FUNC(bool, do_low_voltage_battery_have_charge_fault);
 FAKE_VALUE_FUNC(bool, do_low_voltage_battery_have_boost_controller_fault);
 
+FAKE_VALUE_FUNC(float, GetOutputCurrent, uint32_t);
+FAKE_VOID_FUNC(SetOutputEnabled, uint32_t, bool);
+FAKE_VOID_FUNC(DelatchOutputFaults, uint32_t);
+
+// clang-format off
+static const struct OutputProtectionConfig output_protection_configs[1] = {
+    { true, 1.0f, 4.0f, 8.0f, 10U, 3U, SHED_PRIORITY_NEVER },
+};
+// clang-format on
+
 class PdmStateMachineTest : public BaseStateMachineTest
 {
   protected:
@@ -110,7 +123,12 @@ class PdmStateMachineTest : public BaseStateMachineTest
 
         low_voltage_battery = App_LowVoltageBattery_Create(
             do_low_voltage_battery_have_charge_fault,
-            do_low_voltage_battery_have_boost_controller_fault);
+            do_low_voltage_battery_have_boost_controller_fault, GetVbatVoltage,
+            GetLowVoltageLoadCurrent, Get24vAuxVoltage, true);
+
+        output_protection = App_OutputProtection_Create(
+            output_protection_configs, 1U, 1U, GetOutputCurrent,
+            SetOutputEnabled, DelatchOutputFaults, GetVbatVoltage);
 
         clock = App_SharedClock_Create();
 
@@ -122,7 +140,7 @@ class PdmStateMachineTest : public BaseStateMachineTest
             right_inverter_current_in_range_check,
             energy_meter_current_in_range_check, can_current_in_range_check,
             air_shutdown_current_in_range_check, heartbeat_monitor,
-            rgb_led_sequence, low_voltage_battery, clock);
+            rgb_led_sequence, low_voltage_battery, output_protection, clock);
 
         // Default to starting the state machine in the `init` state
         state_machine =
@@ -143,6 +161,7 @@ class PdmStateMachineTest : public BaseStateMachineTest
         RESET_FAKE(GetEnergyMeterCurrent);
         RESET_FAKE(GetCanCurrent);
         RESET_FAKE(GetAirShutdownCurrent);
+        RESET_FAKE(GetLowVoltageLoadCurrent);
         RESET_FAKE(get_current_ms);
         RESET_FAKE(heartbeat_timeout_callback);
         RESET_FAKE(turn_on_red_led);
@@ -150,6 +169,9 @@ class PdmStateMachineTest : public BaseStateMachineTest
         RESET_FAKE(turn_on_blue_led);
         RESET_FAKE(do_low_voltage_battery_have_charge_fault);
         RESET_FAKE(do_low_voltage_battery_have_boost_controller_fault);
+        RESET_FAKE(GetOutputCurrent);
+        RESET_FAKE(SetOutputEnabled);
+        RESET_FAKE(DelatchOutputFaults);
     }
 
     void TearDown() override
@@ -177,6 +199,7 @@ class PdmStateMachineTest : public BaseStateMachineTest
         TearDownObject(rgb_led_sequence, App_SharedRgbLedSequence_Destroy);
         TearDownObject(state_machine, App_SharedStateMachine_Destroy);
         TearDownObject(low_voltage_battery, App_LowVoltageBattery_Destroy);
+        TearDownObject(output_protection, App_OutputProtection_Destroy);
         TearDownObject(clock, App_SharedClock_Destroy);
     }
 
@@ -362,6 +385,7 @@ class PdmStateMachineTest : public BaseStateMachineTest
     struct HeartbeatMonitor * heartbeat_monitor;
     struct RgbLedSequence *   rgb_led_sequence;
     struct LowVoltageBattery *low_voltage_battery;
+    struct OutputProtection * output_protection;
     struct Clock *            clock;
 };
 
@@ -786,4 +810,51 @@ TEST_F(PdmStateMachineTest, clear_18650s_boost_controller_fault_in_all_states)
             App_CanTx_GetPeriodicSignal_BOOST_PGOOD_FAULT(can_tx_interface));
     }
 }
+
+TEST_F(PdmStateMachineTest, check_glv_battery_can_signals_in_all_states)
+{
+    for (auto &state : GetAllStates())
+    {
+        SetInitialState(state);
+
+        // A fully charged battery that isn't discharging
+        GetVbatVoltage_fake.return_val           = 8.4f;
+        GetLowVoltageLoadCurrent_fake.return_val = 0.0f;
+        LetTimePass(state_machine, 10);
+
+        ASSERT_EQ(
+            100.0f,
+            App_CanTx_GetPeriodicSignal_GLV_STATE_OF_CHARGE(can_tx_interface));
+        ASSERT_EQ(
+            LV_BATTERY_MAX_TIME_TO_EMPTY_MIN,
+            App_CanTx_GetPeriodicSignal_GLV_TIME_TO_EMPTY(can_tx_interface));
+    }
+}
+
+TEST_F(PdmStateMachineTest, output_protection_is_ticked_in_all_states)
+{
+    for (auto &state : GetAllStates())
+    {
+        SetInitialState(state);
+        RESET_FAKE(SetOutputEnabled);
+
+        // A short circuit trips the output on the next 1kHz tick
+        GetOutputCurrent_fake.return_val = 20.0f;
+        LetTimePass(state_machine, 1);
+
+        ASSERT_TRUE(
+            App_OutputProtection_IsOutputTripped(output_protection, 0U));
+        ASSERT_EQ(1, SetOutputEnabled_fake.call_count);
+        ASSERT_FALSE(SetOutputEnabled_fake.arg1_val);
+
+        // Once the short circuit clears, the output is retried after a delay
+        // that doubles with every state's trip
+        GetOutputCurrent_fake.return_val = 0.0f;
+        LetTimePass(state_machine, 1000);
+
+        ASSERT_FALSE(
+            App_OutputProtection_IsOutputTripped(output_protection, 0U));
+        ASSERT_TRUE(SetOutputEnabled_fake.arg1_val);
+    }
+}
 } // namespace StateMachineTest
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <stdint.h>
+
+// The most ADC channels that can be converted in one scan
+#define ADC_PIPELINE_MAX_CHANNELS 8U
+
+// The longest window of decimated samples for a median filter
+#define ADC_PIPELINE_MAX_MEDIAN_WINDOW 7U
+
+enum AdcFilterType
+{
+    // Publish every decimated sample as is
+    ADC_FILTER_NONE,
+    // Smooth the decimated samples with a first-order IIR low pass filter
+    ADC_FILTER_IIR,
+    // Publish the median of the most recent decimated samples, which rejects
+    // spikes without smoothing steps
+    ADC_FILTER_MEDIAN,
+};
+
+struct AdcChannelConfig
+{
+    enum AdcFilterType filter_type;
+
+    // For ADC_FILTER_IIR, the weight in (0, 1] of each new decimated sample
+    float iir_smoothing_factor;
+
+    // For ADC_FILTER_MEDIAN, the odd number of most recent decimated samples
+    // that the median is taken over, at most ADC_PIPELINE_MAX_MEDIAN_WINDOW
+    uint32_t median_window_size;
+};
+
+struct AdcChannelOutput
+{
+    // The filtered voltage of the channel, in V
+    float voltage;
+
+    // The time at which the last scan contributing to the voltage finished, in
+    // ms
+    uint32_t timestamp_ms;
+};
+
+struct AdcPipeline;
+
+/**
+ * Allocate and initialize a pipeline that processes the raw values written by
+ * a DMA controller for an ADC scanning several channels. The ADC converts
+ * oversampling_ratio scans per block, which are decimated to one sample per
+ * channel by averaging, filtered per channel and scaled to a voltage with a
+ * scale factor computed here.
+ * @param num_channels The number of channels converted in each scan, at most
+ *                     ADC_PIPELINE_MAX_CHANNELS
+ * @param oversampling_ratio The number of scans decimated to one sample
+ * @param reference_voltage The voltage corresponding to a raw value of
+ *                          full_scale, in V
+ * @param full_scale The largest raw value of the ADC (e.g. 4095 for a 12-bit
+ *                   ADC)
+ * @param channel_configs The filter of each channel, in the order the channels
+ *                        are converted in a scan
+ * @return The created ADC pipeline, whose ownership is given to the caller
+ */
+struct AdcPipeline *App_SharedAdcPipeline_Create(
+    uint32_t                       num_channels,
+    uint32_t                       oversampling_ratio,
+    float                          reference_voltage,
+    uint32_t                       full_scale,
+    const struct AdcChannelConfig *channel_configs);
+
+/**
+ * Deallocate the memory used by the given ADC pipeline
+ * @param adc_pipeline The ADC pipeline to deallocate
+ */
+void App_SharedAdcPipeline_Destroy(struct AdcPipeline *adc_pipeline);
+
+/**
+ * Process one block of scans with the given ADC pipeline, and publish the
+ * resulting voltage of every channel
+ * @note This is safe to call from the DMA interrupt while another context
+ *       gets the output of a channel
+ * @param adc_pipeline The ADC pipeline to process the block with
+ * @param raw_adc_values The raw values of oversampling_ratio consecutive scans,
+ *                       each of which holds num_channels raw values in the
+ *                       order the channels are converted
+ * @param timestamp_ms The time at which the last scan of the block finished,
+ *                     in ms
+ */
+void App_SharedAdcPipeline_ProcessBlock(
+    struct AdcPipeline *adc_pipeline,
+    const uint16_t *    raw_adc_values,
+    uint32_t            timestamp_ms);
+
+/**
+ * Get the output of a channel of the given ADC pipeline
+ * @param adc_pipeline The ADC pipeline to get the output from
+ * @param channel The index of the channel in a scan
+ * @return The voltage of the channel and when it was converted, as of the last
+ *         processed block. Before any block is processed, this is 0V at 0ms.
+ */
+struct AdcChannelOutput App_SharedAdcPipeline_GetOutput(
+    const struct AdcPipeline *adc_pipeline,
+    uint32_t                  channel);
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <stdint.h>
+
+struct CaptureFrequency;
+
+/**
+ * Allocate and initialize a frequency measurement for a timer channel that
+ * captures the counter on every rising edge of a signal. Rather than computing
+ * the frequency from the two most recent edges, the captured counter values
+ * are processed in batches: the frequency is the number of edges in a batch
+ * over the time between the last edge of the previous batch and the last edge
+ * of this batch.
+ * @param timer_frequency_hz The frequency of the timer capturing the edges
+ * @param timer_period_ticks The number of ticks before the timer counter wraps
+ *                           around (i.e. The auto-reload register + 1)
+ * @param timeout_ms The time without any edge after which the frequency is
+ *                   0Hz. This must be shorter than one timer period, so the
+ *                   time between two consecutive edges is never ambiguous.
+ * @return The created frequency measurement, whose ownership is given to the
+ *         caller
+ */
+struct CaptureFrequency *App_SharedCaptureFrequency_Create(
+    float    timer_frequency_hz,
+    uint32_t timer_period_ticks,
+    uint32_t timeout_ms);
+
+/**
+ * Deallocate the memory used by the given frequency measurement
+ * @param capture_frequency The frequency measurement to deallocate
+ */
+void App_SharedCaptureFrequency_Destroy(
+    struct CaptureFrequency *capture_frequency);
+
+/**
+ * Update the frequency of the given frequency measurement with the edges
+ * captured since the last update
+ * @param capture_frequency The frequency measurement to update
+ * @param captures The counter values captured since the last update, oldest
+ *                 first
+ * @param num_captures The number of counter values in captures
+ * @param current_time_ms The current time, in ms
+ */
+void App_SharedCaptureFrequency_Update(
+    struct CaptureFrequency *capture_frequency,
+    const uint32_t *         captures,
+    uint32_t                 num_captures,
+    uint32_t                 current_time_ms);
+
+/**
+ * Get the frequency of the given frequency measurement
+ * @param capture_frequency The frequency measurement to get the frequency of
+ * @return The frequency, in Hz, as of the last update
+ */
+float App_SharedCaptureFrequency_GetFrequency(
+    const struct CaptureFrequency *capture_frequency);
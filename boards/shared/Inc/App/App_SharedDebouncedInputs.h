@@ -0,0 +1,79 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// The number of samples in a row that an input must read its new level for
+// before its state changes, which is set by the 2-bit vertical counters
+#define DEBOUNCED_INPUTS_NUM_SAMPLES 4U
+
+struct DebouncedInputs;
+
+/**
+ * Allocate and initialize up to 32 debounced digital inputs, which are sampled
+ * together into a bitmask with one bit per input. An input only changes state
+ * once it has read the same new level for DEBOUNCED_INPUTS_NUM_SAMPLES samples
+ * in a row, and every input is debounced in parallel with vertical counters.
+ * @note Samples may be taken and states and edges read from different tasks,
+ *       since each is written by one side only. Edges must only be taken from
+ *       one task.
+ * @param read_inputs A function that returns the raw level of every input,
+ *                    with bit i set if input i reads high. It is also called
+ *                    once here, so the inputs start in their current state
+ *                    without any edge.
+ * @return The created debounced inputs, whose ownership is given to the
+ *         caller
+ */
+struct DebouncedInputs *
+    App_SharedDebouncedInputs_Create(uint32_t (*read_inputs)(void));
+
+/**
+ * Deallocate the memory used by the given debounced inputs
+ * @param debounced_inputs The debounced inputs to deallocate
+ */
+void App_SharedDebouncedInputs_Destroy(
+    struct DebouncedInputs *debounced_inputs);
+
+/**
+ * Sample every input of the given debounced inputs, which must be called with
+ * a fixed period that sets the debounce time together with
+ * DEBOUNCED_INPUTS_NUM_SAMPLES
+ * @param debounced_inputs The debounced inputs to sample
+ */
+void App_SharedDebouncedInputs_Sample(struct DebouncedInputs *debounced_inputs);
+
+/**
+ * Get the debounced state of every input of the given debounced inputs
+ * @param debounced_inputs The debounced inputs to get the states of
+ * @return The debounced states, with bit i set if input i is high
+ */
+uint32_t App_SharedDebouncedInputs_GetStates(
+    const struct DebouncedInputs *debounced_inputs);
+
+/**
+ * Check if an input of the given debounced inputs is high once debounced
+ * @param debounced_inputs The debounced inputs to check
+ * @param input The index of the input to check
+ * @return true if the given input is high, else false
+ */
+bool App_SharedDebouncedInputs_IsHigh(
+    const struct DebouncedInputs *debounced_inputs,
+    uint32_t                      input);
+
+/**
+ * Take the inputs of the given debounced inputs that went from low to high
+ * since they were last taken
+ * @param debounced_inputs The debounced inputs to take the rising edges of
+ * @return The rising edges, with bit i set if input i went from low to high
+ */
+uint32_t App_SharedDebouncedInputs_TakeRisingEdges(
+    struct DebouncedInputs *debounced_inputs);
+
+/**
+ * Take the inputs of the given debounced inputs that went from high to low
+ * since they were last taken
+ * @param debounced_inputs The debounced inputs to take the falling edges of
+ * @return The falling edges, with bit i set if input i went from high to low
+ */
+uint32_t App_SharedDebouncedInputs_TakeFallingEdges(
+    struct DebouncedInputs *debounced_inputs);
@@ -30,6 +30,23 @@ ExitCode App_SharedErrorTable_SetError(
     enum ErrorId       error_id,
     bool               is_set);
 
+/**
+ * Register the function to call whenever an error in the given error table
+ * changes from cleared to set or vice versa, replacing the previously
+ * registered one. Setting an error that is already set, or clearing an error
+ * that is already cleared, doesn't call it.
+ * @note The function is called from the task that sets or clears the error
+ * @param error_table The error table to watch
+ * @param error_changed_callback The function to call with the error that was
+ *                               set or cleared, or NULL to stop watching the
+ *                               error table
+ * @param context The context to pass to error_changed_callback
+ */
+void App_SharedErrorTable_SetErrorChangedCallback(
+    struct ErrorTable *error_table,
+    void (*error_changed_callback)(const struct Error *error, void *context),
+    void *context);
+
 /**
  * Check if an error in the given error table is set
  * @param error_table The error table to check
@@ -57,6 +74,29 @@ bool App_SharedErrorTable_HasAnyErrorSet(const struct ErrorTable *error_table);
 bool App_SharedErrorTable_HasAnyCriticalErrorSet(
     const struct ErrorTable *error_table);
 
+/**
+ * Check if any critical error for the given board is set in the given error
+ * table, without going through every error in the error table
+ * @param error_table The error table to check
+ * @param board The board to check
+ * @return true if any critical error for the given board is set, else false
+ */
+bool App_SharedErrorTable_HasAnyCriticalErrorSetForBoard(
+    const struct ErrorTable *error_table,
+    enum Board               board);
+
+/**
+ * Check if any non-critical error for the given board is set in the given
+ * error table, without going through every error in the error table
+ * @param error_table The error table to check
+ * @param board The board to check
+ * @return true if any non-critical error for the given board is set, else
+ *         false
+ */
+bool App_SharedErrorTable_HasAnyNonCriticalErrorSetForBoard(
+    const struct ErrorTable *error_table,
+    enum Board               board);
+
 /**
  * Check if any AIR shutdown error in the given error table is set
  * @param error_table The error table to check
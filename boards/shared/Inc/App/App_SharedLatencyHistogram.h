@@ -0,0 +1,47 @@
+#pragma once
+
+#include <stdint.h>
+
+struct LatencyHistogram;
+
+/**
+ * Allocate and initialize a histogram of latencies, with bins of equal width
+ * starting from 0us. The last bin also counts every latency beyond it, so no
+ * latency goes unrecorded however long it is.
+ * @note Latencies may be recorded and bin counts taken from different tasks,
+ *       since each is written by one side only
+ * @param bin_width_us The width of every bin, in us
+ * @param num_bins The number of bins
+ * @return The created latency histogram, whose ownership is given to the
+ *         caller
+ */
+struct LatencyHistogram *
+    App_SharedLatencyHistogram_Create(uint32_t bin_width_us, uint32_t num_bins);
+
+/**
+ * Deallocate the memory used by the given latency histogram
+ * @param latency_histogram The latency histogram to deallocate
+ */
+void App_SharedLatencyHistogram_Destroy(
+    struct LatencyHistogram *latency_histogram);
+
+/**
+ * Record a latency in the given latency histogram
+ * @param latency_histogram The latency histogram to record the latency in
+ * @param latency_us The latency to record, in us
+ */
+void App_SharedLatencyHistogram_Record(
+    struct LatencyHistogram *latency_histogram,
+    uint32_t                 latency_us);
+
+/**
+ * Take the count of a bin of the given latency histogram
+ * @param latency_histogram The latency histogram to take the count from
+ * @param bin The bin to take the count of, where bin i counts the latencies in
+ *            [i * bin width, (i + 1) * bin width)
+ * @return The number of latencies recorded in the given bin since its count
+ *         was last taken
+ */
+uint32_t App_SharedLatencyHistogram_TakeBinCount(
+    struct LatencyHistogram *latency_histogram,
+    uint32_t                 bin);
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// The number of most recent PWM periods that are kept for estimation
+#define PWM_INPUT_BUFFER_LENGTH 8U
+
+// The fewest recent PWM periods needed to estimate the frequency of the PWM
+// input. With fewer periods, the PWM input is treated as a DC signal (0Hz).
+#define PWM_INPUT_BUFFER_MIN_SAMPLES 3U
+
+struct PwmInputBuffer;
+
+/**
+ * Allocate and initialize a ring buffer of PWM periods captured by a timer in
+ * input capture mode. Each entry records the length of one PWM period and its
+ * high time, as well as when the period ended, so the frequency and the duty
+ * cycle can be estimated from the median over several periods rather than
+ * from the last (possibly glitched) period alone.
+ * @param timer_frequency_hz The frequency of the timer capturing the PWM input
+ * @param max_sample_age_ms The age above which a captured period is discarded
+ * @param consensus_tolerance The fraction of the median period within which a
+ *                            captured period agrees with the median period
+ * @return The created PWM input buffer, whose ownership is given to the caller
+ */
+struct PwmInputBuffer *App_SharedPwmInputBuffer_Create(
+    float    timer_frequency_hz,
+    uint32_t max_sample_age_ms,
+    float    consensus_tolerance);
+
+/**
+ * Deallocate the memory used by the given PWM input buffer
+ * @param pwm_input_buffer The PWM input buffer to deallocate
+ */
+void App_SharedPwmInputBuffer_Destroy(struct PwmInputBuffer *pwm_input_buffer);
+
+/**
+ * Push a captured PWM period into the given PWM input buffer, overwriting the
+ * oldest period once the buffer is full
+ * @note This is safe to call from the input capture interrupt while another
+ *       context estimates the frequency and the duty cycle
+ * @param pwm_input_buffer The PWM input buffer to push the period into
+ * @param period_ticks The length of the PWM period, in timer ticks
+ * @param high_ticks The high time of the PWM period, in timer ticks
+ * @param timestamp_ms The time at which the PWM period was captured, in ms
+ */
+void App_SharedPwmInputBuffer_Push(
+    struct PwmInputBuffer *pwm_input_buffer,
+    uint32_t               period_ticks,
+    uint32_t               high_ticks,
+    uint32_t               timestamp_ms);
+
+/**
+ * Estimate the frequency and the duty cycle of the PWM input from the median of
+ * the recently captured periods
+ * @param pwm_input_buffer The PWM input buffer to estimate from
+ * @param current_time_ms The current time, in ms
+ * @param frequency_hz This will be set to the estimated frequency, in Hz, if
+ *                     the estimate is successful
+ * @param duty_cycle This will be set to the estimated duty cycle, in %, if the
+ *                   estimate is successful
+ * @return true if the frequency and duty cycle could be estimated, false if
+ *         no more than half of the recent periods agree with the median period
+ */
+bool App_SharedPwmInputBuffer_Estimate(
+    const struct PwmInputBuffer *pwm_input_buffer,
+    uint32_t                     current_time_ms,
+    float *                      frequency_hz,
+    float *                      duty_cycle);
@@ -17,6 +17,7 @@ struct State
     void (*run_on_entry)(struct StateMachine *state_machine);
     void (*run_on_tick_1Hz)(struct StateMachine *state_machine);
     void (*run_on_tick_100Hz)(struct StateMachine *state_machine);
+    void (*run_on_tick_1kHz)(struct StateMachine *state_machine);
     void (*run_on_exit)(struct StateMachine *state_machine);
 };
 
@@ -76,3 +77,9 @@ void App_SharedStateMachine_Tick1Hz(struct StateMachine *state_machine);
  * @param state_machine The state machine to tick
  */
 void App_SharedStateMachine_Tick100Hz(struct StateMachine *state_machine);
+
+/**
+ * Tick the 1kHz function of the given state machine
+ * @param state_machine The state machine to tick
+ */
+void App_SharedStateMachine_Tick1kHz(struct StateMachine *state_machine);
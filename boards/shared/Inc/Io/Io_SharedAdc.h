@@ -2,6 +2,18 @@
 
 #include <stm32f3xx.h>
 
+// The voltage of VDDA, which corresponds to the full scale of the ADC
+#define ADC_REFERENCE_VOLTAGE 3.3f
+
+/**
+ * Get the full scale of the given ADC handle, which is the largest raw value
+ * it can measure at its resolution
+ * @param hadc ADC handle
+ * @return The full scale of the given ADC handle (e.g. 4095 at 12-bit
+ *         resolution)
+ */
+uint32_t Io_SharedAdc_GetFullScale(const ADC_HandleTypeDef *hadc);
+
 /**
  * Convert the given raw ADC value measured by the given ADC handle into voltage
  * @param hadc ADC handle
@@ -25,6 +25,27 @@ void Io_SharedCan_Init(
     void (*tx_overflow_callback)(size_t),
     void (*rx_overflow_callback)(size_t));
 
+/**
+ * Set the callbacks that follow every CAN TX message through the CAN TX queue,
+ * e.g. to measure how long messages wait in the queue
+ * @note Messages leave the CAN TX queue in the order they are enqueued. The
+ *       enqueuing and discarded callbacks may be called from an interrupt, so
+ *       they must not block.
+ * @param enqueuing_callback A function that is called with every message
+ *                           right before it is sent to the CAN TX queue, or
+ *                           NULL
+ * @param discarded_callback A function that is called with every message that
+ *                           is discarded because the CAN TX queue is full, or
+ *                           NULL
+ * @param dequeued_callback A function that is called with every message right
+ *                          after it is taken from the CAN TX queue and added
+ *                          to a TX mailbox, or NULL
+ */
+void Io_SharedCan_SetTxMessageCallbacks(
+    void (*enqueuing_callback)(const struct CanMsg *),
+    void (*discarded_callback)(const struct CanMsg *),
+    void (*dequeued_callback)(const struct CanMsg *));
+
 /**
  * Send a message to the back of the CAN TX queue
  * @param message CAN message to send
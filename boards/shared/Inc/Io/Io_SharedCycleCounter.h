@@ -0,0 +1,18 @@
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * Start the cycle counter of the CPU, which wraps around after ~60s at 72MHz.
+ * That is far longer than anything it times, so the unsigned difference of
+ * two cycle counts is always the number of elapsed cycles.
+ * @note This must be called before any cycle count is taken
+ */
+void Io_SharedCycleCounter_Init(void);
+
+/**
+ * Get the cycle count of the CPU
+ * @return The number of CPU cycles elapsed since the cycle counter was last
+ *         wrapped around
+ */
+uint32_t Io_SharedCycleCounter_GetCycleCount(void);
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <stm32f3xx_hal.h>
+
+struct DmaInputCapture;
+
+/**
+ * Allocate and initialize an input capture that transfers the captured values
+ * into a circular buffer using DMA, so the CPU isn't interrupted on every edge
+ * and can process the captured values in batches instead
+ *
+ * @note The DMA channel for the capture compare request of the given timer
+ *       channel must be initialized in circular mode, with word-sized
+ *       transfers, and linked to the given timer handle. Its interrupts are
+ *       disabled, since the captured values are only read at task rate.
+ * @note With one register per capture, the capture compare register of the
+ *       given timer channel is captured. With more registers per capture, a
+ *       DMA burst reads that many capture compare registers, starting from
+ *       CCR1, on every capture of the given timer channel. Because the burst
+ *       uses the single DMA address register of the timer, only one timer
+ *       channel per timer may use burst reads.
+ * @param htim The handle of the timer capturing the input
+ * @param tim_channel The timer channel whose capture triggers a DMA transfer
+ * @param num_registers The number of registers read on every capture
+ * @param num_captures The number of captures that fit in the circular buffer.
+ *                     This must exceed the most captures that can occur
+ *                     between two reads, or older captures are overwritten.
+ * @return Pointer to the allocated and initialized input capture
+ */
+struct DmaInputCapture *Io_SharedDmaInputCapture_Create(
+    TIM_HandleTypeDef *htim,
+    uint32_t           tim_channel,
+    uint32_t           num_registers,
+    uint32_t           num_captures);
+
+/**
+ * Read the captures transferred since the last read of the given input capture
+ * @param dma_input_capture The input capture to read from
+ * @param captures This will be set to the captured register values, oldest
+ *                 capture first. Each capture occupies num_registers
+ *                 consecutive elements.
+ * @param max_captures The most captures that fit in captures
+ * @return The number of captures read
+ */
+uint32_t Io_SharedDmaInputCapture_Read(
+    struct DmaInputCapture *dma_input_capture,
+    uint32_t *              captures,
+    uint32_t                max_captures);
@@ -0,0 +1,239 @@
+#include <assert.h>
+#include <stdlib.h>
+
+#include "App_SharedAdcPipeline.h"
+
+struct AdcChannel
+{
+    struct AdcChannelConfig config;
+
+    // The decimated samples are filtered as sums of oversampling_ratio raw
+    // values, and only scaled to a voltage once filtered
+    float    iir_output;
+    uint32_t median_window[ADC_PIPELINE_MAX_MEDIAN_WINDOW];
+    uint32_t next_median_index;
+    uint32_t num_samples;
+};
+
+struct AdcPipeline
+{
+    uint32_t num_channels;
+    uint32_t oversampling_ratio;
+
+    // The voltage of a sum of oversampling_ratio raw values
+    float volts_per_sum;
+
+    struct AdcChannel channels[ADC_PIPELINE_MAX_CHANNELS];
+
+    // Written by the DMA interrupt. The update count is odd while the outputs
+    // are being written, so a reader can detect that it copied an output while
+    // a block was being processed.
+    volatile struct AdcChannelOutput outputs[ADC_PIPELINE_MAX_CHANNELS];
+    volatile uint32_t                num_updates;
+};
+
+/**
+ * Filter a decimated sample of the given channel
+ * @param channel The channel to filter the decimated sample of
+ * @param sum The decimated sample, as a sum of oversampling_ratio raw values
+ * @return The filtered sample, as a sum of oversampling_ratio raw values
+ */
+static float App_FilterSample(struct AdcChannel *channel, uint32_t sum);
+
+/**
+ * Get the median of the decimated samples in the median window of the given
+ * channel
+ * @param channel The channel to get the median of
+ * @return The median, as a sum of oversampling_ratio raw values
+ */
+static float App_GetMedian(const struct AdcChannel *channel);
+
+static float App_GetMedian(const struct AdcChannel *const channel)
+{
+    uint32_t sorted[ADC_PIPELINE_MAX_MEDIAN_WINDOW];
+
+    // Insertion sort, as the window is at most ADC_PIPELINE_MAX_MEDIAN_WINDOW
+    // samples long
+    for (uint32_t i = 0U; i < channel->num_samples; i++)
+    {
+        const uint32_t value = channel->median_window[i];
+        uint32_t       j     = i;
+
+        while (j > 0U && sorted[j - 1U] > value)
+        {
+            sorted[j] = sorted[j - 1U];
+            j--;
+        }
+
+        sorted[j] = value;
+    }
+
+    const uint32_t middle = channel->num_samples / 2U;
+
+    if (channel->num_samples % 2U == 0U)
+    {
+        return ((float)sorted[middle - 1U] + (float)sorted[middle]) / 2.0f;
+    }
+
+    return (float)sorted[middle];
+}
+
+static float
+    App_FilterSample(struct AdcChannel *const channel, const uint32_t sum)
+{
+    switch (channel->config.filter_type)
+    {
+        case ADC_FILTER_IIR:
+        {
+            if (channel->num_samples == 0U)
+            {
+                // Start from the first sample rather than ramping up from 0V
+                channel->iir_output  = (float)sum;
+                channel->num_samples = 1U;
+            }
+            else
+            {
+                channel->iir_output += channel->config.iir_smoothing_factor *
+                                       ((float)sum - channel->iir_output);
+            }
+
+            return channel->iir_output;
+        }
+        case ADC_FILTER_MEDIAN:
+        {
+            const uint32_t window_size = channel->config.median_window_size;
+
+            // Until the window is full, the samples are at the start of it
+            channel->median_window[channel->next_median_index] = sum;
+            channel->next_median_index =
+                (channel->next_median_index + 1U) % window_size;
+
+            if (channel->num_samples < window_size)
+            {
+                channel->num_samples++;
+            }
+
+            return App_GetMedian(channel);
+        }
+        case ADC_FILTER_NONE:
+        default:
+        {
+            return (float)sum;
+        }
+    }
+}
+
+struct AdcPipeline *App_SharedAdcPipeline_Create(
+    const uint32_t                       num_channels,
+    const uint32_t                       oversampling_ratio,
+    const float                          reference_voltage,
+    const uint32_t                       full_scale,
+    const struct AdcChannelConfig *const channel_configs)
+{
+    assert(num_channels > 0U && num_channels <= ADC_PIPELINE_MAX_CHANNELS);
+    assert(oversampling_ratio > 0U);
+    assert(full_scale > 0U);
+
+    struct AdcPipeline *adc_pipeline = malloc(sizeof(struct AdcPipeline));
+    assert(adc_pipeline != NULL);
+
+    adc_pipeline->num_channels       = num_channels;
+    adc_pipeline->oversampling_ratio = oversampling_ratio;
+    adc_pipeline->volts_per_sum =
+        reference_voltage / ((float)full_scale * (float)oversampling_ratio);
+
+    for (uint32_t i = 0U; i < num_channels; i++)
+    {
+        const struct AdcChannelConfig *const config = &channel_configs[i];
+
+        assert(
+            config->filter_type != ADC_FILTER_IIR ||
+            (config->iir_smoothing_factor > 0.0f &&
+             config->iir_smoothing_factor <= 1.0f));
+        assert(
+            config->filter_type != ADC_FILTER_MEDIAN ||
+            (config->median_window_size % 2U == 1U &&
+             config->median_window_size <= ADC_PIPELINE_MAX_MEDIAN_WINDOW));
+
+        struct AdcChannel *const channel = &adc_pipeline->channels[i];
+
+        channel->config            = *config;
+        channel->iir_output        = 0.0f;
+        channel->next_median_index = 0U;
+        channel->num_samples       = 0U;
+
+        for (uint32_t j = 0U; j < ADC_PIPELINE_MAX_MEDIAN_WINDOW; j++)
+        {
+            channel->median_window[j] = 0U;
+        }
+
+        adc_pipeline->outputs[i].voltage      = 0.0f;
+        adc_pipeline->outputs[i].timestamp_ms = 0U;
+    }
+
+    adc_pipeline->num_updates = 0U;
+
+    return adc_pipeline;
+}
+
+void App_SharedAdcPipeline_Destroy(struct AdcPipeline *adc_pipeline)
+{
+    free(adc_pipeline);
+}
+
+void App_SharedAdcPipeline_ProcessBlock(
+    struct AdcPipeline *const adc_pipeline,
+    const uint16_t *const     raw_adc_values,
+    const uint32_t            timestamp_ms)
+{
+    const uint32_t num_channels                    = adc_pipeline->num_channels;
+    uint32_t       sums[ADC_PIPELINE_MAX_CHANNELS] = { 0U };
+
+    // Decimate the block to one sample per channel
+    for (uint32_t scan = 0U; scan < adc_pipeline->oversampling_ratio; scan++)
+    {
+        for (uint32_t i = 0U; i < num_channels; i++)
+        {
+            sums[i] += raw_adc_values[scan * num_channels + i];
+        }
+    }
+
+    float voltages[ADC_PIPELINE_MAX_CHANNELS];
+
+    for (uint32_t i = 0U; i < num_channels; i++)
+    {
+        voltages[i] = App_FilterSample(&adc_pipeline->channels[i], sums[i]) *
+                      adc_pipeline->volts_per_sum;
+    }
+
+    adc_pipeline->num_updates++;
+
+    for (uint32_t i = 0U; i < num_channels; i++)
+    {
+        adc_pipeline->outputs[i].voltage      = voltages[i];
+        adc_pipeline->outputs[i].timestamp_ms = timestamp_ms;
+    }
+
+    adc_pipeline->num_updates++;
+}
+
+struct AdcChannelOutput App_SharedAdcPipeline_GetOutput(
+    const struct AdcPipeline *const adc_pipeline,
+    const uint32_t                  channel)
+{
+    assert(channel < adc_pipeline->num_channels);
+
+    struct AdcChannelOutput output;
+    uint32_t                num_updates;
+
+    // Copy the output again if a block was processed while copying it
+    do
+    {
+        num_updates         = adc_pipeline->num_updates;
+        output.voltage      = adc_pipeline->outputs[channel].voltage;
+        output.timestamp_ms = adc_pipeline->outputs[channel].timestamp_ms;
+    } while (num_updates % 2U != 0U ||
+             num_updates != adc_pipeline->num_updates);
+
+    return output;
+}
@@ -0,0 +1,118 @@
+#include <assert.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "App_SharedCaptureFrequency.h"
+
+struct CaptureFrequency
+{
+    float    timer_frequency_hz;
+    uint32_t timer_period_ticks;
+    uint32_t timeout_ms;
+
+    float frequency_hz;
+
+    // The last edge captured, which the next batch of edges is measured from
+    bool     has_last_capture;
+    uint32_t last_capture;
+    uint32_t last_capture_time_ms;
+};
+
+struct CaptureFrequency *App_SharedCaptureFrequency_Create(
+    const float    timer_frequency_hz,
+    const uint32_t timer_period_ticks,
+    const uint32_t timeout_ms)
+{
+    assert(timer_frequency_hz > 0.0f);
+    assert(timer_period_ticks > 0U);
+    assert(
+        (float)timeout_ms <
+        1000.0f * (float)timer_period_ticks / timer_frequency_hz);
+
+    struct CaptureFrequency *capture_frequency =
+        malloc(sizeof(struct CaptureFrequency));
+    assert(capture_frequency != NULL);
+
+    capture_frequency->timer_frequency_hz   = timer_frequency_hz;
+    capture_frequency->timer_period_ticks   = timer_period_ticks;
+    capture_frequency->timeout_ms           = timeout_ms;
+    capture_frequency->frequency_hz         = 0.0f;
+    capture_frequency->has_last_capture     = false;
+    capture_frequency->last_capture         = 0U;
+    capture_frequency->last_capture_time_ms = 0U;
+
+    return capture_frequency;
+}
+
+void App_SharedCaptureFrequency_Destroy(
+    struct CaptureFrequency *capture_frequency)
+{
+    free(capture_frequency);
+}
+
+void App_SharedCaptureFrequency_Update(
+    struct CaptureFrequency *const capture_frequency,
+    const uint32_t *const          captures,
+    const uint32_t                 num_captures,
+    const uint32_t                 current_time_ms)
+{
+    // The subtraction is well-defined when the millisecond counter wraps
+    const bool timed_out =
+        current_time_ms - capture_frequency->last_capture_time_ms >
+        capture_frequency->timeout_ms;
+
+    if (timed_out)
+    {
+        // The timer may have wrapped around more than once since the last
+        // edge, so the next edge can't be measured from it
+        capture_frequency->has_last_capture = false;
+    }
+
+    if (num_captures == 0U)
+    {
+        if (timed_out)
+        {
+            // The signal is stuck high or low
+            capture_frequency->frequency_hz = 0.0f;
+        }
+        return;
+    }
+
+    uint32_t first_edge = 0U;
+
+    if (!capture_frequency->has_last_capture)
+    {
+        // The first edge after a timeout only starts the measurement
+        capture_frequency->last_capture = captures[0];
+        first_edge                      = 1U;
+    }
+
+    uint32_t elapsed_ticks = 0U;
+    uint32_t prev_capture  = capture_frequency->last_capture;
+
+    for (uint32_t i = first_edge; i < num_captures; i++)
+    {
+        // The timer counter may have wrapped around between two edges
+        elapsed_ticks += (captures[i] + capture_frequency->timer_period_ticks -
+                          prev_capture) %
+                         capture_frequency->timer_period_ticks;
+        prev_capture = captures[i];
+    }
+
+    if (elapsed_ticks > 0U)
+    {
+        capture_frequency->frequency_hz =
+            (float)(num_captures - first_edge) *
+            capture_frequency->timer_frequency_hz / (float)elapsed_ticks;
+    }
+
+    capture_frequency->has_last_capture     = true;
+    capture_frequency->last_capture         = captures[num_captures - 1U];
+    capture_frequency->last_capture_time_ms = current_time_ms;
+}
+
+float App_SharedCaptureFrequency_GetFrequency(
+    const struct CaptureFrequency *const capture_frequency)
+{
+    return capture_frequency->frequency_hz;
+}
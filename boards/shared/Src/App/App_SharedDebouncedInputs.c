@@ -0,0 +1,118 @@
+#include <assert.h>
+#include <stdlib.h>
+#include "App_SharedDebouncedInputs.h"
+
+struct DebouncedInputs
+{
+    uint32_t (*read_inputs)(void);
+
+    // Bit i of these two words together is the 2-bit counter of how many
+    // samples in a row input i has read a level different from its state. The
+    // counters run down from 3, and are reset to 3 when the input reads its
+    // state again.
+    uint32_t counters_bit0;
+    uint32_t counters_bit1;
+
+    volatile uint32_t states;
+
+    // Bit i toggles on every rising (or falling) edge of input i, so the edges
+    // are written by sampling only and never race with taking them. Two edges
+    // of the same kind can't happen between two takes unless the inputs are
+    // taken less often than every 2 debounce times.
+    volatile uint32_t rising_edge_toggles;
+    volatile uint32_t falling_edge_toggles;
+
+    // The edge toggles when the edges were last taken
+    uint32_t taken_rising_edge_toggles;
+    uint32_t taken_falling_edge_toggles;
+};
+
+struct DebouncedInputs *
+    App_SharedDebouncedInputs_Create(uint32_t (*const read_inputs)(void))
+{
+    assert(read_inputs != NULL);
+
+    struct DebouncedInputs *debounced_inputs =
+        malloc(sizeof(struct DebouncedInputs));
+    assert(debounced_inputs != NULL);
+
+    debounced_inputs->read_inputs                = read_inputs;
+    debounced_inputs->counters_bit0              = UINT32_MAX;
+    debounced_inputs->counters_bit1              = UINT32_MAX;
+    debounced_inputs->states                     = read_inputs();
+    debounced_inputs->rising_edge_toggles        = 0U;
+    debounced_inputs->falling_edge_toggles       = 0U;
+    debounced_inputs->taken_rising_edge_toggles  = 0U;
+    debounced_inputs->taken_falling_edge_toggles = 0U;
+
+    return debounced_inputs;
+}
+
+void App_SharedDebouncedInputs_Destroy(struct DebouncedInputs *debounced_inputs)
+{
+    free(debounced_inputs);
+}
+
+void App_SharedDebouncedInputs_Sample(
+    struct DebouncedInputs *const debounced_inputs)
+{
+    const uint32_t states  = debounced_inputs->states;
+    const uint32_t changes = debounced_inputs->read_inputs() ^ states;
+
+    // Count down the counters of the inputs that read a different level than
+    // their state, and reset the others. The inputs whose counters wrap around
+    // have read the same new level for DEBOUNCED_INPUTS_NUM_SAMPLES samples in
+    // a row.
+    const uint32_t counters_bit0 = ~(debounced_inputs->counters_bit0 & changes);
+    const uint32_t counters_bit1 =
+        counters_bit0 ^ (debounced_inputs->counters_bit1 & changes);
+    const uint32_t toggles = changes & counters_bit0 & counters_bit1;
+
+    debounced_inputs->counters_bit0 = counters_bit0;
+    debounced_inputs->counters_bit1 = counters_bit1;
+
+    if (toggles != 0U)
+    {
+        debounced_inputs->states = states ^ toggles;
+        debounced_inputs->rising_edge_toggles ^= toggles & ~states;
+        debounced_inputs->falling_edge_toggles ^= toggles & states;
+    }
+}
+
+uint32_t App_SharedDebouncedInputs_GetStates(
+    const struct DebouncedInputs *const debounced_inputs)
+{
+    return debounced_inputs->states;
+}
+
+bool App_SharedDebouncedInputs_IsHigh(
+    const struct DebouncedInputs *const debounced_inputs,
+    const uint32_t                      input)
+{
+    assert(input < 32U);
+
+    return (debounced_inputs->states & (1U << input)) != 0U;
+}
+
+uint32_t App_SharedDebouncedInputs_TakeRisingEdges(
+    struct DebouncedInputs *const debounced_inputs)
+{
+    const uint32_t rising_edge_toggles = debounced_inputs->rising_edge_toggles;
+    const uint32_t rising_edges =
+        rising_edge_toggles ^ debounced_inputs->taken_rising_edge_toggles;
+    debounced_inputs->taken_rising_edge_toggles = rising_edge_toggles;
+
+    return rising_edges;
+}
+
+uint32_t App_SharedDebouncedInputs_TakeFallingEdges(
+    struct DebouncedInputs *const debounced_inputs)
+{
+    const uint32_t falling_edge_toggles =
+        debounced_inputs->falling_edge_toggles;
+    const uint32_t falling_edges =
+        falling_edge_toggles ^ debounced_inputs->taken_falling_edge_toggles;
+    debounced_inputs->taken_falling_edge_toggles = falling_edge_toggles;
+
+    return falling_edges;
+}
@@ -6,6 +6,15 @@
 struct ErrorTable
 {
     struct Error *errors[NUM_ERROR_IDS];
+
+    // The number of critical and non-critical errors set for each board, which
+    // are kept up to date as errors are set and cleared
+    uint32_t num_critical_errors_set[NUM_BOARDS];
+    uint32_t num_non_critical_errors_set[NUM_BOARDS];
+
+    // Called whenever an error changes from cleared to set or vice versa
+    void (*error_changed_callback)(const struct Error *error, void *context);
+    void *error_changed_context;
 };
 
 #define INIT_ERROR(id, board, error_type)                     \
@@ -23,6 +32,15 @@ struct ErrorTable *App_SharedErrorTable_Create(void)
         error_table->errors[i] = App_SharedError_Create();
     }
 
+    for (size_t i = 0; i < NUM_BOARDS; i++)
+    {
+        error_table->num_critical_errors_set[i]     = 0;
+        error_table->num_non_critical_errors_set[i] = 0;
+    }
+
+    error_table->error_changed_callback = NULL;
+    error_table->error_changed_context  = NULL;
+
     // clang-format off
     INIT_ERROR(BMS_NON_CRITICAL_STACK_WATERMARK_ABOVE_THRESHOLD_TASK1HZ, BMS, NON_CRITICAL_ERROR);
     INIT_ERROR(BMS_NON_CRITICAL_STACK_WATERMARK_ABOVE_THRESHOLD_TASK1KHZ, BMS, NON_CRITICAL_ERROR);
@@ -60,6 +78,7 @@ struct ErrorTable *App_SharedErrorTable_Create(void)
     INIT_ERROR(DIM_NON_CRITICAL_STACK_WATERMARK_ABOVE_THRESHOLD_TASKCANRX, DIM, NON_CRITICAL_ERROR);
     INIT_ERROR(DIM_NON_CRITICAL_STACK_WATERMARK_ABOVE_THRESHOLD_TASKCANTX, DIM, NON_CRITICAL_ERROR);
     INIT_ERROR(DIM_NON_CRITICAL_WATCHDOG_TIMEOUT, DIM, NON_CRITICAL_ERROR);
+    INIT_ERROR(DIM_NON_CRITICAL_REGEN_PADDLE_OUT_OF_RANGE, DIM, NON_CRITICAL_ERROR);
 
     INIT_ERROR(FSM_NON_CRITICAL_PAPPS_OUT_OF_RANGE, FSM, NON_CRITICAL_ERROR);
     INIT_ERROR(FSM_NON_CRITICAL_SAPPS_OUT_OF_RANGE, FSM, NON_CRITICAL_ERROR);
@@ -142,11 +161,49 @@ ExitCode App_SharedErrorTable_SetError(
         return EXIT_CODE_OUT_OF_RANGE;
     }
     struct Error *error = error_table->errors[error_id];
+
+    if (App_SharedError_GetIsSet(error) == is_set)
+    {
+        return EXIT_CODE_OK;
+    }
+
     App_SharedError_SetIsSet(error, is_set);
 
+    const enum Board board          = App_SharedError_GetBoard(error);
+    uint32_t *       num_errors_set = NULL;
+
+    if (board < NUM_BOARDS && App_SharedError_IsCritical(error))
+    {
+        num_errors_set = &error_table->num_critical_errors_set[board];
+    }
+    else if (board < NUM_BOARDS && App_SharedError_IsNonCritical(error))
+    {
+        num_errors_set = &error_table->num_non_critical_errors_set[board];
+    }
+
+    if (num_errors_set != NULL)
+    {
+        *num_errors_set = is_set ? *num_errors_set + 1 : *num_errors_set - 1;
+    }
+
+    if (error_table->error_changed_callback != NULL)
+    {
+        error_table->error_changed_callback(
+            error, error_table->error_changed_context);
+    }
+
     return EXIT_CODE_OK;
 }
 
+void App_SharedErrorTable_SetErrorChangedCallback(
+    struct ErrorTable *error_table,
+    void (*error_changed_callback)(const struct Error *error, void *context),
+    void *context)
+{
+    error_table->error_changed_callback = error_changed_callback;
+    error_table->error_changed_context  = context;
+}
+
 ExitCode App_SharedErrorTable_IsErrorSet(
     const struct ErrorTable *error_table,
     enum ErrorId             error_id,
@@ -188,6 +245,30 @@ bool App_SharedErrorTable_HasAnyCriticalErrorSet(
     return false;
 }
 
+bool App_SharedErrorTable_HasAnyCriticalErrorSetForBoard(
+    const struct ErrorTable *error_table,
+    enum Board               board)
+{
+    if (board >= NUM_BOARDS)
+    {
+        return false;
+    }
+
+    return error_table->num_critical_errors_set[board] > 0;
+}
+
+bool App_SharedErrorTable_HasAnyNonCriticalErrorSetForBoard(
+    const struct ErrorTable *error_table,
+    enum Board               board)
+{
+    if (board >= NUM_BOARDS)
+    {
+        return false;
+    }
+
+    return error_table->num_non_critical_errors_set[board] > 0;
+}
+
 bool App_SharedErrorTable_HasAnyAirShutdownErrorSet(
     const struct ErrorTable *error_table)
 {
@@ -0,0 +1,75 @@
+#include <assert.h>
+#include <stdlib.h>
+#include "App_SharedLatencyHistogram.h"
+
+struct LatencyHistogram
+{
+    uint32_t bin_width_us;
+    uint32_t num_bins;
+
+    // The number of latencies recorded in every bin, which only increases (and
+    // wraps around) so recording never races with taking a count
+    volatile uint32_t *recorded_counts;
+
+    // The recorded count of every bin when its count was last taken
+    uint32_t *taken_counts;
+};
+
+struct LatencyHistogram *App_SharedLatencyHistogram_Create(
+    const uint32_t bin_width_us,
+    const uint32_t num_bins)
+{
+    assert(bin_width_us > 0U);
+    assert(num_bins > 0U);
+
+    struct LatencyHistogram *latency_histogram =
+        malloc(sizeof(struct LatencyHistogram));
+    assert(latency_histogram != NULL);
+
+    latency_histogram->bin_width_us    = bin_width_us;
+    latency_histogram->num_bins        = num_bins;
+    latency_histogram->recorded_counts = calloc(num_bins, sizeof(uint32_t));
+    latency_histogram->taken_counts    = calloc(num_bins, sizeof(uint32_t));
+    assert(latency_histogram->recorded_counts != NULL);
+    assert(latency_histogram->taken_counts != NULL);
+
+    return latency_histogram;
+}
+
+void App_SharedLatencyHistogram_Destroy(
+    struct LatencyHistogram *latency_histogram)
+{
+    free((uint32_t *)latency_histogram->recorded_counts);
+    free(latency_histogram->taken_counts);
+    free(latency_histogram);
+}
+
+void App_SharedLatencyHistogram_Record(
+    struct LatencyHistogram *const latency_histogram,
+    const uint32_t                 latency_us)
+{
+    uint32_t bin = latency_us / latency_histogram->bin_width_us;
+
+    if (bin >= latency_histogram->num_bins)
+    {
+        bin = latency_histogram->num_bins - 1U;
+    }
+
+    latency_histogram->recorded_counts[bin]++;
+}
+
+uint32_t App_SharedLatencyHistogram_TakeBinCount(
+    struct LatencyHistogram *const latency_histogram,
+    const uint32_t                 bin)
+{
+    assert(bin < latency_histogram->num_bins);
+
+    const uint32_t recorded_count = latency_histogram->recorded_counts[bin];
+
+    // The unsigned difference is correct even if the recorded count wrapped
+    const uint32_t count =
+        recorded_count - latency_histogram->taken_counts[bin];
+    latency_histogram->taken_counts[bin] = recorded_count;
+
+    return count;
+}
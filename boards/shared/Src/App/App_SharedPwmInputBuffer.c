@@ -0,0 +1,201 @@
+#include <assert.h>
+#include <stdlib.h>
+
+#include "App_SharedPwmInputBuffer.h"
+
+struct PwmInputSample
+{
+    uint32_t period_ticks;
+    uint32_t high_ticks;
+    uint32_t timestamp_ms;
+};
+
+struct PwmInputBuffer
+{
+    float    timer_frequency_hz;
+    uint32_t max_sample_age_ms;
+    float    consensus_tolerance;
+
+    // May be written by an input capture interrupt. The push count is
+    // incremented after a sample is written, so a reader can detect that a
+    // sample was pushed while it was copying the buffer.
+    volatile struct PwmInputSample samples[PWM_INPUT_BUFFER_LENGTH];
+    volatile uint32_t              num_pushes;
+};
+
+/**
+ * Sort the given array in ascending order. Insertion sort is used because the
+ * array is at most PWM_INPUT_BUFFER_LENGTH elements long.
+ * @param array The array to sort
+ * @param length The number of elements in the array
+ */
+static void App_SortAscending(float array[], uint32_t length);
+
+/**
+ * Get the median of the given array, sorting the array in the process
+ * @param array The array to get the median of
+ * @param length The number of elements in the array, which must be nonzero
+ * @return The median of the given array
+ */
+static float App_GetMedian(float array[], uint32_t length);
+
+static void App_SortAscending(float array[], const uint32_t length)
+{
+    for (uint32_t i = 1U; i < length; i++)
+    {
+        const float value = array[i];
+        uint32_t    j     = i;
+
+        while (j > 0U && array[j - 1U] > value)
+        {
+            array[j] = array[j - 1U];
+            j--;
+        }
+
+        array[j] = value;
+    }
+}
+
+static float App_GetMedian(float array[], const uint32_t length)
+{
+    assert(length > 0U);
+
+    App_SortAscending(array, length);
+
+    if (length % 2U == 0U)
+    {
+        return (array[length / 2U - 1U] + array[length / 2U]) / 2.0f;
+    }
+
+    return array[length / 2U];
+}
+
+struct PwmInputBuffer *App_SharedPwmInputBuffer_Create(
+    const float    timer_frequency_hz,
+    const uint32_t max_sample_age_ms,
+    const float    consensus_tolerance)
+{
+    assert(timer_frequency_hz > 0.0f);
+    assert(consensus_tolerance >= 0.0f);
+
+    struct PwmInputBuffer *pwm_input_buffer =
+        malloc(sizeof(struct PwmInputBuffer));
+    assert(pwm_input_buffer != NULL);
+
+    pwm_input_buffer->timer_frequency_hz  = timer_frequency_hz;
+    pwm_input_buffer->max_sample_age_ms   = max_sample_age_ms;
+    pwm_input_buffer->consensus_tolerance = consensus_tolerance;
+
+    for (uint32_t i = 0U; i < PWM_INPUT_BUFFER_LENGTH; i++)
+    {
+        pwm_input_buffer->samples[i].period_ticks = 0U;
+        pwm_input_buffer->samples[i].high_ticks   = 0U;
+        pwm_input_buffer->samples[i].timestamp_ms = 0U;
+    }
+    pwm_input_buffer->num_pushes = 0U;
+
+    return pwm_input_buffer;
+}
+
+void App_SharedPwmInputBuffer_Destroy(struct PwmInputBuffer *pwm_input_buffer)
+{
+    free(pwm_input_buffer);
+}
+
+void App_SharedPwmInputBuffer_Push(
+    struct PwmInputBuffer *const pwm_input_buffer,
+    const uint32_t               period_ticks,
+    const uint32_t               high_ticks,
+    const uint32_t               timestamp_ms)
+{
+    const uint32_t index =
+        pwm_input_buffer->num_pushes % PWM_INPUT_BUFFER_LENGTH;
+
+    pwm_input_buffer->samples[index].period_ticks = period_ticks;
+    pwm_input_buffer->samples[index].high_ticks   = high_ticks;
+    pwm_input_buffer->samples[index].timestamp_ms = timestamp_ms;
+
+    pwm_input_buffer->num_pushes++;
+}
+
+bool App_SharedPwmInputBuffer_Estimate(
+    const struct PwmInputBuffer *const pwm_input_buffer,
+    const uint32_t                     current_time_ms,
+    float *const                       frequency_hz,
+    float *const                       duty_cycle)
+{
+    struct PwmInputSample samples[PWM_INPUT_BUFFER_LENGTH];
+    uint32_t              num_pushes;
+
+    // Copy the buffer again if a period was pushed while it was being copied
+    do
+    {
+        num_pushes = pwm_input_buffer->num_pushes;
+
+        for (uint32_t i = 0U; i < PWM_INPUT_BUFFER_LENGTH; i++)
+        {
+            samples[i].period_ticks = pwm_input_buffer->samples[i].period_ticks;
+            samples[i].high_ticks   = pwm_input_buffer->samples[i].high_ticks;
+            samples[i].timestamp_ms = pwm_input_buffer->samples[i].timestamp_ms;
+        }
+    } while (num_pushes != pwm_input_buffer->num_pushes);
+
+    float    periods[PWM_INPUT_BUFFER_LENGTH];
+    uint32_t num_samples = 0U;
+
+    for (uint32_t i = 0U; i < PWM_INPUT_BUFFER_LENGTH && i < num_pushes; i++)
+    {
+        // The subtraction is well-defined when the millisecond counter wraps
+        const uint32_t sample_age_ms =
+            current_time_ms - samples[i].timestamp_ms;
+
+        if (samples[i].period_ticks != 0U &&
+            sample_age_ms <= pwm_input_buffer->max_sample_age_ms)
+        {
+            samples[num_samples]   = samples[i];
+            periods[num_samples++] = (float)samples[i].period_ticks;
+        }
+    }
+
+    // Without enough recent edges, the PWM input is stuck high or low
+    if (num_samples < PWM_INPUT_BUFFER_MIN_SAMPLES)
+    {
+        *frequency_hz = 0.0f;
+        *duty_cycle   = 0.0f;
+        return true;
+    }
+
+    const float median_period_ticks = App_GetMedian(periods, num_samples);
+    const float max_period_error_ticks =
+        pwm_input_buffer->consensus_tolerance * median_period_ticks;
+
+    // Only periods that agree with the median period contribute to the duty
+    // cycle, so a glitched period can't skew it either
+    float    duty_cycles[PWM_INPUT_BUFFER_LENGTH];
+    uint32_t num_agreeing_samples = 0U;
+
+    for (uint32_t i = 0U; i < num_samples; i++)
+    {
+        const float period_ticks = (float)samples[i].period_ticks;
+        const float period_error_ticks =
+            period_ticks > median_period_ticks
+                ? period_ticks - median_period_ticks
+                : median_period_ticks - period_ticks;
+
+        if (period_error_ticks <= max_period_error_ticks)
+        {
+            duty_cycles[num_agreeing_samples++] =
+                (float)samples[i].high_ticks * 100.0f / period_ticks;
+        }
+    }
+
+    if (2U * num_agreeing_samples <= num_samples)
+    {
+        return false;
+    }
+
+    *frequency_hz = pwm_input_buffer->timer_frequency_hz / median_period_ticks;
+    *duty_cycle   = App_GetMedian(duty_cycles, num_agreeing_samples);
+
+    return true;
+}
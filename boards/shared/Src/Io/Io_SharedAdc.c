@@ -1,9 +1,7 @@
 #include "App_SharedConstants.h"
 #include "Io_SharedAdc.h"
 
-float Io_SharedAdc_ConvertRawAdcValueToVoltage(
-    ADC_HandleTypeDef *hadc,
-    uint16_t           raw_adc_value)
+uint32_t Io_SharedAdc_GetFullScale(const ADC_HandleTypeDef *const hadc)
 {
     uint32_t full_scale;
 
@@ -31,6 +29,15 @@ float Io_SharedAdc_ConvertRawAdcValueToVoltage(
         break;
     }
 
+    return full_scale;
+}
+
+float Io_SharedAdc_ConvertRawAdcValueToVoltage(
+    ADC_HandleTypeDef *hadc,
+    uint16_t           raw_adc_value)
+{
+    const uint32_t full_scale = Io_SharedAdc_GetFullScale(hadc);
+
     // Taken from the STM32 manual, the formula to convert the raw ADC
     // measurements to an absolute voltage value is as follows:
     //
@@ -43,5 +50,5 @@ float Io_SharedAdc_ConvertRawAdcValueToVoltage(
     //   with 12-bit resolution, it will be 2^12 -1 = 4095 or with 8-bit
     //   resolution, 2^8 - 1 = 255.
 
-    return (3.3f * raw_adc_value) / (float)full_scale;
+    return (ADC_REFERENCE_VOLTAGE * raw_adc_value) / (float)full_scale;
 }
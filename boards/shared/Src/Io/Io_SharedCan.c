@@ -73,6 +73,23 @@ static void (*_tx_overflow_callback)(size_t) = NULL;
  */
 static void (*_rx_overflow_callback)(size_t) = NULL;
 
+/**
+ * @brief Callback to call with every message right before it is sent to the
+ *        TX queue
+ */
+static void (*_tx_enqueuing_callback)(const struct CanMsg *) = NULL;
+
+/**
+ * @brief Callback to call with every message discarded because the TX queue
+ *        is full
+ */
+static void (*_tx_discarded_callback)(const struct CanMsg *) = NULL;
+
+/**
+ * @brief Callback to call with every message taken from the TX queue
+ */
+static void (*_tx_dequeued_callback)(const struct CanMsg *) = NULL;
+
 static struct StaticSemaphore CanTxBinarySemaphore = {
     .handle  = NULL,
     .storage = { { 0 } },
@@ -246,11 +263,28 @@ void Io_SharedCan_Init(
     sharedcan_hcan = hcan;
 }
 
+void Io_SharedCan_SetTxMessageCallbacks(
+    void (*enqueuing_callback)(const struct CanMsg *),
+    void (*discarded_callback)(const struct CanMsg *),
+    void (*dequeued_callback)(const struct CanMsg *))
+{
+    _tx_enqueuing_callback = enqueuing_callback;
+    _tx_discarded_callback = discarded_callback;
+    _tx_dequeued_callback  = dequeued_callback;
+}
+
 void Io_SharedCan_TxMessageQueueSendtoBack(const struct CanMsg *message)
 {
     // Track how many times the CAN TX FIFO has overflowed
     static uint32_t cantx_overflow_count = { 0 };
 
+    // The CAN TX task may add the message to a TX mailbox as soon as it is
+    // enqueued, so report the message before it is enqueued
+    if (_tx_enqueuing_callback != NULL)
+    {
+        _tx_enqueuing_callback(message);
+    }
+
     if (xPortIsInsideInterrupt())
     {
         if (xQueueSendToBackFromISR(can_tx_msg_fifo.handle, message, NULL) !=
@@ -260,6 +294,11 @@ void Io_SharedCan_TxMessageQueueSendtoBack(const struct CanMsg *message)
             // overflow over CAN.
             cantx_overflow_count++;
             _tx_overflow_callback(cantx_overflow_count);
+
+            if (_tx_discarded_callback != NULL)
+            {
+                _tx_discarded_callback(message);
+            }
         }
         else if (
             uxQueueMessagesWaitingFromISR(CanTxBinarySemaphore.handle) == 0U)
@@ -277,6 +316,11 @@ void Io_SharedCan_TxMessageQueueSendtoBack(const struct CanMsg *message)
             // overflow over CAN.
             cantx_overflow_count++;
             _tx_overflow_callback(cantx_overflow_count);
+
+            if (_tx_discarded_callback != NULL)
+            {
+                _tx_discarded_callback(message);
+            }
         }
         // Without this if-statement, xSemaphore could fail and this would
         // clutter up the Tracealyzer trace.
@@ -309,6 +353,11 @@ void Io_SharedCan_TransmitEnqueuedCanTxMessagesFromTask(void)
         if (xQueueReceive(can_tx_msg_fifo.handle, &message, 0) == pdTRUE)
         {
             (void)Io_TransmitCanMessage(&message);
+
+            if (_tx_dequeued_callback != NULL)
+            {
+                _tx_dequeued_callback(&message);
+            }
         }
     }
 }
@@ -0,0 +1,144 @@
+#include <assert.h>
+#include <stdlib.h>
+#include "Io_SharedDmaInputCapture.h"
+
+struct DmaInputCapture
+{
+    DMA_HandleTypeDef *hdma;
+    uint32_t           num_registers;
+    uint32_t           num_captures;
+
+    // Written by the DMA controller, one capture after another
+    volatile uint32_t *buffer;
+
+    // The index of the oldest capture that hasn't been read
+    uint32_t read_index;
+};
+
+/**
+ * Get the index of the capture the DMA controller transfers next, so every
+ * capture before it (in the circular buffer) is complete
+ * @param dma_input_capture The input capture to get the write index of
+ * @return The index of the capture the DMA controller transfers next
+ */
+static uint32_t
+    Io_GetWriteIndex(const struct DmaInputCapture *dma_input_capture);
+
+static uint32_t
+    Io_GetWriteIndex(const struct DmaInputCapture *const dma_input_capture)
+{
+    const uint32_t buffer_length =
+        dma_input_capture->num_registers * dma_input_capture->num_captures;
+
+    // The DMA counter counts down the transfers left before the buffer wraps
+    // around, and is reloaded with the buffer length once it reaches 0
+    const uint32_t num_transfers =
+        (buffer_length - __HAL_DMA_GET_COUNTER(dma_input_capture->hdma)) %
+        buffer_length;
+
+    // A burst that is partially transferred isn't a complete capture yet
+    return num_transfers / dma_input_capture->num_registers;
+}
+
+struct DmaInputCapture *Io_SharedDmaInputCapture_Create(
+    TIM_HandleTypeDef *const htim,
+    const uint32_t           tim_channel,
+    const uint32_t           num_registers,
+    const uint32_t           num_captures)
+{
+    assert(htim != NULL);
+    assert(num_registers > 0U && num_registers <= 4U);
+    assert(num_captures > 0U);
+
+    uint16_t           dma_id;
+    uint32_t           dma_request;
+    volatile uint32_t *capture_compare_register;
+
+    switch (tim_channel)
+    {
+        case TIM_CHANNEL_1:
+            dma_id                   = TIM_DMA_ID_CC1;
+            dma_request              = TIM_DMA_CC1;
+            capture_compare_register = &htim->Instance->CCR1;
+            break;
+        case TIM_CHANNEL_2:
+            dma_id                   = TIM_DMA_ID_CC2;
+            dma_request              = TIM_DMA_CC2;
+            capture_compare_register = &htim->Instance->CCR2;
+            break;
+        case TIM_CHANNEL_3:
+            dma_id                   = TIM_DMA_ID_CC3;
+            dma_request              = TIM_DMA_CC3;
+            capture_compare_register = &htim->Instance->CCR3;
+            break;
+        case TIM_CHANNEL_4:
+            dma_id                   = TIM_DMA_ID_CC4;
+            dma_request              = TIM_DMA_CC4;
+            capture_compare_register = &htim->Instance->CCR4;
+            break;
+        default:
+            assert(0);
+            return NULL;
+    }
+
+    struct DmaInputCapture *const dma_input_capture =
+        malloc(sizeof(struct DmaInputCapture));
+    assert(dma_input_capture != NULL);
+
+    dma_input_capture->hdma          = htim->hdma[dma_id];
+    dma_input_capture->num_registers = num_registers;
+    dma_input_capture->num_captures  = num_captures;
+    dma_input_capture->buffer =
+        malloc(num_registers * num_captures * sizeof(uint32_t));
+    dma_input_capture->read_index = 0U;
+    assert(dma_input_capture->hdma != NULL);
+    assert(dma_input_capture->buffer != NULL);
+
+    uint32_t source_address = (uint32_t)capture_compare_register;
+
+    if (num_registers > 1U)
+    {
+        // Every DMA request reads the consecutive capture compare registers
+        // starting from CCR1 through the DMA address register
+        htim->Instance->DCR =
+            TIM_DMABASE_CCR1 | ((num_registers - 1U) << TIM_DCR_DBL_Pos);
+        source_address = (uint32_t)&htim->Instance->DMAR;
+    }
+
+    // Start the DMA channel without interrupts, since the captures are only
+    // read at task rate
+    HAL_DMA_Start(
+        dma_input_capture->hdma, source_address,
+        (uint32_t)dma_input_capture->buffer, num_registers * num_captures);
+    __HAL_TIM_ENABLE_DMA(htim, dma_request);
+    HAL_TIM_IC_Start(htim, tim_channel);
+
+    return dma_input_capture;
+}
+
+uint32_t Io_SharedDmaInputCapture_Read(
+    struct DmaInputCapture *const dma_input_capture,
+    uint32_t *const               captures,
+    const uint32_t                max_captures)
+{
+    const uint32_t write_index   = Io_GetWriteIndex(dma_input_capture);
+    const uint32_t num_registers = dma_input_capture->num_registers;
+    uint32_t       num_read      = 0U;
+
+    while (dma_input_capture->read_index != write_index &&
+           num_read < max_captures)
+    {
+        for (uint32_t i = 0U; i < num_registers; i++)
+        {
+            captures[num_read * num_registers + i] =
+                dma_input_capture
+                    ->buffer[dma_input_capture->read_index * num_registers + i];
+        }
+
+        dma_input_capture->read_index = (dma_input_capture->read_index + 1U) %
+                                        dma_input_capture->num_captures;
+        num_read++;
+    }
+
+    return num_read;
+}
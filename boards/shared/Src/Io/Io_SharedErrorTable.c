@@ -120,6 +120,9 @@ static void Io_ProcessDimNonCriticalErrorMsg(
         data->stack_watermark_above_threshold_taskcantx);
     SET_ERROR(
         error_table, DIM_NON_CRITICAL_WATCHDOG_TIMEOUT, data->watchdog_timeout);
+    SET_ERROR(
+        error_table, DIM_NON_CRITICAL_REGEN_PADDLE_OUT_OF_RANGE,
+        data->regen_paddle_out_of_range);
 }
 
 static void Io_ProcessFsmNonCriticalErrorMsg(
@@ -9,10 +9,17 @@ extern "C"
 #include "App_CanMsgs.h"
 }
 
+FAKE_VOID_FUNC(error_changed_callback, const struct Error *, void *);
+
 class SharedErrorTableTest : public testing::Test
 {
   protected:
-    void SetUp() override { error_table = App_SharedErrorTable_Create(); }
+    void SetUp() override
+    {
+        error_table = App_SharedErrorTable_Create();
+
+        RESET_FAKE(error_changed_callback);
+    }
 
     void TearDown() override
     {
@@ -313,6 +320,86 @@ TEST_F(SharedErrorTableTest, clear_error_using_out_of_range_id)
         App_SharedErrorTable_SetError(error_table, NUM_ERROR_IDS, false));
 }
 
+TEST_F(SharedErrorTableTest, error_changed_callback_is_only_called_on_change)
+{
+    int context;
+    App_SharedErrorTable_SetErrorChangedCallback(
+        error_table, error_changed_callback, &context);
+
+    // Clearing an error that is already cleared isn't a change
+    App_SharedErrorTable_SetError(
+        error_table, BMS_NON_CRITICAL_WATCHDOG_TIMEOUT, false);
+    ASSERT_EQ(0, error_changed_callback_fake.call_count);
+
+    App_SharedErrorTable_SetError(
+        error_table, BMS_NON_CRITICAL_WATCHDOG_TIMEOUT, true);
+    ASSERT_EQ(1, error_changed_callback_fake.call_count);
+    ASSERT_EQ(
+        BMS_NON_CRITICAL_WATCHDOG_TIMEOUT,
+        App_SharedError_GetId(error_changed_callback_fake.arg0_val));
+    ASSERT_EQ(&context, error_changed_callback_fake.arg1_val);
+
+    // Setting an error that is already set isn't a change
+    App_SharedErrorTable_SetError(
+        error_table, BMS_NON_CRITICAL_WATCHDOG_TIMEOUT, true);
+    ASSERT_EQ(1, error_changed_callback_fake.call_count);
+
+    App_SharedErrorTable_SetError(
+        error_table, BMS_NON_CRITICAL_WATCHDOG_TIMEOUT, false);
+    ASSERT_EQ(2, error_changed_callback_fake.call_count);
+
+    // The callback can be unregistered
+    App_SharedErrorTable_SetErrorChangedCallback(error_table, NULL, NULL);
+    App_SharedErrorTable_SetError(
+        error_table, BMS_NON_CRITICAL_WATCHDOG_TIMEOUT, true);
+    ASSERT_EQ(2, error_changed_callback_fake.call_count);
+}
+
+TEST_F(SharedErrorTableTest, has_any_error_set_for_board)
+{
+    ASSERT_FALSE(
+        App_SharedErrorTable_HasAnyCriticalErrorSetForBoard(error_table, BMS));
+    ASSERT_FALSE(App_SharedErrorTable_HasAnyNonCriticalErrorSetForBoard(
+        error_table, BMS));
+
+    // Two errors of the same type for the same board are counted separately
+    App_SharedErrorTable_SetError(
+        error_table, BMS_AIR_SHUTDOWN_MAX_CELL_VOLTAGE_OUT_OF_RANGE, true);
+    App_SharedErrorTable_SetError(
+        error_table, BMS_AIR_SHUTDOWN_MIN_CELL_VOLTAGE_OUT_OF_RANGE, true);
+    App_SharedErrorTable_SetError(
+        error_table, BMS_AIR_SHUTDOWN_MIN_CELL_VOLTAGE_OUT_OF_RANGE, true);
+    ASSERT_TRUE(
+        App_SharedErrorTable_HasAnyCriticalErrorSetForBoard(error_table, BMS));
+    ASSERT_FALSE(App_SharedErrorTable_HasAnyNonCriticalErrorSetForBoard(
+        error_table, BMS));
+    ASSERT_FALSE(
+        App_SharedErrorTable_HasAnyCriticalErrorSetForBoard(error_table, DCM));
+
+    App_SharedErrorTable_SetError(
+        error_table, BMS_AIR_SHUTDOWN_MAX_CELL_VOLTAGE_OUT_OF_RANGE, false);
+    ASSERT_TRUE(
+        App_SharedErrorTable_HasAnyCriticalErrorSetForBoard(error_table, BMS));
+
+    App_SharedErrorTable_SetError(
+        error_table, BMS_AIR_SHUTDOWN_MIN_CELL_VOLTAGE_OUT_OF_RANGE, false);
+    ASSERT_FALSE(
+        App_SharedErrorTable_HasAnyCriticalErrorSetForBoard(error_table, BMS));
+
+    App_SharedErrorTable_SetError(
+        error_table, DEFAULT_DCM_NON_CRITICAL_ERROR, true);
+    ASSERT_TRUE(App_SharedErrorTable_HasAnyNonCriticalErrorSetForBoard(
+        error_table, DCM));
+    ASSERT_FALSE(
+        App_SharedErrorTable_HasAnyCriticalErrorSetForBoard(error_table, DCM));
+
+    // Out-of-range boards have no errors
+    ASSERT_FALSE(App_SharedErrorTable_HasAnyCriticalErrorSetForBoard(
+        error_table, NUM_BOARDS));
+    ASSERT_FALSE(App_SharedErrorTable_HasAnyNonCriticalErrorSetForBoard(
+        error_table, NUM_BOARDS));
+}
+
 TEST_F(SharedErrorTableTest, has_any_error_set_using_critical_error)
 {
     // Set a critical error
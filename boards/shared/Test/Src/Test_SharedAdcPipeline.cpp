@@ -0,0 +1,132 @@
+#include "Test_Shared.h"
+
+extern "C"
+{
+#include "App_SharedAdcPipeline.h"
+}
+
+class SharedAdcPipelineTest : public testing::Test
+{
+  protected:
+    static constexpr uint32_t NUM_CHANNELS       = 3U;
+    static constexpr uint32_t OVERSAMPLING_RATIO = 4U;
+    static constexpr uint32_t FULL_SCALE         = 4095U;
+
+    enum
+    {
+        UNFILTERED_CHANNEL,
+        IIR_CHANNEL,
+        MEDIAN_CHANNEL,
+    };
+
+    void SetUp() override
+    {
+        const struct AdcChannelConfig channel_configs[NUM_CHANNELS] = {
+            { ADC_FILTER_NONE, 0.0f, 0U },
+            { ADC_FILTER_IIR, 0.5f, 0U },
+            { ADC_FILTER_MEDIAN, 0.0f, 3U },
+        };
+
+        adc_pipeline = App_SharedAdcPipeline_Create(
+            NUM_CHANNELS, OVERSAMPLING_RATIO, 3.3f, FULL_SCALE,
+            channel_configs);
+    }
+
+    void TearDown() override
+    {
+        TearDownObject(adc_pipeline, App_SharedAdcPipeline_Destroy);
+    }
+
+    // Process a block in which every scan converts the given raw value on
+    // every channel
+    void ProcessBlock(uint16_t raw_adc_value, uint32_t timestamp_ms)
+    {
+        uint16_t raw_adc_values[OVERSAMPLING_RATIO * NUM_CHANNELS];
+
+        for (uint32_t i = 0U; i < OVERSAMPLING_RATIO * NUM_CHANNELS; i++)
+        {
+            raw_adc_values[i] = raw_adc_value;
+        }
+
+        App_SharedAdcPipeline_ProcessBlock(
+            adc_pipeline, raw_adc_values, timestamp_ms);
+    }
+
+    float GetVoltage(uint32_t channel)
+    {
+        return App_SharedAdcPipeline_GetOutput(adc_pipeline, channel).voltage;
+    }
+
+    struct AdcPipeline *adc_pipeline;
+};
+
+TEST_F(SharedAdcPipelineTest, outputs_are_0V_before_the_first_block)
+{
+    for (uint32_t channel = 0U; channel < NUM_CHANNELS; channel++)
+    {
+        const struct AdcChannelOutput output =
+            App_SharedAdcPipeline_GetOutput(adc_pipeline, channel);
+        ASSERT_EQ(0.0f, output.voltage);
+        ASSERT_EQ(0U, output.timestamp_ms);
+    }
+}
+
+TEST_F(SharedAdcPipelineTest, scans_are_decimated_per_channel_and_timestamped)
+{
+    // Each channel converts a different value in every scan, which average to
+    // a quarter, half and full scale
+    const uint16_t raw_adc_values[OVERSAMPLING_RATIO * NUM_CHANNELS] = {
+        0,    2047, 4095, //
+        2047, 2047, 4095, //
+        0,    1024, 4095, //
+        2047, 3071, 4095, //
+    };
+    App_SharedAdcPipeline_ProcessBlock(adc_pipeline, raw_adc_values, 42U);
+
+    ASSERT_NEAR(3.3f / 4.0f, GetVoltage(UNFILTERED_CHANNEL), 0.001f);
+    ASSERT_NEAR(3.3f / 2.0f, GetVoltage(IIR_CHANNEL), 0.001f);
+    ASSERT_NEAR(3.3f, GetVoltage(MEDIAN_CHANNEL), 0.001f);
+
+    for (uint32_t channel = 0U; channel < NUM_CHANNELS; channel++)
+    {
+        ASSERT_EQ(
+            42U, App_SharedAdcPipeline_GetOutput(adc_pipeline, channel)
+                     .timestamp_ms);
+    }
+}
+
+TEST_F(SharedAdcPipelineTest, iir_filter_smooths_steps)
+{
+    // The first sample is published as is
+    ProcessBlock(0U, 1U);
+    ASSERT_EQ(0.0f, GetVoltage(IIR_CHANNEL));
+
+    // Each sample closes half of the gap to the step
+    float expected_voltage = 0.0f;
+    for (uint32_t i = 0U; i < 10U; i++)
+    {
+        ProcessBlock(FULL_SCALE, 2U + i);
+        expected_voltage += 0.5f * (3.3f - expected_voltage);
+        ASSERT_NEAR(expected_voltage, GetVoltage(IIR_CHANNEL), 0.0001f);
+        ASSERT_EQ(3.3f, GetVoltage(UNFILTERED_CHANNEL));
+    }
+}
+
+TEST_F(SharedAdcPipelineTest, median_filter_rejects_spikes_but_follows_steps)
+{
+    ProcessBlock(1000U, 1U);
+    ProcessBlock(1000U, 2U);
+
+    // A single spike is rejected
+    ProcessBlock(FULL_SCALE, 3U);
+    ASSERT_NEAR(3.3f * 1000U / FULL_SCALE, GetVoltage(MEDIAN_CHANNEL), 0.001f);
+    ProcessBlock(1000U, 4U);
+    ASSERT_NEAR(3.3f * 1000U / FULL_SCALE, GetVoltage(MEDIAN_CHANNEL), 0.001f);
+    ProcessBlock(1000U, 5U);
+
+    // A step is followed once it is the majority of the window
+    ProcessBlock(3000U, 6U);
+    ASSERT_NEAR(3.3f * 1000U / FULL_SCALE, GetVoltage(MEDIAN_CHANNEL), 0.001f);
+    ProcessBlock(3000U, 7U);
+    ASSERT_NEAR(3.3f * 3000U / FULL_SCALE, GetVoltage(MEDIAN_CHANNEL), 0.001f);
+}
@@ -0,0 +1,135 @@
+#include "Test_Shared.h"
+
+extern "C"
+{
+#include "App_SharedCaptureFrequency.h"
+}
+
+class SharedCaptureFrequencyTest : public testing::Test
+{
+  protected:
+    static constexpr float    TIMER_FREQUENCY_HZ = 65536.0f;
+    static constexpr uint32_t TIMER_PERIOD_TICKS = 65536U;
+    static constexpr uint32_t TIMEOUT_MS         = 500U;
+    static constexpr uint32_t UPDATE_PERIOD_MS   = 10U;
+    static constexpr uint32_t MAX_CAPTURES       = 64U;
+
+    void SetUp() override
+    {
+        capture_frequency = App_SharedCaptureFrequency_Create(
+            TIMER_FREQUENCY_HZ, TIMER_PERIOD_TICKS, TIMEOUT_MS);
+        current_time_ms = 0U;
+        timer_ticks     = 0.0;
+        next_edge_ticks = 0.0;
+    }
+
+    void TearDown() override
+    {
+        TearDownObject(capture_frequency, App_SharedCaptureFrequency_Destroy);
+    }
+
+    // Capture the rising edges of a signal with the given frequency for the
+    // given duration, updating the frequency measurement at the update rate
+    void CaptureSignal(float frequency_hz, uint32_t duration_ms)
+    {
+        for (uint32_t i = 0U; i < duration_ms / UPDATE_PERIOD_MS; i++)
+        {
+            uint32_t captures[MAX_CAPTURES];
+            uint32_t num_captures = 0U;
+
+            timer_ticks += TIMER_FREQUENCY_HZ * UPDATE_PERIOD_MS / 1000.0;
+
+            if (frequency_hz == 0.0f)
+            {
+                next_edge_ticks = timer_ticks;
+            }
+
+            while (next_edge_ticks < timer_ticks)
+            {
+                ASSERT_TRUE(num_captures < MAX_CAPTURES);
+                captures[num_captures++] =
+                    (uint32_t)next_edge_ticks % TIMER_PERIOD_TICKS;
+                next_edge_ticks += TIMER_FREQUENCY_HZ / frequency_hz;
+            }
+
+            current_time_ms += UPDATE_PERIOD_MS;
+            App_SharedCaptureFrequency_Update(
+                capture_frequency, captures, num_captures, current_time_ms);
+        }
+    }
+
+    // With a single edge per update, the frequency is only as accurate as the
+    // one tick resolution of the period between two edges
+    static float OneTickErrorHz(float frequency_hz)
+    {
+        return 1.01f * frequency_hz * frequency_hz / TIMER_FREQUENCY_HZ;
+    }
+
+    float GetFrequency(void)
+    {
+        return App_SharedCaptureFrequency_GetFrequency(capture_frequency);
+    }
+
+    struct CaptureFrequency *capture_frequency;
+    uint32_t                 current_time_ms;
+    double                   timer_ticks;
+    double                   next_edge_ticks;
+};
+
+TEST_F(SharedCaptureFrequencyTest, no_edges_is_0hz)
+{
+    ASSERT_EQ(0.0f, GetFrequency());
+
+    CaptureSignal(0.0f, 1000U);
+    ASSERT_EQ(0.0f, GetFrequency());
+}
+
+TEST_F(SharedCaptureFrequencyTest, frequency_is_averaged_over_every_edge)
+{
+    // Many edges per update, whose periods aren't a whole number of ticks
+    for (const float frequency_hz : { 333.3f, 1000.0f, 2750.0f })
+    {
+        CaptureSignal(frequency_hz, 100U);
+        ASSERT_NEAR(frequency_hz, GetFrequency(), frequency_hz * 0.001f);
+    }
+}
+
+TEST_F(SharedCaptureFrequencyTest, frequency_below_update_rate)
+{
+    // Most updates don't have any edge, and those keep the last frequency
+    CaptureSignal(20.0f, 1000U);
+    ASSERT_NEAR(20.0f, GetFrequency(), OneTickErrorHz(20.0f));
+}
+
+TEST_F(SharedCaptureFrequencyTest, timer_counter_wraps_around)
+{
+    // The timer wraps around every second, and every update period spans the
+    // wrap around at some point
+    CaptureSignal(123.0f, 5000U);
+    ASSERT_NEAR(123.0f, GetFrequency(), OneTickErrorHz(123.0f));
+}
+
+TEST_F(SharedCaptureFrequencyTest, signal_stops_after_timeout)
+{
+    CaptureSignal(100.0f, 100U);
+    ASSERT_NEAR(100.0f, GetFrequency(), OneTickErrorHz(100.0f));
+
+    // The last frequency is held until no edge is captured for the timeout
+    CaptureSignal(0.0f, TIMEOUT_MS);
+    ASSERT_NEAR(100.0f, GetFrequency(), OneTickErrorHz(100.0f));
+    CaptureSignal(0.0f, UPDATE_PERIOD_MS);
+    ASSERT_EQ(0.0f, GetFrequency());
+}
+
+TEST_F(SharedCaptureFrequencyTest, signal_restarts_after_timeout)
+{
+    CaptureSignal(100.0f, 100U);
+
+    // Stop for longer than a timer period, so measuring from the last edge
+    // before the timeout would give the wrong frequency
+    CaptureSignal(0.0f, 1500U);
+    ASSERT_EQ(0.0f, GetFrequency());
+
+    CaptureSignal(50.0f, 100U);
+    ASSERT_NEAR(50.0f, GetFrequency(), OneTickErrorHz(50.0f));
+}
@@ -0,0 +1,124 @@
+#include "Test_Shared.h"
+
+extern "C"
+{
+#include "App_SharedDebouncedInputs.h"
+}
+
+FAKE_VALUE_FUNC(uint32_t, read_inputs);
+
+// The raw level of every input when the debounced inputs are created
+static constexpr uint32_t INITIAL_INPUTS = 0x0000000FU;
+
+class SharedDebouncedInputsTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        RESET_FAKE(read_inputs);
+        read_inputs_fake.return_val = INITIAL_INPUTS;
+        debounced_inputs = App_SharedDebouncedInputs_Create(read_inputs);
+    }
+
+    void TearDown() override
+    {
+        TearDownObject(debounced_inputs, App_SharedDebouncedInputs_Destroy);
+    }
+
+    void SampleInputs(uint32_t inputs, uint32_t num_samples)
+    {
+        read_inputs_fake.return_val = inputs;
+
+        for (uint32_t i = 0; i < num_samples; i++)
+        {
+            App_SharedDebouncedInputs_Sample(debounced_inputs);
+        }
+    }
+
+    struct DebouncedInputs *debounced_inputs;
+};
+
+TEST_F(SharedDebouncedInputsTest, inputs_start_in_their_current_state)
+{
+    ASSERT_EQ(
+        INITIAL_INPUTS, App_SharedDebouncedInputs_GetStates(debounced_inputs));
+    ASSERT_TRUE(App_SharedDebouncedInputs_IsHigh(debounced_inputs, 0));
+    ASSERT_FALSE(App_SharedDebouncedInputs_IsHigh(debounced_inputs, 4));
+    ASSERT_EQ(0U, App_SharedDebouncedInputs_TakeRisingEdges(debounced_inputs));
+    ASSERT_EQ(0U, App_SharedDebouncedInputs_TakeFallingEdges(debounced_inputs));
+}
+
+TEST_F(SharedDebouncedInputsTest, input_changes_after_num_samples_in_a_row)
+{
+    // Bit 4 goes high and bit 0 goes low at the same time
+    const uint32_t inputs = 0x0000001EU;
+
+    SampleInputs(inputs, DEBOUNCED_INPUTS_NUM_SAMPLES - 1);
+    ASSERT_EQ(
+        INITIAL_INPUTS, App_SharedDebouncedInputs_GetStates(debounced_inputs));
+
+    SampleInputs(inputs, 1);
+    ASSERT_EQ(inputs, App_SharedDebouncedInputs_GetStates(debounced_inputs));
+    ASSERT_EQ(
+        1U << 4, App_SharedDebouncedInputs_TakeRisingEdges(debounced_inputs));
+    ASSERT_EQ(
+        1U << 0, App_SharedDebouncedInputs_TakeFallingEdges(debounced_inputs));
+
+    // Taking the edges clears them
+    SampleInputs(inputs, 10 * DEBOUNCED_INPUTS_NUM_SAMPLES);
+    ASSERT_EQ(0U, App_SharedDebouncedInputs_TakeRisingEdges(debounced_inputs));
+    ASSERT_EQ(0U, App_SharedDebouncedInputs_TakeFallingEdges(debounced_inputs));
+}
+
+TEST_F(SharedDebouncedInputsTest, bounce_does_not_change_input)
+{
+    const uint32_t bounced_inputs = INITIAL_INPUTS | (1U << 31);
+
+    // However long an input bounces for, it doesn't change state unless it
+    // reads the same new level for enough samples in a row
+    for (uint32_t i = 0; i < 100; i++)
+    {
+        SampleInputs(bounced_inputs, DEBOUNCED_INPUTS_NUM_SAMPLES - 1);
+        SampleInputs(INITIAL_INPUTS, 1);
+    }
+
+    ASSERT_EQ(
+        INITIAL_INPUTS, App_SharedDebouncedInputs_GetStates(debounced_inputs));
+    ASSERT_EQ(0U, App_SharedDebouncedInputs_TakeRisingEdges(debounced_inputs));
+
+    // Once it settles, it changes state once
+    SampleInputs(bounced_inputs, DEBOUNCED_INPUTS_NUM_SAMPLES);
+    ASSERT_EQ(
+        bounced_inputs, App_SharedDebouncedInputs_GetStates(debounced_inputs));
+    ASSERT_EQ(
+        1U << 31, App_SharedDebouncedInputs_TakeRisingEdges(debounced_inputs));
+}
+
+TEST_F(SharedDebouncedInputsTest, inputs_are_debounced_independently)
+{
+    // Bit 8 starts changing 2 samples before bit 9
+    SampleInputs(INITIAL_INPUTS | (1U << 8), 2);
+    SampleInputs(INITIAL_INPUTS | (1U << 8) | (1U << 9), 2);
+    ASSERT_TRUE(App_SharedDebouncedInputs_IsHigh(debounced_inputs, 8));
+    ASSERT_FALSE(App_SharedDebouncedInputs_IsHigh(debounced_inputs, 9));
+
+    SampleInputs(INITIAL_INPUTS | (1U << 8) | (1U << 9), 2);
+    ASSERT_TRUE(App_SharedDebouncedInputs_IsHigh(debounced_inputs, 9));
+    ASSERT_EQ(
+        (1U << 8) | (1U << 9),
+        App_SharedDebouncedInputs_TakeRisingEdges(debounced_inputs));
+}
+
+TEST_F(SharedDebouncedInputsTest, rising_and_falling_edges_between_takes)
+{
+    // A press and release between two takes is seen as both edges
+    SampleInputs(INITIAL_INPUTS | (1U << 5), DEBOUNCED_INPUTS_NUM_SAMPLES);
+    SampleInputs(INITIAL_INPUTS, DEBOUNCED_INPUTS_NUM_SAMPLES);
+
+    ASSERT_EQ(
+        INITIAL_INPUTS, App_SharedDebouncedInputs_GetStates(debounced_inputs));
+    ASSERT_EQ(
+        1U << 5, App_SharedDebouncedInputs_TakeRisingEdges(debounced_inputs));
+    ASSERT_EQ(
+        1U << 5, App_SharedDebouncedInputs_TakeFallingEdges(debounced_inputs));
+}
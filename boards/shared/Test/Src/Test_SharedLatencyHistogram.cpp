@@ -0,0 +1,91 @@
+#include "Test_Shared.h"
+
+extern "C"
+{
+#include "App_SharedLatencyHistogram.h"
+}
+
+class SharedLatencyHistogramTest : public testing::Test
+{
+  protected:
+    static constexpr uint32_t BIN_WIDTH_US = 250U;
+    static constexpr uint32_t NUM_BINS     = 8U;
+
+    void SetUp() override
+    {
+        latency_histogram =
+            App_SharedLatencyHistogram_Create(BIN_WIDTH_US, NUM_BINS);
+    }
+
+    void TearDown() override
+    {
+        TearDownObject(latency_histogram, App_SharedLatencyHistogram_Destroy);
+    }
+
+    struct LatencyHistogram *latency_histogram;
+};
+
+TEST_F(SharedLatencyHistogramTest, empty_histogram_has_no_counts)
+{
+    for (uint32_t bin = 0U; bin < NUM_BINS; bin++)
+    {
+        ASSERT_EQ(
+            0U,
+            App_SharedLatencyHistogram_TakeBinCount(latency_histogram, bin));
+    }
+}
+
+TEST_F(SharedLatencyHistogramTest, latencies_are_counted_in_their_bins)
+{
+    // The lower edge of a bin is inclusive and the upper edge is exclusive
+    App_SharedLatencyHistogram_Record(latency_histogram, 0U);
+    App_SharedLatencyHistogram_Record(latency_histogram, BIN_WIDTH_US - 1U);
+    App_SharedLatencyHistogram_Record(latency_histogram, BIN_WIDTH_US);
+    App_SharedLatencyHistogram_Record(latency_histogram, 3U * BIN_WIDTH_US);
+    App_SharedLatencyHistogram_Record(
+        latency_histogram, 3U * BIN_WIDTH_US + BIN_WIDTH_US / 2U);
+
+    ASSERT_EQ(
+        2U, App_SharedLatencyHistogram_TakeBinCount(latency_histogram, 0U));
+    ASSERT_EQ(
+        1U, App_SharedLatencyHistogram_TakeBinCount(latency_histogram, 1U));
+    ASSERT_EQ(
+        0U, App_SharedLatencyHistogram_TakeBinCount(latency_histogram, 2U));
+    ASSERT_EQ(
+        2U, App_SharedLatencyHistogram_TakeBinCount(latency_histogram, 3U));
+}
+
+TEST_F(SharedLatencyHistogramTest, last_bin_counts_latencies_beyond_it)
+{
+    App_SharedLatencyHistogram_Record(
+        latency_histogram, (NUM_BINS - 1U) * BIN_WIDTH_US);
+    App_SharedLatencyHistogram_Record(
+        latency_histogram, NUM_BINS * BIN_WIDTH_US);
+    App_SharedLatencyHistogram_Record(latency_histogram, UINT32_MAX);
+
+    ASSERT_EQ(
+        3U, App_SharedLatencyHistogram_TakeBinCount(
+                latency_histogram, NUM_BINS - 1U));
+}
+
+TEST_F(SharedLatencyHistogramTest, taking_a_bin_count_restarts_it)
+{
+    for (uint32_t i = 0U; i < 5U; i++)
+    {
+        App_SharedLatencyHistogram_Record(latency_histogram, BIN_WIDTH_US);
+    }
+    App_SharedLatencyHistogram_Record(latency_histogram, 0U);
+
+    ASSERT_EQ(
+        5U, App_SharedLatencyHistogram_TakeBinCount(latency_histogram, 1U));
+    ASSERT_EQ(
+        0U, App_SharedLatencyHistogram_TakeBinCount(latency_histogram, 1U));
+
+    App_SharedLatencyHistogram_Record(latency_histogram, BIN_WIDTH_US);
+    ASSERT_EQ(
+        1U, App_SharedLatencyHistogram_TakeBinCount(latency_histogram, 1U));
+
+    // Other bins are unaffected by taking the count of a bin
+    ASSERT_EQ(
+        1U, App_SharedLatencyHistogram_TakeBinCount(latency_histogram, 0U));
+}
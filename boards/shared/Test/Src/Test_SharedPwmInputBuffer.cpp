@@ -0,0 +1,164 @@
+#include "Test_Shared.h"
+
+extern "C"
+{
+#include "App_SharedPwmInputBuffer.h"
+}
+
+class SharedPwmInputBufferTest : public testing::Test
+{
+  protected:
+    static constexpr float    TIMER_FREQUENCY_HZ  = 10000.0f;
+    static constexpr uint32_t MAX_SAMPLE_AGE_MS   = 1000U;
+    static constexpr float    CONSENSUS_TOLERANCE = 0.1f;
+
+    void SetUp() override
+    {
+        pwm_input_buffer = App_SharedPwmInputBuffer_Create(
+            TIMER_FREQUENCY_HZ, MAX_SAMPLE_AGE_MS, CONSENSUS_TOLERANCE);
+        current_time_ms = 0U;
+    }
+
+    void TearDown() override
+    {
+        TearDownObject(pwm_input_buffer, App_SharedPwmInputBuffer_Destroy);
+    }
+
+    // Push a period of a PWM signal with the given frequency and duty cycle
+    void PushPeriod(float frequency_hz, float duty_cycle)
+    {
+        const uint32_t period_ticks =
+            (uint32_t)(TIMER_FREQUENCY_HZ / frequency_hz);
+        const uint32_t high_ticks =
+            (uint32_t)((float)period_ticks * duty_cycle / 100.0f);
+
+        current_time_ms += (uint32_t)(1000.0f / frequency_hz);
+        App_SharedPwmInputBuffer_Push(
+            pwm_input_buffer, period_ticks, high_ticks, current_time_ms);
+    }
+
+    bool Estimate(void)
+    {
+        return App_SharedPwmInputBuffer_Estimate(
+            pwm_input_buffer, current_time_ms, &frequency_hz, &duty_cycle);
+    }
+
+    struct PwmInputBuffer *pwm_input_buffer;
+    uint32_t               current_time_ms;
+    float                  frequency_hz;
+    float                  duty_cycle;
+};
+
+TEST_F(SharedPwmInputBufferTest, dc_signal_is_estimated_as_0hz)
+{
+    // No periods captured
+    ASSERT_TRUE(Estimate());
+    ASSERT_EQ(0.0f, frequency_hz);
+    ASSERT_EQ(0.0f, duty_cycle);
+
+    // Too few periods captured to estimate the frequency
+    for (uint32_t i = 0U; i < PWM_INPUT_BUFFER_MIN_SAMPLES - 1U; i++)
+    {
+        PushPeriod(10.0f, 50.0f);
+    }
+    ASSERT_TRUE(Estimate());
+    ASSERT_EQ(0.0f, frequency_hz);
+}
+
+TEST_F(SharedPwmInputBufferTest, estimate_frequency_and_duty_cycle)
+{
+    for (uint32_t i = 0U; i < PWM_INPUT_BUFFER_LENGTH; i++)
+    {
+        PushPeriod(20.0f, 25.0f);
+    }
+
+    ASSERT_TRUE(Estimate());
+    ASSERT_FLOAT_EQ(20.0f, frequency_hz);
+    ASSERT_FLOAT_EQ(25.0f, duty_cycle);
+}
+
+TEST_F(SharedPwmInputBufferTest, glitched_periods_are_rejected)
+{
+    for (uint32_t i = 0U; i < PWM_INPUT_BUFFER_LENGTH; i++)
+    {
+        // A noise spike splits every fourth period into a short period
+        if (i % 4U == 3U)
+        {
+            PushPeriod(400.0f, 90.0f);
+        }
+        else
+        {
+            PushPeriod(10.0f, 50.0f);
+        }
+
+        if (i + 1U >= PWM_INPUT_BUFFER_MIN_SAMPLES)
+        {
+            ASSERT_TRUE(Estimate());
+            ASSERT_FLOAT_EQ(10.0f, frequency_hz);
+            ASSERT_FLOAT_EQ(50.0f, duty_cycle);
+        }
+    }
+}
+
+TEST_F(SharedPwmInputBufferTest, no_estimate_without_consensus)
+{
+    // Alternating periods that don't agree with each other
+    for (uint32_t i = 0U; i < PWM_INPUT_BUFFER_LENGTH; i++)
+    {
+        PushPeriod(i % 2U == 0U ? 10.0f : 30.0f, 50.0f);
+    }
+
+    frequency_hz = -1.0f;
+    duty_cycle   = -1.0f;
+    ASSERT_FALSE(Estimate());
+    ASSERT_EQ(-1.0f, frequency_hz);
+    ASSERT_EQ(-1.0f, duty_cycle);
+}
+
+TEST_F(SharedPwmInputBufferTest, only_most_recent_periods_are_used)
+{
+    for (uint32_t i = 0U; i < PWM_INPUT_BUFFER_LENGTH; i++)
+    {
+        PushPeriod(10.0f, 50.0f);
+    }
+
+    // The buffer wraps around, so the older periods are overwritten
+    for (uint32_t i = 0U; i < PWM_INPUT_BUFFER_LENGTH / 2U + 1U; i++)
+    {
+        PushPeriod(40.0f, 50.0f);
+    }
+    ASSERT_TRUE(Estimate());
+    ASSERT_FLOAT_EQ(40.0f, frequency_hz);
+}
+
+TEST_F(SharedPwmInputBufferTest, stale_periods_expire)
+{
+    for (uint32_t i = 0U; i < PWM_INPUT_BUFFER_LENGTH; i++)
+    {
+        PushPeriod(10.0f, 50.0f);
+    }
+
+    // The PWM input stops toggling, until just enough periods are recent
+    // enough to estimate the frequency
+    current_time_ms +=
+        MAX_SAMPLE_AGE_MS - (PWM_INPUT_BUFFER_MIN_SAMPLES - 1U) * 1000U / 10U;
+    ASSERT_TRUE(Estimate());
+    ASSERT_FLOAT_EQ(10.0f, frequency_hz);
+
+    current_time_ms += 1000U / 10U;
+    ASSERT_TRUE(Estimate());
+    ASSERT_EQ(0.0f, frequency_hz);
+}
+
+TEST_F(SharedPwmInputBufferTest, millisecond_counter_wraps_around)
+{
+    current_time_ms = UINT32_MAX - 100U;
+    for (uint32_t i = 0U; i < PWM_INPUT_BUFFER_LENGTH; i++)
+    {
+        PushPeriod(50.0f, 50.0f);
+    }
+
+    ASSERT_LT(current_time_ms, 1000U);
+    ASSERT_TRUE(Estimate());
+    ASSERT_FLOAT_EQ(50.0f, frequency_hz);
+}
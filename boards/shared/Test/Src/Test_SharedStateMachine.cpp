@@ -10,10 +10,11 @@ extern "C"
 }
 
 FAKE_VOID_FUNC(state_A_entry, struct StateMachine *);
-FAKE_VOID_FUNC(state_A_tick_1kHz, struct StateMachine *);
+FAKE_VOID_FUNC(state_A_tick_100Hz, struct StateMachine *);
 FAKE_VOID_FUNC(state_A_exit, struct StateMachine *);
 FAKE_VOID_FUNC(state_B_entry, struct StateMachine *);
 FAKE_VOID_FUNC(state_B_tick_1Hz, struct StateMachine *);
+FAKE_VOID_FUNC(state_B_tick_100Hz, struct StateMachine *);
 FAKE_VOID_FUNC(state_B_tick_1kHz, struct StateMachine *);
 FAKE_VOID_FUNC(state_B_exit, struct StateMachine *);
 FAKE_VOID_FUNC(state_C_entry, struct StateMachine *);
@@ -32,26 +33,30 @@ class SharedStateMachineTest : public testing::Test
 
         state_A.run_on_entry      = state_A_entry;
         state_A.run_on_tick_1Hz   = state_A_tick_1Hz;
-        state_A.run_on_tick_100Hz = state_A_tick_1kHz;
+        state_A.run_on_tick_100Hz = state_A_tick_100Hz;
+        state_A.run_on_tick_1kHz  = NULL;
         state_A.run_on_exit       = state_A_exit;
 
         state_B.run_on_entry      = state_B_entry;
         state_B.run_on_tick_1Hz   = state_B_tick_1Hz;
-        state_B.run_on_tick_100Hz = state_B_tick_1kHz;
+        state_B.run_on_tick_100Hz = state_B_tick_100Hz;
+        state_B.run_on_tick_1kHz  = state_B_tick_1kHz;
         state_B.run_on_exit       = state_B_exit;
 
         state_C.run_on_entry      = state_C_entry;
         state_C.run_on_tick_1Hz   = NULL;
         state_C.run_on_tick_100Hz = NULL;
+        state_C.run_on_tick_1kHz  = NULL;
         state_C.run_on_exit       = state_C_exit;
 
         state_machine = App_SharedStateMachine_Create(world, &state_A);
 
         RESET_FAKE(state_A_entry);
-        RESET_FAKE(state_A_tick_1kHz);
+        RESET_FAKE(state_A_tick_100Hz);
         RESET_FAKE(state_A_exit);
         RESET_FAKE(state_B_entry);
         RESET_FAKE(state_B_tick_1Hz);
+        RESET_FAKE(state_B_tick_100Hz);
         RESET_FAKE(state_B_tick_1kHz);
         RESET_FAKE(state_B_exit);
     }
@@ -95,7 +100,36 @@ TEST_F(
 
     App_SharedStateMachine_Tick100Hz(state_machine);
 
+    EXPECT_EQ(state_B_tick_100Hz_fake.call_count, 1);
+}
+
+TEST_F(
+    SharedStateMachineTest,
+    check_that_switching_states_in_tick_switches_states_for_1kHz_tick)
+{
+    SetInitialState(&state_A);
+
+    App_SharedStateMachine_Tick1Hz(state_machine);
+
+    App_SharedStateMachine_Tick1kHz(state_machine);
+
     EXPECT_EQ(state_B_tick_1kHz_fake.call_count, 1);
+    EXPECT_EQ(state_B_tick_100Hz_fake.call_count, 0);
+}
+
+TEST_F(SharedStateMachineTest, check_that_1kHz_tick_only_runs_1kHz_function)
+{
+    SetInitialState(&state_B);
+
+    for (size_t i = 0; i < 10; i++)
+    {
+        App_SharedStateMachine_Tick1kHz(state_machine);
+    }
+
+    EXPECT_EQ(state_B_tick_1kHz_fake.call_count, 10);
+    EXPECT_EQ(state_B_tick_1Hz_fake.call_count, 0);
+    EXPECT_EQ(state_B_tick_100Hz_fake.call_count, 0);
+    EXPECT_EQ(state_B_exit_fake.call_count, 0);
 }
 
 TEST_F(SharedStateMachineTest, check_that_null_tick_functions_dont_deadlock)
@@ -110,4 +144,6 @@ TEST_F(SharedStateMachineTest, check_that_null_tick_functions_dont_deadlock)
     SetInitialState(&state_C);
     App_SharedStateMachine_Tick1Hz(state_machine);
     App_SharedStateMachine_Tick1Hz(state_machine);
+    App_SharedStateMachine_Tick1kHz(state_machine);
+    App_SharedStateMachine_Tick1kHz(state_machine);
 }
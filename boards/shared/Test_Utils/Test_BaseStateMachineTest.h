@@ -52,6 +52,10 @@ class BaseStateMachineTest : public testing::Test
     {
         for (uint32_t ms = 0; ms < time_ms; ms++)
         {
+            // The 1kHz task has the highest priority, so its on-tick function
+            // runs first whenever the tick periods line up
+            App_SharedStateMachine_Tick1kHz(state_machine);
+
             if (current_time_ms % 1000 == 0)
             {
                 App_SharedStateMachine_Tick1Hz(state_machine);